@@ -0,0 +1,557 @@
+/**
+ * @file book_cache.c
+ * @brief 书籍缓存目录管理实现 — 文件指纹与路径清单。
+ */
+
+#include "book_cache.h"
+#include "sd_storage.h"
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "mbedtls/md5.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "book_cache";
+
+#ifdef CONFIG_BOOK_CACHE_BUDGET_MB
+#define CACHE_BUDGET ((uint64_t)CONFIG_BOOK_CACHE_BUDGET_MB * 1024 * 1024)
+#else
+#define CACHE_BUDGET ((uint64_t)512 * 1024 * 1024)
+#endif
+
+/** 缓存根目录。 */
+#define CACHE_ROOT     SD_MOUNT_POINT "/.cache"
+#define MANIFEST_PATH  CACHE_ROOT "/manifest.bin"
+#define MANIFEST_TMP   CACHE_ROOT "/manifest.tmp"
+
+/** 待删除目录的后缀：淘汰时先改名，再在后台删除其中的文件。 */
+#define RETIRED_SUFFIX ".del"
+
+#define MANIFEST_VERSION 2
+
+/** manifest.bin 文件头，其后是 count 条 manifest_record_t。 */
+typedef struct {
+    char     magic[4];  /**< "BCMF" */
+    uint32_t version;   /**< MANIFEST_VERSION */
+    uint32_t count;     /**< 记录数 */
+    uint32_t clock;     /**< 访问计数器（无 RTC 时也单调递增） */
+} __attribute__((packed)) manifest_header_t;
+
+/** 清单记录：一条书籍路径及其指纹。 */
+typedef struct {
+    uint8_t  digest[16];
+    uint32_t file_size;
+    uint32_t mtime;
+    uint32_t last_access;  /**< 最近一次打开时的访问计数 */
+    uint32_t cache_bytes;  /**< 缓存目录大小（后台整理时更新） */
+    char     path[BOOK_CACHE_PATH_MAX];
+} __attribute__((packed)) manifest_record_t;
+
+/** 后台整理时扫描到的一个缓存目录。 */
+typedef struct {
+    char     name[40];
+    uint64_t bytes;
+    uint32_t last_access;  /**< 0 表示不在清单中（孤立目录） */
+} cache_dir_t;
+
+// 清单（s_lock 保护）
+static manifest_record_t s_entries[BOOK_CACHE_MAX_ENTRIES];
+static size_t s_count = 0;
+static uint32_t s_clock = 0;
+static bool s_loaded = false;
+static bool s_dirty = false;  /**< 访问时间已更新但未写入 manifest.bin */
+
+static SemaphoreHandle_t s_lock = NULL;
+static TaskHandle_t s_trim_task = NULL;
+static bool s_trim_again = false;  /**< 整理期间又有书籍被打开 */
+
+static void lock(void) {
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+}
+
+static void unlock(void) {
+    xSemaphoreGive(s_lock);
+}
+
+esp_err_t book_cache_init(void) {
+    if (s_lock) return ESP_OK;
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        ESP_LOGE(TAG, "Failed to create lock");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  指纹
+// ════════════════════════════════════════════════════════════════
+
+/** @brief 指纹转为缓存目录名（32 位十六进制）。 */
+static void digest_to_hex(const uint8_t digest[16], char hex[33]) {
+    for (int i = 0; i < 16; i++) {
+        snprintf(hex + i * 2, 3, "%02x", digest[i]);
+    }
+}
+
+esp_err_t book_cache_fingerprint(const char *book_path, book_cache_fp_t *fp) {
+    struct stat st;
+    if (stat(book_path, &st) != 0) {
+        return ESP_FAIL;
+    }
+    fp->file_size = (uint32_t)st.st_size;
+    fp->mtime = (uint32_t)st.st_mtime;
+
+    /* 每次调用各自分配采样缓冲区，可在任意 task 中并发计算 */
+    uint8_t *buf = heap_caps_malloc(BOOK_CACHE_SAMPLE_SIZE, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+    FILE *f = fopen(book_path, "rb");
+    if (!f) {
+        heap_caps_free(buf);
+        return ESP_FAIL;
+    }
+
+    mbedtls_md5_context ctx;
+    mbedtls_md5_init(&ctx);
+    mbedtls_md5_starts(&ctx);
+    mbedtls_md5_update(&ctx, (const uint8_t *)&fp->file_size,
+                       sizeof(fp->file_size));
+    mbedtls_md5_update(&ctx, (const uint8_t *)&fp->mtime, sizeof(fp->mtime));
+
+    /* 首块、末块和中间均匀分布的块；小文件的采样范围重叠时整个读入 */
+    uint32_t size = fp->file_size;
+    uint32_t last_end = 0;
+    for (int i = 0; i < BOOK_CACHE_SAMPLES; i++) {
+        uint32_t start = 0;
+        if (size > BOOK_CACHE_SAMPLE_SIZE) {
+            uint64_t span = size - BOOK_CACHE_SAMPLE_SIZE;
+            start = (uint32_t)(span * i / (BOOK_CACHE_SAMPLES - 1));
+            start &= ~(uint32_t)(BOOK_CACHE_SAMPLE_SIZE - 1);
+            if (i == BOOK_CACHE_SAMPLES - 1) start = (uint32_t)span;
+        }
+        if (start < last_end) start = last_end;
+        if (start >= size) break;
+
+        uint32_t len = size - start;
+        if (len > BOOK_CACHE_SAMPLE_SIZE) len = BOOK_CACHE_SAMPLE_SIZE;
+        fseek(f, start, SEEK_SET);
+        size_t n = fread(buf, 1, len, f);
+        mbedtls_md5_update(&ctx, buf, n);
+        last_end = start + len;
+    }
+
+    mbedtls_md5_finish(&ctx, fp->digest);
+    mbedtls_md5_free(&ctx);
+    fclose(f);
+    heap_caps_free(buf);
+    return ESP_OK;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  清单
+// ════════════════════════════════════════════════════════════════
+
+/** @brief 加载 manifest.bin（只在首次调用时读取）。损坏时从空清单开始。 */
+static void manifest_load(void) {
+    if (s_loaded) return;
+    s_loaded = true;
+    s_count = 0;
+
+    FILE *f = fopen(MANIFEST_PATH, "rb");
+    if (!f) return;
+
+    manifest_header_t hdr;
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1 &&
+        memcmp(hdr.magic, "BCMF", 4) == 0 &&
+        hdr.version == MANIFEST_VERSION) {
+        size_t count = hdr.count;
+        if (count > BOOK_CACHE_MAX_ENTRIES) count = BOOK_CACHE_MAX_ENTRIES;
+        s_count = fread(s_entries, sizeof(manifest_record_t), count, f);
+        s_clock = hdr.clock;
+    } else {
+        /* 指纹由文件内容决定，丢弃清单只会让下次打开重新计算指纹 */
+        ESP_LOGW(TAG, "Manifest invalid, starting empty");
+    }
+    fclose(f);
+
+    for (size_t i = 0; i < s_count; i++) {
+        s_entries[i].path[BOOK_CACHE_PATH_MAX - 1] = '\0';
+    }
+}
+
+/** @brief 写入 manifest.bin（先写临时文件再改名，中途断电不损坏旧清单）。 */
+static void manifest_save(void) {
+    FILE *f = fopen(MANIFEST_TMP, "wb");
+    if (!f) {
+        ESP_LOGW(TAG, "Failed to write manifest");
+        return;
+    }
+
+    manifest_header_t hdr;
+    memcpy(hdr.magic, "BCMF", 4);
+    hdr.version = MANIFEST_VERSION;
+    hdr.count = (uint32_t)s_count;
+    hdr.clock = s_clock;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+              fwrite(s_entries, sizeof(manifest_record_t), s_count, f) == s_count;
+    fclose(f);
+
+    if (!ok) {
+        remove(MANIFEST_TMP);
+        return;
+    }
+    /* FAT 上 rename 不覆盖已有文件 */
+    remove(MANIFEST_PATH);
+    rename(MANIFEST_TMP, MANIFEST_PATH);
+    s_dirty = false;
+}
+
+static int find_by_path(const char *path) {
+    for (size_t i = 0; i < s_count; i++) {
+        if (strcmp(s_entries[i].path, path) == 0) return (int)i;
+    }
+    return -1;
+}
+
+static int find_by_digest(const uint8_t digest[16]) {
+    for (size_t i = 0; i < s_count; i++) {
+        if (memcmp(s_entries[i].digest, digest, 16) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void remove_entry(int idx) {
+    memmove(&s_entries[idx], &s_entries[idx + 1],
+            (s_count - idx - 1) * sizeof(manifest_record_t));
+    s_count--;
+}
+
+/** @brief 最久未打开的记录。 */
+static int find_oldest(void) {
+    int oldest = -1;
+    for (size_t i = 0; i < s_count; i++) {
+        if (oldest < 0 ||
+            s_entries[i].last_access < s_entries[oldest].last_access) {
+            oldest = (int)i;
+        }
+    }
+    return oldest;
+}
+
+/** @brief 删除目录及其中的文件（缓存目录内只有平铺的缓存文件）。 */
+static void remove_tree(const char *dir) {
+    char path[320];
+    DIR *d = opendir(dir);
+    if (!d) return;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        int n = snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+        if (n < 0 || (size_t)n >= sizeof(path)) continue;
+        unlink(path);
+    }
+    closedir(d);
+    rmdir(dir);
+}
+
+/**
+ * @brief 把缓存目录改名为待删除目录（持有 s_lock 调用）。
+ *
+ * 改名在 FAT 上只改目录项，立即完成；文件由后台整理 task 删除。
+ * 之后同指纹的书籍再次打开时会得到一个新建的空目录。
+ */
+static void retire_cache_dir(const char *name) {
+    char dir[256];
+    char retired[264];
+    snprintf(dir, sizeof(dir), "%s/%s", CACHE_ROOT, name);
+    snprintf(retired, sizeof(retired), "%s%s", dir, RETIRED_SUFFIX);
+    remove_tree(retired);
+    if (rename(dir, retired) != 0) {
+        remove_tree(dir);
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+//  缓存目录
+// ════════════════════════════════════════════════════════════════
+
+esp_err_t book_cache_open(const char *book_path, char *dir_out,
+                          size_t dir_len) {
+    struct stat st;
+    if (stat(book_path, &st) != 0) {
+        ESP_LOGE(TAG, "Cannot stat %s", book_path);
+        return ESP_FAIL;
+    }
+
+    lock();
+    mkdir(CACHE_ROOT, 0755);
+    manifest_load();
+
+    uint8_t digest[16];
+    int idx = find_by_path(book_path);
+    if (idx >= 0 && s_entries[idx].file_size == (uint32_t)st.st_size &&
+        s_entries[idx].mtime == (uint32_t)st.st_mtime) {
+        /* 快速路径：文件未变，不读采样块；访问时间由后台整理时写入 */
+        memcpy(digest, s_entries[idx].digest, 16);
+        s_entries[idx].last_access = ++s_clock;
+        s_dirty = true;
+    } else {
+        book_cache_fp_t fp;
+        if (book_cache_fingerprint(book_path, &fp) != ESP_OK) {
+            ESP_LOGE(TAG, "Cannot fingerprint %s", book_path);
+            unlock();
+            return ESP_FAIL;
+        }
+        memcpy(digest, fp.digest, 16);
+
+        if (idx >= 0 && memcmp(s_entries[idx].digest, digest, 16) != 0) {
+            /* 同路径文件被替换：旧缓存失效 */
+            ESP_LOGI(TAG, "Book changed on disk: %s", book_path);
+            uint8_t old[16];
+            memcpy(old, s_entries[idx].digest, 16);
+            remove_entry(idx);
+            idx = -1;
+            if (find_by_digest(old) < 0) {
+                char hex[33];
+                digest_to_hex(old, hex);
+                retire_cache_dir(hex);
+            }
+        }
+
+        if (idx < 0) {
+            /* 原路径已不存在的同指纹记录视为被移动的书籍 */
+            int moved = find_by_digest(digest);
+            if (moved >= 0 && access(s_entries[moved].path, F_OK) != 0) {
+                ESP_LOGI(TAG, "Book moved: %s -> %s",
+                         s_entries[moved].path, book_path);
+                idx = moved;
+            } else if (s_count < BOOK_CACHE_MAX_ENTRIES) {
+                idx = (int)s_count++;
+                s_entries[idx].cache_bytes = 0;
+            } else {
+                /* 清单已满：丢弃最久未打开的记录，其目录由后台整理按孤立目录淘汰 */
+                remove_entry(find_oldest());
+                idx = (int)s_count++;
+                s_entries[idx].cache_bytes = 0;
+            }
+        }
+
+        manifest_record_t *rec = &s_entries[idx];
+        memcpy(rec->digest, digest, 16);
+        rec->file_size = fp.file_size;
+        rec->mtime = fp.mtime;
+        rec->last_access = ++s_clock;
+        strncpy(rec->path, book_path, BOOK_CACHE_PATH_MAX - 1);
+        rec->path[BOOK_CACHE_PATH_MAX - 1] = '\0';
+        manifest_save();
+    }
+
+    char hex[33];
+    digest_to_hex(digest, hex);
+    snprintf(dir_out, dir_len, "%s/%s", CACHE_ROOT, hex);
+    bool ok = mkdir(dir_out, 0755) == 0;
+    unlock();
+
+    if (!ok) {
+        struct stat dst;
+        if (stat(dir_out, &dst) != 0) {
+            ESP_LOGE(TAG, "Cannot create %s", dir_out);
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  后台整理：按预算淘汰
+// ════════════════════════════════════════════════════════════════
+
+/** @brief 目录中各文件大小之和。 */
+static uint64_t dir_bytes(const char *dir) {
+    char path[320];
+    uint64_t total = 0;
+    DIR *d = opendir(dir);
+    if (!d) return 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        int n = snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+        if (n < 0 || (size_t)n >= sizeof(path)) continue;
+        struct stat st;
+        if (stat(path, &st) == 0) total += (uint64_t)st.st_size;
+    }
+    closedir(d);
+    return total;
+}
+
+/** @brief 名为 hex 的目录对应记录中最近的访问计数（持有 s_lock 调用）。 */
+static uint32_t dir_last_access(const char *hex) {
+    char entry_hex[33];
+    uint32_t last = 0;
+    for (size_t i = 0; i < s_count; i++) {
+        digest_to_hex(s_entries[i].digest, entry_hex);
+        if (strcmp(entry_hex, hex) == 0 && s_entries[i].last_access > last) {
+            last = s_entries[i].last_access;
+        }
+    }
+    return last;
+}
+
+static int cmp_by_access(const void *a, const void *b) {
+    uint32_t x = ((const cache_dir_t *)a)->last_access;
+    uint32_t y = ((const cache_dir_t *)b)->last_access;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief 扫描缓存目录并淘汰到预算以内。
+ *
+ * 目录扫描与文件删除不持有 s_lock，book_cache_open() 不被阻塞。
+ * 最近打开的书籍（正在阅读）不淘汰。
+ */
+static void trim_once(void) {
+    DIR *root = opendir(CACHE_ROOT);
+    if (!root) return;
+
+    cache_dir_t *dirs = NULL;
+    size_t count = 0;
+    size_t cap = 0;
+    uint64_t total = 0;
+    char path[320];
+
+    struct dirent *entry;
+    while ((entry = readdir(root)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        snprintf(path, sizeof(path), "%s/%s", CACHE_ROOT, entry->d_name);
+        struct stat st;
+        if (stat(path, &st) != 0 || !S_ISDIR(st.st_mode)) continue;
+
+        size_t name_len = strlen(entry->d_name);
+        size_t suffix_len = strlen(RETIRED_SUFFIX);
+        if (name_len > suffix_len &&
+            strcmp(entry->d_name + name_len - suffix_len, RETIRED_SUFFIX) == 0) {
+            remove_tree(path);
+            continue;
+        }
+        if (name_len >= sizeof(dirs[0].name)) continue;
+
+        if (count == cap) {
+            size_t new_cap = cap ? cap * 2 : 32;
+            cache_dir_t *grown = realloc(dirs, new_cap * sizeof(cache_dir_t));
+            if (!grown) break;
+            dirs = grown;
+            cap = new_cap;
+        }
+        strcpy(dirs[count].name, entry->d_name);
+        dirs[count].bytes = dir_bytes(path);
+        total += dirs[count].bytes;
+        count++;
+    }
+    closedir(root);
+
+    // 记录各目录大小和访问时间
+    lock();
+    manifest_load();
+    char hex[33];
+    for (size_t i = 0; i < count; i++) {
+        dirs[i].last_access = dir_last_access(dirs[i].name);
+    }
+    for (size_t i = 0; i < s_count; i++) {
+        digest_to_hex(s_entries[i].digest, hex);
+        for (size_t j = 0; j < count; j++) {
+            if (strcmp(dirs[j].name, hex) == 0) {
+                if (s_entries[i].cache_bytes != (uint32_t)dirs[j].bytes) {
+                    s_entries[i].cache_bytes = (uint32_t)dirs[j].bytes;
+                    s_dirty = true;
+                }
+                break;
+            }
+        }
+    }
+    if (s_dirty) manifest_save();
+    unlock();
+
+    ESP_LOGI(TAG, "Cache usage: %llu KB in %u dirs (budget %llu KB)",
+             (unsigned long long)(total / 1024), (unsigned)count,
+             (unsigned long long)(CACHE_BUDGET / 1024));
+
+    // 孤立目录（访问计数 0）最先淘汰，其后按最久未打开
+    qsort(dirs, count, sizeof(cache_dir_t), cmp_by_access);
+    for (size_t i = 0; i < count && total > CACHE_BUDGET; i++) {
+        cache_dir_t *victim = &dirs[i];
+
+        lock();
+        uint32_t last = dir_last_access(victim->name);
+        // 扫描后被重新打开的，或正在阅读的书籍不淘汰
+        bool evict = last == victim->last_access && last != s_clock;
+        if (evict) {
+            for (size_t j = 0; j < s_count;) {
+                digest_to_hex(s_entries[j].digest, hex);
+                if (strcmp(hex, victim->name) == 0) {
+                    remove_entry((int)j);
+                } else {
+                    j++;
+                }
+            }
+            retire_cache_dir(victim->name);
+            manifest_save();
+        }
+        unlock();
+        if (!evict) continue;
+
+        snprintf(path, sizeof(path), "%s/%s%s", CACHE_ROOT, victim->name,
+                 RETIRED_SUFFIX);
+        remove_tree(path);
+        total -= victim->bytes;
+        ESP_LOGI(TAG, "Evicted cache %s (%llu KB)", victim->name,
+                 (unsigned long long)(victim->bytes / 1024));
+    }
+
+    free(dirs);
+}
+
+static void trim_task(void *param) {
+    (void)param;
+    for (;;) {
+        trim_once();
+
+        lock();
+        if (!s_trim_again) {
+            s_trim_task = NULL;
+            unlock();
+            break;
+        }
+        s_trim_again = false;
+        unlock();
+    }
+    vTaskDelete(NULL);
+}
+
+void book_cache_trim_async(void) {
+    lock();
+    if (s_trim_task) {
+        // 正在整理：结束后再扫描一遍
+        s_trim_again = true;
+    } else if (xTaskCreatePinnedToCore(trim_task, "cache_trim", 4096, NULL,
+                                       tskIDLE_PRIORITY + 1, &s_trim_task,
+                                       0) != pdPASS) {
+        ESP_LOGW(TAG, "Failed to create cache trim task");
+        s_trim_task = NULL;
+    }
+    unlock();
+}
@@ -0,0 +1,96 @@
+/**
+ * @file book_cache.h
+ * @brief 书籍缓存目录管理 — 按内容指纹定位 /sdcard/.cache/<key>。
+ *
+ * 缓存目录以文件指纹命名：文件大小、修改时间和若干 4KB 采样块的 MD5。
+ * 书籍改名或移动后指纹不变，仍找到原有的转换结果和页索引；同路径
+ * 同大小的文件被替换后指纹改变，旧缓存不再被使用。
+ *
+ * 清单文件 /sdcard/.cache/manifest.bin 记录 路径 → 指纹，路径、大小和
+ * 修改时间都未变时直接复用记录的指纹，打开书籍不读取采样块。
+ *
+ * 清单同时记录每个缓存目录的大小和最近打开顺序。打开书籍后由后台
+ * task 统计缓存总量，超出 CONFIG_BOOK_CACHE_BUDGET_MB 时按最久未打开
+ * 淘汰整本书的缓存目录。
+ */
+
+#ifndef BOOK_CACHE_H
+#define BOOK_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 采样块大小。 */
+#define BOOK_CACHE_SAMPLE_SIZE  4096
+
+/** 采样块数量（首块、末块和中间均匀分布的块）。 */
+#define BOOK_CACHE_SAMPLES      5
+
+/** 清单最多记录的书籍数量。 */
+#define BOOK_CACHE_MAX_ENTRIES  128
+
+/** 书籍路径最大长度（含 NUL），与 book_store 一致。 */
+#define BOOK_CACHE_PATH_MAX     280
+
+/** 文件指纹。 */
+typedef struct {
+    uint32_t file_size;   /**< 文件大小（字节） */
+    uint32_t mtime;       /**< 修改时间 */
+    uint8_t  digest[16];  /**< 大小、修改时间与采样块的 MD5 */
+} book_cache_fp_t;
+
+/**
+ * @brief 创建清单锁。
+ *
+ * 须在 book_cache_open() / book_cache_trim_async() 之前、启动阶段的单线程
+ * 上下文中调用一次；重复调用无副作用。
+ *
+ * @return ESP_OK 成功，ESP_ERR_NO_MEM 无法创建锁。
+ */
+esp_err_t book_cache_init(void);
+
+/**
+ * @brief 计算文件指纹。
+ *
+ * 最多读取 BOOK_CACHE_SAMPLES 个 4KB 块，与文件大小无关。
+ *
+ * @param book_path 书籍文件完整路径。
+ * @param fp        输出指纹。
+ * @return ESP_OK 成功，ESP_FAIL 文件不可读，ESP_ERR_NO_MEM 缓冲区分配失败。
+ */
+esp_err_t book_cache_fingerprint(const char *book_path, book_cache_fp_t *fp);
+
+/**
+ * @brief 获取书籍的缓存目录并确保其存在。
+ *
+ * 清单中路径、大小、修改时间一致时直接使用记录的指纹；否则重新计算。
+ * 同一路径的指纹改变时（文件被替换），旧缓存目录在没有其他书籍引用时
+ * 被删除。新路径的指纹与清单中已有书籍相同时（书籍被移动），沿用其
+ * 缓存目录，原路径已不存在的记录随之改为新路径。
+ *
+ * @param book_path 书籍文件完整路径。
+ * @param dir_out   输出缓存目录路径。
+ * @param dir_len   dir_out 容量（缓存根目录 + 33 字节以上，一般 256）。
+ * @return ESP_OK 成功，ESP_FAIL 文件不可读或无法创建目录。
+ */
+esp_err_t book_cache_open(const char *book_path, char *dir_out,
+                          size_t dir_len);
+
+/**
+ * @brief 在后台统计缓存总量并按预算淘汰。
+ *
+ * 立即返回。不在清单中的目录最先淘汰，其余按最久未打开的顺序；
+ * 最近打开的书籍不淘汰。整理进行中再次调用时，结束后重新扫描一遍。
+ */
+void book_cache_trim_async(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOK_CACHE_H */
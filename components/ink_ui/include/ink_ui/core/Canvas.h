@@ -29,6 +29,12 @@ constexpr uint8_t White  = 0xF0;
 constexpr uint8_t Clear  = 0x01;  ///< 哨兵值：透明，不绘制背景
 } // namespace Color
 
+/// 已定位的 glyph：布局时解码和查找一次，绘制时直接使用
+struct PositionedGlyph {
+    const EpdGlyph* glyph;  ///< 字体 glyph 表中的条目
+    int16_t x;              ///< 笔位置，相对 run 起点（像素）
+};
+
 /// 带裁剪区域的绘图引擎
 class Canvas {
 public:
@@ -92,6 +98,11 @@ public:
     void drawTextN(const EpdFont* font, const char* text, int maxBytes,
                    int x, int y, uint8_t color);
 
+    /// 绘制已定位的 glyph 序列，(x, y) 为 run 起点，y 为基线（局部坐标）。
+    /// 不解码 UTF-8、不查找 glyph，整个 run 只取一次 glyph 缓存锁
+    void drawGlyphRun(const EpdFont* font, const PositionedGlyph* glyphs,
+                      int count, int x, int y, uint8_t color);
+
     /// 度量文字渲染后的像素宽度（不写入 framebuffer）
     int measureText(const EpdFont* font, const char* text) const;
 
@@ -120,6 +131,12 @@ private:
     /// 读取单个像素（屏幕绝对逻辑坐标，不做裁剪检查）
     uint8_t getPixel(int absX, int absY) const;
 
+    /// 以 alpha 混合把 glyph bitmap 绘制到 (x0, y0) 为左上角的位置
+    /// （屏幕绝对坐标）：整个 glyph 只裁剪一次，按 framebuffer 物理行
+    /// 顺序成对写入 nibble，混合查 16×16×16 表
+    void blitGlyph(const uint8_t* bitmap, const EpdGlyph* glyph,
+                   int x0, int y0, uint8_t color);
+
     /// 内部绘制单个字符，前进 cursorX（屏幕绝对坐标）
     void drawChar(const EpdFont* font, uint32_t codepoint,
                   int* cursorX, int cursorY, uint8_t color);
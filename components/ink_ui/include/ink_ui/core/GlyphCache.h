@@ -0,0 +1,148 @@
+/**
+ * @file GlyphCache.h
+ * @brief 解压后 glyph bitmap 的 LRU 缓存，按 (字体, glyph 下标) 索引。
+ *
+ * 压缩字体的 glyph 每次绘制前都要 zlib 解压。一页中文里大量重复的字
+ * （的、了、标点）命中缓存后直接使用已解压的 bitmap，不解压也不分配内存。
+ * bitmap 逐个分配在 PSRAM 中，总量超过字节预算时淘汰最久未用的 glyph；
+ * 条目表和解压器状态在首次使用时一次性分配，之后不再增长。
+ *
+ * bitmap() 须在持有 mutex() 时调用，返回的指针在释放锁之前有效；其余
+ * 方法自行加锁。字体经 pfnt_unload() 卸载时自动丢弃该字体的全部 glyph。
+ *
+ * 后台线程可通过 prewarm() 提前解压即将绘制的 glyph：解压在锁外进行，
+ * 不阻塞前台绘制。字体卸载时等待进行中的预热解压结束，并递增字体纪元，
+ * 之前取得纪元的预热请求随之作废，不再访问已卸载的字体。
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+extern "C" {
+#include "epdiy.h"
+}
+
+namespace ink {
+
+/// 解压后 glyph bitmap 的 LRU 缓存
+class GlyphCache {
+public:
+    static constexpr size_t kDefaultBudget = 512 * 1024;  ///< 默认字节预算
+    static constexpr int kMaxEntries = 2048;               ///< 条目数上限
+    static constexpr int kBucketCount = 1024;              ///< 哈希桶数（2 的幂）
+
+    /// 命中统计
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;       ///< 绘制时需要解压的次数
+        uint32_t prewarmed = 0;    ///< 预热解压的 glyph 数
+        uint32_t evictions = 0;
+        uint32_t entries = 0;      ///< 当前缓存的 glyph 数
+        size_t bytes = 0;          ///< 当前缓存的 bitmap 字节数
+    };
+
+    /// 获取单例
+    static GlyphCache& instance();
+
+    GlyphCache(const GlyphCache&) = delete;
+    GlyphCache& operator=(const GlyphCache&) = delete;
+
+    /// 缓存锁：调用 bitmap() 和使用其返回值期间须持有
+    std::mutex& mutex() { return mutex_; }
+
+    /**
+     * @brief 获取 glyph 的 4bpp bitmap（每行 (width + 1) / 2 字节）。
+     *
+     * 未压缩字体直接返回字体数据；压缩字体命中时返回缓存的 bitmap，
+     * 未命中时解压并插入缓存（可能淘汰其他 glyph）。
+     * @return nullptr 如果 glyph 无像素或解压失败
+     */
+    const uint8_t* bitmap(const EpdFont* font, const EpdGlyph* glyph);
+
+    /**
+     * @brief 预热：glyph 未缓存时在锁外解压并插入（后台线程调用）。
+     * @param epoch 请求创建时的 fontEpoch()
+     * @return false 如果纪元已过期（字体可能已卸载），调用方应放弃其余请求
+     */
+    bool prewarm(const EpdFont* font, uint32_t codepoint, uint32_t epoch);
+
+    /// 字体纪元：每次丢弃字体时递增
+    uint32_t fontEpoch() const;
+
+    /// 丢弃某个字体的全部 glyph（等待该字体进行中的预热解压结束）
+    void invalidateFont(const EpdFont* font);
+
+    /// 丢弃全部 glyph
+    void clear();
+
+    /// 当前统计
+    Stats stats() const;
+
+    /// 清零命中、未命中和淘汰计数
+    void resetStats();
+
+private:
+    GlyphCache();
+    ~GlyphCache() = default;
+
+    /// 一个缓存的 glyph
+    struct Entry {
+        const EpdFont* font;
+        uint32_t glyphIndex;   ///< glyph 在字体 glyph 表中的下标
+        uint8_t* data;         ///< PSRAM 中的解压结果，空闲条目为 nullptr
+        uint32_t size;
+        int16_t prev;          ///< LRU 链表（表头最近使用）
+        int16_t next;
+        int16_t chain;         ///< 同一哈希桶的下一个条目；空闲条目链
+    };
+
+    /// 分配条目表、哈希桶和解压器（首次使用时调用）
+    bool init();
+
+    /// 查找条目，未找到返回 -1
+    int find(const EpdFont* font, uint32_t glyphIndex) const;
+
+    /// 按需淘汰后插入已解压的 bitmap（接管 data），返回条目下标；失败返回 -1
+    int insert(const EpdFont* font, uint32_t glyphIndex, uint8_t* data,
+               size_t size);
+
+    /// 移出条目并释放 bitmap
+    void remove(int index);
+
+    /// 条目移到 LRU 表头
+    void touch(int index);
+
+    void linkFront(int index);
+    void unlink(int index);
+
+    static int bucketOf(const EpdFont* font, uint32_t glyphIndex);
+
+    /// pfnt_unload() 回调
+    static void onFontUnload(const EpdFont* font);
+
+    mutable std::mutex mutex_;
+    size_t budget_;
+
+    Entry* entries_ = nullptr;
+    int16_t* buckets_ = nullptr;
+    void* decomp_ = nullptr;      ///< tinfl_decompressor，绘制时的未命中共用
+    void* prewarmDecomp_ = nullptr;  ///< 预热线程专用的解压器（锁外使用）
+    uint8_t* scratch_ = nullptr;  ///< 条目表分配失败时的临时解压结果
+    bool initTried_ = false;
+
+    const EpdFont* prewarming_ = nullptr;  ///< 正在锁外预热解压的字体
+    std::condition_variable prewarmDone_;
+    uint32_t epoch_ = 0;
+
+    int16_t head_ = -1;           ///< 最近使用
+    int16_t tail_ = -1;           ///< 最久未用
+    int16_t freeList_ = -1;
+
+    Stats stats_;
+};
+
+} // namespace ink
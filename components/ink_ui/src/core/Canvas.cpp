@@ -7,6 +7,7 @@
  */
 
 #include "ink_ui/core/Canvas.h"
+#include "ink_ui/core/GlyphCache.h"
 #include "ink_ui/core/Profiler.h"
 
 #include <cstdlib>
@@ -14,7 +15,7 @@
 
 extern "C" {
 #include "epdiy.h"
-#include <miniz.h>
+#include "ui_font_pfnt.h"
 }
 
 namespace ink {
@@ -351,38 +352,75 @@ static uint32_t nextCodepoint(const char** str) {
 }
 
 // ============================================================================
-//  Glyph 解压 (内部 static)
+//  glyph 混合 (private)
 // ============================================================================
 
-/// 解压 zlib 压缩的 glyph bitmap
-static uint8_t* decompressGlyph(const EpdFont* font, const EpdGlyph* glyph,
-                                 size_t bitmapSize) {
-    auto* buf = static_cast<uint8_t*>(malloc(bitmapSize));
-    if (!buf) return nullptr;
-
-    auto* decomp = static_cast<tinfl_decompressor*>(
-        malloc(sizeof(tinfl_decompressor)));
-    if (!decomp) {
-        free(buf);
-        return nullptr;
+/// 4bpp alpha 混合表：v[fg][alpha][bg] = bg + alpha * (fg - bg) / 15
+struct BlendLut {
+    uint8_t v[16][16][16];
+    constexpr BlendLut() : v{} {
+        for (int fg = 0; fg < 16; fg++)
+            for (int a = 0; a < 16; a++)
+                for (int bg = 0; bg < 16; bg++)
+                    v[fg][a][bg] = static_cast<uint8_t>(bg + a * (fg - bg) / 15);
     }
-    tinfl_init(decomp);
-
-    size_t srcSize = glyph->compressed_size;
-    size_t outSize = bitmapSize;
-    tinfl_status status = tinfl_decompress(
-        decomp,
-        &font->bitmap[glyph->data_offset],
-        &srcSize,
-        buf, buf, &outSize,
-        TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
-    free(decomp);
-
-    if (status != TINFL_STATUS_DONE) {
-        free(buf);
-        return nullptr;
+};
+static constexpr BlendLut kBlend;
+
+void Canvas::blitGlyph(const uint8_t* bitmap, const EpdGlyph* glyph,
+                       int x0, int y0, uint8_t color) {
+    // 一次性把 glyph 矩形裁剪到 clip 和屏幕范围（屏幕绝对逻辑坐标）
+    int left = clip_.x > 0 ? clip_.x : 0;
+    int top = clip_.y > 0 ? clip_.y : 0;
+    int right = clip_.right() < kFbPhysHeight ? clip_.right() : kFbPhysHeight;
+    int bottom = clip_.bottom() < kFbPhysWidth ? clip_.bottom() : kFbPhysWidth;
+
+    int bx0 = left - x0 > 0 ? left - x0 : 0;
+    int by0 = top - y0 > 0 ? top - y0 : 0;
+    int bx1 = right - x0 < glyph->width ? right - x0 : glyph->width;
+    int by1 = bottom - y0 < glyph->height ? bottom - y0 : glyph->height;
+    if (bx0 >= bx1 || by0 >= by1) return;
+
+    int byteWidth = glyph->width / 2 + glyph->width % 2;
+    const uint8_t* lut = &kBlend.v[color >> 4][0][0];
+
+    // glyph 的一列是物理 framebuffer 的一行（px = ly, py = 539 - lx），
+    // 沿列向下即沿物理行向右，相邻两像素共用一个字节（偶 px 为低 nibble）
+    for (int bx = bx0; bx < bx1; bx++) {
+        uint8_t* row = fb_ + ((kFbPhysHeight - 1) - (x0 + bx)) * (kFbPhysWidth / 2);
+        const uint8_t* src = bitmap + bx / 2;
+        int shift = (bx & 1) * 4;
+
+        int by = by0;
+        int px = y0 + by;
+        if (px & 1) {
+            // 起点在字节高 nibble
+            uint8_t a = (src[by * byteWidth] >> shift) & 0x0F;
+            if (a) {
+                uint8_t* p = row + px / 2;
+                *p = static_cast<uint8_t>((*p & 0x0F) | (lut[a * 16 + (*p >> 4)] << 4));
+            }
+            by++;
+            px++;
+        }
+
+        // 不跳过全透明的像素对：alpha 0 查表得到原背景，结果不变；抗锯齿
+        // glyph 的透明与不透明交错无规律，逐对判断的分支预测失败比混合更贵
+        uint8_t* p = row + px / 2;
+        for (; by + 1 < by1; by += 2, p++) {
+            uint8_t a0 = (src[by * byteWidth] >> shift) & 0x0F;
+            uint8_t a1 = (src[(by + 1) * byteWidth] >> shift) & 0x0F;
+            uint8_t b = *p;
+            *p = static_cast<uint8_t>(lut[a0 * 16 + (b & 0x0F)] |
+                                      (lut[a1 * 16 + (b >> 4)] << 4));
+        }
+
+        if (by < by1) {
+            // 终点在字节低 nibble
+            uint8_t a = (src[by * byteWidth] >> shift) & 0x0F;
+            if (a) *p = static_cast<uint8_t>((*p & 0xF0) | lut[a * 16 + (*p & 0x0F)]);
+        }
     }
-    return buf;
 }
 
 // ============================================================================
@@ -391,69 +429,21 @@ static uint8_t* decompressGlyph(const EpdFont* font, const EpdGlyph* glyph,
 
 void Canvas::drawChar(const EpdFont* font, uint32_t codepoint,
                       int* cursorX, int cursorY, uint8_t color) {
-    const EpdGlyph* glyph = epd_get_glyph(font, codepoint);
+    const EpdGlyph* glyph = pfnt_get_glyph(font, codepoint);
     if (!glyph) return;
 
-    uint16_t w = glyph->width;
-    uint16_t h = glyph->height;
-    int byteWidth = (w / 2 + w % 2);
-    size_t bitmapSize = static_cast<size_t>(byteWidth) * h;
-
-    const uint8_t* bitmap = nullptr;
-    bool needFree = false;
-
-    if (bitmapSize > 0) {
-        if (font->compressed) {
-            bitmap = decompressGlyph(font, glyph, bitmapSize);
-            if (!bitmap) {
-                *cursorX += glyph->advance_x;
-                return;
-            }
-            needFree = true;
-        } else {
-            bitmap = &font->bitmap[glyph->data_offset];
-        }
+    // 压缩字体的 bitmap 取自 glyph 缓存，绘制期间持有缓存锁防止被淘汰
+    GlyphCache& cache = GlyphCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    const uint8_t* bitmap = cache.bitmap(font, glyph);
+    if (!bitmap) {
+        *cursorX += glyph->advance_x;
+        return;
     }
 
     // cursorX/cursorY 是屏幕绝对坐标
-    uint8_t fg4 = color >> 4;
-
-    for (int by = 0; by < h; by++) {
-        int absY = cursorY - glyph->top + by;
-        if (absY < clip_.y || absY >= clip_.bottom()) continue;
-
-        for (int bx = 0; bx < w; bx++) {
-            int absX = *cursorX + glyph->left + bx;
-            if (absX < clip_.x || absX >= clip_.right()) continue;
-
-            // 提取 4bpp alpha
-            uint8_t bm = bitmap[by * byteWidth + bx / 2];
-            uint8_t alpha;
-            if ((bx & 1) == 0) {
-                alpha = bm & 0x0F;
-            } else {
-                alpha = bm >> 4;
-            }
-
-            if (alpha == 0) continue;
-
-            if (alpha == 0x0F) {
-                // 完全不透明，直接写入前景色
-                setPixel(absX, absY, color);
-            } else {
-                // 读取实际背景像素进行 alpha 混合
-                uint8_t bg4 = getPixel(absX, absY) >> 4;
-                uint8_t color4 = static_cast<uint8_t>(
-                    bg4 + static_cast<int>(alpha) *
-                    (static_cast<int>(fg4) - static_cast<int>(bg4)) / 15);
-                setPixel(absX, absY, color4 << 4);
-            }
-        }
-    }
-
-    if (needFree) {
-        free(const_cast<uint8_t*>(bitmap));
-    }
+    blitGlyph(bitmap, glyph, *cursorX + glyph->left, cursorY - glyph->top,
+              color);
     *cursorX += glyph->advance_x;
 }
 
@@ -509,6 +499,24 @@ void Canvas::drawTextN(const EpdFont* font, const char* text, int maxBytes,
     }
 }
 
+void Canvas::drawGlyphRun(const EpdFont* font, const PositionedGlyph* glyphs,
+                          int count, int x, int y, uint8_t color) {
+    if (!fb_ || !font || !glyphs || count <= 0 || clip_.isEmpty()) return;
+
+    int originX = clip_.x + x;
+    int originY = clip_.y + y;
+
+    GlyphCache& cache = GlyphCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    for (int i = 0; i < count; i++) {
+        const EpdGlyph* glyph = glyphs[i].glyph;
+        const uint8_t* bitmap = cache.bitmap(font, glyph);
+        if (!bitmap) continue;
+        blitGlyph(bitmap, glyph, originX + glyphs[i].x + glyph->left,
+                  originY - glyph->top, color);
+    }
+}
+
 int Canvas::measureText(const EpdFont* font, const char* text) const {
     if (!font || !text || *text == '\0') return 0;
 
@@ -516,7 +524,7 @@ int Canvas::measureText(const EpdFont* font, const char* text) const {
     uint32_t cp;
     while ((cp = nextCodepoint(&text)) != 0) {
         if (cp == '\n') break;
-        const EpdGlyph* glyph = epd_get_glyph(font, cp);
+        const EpdGlyph* glyph = pfnt_get_glyph(font, cp);
         if (glyph) {
             width += glyph->advance_x;
         }
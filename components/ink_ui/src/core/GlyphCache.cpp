@@ -0,0 +1,312 @@
+/**
+ * @file GlyphCache.cpp
+ * @brief 解压后 glyph bitmap 的 LRU 缓存实现。
+ */
+
+#include "ink_ui/core/GlyphCache.h"
+
+#include <cstring>
+
+extern "C" {
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "ui_font_pfnt.h"
+#include <miniz.h>
+}
+
+static const char* TAG = "ink::GlyphCache";
+
+#ifdef CONFIG_INKUI_GLYPH_CACHE_KB
+static constexpr size_t kBudget = CONFIG_INKUI_GLYPH_CACHE_KB * 1024;
+#else
+static constexpr size_t kBudget = ink::GlyphCache::kDefaultBudget;
+#endif
+
+namespace ink {
+
+/// 解压 zlib 压缩的 glyph bitmap 到新分配的 PSRAM 缓冲区
+/// @param decomp 复用的解压器，nullptr 时临时分配
+static uint8_t* decompressGlyph(const EpdFont* font, const EpdGlyph* glyph,
+                                size_t bitmapSize, void* decomp) {
+    auto* buf = static_cast<uint8_t*>(
+        heap_caps_malloc(bitmapSize, MALLOC_CAP_SPIRAM));
+    if (!buf) return nullptr;
+
+    auto* d = static_cast<tinfl_decompressor*>(decomp);
+    if (!d) {
+        d = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+        if (!d) {
+            heap_caps_free(buf);
+            return nullptr;
+        }
+    }
+    tinfl_init(d);
+
+    size_t srcSize = glyph->compressed_size;
+    size_t outSize = bitmapSize;
+    tinfl_status status = tinfl_decompress(
+        d,
+        &font->bitmap[glyph->data_offset],
+        &srcSize,
+        buf, buf, &outSize,
+        TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    if (d != decomp) free(d);
+
+    if (status != TINFL_STATUS_DONE) {
+        heap_caps_free(buf);
+        return nullptr;
+    }
+    return buf;
+}
+
+// ============================================================================
+//  单例与初始化
+// ============================================================================
+
+GlyphCache& GlyphCache::instance() {
+    static GlyphCache cache;
+    return cache;
+}
+
+GlyphCache::GlyphCache() : budget_(kBudget) {
+    pfnt_set_unload_hook(&GlyphCache::onFontUnload);
+}
+
+bool GlyphCache::init() {
+    initTried_ = true;
+    entries_ = static_cast<Entry*>(
+        heap_caps_malloc(sizeof(Entry) * kMaxEntries, MALLOC_CAP_SPIRAM));
+    buckets_ = static_cast<int16_t*>(
+        heap_caps_malloc(sizeof(int16_t) * kBucketCount, MALLOC_CAP_SPIRAM));
+    decomp_ = heap_caps_malloc(sizeof(tinfl_decompressor), MALLOC_CAP_SPIRAM);
+    prewarmDecomp_ = heap_caps_malloc(sizeof(tinfl_decompressor),
+                                      MALLOC_CAP_SPIRAM);
+    if (!entries_ || !buckets_ || !decomp_ || !prewarmDecomp_) {
+        ESP_LOGW(TAG, "Failed to allocate glyph cache, glyphs are not cached");
+        // 未命中时改为每次临时分配解压器
+        heap_caps_free(entries_);
+        heap_caps_free(buckets_);
+        heap_caps_free(decomp_);
+        heap_caps_free(prewarmDecomp_);
+        entries_ = nullptr;
+        buckets_ = nullptr;
+        decomp_ = nullptr;
+        prewarmDecomp_ = nullptr;
+        return false;
+    }
+
+    for (int i = 0; i < kBucketCount; i++) buckets_[i] = -1;
+    for (int i = 0; i < kMaxEntries; i++) {
+        entries_[i] = {};
+        entries_[i].chain = static_cast<int16_t>(i + 1 < kMaxEntries ? i + 1 : -1);
+    }
+    freeList_ = 0;
+    head_ = tail_ = -1;
+
+    ESP_LOGI(TAG, "Glyph cache ready (%u KB budget, %d entries)",
+             (unsigned)(budget_ / 1024), kMaxEntries);
+    return true;
+}
+
+// ============================================================================
+//  查找与插入
+// ============================================================================
+
+const uint8_t* GlyphCache::bitmap(const EpdFont* font, const EpdGlyph* glyph) {
+    if (!font || !glyph) return nullptr;
+    size_t byteWidth = glyph->width / 2 + glyph->width % 2;
+    size_t bitmapSize = byteWidth * glyph->height;
+    if (bitmapSize == 0) return nullptr;
+    if (!font->compressed) return &font->bitmap[glyph->data_offset];
+
+    if (!initTried_) init();
+
+    if (entries_) {
+        uint32_t glyphIndex = static_cast<uint32_t>(glyph - font->glyph);
+        int index = find(font, glyphIndex);
+        if (index >= 0) {
+            stats_.hits++;
+            touch(index);
+            return entries_[index].data;
+        }
+        stats_.misses++;
+        uint8_t* data = decompressGlyph(font, glyph, bitmapSize, decomp_);
+        if (!data) return nullptr;
+        index = insert(font, glyphIndex, data, bitmapSize);
+        return index >= 0 ? entries_[index].data : nullptr;
+    }
+
+    // 无条目表：逐次解压到临时缓冲区（锁内有效）
+    stats_.misses++;
+    heap_caps_free(scratch_);
+    scratch_ = decompressGlyph(font, glyph, bitmapSize, decomp_);
+    return scratch_;
+}
+
+int GlyphCache::find(const EpdFont* font, uint32_t glyphIndex) const {
+    for (int i = buckets_[bucketOf(font, glyphIndex)]; i >= 0;
+         i = entries_[i].chain) {
+        if (entries_[i].glyphIndex == glyphIndex && entries_[i].font == font) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool GlyphCache::prewarm(const EpdFont* font, uint32_t codepoint,
+                         uint32_t epoch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (epoch != epoch_) return false;
+    if (!font || !font->compressed) return true;
+    if (!initTried_) init();
+    if (!entries_) return true;
+
+    // 纪元有效时字体尚未卸载：卸载回调需要先取得锁
+    const EpdGlyph* glyph = pfnt_get_glyph(font, codepoint);
+    if (!glyph) return true;
+    size_t byteWidth = glyph->width / 2 + glyph->width % 2;
+    size_t bitmapSize = byteWidth * glyph->height;
+    uint32_t glyphIndex = static_cast<uint32_t>(glyph - font->glyph);
+    if (bitmapSize == 0 || find(font, glyphIndex) >= 0) return true;
+
+    // 锁外解压：prewarming_ 使卸载回调等待解压结束
+    prewarming_ = font;
+    lock.unlock();
+    uint8_t* data = decompressGlyph(font, glyph, bitmapSize, prewarmDecomp_);
+    lock.lock();
+    prewarming_ = nullptr;
+    prewarmDone_.notify_all();
+
+    if (!data) return true;
+    if (find(font, glyphIndex) >= 0) {
+        // 解压期间前台已绘制该字
+        heap_caps_free(data);
+        return true;
+    }
+    if (insert(font, glyphIndex, data, bitmapSize) >= 0) stats_.prewarmed++;
+    return true;
+}
+
+int GlyphCache::insert(const EpdFont* font, uint32_t glyphIndex, uint8_t* data,
+                       size_t size) {
+    while (tail_ >= 0 && (freeList_ < 0 || stats_.bytes + size > budget_)) {
+        remove(tail_);
+        stats_.evictions++;
+    }
+    if (freeList_ < 0) {
+        heap_caps_free(data);
+        return -1;
+    }
+
+    int index = freeList_;
+    Entry& e = entries_[index];
+    freeList_ = e.chain;
+
+    e.font = font;
+    e.glyphIndex = glyphIndex;
+    e.data = data;
+    e.size = static_cast<uint32_t>(size);
+    int bucket = bucketOf(font, glyphIndex);
+    e.chain = buckets_[bucket];
+    buckets_[bucket] = static_cast<int16_t>(index);
+    linkFront(index);
+
+    stats_.entries++;
+    stats_.bytes += size;
+    return index;
+}
+
+void GlyphCache::remove(int index) {
+    Entry& e = entries_[index];
+    unlink(index);
+
+    // 从哈希桶链表中摘除
+    int16_t* link = &buckets_[bucketOf(e.font, e.glyphIndex)];
+    while (*link != index) link = &entries_[*link].chain;
+    *link = e.chain;
+
+    heap_caps_free(e.data);
+    stats_.entries--;
+    stats_.bytes -= e.size;
+
+    e = {};
+    e.chain = freeList_;
+    freeList_ = static_cast<int16_t>(index);
+}
+
+// ============================================================================
+//  LRU 链表
+// ============================================================================
+
+void GlyphCache::touch(int index) {
+    if (head_ == index) return;
+    unlink(index);
+    linkFront(index);
+}
+
+void GlyphCache::linkFront(int index) {
+    Entry& e = entries_[index];
+    e.prev = -1;
+    e.next = head_;
+    if (head_ >= 0) entries_[head_].prev = static_cast<int16_t>(index);
+    head_ = static_cast<int16_t>(index);
+    if (tail_ < 0) tail_ = static_cast<int16_t>(index);
+}
+
+void GlyphCache::unlink(int index) {
+    Entry& e = entries_[index];
+    if (e.prev >= 0) entries_[e.prev].next = e.next; else head_ = e.next;
+    if (e.next >= 0) entries_[e.next].prev = e.prev; else tail_ = e.prev;
+    e.prev = e.next = -1;
+}
+
+int GlyphCache::bucketOf(const EpdFont* font, uint32_t glyphIndex) {
+    uint32_t h = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(font) >> 4);
+    h = (h * 0x9E3779B1u) ^ (glyphIndex * 0x85EBCA6Bu);
+    h ^= h >> 15;
+    return static_cast<int>(h & (kBucketCount - 1));
+}
+
+// ============================================================================
+//  失效与统计
+// ============================================================================
+
+uint32_t GlyphCache::fontEpoch() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return epoch_;
+}
+
+void GlyphCache::invalidateFont(const EpdFont* font) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    prewarmDone_.wait(lock, [&]() { return prewarming_ != font; });
+    epoch_++;
+    if (!entries_) return;
+    for (int i = 0; i < kMaxEntries; i++) {
+        if (entries_[i].data && entries_[i].font == font) remove(i);
+    }
+}
+
+void GlyphCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!entries_) return;
+    while (tail_ >= 0) remove(tail_);
+}
+
+GlyphCache::Stats GlyphCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void GlyphCache::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.hits = 0;
+    stats_.misses = 0;
+    stats_.prewarmed = 0;
+    stats_.evictions = 0;
+}
+
+void GlyphCache::onFontUnload(const EpdFont* font) {
+    instance().invalidateFont(font);
+}
+
+} // namespace ink
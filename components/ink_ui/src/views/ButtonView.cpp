@@ -6,6 +6,10 @@
 #include "ink_ui/views/ButtonView.h"
 #include "ink_ui/core/Canvas.h"
 
+extern "C" {
+#include "ui_font_pfnt.h"
+}
+
 namespace ink {
 
 ButtonView::ButtonView() {
@@ -130,7 +134,7 @@ Size ButtonView::intrinsicSize() const {
                 cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
             }
             p += len;
-            const EpdGlyph* glyph = epd_get_glyph(font_, cp);
+            const EpdGlyph* glyph = pfnt_get_glyph(font_, cp);
             if (glyph) textW += glyph->advance_x;
         }
     }
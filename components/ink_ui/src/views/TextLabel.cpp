@@ -9,6 +9,10 @@
 #include <cstring>
 #include <vector>
 
+extern "C" {
+#include "ui_font_pfnt.h"
+}
+
 namespace ink {
 
 TextLabel::TextLabel() {
@@ -157,7 +161,7 @@ Size TextLabel::intrinsicSize() const {
                     }
                     tp += len;
 
-                    const EpdGlyph* glyph = epd_get_glyph(font_, cp);
+                    const EpdGlyph* glyph = pfnt_get_glyph(font_, cp);
                     if (glyph) {
                         w += glyph->advance_x;
                     }
@@ -0,0 +1,144 @@
+/**
+ * @file JobScheduler.h
+ * @brief 后台作业调度 — 时间片协作让出、优先级让步、取消与运行时间统计。
+ *
+ * 分页、编码转换、UTF-8 校验等后台作业各自运行在 FreeRTOS task 中。
+ * task 在循环中调用 JobSlice::yieldPoint()：时间片未用完时只读一次时钟
+ * 就返回，用完才让出 CPU（IDLE task 借此喂看门狗），不再每处理一页或
+ * 一段就固定睡眠一个 tick。有更高优先级的作业正在运行时，低优先级作业
+ * 在时间片用完后让出一整个时间片，把 CPU 和 SD 带宽让给前者。
+ *
+ * 取消由作业的拥有者发起（Job::cancel()），让出点返回 false 时 task
+ * 应尽快退出。作业结束时输出各 task 累计运行时间占墙钟时间的比例。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace ink {
+
+/// 后台作业优先级
+enum class JobPriority : uint8_t {
+    Low = 0,     ///< 可推迟的检查（UTF-8 校验）
+    Normal = 1,  ///< 后台预取（编码转换）
+    High = 2,    ///< 用户正在等待结果（分页）
+};
+
+/// 作业运行统计
+struct JobStats {
+    int64_t runUs = 0;    ///< 各 task 在让出点之间运行的时间之和（不含让出和阻塞等待）
+    int64_t wallUs = 0;   ///< 从 start() 到 finish()（未结束时到当前）的墙钟时间
+    uint32_t yields = 0;  ///< 时间片用完让出的次数
+};
+
+/// 后台作业：由拥有者持有，可由多个 task 共同执行
+class Job {
+public:
+    Job(const char* name, JobPriority priority);
+    ~Job() = default;
+
+    // 不可拷贝
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    /// 创建作业 task 之前由拥有者调用：清除取消标记和统计
+    void start();
+
+    /// 作业的全部 task 结束后调用：输出运行时间占比。未 start() 时无操作。
+    /// 强制删除的 task 来不及退出时间片，其运行计数在这里一并扣除
+    void finish();
+
+    /// 请求取消（任意线程）
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+    /// 是否已请求取消
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    const char* name() const { return name_; }
+    JobPriority priority() const { return priority_; }
+
+    /// 当前统计（任意线程）
+    JobStats stats() const;
+
+private:
+    friend class JobSlice;
+
+    const char* name_;
+    JobPriority priority_;
+    std::atomic<bool> cancelled_{false};
+    std::atomic<bool> active_{false};      ///< start() 之后、finish() 之前
+    std::atomic<int64_t> runUs_{0};
+    std::atomic<uint32_t> yields_{0};
+    std::atomic<int64_t> startUs_{0};
+    std::atomic<int64_t> endUs_{0};
+    std::atomic<int> running_{0};          ///< 本作业正在运行的 task 数
+    std::atomic<uint32_t> generation_{0};  ///< finish() 递增，此前的时间片作废
+};
+
+/// 一个 task 执行作业时的时间片状态，作为 task 栈上的局部对象使用
+class JobSlice {
+public:
+    explicit JobSlice(Job& job);
+    ~JobSlice();
+
+    // 不可拷贝
+    JobSlice(const JobSlice&) = delete;
+    JobSlice& operator=(const JobSlice&) = delete;
+
+    /// 协作让出点：时间片用完时让出 CPU
+    /// @return false 如果作业已被取消，调用者应尽快退出
+    bool yieldPoint();
+
+    /// 阻塞等待（队列、条件变量等）之前调用：等待时间不计入运行时间，
+    /// 也不算作正在运行，低优先级作业不必为它让步
+    void beginWait();
+
+    /// 阻塞等待结束后调用。等待至少一个 tick 时 task 确实让出过 CPU，
+    /// 开始新的时间片；否则（如队列中已有数据）继续计入当前时间片
+    void endWait();
+
+private:
+    /// 结算当前时间片并让出 CPU
+    void yield(int64_t now);
+
+    /// 开始/结束计入正在运行。作业已 finish() 时无操作：被强制删除的
+    /// task 遗留的 worker 在之后退出，不会重复扣除
+    void enter();
+    void leave();
+
+    Job& job_;
+    uint32_t generation_;
+    int64_t budgetUs_;
+    int64_t runStart_;       ///< 当前连续运行段的起点
+    int64_t sliceUsed_ = 0;  ///< 当前时间片中此前各运行段的时长
+    int64_t waitStart_ = 0;
+    bool waiting_ = false;
+};
+
+/// 后台作业调度策略：各优先级的时间片长度与正在运行的作业计数
+class JobScheduler {
+public:
+    /// 各优先级的时间片长度：越重要的作业一次连续运行越久
+    static constexpr int kHighBudgetMs = 50;
+    static constexpr int kNormalBudgetMs = 20;
+    static constexpr int kLowBudgetMs = 10;
+
+    /// 优先级对应的时间片长度（毫秒）
+    static int budgetMs(JobPriority priority);
+
+    /// 是否有高于 priority 的作业正在运行（不在让出或阻塞等待中）
+    static bool higherRunning(JobPriority priority);
+
+private:
+    friend class Job;
+    friend class JobSlice;
+
+    static void enter(JobPriority priority);
+    static void leave(JobPriority priority);
+
+    static std::atomic<int> running_[3];  ///< 各优先级正在运行的 task 数
+};
+
+}  // namespace ink
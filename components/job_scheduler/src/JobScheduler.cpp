@@ -0,0 +1,168 @@
+/**
+ * @file JobScheduler.cpp
+ * @brief 后台作业调度实现。
+ */
+
+#include "job_scheduler/JobScheduler.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+extern "C" {
+#include "esp_log.h"
+#include "esp_timer.h"
+}
+
+static const char* TAG = "JobScheduler";
+
+namespace ink {
+
+// ════════════════════════════════════════════════════════════════
+//  Job
+// ════════════════════════════════════════════════════════════════
+
+Job::Job(const char* name, JobPriority priority)
+    : name_(name), priority_(priority) {}
+
+void Job::start() {
+    cancelled_ = false;
+    runUs_ = 0;
+    yields_ = 0;
+    startUs_ = esp_timer_get_time();
+    endUs_ = 0;
+    active_ = true;
+}
+
+void Job::finish() {
+    // 强制删除的 task 停在时间片中，析构函数不会运行：扣除它们的计数，
+    // 否则低优先级作业会一直为不存在的作业让步
+    generation_++;
+    int stale = running_.exchange(0);
+    for (int i = 0; i < stale; i++) JobScheduler::leave(priority_);
+
+    if (!active_.exchange(false)) return;
+    endUs_ = esp_timer_get_time();
+
+    JobStats s = stats();
+    int64_t wallMs = s.wallUs / 1000;
+    // 多个 task 并行时运行时间可超过墙钟时间，占比按单核计
+    int share = s.wallUs > 0 ? static_cast<int>(s.runUs * 100 / s.wallUs) : 0;
+    ESP_LOGI(TAG, "%s: ran %lld ms of %lld ms (%d%% of one core), %u yields",
+             name_, (long long)(s.runUs / 1000), (long long)wallMs, share,
+             (unsigned)s.yields);
+}
+
+JobStats Job::stats() const {
+    JobStats s;
+    s.runUs = runUs_;
+    s.yields = yields_;
+    int64_t start = startUs_;
+    int64_t end = endUs_;
+    if (start > 0) {
+        s.wallUs = (end > 0 ? end : esp_timer_get_time()) - start;
+    }
+    return s;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  JobSlice
+// ════════════════════════════════════════════════════════════════
+
+JobSlice::JobSlice(Job& job)
+    : job_(job),
+      generation_(job.generation_),
+      budgetUs_(static_cast<int64_t>(JobScheduler::budgetMs(job.priority())) * 1000),
+      runStart_(esp_timer_get_time()) {
+    enter();
+}
+
+JobSlice::~JobSlice() {
+    if (waiting_) return;
+    job_.runUs_ += esp_timer_get_time() - runStart_;
+    leave();
+}
+
+bool JobSlice::yieldPoint() {
+    if (job_.cancelled()) return false;
+    int64_t now = esp_timer_get_time();
+    if (sliceUsed_ + (now - runStart_) >= budgetUs_) yield(now);
+    return !job_.cancelled();
+}
+
+void JobSlice::beginWait() {
+    if (waiting_) return;
+    waiting_ = true;
+    waitStart_ = esp_timer_get_time();
+    job_.runUs_ += waitStart_ - runStart_;
+    sliceUsed_ += waitStart_ - runStart_;
+    leave();
+}
+
+void JobSlice::endWait() {
+    if (!waiting_) return;
+    waiting_ = false;
+    enter();
+    runStart_ = esp_timer_get_time();
+    if (runStart_ - waitStart_ >= portTICK_PERIOD_MS * 1000) sliceUsed_ = 0;
+}
+
+void JobSlice::yield(int64_t now) {
+    job_.runUs_ += now - runStart_;
+    job_.yields_++;
+
+    // 有更高优先级的作业在运行时让出一整个时间片，否则只让出一个 tick，
+    // 足够 IDLE task 和同核的低优先级 task 运行
+    TickType_t ticks = 1;
+    if (JobScheduler::higherRunning(job_.priority_)) {
+        ticks = pdMS_TO_TICKS(budgetUs_ / 1000);
+        if (ticks == 0) ticks = 1;
+    }
+    leave();
+    vTaskDelay(ticks);
+    enter();
+    sliceUsed_ = 0;
+    runStart_ = esp_timer_get_time();
+}
+
+void JobSlice::enter() {
+    if (generation_ != job_.generation_) return;
+    job_.running_++;
+    JobScheduler::enter(job_.priority_);
+}
+
+void JobSlice::leave() {
+    if (generation_ != job_.generation_) return;
+    job_.running_--;
+    JobScheduler::leave(job_.priority_);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  JobScheduler
+// ════════════════════════════════════════════════════════════════
+
+std::atomic<int> JobScheduler::running_[3] = {};
+
+int JobScheduler::budgetMs(JobPriority priority) {
+    switch (priority) {
+        case JobPriority::High:   return kHighBudgetMs;
+        case JobPriority::Normal: return kNormalBudgetMs;
+        default:                  return kLowBudgetMs;
+    }
+}
+
+bool JobScheduler::higherRunning(JobPriority priority) {
+    for (int p = static_cast<int>(priority) + 1; p < 3; p++) {
+        if (running_[p].load(std::memory_order_relaxed) > 0) return true;
+    }
+    return false;
+}
+
+void JobScheduler::enter(JobPriority priority) {
+    running_[static_cast<int>(priority)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void JobScheduler::leave(JobPriority priority) {
+    running_[static_cast<int>(priority)].fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace ink
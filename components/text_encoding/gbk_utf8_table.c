@@ -0,0 +1,3288 @@
+/**
+ * @file gbk_utf8_table.c
+ * @brief GBK→UTF-8 预编码表（由 generate_gbk_table.py 自动生成）。
+ *
+ * 索引同 gbk_to_unicode。
+ * 值: {UTF-8 字节 0-2, 字节数}, 无效映射预编码为 U+FFFD
+ */
+
+#include <stdint.h>
+
+const uint8_t gbk_utf8_table[126][190][4] = {
+    /* 0x81 */ {
+        {0xE4,0xB8,0x82,3}, {0xE4,0xB8,0x84,3}, {0xE4,0xB8,0x85,3}, {0xE4,0xB8,0x86,3}, {0xE4,0xB8,0x8F,3}, {0xE4,0xB8,0x92,3}, {0xE4,0xB8,0x97,3}, {0xE4,0xB8,0x9F,3},
+        {0xE4,0xB8,0xA0,3}, {0xE4,0xB8,0xA1,3}, {0xE4,0xB8,0xA3,3}, {0xE4,0xB8,0xA6,3}, {0xE4,0xB8,0xA9,3}, {0xE4,0xB8,0xAE,3}, {0xE4,0xB8,0xAF,3}, {0xE4,0xB8,0xB1,3},
+        {0xE4,0xB8,0xB3,3}, {0xE4,0xB8,0xB5,3}, {0xE4,0xB8,0xB7,3}, {0xE4,0xB8,0xBC,3}, {0xE4,0xB9,0x80,3}, {0xE4,0xB9,0x81,3}, {0xE4,0xB9,0x82,3}, {0xE4,0xB9,0x84,3},
+        {0xE4,0xB9,0x86,3}, {0xE4,0xB9,0x8A,3}, {0xE4,0xB9,0x91,3}, {0xE4,0xB9,0x95,3}, {0xE4,0xB9,0x97,3}, {0xE4,0xB9,0x9A,3}, {0xE4,0xB9,0x9B,3}, {0xE4,0xB9,0xA2,3},
+        {0xE4,0xB9,0xA3,3}, {0xE4,0xB9,0xA4,3}, {0xE4,0xB9,0xA5,3}, {0xE4,0xB9,0xA7,3}, {0xE4,0xB9,0xA8,3}, {0xE4,0xB9,0xAA,3}, {0xE4,0xB9,0xAB,3}, {0xE4,0xB9,0xAC,3},
+        {0xE4,0xB9,0xAD,3}, {0xE4,0xB9,0xAE,3}, {0xE4,0xB9,0xAF,3}, {0xE4,0xB9,0xB2,3}, {0xE4,0xB9,0xB4,3}, {0xE4,0xB9,0xB5,3}, {0xE4,0xB9,0xB6,3}, {0xE4,0xB9,0xB7,3},
+        {0xE4,0xB9,0xB8,3}, {0xE4,0xB9,0xB9,3}, {0xE4,0xB9,0xBA,3}, {0xE4,0xB9,0xBB,3}, {0xE4,0xB9,0xBC,3}, {0xE4,0xB9,0xBD,3}, {0xE4,0xB9,0xBF,3}, {0xE4,0xBA,0x80,3},
+        {0xE4,0xBA,0x81,3}, {0xE4,0xBA,0x82,3}, {0xE4,0xBA,0x83,3}, {0xE4,0xBA,0x84,3}, {0xE4,0xBA,0x85,3}, {0xE4,0xBA,0x87,3}, {0xE4,0xBA,0x8A,3}, {0xE4,0xBA,0x90,3},
+        {0xE4,0xBA,0x96,3}, {0xE4,0xBA,0x97,3}, {0xE4,0xBA,0x99,3}, {0xE4,0xBA,0x9C,3}, {0xE4,0xBA,0x9D,3}, {0xE4,0xBA,0x9E,3}, {0xE4,0xBA,0xA3,3}, {0xE4,0xBA,0xAA,3},
+        {0xE4,0xBA,0xAF,3}, {0xE4,0xBA,0xB0,3}, {0xE4,0xBA,0xB1,3}, {0xE4,0xBA,0xB4,3}, {0xE4,0xBA,0xB6,3}, {0xE4,0xBA,0xB7,3}, {0xE4,0xBA,0xB8,3}, {0xE4,0xBA,0xB9,3},
+        {0xE4,0xBA,0xBC,3}, {0xE4,0xBA,0xBD,3}, {0xE4,0xBA,0xBE,3}, {0xE4,0xBB,0x88,3}, {0xE4,0xBB,0x8C,3}, {0xE4,0xBB,0x8F,3}, {0xE4,0xBB,0x90,3}, {0xE4,0xBB,0x92,3},
+        {0xE4,0xBB,0x9A,3}, {0xE4,0xBB,0x9B,3}, {0xE4,0xBB,0x9C,3}, {0xE4,0xBB,0xA0,3}, {0xE4,0xBB,0xA2,3}, {0xE4,0xBB,0xA6,3}, {0xE4,0xBB,0xA7,3}, {0xE4,0xBB,0xA9,3},
+        {0xE4,0xBB,0xAD,3}, {0xE4,0xBB,0xAE,3}, {0xE4,0xBB,0xAF,3}, {0xE4,0xBB,0xB1,3}, {0xE4,0xBB,0xB4,3}, {0xE4,0xBB,0xB8,3}, {0xE4,0xBB,0xB9,3}, {0xE4,0xBB,0xBA,3},
+        {0xE4,0xBB,0xBC,3}, {0xE4,0xBB,0xBE,3}, {0xE4,0xBC,0x80,3}, {0xE4,0xBC,0x82,3}, {0xE4,0xBC,0x83,3}, {0xE4,0xBC,0x84,3}, {0xE4,0xBC,0x85,3}, {0xE4,0xBC,0x86,3},
+        {0xE4,0xBC,0x87,3}, {0xE4,0xBC,0x88,3}, {0xE4,0xBC,0x8B,3}, {0xE4,0xBC,0x8C,3}, {0xE4,0xBC,0x92,3}, {0xE4,0xBC,0x93,3}, {0xE4,0xBC,0x94,3}, {0xE4,0xBC,0x95,3},
+        {0xE4,0xBC,0x96,3}, {0xE4,0xBC,0x9C,3}, {0xE4,0xBC,0x9D,3}, {0xE4,0xBC,0xA1,3}, {0xE4,0xBC,0xA3,3}, {0xE4,0xBC,0xA8,3}, {0xE4,0xBC,0xA9,3}, {0xE4,0xBC,0xAC,3},
+        {0xE4,0xBC,0xAD,3}, {0xE4,0xBC,0xAE,3}, {0xE4,0xBC,0xB1,3}, {0xE4,0xBC,0xB3,3}, {0xE4,0xBC,0xB5,3}, {0xE4,0xBC,0xB7,3}, {0xE4,0xBC,0xB9,3}, {0xE4,0xBC,0xBB,3},
+        {0xE4,0xBC,0xBE,3}, {0xE4,0xBC,0xBF,3}, {0xE4,0xBD,0x80,3}, {0xE4,0xBD,0x81,3}, {0xE4,0xBD,0x82,3}, {0xE4,0xBD,0x84,3}, {0xE4,0xBD,0x85,3}, {0xE4,0xBD,0x87,3},
+        {0xE4,0xBD,0x88,3}, {0xE4,0xBD,0x89,3}, {0xE4,0xBD,0x8A,3}, {0xE4,0xBD,0x8B,3}, {0xE4,0xBD,0x8C,3}, {0xE4,0xBD,0x92,3}, {0xE4,0xBD,0x94,3}, {0xE4,0xBD,0x96,3},
+        {0xE4,0xBD,0xA1,3}, {0xE4,0xBD,0xA2,3}, {0xE4,0xBD,0xA6,3}, {0xE4,0xBD,0xA8,3}, {0xE4,0xBD,0xAA,3}, {0xE4,0xBD,0xAB,3}, {0xE4,0xBD,0xAD,3}, {0xE4,0xBD,0xAE,3},
+        {0xE4,0xBD,0xB1,3}, {0xE4,0xBD,0xB2,3}, {0xE4,0xBD,0xB5,3}, {0xE4,0xBD,0xB7,3}, {0xE4,0xBD,0xB8,3}, {0xE4,0xBD,0xB9,3}, {0xE4,0xBD,0xBA,3}, {0xE4,0xBD,0xBD,3},
+        {0xE4,0xBE,0x80,3}, {0xE4,0xBE,0x81,3}, {0xE4,0xBE,0x82,3}, {0xE4,0xBE,0x85,3}, {0xE4,0xBE,0x86,3}, {0xE4,0xBE,0x87,3}, {0xE4,0xBE,0x8A,3}, {0xE4,0xBE,0x8C,3},
+        {0xE4,0xBE,0x8E,3}, {0xE4,0xBE,0x90,3}, {0xE4,0xBE,0x92,3}, {0xE4,0xBE,0x93,3}, {0xE4,0xBE,0x95,3}, {0xE4,0xBE,0x96,3}, {0xE4,0xBE,0x98,3}, {0xE4,0xBE,0x99,3},
+        {0xE4,0xBE,0x9A,3}, {0xE4,0xBE,0x9C,3}, {0xE4,0xBE,0x9E,3}, {0xE4,0xBE,0x9F,3}, {0xE4,0xBE,0xA1,3}, {0xE4,0xBE,0xA2,3},
+    },
+    /* 0x82 */ {
+        {0xE4,0xBE,0xA4,3}, {0xE4,0xBE,0xAB,3}, {0xE4,0xBE,0xAD,3}, {0xE4,0xBE,0xB0,3}, {0xE4,0xBE,0xB1,3}, {0xE4,0xBE,0xB2,3}, {0xE4,0xBE,0xB3,3}, {0xE4,0xBE,0xB4,3},
+        {0xE4,0xBE,0xB6,3}, {0xE4,0xBE,0xB7,3}, {0xE4,0xBE,0xB8,3}, {0xE4,0xBE,0xB9,3}, {0xE4,0xBE,0xBA,3}, {0xE4,0xBE,0xBB,3}, {0xE4,0xBE,0xBC,3}, {0xE4,0xBE,0xBD,3},
+        {0xE4,0xBE,0xBE,3}, {0xE4,0xBF,0x80,3}, {0xE4,0xBF,0x81,3}, {0xE4,0xBF,0x82,3}, {0xE4,0xBF,0x86,3}, {0xE4,0xBF,0x87,3}, {0xE4,0xBF,0x88,3}, {0xE4,0xBF,0x89,3},
+        {0xE4,0xBF,0x8B,3}, {0xE4,0xBF,0x8C,3}, {0xE4,0xBF,0x8D,3}, {0xE4,0xBF,0x92,3}, {0xE4,0xBF,0x93,3}, {0xE4,0xBF,0x94,3}, {0xE4,0xBF,0x95,3}, {0xE4,0xBF,0x96,3},
+        {0xE4,0xBF,0x99,3}, {0xE4,0xBF,0x9B,3}, {0xE4,0xBF,0xA0,3}, {0xE4,0xBF,0xA2,3}, {0xE4,0xBF,0xA4,3}, {0xE4,0xBF,0xA5,3}, {0xE4,0xBF,0xA7,3}, {0xE4,0xBF,0xAB,3},
+        {0xE4,0xBF,0xAC,3}, {0xE4,0xBF,0xB0,3}, {0xE4,0xBF,0xB2,3}, {0xE4,0xBF,0xB4,3}, {0xE4,0xBF,0xB5,3}, {0xE4,0xBF,0xB6,3}, {0xE4,0xBF,0xB7,3}, {0xE4,0xBF,0xB9,3},
+        {0xE4,0xBF,0xBB,3}, {0xE4,0xBF,0xBC,3}, {0xE4,0xBF,0xBD,3}, {0xE4,0xBF,0xBF,3}, {0xE5,0x80,0x80,3}, {0xE5,0x80,0x81,3}, {0xE5,0x80,0x82,3}, {0xE5,0x80,0x83,3},
+        {0xE5,0x80,0x84,3}, {0xE5,0x80,0x85,3}, {0xE5,0x80,0x86,3}, {0xE5,0x80,0x87,3}, {0xE5,0x80,0x88,3}, {0xE5,0x80,0x89,3}, {0xE5,0x80,0x8A,3}, {0xE5,0x80,0x8B,3},
+        {0xE5,0x80,0x8E,3}, {0xE5,0x80,0x90,3}, {0xE5,0x80,0x91,3}, {0xE5,0x80,0x93,3}, {0xE5,0x80,0x95,3}, {0xE5,0x80,0x96,3}, {0xE5,0x80,0x97,3}, {0xE5,0x80,0x9B,3},
+        {0xE5,0x80,0x9D,3}, {0xE5,0x80,0x9E,3}, {0xE5,0x80,0xA0,3}, {0xE5,0x80,0xA2,3}, {0xE5,0x80,0xA3,3}, {0xE5,0x80,0xA4,3}, {0xE5,0x80,0xA7,3}, {0xE5,0x80,0xAB,3},
+        {0xE5,0x80,0xAF,3}, {0xE5,0x80,0xB0,3}, {0xE5,0x80,0xB1,3}, {0xE5,0x80,0xB2,3}, {0xE5,0x80,0xB3,3}, {0xE5,0x80,0xB4,3}, {0xE5,0x80,0xB5,3}, {0xE5,0x80,0xB6,3},
+        {0xE5,0x80,0xB7,3}, {0xE5,0x80,0xB8,3}, {0xE5,0x80,0xB9,3}, {0xE5,0x80,0xBB,3}, {0xE5,0x80,0xBD,3}, {0xE5,0x80,0xBF,3}, {0xE5,0x81,0x80,3}, {0xE5,0x81,0x81,3},
+        {0xE5,0x81,0x82,3}, {0xE5,0x81,0x84,3}, {0xE5,0x81,0x85,3}, {0xE5,0x81,0x86,3}, {0xE5,0x81,0x89,3}, {0xE5,0x81,0x8A,3}, {0xE5,0x81,0x8B,3}, {0xE5,0x81,0x8D,3},
+        {0xE5,0x81,0x90,3}, {0xE5,0x81,0x91,3}, {0xE5,0x81,0x92,3}, {0xE5,0x81,0x93,3}, {0xE5,0x81,0x94,3}, {0xE5,0x81,0x96,3}, {0xE5,0x81,0x97,3}, {0xE5,0x81,0x98,3},
+        {0xE5,0x81,0x99,3}, {0xE5,0x81,0x9B,3}, {0xE5,0x81,0x9D,3}, {0xE5,0x81,0x9E,3}, {0xE5,0x81,0x9F,3}, {0xE5,0x81,0xA0,3}, {0xE5,0x81,0xA1,3}, {0xE5,0x81,0xA2,3},
+        {0xE5,0x81,0xA3,3}, {0xE5,0x81,0xA4,3}, {0xE5,0x81,0xA6,3}, {0xE5,0x81,0xA7,3}, {0xE5,0x81,0xA8,3}, {0xE5,0x81,0xA9,3}, {0xE5,0x81,0xAA,3}, {0xE5,0x81,0xAB,3},
+        {0xE5,0x81,0xAD,3}, {0xE5,0x81,0xAE,3}, {0xE5,0x81,0xAF,3}, {0xE5,0x81,0xB0,3}, {0xE5,0x81,0xB1,3}, {0xE5,0x81,0xB2,3}, {0xE5,0x81,0xB3,3}, {0xE5,0x81,0xB4,3},
+        {0xE5,0x81,0xB5,3}, {0xE5,0x81,0xB8,3}, {0xE5,0x81,0xB9,3}, {0xE5,0x81,0xBA,3}, {0xE5,0x81,0xBC,3}, {0xE5,0x81,0xBD,3}, {0xE5,0x82,0x81,3}, {0xE5,0x82,0x82,3},
+        {0xE5,0x82,0x83,3}, {0xE5,0x82,0x84,3}, {0xE5,0x82,0x86,3}, {0xE5,0x82,0x87,3}, {0xE5,0x82,0x89,3}, {0xE5,0x82,0x8A,3}, {0xE5,0x82,0x8B,3}, {0xE5,0x82,0x8C,3},
+        {0xE5,0x82,0x8E,3}, {0xE5,0x82,0x8F,3}, {0xE5,0x82,0x90,3}, {0xE5,0x82,0x91,3}, {0xE5,0x82,0x92,3}, {0xE5,0x82,0x93,3}, {0xE5,0x82,0x94,3}, {0xE5,0x82,0x95,3},
+        {0xE5,0x82,0x96,3}, {0xE5,0x82,0x97,3}, {0xE5,0x82,0x98,3}, {0xE5,0x82,0x99,3}, {0xE5,0x82,0x9A,3}, {0xE5,0x82,0x9B,3}, {0xE5,0x82,0x9C,3}, {0xE5,0x82,0x9D,3},
+        {0xE5,0x82,0x9E,3}, {0xE5,0x82,0x9F,3}, {0xE5,0x82,0xA0,3}, {0xE5,0x82,0xA1,3}, {0xE5,0x82,0xA2,3}, {0xE5,0x82,0xA4,3}, {0xE5,0x82,0xA6,3}, {0xE5,0x82,0xAA,3},
+        {0xE5,0x82,0xAB,3}, {0xE5,0x82,0xAD,3}, {0xE5,0x82,0xAE,3}, {0xE5,0x82,0xAF,3}, {0xE5,0x82,0xB0,3}, {0xE5,0x82,0xB1,3}, {0xE5,0x82,0xB3,3}, {0xE5,0x82,0xB4,3},
+        {0xE5,0x82,0xB5,3}, {0xE5,0x82,0xB6,3}, {0xE5,0x82,0xB7,3}, {0xE5,0x82,0xB8,3}, {0xE5,0x82,0xB9,3}, {0xE5,0x82,0xBC,3},
+    },
+    /* 0x83 */ {
+        {0xE5,0x82,0xBD,3}, {0xE5,0x82,0xBE,3}, {0xE5,0x82,0xBF,3}, {0xE5,0x83,0x80,3}, {0xE5,0x83,0x81,3}, {0xE5,0x83,0x82,3}, {0xE5,0x83,0x83,3}, {0xE5,0x83,0x84,3},
+        {0xE5,0x83,0x85,3}, {0xE5,0x83,0x86,3}, {0xE5,0x83,0x87,3}, {0xE5,0x83,0x88,3}, {0xE5,0x83,0x89,3}, {0xE5,0x83,0x8A,3}, {0xE5,0x83,0x8B,3}, {0xE5,0x83,0x8C,3},
+        {0xE5,0x83,0x8D,3}, {0xE5,0x83,0x8E,3}, {0xE5,0x83,0x90,3}, {0xE5,0x83,0x91,3}, {0xE5,0x83,0x92,3}, {0xE5,0x83,0x93,3}, {0xE5,0x83,0x94,3}, {0xE5,0x83,0x95,3},
+        {0xE5,0x83,0x97,3}, {0xE5,0x83,0x98,3}, {0xE5,0x83,0x99,3}, {0xE5,0x83,0x9B,3}, {0xE5,0x83,0x9C,3}, {0xE5,0x83,0x9D,3}, {0xE5,0x83,0x9E,3}, {0xE5,0x83,0x9F,3},
+        {0xE5,0x83,0xA0,3}, {0xE5,0x83,0xA1,3}, {0xE5,0x83,0xA2,3}, {0xE5,0x83,0xA3,3}, {0xE5,0x83,0xA4,3}, {0xE5,0x83,0xA5,3}, {0xE5,0x83,0xA8,3}, {0xE5,0x83,0xA9,3},
+        {0xE5,0x83,0xAA,3}, {0xE5,0x83,0xAB,3}, {0xE5,0x83,0xAF,3}, {0xE5,0x83,0xB0,3}, {0xE5,0x83,0xB1,3}, {0xE5,0x83,0xB2,3}, {0xE5,0x83,0xB4,3}, {0xE5,0x83,0xB6,3},
+        {0xE5,0x83,0xB7,3}, {0xE5,0x83,0xB8,3}, {0xE5,0x83,0xB9,3}, {0xE5,0x83,0xBA,3}, {0xE5,0x83,0xBC,3}, {0xE5,0x83,0xBD,3}, {0xE5,0x83,0xBE,3}, {0xE5,0x83,0xBF,3},
+        {0xE5,0x84,0x80,3}, {0xE5,0x84,0x81,3}, {0xE5,0x84,0x82,3}, {0xE5,0x84,0x83,3}, {0xE5,0x84,0x84,3}, {0xE5,0x84,0x85,3}, {0xE5,0x84,0x88,3}, {0xE5,0x84,0x89,3},
+        {0xE5,0x84,0x8A,3}, {0xE5,0x84,0x8C,3}, {0xE5,0x84,0x8D,3}, {0xE5,0x84,0x8E,3}, {0xE5,0x84,0x8F,3}, {0xE5,0x84,0x90,3}, {0xE5,0x84,0x91,3}, {0xE5,0x84,0x93,3},
+        {0xE5,0x84,0x94,3}, {0xE5,0x84,0x95,3}, {0xE5,0x84,0x96,3}, {0xE5,0x84,0x97,3}, {0xE5,0x84,0x98,3}, {0xE5,0x84,0x99,3}, {0xE5,0x84,0x9A,3}, {0xE5,0x84,0x9B,3},
+        {0xE5,0x84,0x9C,3}, {0xE5,0x84,0x9D,3}, {0xE5,0x84,0x9E,3}, {0xE5,0x84,0x9F,3}, {0xE5,0x84,0xA0,3}, {0xE5,0x84,0xA2,3}, {0xE5,0x84,0xA3,3}, {0xE5,0x84,0xA4,3},
+        {0xE5,0x84,0xA5,3}, {0xE5,0x84,0xA6,3}, {0xE5,0x84,0xA7,3}, {0xE5,0x84,0xA8,3}, {0xE5,0x84,0xA9,3}, {0xE5,0x84,0xAA,3}, {0xE5,0x84,0xAB,3}, {0xE5,0x84,0xAC,3},
+        {0xE5,0x84,0xAD,3}, {0xE5,0x84,0xAE,3}, {0xE5,0x84,0xAF,3}, {0xE5,0x84,0xB0,3}, {0xE5,0x84,0xB1,3}, {0xE5,0x84,0xB2,3}, {0xE5,0x84,0xB3,3}, {0xE5,0x84,0xB4,3},
+        {0xE5,0x84,0xB5,3}, {0xE5,0x84,0xB6,3}, {0xE5,0x84,0xB7,3}, {0xE5,0x84,0xB8,3}, {0xE5,0x84,0xB9,3}, {0xE5,0x84,0xBA,3}, {0xE5,0x84,0xBB,3}, {0xE5,0x84,0xBC,3},
+        {0xE5,0x84,0xBD,3}, {0xE5,0x84,0xBE,3}, {0xE5,0x85,0x82,3}, {0xE5,0x85,0x87,3}, {0xE5,0x85,0x8A,3}, {0xE5,0x85,0x8C,3}, {0xE5,0x85,0x8E,3}, {0xE5,0x85,0x8F,3},
+        {0xE5,0x85,0x90,3}, {0xE5,0x85,0x92,3}, {0xE5,0x85,0x93,3}, {0xE5,0x85,0x97,3}, {0xE5,0x85,0x98,3}, {0xE5,0x85,0x99,3}, {0xE5,0x85,0x9B,3}, {0xE5,0x85,0x9D,3},
+        {0xE5,0x85,0x9E,3}, {0xE5,0x85,0x9F,3}, {0xE5,0x85,0xA0,3}, {0xE5,0x85,0xA1,3}, {0xE5,0x85,0xA3,3}, {0xE5,0x85,0xA4,3}, {0xE5,0x85,0xA6,3}, {0xE5,0x85,0xA7,3},
+        {0xE5,0x85,0xA9,3}, {0xE5,0x85,0xAA,3}, {0xE5,0x85,0xAF,3}, {0xE5,0x85,0xB2,3}, {0xE5,0x85,0xBA,3}, {0xE5,0x85,0xBE,3}, {0xE5,0x85,0xBF,3}, {0xE5,0x86,0x83,3},
+        {0xE5,0x86,0x84,3}, {0xE5,0x86,0x86,3}, {0xE5,0x86,0x87,3}, {0xE5,0x86,0x8A,3}, {0xE5,0x86,0x8B,3}, {0xE5,0x86,0x8E,3}, {0xE5,0x86,0x8F,3}, {0xE5,0x86,0x90,3},
+        {0xE5,0x86,0x91,3}, {0xE5,0x86,0x93,3}, {0xE5,0x86,0x94,3}, {0xE5,0x86,0x98,3}, {0xE5,0x86,0x9A,3}, {0xE5,0x86,0x9D,3}, {0xE5,0x86,0x9E,3}, {0xE5,0x86,0x9F,3},
+        {0xE5,0x86,0xA1,3}, {0xE5,0x86,0xA3,3}, {0xE5,0x86,0xA6,3}, {0xE5,0x86,0xA7,3}, {0xE5,0x86,0xA8,3}, {0xE5,0x86,0xA9,3}, {0xE5,0x86,0xAA,3}, {0xE5,0x86,0xAD,3},
+        {0xE5,0x86,0xAE,3}, {0xE5,0x86,0xB4,3}, {0xE5,0x86,0xB8,3}, {0xE5,0x86,0xB9,3}, {0xE5,0x86,0xBA,3}, {0xE5,0x86,0xBE,3}, {0xE5,0x86,0xBF,3}, {0xE5,0x87,0x81,3},
+        {0xE5,0x87,0x82,3}, {0xE5,0x87,0x83,3}, {0xE5,0x87,0x85,3}, {0xE5,0x87,0x88,3}, {0xE5,0x87,0x8A,3}, {0xE5,0x87,0x8D,3}, {0xE5,0x87,0x8E,3}, {0xE5,0x87,0x90,3},
+        {0xE5,0x87,0x92,3}, {0xE5,0x87,0x93,3}, {0xE5,0x87,0x94,3}, {0xE5,0x87,0x95,3}, {0xE5,0x87,0x96,3}, {0xE5,0x87,0x97,3},
+    },
+    /* 0x84 */ {
+        {0xE5,0x87,0x98,3}, {0xE5,0x87,0x99,3}, {0xE5,0x87,0x9A,3}, {0xE5,0x87,0x9C,3}, {0xE5,0x87,0x9E,3}, {0xE5,0x87,0x9F,3}, {0xE5,0x87,0xA2,3}, {0xE5,0x87,0xA3,3},
+        {0xE5,0x87,0xA5,3}, {0xE5,0x87,0xA6,3}, {0xE5,0x87,0xA7,3}, {0xE5,0x87,0xA8,3}, {0xE5,0x87,0xA9,3}, {0xE5,0x87,0xAA,3}, {0xE5,0x87,0xAC,3}, {0xE5,0x87,0xAE,3},
+        {0xE5,0x87,0xB1,3}, {0xE5,0x87,0xB2,3}, {0xE5,0x87,0xB4,3}, {0xE5,0x87,0xB7,3}, {0xE5,0x87,0xBE,3}, {0xE5,0x88,0x84,3}, {0xE5,0x88,0x85,3}, {0xE5,0x88,0x89,3},
+        {0xE5,0x88,0x8B,3}, {0xE5,0x88,0x8C,3}, {0xE5,0x88,0x8F,3}, {0xE5,0x88,0x90,3}, {0xE5,0x88,0x93,3}, {0xE5,0x88,0x94,3}, {0xE5,0x88,0x95,3}, {0xE5,0x88,0x9C,3},
+        {0xE5,0x88,0x9E,3}, {0xE5,0x88,0x9F,3}, {0xE5,0x88,0xA1,3}, {0xE5,0x88,0xA2,3}, {0xE5,0x88,0xA3,3}, {0xE5,0x88,0xA5,3}, {0xE5,0x88,0xA6,3}, {0xE5,0x88,0xA7,3},
+        {0xE5,0x88,0xAA,3}, {0xE5,0x88,0xAC,3}, {0xE5,0x88,0xAF,3}, {0xE5,0x88,0xB1,3}, {0xE5,0x88,0xB2,3}, {0xE5,0x88,0xB4,3}, {0xE5,0x88,0xB5,3}, {0xE5,0x88,0xBC,3},
+        {0xE5,0x88,0xBE,3}, {0xE5,0x89,0x84,3}, {0xE5,0x89,0x85,3}, {0xE5,0x89,0x86,3}, {0xE5,0x89,0x87,3}, {0xE5,0x89,0x88,3}, {0xE5,0x89,0x89,3}, {0xE5,0x89,0x8B,3},
+        {0xE5,0x89,0x8E,3}, {0xE5,0x89,0x8F,3}, {0xE5,0x89,0x92,3}, {0xE5,0x89,0x93,3}, {0xE5,0x89,0x95,3}, {0xE5,0x89,0x97,3}, {0xE5,0x89,0x98,3}, {0xE5,0x89,0x99,3},
+        {0xE5,0x89,0x9A,3}, {0xE5,0x89,0x9B,3}, {0xE5,0x89,0x9D,3}, {0xE5,0x89,0x9F,3}, {0xE5,0x89,0xA0,3}, {0xE5,0x89,0xA2,3}, {0xE5,0x89,0xA3,3}, {0xE5,0x89,0xA4,3},
+        {0xE5,0x89,0xA6,3}, {0xE5,0x89,0xA8,3}, {0xE5,0x89,0xAB,3}, {0xE5,0x89,0xAC,3}, {0xE5,0x89,0xAD,3}, {0xE5,0x89,0xAE,3}, {0xE5,0x89,0xB0,3}, {0xE5,0x89,0xB1,3},
+        {0xE5,0x89,0xB3,3}, {0xE5,0x89,0xB4,3}, {0xE5,0x89,0xB5,3}, {0xE5,0x89,0xB6,3}, {0xE5,0x89,0xB7,3}, {0xE5,0x89,0xB8,3}, {0xE5,0x89,0xB9,3}, {0xE5,0x89,0xBA,3},
+        {0xE5,0x89,0xBB,3}, {0xE5,0x89,0xBC,3}, {0xE5,0x89,0xBE,3}, {0xE5,0x8A,0x80,3}, {0xE5,0x8A,0x83,3}, {0xE5,0x8A,0x84,3}, {0xE5,0x8A,0x85,3}, {0xE5,0x8A,0x86,3},
+        {0xE5,0x8A,0x87,3}, {0xE5,0x8A,0x89,3}, {0xE5,0x8A,0x8A,3}, {0xE5,0x8A,0x8B,3}, {0xE5,0x8A,0x8C,3}, {0xE5,0x8A,0x8D,3}, {0xE5,0x8A,0x8E,3}, {0xE5,0x8A,0x8F,3},
+        {0xE5,0x8A,0x91,3}, {0xE5,0x8A,0x92,3}, {0xE5,0x8A,0x94,3}, {0xE5,0x8A,0x95,3}, {0xE5,0x8A,0x96,3}, {0xE5,0x8A,0x97,3}, {0xE5,0x8A,0x98,3}, {0xE5,0x8A,0x99,3},
+        {0xE5,0x8A,0x9A,3}, {0xE5,0x8A,0x9C,3}, {0xE5,0x8A,0xA4,3}, {0xE5,0x8A,0xA5,3}, {0xE5,0x8A,0xA6,3}, {0xE5,0x8A,0xA7,3}, {0xE5,0x8A,0xAE,3}, {0xE5,0x8A,0xAF,3},
+        {0xE5,0x8A,0xB0,3}, {0xE5,0x8A,0xB4,3}, {0xE5,0x8A,0xB5,3}, {0xE5,0x8A,0xB6,3}, {0xE5,0x8A,0xB7,3}, {0xE5,0x8A,0xB8,3}, {0xE5,0x8A,0xB9,3}, {0xE5,0x8A,0xBA,3},
+        {0xE5,0x8A,0xBB,3}, {0xE5,0x8A,0xBC,3}, {0xE5,0x8A,0xBD,3}, {0xE5,0x8B,0x80,3}, {0xE5,0x8B,0x81,3}, {0xE5,0x8B,0x82,3}, {0xE5,0x8B,0x84,3}, {0xE5,0x8B,0x85,3},
+        {0xE5,0x8B,0x86,3}, {0xE5,0x8B,0x88,3}, {0xE5,0x8B,0x8A,3}, {0xE5,0x8B,0x8C,3}, {0xE5,0x8B,0x8D,3}, {0xE5,0x8B,0x8E,3}, {0xE5,0x8B,0x8F,3}, {0xE5,0x8B,0x91,3},
+        {0xE5,0x8B,0x93,3}, {0xE5,0x8B,0x94,3}, {0xE5,0x8B,0x95,3}, {0xE5,0x8B,0x97,3}, {0xE5,0x8B,0x99,3}, {0xE5,0x8B,0x9A,3}, {0xE5,0x8B,0x9B,3}, {0xE5,0x8B,0x9C,3},
+        {0xE5,0x8B,0x9D,3}, {0xE5,0x8B,0x9E,3}, {0xE5,0x8B,0xA0,3}, {0xE5,0x8B,0xA1,3}, {0xE5,0x8B,0xA2,3}, {0xE5,0x8B,0xA3,3}, {0xE5,0x8B,0xA5,3}, {0xE5,0x8B,0xA6,3},
+        {0xE5,0x8B,0xA7,3}, {0xE5,0x8B,0xA8,3}, {0xE5,0x8B,0xA9,3}, {0xE5,0x8B,0xAA,3}, {0xE5,0x8B,0xAB,3}, {0xE5,0x8B,0xAC,3}, {0xE5,0x8B,0xAD,3}, {0xE5,0x8B,0xAE,3},
+        {0xE5,0x8B,0xAF,3}, {0xE5,0x8B,0xB1,3}, {0xE5,0x8B,0xB2,3}, {0xE5,0x8B,0xB3,3}, {0xE5,0x8B,0xB4,3}, {0xE5,0x8B,0xB5,3}, {0xE5,0x8B,0xB6,3}, {0xE5,0x8B,0xB7,3},
+        {0xE5,0x8B,0xB8,3}, {0xE5,0x8B,0xBB,3}, {0xE5,0x8B,0xBC,3}, {0xE5,0x8B,0xBD,3}, {0xE5,0x8C,0x81,3}, {0xE5,0x8C,0x82,3}, {0xE5,0x8C,0x83,3}, {0xE5,0x8C,0x84,3},
+        {0xE5,0x8C,0x87,3}, {0xE5,0x8C,0x89,3}, {0xE5,0x8C,0x8A,3}, {0xE5,0x8C,0x8B,3}, {0xE5,0x8C,0x8C,3}, {0xE5,0x8C,0x8E,3},
+    },
+    /* 0x85 */ {
+        {0xE5,0x8C,0x91,3}, {0xE5,0x8C,0x92,3}, {0xE5,0x8C,0x93,3}, {0xE5,0x8C,0x94,3}, {0xE5,0x8C,0x98,3}, {0xE5,0x8C,0x9B,3}, {0xE5,0x8C,0x9C,3}, {0xE5,0x8C,0x9E,3},
+        {0xE5,0x8C,0x9F,3}, {0xE5,0x8C,0xA2,3}, {0xE5,0x8C,0xA4,3}, {0xE5,0x8C,0xA5,3}, {0xE5,0x8C,0xA7,3}, {0xE5,0x8C,0xA8,3}, {0xE5,0x8C,0xA9,3}, {0xE5,0x8C,0xAB,3},
+        {0xE5,0x8C,0xAC,3}, {0xE5,0x8C,0xAD,3}, {0xE5,0x8C,0xAF,3}, {0xE5,0x8C,0xB0,3}, {0xE5,0x8C,0xB1,3}, {0xE5,0x8C,0xB2,3}, {0xE5,0x8C,0xB3,3}, {0xE5,0x8C,0xB4,3},
+        {0xE5,0x8C,0xB5,3}, {0xE5,0x8C,0xB6,3}, {0xE5,0x8C,0xB7,3}, {0xE5,0x8C,0xB8,3}, {0xE5,0x8C,0xBC,3}, {0xE5,0x8C,0xBD,3}, {0xE5,0x8D,0x80,3}, {0xE5,0x8D,0x82,3},
+        {0xE5,0x8D,0x84,3}, {0xE5,0x8D,0x86,3}, {0xE5,0x8D,0x8B,3}, {0xE5,0x8D,0x8C,3}, {0xE5,0x8D,0x8D,3}, {0xE5,0x8D,0x90,3}, {0xE5,0x8D,0x94,3}, {0xE5,0x8D,0x98,3},
+        {0xE5,0x8D,0x99,3}, {0xE5,0x8D,0x9B,3}, {0xE5,0x8D,0x9D,3}, {0xE5,0x8D,0xA5,3}, {0xE5,0x8D,0xA8,3}, {0xE5,0x8D,0xAA,3}, {0xE5,0x8D,0xAC,3}, {0xE5,0x8D,0xAD,3},
+        {0xE5,0x8D,0xB2,3}, {0xE5,0x8D,0xB6,3}, {0xE5,0x8D,0xB9,3}, {0xE5,0x8D,0xBB,3}, {0xE5,0x8D,0xBC,3}, {0xE5,0x8D,0xBD,3}, {0xE5,0x8D,0xBE,3}, {0xE5,0x8E,0x80,3},
+        {0xE5,0x8E,0x81,3}, {0xE5,0x8E,0x83,3}, {0xE5,0x8E,0x87,3}, {0xE5,0x8E,0x88,3}, {0xE5,0x8E,0x8A,3}, {0xE5,0x8E,0x8E,3}, {0xE5,0x8E,0x8F,3}, {0xE5,0x8E,0x90,3},
+        {0xE5,0x8E,0x91,3}, {0xE5,0x8E,0x92,3}, {0xE5,0x8E,0x93,3}, {0xE5,0x8E,0x94,3}, {0xE5,0x8E,0x96,3}, {0xE5,0x8E,0x97,3}, {0xE5,0x8E,0x99,3}, {0xE5,0x8E,0x9B,3},
+        {0xE5,0x8E,0x9C,3}, {0xE5,0x8E,0x9E,3}, {0xE5,0x8E,0xA0,3}, {0xE5,0x8E,0xA1,3}, {0xE5,0x8E,0xA4,3}, {0xE5,0x8E,0xA7,3}, {0xE5,0x8E,0xAA,3}, {0xE5,0x8E,0xAB,3},
+        {0xE5,0x8E,0xAC,3}, {0xE5,0x8E,0xAD,3}, {0xE5,0x8E,0xAF,3}, {0xE5,0x8E,0xB0,3}, {0xE5,0x8E,0xB1,3}, {0xE5,0x8E,0xB2,3}, {0xE5,0x8E,0xB3,3}, {0xE5,0x8E,0xB4,3},
+        {0xE5,0x8E,0xB5,3}, {0xE5,0x8E,0xB7,3}, {0xE5,0x8E,0xB8,3}, {0xE5,0x8E,0xB9,3}, {0xE5,0x8E,0xBA,3}, {0xE5,0x8E,0xBC,3}, {0xE5,0x8E,0xBD,3}, {0xE5,0x8E,0xBE,3},
+        {0xE5,0x8F,0x80,3}, {0xE5,0x8F,0x83,3}, {0xE5,0x8F,0x84,3}, {0xE5,0x8F,0x85,3}, {0xE5,0x8F,0x86,3}, {0xE5,0x8F,0x87,3}, {0xE5,0x8F,0x8E,3}, {0xE5,0x8F,0x8F,3},
+        {0xE5,0x8F,0x90,3}, {0xE5,0x8F,0x92,3}, {0xE5,0x8F,0x93,3}, {0xE5,0x8F,0x95,3}, {0xE5,0x8F,0x9A,3}, {0xE5,0x8F,0x9C,3}, {0xE5,0x8F,0x9D,3}, {0xE5,0x8F,0x9E,3},
+        {0xE5,0x8F,0xA1,3}, {0xE5,0x8F,0xA2,3}, {0xE5,0x8F,0xA7,3}, {0xE5,0x8F,0xB4,3}, {0xE5,0x8F,0xBA,3}, {0xE5,0x8F,0xBE,3}, {0xE5,0x8F,0xBF,3}, {0xE5,0x90,0x80,3},
+        {0xE5,0x90,0x82,3}, {0xE5,0x90,0x85,3}, {0xE5,0x90,0x87,3}, {0xE5,0x90,0x8B,3}, {0xE5,0x90,0x94,3}, {0xE5,0x90,0x98,3}, {0xE5,0x90,0x99,3}, {0xE5,0x90,0x9A,3},
+        {0xE5,0x90,0x9C,3}, {0xE5,0x90,0xA2,3}, {0xE5,0x90,0xA4,3}, {0xE5,0x90,0xA5,3}, {0xE5,0x90,0xAA,3}, {0xE5,0x90,0xB0,3}, {0xE5,0x90,0xB3,3}, {0xE5,0x90,0xB6,3},
+        {0xE5,0x90,0xB7,3}, {0xE5,0x90,0xBA,3}, {0xE5,0x90,0xBD,3}, {0xE5,0x90,0xBF,3}, {0xE5,0x91,0x81,3}, {0xE5,0x91,0x82,3}, {0xE5,0x91,0x84,3}, {0xE5,0x91,0x85,3},
+        {0xE5,0x91,0x87,3}, {0xE5,0x91,0x89,3}, {0xE5,0x91,0x8C,3}, {0xE5,0x91,0x8D,3}, {0xE5,0x91,0x8E,3}, {0xE5,0x91,0x8F,3}, {0xE5,0x91,0x91,3}, {0xE5,0x91,0x9A,3},
+        {0xE5,0x91,0x9D,3}, {0xE5,0x91,0x9E,3}, {0xE5,0x91,0x9F,3}, {0xE5,0x91,0xA0,3}, {0xE5,0x91,0xA1,3}, {0xE5,0x91,0xA3,3}, {0xE5,0x91,0xA5,3}, {0xE5,0x91,0xA7,3},
+        {0xE5,0x91,0xA9,3}, {0xE5,0x91,0xAA,3}, {0xE5,0x91,0xAB,3}, {0xE5,0x91,0xAC,3}, {0xE5,0x91,0xAD,3}, {0xE5,0x91,0xAE,3}, {0xE5,0x91,0xAF,3}, {0xE5,0x91,0xB0,3},
+        {0xE5,0x91,0xB4,3}, {0xE5,0x91,0xB9,3}, {0xE5,0x91,0xBA,3}, {0xE5,0x91,0xBE,3}, {0xE5,0x91,0xBF,3}, {0xE5,0x92,0x81,3}, {0xE5,0x92,0x83,3}, {0xE5,0x92,0x85,3},
+        {0xE5,0x92,0x87,3}, {0xE5,0x92,0x88,3}, {0xE5,0x92,0x89,3}, {0xE5,0x92,0x8A,3}, {0xE5,0x92,0x8D,3}, {0xE5,0x92,0x91,3}, {0xE5,0x92,0x93,3}, {0xE5,0x92,0x97,3},
+        {0xE5,0x92,0x98,3}, {0xE5,0x92,0x9C,3}, {0xE5,0x92,0x9E,3}, {0xE5,0x92,0x9F,3}, {0xE5,0x92,0xA0,3}, {0xE5,0x92,0xA1,3},
+    },
+    /* 0x86 */ {
+        {0xE5,0x92,0xA2,3}, {0xE5,0x92,0xA5,3}, {0xE5,0x92,0xAE,3}, {0xE5,0x92,0xB0,3}, {0xE5,0x92,0xB2,3}, {0xE5,0x92,0xB5,3}, {0xE5,0x92,0xB6,3}, {0xE5,0x92,0xB7,3},
+        {0xE5,0x92,0xB9,3}, {0xE5,0x92,0xBA,3}, {0xE5,0x92,0xBC,3}, {0xE5,0x92,0xBE,3}, {0xE5,0x93,0x83,3}, {0xE5,0x93,0x85,3}, {0xE5,0x93,0x8A,3}, {0xE5,0x93,0x8B,3},
+        {0xE5,0x93,0x96,3}, {0xE5,0x93,0x98,3}, {0xE5,0x93,0x9B,3}, {0xE5,0x93,0xA0,3}, {0xE5,0x93,0xA1,3}, {0xE5,0x93,0xA2,3}, {0xE5,0x93,0xA3,3}, {0xE5,0x93,0xA4,3},
+        {0xE5,0x93,0xAB,3}, {0xE5,0x93,0xAC,3}, {0xE5,0x93,0xAF,3}, {0xE5,0x93,0xB0,3}, {0xE5,0x93,0xB1,3}, {0xE5,0x93,0xB4,3}, {0xE5,0x93,0xB5,3}, {0xE5,0x93,0xB6,3},
+        {0xE5,0x93,0xB7,3}, {0xE5,0x93,0xB8,3}, {0xE5,0x93,0xB9,3}, {0xE5,0x93,0xBB,3}, {0xE5,0x93,0xBE,3}, {0xE5,0x94,0x80,3}, {0xE5,0x94,0x82,3}, {0xE5,0x94,0x83,3},
+        {0xE5,0x94,0x84,3}, {0xE5,0x94,0x85,3}, {0xE5,0x94,0x88,3}, {0xE5,0x94,0x8A,3}, {0xE5,0x94,0x8B,3}, {0xE5,0x94,0x8C,3}, {0xE5,0x94,0x8D,3}, {0xE5,0x94,0x8E,3},
+        {0xE5,0x94,0x92,3}, {0xE5,0x94,0x93,3}, {0xE5,0x94,0x95,3}, {0xE5,0x94,0x96,3}, {0xE5,0x94,0x97,3}, {0xE5,0x94,0x98,3}, {0xE5,0x94,0x99,3}, {0xE5,0x94,0x9A,3},
+        {0xE5,0x94,0x9C,3}, {0xE5,0x94,0x9D,3}, {0xE5,0x94,0x9E,3}, {0xE5,0x94,0x9F,3}, {0xE5,0x94,0xA1,3}, {0xE5,0x94,0xA5,3}, {0xE5,0x94,0xA6,3}, {0xE5,0x94,0xA8,3},
+        {0xE5,0x94,0xA9,3}, {0xE5,0x94,0xAB,3}, {0xE5,0x94,0xAD,3}, {0xE5,0x94,0xB2,3}, {0xE5,0x94,0xB4,3}, {0xE5,0x94,0xB5,3}, {0xE5,0x94,0xB6,3}, {0xE5,0x94,0xB8,3},
+        {0xE5,0x94,0xB9,3}, {0xE5,0x94,0xBA,3}, {0xE5,0x94,0xBB,3}, {0xE5,0x94,0xBD,3}, {0xE5,0x95,0x80,3}, {0xE5,0x95,0x82,3}, {0xE5,0x95,0x85,3}, {0xE5,0x95,0x87,3},
+        {0xE5,0x95,0x88,3}, {0xE5,0x95,0x8B,3}, {0xE5,0x95,0x8C,3}, {0xE5,0x95,0x8D,3}, {0xE5,0x95,0x8E,3}, {0xE5,0x95,0x8F,3}, {0xE5,0x95,0x91,3}, {0xE5,0x95,0x92,3},
+        {0xE5,0x95,0x93,3}, {0xE5,0x95,0x94,3}, {0xE5,0x95,0x97,3}, {0xE5,0x95,0x98,3}, {0xE5,0x95,0x99,3}, {0xE5,0x95,0x9A,3}, {0xE5,0x95,0x9B,3}, {0xE5,0x95,0x9D,3},
+        {0xE5,0x95,0x9E,3}, {0xE5,0x95,0x9F,3}, {0xE5,0x95,0xA0,3}, {0xE5,0x95,0xA2,3}, {0xE5,0x95,0xA3,3}, {0xE5,0x95,0xA8,3}, {0xE5,0x95,0xA9,3}, {0xE5,0x95,0xAB,3},
+        {0xE5,0x95,0xAF,3}, {0xE5,0x95,0xB0,3}, {0xE5,0x95,0xB1,3}, {0xE5,0x95,0xB2,3}, {0xE5,0x95,0xB3,3}, {0xE5,0x95,0xB4,3}, {0xE5,0x95,0xB9,3}, {0xE5,0x95,0xBA,3},
+        {0xE5,0x95,0xBD,3}, {0xE5,0x95,0xBF,3}, {0xE5,0x96,0x85,3}, {0xE5,0x96,0x86,3}, {0xE5,0x96,0x8C,3}, {0xE5,0x96,0x8D,3}, {0xE5,0x96,0x8E,3}, {0xE5,0x96,0x90,3},
+        {0xE5,0x96,0x92,3}, {0xE5,0x96,0x93,3}, {0xE5,0x96,0x95,3}, {0xE5,0x96,0x96,3}, {0xE5,0x96,0x97,3}, {0xE5,0x96,0x9A,3}, {0xE5,0x96,0x9B,3}, {0xE5,0x96,0x9E,3},
+        {0xE5,0x96,0xA0,3}, {0xE5,0x96,0xA1,3}, {0xE5,0x96,0xA2,3}, {0xE5,0x96,0xA3,3}, {0xE5,0x96,0xA4,3}, {0xE5,0x96,0xA5,3}, {0xE5,0x96,0xA6,3}, {0xE5,0x96,0xA8,3},
+        {0xE5,0x96,0xA9,3}, {0xE5,0x96,0xAA,3}, {0xE5,0x96,0xAB,3}, {0xE5,0x96,0xAC,3}, {0xE5,0x96,0xAD,3}, {0xE5,0x96,0xAE,3}, {0xE5,0x96,0xAF,3}, {0xE5,0x96,0xB0,3},
+        {0xE5,0x96,0xB2,3}, {0xE5,0x96,0xB4,3}, {0xE5,0x96,0xB6,3}, {0xE5,0x96,0xB8,3}, {0xE5,0x96,0xBA,3}, {0xE5,0x96,0xBC,3}, {0xE5,0x96,0xBF,3}, {0xE5,0x97,0x80,3},
+        {0xE5,0x97,0x81,3}, {0xE5,0x97,0x82,3}, {0xE5,0x97,0x83,3}, {0xE5,0x97,0x86,3}, {0xE5,0x97,0x87,3}, {0xE5,0x97,0x88,3}, {0xE5,0x97,0x8A,3}, {0xE5,0x97,0x8B,3},
+        {0xE5,0x97,0x8E,3}, {0xE5,0x97,0x8F,3}, {0xE5,0x97,0x90,3}, {0xE5,0x97,0x95,3}, {0xE5,0x97,0x97,3}, {0xE5,0x97,0x98,3}, {0xE5,0x97,0x99,3}, {0xE5,0x97,0x9A,3},
+        {0xE5,0x97,0x9B,3}, {0xE5,0x97,0x9E,3}, {0xE5,0x97,0xA0,3}, {0xE5,0x97,0xA2,3}, {0xE5,0x97,0xA7,3}, {0xE5,0x97,0xA9,3}, {0xE5,0x97,0xAD,3}, {0xE5,0x97,0xAE,3},
+        {0xE5,0x97,0xB0,3}, {0xE5,0x97,0xB1,3}, {0xE5,0x97,0xB4,3}, {0xE5,0x97,0xB6,3}, {0xE5,0x97,0xB8,3}, {0xE5,0x97,0xB9,3}, {0xE5,0x97,0xBA,3}, {0xE5,0x97,0xBB,3},
+        {0xE5,0x97,0xBC,3}, {0xE5,0x97,0xBF,3}, {0xE5,0x98,0x82,3}, {0xE5,0x98,0x83,3}, {0xE5,0x98,0x84,3}, {0xE5,0x98,0x85,3},
+    },
+    /* 0x87 */ {
+        {0xE5,0x98,0x86,3}, {0xE5,0x98,0x87,3}, {0xE5,0x98,0x8A,3}, {0xE5,0x98,0x8B,3}, {0xE5,0x98,0x8D,3}, {0xE5,0x98,0x90,3}, {0xE5,0x98,0x91,3}, {0xE5,0x98,0x92,3},
+        {0xE5,0x98,0x93,3}, {0xE5,0x98,0x94,3}, {0xE5,0x98,0x95,3}, {0xE5,0x98,0x96,3}, {0xE5,0x98,0x97,3}, {0xE5,0x98,0x99,3}, {0xE5,0x98,0x9A,3}, {0xE5,0x98,0x9C,3},
+        {0xE5,0x98,0x9D,3}, {0xE5,0x98,0xA0,3}, {0xE5,0x98,0xA1,3}, {0xE5,0x98,0xA2,3}, {0xE5,0x98,0xA5,3}, {0xE5,0x98,0xA6,3}, {0xE5,0x98,0xA8,3}, {0xE5,0x98,0xA9,3},
+        {0xE5,0x98,0xAA,3}, {0xE5,0x98,0xAB,3}, {0xE5,0x98,0xAE,3}, {0xE5,0x98,0xAF,3}, {0xE5,0x98,0xB0,3}, {0xE5,0x98,0xB3,3}, {0xE5,0x98,0xB5,3}, {0xE5,0x98,0xB7,3},
+        {0xE5,0x98,0xB8,3}, {0xE5,0x98,0xBA,3}, {0xE5,0x98,0xBC,3}, {0xE5,0x98,0xBD,3}, {0xE5,0x98,0xBE,3}, {0xE5,0x99,0x80,3}, {0xE5,0x99,0x81,3}, {0xE5,0x99,0x82,3},
+        {0xE5,0x99,0x83,3}, {0xE5,0x99,0x84,3}, {0xE5,0x99,0x85,3}, {0xE5,0x99,0x86,3}, {0xE5,0x99,0x87,3}, {0xE5,0x99,0x88,3}, {0xE5,0x99,0x89,3}, {0xE5,0x99,0x8A,3},
+        {0xE5,0x99,0x8B,3}, {0xE5,0x99,0x8F,3}, {0xE5,0x99,0x90,3}, {0xE5,0x99,0x91,3}, {0xE5,0x99,0x92,3}, {0xE5,0x99,0x93,3}, {0xE5,0x99,0x95,3}, {0xE5,0x99,0x96,3},
+        {0xE5,0x99,0x9A,3}, {0xE5,0x99,0x9B,3}, {0xE5,0x99,0x9D,3}, {0xE5,0x99,0x9E,3}, {0xE5,0x99,0x9F,3}, {0xE5,0x99,0xA0,3}, {0xE5,0x99,0xA1,3}, {0xE5,0x99,0xA3,3},
+        {0xE5,0x99,0xA5,3}, {0xE5,0x99,0xA6,3}, {0xE5,0x99,0xA7,3}, {0xE5,0x99,0xAD,3}, {0xE5,0x99,0xAE,3}, {0xE5,0x99,0xAF,3}, {0xE5,0x99,0xB0,3}, {0xE5,0x99,0xB2,3},
+        {0xE5,0x99,0xB3,3}, {0xE5,0x99,0xB4,3}, {0xE5,0x99,0xB5,3}, {0xE5,0x99,0xB7,3}, {0xE5,0x99,0xB8,3}, {0xE5,0x99,0xB9,3}, {0xE5,0x99,0xBA,3}, {0xE5,0x99,0xBD,3},
+        {0xE5,0x99,0xBE,3}, {0xE5,0x99,0xBF,3}, {0xE5,0x9A,0x80,3}, {0xE5,0x9A,0x81,3}, {0xE5,0x9A,0x82,3}, {0xE5,0x9A,0x83,3}, {0xE5,0x9A,0x84,3}, {0xE5,0x9A,0x87,3},
+        {0xE5,0x9A,0x88,3}, {0xE5,0x9A,0x89,3}, {0xE5,0x9A,0x8A,3}, {0xE5,0x9A,0x8B,3}, {0xE5,0x9A,0x8C,3}, {0xE5,0x9A,0x8D,3}, {0xE5,0x9A,0x90,3}, {0xE5,0x9A,0x91,3},
+        {0xE5,0x9A,0x92,3}, {0xE5,0x9A,0x94,3}, {0xE5,0x9A,0x95,3}, {0xE5,0x9A,0x96,3}, {0xE5,0x9A,0x97,3}, {0xE5,0x9A,0x98,3}, {0xE5,0x9A,0x99,3}, {0xE5,0x9A,0x9A,3},
+        {0xE5,0x9A,0x9B,3}, {0xE5,0x9A,0x9C,3}, {0xE5,0x9A,0x9D,3}, {0xE5,0x9A,0x9E,3}, {0xE5,0x9A,0x9F,3}, {0xE5,0x9A,0xA0,3}, {0xE5,0x9A,0xA1,3}, {0xE5,0x9A,0xA2,3},
+        {0xE5,0x9A,0xA4,3}, {0xE5,0x9A,0xA5,3}, {0xE5,0x9A,0xA6,3}, {0xE5,0x9A,0xA7,3}, {0xE5,0x9A,0xA8,3}, {0xE5,0x9A,0xA9,3}, {0xE5,0x9A,0xAA,3}, {0xE5,0x9A,0xAB,3},
+        {0xE5,0x9A,0xAC,3}, {0xE5,0x9A,0xAD,3}, {0xE5,0x9A,0xAE,3}, {0xE5,0x9A,0xB0,3}, {0xE5,0x9A,0xB1,3}, {0xE5,0x9A,0xB2,3}, {0xE5,0x9A,0xB3,3}, {0xE5,0x9A,0xB4,3},
+        {0xE5,0x9A,0xB5,3}, {0xE5,0x9A,0xB6,3}, {0xE5,0x9A,0xB8,3}, {0xE5,0x9A,0xB9,3}, {0xE5,0x9A,0xBA,3}, {0xE5,0x9A,0xBB,3}, {0xE5,0x9A,0xBD,3}, {0xE5,0x9A,0xBE,3},
+        {0xE5,0x9A,0xBF,3}, {0xE5,0x9B,0x80,3}, {0xE5,0x9B,0x81,3}, {0xE5,0x9B,0x82,3}, {0xE5,0x9B,0x83,3}, {0xE5,0x9B,0x84,3}, {0xE5,0x9B,0x85,3}, {0xE5,0x9B,0x86,3},
+        {0xE5,0x9B,0x87,3}, {0xE5,0x9B,0x88,3}, {0xE5,0x9B,0x89,3}, {0xE5,0x9B,0x8B,3}, {0xE5,0x9B,0x8C,3}, {0xE5,0x9B,0x8D,3}, {0xE5,0x9B,0x8E,3}, {0xE5,0x9B,0x8F,3},
+        {0xE5,0x9B,0x90,3}, {0xE5,0x9B,0x91,3}, {0xE5,0x9B,0x92,3}, {0xE5,0x9B,0x93,3}, {0xE5,0x9B,0x95,3}, {0xE5,0x9B,0x96,3}, {0xE5,0x9B,0x98,3}, {0xE5,0x9B,0x99,3},
+        {0xE5,0x9B,0x9C,3}, {0xE5,0x9B,0xA3,3}, {0xE5,0x9B,0xA5,3}, {0xE5,0x9B,0xA6,3}, {0xE5,0x9B,0xA7,3}, {0xE5,0x9B,0xA8,3}, {0xE5,0x9B,0xA9,3}, {0xE5,0x9B,0xAA,3},
+        {0xE5,0x9B,0xAC,3}, {0xE5,0x9B,0xAE,3}, {0xE5,0x9B,0xAF,3}, {0xE5,0x9B,0xB2,3}, {0xE5,0x9B,0xB3,3}, {0xE5,0x9B,0xB6,3}, {0xE5,0x9B,0xB7,3}, {0xE5,0x9B,0xB8,3},
+        {0xE5,0x9B,0xBB,3}, {0xE5,0x9B,0xBC,3}, {0xE5,0x9C,0x80,3}, {0xE5,0x9C,0x81,3}, {0xE5,0x9C,0x82,3}, {0xE5,0x9C,0x85,3}, {0xE5,0x9C,0x87,3}, {0xE5,0x9C,0x8B,3},
+        {0xE5,0x9C,0x8C,3}, {0xE5,0x9C,0x8D,3}, {0xE5,0x9C,0x8E,3}, {0xE5,0x9C,0x8F,3}, {0xE5,0x9C,0x90,3}, {0xE5,0x9C,0x91,3},
+    },
+    /* 0x88 */ {
+        {0xE5,0x9C,0x92,3}, {0xE5,0x9C,0x93,3}, {0xE5,0x9C,0x94,3}, {0xE5,0x9C,0x95,3}, {0xE5,0x9C,0x96,3}, {0xE5,0x9C,0x97,3}, {0xE5,0x9C,0x98,3}, {0xE5,0x9C,0x99,3},
+        {0xE5,0x9C,0x9A,3}, {0xE5,0x9C,0x9B,3}, {0xE5,0x9C,0x9D,3}, {0xE5,0x9C,0x9E,3}, {0xE5,0x9C,0xA0,3}, {0xE5,0x9C,0xA1,3}, {0xE5,0x9C,0xA2,3}, {0xE5,0x9C,0xA4,3},
+        {0xE5,0x9C,0xA5,3}, {0xE5,0x9C,0xA6,3}, {0xE5,0x9C,0xA7,3}, {0xE5,0x9C,0xAB,3}, {0xE5,0x9C,0xB1,3}, {0xE5,0x9C,0xB2,3}, {0xE5,0x9C,0xB4,3}, {0xE5,0x9C,0xB5,3},
+        {0xE5,0x9C,0xB6,3}, {0xE5,0x9C,0xB7,3}, {0xE5,0x9C,0xB8,3}, {0xE5,0x9C,0xBC,3}, {0xE5,0x9C,0xBD,3}, {0xE5,0x9C,0xBF,3}, {0xE5,0x9D,0x81,3}, {0xE5,0x9D,0x83,3},
+        {0xE5,0x9D,0x84,3}, {0xE5,0x9D,0x85,3}, {0xE5,0x9D,0x86,3}, {0xE5,0x9D,0x88,3}, {0xE5,0x9D,0x89,3}, {0xE5,0x9D,0x8B,3}, {0xE5,0x9D,0x92,3}, {0xE5,0x9D,0x93,3},
+        {0xE5,0x9D,0x94,3}, {0xE5,0x9D,0x95,3}, {0xE5,0x9D,0x96,3}, {0xE5,0x9D,0x98,3}, {0xE5,0x9D,0x99,3}, {0xE5,0x9D,0xA2,3}, {0xE5,0x9D,0xA3,3}, {0xE5,0x9D,0xA5,3},
+        {0xE5,0x9D,0xA7,3}, {0xE5,0x9D,0xAC,3}, {0xE5,0x9D,0xAE,3}, {0xE5,0x9D,0xB0,3}, {0xE5,0x9D,0xB1,3}, {0xE5,0x9D,0xB2,3}, {0xE5,0x9D,0xB4,3}, {0xE5,0x9D,0xB5,3},
+        {0xE5,0x9D,0xB8,3}, {0xE5,0x9D,0xB9,3}, {0xE5,0x9D,0xBA,3}, {0xE5,0x9D,0xBD,3}, {0xE5,0x9D,0xBE,3}, {0xE5,0x9D,0xBF,3}, {0xE5,0x9E,0x80,3}, {0xE5,0x9E,0x81,3},
+        {0xE5,0x9E,0x87,3}, {0xE5,0x9E,0x88,3}, {0xE5,0x9E,0x89,3}, {0xE5,0x9E,0x8A,3}, {0xE5,0x9E,0x8D,3}, {0xE5,0x9E,0x8E,3}, {0xE5,0x9E,0x8F,3}, {0xE5,0x9E,0x90,3},
+        {0xE5,0x9E,0x91,3}, {0xE5,0x9E,0x94,3}, {0xE5,0x9E,0x95,3}, {0xE5,0x9E,0x96,3}, {0xE5,0x9E,0x97,3}, {0xE5,0x9E,0x98,3}, {0xE5,0x9E,0x99,3}, {0xE5,0x9E,0x9A,3},
+        {0xE5,0x9E,0x9C,3}, {0xE5,0x9E,0x9D,3}, {0xE5,0x9E,0x9E,3}, {0xE5,0x9E,0x9F,3}, {0xE5,0x9E,0xA5,3}, {0xE5,0x9E,0xA8,3}, {0xE5,0x9E,0xAA,3}, {0xE5,0x9E,0xAC,3},
+        {0xE5,0x9E,0xAF,3}, {0xE5,0x9E,0xB0,3}, {0xE5,0x9E,0xB1,3}, {0xE5,0x9E,0xB3,3}, {0xE5,0x9E,0xB5,3}, {0xE5,0x9E,0xB6,3}, {0xE5,0x9E,0xB7,3}, {0xE5,0x9E,0xB9,3},
+        {0xE5,0x9E,0xBA,3}, {0xE5,0x9E,0xBB,3}, {0xE5,0x9E,0xBC,3}, {0xE5,0x9E,0xBD,3}, {0xE5,0x9E,0xBE,3}, {0xE5,0x9E,0xBF,3}, {0xE5,0x9F,0x80,3}, {0xE5,0x9F,0x81,3},
+        {0xE5,0x9F,0x84,3}, {0xE5,0x9F,0x85,3}, {0xE5,0x9F,0x86,3}, {0xE5,0x9F,0x87,3}, {0xE5,0x9F,0x88,3}, {0xE5,0x9F,0x89,3}, {0xE5,0x9F,0x8A,3}, {0xE5,0x9F,0x8C,3},
+        {0xE5,0x9F,0x8D,3}, {0xE5,0x9F,0x90,3}, {0xE5,0x9F,0x91,3}, {0xE5,0x9F,0x93,3}, {0xE5,0x9F,0x96,3}, {0xE5,0x9F,0x97,3}, {0xE5,0x9F,0x9B,3}, {0xE5,0x9F,0x9C,3},
+        {0xE5,0x9F,0x9E,3}, {0xE5,0x9F,0xA1,3}, {0xE5,0x9F,0xA2,3}, {0xE5,0x9F,0xA3,3}, {0xE5,0x9F,0xA5,3}, {0xE5,0x9F,0xA6,3}, {0xE5,0x9F,0xA7,3}, {0xE5,0x9F,0xA8,3},
+        {0xE5,0x9F,0xA9,3}, {0xE5,0x9F,0xAA,3}, {0xE5,0x9F,0xAB,3}, {0xE5,0x9F,0xAC,3}, {0xE5,0x9F,0xAE,3}, {0xE5,0x9F,0xB0,3}, {0xE5,0x9F,0xB1,3}, {0xE5,0x9F,0xB2,3},
+        {0xE5,0x9F,0xB3,3}, {0xE5,0x9F,0xB5,3}, {0xE5,0x9F,0xB6,3}, {0xE5,0x9F,0xB7,3}, {0xE5,0x9F,0xBB,3}, {0xE5,0x9F,0xBC,3}, {0xE5,0x9F,0xBE,3}, {0xE5,0x9F,0xBF,3},
+        {0xE5,0xA0,0x81,3}, {0xE5,0xA0,0x83,3}, {0xE5,0xA0,0x84,3}, {0xE5,0xA0,0x85,3}, {0xE5,0xA0,0x88,3}, {0xE5,0xA0,0x89,3}, {0xE5,0xA0,0x8A,3}, {0xE5,0xA0,0x8C,3},
+        {0xE5,0xA0,0x8E,3}, {0xE5,0xA0,0x8F,3}, {0xE5,0xA0,0x90,3}, {0xE5,0xA0,0x92,3}, {0xE5,0xA0,0x93,3}, {0xE5,0xA0,0x94,3}, {0xE5,0xA0,0x96,3}, {0xE5,0xA0,0x97,3},
+        {0xE5,0xA0,0x98,3}, {0xE5,0xA0,0x9A,3}, {0xE5,0xA0,0x9B,3}, {0xE5,0xA0,0x9C,3}, {0xE5,0xA0,0x9D,3}, {0xE5,0xA0,0x9F,3}, {0xE5,0xA0,0xA2,3}, {0xE5,0xA0,0xA3,3},
+        {0xE5,0xA0,0xA5,3}, {0xE5,0xA0,0xA6,3}, {0xE5,0xA0,0xA7,3}, {0xE5,0xA0,0xA8,3}, {0xE5,0xA0,0xA9,3}, {0xE5,0xA0,0xAB,3}, {0xE5,0xA0,0xAC,3}, {0xE5,0xA0,0xAD,3},
+        {0xE5,0xA0,0xAE,3}, {0xE5,0xA0,0xAF,3}, {0xE5,0xA0,0xB1,3}, {0xE5,0xA0,0xB2,3}, {0xE5,0xA0,0xB3,3}, {0xE5,0xA0,0xB4,3}, {0xE5,0xA0,0xB6,3}, {0xE5,0xA0,0xB7,3},
+        {0xE5,0xA0,0xB8,3}, {0xE5,0xA0,0xB9,3}, {0xE5,0xA0,0xBA,3}, {0xE5,0xA0,0xBB,3}, {0xE5,0xA0,0xBC,3}, {0xE5,0xA0,0xBD,3},
+    },
+    /* 0x89 */ {
+        {0xE5,0xA0,0xBE,3}, {0xE5,0xA0,0xBF,3}, {0xE5,0xA1,0x80,3}, {0xE5,0xA1,0x81,3}, {0xE5,0xA1,0x82,3}, {0xE5,0xA1,0x83,3}, {0xE5,0xA1,0x85,3}, {0xE5,0xA1,0x86,3},
+        {0xE5,0xA1,0x87,3}, {0xE5,0xA1,0x88,3}, {0xE5,0xA1,0x89,3}, {0xE5,0xA1,0x8A,3}, {0xE5,0xA1,0x8B,3}, {0xE5,0xA1,0x8E,3}, {0xE5,0xA1,0x8F,3}, {0xE5,0xA1,0x90,3},
+        {0xE5,0xA1,0x92,3}, {0xE5,0xA1,0x93,3}, {0xE5,0xA1,0x95,3}, {0xE5,0xA1,0x96,3}, {0xE5,0xA1,0x97,3}, {0xE5,0xA1,0x99,3}, {0xE5,0xA1,0x9A,3}, {0xE5,0xA1,0x9B,3},
+        {0xE5,0xA1,0x9C,3}, {0xE5,0xA1,0x9D,3}, {0xE5,0xA1,0x9F,3}, {0xE5,0xA1,0xA0,3}, {0xE5,0xA1,0xA1,3}, {0xE5,0xA1,0xA2,3}, {0xE5,0xA1,0xA3,3}, {0xE5,0xA1,0xA4,3},
+        {0xE5,0xA1,0xA6,3}, {0xE5,0xA1,0xA7,3}, {0xE5,0xA1,0xA8,3}, {0xE5,0xA1,0xA9,3}, {0xE5,0xA1,0xAA,3}, {0xE5,0xA1,0xAD,3}, {0xE5,0xA1,0xAE,3}, {0xE5,0xA1,0xAF,3},
+        {0xE5,0xA1,0xB0,3}, {0xE5,0xA1,0xB1,3}, {0xE5,0xA1,0xB2,3}, {0xE5,0xA1,0xB3,3}, {0xE5,0xA1,0xB4,3}, {0xE5,0xA1,0xB5,3}, {0xE5,0xA1,0xB6,3}, {0xE5,0xA1,0xB7,3},
+        {0xE5,0xA1,0xB8,3}, {0xE5,0xA1,0xB9,3}, {0xE5,0xA1,0xBA,3}, {0xE5,0xA1,0xBB,3}, {0xE5,0xA1,0xBC,3}, {0xE5,0xA1,0xBD,3}, {0xE5,0xA1,0xBF,3}, {0xE5,0xA2,0x82,3},
+        {0xE5,0xA2,0x84,3}, {0xE5,0xA2,0x86,3}, {0xE5,0xA2,0x87,3}, {0xE5,0xA2,0x88,3}, {0xE5,0xA2,0x8A,3}, {0xE5,0xA2,0x8B,3}, {0xE5,0xA2,0x8C,3}, {0xE5,0xA2,0x8D,3},
+        {0xE5,0xA2,0x8E,3}, {0xE5,0xA2,0x8F,3}, {0xE5,0xA2,0x90,3}, {0xE5,0xA2,0x91,3}, {0xE5,0xA2,0x94,3}, {0xE5,0xA2,0x95,3}, {0xE5,0xA2,0x96,3}, {0xE5,0xA2,0x97,3},
+        {0xE5,0xA2,0x98,3}, {0xE5,0xA2,0x9B,3}, {0xE5,0xA2,0x9C,3}, {0xE5,0xA2,0x9D,3}, {0xE5,0xA2,0xA0,3}, {0xE5,0xA2,0xA1,3}, {0xE5,0xA2,0xA2,3}, {0xE5,0xA2,0xA3,3},
+        {0xE5,0xA2,0xA4,3}, {0xE5,0xA2,0xA5,3}, {0xE5,0xA2,0xA6,3}, {0xE5,0xA2,0xA7,3}, {0xE5,0xA2,0xAA,3}, {0xE5,0xA2,0xAB,3}, {0xE5,0xA2,0xAC,3}, {0xE5,0xA2,0xAD,3},
+        {0xE5,0xA2,0xAE,3}, {0xE5,0xA2,0xAF,3}, {0xE5,0xA2,0xB0,3}, {0xE5,0xA2,0xB1,3}, {0xE5,0xA2,0xB2,3}, {0xE5,0xA2,0xB3,3}, {0xE5,0xA2,0xB4,3}, {0xE5,0xA2,0xB5,3},
+        {0xE5,0xA2,0xB6,3}, {0xE5,0xA2,0xB7,3}, {0xE5,0xA2,0xB8,3}, {0xE5,0xA2,0xB9,3}, {0xE5,0xA2,0xBA,3}, {0xE5,0xA2,0xBB,3}, {0xE5,0xA2,0xBD,3}, {0xE5,0xA2,0xBE,3},
+        {0xE5,0xA2,0xBF,3}, {0xE5,0xA3,0x80,3}, {0xE5,0xA3,0x82,3}, {0xE5,0xA3,0x83,3}, {0xE5,0xA3,0x84,3}, {0xE5,0xA3,0x86,3}, {0xE5,0xA3,0x87,3}, {0xE5,0xA3,0x88,3},
+        {0xE5,0xA3,0x89,3}, {0xE5,0xA3,0x8A,3}, {0xE5,0xA3,0x8B,3}, {0xE5,0xA3,0x8C,3}, {0xE5,0xA3,0x8D,3}, {0xE5,0xA3,0x8E,3}, {0xE5,0xA3,0x8F,3}, {0xE5,0xA3,0x90,3},
+        {0xE5,0xA3,0x92,3}, {0xE5,0xA3,0x93,3}, {0xE5,0xA3,0x94,3}, {0xE5,0xA3,0x96,3}, {0xE5,0xA3,0x97,3}, {0xE5,0xA3,0x98,3}, {0xE5,0xA3,0x99,3}, {0xE5,0xA3,0x9A,3},
+        {0xE5,0xA3,0x9B,3}, {0xE5,0xA3,0x9C,3}, {0xE5,0xA3,0x9D,3}, {0xE5,0xA3,0x9E,3}, {0xE5,0xA3,0x9F,3}, {0xE5,0xA3,0xA0,3}, {0xE5,0xA3,0xA1,3}, {0xE5,0xA3,0xA2,3},
+        {0xE5,0xA3,0xA3,3}, {0xE5,0xA3,0xA5,3}, {0xE5,0xA3,0xA6,3}, {0xE5,0xA3,0xA7,3}, {0xE5,0xA3,0xA8,3}, {0xE5,0xA3,0xA9,3}, {0xE5,0xA3,0xAA,3}, {0xE5,0xA3,0xAD,3},
+        {0xE5,0xA3,0xAF,3}, {0xE5,0xA3,0xB1,3}, {0xE5,0xA3,0xB2,3}, {0xE5,0xA3,0xB4,3}, {0xE5,0xA3,0xB5,3}, {0xE5,0xA3,0xB7,3}, {0xE5,0xA3,0xB8,3}, {0xE5,0xA3,0xBA,3},
+        {0xE5,0xA3,0xBB,3}, {0xE5,0xA3,0xBC,3}, {0xE5,0xA3,0xBD,3}, {0xE5,0xA3,0xBE,3}, {0xE5,0xA3,0xBF,3}, {0xE5,0xA4,0x80,3}, {0xE5,0xA4,0x81,3}, {0xE5,0xA4,0x83,3},
+        {0xE5,0xA4,0x85,3}, {0xE5,0xA4,0x86,3}, {0xE5,0xA4,0x88,3}, {0xE5,0xA4,0x89,3}, {0xE5,0xA4,0x8A,3}, {0xE5,0xA4,0x8B,3}, {0xE5,0xA4,0x8C,3}, {0xE5,0xA4,0x8E,3},
+        {0xE5,0xA4,0x90,3}, {0xE5,0xA4,0x91,3}, {0xE5,0xA4,0x92,3}, {0xE5,0xA4,0x93,3}, {0xE5,0xA4,0x97,3}, {0xE5,0xA4,0x98,3}, {0xE5,0xA4,0x9B,3}, {0xE5,0xA4,0x9D,3},
+        {0xE5,0xA4,0x9E,3}, {0xE5,0xA4,0xA0,3}, {0xE5,0xA4,0xA1,3}, {0xE5,0xA4,0xA2,3}, {0xE5,0xA4,0xA3,3}, {0xE5,0xA4,0xA6,3}, {0xE5,0xA4,0xA8,3}, {0xE5,0xA4,0xAC,3},
+        {0xE5,0xA4,0xB0,3}, {0xE5,0xA4,0xB2,3}, {0xE5,0xA4,0xB3,3}, {0xE5,0xA4,0xB5,3}, {0xE5,0xA4,0xB6,3}, {0xE5,0xA4,0xBB,3},
+    },
+    /* 0x8A */ {
+        {0xE5,0xA4,0xBD,3}, {0xE5,0xA4,0xBE,3}, {0xE5,0xA4,0xBF,3}, {0xE5,0xA5,0x80,3}, {0xE5,0xA5,0x83,3}, {0xE5,0xA5,0x85,3}, {0xE5,0xA5,0x86,3}, {0xE5,0xA5,0x8A,3},
+        {0xE5,0xA5,0x8C,3}, {0xE5,0xA5,0x8D,3}, {0xE5,0xA5,0x90,3}, {0xE5,0xA5,0x92,3}, {0xE5,0xA5,0x93,3}, {0xE5,0xA5,0x99,3}, {0xE5,0xA5,0x9B,3}, {0xE5,0xA5,0x9C,3},
+        {0xE5,0xA5,0x9D,3}, {0xE5,0xA5,0x9E,3}, {0xE5,0xA5,0x9F,3}, {0xE5,0xA5,0xA1,3}, {0xE5,0xA5,0xA3,3}, {0xE5,0xA5,0xA4,3}, {0xE5,0xA5,0xA6,3}, {0xE5,0xA5,0xA7,3},
+        {0xE5,0xA5,0xA8,3}, {0xE5,0xA5,0xA9,3}, {0xE5,0xA5,0xAA,3}, {0xE5,0xA5,0xAB,3}, {0xE5,0xA5,0xAC,3}, {0xE5,0xA5,0xAD,3}, {0xE5,0xA5,0xAE,3}, {0xE5,0xA5,0xAF,3},
+        {0xE5,0xA5,0xB0,3}, {0xE5,0xA5,0xB1,3}, {0xE5,0xA5,0xB2,3}, {0xE5,0xA5,0xB5,3}, {0xE5,0xA5,0xB7,3}, {0xE5,0xA5,0xBA,3}, {0xE5,0xA5,0xBB,3}, {0xE5,0xA5,0xBC,3},
+        {0xE5,0xA5,0xBE,3}, {0xE5,0xA5,0xBF,3}, {0xE5,0xA6,0x80,3}, {0xE5,0xA6,0x85,3}, {0xE5,0xA6,0x89,3}, {0xE5,0xA6,0x8B,3}, {0xE5,0xA6,0x8C,3}, {0xE5,0xA6,0x8E,3},
+        {0xE5,0xA6,0x8F,3}, {0xE5,0xA6,0x90,3}, {0xE5,0xA6,0x91,3}, {0xE5,0xA6,0x94,3}, {0xE5,0xA6,0x95,3}, {0xE5,0xA6,0x98,3}, {0xE5,0xA6,0x9A,3}, {0xE5,0xA6,0x9B,3},
+        {0xE5,0xA6,0x9C,3}, {0xE5,0xA6,0x9D,3}, {0xE5,0xA6,0x9F,3}, {0xE5,0xA6,0xA0,3}, {0xE5,0xA6,0xA1,3}, {0xE5,0xA6,0xA2,3}, {0xE5,0xA6,0xA6,3}, {0xE5,0xA6,0xA7,3},
+        {0xE5,0xA6,0xAC,3}, {0xE5,0xA6,0xAD,3}, {0xE5,0xA6,0xB0,3}, {0xE5,0xA6,0xB1,3}, {0xE5,0xA6,0xB3,3}, {0xE5,0xA6,0xB4,3}, {0xE5,0xA6,0xB5,3}, {0xE5,0xA6,0xB6,3},
+        {0xE5,0xA6,0xB7,3}, {0xE5,0xA6,0xB8,3}, {0xE5,0xA6,0xBA,3}, {0xE5,0xA6,0xBC,3}, {0xE5,0xA6,0xBD,3}, {0xE5,0xA6,0xBF,3}, {0xE5,0xA7,0x80,3}, {0xE5,0xA7,0x81,3},
+        {0xE5,0xA7,0x82,3}, {0xE5,0xA7,0x83,3}, {0xE5,0xA7,0x84,3}, {0xE5,0xA7,0x85,3}, {0xE5,0xA7,0x87,3}, {0xE5,0xA7,0x88,3}, {0xE5,0xA7,0x89,3}, {0xE5,0xA7,0x8C,3},
+        {0xE5,0xA7,0x8D,3}, {0xE5,0xA7,0x8E,3}, {0xE5,0xA7,0x8F,3}, {0xE5,0xA7,0x95,3}, {0xE5,0xA7,0x96,3}, {0xE5,0xA7,0x99,3}, {0xE5,0xA7,0x9B,3}, {0xE5,0xA7,0x9E,3},
+        {0xE5,0xA7,0x9F,3}, {0xE5,0xA7,0xA0,3}, {0xE5,0xA7,0xA1,3}, {0xE5,0xA7,0xA2,3}, {0xE5,0xA7,0xA4,3}, {0xE5,0xA7,0xA6,3}, {0xE5,0xA7,0xA7,3}, {0xE5,0xA7,0xA9,3},
+        {0xE5,0xA7,0xAA,3}, {0xE5,0xA7,0xAB,3}, {0xE5,0xA7,0xAD,3}, {0xE5,0xA7,0xAE,3}, {0xE5,0xA7,0xAF,3}, {0xE5,0xA7,0xB0,3}, {0xE5,0xA7,0xB1,3}, {0xE5,0xA7,0xB2,3},
+        {0xE5,0xA7,0xB3,3}, {0xE5,0xA7,0xB4,3}, {0xE5,0xA7,0xB5,3}, {0xE5,0xA7,0xB6,3}, {0xE5,0xA7,0xB7,3}, {0xE5,0xA7,0xB8,3}, {0xE5,0xA7,0xBA,3}, {0xE5,0xA7,0xBC,3},
+        {0xE5,0xA7,0xBD,3}, {0xE5,0xA7,0xBE,3}, {0xE5,0xA8,0x80,3}, {0xE5,0xA8,0x82,3}, {0xE5,0xA8,0x8A,3}, {0xE5,0xA8,0x8B,3}, {0xE5,0xA8,0x8D,3}, {0xE5,0xA8,0x8E,3},
+        {0xE5,0xA8,0x8F,3}, {0xE5,0xA8,0x90,3}, {0xE5,0xA8,0x92,3}, {0xE5,0xA8,0x94,3}, {0xE5,0xA8,0x95,3}, {0xE5,0xA8,0x96,3}, {0xE5,0xA8,0x97,3}, {0xE5,0xA8,0x99,3},
+        {0xE5,0xA8,0x9A,3}, {0xE5,0xA8,0x9B,3}, {0xE5,0xA8,0x9D,3}, {0xE5,0xA8,0x9E,3}, {0xE5,0xA8,0xA1,3}, {0xE5,0xA8,0xA2,3}, {0xE5,0xA8,0xA4,3}, {0xE5,0xA8,0xA6,3},
+        {0xE5,0xA8,0xA7,3}, {0xE5,0xA8,0xA8,3}, {0xE5,0xA8,0xAA,3}, {0xE5,0xA8,0xAB,3}, {0xE5,0xA8,0xAC,3}, {0xE5,0xA8,0xAD,3}, {0xE5,0xA8,0xAE,3}, {0xE5,0xA8,0xAF,3},
+        {0xE5,0xA8,0xB0,3}, {0xE5,0xA8,0xB3,3}, {0xE5,0xA8,0xB5,3}, {0xE5,0xA8,0xB7,3}, {0xE5,0xA8,0xB8,3}, {0xE5,0xA8,0xB9,3}, {0xE5,0xA8,0xBA,3}, {0xE5,0xA8,0xBB,3},
+        {0xE5,0xA8,0xBD,3}, {0xE5,0xA8,0xBE,3}, {0xE5,0xA8,0xBF,3}, {0xE5,0xA9,0x81,3}, {0xE5,0xA9,0x82,3}, {0xE5,0xA9,0x83,3}, {0xE5,0xA9,0x84,3}, {0xE5,0xA9,0x85,3},
+        {0xE5,0xA9,0x87,3}, {0xE5,0xA9,0x88,3}, {0xE5,0xA9,0x8B,3}, {0xE5,0xA9,0x8C,3}, {0xE5,0xA9,0x8D,3}, {0xE5,0xA9,0x8E,3}, {0xE5,0xA9,0x8F,3}, {0xE5,0xA9,0x90,3},
+        {0xE5,0xA9,0x91,3}, {0xE5,0xA9,0x92,3}, {0xE5,0xA9,0x93,3}, {0xE5,0xA9,0x94,3}, {0xE5,0xA9,0x96,3}, {0xE5,0xA9,0x97,3}, {0xE5,0xA9,0x98,3}, {0xE5,0xA9,0x99,3},
+        {0xE5,0xA9,0x9B,3}, {0xE5,0xA9,0x9C,3}, {0xE5,0xA9,0x9D,3}, {0xE5,0xA9,0x9E,3}, {0xE5,0xA9,0x9F,3}, {0xE5,0xA9,0xA0,3},
+    },
+    /* 0x8B */ {
+        {0xE5,0xA9,0xA1,3}, {0xE5,0xA9,0xA3,3}, {0xE5,0xA9,0xA4,3}, {0xE5,0xA9,0xA5,3}, {0xE5,0xA9,0xA6,3}, {0xE5,0xA9,0xA8,3}, {0xE5,0xA9,0xA9,3}, {0xE5,0xA9,0xAB,3},
+        {0xE5,0xA9,0xAC,3}, {0xE5,0xA9,0xAD,3}, {0xE5,0xA9,0xAE,3}, {0xE5,0xA9,0xAF,3}, {0xE5,0xA9,0xB0,3}, {0xE5,0xA9,0xB1,3}, {0xE5,0xA9,0xB2,3}, {0xE5,0xA9,0xB3,3},
+        {0xE5,0xA9,0xB8,3}, {0xE5,0xA9,0xB9,3}, {0xE5,0xA9,0xBB,3}, {0xE5,0xA9,0xBC,3}, {0xE5,0xA9,0xBD,3}, {0xE5,0xA9,0xBE,3}, {0xE5,0xAA,0x80,3}, {0xE5,0xAA,0x81,3},
+        {0xE5,0xAA,0x82,3}, {0xE5,0xAA,0x83,3}, {0xE5,0xAA,0x84,3}, {0xE5,0xAA,0x85,3}, {0xE5,0xAA,0x86,3}, {0xE5,0xAA,0x87,3}, {0xE5,0xAA,0x88,3}, {0xE5,0xAA,0x89,3},
+        {0xE5,0xAA,0x8A,3}, {0xE5,0xAA,0x8B,3}, {0xE5,0xAA,0x8C,3}, {0xE5,0xAA,0x8D,3}, {0xE5,0xAA,0x8E,3}, {0xE5,0xAA,0x8F,3}, {0xE5,0xAA,0x90,3}, {0xE5,0xAA,0x91,3},
+        {0xE5,0xAA,0x93,3}, {0xE5,0xAA,0x94,3}, {0xE5,0xAA,0x95,3}, {0xE5,0xAA,0x96,3}, {0xE5,0xAA,0x97,3}, {0xE5,0xAA,0x98,3}, {0xE5,0xAA,0x99,3}, {0xE5,0xAA,0x9C,3},
+        {0xE5,0xAA,0x9D,3}, {0xE5,0xAA,0x9E,3}, {0xE5,0xAA,0x9F,3}, {0xE5,0xAA,0xA0,3}, {0xE5,0xAA,0xA1,3}, {0xE5,0xAA,0xA2,3}, {0xE5,0xAA,0xA3,3}, {0xE5,0xAA,0xA4,3},
+        {0xE5,0xAA,0xA5,3}, {0xE5,0xAA,0xA6,3}, {0xE5,0xAA,0xA7,3}, {0xE5,0xAA,0xA8,3}, {0xE5,0xAA,0xA9,3}, {0xE5,0xAA,0xAB,3}, {0xE5,0xAA,0xAC,3}, {0xE5,0xAA,0xAD,3},
+        {0xE5,0xAA,0xAE,3}, {0xE5,0xAA,0xAF,3}, {0xE5,0xAA,0xB0,3}, {0xE5,0xAA,0xB1,3}, {0xE5,0xAA,0xB4,3}, {0xE5,0xAA,0xB6,3}, {0xE5,0xAA,0xB7,3}, {0xE5,0xAA,0xB9,3},
+        {0xE5,0xAA,0xBA,3}, {0xE5,0xAA,0xBB,3}, {0xE5,0xAA,0xBC,3}, {0xE5,0xAA,0xBD,3}, {0xE5,0xAA,0xBF,3}, {0xE5,0xAB,0x80,3}, {0xE5,0xAB,0x83,3}, {0xE5,0xAB,0x84,3},
+        {0xE5,0xAB,0x85,3}, {0xE5,0xAB,0x86,3}, {0xE5,0xAB,0x87,3}, {0xE5,0xAB,0x88,3}, {0xE5,0xAB,0x8A,3}, {0xE5,0xAB,0x8B,3}, {0xE5,0xAB,0x8D,3}, {0xE5,0xAB,0x8E,3},
+        {0xE5,0xAB,0x8F,3}, {0xE5,0xAB,0x90,3}, {0xE5,0xAB,0x91,3}, {0xE5,0xAB,0x93,3}, {0xE5,0xAB,0x95,3}, {0xE5,0xAB,0x97,3}, {0xE5,0xAB,0x99,3}, {0xE5,0xAB,0x9A,3},
+        {0xE5,0xAB,0x9B,3}, {0xE5,0xAB,0x9D,3}, {0xE5,0xAB,0x9E,3}, {0xE5,0xAB,0x9F,3}, {0xE5,0xAB,0xA2,3}, {0xE5,0xAB,0xA4,3}, {0xE5,0xAB,0xA5,3}, {0xE5,0xAB,0xA7,3},
+        {0xE5,0xAB,0xA8,3}, {0xE5,0xAB,0xAA,3}, {0xE5,0xAB,0xAC,3}, {0xE5,0xAB,0xAD,3}, {0xE5,0xAB,0xAE,3}, {0xE5,0xAB,0xAF,3}, {0xE5,0xAB,0xB0,3}, {0xE5,0xAB,0xB2,3},
+        {0xE5,0xAB,0xB3,3}, {0xE5,0xAB,0xB4,3}, {0xE5,0xAB,0xB5,3}, {0xE5,0xAB,0xB6,3}, {0xE5,0xAB,0xB7,3}, {0xE5,0xAB,0xB8,3}, {0xE5,0xAB,0xB9,3}, {0xE5,0xAB,0xBA,3},
+        {0xE5,0xAB,0xBB,3}, {0xE5,0xAB,0xBC,3}, {0xE5,0xAB,0xBD,3}, {0xE5,0xAB,0xBE,3}, {0xE5,0xAB,0xBF,3}, {0xE5,0xAC,0x80,3}, {0xE5,0xAC,0x81,3}, {0xE5,0xAC,0x82,3},
+        {0xE5,0xAC,0x83,3}, {0xE5,0xAC,0x84,3}, {0xE5,0xAC,0x85,3}, {0xE5,0xAC,0x86,3}, {0xE5,0xAC,0x87,3}, {0xE5,0xAC,0x88,3}, {0xE5,0xAC,0x8A,3}, {0xE5,0xAC,0x8B,3},
+        {0xE5,0xAC,0x8C,3}, {0xE5,0xAC,0x8D,3}, {0xE5,0xAC,0x8E,3}, {0xE5,0xAC,0x8F,3}, {0xE5,0xAC,0x90,3}, {0xE5,0xAC,0x91,3}, {0xE5,0xAC,0x92,3}, {0xE5,0xAC,0x93,3},
+        {0xE5,0xAC,0x94,3}, {0xE5,0xAC,0x95,3}, {0xE5,0xAC,0x98,3}, {0xE5,0xAC,0x99,3}, {0xE5,0xAC,0x9A,3}, {0xE5,0xAC,0x9B,3}, {0xE5,0xAC,0x9C,3}, {0xE5,0xAC,0x9D,3},
+        {0xE5,0xAC,0x9E,3}, {0xE5,0xAC,0x9F,3}, {0xE5,0xAC,0xA0,3}, {0xE5,0xAC,0xA1,3}, {0xE5,0xAC,0xA2,3}, {0xE5,0xAC,0xA3,3}, {0xE5,0xAC,0xA4,3}, {0xE5,0xAC,0xA5,3},
+        {0xE5,0xAC,0xA6,3}, {0xE5,0xAC,0xA7,3}, {0xE5,0xAC,0xA8,3}, {0xE5,0xAC,0xA9,3}, {0xE5,0xAC,0xAA,3}, {0xE5,0xAC,0xAB,3}, {0xE5,0xAC,0xAC,3}, {0xE5,0xAC,0xAD,3},
+        {0xE5,0xAC,0xAE,3}, {0xE5,0xAC,0xAF,3}, {0xE5,0xAC,0xB0,3}, {0xE5,0xAC,0xB1,3}, {0xE5,0xAC,0xB3,3}, {0xE5,0xAC,0xB5,3}, {0xE5,0xAC,0xB6,3}, {0xE5,0xAC,0xB8,3},
+        {0xE5,0xAC,0xB9,3}, {0xE5,0xAC,0xBA,3}, {0xE5,0xAC,0xBB,3}, {0xE5,0xAC,0xBC,3}, {0xE5,0xAC,0xBD,3}, {0xE5,0xAC,0xBE,3}, {0xE5,0xAC,0xBF,3}, {0xE5,0xAD,0x81,3},
+        {0xE5,0xAD,0x82,3}, {0xE5,0xAD,0x83,3}, {0xE5,0xAD,0x84,3}, {0xE5,0xAD,0x85,3}, {0xE5,0xAD,0x86,3}, {0xE5,0xAD,0x87,3},
+    },
+    /* 0x8C */ {
+        {0xE5,0xAD,0x88,3}, {0xE5,0xAD,0x89,3}, {0xE5,0xAD,0x8A,3}, {0xE5,0xAD,0x8B,3}, {0xE5,0xAD,0x8C,3}, {0xE5,0xAD,0x8D,3}, {0xE5,0xAD,0x8E,3}, {0xE5,0xAD,0x8F,3},
+        {0xE5,0xAD,0x92,3}, {0xE5,0xAD,0x96,3}, {0xE5,0xAD,0x9E,3}, {0xE5,0xAD,0xA0,3}, {0xE5,0xAD,0xA1,3}, {0xE5,0xAD,0xA7,3}, {0xE5,0xAD,0xA8,3}, {0xE5,0xAD,0xAB,3},
+        {0xE5,0xAD,0xAD,3}, {0xE5,0xAD,0xAE,3}, {0xE5,0xAD,0xAF,3}, {0xE5,0xAD,0xB2,3}, {0xE5,0xAD,0xB4,3}, {0xE5,0xAD,0xB6,3}, {0xE5,0xAD,0xB7,3}, {0xE5,0xAD,0xB8,3},
+        {0xE5,0xAD,0xB9,3}, {0xE5,0xAD,0xBB,3}, {0xE5,0xAD,0xBC,3}, {0xE5,0xAD,0xBE,3}, {0xE5,0xAD,0xBF,3}, {0xE5,0xAE,0x82,3}, {0xE5,0xAE,0x86,3}, {0xE5,0xAE,0x8A,3},
+        {0xE5,0xAE,0x8D,3}, {0xE5,0xAE,0x8E,3}, {0xE5,0xAE,0x90,3}, {0xE5,0xAE,0x91,3}, {0xE5,0xAE,0x92,3}, {0xE5,0xAE,0x94,3}, {0xE5,0xAE,0x96,3}, {0xE5,0xAE,0x9F,3},
+        {0xE5,0xAE,0xA7,3}, {0xE5,0xAE,0xA8,3}, {0xE5,0xAE,0xA9,3}, {0xE5,0xAE,0xAC,3}, {0xE5,0xAE,0xAD,3}, {0xE5,0xAE,0xAE,3}, {0xE5,0xAE,0xAF,3}, {0xE5,0xAE,0xB1,3},
+        {0xE5,0xAE,0xB2,3}, {0xE5,0xAE,0xB7,3}, {0xE5,0xAE,0xBA,3}, {0xE5,0xAE,0xBB,3}, {0xE5,0xAE,0xBC,3}, {0xE5,0xAF,0x80,3}, {0xE5,0xAF,0x81,3}, {0xE5,0xAF,0x83,3},
+        {0xE5,0xAF,0x88,3}, {0xE5,0xAF,0x89,3}, {0xE5,0xAF,0x8A,3}, {0xE5,0xAF,0x8B,3}, {0xE5,0xAF,0x8D,3}, {0xE5,0xAF,0x8E,3}, {0xE5,0xAF,0x8F,3}, {0xE5,0xAF,0x91,3},
+        {0xE5,0xAF,0x94,3}, {0xE5,0xAF,0x95,3}, {0xE5,0xAF,0x96,3}, {0xE5,0xAF,0x97,3}, {0xE5,0xAF,0x98,3}, {0xE5,0xAF,0x99,3}, {0xE5,0xAF,0x9A,3}, {0xE5,0xAF,0x9B,3},
+        {0xE5,0xAF,0x9C,3}, {0xE5,0xAF,0xA0,3}, {0xE5,0xAF,0xA2,3}, {0xE5,0xAF,0xA3,3}, {0xE5,0xAF,0xA6,3}, {0xE5,0xAF,0xA7,3}, {0xE5,0xAF,0xA9,3}, {0xE5,0xAF,0xAA,3},
+        {0xE5,0xAF,0xAB,3}, {0xE5,0xAF,0xAC,3}, {0xE5,0xAF,0xAD,3}, {0xE5,0xAF,0xAF,3}, {0xE5,0xAF,0xB1,3}, {0xE5,0xAF,0xB2,3}, {0xE5,0xAF,0xB3,3}, {0xE5,0xAF,0xB4,3},
+        {0xE5,0xAF,0xB5,3}, {0xE5,0xAF,0xB6,3}, {0xE5,0xAF,0xB7,3}, {0xE5,0xAF,0xBD,3}, {0xE5,0xAF,0xBE,3}, {0xE5,0xB0,0x80,3}, {0xE5,0xB0,0x82,3}, {0xE5,0xB0,0x83,3},
+        {0xE5,0xB0,0x85,3}, {0xE5,0xB0,0x87,3}, {0xE5,0xB0,0x88,3}, {0xE5,0xB0,0x8B,3}, {0xE5,0xB0,0x8C,3}, {0xE5,0xB0,0x8D,3}, {0xE5,0xB0,0x8E,3}, {0xE5,0xB0,0x90,3},
+        {0xE5,0xB0,0x92,3}, {0xE5,0xB0,0x93,3}, {0xE5,0xB0,0x97,3}, {0xE5,0xB0,0x99,3}, {0xE5,0xB0,0x9B,3}, {0xE5,0xB0,0x9E,3}, {0xE5,0xB0,0x9F,3}, {0xE5,0xB0,0xA0,3},
+        {0xE5,0xB0,0xA1,3}, {0xE5,0xB0,0xA3,3}, {0xE5,0xB0,0xA6,3}, {0xE5,0xB0,0xA8,3}, {0xE5,0xB0,0xA9,3}, {0xE5,0xB0,0xAA,3}, {0xE5,0xB0,0xAB,3}, {0xE5,0xB0,0xAD,3},
+        {0xE5,0xB0,0xAE,3}, {0xE5,0xB0,0xAF,3}, {0xE5,0xB0,0xB0,3}, {0xE5,0xB0,0xB2,3}, {0xE5,0xB0,0xB3,3}, {0xE5,0xB0,0xB5,3}, {0xE5,0xB0,0xB6,3}, {0xE5,0xB0,0xB7,3},
+        {0xE5,0xB1,0x83,3}, {0xE5,0xB1,0x84,3}, {0xE5,0xB1,0x86,3}, {0xE5,0xB1,0x87,3}, {0xE5,0xB1,0x8C,3}, {0xE5,0xB1,0x8D,3}, {0xE5,0xB1,0x92,3}, {0xE5,0xB1,0x93,3},
+        {0xE5,0xB1,0x94,3}, {0xE5,0xB1,0x96,3}, {0xE5,0xB1,0x97,3}, {0xE5,0xB1,0x98,3}, {0xE5,0xB1,0x9A,3}, {0xE5,0xB1,0x9B,3}, {0xE5,0xB1,0x9C,3}, {0xE5,0xB1,0x9D,3},
+        {0xE5,0xB1,0x9F,3}, {0xE5,0xB1,0xA2,3}, {0xE5,0xB1,0xA4,3}, {0xE5,0xB1,0xA7,3}, {0xE5,0xB1,0xA8,3}, {0xE5,0xB1,0xA9,3}, {0xE5,0xB1,0xAA,3}, {0xE5,0xB1,0xAB,3},
+        {0xE5,0xB1,0xAC,3}, {0xE5,0xB1,0xAD,3}, {0xE5,0xB1,0xB0,3}, {0xE5,0xB1,0xB2,3}, {0xE5,0xB1,0xB3,3}, {0xE5,0xB1,0xB4,3}, {0xE5,0xB1,0xB5,3}, {0xE5,0xB1,0xB6,3},
+        {0xE5,0xB1,0xB7,3}, {0xE5,0xB1,0xB8,3}, {0xE5,0xB1,0xBB,3}, {0xE5,0xB1,0xBC,3}, {0xE5,0xB1,0xBD,3}, {0xE5,0xB1,0xBE,3}, {0xE5,0xB2,0x80,3}, {0xE5,0xB2,0x83,3},
+        {0xE5,0xB2,0x84,3}, {0xE5,0xB2,0x85,3}, {0xE5,0xB2,0x86,3}, {0xE5,0xB2,0x87,3}, {0xE5,0xB2,0x89,3}, {0xE5,0xB2,0x8A,3}, {0xE5,0xB2,0x8B,3}, {0xE5,0xB2,0x8E,3},
+        {0xE5,0xB2,0x8F,3}, {0xE5,0xB2,0x92,3}, {0xE5,0xB2,0x93,3}, {0xE5,0xB2,0x95,3}, {0xE5,0xB2,0x9D,3}, {0xE5,0xB2,0x9E,3}, {0xE5,0xB2,0x9F,3}, {0xE5,0xB2,0xA0,3},
+        {0xE5,0xB2,0xA1,3}, {0xE5,0xB2,0xA4,3}, {0xE5,0xB2,0xA5,3}, {0xE5,0xB2,0xA6,3}, {0xE5,0xB2,0xA7,3}, {0xE5,0xB2,0xA8,3},
+    },
+    /* 0x8D */ {
+        {0xE5,0xB2,0xAA,3}, {0xE5,0xB2,0xAE,3}, {0xE5,0xB2,0xAF,3}, {0xE5,0xB2,0xB0,3}, {0xE5,0xB2,0xB2,3}, {0xE5,0xB2,0xB4,3}, {0xE5,0xB2,0xB6,3}, {0xE5,0xB2,0xB9,3},
+        {0xE5,0xB2,0xBA,3}, {0xE5,0xB2,0xBB,3}, {0xE5,0xB2,0xBC,3}, {0xE5,0xB2,0xBE,3}, {0xE5,0xB3,0x80,3}, {0xE5,0xB3,0x82,3}, {0xE5,0xB3,0x83,3}, {0xE5,0xB3,0x85,3},
+        {0xE5,0xB3,0x86,3}, {0xE5,0xB3,0x87,3}, {0xE5,0xB3,0x88,3}, {0xE5,0xB3,0x89,3}, {0xE5,0xB3,0x8A,3}, {0xE5,0xB3,0x8C,3}, {0xE5,0xB3,0x8D,3}, {0xE5,0xB3,0x8E,3},
+        {0xE5,0xB3,0x8F,3}, {0xE5,0xB3,0x90,3}, {0xE5,0xB3,0x91,3}, {0xE5,0xB3,0x93,3}, {0xE5,0xB3,0x94,3}, {0xE5,0xB3,0x95,3}, {0xE5,0xB3,0x96,3}, {0xE5,0xB3,0x97,3},
+        {0xE5,0xB3,0x98,3}, {0xE5,0xB3,0x9A,3}, {0xE5,0xB3,0x9B,3}, {0xE5,0xB3,0x9C,3}, {0xE5,0xB3,0x9D,3}, {0xE5,0xB3,0x9E,3}, {0xE5,0xB3,0x9F,3}, {0xE5,0xB3,0xA0,3},
+        {0xE5,0xB3,0xA2,3}, {0xE5,0xB3,0xA3,3}, {0xE5,0xB3,0xA7,3}, {0xE5,0xB3,0xA9,3}, {0xE5,0xB3,0xAB,3}, {0xE5,0xB3,0xAC,3}, {0xE5,0xB3,0xAE,3}, {0xE5,0xB3,0xAF,3},
+        {0xE5,0xB3,0xB1,3}, {0xE5,0xB3,0xB2,3}, {0xE5,0xB3,0xB3,3}, {0xE5,0xB3,0xB4,3}, {0xE5,0xB3,0xB5,3}, {0xE5,0xB3,0xB6,3}, {0xE5,0xB3,0xB7,3}, {0xE5,0xB3,0xB8,3},
+        {0xE5,0xB3,0xB9,3}, {0xE5,0xB3,0xBA,3}, {0xE5,0xB3,0xBC,3}, {0xE5,0xB3,0xBD,3}, {0xE5,0xB3,0xBE,3}, {0xE5,0xB3,0xBF,3}, {0xE5,0xB4,0x80,3}, {0xE5,0xB4,0x81,3},
+        {0xE5,0xB4,0x84,3}, {0xE5,0xB4,0x85,3}, {0xE5,0xB4,0x88,3}, {0xE5,0xB4,0x89,3}, {0xE5,0xB4,0x8A,3}, {0xE5,0xB4,0x8B,3}, {0xE5,0xB4,0x8C,3}, {0xE5,0xB4,0x8D,3},
+        {0xE5,0xB4,0x8F,3}, {0xE5,0xB4,0x90,3}, {0xE5,0xB4,0x91,3}, {0xE5,0xB4,0x92,3}, {0xE5,0xB4,0x93,3}, {0xE5,0xB4,0x95,3}, {0xE5,0xB4,0x97,3}, {0xE5,0xB4,0x98,3},
+        {0xE5,0xB4,0x99,3}, {0xE5,0xB4,0x9A,3}, {0xE5,0xB4,0x9C,3}, {0xE5,0xB4,0x9D,3}, {0xE5,0xB4,0x9F,3}, {0xE5,0xB4,0xA0,3}, {0xE5,0xB4,0xA1,3}, {0xE5,0xB4,0xA2,3},
+        {0xE5,0xB4,0xA3,3}, {0xE5,0xB4,0xA5,3}, {0xE5,0xB4,0xA8,3}, {0xE5,0xB4,0xAA,3}, {0xE5,0xB4,0xAB,3}, {0xE5,0xB4,0xAC,3}, {0xE5,0xB4,0xAF,3}, {0xE5,0xB4,0xB0,3},
+        {0xE5,0xB4,0xB1,3}, {0xE5,0xB4,0xB2,3}, {0xE5,0xB4,0xB3,3}, {0xE5,0xB4,0xB5,3}, {0xE5,0xB4,0xB6,3}, {0xE5,0xB4,0xB7,3}, {0xE5,0xB4,0xB8,3}, {0xE5,0xB4,0xB9,3},
+        {0xE5,0xB4,0xBA,3}, {0xE5,0xB4,0xBB,3}, {0xE5,0xB4,0xBC,3}, {0xE5,0xB4,0xBF,3}, {0xE5,0xB5,0x80,3}, {0xE5,0xB5,0x81,3}, {0xE5,0xB5,0x82,3}, {0xE5,0xB5,0x83,3},
+        {0xE5,0xB5,0x84,3}, {0xE5,0xB5,0x85,3}, {0xE5,0xB5,0x86,3}, {0xE5,0xB5,0x88,3}, {0xE5,0xB5,0x89,3}, {0xE5,0xB5,0x8D,3}, {0xE5,0xB5,0x8E,3}, {0xE5,0xB5,0x8F,3},
+        {0xE5,0xB5,0x90,3}, {0xE5,0xB5,0x91,3}, {0xE5,0xB5,0x92,3}, {0xE5,0xB5,0x93,3}, {0xE5,0xB5,0x94,3}, {0xE5,0xB5,0x95,3}, {0xE5,0xB5,0x96,3}, {0xE5,0xB5,0x97,3},
+        {0xE5,0xB5,0x99,3}, {0xE5,0xB5,0x9A,3}, {0xE5,0xB5,0x9C,3}, {0xE5,0xB5,0x9E,3}, {0xE5,0xB5,0x9F,3}, {0xE5,0xB5,0xA0,3}, {0xE5,0xB5,0xA1,3}, {0xE5,0xB5,0xA2,3},
+        {0xE5,0xB5,0xA3,3}, {0xE5,0xB5,0xA4,3}, {0xE5,0xB5,0xA5,3}, {0xE5,0xB5,0xA6,3}, {0xE5,0xB5,0xA7,3}, {0xE5,0xB5,0xA8,3}, {0xE5,0xB5,0xAA,3}, {0xE5,0xB5,0xAD,3},
+        {0xE5,0xB5,0xAE,3}, {0xE5,0xB5,0xB0,3}, {0xE5,0xB5,0xB1,3}, {0xE5,0xB5,0xB2,3}, {0xE5,0xB5,0xB3,3}, {0xE5,0xB5,0xB5,3}, {0xE5,0xB5,0xB6,3}, {0xE5,0xB5,0xB7,3},
+        {0xE5,0xB5,0xB8,3}, {0xE5,0xB5,0xB9,3}, {0xE5,0xB5,0xBA,3}, {0xE5,0xB5,0xBB,3}, {0xE5,0xB5,0xBC,3}, {0xE5,0xB5,0xBD,3}, {0xE5,0xB5,0xBE,3}, {0xE5,0xB5,0xBF,3},
+        {0xE5,0xB6,0x80,3}, {0xE5,0xB6,0x81,3}, {0xE5,0xB6,0x83,3}, {0xE5,0xB6,0x84,3}, {0xE5,0xB6,0x85,3}, {0xE5,0xB6,0x86,3}, {0xE5,0xB6,0x87,3}, {0xE5,0xB6,0x88,3},
+        {0xE5,0xB6,0x89,3}, {0xE5,0xB6,0x8A,3}, {0xE5,0xB6,0x8B,3}, {0xE5,0xB6,0x8C,3}, {0xE5,0xB6,0x8D,3}, {0xE5,0xB6,0x8E,3}, {0xE5,0xB6,0x8F,3}, {0xE5,0xB6,0x90,3},
+        {0xE5,0xB6,0x91,3}, {0xE5,0xB6,0x92,3}, {0xE5,0xB6,0x93,3}, {0xE5,0xB6,0x94,3}, {0xE5,0xB6,0x95,3}, {0xE5,0xB6,0x96,3}, {0xE5,0xB6,0x97,3}, {0xE5,0xB6,0x98,3},
+        {0xE5,0xB6,0x9A,3}, {0xE5,0xB6,0x9B,3}, {0xE5,0xB6,0x9C,3}, {0xE5,0xB6,0x9E,3}, {0xE5,0xB6,0x9F,3}, {0xE5,0xB6,0xA0,3},
+    },
+    /* 0x8E */ {
+        {0xE5,0xB6,0xA1,3}, {0xE5,0xB6,0xA2,3}, {0xE5,0xB6,0xA3,3}, {0xE5,0xB6,0xA4,3}, {0xE5,0xB6,0xA5,3}, {0xE5,0xB6,0xA6,3}, {0xE5,0xB6,0xA7,3}, {0xE5,0xB6,0xA8,3},
+        {0xE5,0xB6,0xA9,3}, {0xE5,0xB6,0xAA,3}, {0xE5,0xB6,0xAB,3}, {0xE5,0xB6,0xAC,3}, {0xE5,0xB6,0xAD,3}, {0xE5,0xB6,0xAE,3}, {0xE5,0xB6,0xAF,3}, {0xE5,0xB6,0xB0,3},
+        {0xE5,0xB6,0xB1,3}, {0xE5,0xB6,0xB2,3}, {0xE5,0xB6,0xB3,3}, {0xE5,0xB6,0xB4,3}, {0xE5,0xB6,0xB5,3}, {0xE5,0xB6,0xB6,3}, {0xE5,0xB6,0xB8,3}, {0xE5,0xB6,0xB9,3},
+        {0xE5,0xB6,0xBA,3}, {0xE5,0xB6,0xBB,3}, {0xE5,0xB6,0xBC,3}, {0xE5,0xB6,0xBD,3}, {0xE5,0xB6,0xBE,3}, {0xE5,0xB6,0xBF,3}, {0xE5,0xB7,0x80,3}, {0xE5,0xB7,0x81,3},
+        {0xE5,0xB7,0x82,3}, {0xE5,0xB7,0x83,3}, {0xE5,0xB7,0x84,3}, {0xE5,0xB7,0x86,3}, {0xE5,0xB7,0x87,3}, {0xE5,0xB7,0x88,3}, {0xE5,0xB7,0x89,3}, {0xE5,0xB7,0x8A,3},
+        {0xE5,0xB7,0x8B,3}, {0xE5,0xB7,0x8C,3}, {0xE5,0xB7,0x8E,3}, {0xE5,0xB7,0x8F,3}, {0xE5,0xB7,0x90,3}, {0xE5,0xB7,0x91,3}, {0xE5,0xB7,0x92,3}, {0xE5,0xB7,0x93,3},
+        {0xE5,0xB7,0x94,3}, {0xE5,0xB7,0x95,3}, {0xE5,0xB7,0x96,3}, {0xE5,0xB7,0x97,3}, {0xE5,0xB7,0x98,3}, {0xE5,0xB7,0x99,3}, {0xE5,0xB7,0x9A,3}, {0xE5,0xB7,0x9C,3},
+        {0xE5,0xB7,0x9F,3}, {0xE5,0xB7,0xA0,3}, {0xE5,0xB7,0xA3,3}, {0xE5,0xB7,0xA4,3}, {0xE5,0xB7,0xAA,3}, {0xE5,0xB7,0xAC,3}, {0xE5,0xB7,0xAD,3}, {0xE5,0xB7,0xB0,3},
+        {0xE5,0xB7,0xB5,3}, {0xE5,0xB7,0xB6,3}, {0xE5,0xB7,0xB8,3}, {0xE5,0xB7,0xB9,3}, {0xE5,0xB7,0xBA,3}, {0xE5,0xB7,0xBB,3}, {0xE5,0xB7,0xBC,3}, {0xE5,0xB7,0xBF,3},
+        {0xE5,0xB8,0x80,3}, {0xE5,0xB8,0x84,3}, {0xE5,0xB8,0x87,3}, {0xE5,0xB8,0x89,3}, {0xE5,0xB8,0x8A,3}, {0xE5,0xB8,0x8B,3}, {0xE5,0xB8,0x8D,3}, {0xE5,0xB8,0x8E,3},
+        {0xE5,0xB8,0x92,3}, {0xE5,0xB8,0x93,3}, {0xE5,0xB8,0x97,3}, {0xE5,0xB8,0x9E,3}, {0xE5,0xB8,0x9F,3}, {0xE5,0xB8,0xA0,3}, {0xE5,0xB8,0xA1,3}, {0xE5,0xB8,0xA2,3},
+        {0xE5,0xB8,0xA3,3}, {0xE5,0xB8,0xA4,3}, {0xE5,0xB8,0xA5,3}, {0xE5,0xB8,0xA8,3}, {0xE5,0xB8,0xA9,3}, {0xE5,0xB8,0xAA,3}, {0xE5,0xB8,0xAB,3}, {0xE5,0xB8,0xAC,3},
+        {0xE5,0xB8,0xAF,3}, {0xE5,0xB8,0xB0,3}, {0xE5,0xB8,0xB2,3}, {0xE5,0xB8,0xB3,3}, {0xE5,0xB8,0xB4,3}, {0xE5,0xB8,0xB5,3}, {0xE5,0xB8,0xB6,3}, {0xE5,0xB8,0xB9,3},
+        {0xE5,0xB8,0xBA,3}, {0xE5,0xB8,0xBE,3}, {0xE5,0xB8,0xBF,3}, {0xE5,0xB9,0x80,3}, {0xE5,0xB9,0x81,3}, {0xE5,0xB9,0x83,3}, {0xE5,0xB9,0x86,3}, {0xE5,0xB9,0x87,3},
+        {0xE5,0xB9,0x88,3}, {0xE5,0xB9,0x89,3}, {0xE5,0xB9,0x8A,3}, {0xE5,0xB9,0x8B,3}, {0xE5,0xB9,0x8D,3}, {0xE5,0xB9,0x8E,3}, {0xE5,0xB9,0x8F,3}, {0xE5,0xB9,0x90,3},
+        {0xE5,0xB9,0x91,3}, {0xE5,0xB9,0x92,3}, {0xE5,0xB9,0x93,3}, {0xE5,0xB9,0x96,3}, {0xE5,0xB9,0x97,3}, {0xE5,0xB9,0x98,3}, {0xE5,0xB9,0x99,3}, {0xE5,0xB9,0x9A,3},
+        {0xE5,0xB9,0x9C,3}, {0xE5,0xB9,0x9D,3}, {0xE5,0xB9,0x9F,3}, {0xE5,0xB9,0xA0,3}, {0xE5,0xB9,0xA3,3}, {0xE5,0xB9,0xA4,3}, {0xE5,0xB9,0xA5,3}, {0xE5,0xB9,0xA6,3},
+        {0xE5,0xB9,0xA7,3}, {0xE5,0xB9,0xA8,3}, {0xE5,0xB9,0xA9,3}, {0xE5,0xB9,0xAA,3}, {0xE5,0xB9,0xAB,3}, {0xE5,0xB9,0xAC,3}, {0xE5,0xB9,0xAD,3}, {0xE5,0xB9,0xAE,3},
+        {0xE5,0xB9,0xAF,3}, {0xE5,0xB9,0xB0,3}, {0xE5,0xB9,0xB1,3}, {0xE5,0xB9,0xB5,3}, {0xE5,0xB9,0xB7,3}, {0xE5,0xB9,0xB9,3}, {0xE5,0xB9,0xBE,3}, {0xE5,0xBA,0x81,3},
+        {0xE5,0xBA,0x82,3}, {0xE5,0xBA,0x83,3}, {0xE5,0xBA,0x85,3}, {0xE5,0xBA,0x88,3}, {0xE5,0xBA,0x89,3}, {0xE5,0xBA,0x8C,3}, {0xE5,0xBA,0x8D,3}, {0xE5,0xBA,0x8E,3},
+        {0xE5,0xBA,0x92,3}, {0xE5,0xBA,0x98,3}, {0xE5,0xBA,0x9B,3}, {0xE5,0xBA,0x9D,3}, {0xE5,0xBA,0xA1,3}, {0xE5,0xBA,0xA2,3}, {0xE5,0xBA,0xA3,3}, {0xE5,0xBA,0xA4,3},
+        {0xE5,0xBA,0xA8,3}, {0xE5,0xBA,0xA9,3}, {0xE5,0xBA,0xAA,3}, {0xE5,0xBA,0xAB,3}, {0xE5,0xBA,0xAC,3}, {0xE5,0xBA,0xAE,3}, {0xE5,0xBA,0xAF,3}, {0xE5,0xBA,0xB0,3},
+        {0xE5,0xBA,0xB1,3}, {0xE5,0xBA,0xB2,3}, {0xE5,0xBA,0xB4,3}, {0xE5,0xBA,0xBA,3}, {0xE5,0xBA,0xBB,3}, {0xE5,0xBA,0xBC,3}, {0xE5,0xBA,0xBD,3}, {0xE5,0xBA,0xBF,3},
+        {0xE5,0xBB,0x80,3}, {0xE5,0xBB,0x81,3}, {0xE5,0xBB,0x82,3}, {0xE5,0xBB,0x83,3}, {0xE5,0xBB,0x84,3}, {0xE5,0xBB,0x85,3},
+    },
+    /* 0x8F */ {
+        {0xE5,0xBB,0x86,3}, {0xE5,0xBB,0x87,3}, {0xE5,0xBB,0x88,3}, {0xE5,0xBB,0x8B,3}, {0xE5,0xBB,0x8C,3}, {0xE5,0xBB,0x8D,3}, {0xE5,0xBB,0x8E,3}, {0xE5,0xBB,0x8F,3},
+        {0xE5,0xBB,0x90,3}, {0xE5,0xBB,0x94,3}, {0xE5,0xBB,0x95,3}, {0xE5,0xBB,0x97,3}, {0xE5,0xBB,0x98,3}, {0xE5,0xBB,0x99,3}, {0xE5,0xBB,0x9A,3}, {0xE5,0xBB,0x9C,3},
+        {0xE5,0xBB,0x9D,3}, {0xE5,0xBB,0x9E,3}, {0xE5,0xBB,0x9F,3}, {0xE5,0xBB,0xA0,3}, {0xE5,0xBB,0xA1,3}, {0xE5,0xBB,0xA2,3}, {0xE5,0xBB,0xA3,3}, {0xE5,0xBB,0xA4,3},
+        {0xE5,0xBB,0xA5,3}, {0xE5,0xBB,0xA6,3}, {0xE5,0xBB,0xA7,3}, {0xE5,0xBB,0xA9,3}, {0xE5,0xBB,0xAB,3}, {0xE5,0xBB,0xAC,3}, {0xE5,0xBB,0xAD,3}, {0xE5,0xBB,0xAE,3},
+        {0xE5,0xBB,0xAF,3}, {0xE5,0xBB,0xB0,3}, {0xE5,0xBB,0xB1,3}, {0xE5,0xBB,0xB2,3}, {0xE5,0xBB,0xB3,3}, {0xE5,0xBB,0xB5,3}, {0xE5,0xBB,0xB8,3}, {0xE5,0xBB,0xB9,3},
+        {0xE5,0xBB,0xBB,3}, {0xE5,0xBB,0xBC,3}, {0xE5,0xBB,0xBD,3}, {0xE5,0xBC,0x85,3}, {0xE5,0xBC,0x86,3}, {0xE5,0xBC,0x87,3}, {0xE5,0xBC,0x89,3}, {0xE5,0xBC,0x8C,3},
+        {0xE5,0xBC,0x8D,3}, {0xE5,0xBC,0x8E,3}, {0xE5,0xBC,0x90,3}, {0xE5,0xBC,0x92,3}, {0xE5,0xBC,0x94,3}, {0xE5,0xBC,0x96,3}, {0xE5,0xBC,0x99,3}, {0xE5,0xBC,0x9A,3},
+        {0xE5,0xBC,0x9C,3}, {0xE5,0xBC,0x9D,3}, {0xE5,0xBC,0x9E,3}, {0xE5,0xBC,0xA1,3}, {0xE5,0xBC,0xA2,3}, {0xE5,0xBC,0xA3,3}, {0xE5,0xBC,0xA4,3}, {0xE5,0xBC,0xA8,3},
+        {0xE5,0xBC,0xAB,3}, {0xE5,0xBC,0xAC,3}, {0xE5,0xBC,0xAE,3}, {0xE5,0xBC,0xB0,3}, {0xE5,0xBC,0xB2,3}, {0xE5,0xBC,0xB3,3}, {0xE5,0xBC,0xB4,3}, {0xE5,0xBC,0xB5,3},
+        {0xE5,0xBC,0xB6,3}, {0xE5,0xBC,0xB7,3}, {0xE5,0xBC,0xB8,3}, {0xE5,0xBC,0xBB,3}, {0xE5,0xBC,0xBD,3}, {0xE5,0xBC,0xBE,3}, {0xE5,0xBC,0xBF,3}, {0xE5,0xBD,0x81,3},
+        {0xE5,0xBD,0x82,3}, {0xE5,0xBD,0x83,3}, {0xE5,0xBD,0x84,3}, {0xE5,0xBD,0x85,3}, {0xE5,0xBD,0x86,3}, {0xE5,0xBD,0x87,3}, {0xE5,0xBD,0x88,3}, {0xE5,0xBD,0x89,3},
+        {0xE5,0xBD,0x8A,3}, {0xE5,0xBD,0x8B,3}, {0xE5,0xBD,0x8C,3}, {0xE5,0xBD,0x8D,3}, {0xE5,0xBD,0x8E,3}, {0xE5,0xBD,0x8F,3}, {0xE5,0xBD,0x91,3}, {0xE5,0xBD,0x94,3},
+        {0xE5,0xBD,0x99,3}, {0xE5,0xBD,0x9A,3}, {0xE5,0xBD,0x9B,3}, {0xE5,0xBD,0x9C,3}, {0xE5,0xBD,0x9E,3}, {0xE5,0xBD,0x9F,3}, {0xE5,0xBD,0xA0,3}, {0xE5,0xBD,0xA3,3},
+        {0xE5,0xBD,0xA5,3}, {0xE5,0xBD,0xA7,3}, {0xE5,0xBD,0xA8,3}, {0xE5,0xBD,0xAB,3}, {0xE5,0xBD,0xAE,3}, {0xE5,0xBD,0xAF,3}, {0xE5,0xBD,0xB2,3}, {0xE5,0xBD,0xB4,3},
+        {0xE5,0xBD,0xB5,3}, {0xE5,0xBD,0xB6,3}, {0xE5,0xBD,0xB8,3}, {0xE5,0xBD,0xBA,3}, {0xE5,0xBD,0xBD,3}, {0xE5,0xBD,0xBE,3}, {0xE5,0xBD,0xBF,3}, {0xE5,0xBE,0x83,3},
+        {0xE5,0xBE,0x86,3}, {0xE5,0xBE,0x8D,3}, {0xE5,0xBE,0x8E,3}, {0xE5,0xBE,0x8F,3}, {0xE5,0xBE,0x91,3}, {0xE5,0xBE,0x93,3}, {0xE5,0xBE,0x94,3}, {0xE5,0xBE,0x96,3},
+        {0xE5,0xBE,0x9A,3}, {0xE5,0xBE,0x9B,3}, {0xE5,0xBE,0x9D,3}, {0xE5,0xBE,0x9E,3}, {0xE5,0xBE,0x9F,3}, {0xE5,0xBE,0xA0,3}, {0xE5,0xBE,0xA2,3}, {0xE5,0xBE,0xA3,3},
+        {0xE5,0xBE,0xA4,3}, {0xE5,0xBE,0xA5,3}, {0xE5,0xBE,0xA6,3}, {0xE5,0xBE,0xA7,3}, {0xE5,0xBE,0xA9,3}, {0xE5,0xBE,0xAB,3}, {0xE5,0xBE,0xAC,3}, {0xE5,0xBE,0xAF,3},
+        {0xE5,0xBE,0xB0,3}, {0xE5,0xBE,0xB1,3}, {0xE5,0xBE,0xB2,3}, {0xE5,0xBE,0xB3,3}, {0xE5,0xBE,0xB4,3}, {0xE5,0xBE,0xB6,3}, {0xE5,0xBE,0xB8,3}, {0xE5,0xBE,0xB9,3},
+        {0xE5,0xBE,0xBA,3}, {0xE5,0xBE,0xBB,3}, {0xE5,0xBE,0xBE,3}, {0xE5,0xBE,0xBF,3}, {0xE5,0xBF,0x80,3}, {0xE5,0xBF,0x81,3}, {0xE5,0xBF,0x82,3}, {0xE5,0xBF,0x87,3},
+        {0xE5,0xBF,0x88,3}, {0xE5,0xBF,0x8A,3}, {0xE5,0xBF,0x8B,3}, {0xE5,0xBF,0x8E,3}, {0xE5,0xBF,0x93,3}, {0xE5,0xBF,0x94,3}, {0xE5,0xBF,0x95,3}, {0xE5,0xBF,0x9A,3},
+        {0xE5,0xBF,0x9B,3}, {0xE5,0xBF,0x9C,3}, {0xE5,0xBF,0x9E,3}, {0xE5,0xBF,0x9F,3}, {0xE5,0xBF,0xA2,3}, {0xE5,0xBF,0xA3,3}, {0xE5,0xBF,0xA5,3}, {0xE5,0xBF,0xA6,3},
+        {0xE5,0xBF,0xA8,3}, {0xE5,0xBF,0xA9,3}, {0xE5,0xBF,0xAC,3}, {0xE5,0xBF,0xAF,3}, {0xE5,0xBF,0xB0,3}, {0xE5,0xBF,0xB2,3}, {0xE5,0xBF,0xB3,3}, {0xE5,0xBF,0xB4,3},
+        {0xE5,0xBF,0xB6,3}, {0xE5,0xBF,0xB7,3}, {0xE5,0xBF,0xB9,3}, {0xE5,0xBF,0xBA,3}, {0xE5,0xBF,0xBC,3}, {0xE6,0x80,0x87,3},
+    },
+    /* 0x90 */ {
+        {0xE6,0x80,0x88,3}, {0xE6,0x80,0x89,3}, {0xE6,0x80,0x8B,3}, {0xE6,0x80,0x8C,3}, {0xE6,0x80,0x90,3}, {0xE6,0x80,0x91,3}, {0xE6,0x80,0x93,3}, {0xE6,0x80,0x97,3},
+        {0xE6,0x80,0x98,3}, {0xE6,0x80,0x9A,3}, {0xE6,0x80,0x9E,3}, {0xE6,0x80,0x9F,3}, {0xE6,0x80,0xA2,3}, {0xE6,0x80,0xA3,3}, {0xE6,0x80,0xA4,3}, {0xE6,0x80,0xAC,3},
+        {0xE6,0x80,0xAD,3}, {0xE6,0x80,0xAE,3}, {0xE6,0x80,0xB0,3}, {0xE6,0x80,0xB1,3}, {0xE6,0x80,0xB2,3}, {0xE6,0x80,0xB3,3}, {0xE6,0x80,0xB4,3}, {0xE6,0x80,0xB6,3},
+        {0xE6,0x80,0xB7,3}, {0xE6,0x80,0xB8,3}, {0xE6,0x80,0xB9,3}, {0xE6,0x80,0xBA,3}, {0xE6,0x80,0xBD,3}, {0xE6,0x80,0xBE,3}, {0xE6,0x81,0x80,3}, {0xE6,0x81,0x84,3},
+        {0xE6,0x81,0x85,3}, {0xE6,0x81,0x86,3}, {0xE6,0x81,0x87,3}, {0xE6,0x81,0x88,3}, {0xE6,0x81,0x89,3}, {0xE6,0x81,0x8A,3}, {0xE6,0x81,0x8C,3}, {0xE6,0x81,0x8E,3},
+        {0xE6,0x81,0x8F,3}, {0xE6,0x81,0x91,3}, {0xE6,0x81,0x93,3}, {0xE6,0x81,0x94,3}, {0xE6,0x81,0x96,3}, {0xE6,0x81,0x97,3}, {0xE6,0x81,0x98,3}, {0xE6,0x81,0x9B,3},
+        {0xE6,0x81,0x9C,3}, {0xE6,0x81,0x9E,3}, {0xE6,0x81,0x9F,3}, {0xE6,0x81,0xA0,3}, {0xE6,0x81,0xA1,3}, {0xE6,0x81,0xA5,3}, {0xE6,0x81,0xA6,3}, {0xE6,0x81,0xAE,3},
+        {0xE6,0x81,0xB1,3}, {0xE6,0x81,0xB2,3}, {0xE6,0x81,0xB4,3}, {0xE6,0x81,0xB5,3}, {0xE6,0x81,0xB7,3}, {0xE6,0x81,0xBE,3}, {0xE6,0x82,0x80,3}, {0xE6,0x82,0x81,3},
+        {0xE6,0x82,0x82,3}, {0xE6,0x82,0x85,3}, {0xE6,0x82,0x86,3}, {0xE6,0x82,0x87,3}, {0xE6,0x82,0x88,3}, {0xE6,0x82,0x8A,3}, {0xE6,0x82,0x8B,3}, {0xE6,0x82,0x8E,3},
+        {0xE6,0x82,0x8F,3}, {0xE6,0x82,0x90,3}, {0xE6,0x82,0x91,3}, {0xE6,0x82,0x93,3}, {0xE6,0x82,0x95,3}, {0xE6,0x82,0x97,3}, {0xE6,0x82,0x98,3}, {0xE6,0x82,0x99,3},
+        {0xE6,0x82,0x9C,3}, {0xE6,0x82,0x9E,3}, {0xE6,0x82,0xA1,3}, {0xE6,0x82,0xA2,3}, {0xE6,0x82,0xA4,3}, {0xE6,0x82,0xA5,3}, {0xE6,0x82,0xA7,3}, {0xE6,0x82,0xA9,3},
+        {0xE6,0x82,0xAA,3}, {0xE6,0x82,0xAE,3}, {0xE6,0x82,0xB0,3}, {0xE6,0x82,0xB3,3}, {0xE6,0x82,0xB5,3}, {0xE6,0x82,0xB6,3}, {0xE6,0x82,0xB7,3}, {0xE6,0x82,0xB9,3},
+        {0xE6,0x82,0xBA,3}, {0xE6,0x82,0xBD,3}, {0xE6,0x82,0xBE,3}, {0xE6,0x82,0xBF,3}, {0xE6,0x83,0x80,3}, {0xE6,0x83,0x81,3}, {0xE6,0x83,0x82,3}, {0xE6,0x83,0x83,3},
+        {0xE6,0x83,0x84,3}, {0xE6,0x83,0x87,3}, {0xE6,0x83,0x88,3}, {0xE6,0x83,0x89,3}, {0xE6,0x83,0x8C,3}, {0xE6,0x83,0x8D,3}, {0xE6,0x83,0x8E,3}, {0xE6,0x83,0x8F,3},
+        {0xE6,0x83,0x90,3}, {0xE6,0x83,0x92,3}, {0xE6,0x83,0x93,3}, {0xE6,0x83,0x94,3}, {0xE6,0x83,0x96,3}, {0xE6,0x83,0x97,3}, {0xE6,0x83,0x99,3}, {0xE6,0x83,0x9B,3},
+        {0xE6,0x83,0x9E,3}, {0xE6,0x83,0xA1,3}, {0xE6,0x83,0xA2,3}, {0xE6,0x83,0xA3,3}, {0xE6,0x83,0xA4,3}, {0xE6,0x83,0xA5,3}, {0xE6,0x83,0xAA,3}, {0xE6,0x83,0xB1,3},
+        {0xE6,0x83,0xB2,3}, {0xE6,0x83,0xB5,3}, {0xE6,0x83,0xB7,3}, {0xE6,0x83,0xB8,3}, {0xE6,0x83,0xBB,3}, {0xE6,0x83,0xBC,3}, {0xE6,0x83,0xBD,3}, {0xE6,0x83,0xBE,3},
+        {0xE6,0x83,0xBF,3}, {0xE6,0x84,0x82,3}, {0xE6,0x84,0x83,3}, {0xE6,0x84,0x84,3}, {0xE6,0x84,0x85,3}, {0xE6,0x84,0x87,3}, {0xE6,0x84,0x8A,3}, {0xE6,0x84,0x8B,3},
+        {0xE6,0x84,0x8C,3}, {0xE6,0x84,0x90,3}, {0xE6,0x84,0x91,3}, {0xE6,0x84,0x92,3}, {0xE6,0x84,0x93,3}, {0xE6,0x84,0x94,3}, {0xE6,0x84,0x96,3}, {0xE6,0x84,0x97,3},
+        {0xE6,0x84,0x98,3}, {0xE6,0x84,0x99,3}, {0xE6,0x84,0x9B,3}, {0xE6,0x84,0x9C,3}, {0xE6,0x84,0x9D,3}, {0xE6,0x84,0x9E,3}, {0xE6,0x84,0xA1,3}, {0xE6,0x84,0xA2,3},
+        {0xE6,0x84,0xA5,3}, {0xE6,0x84,0xA8,3}, {0xE6,0x84,0xA9,3}, {0xE6,0x84,0xAA,3}, {0xE6,0x84,0xAC,3}, {0xE6,0x84,0xAD,3}, {0xE6,0x84,0xAE,3}, {0xE6,0x84,0xAF,3},
+        {0xE6,0x84,0xB0,3}, {0xE6,0x84,0xB1,3}, {0xE6,0x84,0xB2,3}, {0xE6,0x84,0xB3,3}, {0xE6,0x84,0xB4,3}, {0xE6,0x84,0xB5,3}, {0xE6,0x84,0xB6,3}, {0xE6,0x84,0xB7,3},
+        {0xE6,0x84,0xB8,3}, {0xE6,0x84,0xB9,3}, {0xE6,0x84,0xBA,3}, {0xE6,0x84,0xBB,3}, {0xE6,0x84,0xBC,3}, {0xE6,0x84,0xBD,3}, {0xE6,0x84,0xBE,3}, {0xE6,0x85,0x80,3},
+        {0xE6,0x85,0x81,3}, {0xE6,0x85,0x82,3}, {0xE6,0x85,0x83,3}, {0xE6,0x85,0x84,3}, {0xE6,0x85,0x85,3}, {0xE6,0x85,0x86,3},
+    },
+    /* 0x91 */ {
+        {0xE6,0x85,0x87,3}, {0xE6,0x85,0x89,3}, {0xE6,0x85,0x8B,3}, {0xE6,0x85,0x8D,3}, {0xE6,0x85,0x8F,3}, {0xE6,0x85,0x90,3}, {0xE6,0x85,0x92,3}, {0xE6,0x85,0x93,3},
+        {0xE6,0x85,0x94,3}, {0xE6,0x85,0x96,3}, {0xE6,0x85,0x97,3}, {0xE6,0x85,0x98,3}, {0xE6,0x85,0x99,3}, {0xE6,0x85,0x9A,3}, {0xE6,0x85,0x9B,3}, {0xE6,0x85,0x9C,3},
+        {0xE6,0x85,0x9E,3}, {0xE6,0x85,0x9F,3}, {0xE6,0x85,0xA0,3}, {0xE6,0x85,0xA1,3}, {0xE6,0x85,0xA3,3}, {0xE6,0x85,0xA4,3}, {0xE6,0x85,0xA5,3}, {0xE6,0x85,0xA6,3},
+        {0xE6,0x85,0xA9,3}, {0xE6,0x85,0xAA,3}, {0xE6,0x85,0xAB,3}, {0xE6,0x85,0xAC,3}, {0xE6,0x85,0xAD,3}, {0xE6,0x85,0xAE,3}, {0xE6,0x85,0xAF,3}, {0xE6,0x85,0xB1,3},
+        {0xE6,0x85,0xB2,3}, {0xE6,0x85,0xB3,3}, {0xE6,0x85,0xB4,3}, {0xE6,0x85,0xB6,3}, {0xE6,0x85,0xB8,3}, {0xE6,0x85,0xB9,3}, {0xE6,0x85,0xBA,3}, {0xE6,0x85,0xBB,3},
+        {0xE6,0x85,0xBC,3}, {0xE6,0x85,0xBD,3}, {0xE6,0x85,0xBE,3}, {0xE6,0x85,0xBF,3}, {0xE6,0x86,0x80,3}, {0xE6,0x86,0x81,3}, {0xE6,0x86,0x82,3}, {0xE6,0x86,0x83,3},
+        {0xE6,0x86,0x84,3}, {0xE6,0x86,0x85,3}, {0xE6,0x86,0x86,3}, {0xE6,0x86,0x87,3}, {0xE6,0x86,0x88,3}, {0xE6,0x86,0x89,3}, {0xE6,0x86,0x8A,3}, {0xE6,0x86,0x8C,3},
+        {0xE6,0x86,0x8D,3}, {0xE6,0x86,0x8F,3}, {0xE6,0x86,0x90,3}, {0xE6,0x86,0x91,3}, {0xE6,0x86,0x92,3}, {0xE6,0x86,0x93,3}, {0xE6,0x86,0x95,3}, {0xE6,0x86,0x96,3},
+        {0xE6,0x86,0x97,3}, {0xE6,0x86,0x98,3}, {0xE6,0x86,0x99,3}, {0xE6,0x86,0x9A,3}, {0xE6,0x86,0x9B,3}, {0xE6,0x86,0x9C,3}, {0xE6,0x86,0x9E,3}, {0xE6,0x86,0x9F,3},
+        {0xE6,0x86,0xA0,3}, {0xE6,0x86,0xA1,3}, {0xE6,0x86,0xA2,3}, {0xE6,0x86,0xA3,3}, {0xE6,0x86,0xA4,3}, {0xE6,0x86,0xA5,3}, {0xE6,0x86,0xA6,3}, {0xE6,0x86,0xAA,3},
+        {0xE6,0x86,0xAB,3}, {0xE6,0x86,0xAD,3}, {0xE6,0x86,0xAE,3}, {0xE6,0x86,0xAF,3}, {0xE6,0x86,0xB0,3}, {0xE6,0x86,0xB1,3}, {0xE6,0x86,0xB2,3}, {0xE6,0x86,0xB3,3},
+        {0xE6,0x86,0xB4,3}, {0xE6,0x86,0xB5,3}, {0xE6,0x86,0xB6,3}, {0xE6,0x86,0xB8,3}, {0xE6,0x86,0xB9,3}, {0xE6,0x86,0xBA,3}, {0xE6,0x86,0xBB,3}, {0xE6,0x86,0xBC,3},
+        {0xE6,0x86,0xBD,3}, {0xE6,0x86,0xBF,3}, {0xE6,0x87,0x80,3}, {0xE6,0x87,0x81,3}, {0xE6,0x87,0x83,3}, {0xE6,0x87,0x84,3}, {0xE6,0x87,0x85,3}, {0xE6,0x87,0x86,3},
+        {0xE6,0x87,0x87,3}, {0xE6,0x87,0x89,3}, {0xE6,0x87,0x8C,3}, {0xE6,0x87,0x8D,3}, {0xE6,0x87,0x8E,3}, {0xE6,0x87,0x8F,3}, {0xE6,0x87,0x90,3}, {0xE6,0x87,0x93,3},
+        {0xE6,0x87,0x95,3}, {0xE6,0x87,0x96,3}, {0xE6,0x87,0x97,3}, {0xE6,0x87,0x98,3}, {0xE6,0x87,0x99,3}, {0xE6,0x87,0x9A,3}, {0xE6,0x87,0x9B,3}, {0xE6,0x87,0x9C,3},
+        {0xE6,0x87,0x9D,3}, {0xE6,0x87,0x9E,3}, {0xE6,0x87,0x9F,3}, {0xE6,0x87,0xA0,3}, {0xE6,0x87,0xA1,3}, {0xE6,0x87,0xA2,3}, {0xE6,0x87,0xA3,3}, {0xE6,0x87,0xA4,3},
+        {0xE6,0x87,0xA5,3}, {0xE6,0x87,0xA7,3}, {0xE6,0x87,0xA8,3}, {0xE6,0x87,0xA9,3}, {0xE6,0x87,0xAA,3}, {0xE6,0x87,0xAB,3}, {0xE6,0x87,0xAC,3}, {0xE6,0x87,0xAD,3},
+        {0xE6,0x87,0xAE,3}, {0xE6,0x87,0xAF,3}, {0xE6,0x87,0xB0,3}, {0xE6,0x87,0xB1,3}, {0xE6,0x87,0xB2,3}, {0xE6,0x87,0xB3,3}, {0xE6,0x87,0xB4,3}, {0xE6,0x87,0xB6,3},
+        {0xE6,0x87,0xB7,3}, {0xE6,0x87,0xB8,3}, {0xE6,0x87,0xB9,3}, {0xE6,0x87,0xBA,3}, {0xE6,0x87,0xBB,3}, {0xE6,0x87,0xBC,3}, {0xE6,0x87,0xBD,3}, {0xE6,0x87,0xBE,3},
+        {0xE6,0x88,0x80,3}, {0xE6,0x88,0x81,3}, {0xE6,0x88,0x82,3}, {0xE6,0x88,0x83,3}, {0xE6,0x88,0x84,3}, {0xE6,0x88,0x85,3}, {0xE6,0x88,0x87,3}, {0xE6,0x88,0x89,3},
+        {0xE6,0x88,0x93,3}, {0xE6,0x88,0x94,3}, {0xE6,0x88,0x99,3}, {0xE6,0x88,0x9C,3}, {0xE6,0x88,0x9D,3}, {0xE6,0x88,0x9E,3}, {0xE6,0x88,0xA0,3}, {0xE6,0x88,0xA3,3},
+        {0xE6,0x88,0xA6,3}, {0xE6,0x88,0xA7,3}, {0xE6,0x88,0xA8,3}, {0xE6,0x88,0xA9,3}, {0xE6,0x88,0xAB,3}, {0xE6,0x88,0xAD,3}, {0xE6,0x88,0xAF,3}, {0xE6,0x88,0xB0,3},
+        {0xE6,0x88,0xB1,3}, {0xE6,0x88,0xB2,3}, {0xE6,0x88,0xB5,3}, {0xE6,0x88,0xB6,3}, {0xE6,0x88,0xB8,3}, {0xE6,0x88,0xB9,3}, {0xE6,0x88,0xBA,3}, {0xE6,0x88,0xBB,3},
+        {0xE6,0x88,0xBC,3}, {0xE6,0x89,0x82,3}, {0xE6,0x89,0x84,3}, {0xE6,0x89,0x85,3}, {0xE6,0x89,0x86,3}, {0xE6,0x89,0x8A,3},
+    },
+    /* 0x92 */ {
+        {0xE6,0x89,0x8F,3}, {0xE6,0x89,0x90,3}, {0xE6,0x89,0x95,3}, {0xE6,0x89,0x96,3}, {0xE6,0x89,0x97,3}, {0xE6,0x89,0x99,3}, {0xE6,0x89,0x9A,3}, {0xE6,0x89,0x9C,3},
+        {0xE6,0x89,0x9D,3}, {0xE6,0x89,0x9E,3}, {0xE6,0x89,0x9F,3}, {0xE6,0x89,0xA0,3}, {0xE6,0x89,0xA1,3}, {0xE6,0x89,0xA2,3}, {0xE6,0x89,0xA4,3}, {0xE6,0x89,0xA5,3},
+        {0xE6,0x89,0xA8,3}, {0xE6,0x89,0xB1,3}, {0xE6,0x89,0xB2,3}, {0xE6,0x89,0xB4,3}, {0xE6,0x89,0xB5,3}, {0xE6,0x89,0xB7,3}, {0xE6,0x89,0xB8,3}, {0xE6,0x89,0xBA,3},
+        {0xE6,0x89,0xBB,3}, {0xE6,0x89,0xBD,3}, {0xE6,0x8A,0x81,3}, {0xE6,0x8A,0x82,3}, {0xE6,0x8A,0x83,3}, {0xE6,0x8A,0x85,3}, {0xE6,0x8A,0x86,3}, {0xE6,0x8A,0x87,3},
+        {0xE6,0x8A,0x88,3}, {0xE6,0x8A,0x8B,3}, {0xE6,0x8A,0x8C,3}, {0xE6,0x8A,0x8D,3}, {0xE6,0x8A,0x8E,3}, {0xE6,0x8A,0x8F,3}, {0xE6,0x8A,0x90,3}, {0xE6,0x8A,0x94,3},
+        {0xE6,0x8A,0x99,3}, {0xE6,0x8A,0x9C,3}, {0xE6,0x8A,0x9D,3}, {0xE6,0x8A,0x9E,3}, {0xE6,0x8A,0xA3,3}, {0xE6,0x8A,0xA6,3}, {0xE6,0x8A,0xA7,3}, {0xE6,0x8A,0xA9,3},
+        {0xE6,0x8A,0xAA,3}, {0xE6,0x8A,0xAD,3}, {0xE6,0x8A,0xAE,3}, {0xE6,0x8A,0xAF,3}, {0xE6,0x8A,0xB0,3}, {0xE6,0x8A,0xB2,3}, {0xE6,0x8A,0xB3,3}, {0xE6,0x8A,0xB4,3},
+        {0xE6,0x8A,0xB6,3}, {0xE6,0x8A,0xB7,3}, {0xE6,0x8A,0xB8,3}, {0xE6,0x8A,0xBA,3}, {0xE6,0x8A,0xBE,3}, {0xE6,0x8B,0x80,3}, {0xE6,0x8B,0x81,3}, {0xE6,0x8B,0x83,3},
+        {0xE6,0x8B,0x8B,3}, {0xE6,0x8B,0x8F,3}, {0xE6,0x8B,0x91,3}, {0xE6,0x8B,0x95,3}, {0xE6,0x8B,0x9D,3}, {0xE6,0x8B,0x9E,3}, {0xE6,0x8B,0xA0,3}, {0xE6,0x8B,0xA1,3},
+        {0xE6,0x8B,0xA4,3}, {0xE6,0x8B,0xAA,3}, {0xE6,0x8B,0xAB,3}, {0xE6,0x8B,0xB0,3}, {0xE6,0x8B,0xB2,3}, {0xE6,0x8B,0xB5,3}, {0xE6,0x8B,0xB8,3}, {0xE6,0x8B,0xB9,3},
+        {0xE6,0x8B,0xBA,3}, {0xE6,0x8B,0xBB,3}, {0xE6,0x8C,0x80,3}, {0xE6,0x8C,0x83,3}, {0xE6,0x8C,0x84,3}, {0xE6,0x8C,0x85,3}, {0xE6,0x8C,0x86,3}, {0xE6,0x8C,0x8A,3},
+        {0xE6,0x8C,0x8B,3}, {0xE6,0x8C,0x8C,3}, {0xE6,0x8C,0x8D,3}, {0xE6,0x8C,0x8F,3}, {0xE6,0x8C,0x90,3}, {0xE6,0x8C,0x92,3}, {0xE6,0x8C,0x93,3}, {0xE6,0x8C,0x94,3},
+        {0xE6,0x8C,0x95,3}, {0xE6,0x8C,0x97,3}, {0xE6,0x8C,0x98,3}, {0xE6,0x8C,0x99,3}, {0xE6,0x8C,0x9C,3}, {0xE6,0x8C,0xA6,3}, {0xE6,0x8C,0xA7,3}, {0xE6,0x8C,0xA9,3},
+        {0xE6,0x8C,0xAC,3}, {0xE6,0x8C,0xAD,3}, {0xE6,0x8C,0xAE,3}, {0xE6,0x8C,0xB0,3}, {0xE6,0x8C,0xB1,3}, {0xE6,0x8C,0xB3,3}, {0xE6,0x8C,0xB4,3}, {0xE6,0x8C,0xB5,3},
+        {0xE6,0x8C,0xB6,3}, {0xE6,0x8C,0xB7,3}, {0xE6,0x8C,0xB8,3}, {0xE6,0x8C,0xBB,3}, {0xE6,0x8C,0xBC,3}, {0xE6,0x8C,0xBE,3}, {0xE6,0x8C,0xBF,3}, {0xE6,0x8D,0x80,3},
+        {0xE6,0x8D,0x81,3}, {0xE6,0x8D,0x84,3}, {0xE6,0x8D,0x87,3}, {0xE6,0x8D,0x88,3}, {0xE6,0x8D,0x8A,3}, {0xE6,0x8D,0x91,3}, {0xE6,0x8D,0x92,3}, {0xE6,0x8D,0x93,3},
+        {0xE6,0x8D,0x94,3}, {0xE6,0x8D,0x96,3}, {0xE6,0x8D,0x97,3}, {0xE6,0x8D,0x98,3}, {0xE6,0x8D,0x99,3}, {0xE6,0x8D,0x9A,3}, {0xE6,0x8D,0x9B,3}, {0xE6,0x8D,0x9C,3},
+        {0xE6,0x8D,0x9D,3}, {0xE6,0x8D,0xA0,3}, {0xE6,0x8D,0xA4,3}, {0xE6,0x8D,0xA5,3}, {0xE6,0x8D,0xA6,3}, {0xE6,0x8D,0xA8,3}, {0xE6,0x8D,0xAA,3}, {0xE6,0x8D,0xAB,3},
+        {0xE6,0x8D,0xAC,3}, {0xE6,0x8D,0xAF,3}, {0xE6,0x8D,0xB0,3}, {0xE6,0x8D,0xB2,3}, {0xE6,0x8D,0xB3,3}, {0xE6,0x8D,0xB4,3}, {0xE6,0x8D,0xB5,3}, {0xE6,0x8D,0xB8,3},
+        {0xE6,0x8D,0xB9,3}, {0xE6,0x8D,0xBC,3}, {0xE6,0x8D,0xBD,3}, {0xE6,0x8D,0xBE,3}, {0xE6,0x8D,0xBF,3}, {0xE6,0x8E,0x81,3}, {0xE6,0x8E,0x83,3}, {0xE6,0x8E,0x84,3},
+        {0xE6,0x8E,0x85,3}, {0xE6,0x8E,0x86,3}, {0xE6,0x8E,0x8B,3}, {0xE6,0x8E,0x8D,3}, {0xE6,0x8E,0x91,3}, {0xE6,0x8E,0x93,3}, {0xE6,0x8E,0x94,3}, {0xE6,0x8E,0x95,3},
+        {0xE6,0x8E,0x97,3}, {0xE6,0x8E,0x99,3}, {0xE6,0x8E,0x9A,3}, {0xE6,0x8E,0x9B,3}, {0xE6,0x8E,0x9C,3}, {0xE6,0x8E,0x9D,3}, {0xE6,0x8E,0x9E,3}, {0xE6,0x8E,0x9F,3},
+        {0xE6,0x8E,0xA1,3}, {0xE6,0x8E,0xA4,3}, {0xE6,0x8E,0xA6,3}, {0xE6,0x8E,0xAB,3}, {0xE6,0x8E,0xAF,3}, {0xE6,0x8E,0xB1,3}, {0xE6,0x8E,0xB2,3}, {0xE6,0x8E,0xB5,3},
+        {0xE6,0x8E,0xB6,3}, {0xE6,0x8E,0xB9,3}, {0xE6,0x8E,0xBB,3}, {0xE6,0x8E,0xBD,3}, {0xE6,0x8E,0xBF,3}, {0xE6,0x8F,0x80,3},
+    },
+    /* 0x93 */ {
+        {0xE6,0x8F,0x81,3}, {0xE6,0x8F,0x82,3}, {0xE6,0x8F,0x83,3}, {0xE6,0x8F,0x85,3}, {0xE6,0x8F,0x87,3}, {0xE6,0x8F,0x88,3}, {0xE6,0x8F,0x8A,3}, {0xE6,0x8F,0x8B,3},
+        {0xE6,0x8F,0x8C,3}, {0xE6,0x8F,0x91,3}, {0xE6,0x8F,0x93,3}, {0xE6,0x8F,0x94,3}, {0xE6,0x8F,0x95,3}, {0xE6,0x8F,0x97,3}, {0xE6,0x8F,0x98,3}, {0xE6,0x8F,0x99,3},
+        {0xE6,0x8F,0x9A,3}, {0xE6,0x8F,0x9B,3}, {0xE6,0x8F,0x9C,3}, {0xE6,0x8F,0x9D,3}, {0xE6,0x8F,0x9F,3}, {0xE6,0x8F,0xA2,3}, {0xE6,0x8F,0xA4,3}, {0xE6,0x8F,0xA5,3},
+        {0xE6,0x8F,0xA6,3}, {0xE6,0x8F,0xA7,3}, {0xE6,0x8F,0xA8,3}, {0xE6,0x8F,0xAB,3}, {0xE6,0x8F,0xAC,3}, {0xE6,0x8F,0xAE,3}, {0xE6,0x8F,0xAF,3}, {0xE6,0x8F,0xB0,3},
+        {0xE6,0x8F,0xB1,3}, {0xE6,0x8F,0xB3,3}, {0xE6,0x8F,0xB5,3}, {0xE6,0x8F,0xB7,3}, {0xE6,0x8F,0xB9,3}, {0xE6,0x8F,0xBA,3}, {0xE6,0x8F,0xBB,3}, {0xE6,0x8F,0xBC,3},
+        {0xE6,0x8F,0xBE,3}, {0xE6,0x90,0x83,3}, {0xE6,0x90,0x84,3}, {0xE6,0x90,0x86,3}, {0xE6,0x90,0x87,3}, {0xE6,0x90,0x88,3}, {0xE6,0x90,0x89,3}, {0xE6,0x90,0x8A,3},
+        {0xE6,0x90,0x8D,3}, {0xE6,0x90,0x8E,3}, {0xE6,0x90,0x91,3}, {0xE6,0x90,0x92,3}, {0xE6,0x90,0x95,3}, {0xE6,0x90,0x96,3}, {0xE6,0x90,0x97,3}, {0xE6,0x90,0x98,3},
+        {0xE6,0x90,0x99,3}, {0xE6,0x90,0x9A,3}, {0xE6,0x90,0x9D,3}, {0xE6,0x90,0x9F,3}, {0xE6,0x90,0xA2,3}, {0xE6,0x90,0xA3,3}, {0xE6,0x90,0xA4,3}, {0xE6,0x90,0xA5,3},
+        {0xE6,0x90,0xA7,3}, {0xE6,0x90,0xA8,3}, {0xE6,0x90,0xA9,3}, {0xE6,0x90,0xAB,3}, {0xE6,0x90,0xAE,3}, {0xE6,0x90,0xAF,3}, {0xE6,0x90,0xB0,3}, {0xE6,0x90,0xB1,3},
+        {0xE6,0x90,0xB2,3}, {0xE6,0x90,0xB3,3}, {0xE6,0x90,0xB5,3}, {0xE6,0x90,0xB6,3}, {0xE6,0x90,0xB7,3}, {0xE6,0x90,0xB8,3}, {0xE6,0x90,0xB9,3}, {0xE6,0x90,0xBB,3},
+        {0xE6,0x90,0xBC,3}, {0xE6,0x90,0xBE,3}, {0xE6,0x91,0x80,3}, {0xE6,0x91,0x82,3}, {0xE6,0x91,0x83,3}, {0xE6,0x91,0x89,3}, {0xE6,0x91,0x8B,3}, {0xE6,0x91,0x8C,3},
+        {0xE6,0x91,0x8D,3}, {0xE6,0x91,0x8E,3}, {0xE6,0x91,0x8F,3}, {0xE6,0x91,0x90,3}, {0xE6,0x91,0x91,3}, {0xE6,0x91,0x93,3}, {0xE6,0x91,0x95,3}, {0xE6,0x91,0x96,3},
+        {0xE6,0x91,0x97,3}, {0xE6,0x91,0x99,3}, {0xE6,0x91,0x9A,3}, {0xE6,0x91,0x9B,3}, {0xE6,0x91,0x9C,3}, {0xE6,0x91,0x9D,3}, {0xE6,0x91,0x9F,3}, {0xE6,0x91,0xA0,3},
+        {0xE6,0x91,0xA1,3}, {0xE6,0x91,0xA2,3}, {0xE6,0x91,0xA3,3}, {0xE6,0x91,0xA4,3}, {0xE6,0x91,0xA5,3}, {0xE6,0x91,0xA6,3}, {0xE6,0x91,0xA8,3}, {0xE6,0x91,0xAA,3},
+        {0xE6,0x91,0xAB,3}, {0xE6,0x91,0xAC,3}, {0xE6,0x91,0xAE,3}, {0xE6,0x91,0xAF,3}, {0xE6,0x91,0xB0,3}, {0xE6,0x91,0xB1,3}, {0xE6,0x91,0xB2,3}, {0xE6,0x91,0xB3,3},
+        {0xE6,0x91,0xB4,3}, {0xE6,0x91,0xB5,3}, {0xE6,0x91,0xB6,3}, {0xE6,0x91,0xB7,3}, {0xE6,0x91,0xBB,3}, {0xE6,0x91,0xBC,3}, {0xE6,0x91,0xBD,3}, {0xE6,0x91,0xBE,3},
+        {0xE6,0x91,0xBF,3}, {0xE6,0x92,0x80,3}, {0xE6,0x92,0x81,3}, {0xE6,0x92,0x83,3}, {0xE6,0x92,0x86,3}, {0xE6,0x92,0x88,3}, {0xE6,0x92,0x89,3}, {0xE6,0x92,0x8A,3},
+        {0xE6,0x92,0x8B,3}, {0xE6,0x92,0x8C,3}, {0xE6,0x92,0x8D,3}, {0xE6,0x92,0x8E,3}, {0xE6,0x92,0x8F,3}, {0xE6,0x92,0x90,3}, {0xE6,0x92,0x93,3}, {0xE6,0x92,0x94,3},
+        {0xE6,0x92,0x97,3}, {0xE6,0x92,0x98,3}, {0xE6,0x92,0x9A,3}, {0xE6,0x92,0x9B,3}, {0xE6,0x92,0x9C,3}, {0xE6,0x92,0x9D,3}, {0xE6,0x92,0x9F,3}, {0xE6,0x92,0xA0,3},
+        {0xE6,0x92,0xA1,3}, {0xE6,0x92,0xA2,3}, {0xE6,0x92,0xA3,3}, {0xE6,0x92,0xA5,3}, {0xE6,0x92,0xA6,3}, {0xE6,0x92,0xA7,3}, {0xE6,0x92,0xA8,3}, {0xE6,0x92,0xAA,3},
+        {0xE6,0x92,0xAB,3}, {0xE6,0x92,0xAF,3}, {0xE6,0x92,0xB1,3}, {0xE6,0x92,0xB2,3}, {0xE6,0x92,0xB3,3}, {0xE6,0x92,0xB4,3}, {0xE6,0x92,0xB6,3}, {0xE6,0x92,0xB9,3},
+        {0xE6,0x92,0xBB,3}, {0xE6,0x92,0xBD,3}, {0xE6,0x92,0xBE,3}, {0xE6,0x92,0xBF,3}, {0xE6,0x93,0x81,3}, {0xE6,0x93,0x83,3}, {0xE6,0x93,0x84,3}, {0xE6,0x93,0x86,3},
+        {0xE6,0x93,0x87,3}, {0xE6,0x93,0x88,3}, {0xE6,0x93,0x89,3}, {0xE6,0x93,0x8A,3}, {0xE6,0x93,0x8B,3}, {0xE6,0x93,0x8C,3}, {0xE6,0x93,0x8F,3}, {0xE6,0x93,0x91,3},
+        {0xE6,0x93,0x93,3}, {0xE6,0x93,0x94,3}, {0xE6,0x93,0x95,3}, {0xE6,0x93,0x96,3}, {0xE6,0x93,0x99,3}, {0xE6,0x93,0x9A,3},
+    },
+    /* 0x94 */ {
+        {0xE6,0x93,0x9B,3}, {0xE6,0x93,0x9C,3}, {0xE6,0x93,0x9D,3}, {0xE6,0x93,0x9F,3}, {0xE6,0x93,0xA0,3}, {0xE6,0x93,0xA1,3}, {0xE6,0x93,0xA3,3}, {0xE6,0x93,0xA5,3},
+        {0xE6,0x93,0xA7,3}, {0xE6,0x93,0xA8,3}, {0xE6,0x93,0xA9,3}, {0xE6,0x93,0xAA,3}, {0xE6,0x93,0xAB,3}, {0xE6,0x93,0xAC,3}, {0xE6,0x93,0xAD,3}, {0xE6,0x93,0xAE,3},
+        {0xE6,0x93,0xAF,3}, {0xE6,0x93,0xB0,3}, {0xE6,0x93,0xB1,3}, {0xE6,0x93,0xB2,3}, {0xE6,0x93,0xB3,3}, {0xE6,0x93,0xB4,3}, {0xE6,0x93,0xB5,3}, {0xE6,0x93,0xB6,3},
+        {0xE6,0x93,0xB7,3}, {0xE6,0x93,0xB8,3}, {0xE6,0x93,0xB9,3}, {0xE6,0x93,0xBA,3}, {0xE6,0x93,0xBB,3}, {0xE6,0x93,0xBC,3}, {0xE6,0x93,0xBD,3}, {0xE6,0x93,0xBE,3},
+        {0xE6,0x93,0xBF,3}, {0xE6,0x94,0x81,3}, {0xE6,0x94,0x82,3}, {0xE6,0x94,0x83,3}, {0xE6,0x94,0x84,3}, {0xE6,0x94,0x85,3}, {0xE6,0x94,0x86,3}, {0xE6,0x94,0x87,3},
+        {0xE6,0x94,0x88,3}, {0xE6,0x94,0x8A,3}, {0xE6,0x94,0x8B,3}, {0xE6,0x94,0x8C,3}, {0xE6,0x94,0x8D,3}, {0xE6,0x94,0x8E,3}, {0xE6,0x94,0x8F,3}, {0xE6,0x94,0x90,3},
+        {0xE6,0x94,0x91,3}, {0xE6,0x94,0x93,3}, {0xE6,0x94,0x94,3}, {0xE6,0x94,0x95,3}, {0xE6,0x94,0x96,3}, {0xE6,0x94,0x97,3}, {0xE6,0x94,0x99,3}, {0xE6,0x94,0x9A,3},
+        {0xE6,0x94,0x9B,3}, {0xE6,0x94,0x9C,3}, {0xE6,0x94,0x9D,3}, {0xE6,0x94,0x9E,3}, {0xE6,0x94,0x9F,3}, {0xE6,0x94,0xA0,3}, {0xE6,0x94,0xA1,3}, {0xE6,0x94,0xA2,3},
+        {0xE6,0x94,0xA3,3}, {0xE6,0x94,0xA4,3}, {0xE6,0x94,0xA6,3}, {0xE6,0x94,0xA7,3}, {0xE6,0x94,0xA8,3}, {0xE6,0x94,0xA9,3}, {0xE6,0x94,0xAA,3}, {0xE6,0x94,0xAC,3},
+        {0xE6,0x94,0xAD,3}, {0xE6,0x94,0xB0,3}, {0xE6,0x94,0xB1,3}, {0xE6,0x94,0xB2,3}, {0xE6,0x94,0xB3,3}, {0xE6,0x94,0xB7,3}, {0xE6,0x94,0xBA,3}, {0xE6,0x94,0xBC,3},
+        {0xE6,0x94,0xBD,3}, {0xE6,0x95,0x80,3}, {0xE6,0x95,0x81,3}, {0xE6,0x95,0x82,3}, {0xE6,0x95,0x83,3}, {0xE6,0x95,0x84,3}, {0xE6,0x95,0x86,3}, {0xE6,0x95,0x87,3},
+        {0xE6,0x95,0x8A,3}, {0xE6,0x95,0x8B,3}, {0xE6,0x95,0x8D,3}, {0xE6,0x95,0x8E,3}, {0xE6,0x95,0x90,3}, {0xE6,0x95,0x92,3}, {0xE6,0x95,0x93,3}, {0xE6,0x95,0x94,3},
+        {0xE6,0x95,0x97,3}, {0xE6,0x95,0x98,3}, {0xE6,0x95,0x9A,3}, {0xE6,0x95,0x9C,3}, {0xE6,0x95,0x9F,3}, {0xE6,0x95,0xA0,3}, {0xE6,0x95,0xA1,3}, {0xE6,0x95,0xA4,3},
+        {0xE6,0x95,0xA5,3}, {0xE6,0x95,0xA7,3}, {0xE6,0x95,0xA8,3}, {0xE6,0x95,0xA9,3}, {0xE6,0x95,0xAA,3}, {0xE6,0x95,0xAD,3}, {0xE6,0x95,0xAE,3}, {0xE6,0x95,0xAF,3},
+        {0xE6,0x95,0xB1,3}, {0xE6,0x95,0xB3,3}, {0xE6,0x95,0xB5,3}, {0xE6,0x95,0xB6,3}, {0xE6,0x95,0xB8,3}, {0xE6,0x95,0xB9,3}, {0xE6,0x95,0xBA,3}, {0xE6,0x95,0xBB,3},
+        {0xE6,0x95,0xBC,3}, {0xE6,0x95,0xBD,3}, {0xE6,0x95,0xBE,3}, {0xE6,0x95,0xBF,3}, {0xE6,0x96,0x80,3}, {0xE6,0x96,0x81,3}, {0xE6,0x96,0x82,3}, {0xE6,0x96,0x83,3},
+        {0xE6,0x96,0x84,3}, {0xE6,0x96,0x85,3}, {0xE6,0x96,0x86,3}, {0xE6,0x96,0x88,3}, {0xE6,0x96,0x89,3}, {0xE6,0x96,0x8A,3}, {0xE6,0x96,0x8D,3}, {0xE6,0x96,0x8E,3},
+        {0xE6,0x96,0x8F,3}, {0xE6,0x96,0x92,3}, {0xE6,0x96,0x94,3}, {0xE6,0x96,0x95,3}, {0xE6,0x96,0x96,3}, {0xE6,0x96,0x98,3}, {0xE6,0x96,0x9A,3}, {0xE6,0x96,0x9D,3},
+        {0xE6,0x96,0x9E,3}, {0xE6,0x96,0xA0,3}, {0xE6,0x96,0xA2,3}, {0xE6,0x96,0xA3,3}, {0xE6,0x96,0xA6,3}, {0xE6,0x96,0xA8,3}, {0xE6,0x96,0xAA,3}, {0xE6,0x96,0xAC,3},
+        {0xE6,0x96,0xAE,3}, {0xE6,0x96,0xB1,3}, {0xE6,0x96,0xB2,3}, {0xE6,0x96,0xB3,3}, {0xE6,0x96,0xB4,3}, {0xE6,0x96,0xB5,3}, {0xE6,0x96,0xB6,3}, {0xE6,0x96,0xB7,3},
+        {0xE6,0x96,0xB8,3}, {0xE6,0x96,0xBA,3}, {0xE6,0x96,0xBB,3}, {0xE6,0x96,0xBE,3}, {0xE6,0x96,0xBF,3}, {0xE6,0x97,0x80,3}, {0xE6,0x97,0x82,3}, {0xE6,0x97,0x87,3},
+        {0xE6,0x97,0x88,3}, {0xE6,0x97,0x89,3}, {0xE6,0x97,0x8A,3}, {0xE6,0x97,0x8D,3}, {0xE6,0x97,0x90,3}, {0xE6,0x97,0x91,3}, {0xE6,0x97,0x93,3}, {0xE6,0x97,0x94,3},
+        {0xE6,0x97,0x95,3}, {0xE6,0x97,0x98,3}, {0xE6,0x97,0x99,3}, {0xE6,0x97,0x9A,3}, {0xE6,0x97,0x9B,3}, {0xE6,0x97,0x9C,3}, {0xE6,0x97,0x9D,3}, {0xE6,0x97,0x9E,3},
+        {0xE6,0x97,0x9F,3}, {0xE6,0x97,0xA1,3}, {0xE6,0x97,0xA3,3}, {0xE6,0x97,0xA4,3}, {0xE6,0x97,0xAA,3}, {0xE6,0x97,0xAB,3},
+    },
+    /* 0x95 */ {
+        {0xE6,0x97,0xB2,3}, {0xE6,0x97,0xB3,3}, {0xE6,0x97,0xB4,3}, {0xE6,0x97,0xB5,3}, {0xE6,0x97,0xB8,3}, {0xE6,0x97,0xB9,3}, {0xE6,0x97,0xBB,3}, {0xE6,0x97,0xBC,3},
+        {0xE6,0x97,0xBD,3}, {0xE6,0x97,0xBE,3}, {0xE6,0x97,0xBF,3}, {0xE6,0x98,0x81,3}, {0xE6,0x98,0x84,3}, {0xE6,0x98,0x85,3}, {0xE6,0x98,0x87,3}, {0xE6,0x98,0x88,3},
+        {0xE6,0x98,0x89,3}, {0xE6,0x98,0x8B,3}, {0xE6,0x98,0x8D,3}, {0xE6,0x98,0x90,3}, {0xE6,0x98,0x91,3}, {0xE6,0x98,0x92,3}, {0xE6,0x98,0x96,3}, {0xE6,0x98,0x97,3},
+        {0xE6,0x98,0x98,3}, {0xE6,0x98,0x9A,3}, {0xE6,0x98,0x9B,3}, {0xE6,0x98,0x9C,3}, {0xE6,0x98,0x9E,3}, {0xE6,0x98,0xA1,3}, {0xE6,0x98,0xA2,3}, {0xE6,0x98,0xA3,3},
+        {0xE6,0x98,0xA4,3}, {0xE6,0x98,0xA6,3}, {0xE6,0x98,0xA9,3}, {0xE6,0x98,0xAA,3}, {0xE6,0x98,0xAB,3}, {0xE6,0x98,0xAC,3}, {0xE6,0x98,0xAE,3}, {0xE6,0x98,0xB0,3},
+        {0xE6,0x98,0xB2,3}, {0xE6,0x98,0xB3,3}, {0xE6,0x98,0xB7,3}, {0xE6,0x98,0xB8,3}, {0xE6,0x98,0xB9,3}, {0xE6,0x98,0xBA,3}, {0xE6,0x98,0xBB,3}, {0xE6,0x98,0xBD,3},
+        {0xE6,0x98,0xBF,3}, {0xE6,0x99,0x80,3}, {0xE6,0x99,0x82,3}, {0xE6,0x99,0x84,3}, {0xE6,0x99,0x85,3}, {0xE6,0x99,0x86,3}, {0xE6,0x99,0x87,3}, {0xE6,0x99,0x88,3},
+        {0xE6,0x99,0x89,3}, {0xE6,0x99,0x8A,3}, {0xE6,0x99,0x8D,3}, {0xE6,0x99,0x8E,3}, {0xE6,0x99,0x90,3}, {0xE6,0x99,0x91,3}, {0xE6,0x99,0x98,3}, {0xE6,0x99,0x99,3},
+        {0xE6,0x99,0x9B,3}, {0xE6,0x99,0x9C,3}, {0xE6,0x99,0x9D,3}, {0xE6,0x99,0x9E,3}, {0xE6,0x99,0xA0,3}, {0xE6,0x99,0xA2,3}, {0xE6,0x99,0xA3,3}, {0xE6,0x99,0xA5,3},
+        {0xE6,0x99,0xA7,3}, {0xE6,0x99,0xA9,3}, {0xE6,0x99,0xAA,3}, {0xE6,0x99,0xAB,3}, {0xE6,0x99,0xAC,3}, {0xE6,0x99,0xAD,3}, {0xE6,0x99,0xB1,3}, {0xE6,0x99,0xB2,3},
+        {0xE6,0x99,0xB3,3}, {0xE6,0x99,0xB5,3}, {0xE6,0x99,0xB8,3}, {0xE6,0x99,0xB9,3}, {0xE6,0x99,0xBB,3}, {0xE6,0x99,0xBC,3}, {0xE6,0x99,0xBD,3}, {0xE6,0x99,0xBF,3},
+        {0xE6,0x9A,0x80,3}, {0xE6,0x9A,0x81,3}, {0xE6,0x9A,0x83,3}, {0xE6,0x9A,0x85,3}, {0xE6,0x9A,0x86,3}, {0xE6,0x9A,0x88,3}, {0xE6,0x9A,0x89,3}, {0xE6,0x9A,0x8A,3},
+        {0xE6,0x9A,0x8B,3}, {0xE6,0x9A,0x8D,3}, {0xE6,0x9A,0x8E,3}, {0xE6,0x9A,0x8F,3}, {0xE6,0x9A,0x90,3}, {0xE6,0x9A,0x92,3}, {0xE6,0x9A,0x93,3}, {0xE6,0x9A,0x94,3},
+        {0xE6,0x9A,0x95,3}, {0xE6,0x9A,0x98,3}, {0xE6,0x9A,0x99,3}, {0xE6,0x9A,0x9A,3}, {0xE6,0x9A,0x9B,3}, {0xE6,0x9A,0x9C,3}, {0xE6,0x9A,0x9E,3}, {0xE6,0x9A,0x9F,3},
+        {0xE6,0x9A,0xA0,3}, {0xE6,0x9A,0xA1,3}, {0xE6,0x9A,0xA2,3}, {0xE6,0x9A,0xA3,3}, {0xE6,0x9A,0xA4,3}, {0xE6,0x9A,0xA5,3}, {0xE6,0x9A,0xA6,3}, {0xE6,0x9A,0xA9,3},
+        {0xE6,0x9A,0xAA,3}, {0xE6,0x9A,0xAB,3}, {0xE6,0x9A,0xAC,3}, {0xE6,0x9A,0xAD,3}, {0xE6,0x9A,0xAF,3}, {0xE6,0x9A,0xB0,3}, {0xE6,0x9A,0xB1,3}, {0xE6,0x9A,0xB2,3},
+        {0xE6,0x9A,0xB3,3}, {0xE6,0x9A,0xB5,3}, {0xE6,0x9A,0xB6,3}, {0xE6,0x9A,0xB7,3}, {0xE6,0x9A,0xB8,3}, {0xE6,0x9A,0xBA,3}, {0xE6,0x9A,0xBB,3}, {0xE6,0x9A,0xBC,3},
+        {0xE6,0x9A,0xBD,3}, {0xE6,0x9A,0xBF,3}, {0xE6,0x9B,0x80,3}, {0xE6,0x9B,0x81,3}, {0xE6,0x9B,0x82,3}, {0xE6,0x9B,0x83,3}, {0xE6,0x9B,0x84,3}, {0xE6,0x9B,0x85,3},
+        {0xE6,0x9B,0x86,3}, {0xE6,0x9B,0x87,3}, {0xE6,0x9B,0x88,3}, {0xE6,0x9B,0x89,3}, {0xE6,0x9B,0x8A,3}, {0xE6,0x9B,0x8B,3}, {0xE6,0x9B,0x8C,3}, {0xE6,0x9B,0x8D,3},
+        {0xE6,0x9B,0x8E,3}, {0xE6,0x9B,0x8F,3}, {0xE6,0x9B,0x90,3}, {0xE6,0x9B,0x91,3}, {0xE6,0x9B,0x92,3}, {0xE6,0x9B,0x93,3}, {0xE6,0x9B,0x94,3}, {0xE6,0x9B,0x95,3},
+        {0xE6,0x9B,0x96,3}, {0xE6,0x9B,0x97,3}, {0xE6,0x9B,0x98,3}, {0xE6,0x9B,0x9A,3}, {0xE6,0x9B,0x9E,3}, {0xE6,0x9B,0x9F,3}, {0xE6,0x9B,0xA0,3}, {0xE6,0x9B,0xA1,3},
+        {0xE6,0x9B,0xA2,3}, {0xE6,0x9B,0xA3,3}, {0xE6,0x9B,0xA4,3}, {0xE6,0x9B,0xA5,3}, {0xE6,0x9B,0xA7,3}, {0xE6,0x9B,0xA8,3}, {0xE6,0x9B,0xAA,3}, {0xE6,0x9B,0xAB,3},
+        {0xE6,0x9B,0xAC,3}, {0xE6,0x9B,0xAD,3}, {0xE6,0x9B,0xAE,3}, {0xE6,0x9B,0xAF,3}, {0xE6,0x9B,0xB1,3}, {0xE6,0x9B,0xB5,3}, {0xE6,0x9B,0xB6,3}, {0xE6,0x9B,0xB8,3},
+        {0xE6,0x9B,0xBA,3}, {0xE6,0x9B,0xBB,3}, {0xE6,0x9B,0xBD,3}, {0xE6,0x9C,0x81,3}, {0xE6,0x9C,0x82,3}, {0xE6,0x9C,0x83,3},
+    },
+    /* 0x96 */ {
+        {0xE6,0x9C,0x84,3}, {0xE6,0x9C,0x85,3}, {0xE6,0x9C,0x86,3}, {0xE6,0x9C,0x87,3}, {0xE6,0x9C,0x8C,3}, {0xE6,0x9C,0x8E,3}, {0xE6,0x9C,0x8F,3}, {0xE6,0x9C,0x91,3},
+        {0xE6,0x9C,0x92,3}, {0xE6,0x9C,0x93,3}, {0xE6,0x9C,0x96,3}, {0xE6,0x9C,0x98,3}, {0xE6,0x9C,0x99,3}, {0xE6,0x9C,0x9A,3}, {0xE6,0x9C,0x9C,3}, {0xE6,0x9C,0x9E,3},
+        {0xE6,0x9C,0xA0,3}, {0xE6,0x9C,0xA1,3}, {0xE6,0x9C,0xA2,3}, {0xE6,0x9C,0xA3,3}, {0xE6,0x9C,0xA4,3}, {0xE6,0x9C,0xA5,3}, {0xE6,0x9C,0xA7,3}, {0xE6,0x9C,0xA9,3},
+        {0xE6,0x9C,0xAE,3}, {0xE6,0x9C,0xB0,3}, {0xE6,0x9C,0xB2,3}, {0xE6,0x9C,0xB3,3}, {0xE6,0x9C,0xB6,3}, {0xE6,0x9C,0xB7,3}, {0xE6,0x9C,0xB8,3}, {0xE6,0x9C,0xB9,3},
+        {0xE6,0x9C,0xBB,3}, {0xE6,0x9C,0xBC,3}, {0xE6,0x9C,0xBE,3}, {0xE6,0x9C,0xBF,3}, {0xE6,0x9D,0x81,3}, {0xE6,0x9D,0x84,3}, {0xE6,0x9D,0x85,3}, {0xE6,0x9D,0x87,3},
+        {0xE6,0x9D,0x8A,3}, {0xE6,0x9D,0x8B,3}, {0xE6,0x9D,0x8D,3}, {0xE6,0x9D,0x92,3}, {0xE6,0x9D,0x94,3}, {0xE6,0x9D,0x95,3}, {0xE6,0x9D,0x97,3}, {0xE6,0x9D,0x98,3},
+        {0xE6,0x9D,0x99,3}, {0xE6,0x9D,0x9A,3}, {0xE6,0x9D,0x9B,3}, {0xE6,0x9D,0x9D,3}, {0xE6,0x9D,0xA2,3}, {0xE6,0x9D,0xA3,3}, {0xE6,0x9D,0xA4,3}, {0xE6,0x9D,0xA6,3},
+        {0xE6,0x9D,0xA7,3}, {0xE6,0x9D,0xAB,3}, {0xE6,0x9D,0xAC,3}, {0xE6,0x9D,0xAE,3}, {0xE6,0x9D,0xB1,3}, {0xE6,0x9D,0xB4,3}, {0xE6,0x9D,0xB6,3}, {0xE6,0x9D,0xB8,3},
+        {0xE6,0x9D,0xB9,3}, {0xE6,0x9D,0xBA,3}, {0xE6,0x9D,0xBB,3}, {0xE6,0x9D,0xBD,3}, {0xE6,0x9E,0x80,3}, {0xE6,0x9E,0x82,3}, {0xE6,0x9E,0x83,3}, {0xE6,0x9E,0x85,3},
+        {0xE6,0x9E,0x86,3}, {0xE6,0x9E,0x88,3}, {0xE6,0x9E,0x8A,3}, {0xE6,0x9E,0x8C,3}, {0xE6,0x9E,0x8D,3}, {0xE6,0x9E,0x8E,3}, {0xE6,0x9E,0x8F,3}, {0xE6,0x9E,0x91,3},
+        {0xE6,0x9E,0x92,3}, {0xE6,0x9E,0x93,3}, {0xE6,0x9E,0x94,3}, {0xE6,0x9E,0x96,3}, {0xE6,0x9E,0x99,3}, {0xE6,0x9E,0x9B,3}, {0xE6,0x9E,0x9F,3}, {0xE6,0x9E,0xA0,3},
+        {0xE6,0x9E,0xA1,3}, {0xE6,0x9E,0xA4,3}, {0xE6,0x9E,0xA6,3}, {0xE6,0x9E,0xA9,3}, {0xE6,0x9E,0xAC,3}, {0xE6,0x9E,0xAE,3}, {0xE6,0x9E,0xB1,3}, {0xE6,0x9E,0xB2,3},
+        {0xE6,0x9E,0xB4,3}, {0xE6,0x9E,0xB9,3}, {0xE6,0x9E,0xBA,3}, {0xE6,0x9E,0xBB,3}, {0xE6,0x9E,0xBC,3}, {0xE6,0x9E,0xBD,3}, {0xE6,0x9E,0xBE,3}, {0xE6,0x9E,0xBF,3},
+        {0xE6,0x9F,0x80,3}, {0xE6,0x9F,0x82,3}, {0xE6,0x9F,0x85,3}, {0xE6,0x9F,0x86,3}, {0xE6,0x9F,0x87,3}, {0xE6,0x9F,0x88,3}, {0xE6,0x9F,0x89,3}, {0xE6,0x9F,0x8A,3},
+        {0xE6,0x9F,0x8B,3}, {0xE6,0x9F,0x8C,3}, {0xE6,0x9F,0x8D,3}, {0xE6,0x9F,0x8E,3}, {0xE6,0x9F,0x95,3}, {0xE6,0x9F,0x96,3}, {0xE6,0x9F,0x97,3}, {0xE6,0x9F,0x9B,3},
+        {0xE6,0x9F,0x9F,3}, {0xE6,0x9F,0xA1,3}, {0xE6,0x9F,0xA3,3}, {0xE6,0x9F,0xA4,3}, {0xE6,0x9F,0xA6,3}, {0xE6,0x9F,0xA7,3}, {0xE6,0x9F,0xA8,3}, {0xE6,0x9F,0xAA,3},
+        {0xE6,0x9F,0xAB,3}, {0xE6,0x9F,0xAD,3}, {0xE6,0x9F,0xAE,3}, {0xE6,0x9F,0xB2,3}, {0xE6,0x9F,0xB5,3}, {0xE6,0x9F,0xB6,3}, {0xE6,0x9F,0xB7,3}, {0xE6,0x9F,0xB8,3},
+        {0xE6,0x9F,0xB9,3}, {0xE6,0x9F,0xBA,3}, {0xE6,0x9F,0xBB,3}, {0xE6,0x9F,0xBC,3}, {0xE6,0x9F,0xBE,3}, {0xE6,0xA0,0x81,3}, {0xE6,0xA0,0x82,3}, {0xE6,0xA0,0x83,3},
+        {0xE6,0xA0,0x84,3}, {0xE6,0xA0,0x86,3}, {0xE6,0xA0,0x8D,3}, {0xE6,0xA0,0x90,3}, {0xE6,0xA0,0x92,3}, {0xE6,0xA0,0x94,3}, {0xE6,0xA0,0x95,3}, {0xE6,0xA0,0x98,3},
+        {0xE6,0xA0,0x99,3}, {0xE6,0xA0,0x9A,3}, {0xE6,0xA0,0x9B,3}, {0xE6,0xA0,0x9C,3}, {0xE6,0xA0,0x9E,3}, {0xE6,0xA0,0x9F,3}, {0xE6,0xA0,0xA0,3}, {0xE6,0xA0,0xA2,3},
+        {0xE6,0xA0,0xA3,3}, {0xE6,0xA0,0xA4,3}, {0xE6,0xA0,0xA5,3}, {0xE6,0xA0,0xA6,3}, {0xE6,0xA0,0xA7,3}, {0xE6,0xA0,0xA8,3}, {0xE6,0xA0,0xAB,3}, {0xE6,0xA0,0xAC,3},
+        {0xE6,0xA0,0xAD,3}, {0xE6,0xA0,0xAE,3}, {0xE6,0xA0,0xAF,3}, {0xE6,0xA0,0xB0,3}, {0xE6,0xA0,0xB1,3}, {0xE6,0xA0,0xB4,3}, {0xE6,0xA0,0xB5,3}, {0xE6,0xA0,0xB6,3},
+        {0xE6,0xA0,0xBA,3}, {0xE6,0xA0,0xBB,3}, {0xE6,0xA0,0xBF,3}, {0xE6,0xA1,0x87,3}, {0xE6,0xA1,0x8B,3}, {0xE6,0xA1,0x8D,3}, {0xE6,0xA1,0x8F,3}, {0xE6,0xA1,0x92,3},
+        {0xE6,0xA1,0x96,3}, {0xE6,0xA1,0x97,3}, {0xE6,0xA1,0x98,3}, {0xE6,0xA1,0x99,3}, {0xE6,0xA1,0x9A,3}, {0xE6,0xA1,0x9B,3},
+    },
+    /* 0x97 */ {
+        {0xE6,0xA1,0x9C,3}, {0xE6,0xA1,0x9D,3}, {0xE6,0xA1,0x9E,3}, {0xE6,0xA1,0x9F,3}, {0xE6,0xA1,0xAA,3}, {0xE6,0xA1,0xAC,3}, {0xE6,0xA1,0xAD,3}, {0xE6,0xA1,0xAE,3},
+        {0xE6,0xA1,0xAF,3}, {0xE6,0xA1,0xB0,3}, {0xE6,0xA1,0xB1,3}, {0xE6,0xA1,0xB2,3}, {0xE6,0xA1,0xB3,3}, {0xE6,0xA1,0xB5,3}, {0xE6,0xA1,0xB8,3}, {0xE6,0xA1,0xB9,3},
+        {0xE6,0xA1,0xBA,3}, {0xE6,0xA1,0xBB,3}, {0xE6,0xA1,0xBC,3}, {0xE6,0xA1,0xBD,3}, {0xE6,0xA1,0xBE,3}, {0xE6,0xA1,0xBF,3}, {0xE6,0xA2,0x80,3}, {0xE6,0xA2,0x82,3},
+        {0xE6,0xA2,0x84,3}, {0xE6,0xA2,0x87,3}, {0xE6,0xA2,0x88,3}, {0xE6,0xA2,0x89,3}, {0xE6,0xA2,0x8A,3}, {0xE6,0xA2,0x8B,3}, {0xE6,0xA2,0x8C,3}, {0xE6,0xA2,0x8D,3},
+        {0xE6,0xA2,0x8E,3}, {0xE6,0xA2,0x90,3}, {0xE6,0xA2,0x91,3}, {0xE6,0xA2,0x92,3}, {0xE6,0xA2,0x94,3}, {0xE6,0xA2,0x95,3}, {0xE6,0xA2,0x96,3}, {0xE6,0xA2,0x98,3},
+        {0xE6,0xA2,0x99,3}, {0xE6,0xA2,0x9A,3}, {0xE6,0xA2,0x9B,3}, {0xE6,0xA2,0x9C,3}, {0xE6,0xA2,0x9D,3}, {0xE6,0xA2,0x9E,3}, {0xE6,0xA2,0x9F,3}, {0xE6,0xA2,0xA0,3},
+        {0xE6,0xA2,0xA1,3}, {0xE6,0xA2,0xA3,3}, {0xE6,0xA2,0xA4,3}, {0xE6,0xA2,0xA5,3}, {0xE6,0xA2,0xA9,3}, {0xE6,0xA2,0xAA,3}, {0xE6,0xA2,0xAB,3}, {0xE6,0xA2,0xAC,3},
+        {0xE6,0xA2,0xAE,3}, {0xE6,0xA2,0xB1,3}, {0xE6,0xA2,0xB2,3}, {0xE6,0xA2,0xB4,3}, {0xE6,0xA2,0xB6,3}, {0xE6,0xA2,0xB7,3}, {0xE6,0xA2,0xB8,3}, {0xE6,0xA2,0xB9,3},
+        {0xE6,0xA2,0xBA,3}, {0xE6,0xA2,0xBB,3}, {0xE6,0xA2,0xBC,3}, {0xE6,0xA2,0xBD,3}, {0xE6,0xA2,0xBE,3}, {0xE6,0xA2,0xBF,3}, {0xE6,0xA3,0x81,3}, {0xE6,0xA3,0x83,3},
+        {0xE6,0xA3,0x84,3}, {0xE6,0xA3,0x85,3}, {0xE6,0xA3,0x86,3}, {0xE6,0xA3,0x87,3}, {0xE6,0xA3,0x88,3}, {0xE6,0xA3,0x8A,3}, {0xE6,0xA3,0x8C,3}, {0xE6,0xA3,0x8E,3},
+        {0xE6,0xA3,0x8F,3}, {0xE6,0xA3,0x90,3}, {0xE6,0xA3,0x91,3}, {0xE6,0xA3,0x93,3}, {0xE6,0xA3,0x94,3}, {0xE6,0xA3,0x96,3}, {0xE6,0xA3,0x97,3}, {0xE6,0xA3,0x99,3},
+        {0xE6,0xA3,0x9B,3}, {0xE6,0xA3,0x9C,3}, {0xE6,0xA3,0x9D,3}, {0xE6,0xA3,0x9E,3}, {0xE6,0xA3,0x9F,3}, {0xE6,0xA3,0xA1,3}, {0xE6,0xA3,0xA2,3}, {0xE6,0xA3,0xA4,3},
+        {0xE6,0xA3,0xA5,3}, {0xE6,0xA3,0xA6,3}, {0xE6,0xA3,0xA7,3}, {0xE6,0xA3,0xA8,3}, {0xE6,0xA3,0xA9,3}, {0xE6,0xA3,0xAA,3}, {0xE6,0xA3,0xAB,3}, {0xE6,0xA3,0xAC,3},
+        {0xE6,0xA3,0xAD,3}, {0xE6,0xA3,0xAF,3}, {0xE6,0xA3,0xB2,3}, {0xE6,0xA3,0xB3,3}, {0xE6,0xA3,0xB4,3}, {0xE6,0xA3,0xB6,3}, {0xE6,0xA3,0xB7,3}, {0xE6,0xA3,0xB8,3},
+        {0xE6,0xA3,0xBB,3}, {0xE6,0xA3,0xBD,3}, {0xE6,0xA3,0xBE,3}, {0xE6,0xA3,0xBF,3}, {0xE6,0xA4,0x80,3}, {0xE6,0xA4,0x82,3}, {0xE6,0xA4,0x83,3}, {0xE6,0xA4,0x84,3},
+        {0xE6,0xA4,0x86,3}, {0xE6,0xA4,0x87,3}, {0xE6,0xA4,0x88,3}, {0xE6,0xA4,0x89,3}, {0xE6,0xA4,0x8A,3}, {0xE6,0xA4,0x8C,3}, {0xE6,0xA4,0x8F,3}, {0xE6,0xA4,0x91,3},
+        {0xE6,0xA4,0x93,3}, {0xE6,0xA4,0x94,3}, {0xE6,0xA4,0x95,3}, {0xE6,0xA4,0x96,3}, {0xE6,0xA4,0x97,3}, {0xE6,0xA4,0x98,3}, {0xE6,0xA4,0x99,3}, {0xE6,0xA4,0x9A,3},
+        {0xE6,0xA4,0x9B,3}, {0xE6,0xA4,0x9C,3}, {0xE6,0xA4,0x9D,3}, {0xE6,0xA4,0x9E,3}, {0xE6,0xA4,0xA1,3}, {0xE6,0xA4,0xA2,3}, {0xE6,0xA4,0xA3,3}, {0xE6,0xA4,0xA5,3},
+        {0xE6,0xA4,0xA6,3}, {0xE6,0xA4,0xA7,3}, {0xE6,0xA4,0xA8,3}, {0xE6,0xA4,0xA9,3}, {0xE6,0xA4,0xAA,3}, {0xE6,0xA4,0xAB,3}, {0xE6,0xA4,0xAC,3}, {0xE6,0xA4,0xAE,3},
+        {0xE6,0xA4,0xAF,3}, {0xE6,0xA4,0xB1,3}, {0xE6,0xA4,0xB2,3}, {0xE6,0xA4,0xB3,3}, {0xE6,0xA4,0xB5,3}, {0xE6,0xA4,0xB6,3}, {0xE6,0xA4,0xB7,3}, {0xE6,0xA4,0xB8,3},
+        {0xE6,0xA4,0xBA,3}, {0xE6,0xA4,0xBB,3}, {0xE6,0xA4,0xBC,3}, {0xE6,0xA4,0xBE,3}, {0xE6,0xA5,0x80,3}, {0xE6,0xA5,0x81,3}, {0xE6,0xA5,0x83,3}, {0xE6,0xA5,0x84,3},
+        {0xE6,0xA5,0x85,3}, {0xE6,0xA5,0x86,3}, {0xE6,0xA5,0x87,3}, {0xE6,0xA5,0x88,3}, {0xE6,0xA5,0x89,3}, {0xE6,0xA5,0x8A,3}, {0xE6,0xA5,0x8B,3}, {0xE6,0xA5,0x8C,3},
+        {0xE6,0xA5,0x8D,3}, {0xE6,0xA5,0x8E,3}, {0xE6,0xA5,0x8F,3}, {0xE6,0xA5,0x90,3}, {0xE6,0xA5,0x91,3}, {0xE6,0xA5,0x92,3}, {0xE6,0xA5,0x93,3}, {0xE6,0xA5,0x95,3},
+        {0xE6,0xA5,0x96,3}, {0xE6,0xA5,0x98,3}, {0xE6,0xA5,0x99,3}, {0xE6,0xA5,0x9B,3}, {0xE6,0xA5,0x9C,3}, {0xE6,0xA5,0x9F,3},
+    },
+    /* 0x98 */ {
+        {0xE6,0xA5,0xA1,3}, {0xE6,0xA5,0xA2,3}, {0xE6,0xA5,0xA4,3}, {0xE6,0xA5,0xA5,3}, {0xE6,0xA5,0xA7,3}, {0xE6,0xA5,0xA8,3}, {0xE6,0xA5,0xA9,3}, {0xE6,0xA5,0xAA,3},
+        {0xE6,0xA5,0xAC,3}, {0xE6,0xA5,0xAD,3}, {0xE6,0xA5,0xAF,3}, {0xE6,0xA5,0xB0,3}, {0xE6,0xA5,0xB2,3}, {0xE6,0xA5,0xB3,3}, {0xE6,0xA5,0xB4,3}, {0xE6,0xA5,0xB5,3},
+        {0xE6,0xA5,0xB6,3}, {0xE6,0xA5,0xBA,3}, {0xE6,0xA5,0xBB,3}, {0xE6,0xA5,0xBD,3}, {0xE6,0xA5,0xBE,3}, {0xE6,0xA5,0xBF,3}, {0xE6,0xA6,0x81,3}, {0xE6,0xA6,0x83,3},
+        {0xE6,0xA6,0x85,3}, {0xE6,0xA6,0x8A,3}, {0xE6,0xA6,0x8B,3}, {0xE6,0xA6,0x8C,3}, {0xE6,0xA6,0x8E,3}, {0xE6,0xA6,0x8F,3}, {0xE6,0xA6,0x90,3}, {0xE6,0xA6,0x91,3},
+        {0xE6,0xA6,0x92,3}, {0xE6,0xA6,0x93,3}, {0xE6,0xA6,0x96,3}, {0xE6,0xA6,0x97,3}, {0xE6,0xA6,0x99,3}, {0xE6,0xA6,0x9A,3}, {0xE6,0xA6,0x9D,3}, {0xE6,0xA6,0x9E,3},
+        {0xE6,0xA6,0x9F,3}, {0xE6,0xA6,0xA0,3}, {0xE6,0xA6,0xA1,3}, {0xE6,0xA6,0xA2,3}, {0xE6,0xA6,0xA3,3}, {0xE6,0xA6,0xA4,3}, {0xE6,0xA6,0xA5,3}, {0xE6,0xA6,0xA6,3},
+        {0xE6,0xA6,0xA9,3}, {0xE6,0xA6,0xAA,3}, {0xE6,0xA6,0xAC,3}, {0xE6,0xA6,0xAE,3}, {0xE6,0xA6,0xAF,3}, {0xE6,0xA6,0xB0,3}, {0xE6,0xA6,0xB2,3}, {0xE6,0xA6,0xB3,3},
+        {0xE6,0xA6,0xB5,3}, {0xE6,0xA6,0xB6,3}, {0xE6,0xA6,0xB8,3}, {0xE6,0xA6,0xB9,3}, {0xE6,0xA6,0xBA,3}, {0xE6,0xA6,0xBC,3}, {0xE6,0xA6,0xBD,3}, {0xE6,0xA6,0xBE,3},
+        {0xE6,0xA6,0xBF,3}, {0xE6,0xA7,0x80,3}, {0xE6,0xA7,0x82,3}, {0xE6,0xA7,0x83,3}, {0xE6,0xA7,0x84,3}, {0xE6,0xA7,0x85,3}, {0xE6,0xA7,0x86,3}, {0xE6,0xA7,0x87,3},
+        {0xE6,0xA7,0x88,3}, {0xE6,0xA7,0x89,3}, {0xE6,0xA7,0x8B,3}, {0xE6,0xA7,0x8D,3}, {0xE6,0xA7,0x8F,3}, {0xE6,0xA7,0x91,3}, {0xE6,0xA7,0x92,3}, {0xE6,0xA7,0x93,3},
+        {0xE6,0xA7,0x95,3}, {0xE6,0xA7,0x96,3}, {0xE6,0xA7,0x97,3}, {0xE6,0xA7,0x98,3}, {0xE6,0xA7,0x99,3}, {0xE6,0xA7,0x9A,3}, {0xE6,0xA7,0x9C,3}, {0xE6,0xA7,0x9D,3},
+        {0xE6,0xA7,0x9E,3}, {0xE6,0xA7,0xA1,3}, {0xE6,0xA7,0xA2,3}, {0xE6,0xA7,0xA3,3}, {0xE6,0xA7,0xA4,3}, {0xE6,0xA7,0xA5,3}, {0xE6,0xA7,0xA6,3}, {0xE6,0xA7,0xA7,3},
+        {0xE6,0xA7,0xA8,3}, {0xE6,0xA7,0xA9,3}, {0xE6,0xA7,0xAA,3}, {0xE6,0xA7,0xAB,3}, {0xE6,0xA7,0xAC,3}, {0xE6,0xA7,0xAE,3}, {0xE6,0xA7,0xAF,3}, {0xE6,0xA7,0xB0,3},
+        {0xE6,0xA7,0xB1,3}, {0xE6,0xA7,0xB3,3}, {0xE6,0xA7,0xB4,3}, {0xE6,0xA7,0xB5,3}, {0xE6,0xA7,0xB6,3}, {0xE6,0xA7,0xB7,3}, {0xE6,0xA7,0xB8,3}, {0xE6,0xA7,0xB9,3},
+        {0xE6,0xA7,0xBA,3}, {0xE6,0xA7,0xBB,3}, {0xE6,0xA7,0xBC,3}, {0xE6,0xA7,0xBE,3}, {0xE6,0xA8,0x80,3}, {0xE6,0xA8,0x81,3}, {0xE6,0xA8,0x82,3}, {0xE6,0xA8,0x83,3},
+        {0xE6,0xA8,0x84,3}, {0xE6,0xA8,0x85,3}, {0xE6,0xA8,0x86,3}, {0xE6,0xA8,0x87,3}, {0xE6,0xA8,0x88,3}, {0xE6,0xA8,0x89,3}, {0xE6,0xA8,0x8B,3}, {0xE6,0xA8,0x8C,3},
+        {0xE6,0xA8,0x8D,3}, {0xE6,0xA8,0x8E,3}, {0xE6,0xA8,0x8F,3}, {0xE6,0xA8,0x90,3}, {0xE6,0xA8,0x91,3}, {0xE6,0xA8,0x92,3}, {0xE6,0xA8,0x93,3}, {0xE6,0xA8,0x94,3},
+        {0xE6,0xA8,0x95,3}, {0xE6,0xA8,0x96,3}, {0xE6,0xA8,0x99,3}, {0xE6,0xA8,0x9A,3}, {0xE6,0xA8,0x9B,3}, {0xE6,0xA8,0x9C,3}, {0xE6,0xA8,0x9D,3}, {0xE6,0xA8,0x9E,3},
+        {0xE6,0xA8,0xA0,3}, {0xE6,0xA8,0xA2,3}, {0xE6,0xA8,0xA3,3}, {0xE6,0xA8,0xA4,3}, {0xE6,0xA8,0xA5,3}, {0xE6,0xA8,0xA6,3}, {0xE6,0xA8,0xA7,3}, {0xE6,0xA8,0xA9,3},
+        {0xE6,0xA8,0xAB,3}, {0xE6,0xA8,0xAC,3}, {0xE6,0xA8,0xAD,3}, {0xE6,0xA8,0xAE,3}, {0xE6,0xA8,0xB0,3}, {0xE6,0xA8,0xB2,3}, {0xE6,0xA8,0xB3,3}, {0xE6,0xA8,0xB4,3},
+        {0xE6,0xA8,0xB6,3}, {0xE6,0xA8,0xB7,3}, {0xE6,0xA8,0xB8,3}, {0xE6,0xA8,0xB9,3}, {0xE6,0xA8,0xBA,3}, {0xE6,0xA8,0xBB,3}, {0xE6,0xA8,0xBC,3}, {0xE6,0xA8,0xBF,3},
+        {0xE6,0xA9,0x80,3}, {0xE6,0xA9,0x81,3}, {0xE6,0xA9,0x82,3}, {0xE6,0xA9,0x83,3}, {0xE6,0xA9,0x85,3}, {0xE6,0xA9,0x86,3}, {0xE6,0xA9,0x88,3}, {0xE6,0xA9,0x89,3},
+        {0xE6,0xA9,0x8A,3}, {0xE6,0xA9,0x8B,3}, {0xE6,0xA9,0x8C,3}, {0xE6,0xA9,0x8D,3}, {0xE6,0xA9,0x8E,3}, {0xE6,0xA9,0x8F,3}, {0xE6,0xA9,0x91,3}, {0xE6,0xA9,0x92,3},
+        {0xE6,0xA9,0x93,3}, {0xE6,0xA9,0x94,3}, {0xE6,0xA9,0x95,3}, {0xE6,0xA9,0x96,3}, {0xE6,0xA9,0x97,3}, {0xE6,0xA9,0x9A,3},
+    },
+    /* 0x99 */ {
+        {0xE6,0xA9,0x9C,3}, {0xE6,0xA9,0x9D,3}, {0xE6,0xA9,0x9E,3}, {0xE6,0xA9,0x9F,3}, {0xE6,0xA9,0xA0,3}, {0xE6,0xA9,0xA2,3}, {0xE6,0xA9,0xA3,3}, {0xE6,0xA9,0xA4,3},
+        {0xE6,0xA9,0xA6,3}, {0xE6,0xA9,0xA7,3}, {0xE6,0xA9,0xA8,3}, {0xE6,0xA9,0xA9,3}, {0xE6,0xA9,0xAA,3}, {0xE6,0xA9,0xAB,3}, {0xE6,0xA9,0xAC,3}, {0xE6,0xA9,0xAD,3},
+        {0xE6,0xA9,0xAE,3}, {0xE6,0xA9,0xAF,3}, {0xE6,0xA9,0xB0,3}, {0xE6,0xA9,0xB2,3}, {0xE6,0xA9,0xB3,3}, {0xE6,0xA9,0xB4,3}, {0xE6,0xA9,0xB5,3}, {0xE6,0xA9,0xB6,3},
+        {0xE6,0xA9,0xB7,3}, {0xE6,0xA9,0xB8,3}, {0xE6,0xA9,0xBA,3}, {0xE6,0xA9,0xBB,3}, {0xE6,0xA9,0xBD,3}, {0xE6,0xA9,0xBE,3}, {0xE6,0xA9,0xBF,3}, {0xE6,0xAA,0x81,3},
+        {0xE6,0xAA,0x82,3}, {0xE6,0xAA,0x83,3}, {0xE6,0xAA,0x85,3}, {0xE6,0xAA,0x86,3}, {0xE6,0xAA,0x87,3}, {0xE6,0xAA,0x88,3}, {0xE6,0xAA,0x89,3}, {0xE6,0xAA,0x8A,3},
+        {0xE6,0xAA,0x8B,3}, {0xE6,0xAA,0x8C,3}, {0xE6,0xAA,0x8D,3}, {0xE6,0xAA,0x8F,3}, {0xE6,0xAA,0x92,3}, {0xE6,0xAA,0x93,3}, {0xE6,0xAA,0x94,3}, {0xE6,0xAA,0x95,3},
+        {0xE6,0xAA,0x96,3}, {0xE6,0xAA,0x98,3}, {0xE6,0xAA,0x99,3}, {0xE6,0xAA,0x9A,3}, {0xE6,0xAA,0x9B,3}, {0xE6,0xAA,0x9C,3}, {0xE6,0xAA,0x9D,3}, {0xE6,0xAA,0x9E,3},
+        {0xE6,0xAA,0x9F,3}, {0xE6,0xAA,0xA1,3}, {0xE6,0xAA,0xA2,3}, {0xE6,0xAA,0xA3,3}, {0xE6,0xAA,0xA4,3}, {0xE6,0xAA,0xA5,3}, {0xE6,0xAA,0xA6,3}, {0xE6,0xAA,0xA7,3},
+        {0xE6,0xAA,0xA8,3}, {0xE6,0xAA,0xAA,3}, {0xE6,0xAA,0xAD,3}, {0xE6,0xAA,0xAE,3}, {0xE6,0xAA,0xAF,3}, {0xE6,0xAA,0xB0,3}, {0xE6,0xAA,0xB1,3}, {0xE6,0xAA,0xB2,3},
+        {0xE6,0xAA,0xB3,3}, {0xE6,0xAA,0xB4,3}, {0xE6,0xAA,0xB5,3}, {0xE6,0xAA,0xB6,3}, {0xE6,0xAA,0xB7,3}, {0xE6,0xAA,0xB8,3}, {0xE6,0xAA,0xB9,3}, {0xE6,0xAA,0xBA,3},
+        {0xE6,0xAA,0xBB,3}, {0xE6,0xAA,0xBC,3}, {0xE6,0xAA,0xBD,3}, {0xE6,0xAA,0xBE,3}, {0xE6,0xAA,0xBF,3}, {0xE6,0xAB,0x80,3}, {0xE6,0xAB,0x81,3}, {0xE6,0xAB,0x82,3},
+        {0xE6,0xAB,0x83,3}, {0xE6,0xAB,0x84,3}, {0xE6,0xAB,0x85,3}, {0xE6,0xAB,0x86,3}, {0xE6,0xAB,0x87,3}, {0xE6,0xAB,0x88,3}, {0xE6,0xAB,0x89,3}, {0xE6,0xAB,0x8A,3},
+        {0xE6,0xAB,0x8B,3}, {0xE6,0xAB,0x8C,3}, {0xE6,0xAB,0x8D,3}, {0xE6,0xAB,0x8E,3}, {0xE6,0xAB,0x8F,3}, {0xE6,0xAB,0x90,3}, {0xE6,0xAB,0x91,3}, {0xE6,0xAB,0x92,3},
+        {0xE6,0xAB,0x93,3}, {0xE6,0xAB,0x94,3}, {0xE6,0xAB,0x95,3}, {0xE6,0xAB,0x96,3}, {0xE6,0xAB,0x97,3}, {0xE6,0xAB,0x98,3}, {0xE6,0xAB,0x99,3}, {0xE6,0xAB,0x9A,3},
+        {0xE6,0xAB,0x9B,3}, {0xE6,0xAB,0x9C,3}, {0xE6,0xAB,0x9D,3}, {0xE6,0xAB,0x9E,3}, {0xE6,0xAB,0x9F,3}, {0xE6,0xAB,0xA0,3}, {0xE6,0xAB,0xA1,3}, {0xE6,0xAB,0xA2,3},
+        {0xE6,0xAB,0xA3,3}, {0xE6,0xAB,0xA4,3}, {0xE6,0xAB,0xA5,3}, {0xE6,0xAB,0xA6,3}, {0xE6,0xAB,0xA7,3}, {0xE6,0xAB,0xA8,3}, {0xE6,0xAB,0xA9,3}, {0xE6,0xAB,0xAA,3},
+        {0xE6,0xAB,0xAB,3}, {0xE6,0xAB,0xAC,3}, {0xE6,0xAB,0xAD,3}, {0xE6,0xAB,0xAE,3}, {0xE6,0xAB,0xAF,3}, {0xE6,0xAB,0xB0,3}, {0xE6,0xAB,0xB1,3}, {0xE6,0xAB,0xB2,3},
+        {0xE6,0xAB,0xB3,3}, {0xE6,0xAB,0xB4,3}, {0xE6,0xAB,0xB5,3}, {0xE6,0xAB,0xB6,3}, {0xE6,0xAB,0xB7,3}, {0xE6,0xAB,0xB8,3}, {0xE6,0xAB,0xB9,3}, {0xE6,0xAB,0xBA,3},
+        {0xE6,0xAB,0xBB,3}, {0xE6,0xAB,0xBC,3}, {0xE6,0xAB,0xBD,3}, {0xE6,0xAB,0xBE,3}, {0xE6,0xAB,0xBF,3}, {0xE6,0xAC,0x80,3}, {0xE6,0xAC,0x81,3}, {0xE6,0xAC,0x82,3},
+        {0xE6,0xAC,0x83,3}, {0xE6,0xAC,0x84,3}, {0xE6,0xAC,0x85,3}, {0xE6,0xAC,0x86,3}, {0xE6,0xAC,0x87,3}, {0xE6,0xAC,0x88,3}, {0xE6,0xAC,0x89,3}, {0xE6,0xAC,0x8A,3},
+        {0xE6,0xAC,0x8B,3}, {0xE6,0xAC,0x8C,3}, {0xE6,0xAC,0x8D,3}, {0xE6,0xAC,0x8E,3}, {0xE6,0xAC,0x8F,3}, {0xE6,0xAC,0x90,3}, {0xE6,0xAC,0x91,3}, {0xE6,0xAC,0x92,3},
+        {0xE6,0xAC,0x93,3}, {0xE6,0xAC,0x94,3}, {0xE6,0xAC,0x95,3}, {0xE6,0xAC,0x96,3}, {0xE6,0xAC,0x97,3}, {0xE6,0xAC,0x98,3}, {0xE6,0xAC,0x99,3}, {0xE6,0xAC,0x9A,3},
+        {0xE6,0xAC,0x9B,3}, {0xE6,0xAC,0x9C,3}, {0xE6,0xAC,0x9D,3}, {0xE6,0xAC,0x9E,3}, {0xE6,0xAC,0x9F,3}, {0xE6,0xAC,0xA5,3}, {0xE6,0xAC,0xA6,3}, {0xE6,0xAC,0xA8,3},
+        {0xE6,0xAC,0xA9,3}, {0xE6,0xAC,0xAA,3}, {0xE6,0xAC,0xAB,3}, {0xE6,0xAC,0xAC,3}, {0xE6,0xAC,0xAD,3}, {0xE6,0xAC,0xAE,3},
+    },
+    /* 0x9A */ {
+        {0xE6,0xAC,0xAF,3}, {0xE6,0xAC,0xB0,3}, {0xE6,0xAC,0xB1,3}, {0xE6,0xAC,0xB3,3}, {0xE6,0xAC,0xB4,3}, {0xE6,0xAC,0xB5,3}, {0xE6,0xAC,0xB6,3}, {0xE6,0xAC,0xB8,3},
+        {0xE6,0xAC,0xBB,3}, {0xE6,0xAC,0xBC,3}, {0xE6,0xAC,0xBD,3}, {0xE6,0xAC,0xBF,3}, {0xE6,0xAD,0x80,3}, {0xE6,0xAD,0x81,3}, {0xE6,0xAD,0x82,3}, {0xE6,0xAD,0x84,3},
+        {0xE6,0xAD,0x85,3}, {0xE6,0xAD,0x88,3}, {0xE6,0xAD,0x8A,3}, {0xE6,0xAD,0x8B,3}, {0xE6,0xAD,0x8D,3}, {0xE6,0xAD,0x8E,3}, {0xE6,0xAD,0x8F,3}, {0xE6,0xAD,0x90,3},
+        {0xE6,0xAD,0x91,3}, {0xE6,0xAD,0x92,3}, {0xE6,0xAD,0x93,3}, {0xE6,0xAD,0x94,3}, {0xE6,0xAD,0x95,3}, {0xE6,0xAD,0x96,3}, {0xE6,0xAD,0x97,3}, {0xE6,0xAD,0x98,3},
+        {0xE6,0xAD,0x9A,3}, {0xE6,0xAD,0x9B,3}, {0xE6,0xAD,0x9C,3}, {0xE6,0xAD,0x9D,3}, {0xE6,0xAD,0x9E,3}, {0xE6,0xAD,0x9F,3}, {0xE6,0xAD,0xA0,3}, {0xE6,0xAD,0xA1,3},
+        {0xE6,0xAD,0xA8,3}, {0xE6,0xAD,0xA9,3}, {0xE6,0xAD,0xAB,3}, {0xE6,0xAD,0xAC,3}, {0xE6,0xAD,0xAD,3}, {0xE6,0xAD,0xAE,3}, {0xE6,0xAD,0xAF,3}, {0xE6,0xAD,0xB0,3},
+        {0xE6,0xAD,0xB1,3}, {0xE6,0xAD,0xB2,3}, {0xE6,0xAD,0xB3,3}, {0xE6,0xAD,0xB4,3}, {0xE6,0xAD,0xB5,3}, {0xE6,0xAD,0xB6,3}, {0xE6,0xAD,0xB7,3}, {0xE6,0xAD,0xB8,3},
+        {0xE6,0xAD,0xBA,3}, {0xE6,0xAD,0xBD,3}, {0xE6,0xAD,0xBE,3}, {0xE6,0xAD,0xBF,3}, {0xE6,0xAE,0x80,3}, {0xE6,0xAE,0x85,3}, {0xE6,0xAE,0x88,3}, {0xE6,0xAE,0x8C,3},
+        {0xE6,0xAE,0x8E,3}, {0xE6,0xAE,0x8F,3}, {0xE6,0xAE,0x90,3}, {0xE6,0xAE,0x91,3}, {0xE6,0xAE,0x94,3}, {0xE6,0xAE,0x95,3}, {0xE6,0xAE,0x97,3}, {0xE6,0xAE,0x98,3},
+        {0xE6,0xAE,0x99,3}, {0xE6,0xAE,0x9C,3}, {0xE6,0xAE,0x9D,3}, {0xE6,0xAE,0x9E,3}, {0xE6,0xAE,0x9F,3}, {0xE6,0xAE,0xA0,3}, {0xE6,0xAE,0xA2,3}, {0xE6,0xAE,0xA3,3},
+        {0xE6,0xAE,0xA4,3}, {0xE6,0xAE,0xA5,3}, {0xE6,0xAE,0xA6,3}, {0xE6,0xAE,0xA7,3}, {0xE6,0xAE,0xA8,3}, {0xE6,0xAE,0xA9,3}, {0xE6,0xAE,0xAB,3}, {0xE6,0xAE,0xAC,3},
+        {0xE6,0xAE,0xAD,3}, {0xE6,0xAE,0xAE,3}, {0xE6,0xAE,0xAF,3}, {0xE6,0xAE,0xB0,3}, {0xE6,0xAE,0xB1,3}, {0xE6,0xAE,0xB2,3}, {0xE6,0xAE,0xB6,3}, {0xE6,0xAE,0xB8,3},
+        {0xE6,0xAE,0xB9,3}, {0xE6,0xAE,0xBA,3}, {0xE6,0xAE,0xBB,3}, {0xE6,0xAE,0xBC,3}, {0xE6,0xAE,0xBD,3}, {0xE6,0xAE,0xBE,3}, {0xE6,0xAF,0x80,3}, {0xE6,0xAF,0x83,3},
+        {0xE6,0xAF,0x84,3}, {0xE6,0xAF,0x86,3}, {0xE6,0xAF,0x87,3}, {0xE6,0xAF,0x88,3}, {0xE6,0xAF,0x89,3}, {0xE6,0xAF,0x8A,3}, {0xE6,0xAF,0x8C,3}, {0xE6,0xAF,0x8E,3},
+        {0xE6,0xAF,0x90,3}, {0xE6,0xAF,0x91,3}, {0xE6,0xAF,0x98,3}, {0xE6,0xAF,0x9A,3}, {0xE6,0xAF,0x9C,3}, {0xE6,0xAF,0x9D,3}, {0xE6,0xAF,0x9E,3}, {0xE6,0xAF,0x9F,3},
+        {0xE6,0xAF,0xA0,3}, {0xE6,0xAF,0xA2,3}, {0xE6,0xAF,0xA3,3}, {0xE6,0xAF,0xA4,3}, {0xE6,0xAF,0xA5,3}, {0xE6,0xAF,0xA6,3}, {0xE6,0xAF,0xA7,3}, {0xE6,0xAF,0xA8,3},
+        {0xE6,0xAF,0xA9,3}, {0xE6,0xAF,0xAC,3}, {0xE6,0xAF,0xAD,3}, {0xE6,0xAF,0xAE,3}, {0xE6,0xAF,0xB0,3}, {0xE6,0xAF,0xB1,3}, {0xE6,0xAF,0xB2,3}, {0xE6,0xAF,0xB4,3},
+        {0xE6,0xAF,0xB6,3}, {0xE6,0xAF,0xB7,3}, {0xE6,0xAF,0xB8,3}, {0xE6,0xAF,0xBA,3}, {0xE6,0xAF,0xBB,3}, {0xE6,0xAF,0xBC,3}, {0xE6,0xAF,0xBE,3}, {0xE6,0xAF,0xBF,3},
+        {0xE6,0xB0,0x80,3}, {0xE6,0xB0,0x81,3}, {0xE6,0xB0,0x82,3}, {0xE6,0xB0,0x83,3}, {0xE6,0xB0,0x84,3}, {0xE6,0xB0,0x88,3}, {0xE6,0xB0,0x89,3}, {0xE6,0xB0,0x8A,3},
+        {0xE6,0xB0,0x8B,3}, {0xE6,0xB0,0x8C,3}, {0xE6,0xB0,0x8E,3}, {0xE6,0xB0,0x92,3}, {0xE6,0xB0,0x97,3}, {0xE6,0xB0,0x9C,3}, {0xE6,0xB0,0x9D,3}, {0xE6,0xB0,0x9E,3},
+        {0xE6,0xB0,0xA0,3}, {0xE6,0xB0,0xA3,3}, {0xE6,0xB0,0xA5,3}, {0xE6,0xB0,0xAB,3}, {0xE6,0xB0,0xAC,3}, {0xE6,0xB0,0xAD,3}, {0xE6,0xB0,0xB1,3}, {0xE6,0xB0,0xB3,3},
+        {0xE6,0xB0,0xB6,3}, {0xE6,0xB0,0xB7,3}, {0xE6,0xB0,0xB9,3}, {0xE6,0xB0,0xBA,3}, {0xE6,0xB0,0xBB,3}, {0xE6,0xB0,0xBC,3}, {0xE6,0xB0,0xBE,3}, {0xE6,0xB0,0xBF,3},
+        {0xE6,0xB1,0x83,3}, {0xE6,0xB1,0x84,3}, {0xE6,0xB1,0x85,3}, {0xE6,0xB1,0x88,3}, {0xE6,0xB1,0x8B,3}, {0xE6,0xB1,0x8C,3}, {0xE6,0xB1,0x8D,3}, {0xE6,0xB1,0x8E,3},
+        {0xE6,0xB1,0x8F,3}, {0xE6,0xB1,0x91,3}, {0xE6,0xB1,0x92,3}, {0xE6,0xB1,0x93,3}, {0xE6,0xB1,0x96,3}, {0xE6,0xB1,0x98,3},
+    },
+    /* 0x9B */ {
+        {0xE6,0xB1,0x99,3}, {0xE6,0xB1,0x9A,3}, {0xE6,0xB1,0xA2,3}, {0xE6,0xB1,0xA3,3}, {0xE6,0xB1,0xA5,3}, {0xE6,0xB1,0xA6,3}, {0xE6,0xB1,0xA7,3}, {0xE6,0xB1,0xAB,3},
+        {0xE6,0xB1,0xAC,3}, {0xE6,0xB1,0xAD,3}, {0xE6,0xB1,0xAE,3}, {0xE6,0xB1,0xAF,3}, {0xE6,0xB1,0xB1,3}, {0xE6,0xB1,0xB3,3}, {0xE6,0xB1,0xB5,3}, {0xE6,0xB1,0xB7,3},
+        {0xE6,0xB1,0xB8,3}, {0xE6,0xB1,0xBA,3}, {0xE6,0xB1,0xBB,3}, {0xE6,0xB1,0xBC,3}, {0xE6,0xB1,0xBF,3}, {0xE6,0xB2,0x80,3}, {0xE6,0xB2,0x84,3}, {0xE6,0xB2,0x87,3},
+        {0xE6,0xB2,0x8A,3}, {0xE6,0xB2,0x8B,3}, {0xE6,0xB2,0x8D,3}, {0xE6,0xB2,0x8E,3}, {0xE6,0xB2,0x91,3}, {0xE6,0xB2,0x92,3}, {0xE6,0xB2,0x95,3}, {0xE6,0xB2,0x96,3},
+        {0xE6,0xB2,0x97,3}, {0xE6,0xB2,0x98,3}, {0xE6,0xB2,0x9A,3}, {0xE6,0xB2,0x9C,3}, {0xE6,0xB2,0x9D,3}, {0xE6,0xB2,0x9E,3}, {0xE6,0xB2,0xA0,3}, {0xE6,0xB2,0xA2,3},
+        {0xE6,0xB2,0xA8,3}, {0xE6,0xB2,0xAC,3}, {0xE6,0xB2,0xAF,3}, {0xE6,0xB2,0xB0,3}, {0xE6,0xB2,0xB4,3}, {0xE6,0xB2,0xB5,3}, {0xE6,0xB2,0xB6,3}, {0xE6,0xB2,0xB7,3},
+        {0xE6,0xB2,0xBA,3}, {0xE6,0xB3,0x80,3}, {0xE6,0xB3,0x81,3}, {0xE6,0xB3,0x82,3}, {0xE6,0xB3,0x83,3}, {0xE6,0xB3,0x86,3}, {0xE6,0xB3,0x87,3}, {0xE6,0xB3,0x88,3},
+        {0xE6,0xB3,0x8B,3}, {0xE6,0xB3,0x8D,3}, {0xE6,0xB3,0x8E,3}, {0xE6,0xB3,0x8F,3}, {0xE6,0xB3,0x91,3}, {0xE6,0xB3,0x92,3}, {0xE6,0xB3,0x98,3}, {0xE6,0xB3,0x99,3},
+        {0xE6,0xB3,0x9A,3}, {0xE6,0xB3,0x9C,3}, {0xE6,0xB3,0x9D,3}, {0xE6,0xB3,0x9F,3}, {0xE6,0xB3,0xA4,3}, {0xE6,0xB3,0xA6,3}, {0xE6,0xB3,0xA7,3}, {0xE6,0xB3,0xA9,3},
+        {0xE6,0xB3,0xAC,3}, {0xE6,0xB3,0xAD,3}, {0xE6,0xB3,0xB2,3}, {0xE6,0xB3,0xB4,3}, {0xE6,0xB3,0xB9,3}, {0xE6,0xB3,0xBF,3}, {0xE6,0xB4,0x80,3}, {0xE6,0xB4,0x82,3},
+        {0xE6,0xB4,0x83,3}, {0xE6,0xB4,0x85,3}, {0xE6,0xB4,0x86,3}, {0xE6,0xB4,0x88,3}, {0xE6,0xB4,0x89,3}, {0xE6,0xB4,0x8A,3}, {0xE6,0xB4,0x8D,3}, {0xE6,0xB4,0x8F,3},
+        {0xE6,0xB4,0x90,3}, {0xE6,0xB4,0x91,3}, {0xE6,0xB4,0x93,3}, {0xE6,0xB4,0x94,3}, {0xE6,0xB4,0x95,3}, {0xE6,0xB4,0x96,3}, {0xE6,0xB4,0x98,3}, {0xE6,0xB4,0x9C,3},
+        {0xE6,0xB4,0x9D,3}, {0xE6,0xB4,0x9F,3}, {0xE6,0xB4,0xA0,3}, {0xE6,0xB4,0xA1,3}, {0xE6,0xB4,0xA2,3}, {0xE6,0xB4,0xA3,3}, {0xE6,0xB4,0xA4,3}, {0xE6,0xB4,0xA6,3},
+        {0xE6,0xB4,0xA8,3}, {0xE6,0xB4,0xA9,3}, {0xE6,0xB4,0xAC,3}, {0xE6,0xB4,0xAD,3}, {0xE6,0xB4,0xAF,3}, {0xE6,0xB4,0xB0,3}, {0xE6,0xB4,0xB4,3}, {0xE6,0xB4,0xB6,3},
+        {0xE6,0xB4,0xB7,3}, {0xE6,0xB4,0xB8,3}, {0xE6,0xB4,0xBA,3}, {0xE6,0xB4,0xBF,3}, {0xE6,0xB5,0x80,3}, {0xE6,0xB5,0x82,3}, {0xE6,0xB5,0x84,3}, {0xE6,0xB5,0x89,3},
+        {0xE6,0xB5,0x8C,3}, {0xE6,0xB5,0x90,3}, {0xE6,0xB5,0x95,3}, {0xE6,0xB5,0x96,3}, {0xE6,0xB5,0x97,3}, {0xE6,0xB5,0x98,3}, {0xE6,0xB5,0x9B,3}, {0xE6,0xB5,0x9D,3},
+        {0xE6,0xB5,0x9F,3}, {0xE6,0xB5,0xA1,3}, {0xE6,0xB5,0xA2,3}, {0xE6,0xB5,0xA4,3}, {0xE6,0xB5,0xA5,3}, {0xE6,0xB5,0xA7,3}, {0xE6,0xB5,0xA8,3}, {0xE6,0xB5,0xAB,3},
+        {0xE6,0xB5,0xAC,3}, {0xE6,0xB5,0xAD,3}, {0xE6,0xB5,0xB0,3}, {0xE6,0xB5,0xB1,3}, {0xE6,0xB5,0xB2,3}, {0xE6,0xB5,0xB3,3}, {0xE6,0xB5,0xB5,3}, {0xE6,0xB5,0xB6,3},
+        {0xE6,0xB5,0xB9,3}, {0xE6,0xB5,0xBA,3}, {0xE6,0xB5,0xBB,3}, {0xE6,0xB5,0xBD,3}, {0xE6,0xB5,0xBE,3}, {0xE6,0xB5,0xBF,3}, {0xE6,0xB6,0x80,3}, {0xE6,0xB6,0x81,3},
+        {0xE6,0xB6,0x83,3}, {0xE6,0xB6,0x84,3}, {0xE6,0xB6,0x86,3}, {0xE6,0xB6,0x87,3}, {0xE6,0xB6,0x8A,3}, {0xE6,0xB6,0x8B,3}, {0xE6,0xB6,0x8D,3}, {0xE6,0xB6,0x8F,3},
+        {0xE6,0xB6,0x90,3}, {0xE6,0xB6,0x92,3}, {0xE6,0xB6,0x96,3}, {0xE6,0xB6,0x97,3}, {0xE6,0xB6,0x98,3}, {0xE6,0xB6,0x99,3}, {0xE6,0xB6,0x9A,3}, {0xE6,0xB6,0x9C,3},
+        {0xE6,0xB6,0xA2,3}, {0xE6,0xB6,0xA5,3}, {0xE6,0xB6,0xAC,3}, {0xE6,0xB6,0xAD,3}, {0xE6,0xB6,0xB0,3}, {0xE6,0xB6,0xB1,3}, {0xE6,0xB6,0xB3,3}, {0xE6,0xB6,0xB4,3},
+        {0xE6,0xB6,0xB6,3}, {0xE6,0xB6,0xB7,3}, {0xE6,0xB6,0xB9,3}, {0xE6,0xB6,0xBA,3}, {0xE6,0xB6,0xBB,3}, {0xE6,0xB6,0xBC,3}, {0xE6,0xB6,0xBD,3}, {0xE6,0xB6,0xBE,3},
+        {0xE6,0xB7,0x81,3}, {0xE6,0xB7,0x82,3}, {0xE6,0xB7,0x83,3}, {0xE6,0xB7,0x88,3}, {0xE6,0xB7,0x89,3}, {0xE6,0xB7,0x8A,3},
+    },
+    /* 0x9C */ {
+        {0xE6,0xB7,0x8D,3}, {0xE6,0xB7,0x8E,3}, {0xE6,0xB7,0x8F,3}, {0xE6,0xB7,0x90,3}, {0xE6,0xB7,0x92,3}, {0xE6,0xB7,0x93,3}, {0xE6,0xB7,0x94,3}, {0xE6,0xB7,0x95,3},
+        {0xE6,0xB7,0x97,3}, {0xE6,0xB7,0x9A,3}, {0xE6,0xB7,0x9B,3}, {0xE6,0xB7,0x9C,3}, {0xE6,0xB7,0x9F,3}, {0xE6,0xB7,0xA2,3}, {0xE6,0xB7,0xA3,3}, {0xE6,0xB7,0xA5,3},
+        {0xE6,0xB7,0xA7,3}, {0xE6,0xB7,0xA8,3}, {0xE6,0xB7,0xA9,3}, {0xE6,0xB7,0xAA,3}, {0xE6,0xB7,0xAD,3}, {0xE6,0xB7,0xAF,3}, {0xE6,0xB7,0xB0,3}, {0xE6,0xB7,0xB2,3},
+        {0xE6,0xB7,0xB4,3}, {0xE6,0xB7,0xB5,3}, {0xE6,0xB7,0xB6,3}, {0xE6,0xB7,0xB8,3}, {0xE6,0xB7,0xBA,3}, {0xE6,0xB7,0xBD,3}, {0xE6,0xB7,0xBE,3}, {0xE6,0xB7,0xBF,3},
+        {0xE6,0xB8,0x80,3}, {0xE6,0xB8,0x81,3}, {0xE6,0xB8,0x82,3}, {0xE6,0xB8,0x83,3}, {0xE6,0xB8,0x84,3}, {0xE6,0xB8,0x86,3}, {0xE6,0xB8,0x87,3}, {0xE6,0xB8,0x88,3},
+        {0xE6,0xB8,0x89,3}, {0xE6,0xB8,0x8B,3}, {0xE6,0xB8,0x8F,3}, {0xE6,0xB8,0x92,3}, {0xE6,0xB8,0x93,3}, {0xE6,0xB8,0x95,3}, {0xE6,0xB8,0x98,3}, {0xE6,0xB8,0x99,3},
+        {0xE6,0xB8,0x9B,3}, {0xE6,0xB8,0x9C,3}, {0xE6,0xB8,0x9E,3}, {0xE6,0xB8,0x9F,3}, {0xE6,0xB8,0xA2,3}, {0xE6,0xB8,0xA6,3}, {0xE6,0xB8,0xA7,3}, {0xE6,0xB8,0xA8,3},
+        {0xE6,0xB8,0xAA,3}, {0xE6,0xB8,0xAC,3}, {0xE6,0xB8,0xAE,3}, {0xE6,0xB8,0xB0,3}, {0xE6,0xB8,0xB1,3}, {0xE6,0xB8,0xB3,3}, {0xE6,0xB8,0xB5,3}, {0xE6,0xB8,0xB6,3},
+        {0xE6,0xB8,0xB7,3}, {0xE6,0xB8,0xB9,3}, {0xE6,0xB8,0xBB,3}, {0xE6,0xB8,0xBC,3}, {0xE6,0xB8,0xBD,3}, {0xE6,0xB8,0xBE,3}, {0xE6,0xB8,0xBF,3}, {0xE6,0xB9,0x80,3},
+        {0xE6,0xB9,0x81,3}, {0xE6,0xB9,0x82,3}, {0xE6,0xB9,0x85,3}, {0xE6,0xB9,0x86,3}, {0xE6,0xB9,0x87,3}, {0xE6,0xB9,0x88,3}, {0xE6,0xB9,0x89,3}, {0xE6,0xB9,0x8A,3},
+        {0xE6,0xB9,0x8B,3}, {0xE6,0xB9,0x8C,3}, {0xE6,0xB9,0x8F,3}, {0xE6,0xB9,0x90,3}, {0xE6,0xB9,0x91,3}, {0xE6,0xB9,0x92,3}, {0xE6,0xB9,0x95,3}, {0xE6,0xB9,0x97,3},
+        {0xE6,0xB9,0x99,3}, {0xE6,0xB9,0x9A,3}, {0xE6,0xB9,0x9C,3}, {0xE6,0xB9,0x9D,3}, {0xE6,0xB9,0x9E,3}, {0xE6,0xB9,0xA0,3}, {0xE6,0xB9,0xA1,3}, {0xE6,0xB9,0xA2,3},
+        {0xE6,0xB9,0xA3,3}, {0xE6,0xB9,0xA4,3}, {0xE6,0xB9,0xA5,3}, {0xE6,0xB9,0xA6,3}, {0xE6,0xB9,0xA7,3}, {0xE6,0xB9,0xA8,3}, {0xE6,0xB9,0xA9,3}, {0xE6,0xB9,0xAA,3},
+        {0xE6,0xB9,0xAC,3}, {0xE6,0xB9,0xAD,3}, {0xE6,0xB9,0xAF,3}, {0xE6,0xB9,0xB0,3}, {0xE6,0xB9,0xB1,3}, {0xE6,0xB9,0xB2,3}, {0xE6,0xB9,0xB3,3}, {0xE6,0xB9,0xB4,3},
+        {0xE6,0xB9,0xB5,3}, {0xE6,0xB9,0xB6,3}, {0xE6,0xB9,0xB7,3}, {0xE6,0xB9,0xB8,3}, {0xE6,0xB9,0xB9,3}, {0xE6,0xB9,0xBA,3}, {0xE6,0xB9,0xBB,3}, {0xE6,0xB9,0xBC,3},
+        {0xE6,0xB9,0xBD,3}, {0xE6,0xBA,0x80,3}, {0xE6,0xBA,0x81,3}, {0xE6,0xBA,0x82,3}, {0xE6,0xBA,0x84,3}, {0xE6,0xBA,0x87,3}, {0xE6,0xBA,0x88,3}, {0xE6,0xBA,0x8A,3},
+        {0xE6,0xBA,0x8B,3}, {0xE6,0xBA,0x8C,3}, {0xE6,0xBA,0x8D,3}, {0xE6,0xBA,0x8E,3}, {0xE6,0xBA,0x91,3}, {0xE6,0xBA,0x92,3}, {0xE6,0xBA,0x93,3}, {0xE6,0xBA,0x94,3},
+        {0xE6,0xBA,0x95,3}, {0xE6,0xBA,0x96,3}, {0xE6,0xBA,0x97,3}, {0xE6,0xBA,0x99,3}, {0xE6,0xBA,0x9A,3}, {0xE6,0xBA,0x9B,3}, {0xE6,0xBA,0x9D,3}, {0xE6,0xBA,0x9E,3},
+        {0xE6,0xBA,0xA0,3}, {0xE6,0xBA,0xA1,3}, {0xE6,0xBA,0xA3,3}, {0xE6,0xBA,0xA4,3}, {0xE6,0xBA,0xA6,3}, {0xE6,0xBA,0xA8,3}, {0xE6,0xBA,0xA9,3}, {0xE6,0xBA,0xAB,3},
+        {0xE6,0xBA,0xAC,3}, {0xE6,0xBA,0xAD,3}, {0xE6,0xBA,0xAE,3}, {0xE6,0xBA,0xB0,3}, {0xE6,0xBA,0xB3,3}, {0xE6,0xBA,0xB5,3}, {0xE6,0xBA,0xB8,3}, {0xE6,0xBA,0xB9,3},
+        {0xE6,0xBA,0xBC,3}, {0xE6,0xBA,0xBE,3}, {0xE6,0xBA,0xBF,3}, {0xE6,0xBB,0x80,3}, {0xE6,0xBB,0x83,3}, {0xE6,0xBB,0x84,3}, {0xE6,0xBB,0x85,3}, {0xE6,0xBB,0x86,3},
+        {0xE6,0xBB,0x88,3}, {0xE6,0xBB,0x89,3}, {0xE6,0xBB,0x8A,3}, {0xE6,0xBB,0x8C,3}, {0xE6,0xBB,0x8D,3}, {0xE6,0xBB,0x8E,3}, {0xE6,0xBB,0x90,3}, {0xE6,0xBB,0x92,3},
+        {0xE6,0xBB,0x96,3}, {0xE6,0xBB,0x98,3}, {0xE6,0xBB,0x99,3}, {0xE6,0xBB,0x9B,3}, {0xE6,0xBB,0x9C,3}, {0xE6,0xBB,0x9D,3}, {0xE6,0xBB,0xA3,3}, {0xE6,0xBB,0xA7,3},
+        {0xE6,0xBB,0xAA,3}, {0xE6,0xBB,0xAB,3}, {0xE6,0xBB,0xAC,3}, {0xE6,0xBB,0xAD,3}, {0xE6,0xBB,0xAE,3}, {0xE6,0xBB,0xAF,3},
+    },
+    /* 0x9D */ {
+        {0xE6,0xBB,0xB0,3}, {0xE6,0xBB,0xB1,3}, {0xE6,0xBB,0xB2,3}, {0xE6,0xBB,0xB3,3}, {0xE6,0xBB,0xB5,3}, {0xE6,0xBB,0xB6,3}, {0xE6,0xBB,0xB7,3}, {0xE6,0xBB,0xB8,3},
+        {0xE6,0xBB,0xBA,3}, {0xE6,0xBB,0xBB,3}, {0xE6,0xBB,0xBC,3}, {0xE6,0xBB,0xBD,3}, {0xE6,0xBB,0xBE,3}, {0xE6,0xBB,0xBF,3}, {0xE6,0xBC,0x80,3}, {0xE6,0xBC,0x81,3},
+        {0xE6,0xBC,0x83,3}, {0xE6,0xBC,0x84,3}, {0xE6,0xBC,0x85,3}, {0xE6,0xBC,0x87,3}, {0xE6,0xBC,0x88,3}, {0xE6,0xBC,0x8A,3}, {0xE6,0xBC,0x8B,3}, {0xE6,0xBC,0x8C,3},
+        {0xE6,0xBC,0x8D,3}, {0xE6,0xBC,0x8E,3}, {0xE6,0xBC,0x90,3}, {0xE6,0xBC,0x91,3}, {0xE6,0xBC,0x92,3}, {0xE6,0xBC,0x96,3}, {0xE6,0xBC,0x97,3}, {0xE6,0xBC,0x98,3},
+        {0xE6,0xBC,0x99,3}, {0xE6,0xBC,0x9A,3}, {0xE6,0xBC,0x9B,3}, {0xE6,0xBC,0x9C,3}, {0xE6,0xBC,0x9D,3}, {0xE6,0xBC,0x9E,3}, {0xE6,0xBC,0x9F,3}, {0xE6,0xBC,0xA1,3},
+        {0xE6,0xBC,0xA2,3}, {0xE6,0xBC,0xA3,3}, {0xE6,0xBC,0xA5,3}, {0xE6,0xBC,0xA6,3}, {0xE6,0xBC,0xA7,3}, {0xE6,0xBC,0xA8,3}, {0xE6,0xBC,0xAC,3}, {0xE6,0xBC,0xAE,3},
+        {0xE6,0xBC,0xB0,3}, {0xE6,0xBC,0xB2,3}, {0xE6,0xBC,0xB4,3}, {0xE6,0xBC,0xB5,3}, {0xE6,0xBC,0xB7,3}, {0xE6,0xBC,0xB8,3}, {0xE6,0xBC,0xB9,3}, {0xE6,0xBC,0xBA,3},
+        {0xE6,0xBC,0xBB,3}, {0xE6,0xBC,0xBC,3}, {0xE6,0xBC,0xBD,3}, {0xE6,0xBC,0xBF,3}, {0xE6,0xBD,0x80,3}, {0xE6,0xBD,0x81,3}, {0xE6,0xBD,0x82,3}, {0xE6,0xBD,0x83,3},
+        {0xE6,0xBD,0x84,3}, {0xE6,0xBD,0x85,3}, {0xE6,0xBD,0x88,3}, {0xE6,0xBD,0x89,3}, {0xE6,0xBD,0x8A,3}, {0xE6,0xBD,0x8C,3}, {0xE6,0xBD,0x8E,3}, {0xE6,0xBD,0x8F,3},
+        {0xE6,0xBD,0x90,3}, {0xE6,0xBD,0x91,3}, {0xE6,0xBD,0x92,3}, {0xE6,0xBD,0x93,3}, {0xE6,0xBD,0x94,3}, {0xE6,0xBD,0x95,3}, {0xE6,0xBD,0x96,3}, {0xE6,0xBD,0x97,3},
+        {0xE6,0xBD,0x99,3}, {0xE6,0xBD,0x9A,3}, {0xE6,0xBD,0x9B,3}, {0xE6,0xBD,0x9D,3}, {0xE6,0xBD,0x9F,3}, {0xE6,0xBD,0xA0,3}, {0xE6,0xBD,0xA1,3}, {0xE6,0xBD,0xA3,3},
+        {0xE6,0xBD,0xA4,3}, {0xE6,0xBD,0xA5,3}, {0xE6,0xBD,0xA7,3}, {0xE6,0xBD,0xA8,3}, {0xE6,0xBD,0xA9,3}, {0xE6,0xBD,0xAA,3}, {0xE6,0xBD,0xAB,3}, {0xE6,0xBD,0xAC,3},
+        {0xE6,0xBD,0xAF,3}, {0xE6,0xBD,0xB0,3}, {0xE6,0xBD,0xB1,3}, {0xE6,0xBD,0xB3,3}, {0xE6,0xBD,0xB5,3}, {0xE6,0xBD,0xB6,3}, {0xE6,0xBD,0xB7,3}, {0xE6,0xBD,0xB9,3},
+        {0xE6,0xBD,0xBB,3}, {0xE6,0xBD,0xBD,3}, {0xE6,0xBD,0xBE,3}, {0xE6,0xBD,0xBF,3}, {0xE6,0xBE,0x80,3}, {0xE6,0xBE,0x81,3}, {0xE6,0xBE,0x82,3}, {0xE6,0xBE,0x83,3},
+        {0xE6,0xBE,0x85,3}, {0xE6,0xBE,0x86,3}, {0xE6,0xBE,0x87,3}, {0xE6,0xBE,0x8A,3}, {0xE6,0xBE,0x8B,3}, {0xE6,0xBE,0x8F,3}, {0xE6,0xBE,0x90,3}, {0xE6,0xBE,0x91,3},
+        {0xE6,0xBE,0x92,3}, {0xE6,0xBE,0x93,3}, {0xE6,0xBE,0x94,3}, {0xE6,0xBE,0x95,3}, {0xE6,0xBE,0x96,3}, {0xE6,0xBE,0x97,3}, {0xE6,0xBE,0x98,3}, {0xE6,0xBE,0x99,3},
+        {0xE6,0xBE,0x9A,3}, {0xE6,0xBE,0x9B,3}, {0xE6,0xBE,0x9D,3}, {0xE6,0xBE,0x9E,3}, {0xE6,0xBE,0x9F,3}, {0xE6,0xBE,0xA0,3}, {0xE6,0xBE,0xA2,3}, {0xE6,0xBE,0xA3,3},
+        {0xE6,0xBE,0xA4,3}, {0xE6,0xBE,0xA5,3}, {0xE6,0xBE,0xA6,3}, {0xE6,0xBE,0xA8,3}, {0xE6,0xBE,0xA9,3}, {0xE6,0xBE,0xAA,3}, {0xE6,0xBE,0xAB,3}, {0xE6,0xBE,0xAC,3},
+        {0xE6,0xBE,0xAD,3}, {0xE6,0xBE,0xAE,3}, {0xE6,0xBE,0xAF,3}, {0xE6,0xBE,0xB0,3}, {0xE6,0xBE,0xB1,3}, {0xE6,0xBE,0xB2,3}, {0xE6,0xBE,0xB4,3}, {0xE6,0xBE,0xB5,3},
+        {0xE6,0xBE,0xB7,3}, {0xE6,0xBE,0xB8,3}, {0xE6,0xBE,0xBA,3}, {0xE6,0xBE,0xBB,3}, {0xE6,0xBE,0xBC,3}, {0xE6,0xBE,0xBD,3}, {0xE6,0xBE,0xBE,3}, {0xE6,0xBE,0xBF,3},
+        {0xE6,0xBF,0x81,3}, {0xE6,0xBF,0x83,3}, {0xE6,0xBF,0x84,3}, {0xE6,0xBF,0x85,3}, {0xE6,0xBF,0x86,3}, {0xE6,0xBF,0x87,3}, {0xE6,0xBF,0x88,3}, {0xE6,0xBF,0x8A,3},
+        {0xE6,0xBF,0x8B,3}, {0xE6,0xBF,0x8C,3}, {0xE6,0xBF,0x8D,3}, {0xE6,0xBF,0x8E,3}, {0xE6,0xBF,0x8F,3}, {0xE6,0xBF,0x90,3}, {0xE6,0xBF,0x93,3}, {0xE6,0xBF,0x94,3},
+        {0xE6,0xBF,0x95,3}, {0xE6,0xBF,0x96,3}, {0xE6,0xBF,0x97,3}, {0xE6,0xBF,0x98,3}, {0xE6,0xBF,0x99,3}, {0xE6,0xBF,0x9A,3}, {0xE6,0xBF,0x9B,3}, {0xE6,0xBF,0x9C,3},
+        {0xE6,0xBF,0x9D,3}, {0xE6,0xBF,0x9F,3}, {0xE6,0xBF,0xA2,3}, {0xE6,0xBF,0xA3,3}, {0xE6,0xBF,0xA4,3}, {0xE6,0xBF,0xA5,3},
+    },
+    /* 0x9E */ {
+        {0xE6,0xBF,0xA6,3}, {0xE6,0xBF,0xA7,3}, {0xE6,0xBF,0xA8,3}, {0xE6,0xBF,0xA9,3}, {0xE6,0xBF,0xAA,3}, {0xE6,0xBF,0xAB,3}, {0xE6,0xBF,0xAC,3}, {0xE6,0xBF,0xAD,3},
+        {0xE6,0xBF,0xB0,3}, {0xE6,0xBF,0xB1,3}, {0xE6,0xBF,0xB2,3}, {0xE6,0xBF,0xB3,3}, {0xE6,0xBF,0xB4,3}, {0xE6,0xBF,0xB5,3}, {0xE6,0xBF,0xB6,3}, {0xE6,0xBF,0xB7,3},
+        {0xE6,0xBF,0xB8,3}, {0xE6,0xBF,0xB9,3}, {0xE6,0xBF,0xBA,3}, {0xE6,0xBF,0xBB,3}, {0xE6,0xBF,0xBC,3}, {0xE6,0xBF,0xBD,3}, {0xE6,0xBF,0xBE,3}, {0xE6,0xBF,0xBF,3},
+        {0xE7,0x80,0x80,3}, {0xE7,0x80,0x81,3}, {0xE7,0x80,0x82,3}, {0xE7,0x80,0x83,3}, {0xE7,0x80,0x84,3}, {0xE7,0x80,0x85,3}, {0xE7,0x80,0x86,3}, {0xE7,0x80,0x87,3},
+        {0xE7,0x80,0x88,3}, {0xE7,0x80,0x89,3}, {0xE7,0x80,0x8A,3}, {0xE7,0x80,0x8B,3}, {0xE7,0x80,0x8C,3}, {0xE7,0x80,0x8D,3}, {0xE7,0x80,0x8E,3}, {0xE7,0x80,0x8F,3},
+        {0xE7,0x80,0x90,3}, {0xE7,0x80,0x92,3}, {0xE7,0x80,0x93,3}, {0xE7,0x80,0x94,3}, {0xE7,0x80,0x95,3}, {0xE7,0x80,0x96,3}, {0xE7,0x80,0x97,3}, {0xE7,0x80,0x98,3},
+        {0xE7,0x80,0x99,3}, {0xE7,0x80,0x9C,3}, {0xE7,0x80,0x9D,3}, {0xE7,0x80,0x9E,3}, {0xE7,0x80,0x9F,3}, {0xE7,0x80,0xA0,3}, {0xE7,0x80,0xA1,3}, {0xE7,0x80,0xA2,3},
+        {0xE7,0x80,0xA4,3}, {0xE7,0x80,0xA5,3}, {0xE7,0x80,0xA6,3}, {0xE7,0x80,0xA7,3}, {0xE7,0x80,0xA8,3}, {0xE7,0x80,0xA9,3}, {0xE7,0x80,0xAA,3}, {0xE7,0x80,0xAB,3},
+        {0xE7,0x80,0xAC,3}, {0xE7,0x80,0xAD,3}, {0xE7,0x80,0xAE,3}, {0xE7,0x80,0xAF,3}, {0xE7,0x80,0xB0,3}, {0xE7,0x80,0xB1,3}, {0xE7,0x80,0xB2,3}, {0xE7,0x80,0xB3,3},
+        {0xE7,0x80,0xB4,3}, {0xE7,0x80,0xB6,3}, {0xE7,0x80,0xB7,3}, {0xE7,0x80,0xB8,3}, {0xE7,0x80,0xBA,3}, {0xE7,0x80,0xBB,3}, {0xE7,0x80,0xBC,3}, {0xE7,0x80,0xBD,3},
+        {0xE7,0x80,0xBE,3}, {0xE7,0x80,0xBF,3}, {0xE7,0x81,0x80,3}, {0xE7,0x81,0x81,3}, {0xE7,0x81,0x82,3}, {0xE7,0x81,0x83,3}, {0xE7,0x81,0x84,3}, {0xE7,0x81,0x85,3},
+        {0xE7,0x81,0x86,3}, {0xE7,0x81,0x87,3}, {0xE7,0x81,0x88,3}, {0xE7,0x81,0x89,3}, {0xE7,0x81,0x8A,3}, {0xE7,0x81,0x8B,3}, {0xE7,0x81,0x8D,3}, {0xE7,0x81,0x8E,3},
+        {0xE7,0x81,0x90,3}, {0xE7,0x81,0x91,3}, {0xE7,0x81,0x92,3}, {0xE7,0x81,0x93,3}, {0xE7,0x81,0x94,3}, {0xE7,0x81,0x95,3}, {0xE7,0x81,0x96,3}, {0xE7,0x81,0x97,3},
+        {0xE7,0x81,0x98,3}, {0xE7,0x81,0x99,3}, {0xE7,0x81,0x9A,3}, {0xE7,0x81,0x9B,3}, {0xE7,0x81,0x9C,3}, {0xE7,0x81,0x9D,3}, {0xE7,0x81,0x9F,3}, {0xE7,0x81,0xA0,3},
+        {0xE7,0x81,0xA1,3}, {0xE7,0x81,0xA2,3}, {0xE7,0x81,0xA3,3}, {0xE7,0x81,0xA4,3}, {0xE7,0x81,0xA5,3}, {0xE7,0x81,0xA6,3}, {0xE7,0x81,0xA7,3}, {0xE7,0x81,0xA8,3},
+        {0xE7,0x81,0xA9,3}, {0xE7,0x81,0xAA,3}, {0xE7,0x81,0xAE,3}, {0xE7,0x81,0xB1,3}, {0xE7,0x81,0xB2,3}, {0xE7,0x81,0xB3,3}, {0xE7,0x81,0xB4,3}, {0xE7,0x81,0xB7,3},
+        {0xE7,0x81,0xB9,3}, {0xE7,0x81,0xBA,3}, {0xE7,0x81,0xBB,3}, {0xE7,0x81,0xBD,3}, {0xE7,0x82,0x81,3}, {0xE7,0x82,0x82,3}, {0xE7,0x82,0x83,3}, {0xE7,0x82,0x84,3},
+        {0xE7,0x82,0x86,3}, {0xE7,0x82,0x87,3}, {0xE7,0x82,0x88,3}, {0xE7,0x82,0x8B,3}, {0xE7,0x82,0x8C,3}, {0xE7,0x82,0x8D,3}, {0xE7,0x82,0x8F,3}, {0xE7,0x82,0x90,3},
+        {0xE7,0x82,0x91,3}, {0xE7,0x82,0x93,3}, {0xE7,0x82,0x97,3}, {0xE7,0x82,0x98,3}, {0xE7,0x82,0x9A,3}, {0xE7,0x82,0x9B,3}, {0xE7,0x82,0x9E,3}, {0xE7,0x82,0x9F,3},
+        {0xE7,0x82,0xA0,3}, {0xE7,0x82,0xA1,3}, {0xE7,0x82,0xA2,3}, {0xE7,0x82,0xA3,3}, {0xE7,0x82,0xA4,3}, {0xE7,0x82,0xA5,3}, {0xE7,0x82,0xA6,3}, {0xE7,0x82,0xA7,3},
+        {0xE7,0x82,0xA8,3}, {0xE7,0x82,0xA9,3}, {0xE7,0x82,0xAA,3}, {0xE7,0x82,0xB0,3}, {0xE7,0x82,0xB2,3}, {0xE7,0x82,0xB4,3}, {0xE7,0x82,0xB5,3}, {0xE7,0x82,0xB6,3},
+        {0xE7,0x82,0xBA,3}, {0xE7,0x82,0xBE,3}, {0xE7,0x82,0xBF,3}, {0xE7,0x83,0x84,3}, {0xE7,0x83,0x85,3}, {0xE7,0x83,0x86,3}, {0xE7,0x83,0x87,3}, {0xE7,0x83,0x89,3},
+        {0xE7,0x83,0x8B,3}, {0xE7,0x83,0x8C,3}, {0xE7,0x83,0x8D,3}, {0xE7,0x83,0x8E,3}, {0xE7,0x83,0x8F,3}, {0xE7,0x83,0x90,3}, {0xE7,0x83,0x91,3}, {0xE7,0x83,0x92,3},
+        {0xE7,0x83,0x93,3}, {0xE7,0x83,0x94,3}, {0xE7,0x83,0x95,3}, {0xE7,0x83,0x96,3}, {0xE7,0x83,0x97,3}, {0xE7,0x83,0x9A,3},
+    },
+    /* 0x9F */ {
+        {0xE7,0x83,0x9C,3}, {0xE7,0x83,0x9D,3}, {0xE7,0x83,0x9E,3}, {0xE7,0x83,0xA0,3}, {0xE7,0x83,0xA1,3}, {0xE7,0x83,0xA2,3}, {0xE7,0x83,0xA3,3}, {0xE7,0x83,0xA5,3},
+        {0xE7,0x83,0xAA,3}, {0xE7,0x83,0xAE,3}, {0xE7,0x83,0xB0,3}, {0xE7,0x83,0xB1,3}, {0xE7,0x83,0xB2,3}, {0xE7,0x83,0xB3,3}, {0xE7,0x83,0xB4,3}, {0xE7,0x83,0xB5,3},
+        {0xE7,0x83,0xB6,3}, {0xE7,0x83,0xB8,3}, {0xE7,0x83,0xBA,3}, {0xE7,0x83,0xBB,3}, {0xE7,0x83,0xBC,3}, {0xE7,0x83,0xBE,3}, {0xE7,0x83,0xBF,3}, {0xE7,0x84,0x80,3},
+        {0xE7,0x84,0x81,3}, {0xE7,0x84,0x82,3}, {0xE7,0x84,0x83,3}, {0xE7,0x84,0x84,3}, {0xE7,0x84,0x85,3}, {0xE7,0x84,0x86,3}, {0xE7,0x84,0x87,3}, {0xE7,0x84,0x88,3},
+        {0xE7,0x84,0x8B,3}, {0xE7,0x84,0x8C,3}, {0xE7,0x84,0x8D,3}, {0xE7,0x84,0x8E,3}, {0xE7,0x84,0x8F,3}, {0xE7,0x84,0x91,3}, {0xE7,0x84,0x92,3}, {0xE7,0x84,0x94,3},
+        {0xE7,0x84,0x97,3}, {0xE7,0x84,0x9B,3}, {0xE7,0x84,0x9C,3}, {0xE7,0x84,0x9D,3}, {0xE7,0x84,0x9E,3}, {0xE7,0x84,0x9F,3}, {0xE7,0x84,0xA0,3}, {0xE7,0x84,0xA1,3},
+        {0xE7,0x84,0xA2,3}, {0xE7,0x84,0xA3,3}, {0xE7,0x84,0xA4,3}, {0xE7,0x84,0xA5,3}, {0xE7,0x84,0xA7,3}, {0xE7,0x84,0xA8,3}, {0xE7,0x84,0xA9,3}, {0xE7,0x84,0xAA,3},
+        {0xE7,0x84,0xAB,3}, {0xE7,0x84,0xAC,3}, {0xE7,0x84,0xAD,3}, {0xE7,0x84,0xAE,3}, {0xE7,0x84,0xB2,3}, {0xE7,0x84,0xB3,3}, {0xE7,0x84,0xB4,3}, {0xE7,0x84,0xB5,3},
+        {0xE7,0x84,0xB7,3}, {0xE7,0x84,0xB8,3}, {0xE7,0x84,0xB9,3}, {0xE7,0x84,0xBA,3}, {0xE7,0x84,0xBB,3}, {0xE7,0x84,0xBC,3}, {0xE7,0x84,0xBD,3}, {0xE7,0x84,0xBE,3},
+        {0xE7,0x84,0xBF,3}, {0xE7,0x85,0x80,3}, {0xE7,0x85,0x81,3}, {0xE7,0x85,0x82,3}, {0xE7,0x85,0x83,3}, {0xE7,0x85,0x84,3}, {0xE7,0x85,0x86,3}, {0xE7,0x85,0x87,3},
+        {0xE7,0x85,0x88,3}, {0xE7,0x85,0x89,3}, {0xE7,0x85,0x8B,3}, {0xE7,0x85,0x8D,3}, {0xE7,0x85,0x8F,3}, {0xE7,0x85,0x90,3}, {0xE7,0x85,0x91,3}, {0xE7,0x85,0x92,3},
+        {0xE7,0x85,0x93,3}, {0xE7,0x85,0x94,3}, {0xE7,0x85,0x95,3}, {0xE7,0x85,0x96,3}, {0xE7,0x85,0x97,3}, {0xE7,0x85,0x98,3}, {0xE7,0x85,0x99,3}, {0xE7,0x85,0x9A,3},
+        {0xE7,0x85,0x9B,3}, {0xE7,0x85,0x9D,3}, {0xE7,0x85,0x9F,3}, {0xE7,0x85,0xA0,3}, {0xE7,0x85,0xA1,3}, {0xE7,0x85,0xA2,3}, {0xE7,0x85,0xA3,3}, {0xE7,0x85,0xA5,3},
+        {0xE7,0x85,0xA9,3}, {0xE7,0x85,0xAA,3}, {0xE7,0x85,0xAB,3}, {0xE7,0x85,0xAC,3}, {0xE7,0x85,0xAD,3}, {0xE7,0x85,0xAF,3}, {0xE7,0x85,0xB0,3}, {0xE7,0x85,0xB1,3},
+        {0xE7,0x85,0xB4,3}, {0xE7,0x85,0xB5,3}, {0xE7,0x85,0xB6,3}, {0xE7,0x85,0xB7,3}, {0xE7,0x85,0xB9,3}, {0xE7,0x85,0xBB,3}, {0xE7,0x85,0xBC,3}, {0xE7,0x85,0xBE,3},
+        {0xE7,0x85,0xBF,3}, {0xE7,0x86,0x80,3}, {0xE7,0x86,0x81,3}, {0xE7,0x86,0x82,3}, {0xE7,0x86,0x83,3}, {0xE7,0x86,0x85,3}, {0xE7,0x86,0x86,3}, {0xE7,0x86,0x87,3},
+        {0xE7,0x86,0x88,3}, {0xE7,0x86,0x89,3}, {0xE7,0x86,0x8B,3}, {0xE7,0x86,0x8C,3}, {0xE7,0x86,0x8D,3}, {0xE7,0x86,0x8E,3}, {0xE7,0x86,0x90,3}, {0xE7,0x86,0x91,3},
+        {0xE7,0x86,0x92,3}, {0xE7,0x86,0x93,3}, {0xE7,0x86,0x95,3}, {0xE7,0x86,0x96,3}, {0xE7,0x86,0x97,3}, {0xE7,0x86,0x9A,3}, {0xE7,0x86,0x9B,3}, {0xE7,0x86,0x9C,3},
+        {0xE7,0x86,0x9D,3}, {0xE7,0x86,0x9E,3}, {0xE7,0x86,0xA1,3}, {0xE7,0x86,0xA2,3}, {0xE7,0x86,0xA3,3}, {0xE7,0x86,0xA4,3}, {0xE7,0x86,0xA5,3}, {0xE7,0x86,0xA6,3},
+        {0xE7,0x86,0xA7,3}, {0xE7,0x86,0xA9,3}, {0xE7,0x86,0xAA,3}, {0xE7,0x86,0xAB,3}, {0xE7,0x86,0xAD,3}, {0xE7,0x86,0xAE,3}, {0xE7,0x86,0xAF,3}, {0xE7,0x86,0xB0,3},
+        {0xE7,0x86,0xB1,3}, {0xE7,0x86,0xB2,3}, {0xE7,0x86,0xB4,3}, {0xE7,0x86,0xB6,3}, {0xE7,0x86,0xB7,3}, {0xE7,0x86,0xB8,3}, {0xE7,0x86,0xBA,3}, {0xE7,0x86,0xBB,3},
+        {0xE7,0x86,0xBC,3}, {0xE7,0x86,0xBD,3}, {0xE7,0x86,0xBE,3}, {0xE7,0x86,0xBF,3}, {0xE7,0x87,0x80,3}, {0xE7,0x87,0x81,3}, {0xE7,0x87,0x82,3}, {0xE7,0x87,0x84,3},
+        {0xE7,0x87,0x85,3}, {0xE7,0x87,0x86,3}, {0xE7,0x87,0x87,3}, {0xE7,0x87,0x88,3}, {0xE7,0x87,0x89,3}, {0xE7,0x87,0x8A,3}, {0xE7,0x87,0x8B,3}, {0xE7,0x87,0x8C,3},
+        {0xE7,0x87,0x8D,3}, {0xE7,0x87,0x8F,3}, {0xE7,0x87,0x90,3}, {0xE7,0x87,0x91,3}, {0xE7,0x87,0x92,3}, {0xE7,0x87,0x93,3},
+    },
+    /* 0xA0 */ {
+        {0xE7,0x87,0x96,3}, {0xE7,0x87,0x97,3}, {0xE7,0x87,0x98,3}, {0xE7,0x87,0x99,3}, {0xE7,0x87,0x9A,3}, {0xE7,0x87,0x9B,3}, {0xE7,0x87,0x9C,3}, {0xE7,0x87,0x9D,3},
+        {0xE7,0x87,0x9E,3}, {0xE7,0x87,0x9F,3}, {0xE7,0x87,0xA1,3}, {0xE7,0x87,0xA2,3}, {0xE7,0x87,0xA3,3}, {0xE7,0x87,0xA4,3}, {0xE7,0x87,0xA6,3}, {0xE7,0x87,0xA8,3},
+        {0xE7,0x87,0xA9,3}, {0xE7,0x87,0xAA,3}, {0xE7,0x87,0xAB,3}, {0xE7,0x87,0xAC,3}, {0xE7,0x87,0xAD,3}, {0xE7,0x87,0xAF,3}, {0xE7,0x87,0xB0,3}, {0xE7,0x87,0xB1,3},
+        {0xE7,0x87,0xB2,3}, {0xE7,0x87,0xB3,3}, {0xE7,0x87,0xB4,3}, {0xE7,0x87,0xB5,3}, {0xE7,0x87,0xB6,3}, {0xE7,0x87,0xB7,3}, {0xE7,0x87,0xB8,3}, {0xE7,0x87,0xBA,3},
+        {0xE7,0x87,0xBB,3}, {0xE7,0x87,0xBC,3}, {0xE7,0x87,0xBD,3}, {0xE7,0x87,0xBE,3}, {0xE7,0x87,0xBF,3}, {0xE7,0x88,0x80,3}, {0xE7,0x88,0x81,3}, {0xE7,0x88,0x82,3},
+        {0xE7,0x88,0x83,3}, {0xE7,0x88,0x84,3}, {0xE7,0x88,0x85,3}, {0xE7,0x88,0x87,3}, {0xE7,0x88,0x88,3}, {0xE7,0x88,0x89,3}, {0xE7,0x88,0x8A,3}, {0xE7,0x88,0x8B,3},
+        {0xE7,0x88,0x8C,3}, {0xE7,0x88,0x8D,3}, {0xE7,0x88,0x8E,3}, {0xE7,0x88,0x8F,3}, {0xE7,0x88,0x90,3}, {0xE7,0x88,0x91,3}, {0xE7,0x88,0x92,3}, {0xE7,0x88,0x93,3},
+        {0xE7,0x88,0x94,3}, {0xE7,0x88,0x95,3}, {0xE7,0x88,0x96,3}, {0xE7,0x88,0x97,3}, {0xE7,0x88,0x98,3}, {0xE7,0x88,0x99,3}, {0xE7,0x88,0x9A,3}, {0xE7,0x88,0x9B,3},
+        {0xE7,0x88,0x9C,3}, {0xE7,0x88,0x9E,3}, {0xE7,0x88,0x9F,3}, {0xE7,0x88,0xA0,3}, {0xE7,0x88,0xA1,3}, {0xE7,0x88,0xA2,3}, {0xE7,0x88,0xA3,3}, {0xE7,0x88,0xA4,3},
+        {0xE7,0x88,0xA5,3}, {0xE7,0x88,0xA6,3}, {0xE7,0x88,0xA7,3}, {0xE7,0x88,0xA9,3}, {0xE7,0x88,0xAB,3}, {0xE7,0x88,0xAD,3}, {0xE7,0x88,0xAE,3}, {0xE7,0x88,0xAF,3},
+        {0xE7,0x88,0xB2,3}, {0xE7,0x88,0xB3,3}, {0xE7,0x88,0xB4,3}, {0xE7,0x88,0xBA,3}, {0xE7,0x88,0xBC,3}, {0xE7,0x88,0xBE,3}, {0xE7,0x89,0x80,3}, {0xE7,0x89,0x81,3},
+        {0xE7,0x89,0x82,3}, {0xE7,0x89,0x83,3}, {0xE7,0x89,0x84,3}, {0xE7,0x89,0x85,3}, {0xE7,0x89,0x86,3}, {0xE7,0x89,0x89,3}, {0xE7,0x89,0x8A,3}, {0xE7,0x89,0x8B,3},
+        {0xE7,0x89,0x8E,3}, {0xE7,0x89,0x8F,3}, {0xE7,0x89,0x90,3}, {0xE7,0x89,0x91,3}, {0xE7,0x89,0x93,3}, {0xE7,0x89,0x94,3}, {0xE7,0x89,0x95,3}, {0xE7,0x89,0x97,3},
+        {0xE7,0x89,0x98,3}, {0xE7,0x89,0x9A,3}, {0xE7,0x89,0x9C,3}, {0xE7,0x89,0x9E,3}, {0xE7,0x89,0xA0,3}, {0xE7,0x89,0xA3,3}, {0xE7,0x89,0xA4,3}, {0xE7,0x89,0xA5,3},
+        {0xE7,0x89,0xA8,3}, {0xE7,0x89,0xAA,3}, {0xE7,0x89,0xAB,3}, {0xE7,0x89,0xAC,3}, {0xE7,0x89,0xAD,3}, {0xE7,0x89,0xB0,3}, {0xE7,0x89,0xB1,3}, {0xE7,0x89,0xB3,3},
+        {0xE7,0x89,0xB4,3}, {0xE7,0x89,0xB6,3}, {0xE7,0x89,0xB7,3}, {0xE7,0x89,0xB8,3}, {0xE7,0x89,0xBB,3}, {0xE7,0x89,0xBC,3}, {0xE7,0x89,0xBD,3}, {0xE7,0x8A,0x82,3},
+        {0xE7,0x8A,0x83,3}, {0xE7,0x8A,0x85,3}, {0xE7,0x8A,0x86,3}, {0xE7,0x8A,0x87,3}, {0xE7,0x8A,0x88,3}, {0xE7,0x8A,0x89,3}, {0xE7,0x8A,0x8C,3}, {0xE7,0x8A,0x8E,3},
+        {0xE7,0x8A,0x90,3}, {0xE7,0x8A,0x91,3}, {0xE7,0x8A,0x93,3}, {0xE7,0x8A,0x94,3}, {0xE7,0x8A,0x95,3}, {0xE7,0x8A,0x96,3}, {0xE7,0x8A,0x97,3}, {0xE7,0x8A,0x98,3},
+        {0xE7,0x8A,0x99,3}, {0xE7,0x8A,0x9A,3}, {0xE7,0x8A,0x9B,3}, {0xE7,0x8A,0x9C,3}, {0xE7,0x8A,0x9D,3}, {0xE7,0x8A,0x9E,3}, {0xE7,0x8A,0xA0,3}, {0xE7,0x8A,0xA1,3},
+        {0xE7,0x8A,0xA2,3}, {0xE7,0x8A,0xA3,3}, {0xE7,0x8A,0xA4,3}, {0xE7,0x8A,0xA5,3}, {0xE7,0x8A,0xA6,3}, {0xE7,0x8A,0xA7,3}, {0xE7,0x8A,0xA8,3}, {0xE7,0x8A,0xA9,3},
+        {0xE7,0x8A,0xAA,3}, {0xE7,0x8A,0xAB,3}, {0xE7,0x8A,0xAE,3}, {0xE7,0x8A,0xB1,3}, {0xE7,0x8A,0xB2,3}, {0xE7,0x8A,0xB3,3}, {0xE7,0x8A,0xB5,3}, {0xE7,0x8A,0xBA,3},
+        {0xE7,0x8A,0xBB,3}, {0xE7,0x8A,0xBC,3}, {0xE7,0x8A,0xBD,3}, {0xE7,0x8A,0xBE,3}, {0xE7,0x8A,0xBF,3}, {0xE7,0x8B,0x80,3}, {0xE7,0x8B,0x85,3}, {0xE7,0x8B,0x86,3},
+        {0xE7,0x8B,0x87,3}, {0xE7,0x8B,0x89,3}, {0xE7,0x8B,0x8A,3}, {0xE7,0x8B,0x8B,3}, {0xE7,0x8B,0x8C,3}, {0xE7,0x8B,0x8F,3}, {0xE7,0x8B,0x91,3}, {0xE7,0x8B,0x93,3},
+        {0xE7,0x8B,0x94,3}, {0xE7,0x8B,0x95,3}, {0xE7,0x8B,0x96,3}, {0xE7,0x8B,0x98,3}, {0xE7,0x8B,0x9A,3}, {0xE7,0x8B,0x9B,3},
+    },
+    /* 0xA1 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE3,0x80,0x80,3}, {0xE3,0x80,0x81,3}, {0xE3,0x80,0x82,3}, {0xC2,0xB7,0x00,2}, {0xCB,0x89,0x00,2}, {0xCB,0x87,0x00,2}, {0xC2,0xA8,0x00,2}, {0xE3,0x80,0x83,3},
+        {0xE3,0x80,0x85,3}, {0xE2,0x80,0x94,3}, {0xEF,0xBD,0x9E,3}, {0xE2,0x80,0x96,3}, {0xE2,0x80,0xA6,3}, {0xE2,0x80,0x98,3}, {0xE2,0x80,0x99,3}, {0xE2,0x80,0x9C,3},
+        {0xE2,0x80,0x9D,3}, {0xE3,0x80,0x94,3}, {0xE3,0x80,0x95,3}, {0xE3,0x80,0x88,3}, {0xE3,0x80,0x89,3}, {0xE3,0x80,0x8A,3}, {0xE3,0x80,0x8B,3}, {0xE3,0x80,0x8C,3},
+        {0xE3,0x80,0x8D,3}, {0xE3,0x80,0x8E,3}, {0xE3,0x80,0x8F,3}, {0xE3,0x80,0x96,3}, {0xE3,0x80,0x97,3}, {0xE3,0x80,0x90,3}, {0xE3,0x80,0x91,3}, {0xC2,0xB1,0x00,2},
+        {0xC3,0x97,0x00,2}, {0xC3,0xB7,0x00,2}, {0xE2,0x88,0xB6,3}, {0xE2,0x88,0xA7,3}, {0xE2,0x88,0xA8,3}, {0xE2,0x88,0x91,3}, {0xE2,0x88,0x8F,3}, {0xE2,0x88,0xAA,3},
+        {0xE2,0x88,0xA9,3}, {0xE2,0x88,0x88,3}, {0xE2,0x88,0xB7,3}, {0xE2,0x88,0x9A,3}, {0xE2,0x8A,0xA5,3}, {0xE2,0x88,0xA5,3}, {0xE2,0x88,0xA0,3}, {0xE2,0x8C,0x92,3},
+        {0xE2,0x8A,0x99,3}, {0xE2,0x88,0xAB,3}, {0xE2,0x88,0xAE,3}, {0xE2,0x89,0xA1,3}, {0xE2,0x89,0x8C,3}, {0xE2,0x89,0x88,3}, {0xE2,0x88,0xBD,3}, {0xE2,0x88,0x9D,3},
+        {0xE2,0x89,0xA0,3}, {0xE2,0x89,0xAE,3}, {0xE2,0x89,0xAF,3}, {0xE2,0x89,0xA4,3}, {0xE2,0x89,0xA5,3}, {0xE2,0x88,0x9E,3}, {0xE2,0x88,0xB5,3}, {0xE2,0x88,0xB4,3},
+        {0xE2,0x99,0x82,3}, {0xE2,0x99,0x80,3}, {0xC2,0xB0,0x00,2}, {0xE2,0x80,0xB2,3}, {0xE2,0x80,0xB3,3}, {0xE2,0x84,0x83,3}, {0xEF,0xBC,0x84,3}, {0xC2,0xA4,0x00,2},
+        {0xEF,0xBF,0xA0,3}, {0xEF,0xBF,0xA1,3}, {0xE2,0x80,0xB0,3}, {0xC2,0xA7,0x00,2}, {0xE2,0x84,0x96,3}, {0xE2,0x98,0x86,3}, {0xE2,0x98,0x85,3}, {0xE2,0x97,0x8B,3},
+        {0xE2,0x97,0x8F,3}, {0xE2,0x97,0x8E,3}, {0xE2,0x97,0x87,3}, {0xE2,0x97,0x86,3}, {0xE2,0x96,0xA1,3}, {0xE2,0x96,0xA0,3}, {0xE2,0x96,0xB3,3}, {0xE2,0x96,0xB2,3},
+        {0xE2,0x80,0xBB,3}, {0xE2,0x86,0x92,3}, {0xE2,0x86,0x90,3}, {0xE2,0x86,0x91,3}, {0xE2,0x86,0x93,3}, {0xE3,0x80,0x93,3},
+    },
+    /* 0xA2 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE2,0x85,0xB0,3}, {0xE2,0x85,0xB1,3}, {0xE2,0x85,0xB2,3}, {0xE2,0x85,0xB3,3}, {0xE2,0x85,0xB4,3}, {0xE2,0x85,0xB5,3}, {0xE2,0x85,0xB6,3}, {0xE2,0x85,0xB7,3},
+        {0xE2,0x85,0xB8,3}, {0xE2,0x85,0xB9,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE2,0x92,0x88,3}, {0xE2,0x92,0x89,3}, {0xE2,0x92,0x8A,3}, {0xE2,0x92,0x8B,3}, {0xE2,0x92,0x8C,3}, {0xE2,0x92,0x8D,3}, {0xE2,0x92,0x8E,3}, {0xE2,0x92,0x8F,3},
+        {0xE2,0x92,0x90,3}, {0xE2,0x92,0x91,3}, {0xE2,0x92,0x92,3}, {0xE2,0x92,0x93,3}, {0xE2,0x92,0x94,3}, {0xE2,0x92,0x95,3}, {0xE2,0x92,0x96,3}, {0xE2,0x92,0x97,3},
+        {0xE2,0x92,0x98,3}, {0xE2,0x92,0x99,3}, {0xE2,0x92,0x9A,3}, {0xE2,0x92,0x9B,3}, {0xE2,0x91,0xB4,3}, {0xE2,0x91,0xB5,3}, {0xE2,0x91,0xB6,3}, {0xE2,0x91,0xB7,3},
+        {0xE2,0x91,0xB8,3}, {0xE2,0x91,0xB9,3}, {0xE2,0x91,0xBA,3}, {0xE2,0x91,0xBB,3}, {0xE2,0x91,0xBC,3}, {0xE2,0x91,0xBD,3}, {0xE2,0x91,0xBE,3}, {0xE2,0x91,0xBF,3},
+        {0xE2,0x92,0x80,3}, {0xE2,0x92,0x81,3}, {0xE2,0x92,0x82,3}, {0xE2,0x92,0x83,3}, {0xE2,0x92,0x84,3}, {0xE2,0x92,0x85,3}, {0xE2,0x92,0x86,3}, {0xE2,0x92,0x87,3},
+        {0xE2,0x91,0xA0,3}, {0xE2,0x91,0xA1,3}, {0xE2,0x91,0xA2,3}, {0xE2,0x91,0xA3,3}, {0xE2,0x91,0xA4,3}, {0xE2,0x91,0xA5,3}, {0xE2,0x91,0xA6,3}, {0xE2,0x91,0xA7,3},
+        {0xE2,0x91,0xA8,3}, {0xE2,0x91,0xA9,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xE3,0x88,0xA0,3}, {0xE3,0x88,0xA1,3}, {0xE3,0x88,0xA2,3}, {0xE3,0x88,0xA3,3},
+        {0xE3,0x88,0xA4,3}, {0xE3,0x88,0xA5,3}, {0xE3,0x88,0xA6,3}, {0xE3,0x88,0xA7,3}, {0xE3,0x88,0xA8,3}, {0xE3,0x88,0xA9,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE2,0x85,0xA0,3}, {0xE2,0x85,0xA1,3}, {0xE2,0x85,0xA2,3}, {0xE2,0x85,0xA3,3}, {0xE2,0x85,0xA4,3}, {0xE2,0x85,0xA5,3}, {0xE2,0x85,0xA6,3}, {0xE2,0x85,0xA7,3},
+        {0xE2,0x85,0xA8,3}, {0xE2,0x85,0xA9,3}, {0xE2,0x85,0xAA,3}, {0xE2,0x85,0xAB,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA3 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBC,0x81,3}, {0xEF,0xBC,0x82,3}, {0xEF,0xBC,0x83,3}, {0xEF,0xBF,0xA5,3}, {0xEF,0xBC,0x85,3}, {0xEF,0xBC,0x86,3}, {0xEF,0xBC,0x87,3}, {0xEF,0xBC,0x88,3},
+        {0xEF,0xBC,0x89,3}, {0xEF,0xBC,0x8A,3}, {0xEF,0xBC,0x8B,3}, {0xEF,0xBC,0x8C,3}, {0xEF,0xBC,0x8D,3}, {0xEF,0xBC,0x8E,3}, {0xEF,0xBC,0x8F,3}, {0xEF,0xBC,0x90,3},
+        {0xEF,0xBC,0x91,3}, {0xEF,0xBC,0x92,3}, {0xEF,0xBC,0x93,3}, {0xEF,0xBC,0x94,3}, {0xEF,0xBC,0x95,3}, {0xEF,0xBC,0x96,3}, {0xEF,0xBC,0x97,3}, {0xEF,0xBC,0x98,3},
+        {0xEF,0xBC,0x99,3}, {0xEF,0xBC,0x9A,3}, {0xEF,0xBC,0x9B,3}, {0xEF,0xBC,0x9C,3}, {0xEF,0xBC,0x9D,3}, {0xEF,0xBC,0x9E,3}, {0xEF,0xBC,0x9F,3}, {0xEF,0xBC,0xA0,3},
+        {0xEF,0xBC,0xA1,3}, {0xEF,0xBC,0xA2,3}, {0xEF,0xBC,0xA3,3}, {0xEF,0xBC,0xA4,3}, {0xEF,0xBC,0xA5,3}, {0xEF,0xBC,0xA6,3}, {0xEF,0xBC,0xA7,3}, {0xEF,0xBC,0xA8,3},
+        {0xEF,0xBC,0xA9,3}, {0xEF,0xBC,0xAA,3}, {0xEF,0xBC,0xAB,3}, {0xEF,0xBC,0xAC,3}, {0xEF,0xBC,0xAD,3}, {0xEF,0xBC,0xAE,3}, {0xEF,0xBC,0xAF,3}, {0xEF,0xBC,0xB0,3},
+        {0xEF,0xBC,0xB1,3}, {0xEF,0xBC,0xB2,3}, {0xEF,0xBC,0xB3,3}, {0xEF,0xBC,0xB4,3}, {0xEF,0xBC,0xB5,3}, {0xEF,0xBC,0xB6,3}, {0xEF,0xBC,0xB7,3}, {0xEF,0xBC,0xB8,3},
+        {0xEF,0xBC,0xB9,3}, {0xEF,0xBC,0xBA,3}, {0xEF,0xBC,0xBB,3}, {0xEF,0xBC,0xBC,3}, {0xEF,0xBC,0xBD,3}, {0xEF,0xBC,0xBE,3}, {0xEF,0xBC,0xBF,3}, {0xEF,0xBD,0x80,3},
+        {0xEF,0xBD,0x81,3}, {0xEF,0xBD,0x82,3}, {0xEF,0xBD,0x83,3}, {0xEF,0xBD,0x84,3}, {0xEF,0xBD,0x85,3}, {0xEF,0xBD,0x86,3}, {0xEF,0xBD,0x87,3}, {0xEF,0xBD,0x88,3},
+        {0xEF,0xBD,0x89,3}, {0xEF,0xBD,0x8A,3}, {0xEF,0xBD,0x8B,3}, {0xEF,0xBD,0x8C,3}, {0xEF,0xBD,0x8D,3}, {0xEF,0xBD,0x8E,3}, {0xEF,0xBD,0x8F,3}, {0xEF,0xBD,0x90,3},
+        {0xEF,0xBD,0x91,3}, {0xEF,0xBD,0x92,3}, {0xEF,0xBD,0x93,3}, {0xEF,0xBD,0x94,3}, {0xEF,0xBD,0x95,3}, {0xEF,0xBD,0x96,3}, {0xEF,0xBD,0x97,3}, {0xEF,0xBD,0x98,3},
+        {0xEF,0xBD,0x99,3}, {0xEF,0xBD,0x9A,3}, {0xEF,0xBD,0x9B,3}, {0xEF,0xBD,0x9C,3}, {0xEF,0xBD,0x9D,3}, {0xEF,0xBF,0xA3,3},
+    },
+    /* 0xA4 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE3,0x81,0x81,3}, {0xE3,0x81,0x82,3}, {0xE3,0x81,0x83,3}, {0xE3,0x81,0x84,3}, {0xE3,0x81,0x85,3}, {0xE3,0x81,0x86,3}, {0xE3,0x81,0x87,3}, {0xE3,0x81,0x88,3},
+        {0xE3,0x81,0x89,3}, {0xE3,0x81,0x8A,3}, {0xE3,0x81,0x8B,3}, {0xE3,0x81,0x8C,3}, {0xE3,0x81,0x8D,3}, {0xE3,0x81,0x8E,3}, {0xE3,0x81,0x8F,3}, {0xE3,0x81,0x90,3},
+        {0xE3,0x81,0x91,3}, {0xE3,0x81,0x92,3}, {0xE3,0x81,0x93,3}, {0xE3,0x81,0x94,3}, {0xE3,0x81,0x95,3}, {0xE3,0x81,0x96,3}, {0xE3,0x81,0x97,3}, {0xE3,0x81,0x98,3},
+        {0xE3,0x81,0x99,3}, {0xE3,0x81,0x9A,3}, {0xE3,0x81,0x9B,3}, {0xE3,0x81,0x9C,3}, {0xE3,0x81,0x9D,3}, {0xE3,0x81,0x9E,3}, {0xE3,0x81,0x9F,3}, {0xE3,0x81,0xA0,3},
+        {0xE3,0x81,0xA1,3}, {0xE3,0x81,0xA2,3}, {0xE3,0x81,0xA3,3}, {0xE3,0x81,0xA4,3}, {0xE3,0x81,0xA5,3}, {0xE3,0x81,0xA6,3}, {0xE3,0x81,0xA7,3}, {0xE3,0x81,0xA8,3},
+        {0xE3,0x81,0xA9,3}, {0xE3,0x81,0xAA,3}, {0xE3,0x81,0xAB,3}, {0xE3,0x81,0xAC,3}, {0xE3,0x81,0xAD,3}, {0xE3,0x81,0xAE,3}, {0xE3,0x81,0xAF,3}, {0xE3,0x81,0xB0,3},
+        {0xE3,0x81,0xB1,3}, {0xE3,0x81,0xB2,3}, {0xE3,0x81,0xB3,3}, {0xE3,0x81,0xB4,3}, {0xE3,0x81,0xB5,3}, {0xE3,0x81,0xB6,3}, {0xE3,0x81,0xB7,3}, {0xE3,0x81,0xB8,3},
+        {0xE3,0x81,0xB9,3}, {0xE3,0x81,0xBA,3}, {0xE3,0x81,0xBB,3}, {0xE3,0x81,0xBC,3}, {0xE3,0x81,0xBD,3}, {0xE3,0x81,0xBE,3}, {0xE3,0x81,0xBF,3}, {0xE3,0x82,0x80,3},
+        {0xE3,0x82,0x81,3}, {0xE3,0x82,0x82,3}, {0xE3,0x82,0x83,3}, {0xE3,0x82,0x84,3}, {0xE3,0x82,0x85,3}, {0xE3,0x82,0x86,3}, {0xE3,0x82,0x87,3}, {0xE3,0x82,0x88,3},
+        {0xE3,0x82,0x89,3}, {0xE3,0x82,0x8A,3}, {0xE3,0x82,0x8B,3}, {0xE3,0x82,0x8C,3}, {0xE3,0x82,0x8D,3}, {0xE3,0x82,0x8E,3}, {0xE3,0x82,0x8F,3}, {0xE3,0x82,0x90,3},
+        {0xE3,0x82,0x91,3}, {0xE3,0x82,0x92,3}, {0xE3,0x82,0x93,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA5 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE3,0x82,0xA1,3}, {0xE3,0x82,0xA2,3}, {0xE3,0x82,0xA3,3}, {0xE3,0x82,0xA4,3}, {0xE3,0x82,0xA5,3}, {0xE3,0x82,0xA6,3}, {0xE3,0x82,0xA7,3}, {0xE3,0x82,0xA8,3},
+        {0xE3,0x82,0xA9,3}, {0xE3,0x82,0xAA,3}, {0xE3,0x82,0xAB,3}, {0xE3,0x82,0xAC,3}, {0xE3,0x82,0xAD,3}, {0xE3,0x82,0xAE,3}, {0xE3,0x82,0xAF,3}, {0xE3,0x82,0xB0,3},
+        {0xE3,0x82,0xB1,3}, {0xE3,0x82,0xB2,3}, {0xE3,0x82,0xB3,3}, {0xE3,0x82,0xB4,3}, {0xE3,0x82,0xB5,3}, {0xE3,0x82,0xB6,3}, {0xE3,0x82,0xB7,3}, {0xE3,0x82,0xB8,3},
+        {0xE3,0x82,0xB9,3}, {0xE3,0x82,0xBA,3}, {0xE3,0x82,0xBB,3}, {0xE3,0x82,0xBC,3}, {0xE3,0x82,0xBD,3}, {0xE3,0x82,0xBE,3}, {0xE3,0x82,0xBF,3}, {0xE3,0x83,0x80,3},
+        {0xE3,0x83,0x81,3}, {0xE3,0x83,0x82,3}, {0xE3,0x83,0x83,3}, {0xE3,0x83,0x84,3}, {0xE3,0x83,0x85,3}, {0xE3,0x83,0x86,3}, {0xE3,0x83,0x87,3}, {0xE3,0x83,0x88,3},
+        {0xE3,0x83,0x89,3}, {0xE3,0x83,0x8A,3}, {0xE3,0x83,0x8B,3}, {0xE3,0x83,0x8C,3}, {0xE3,0x83,0x8D,3}, {0xE3,0x83,0x8E,3}, {0xE3,0x83,0x8F,3}, {0xE3,0x83,0x90,3},
+        {0xE3,0x83,0x91,3}, {0xE3,0x83,0x92,3}, {0xE3,0x83,0x93,3}, {0xE3,0x83,0x94,3}, {0xE3,0x83,0x95,3}, {0xE3,0x83,0x96,3}, {0xE3,0x83,0x97,3}, {0xE3,0x83,0x98,3},
+        {0xE3,0x83,0x99,3}, {0xE3,0x83,0x9A,3}, {0xE3,0x83,0x9B,3}, {0xE3,0x83,0x9C,3}, {0xE3,0x83,0x9D,3}, {0xE3,0x83,0x9E,3}, {0xE3,0x83,0x9F,3}, {0xE3,0x83,0xA0,3},
+        {0xE3,0x83,0xA1,3}, {0xE3,0x83,0xA2,3}, {0xE3,0x83,0xA3,3}, {0xE3,0x83,0xA4,3}, {0xE3,0x83,0xA5,3}, {0xE3,0x83,0xA6,3}, {0xE3,0x83,0xA7,3}, {0xE3,0x83,0xA8,3},
+        {0xE3,0x83,0xA9,3}, {0xE3,0x83,0xAA,3}, {0xE3,0x83,0xAB,3}, {0xE3,0x83,0xAC,3}, {0xE3,0x83,0xAD,3}, {0xE3,0x83,0xAE,3}, {0xE3,0x83,0xAF,3}, {0xE3,0x83,0xB0,3},
+        {0xE3,0x83,0xB1,3}, {0xE3,0x83,0xB2,3}, {0xE3,0x83,0xB3,3}, {0xE3,0x83,0xB4,3}, {0xE3,0x83,0xB5,3}, {0xE3,0x83,0xB6,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA6 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xCE,0x91,0x00,2}, {0xCE,0x92,0x00,2}, {0xCE,0x93,0x00,2}, {0xCE,0x94,0x00,2}, {0xCE,0x95,0x00,2}, {0xCE,0x96,0x00,2}, {0xCE,0x97,0x00,2}, {0xCE,0x98,0x00,2},
+        {0xCE,0x99,0x00,2}, {0xCE,0x9A,0x00,2}, {0xCE,0x9B,0x00,2}, {0xCE,0x9C,0x00,2}, {0xCE,0x9D,0x00,2}, {0xCE,0x9E,0x00,2}, {0xCE,0x9F,0x00,2}, {0xCE,0xA0,0x00,2},
+        {0xCE,0xA1,0x00,2}, {0xCE,0xA3,0x00,2}, {0xCE,0xA4,0x00,2}, {0xCE,0xA5,0x00,2}, {0xCE,0xA6,0x00,2}, {0xCE,0xA7,0x00,2}, {0xCE,0xA8,0x00,2}, {0xCE,0xA9,0x00,2},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xCE,0xB1,0x00,2}, {0xCE,0xB2,0x00,2}, {0xCE,0xB3,0x00,2}, {0xCE,0xB4,0x00,2}, {0xCE,0xB5,0x00,2}, {0xCE,0xB6,0x00,2}, {0xCE,0xB7,0x00,2}, {0xCE,0xB8,0x00,2},
+        {0xCE,0xB9,0x00,2}, {0xCE,0xBA,0x00,2}, {0xCE,0xBB,0x00,2}, {0xCE,0xBC,0x00,2}, {0xCE,0xBD,0x00,2}, {0xCE,0xBE,0x00,2}, {0xCE,0xBF,0x00,2}, {0xCF,0x80,0x00,2},
+        {0xCF,0x81,0x00,2}, {0xCF,0x83,0x00,2}, {0xCF,0x84,0x00,2}, {0xCF,0x85,0x00,2}, {0xCF,0x86,0x00,2}, {0xCF,0x87,0x00,2}, {0xCF,0x88,0x00,2}, {0xCF,0x89,0x00,2},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xB8,0xB5,3},
+        {0xEF,0xB8,0xB6,3}, {0xEF,0xB8,0xB9,3}, {0xEF,0xB8,0xBA,3}, {0xEF,0xB8,0xBF,3}, {0xEF,0xB9,0x80,3}, {0xEF,0xB8,0xBD,3}, {0xEF,0xB8,0xBE,3}, {0xEF,0xB9,0x81,3},
+        {0xEF,0xB9,0x82,3}, {0xEF,0xB9,0x83,3}, {0xEF,0xB9,0x84,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xB8,0xBB,3}, {0xEF,0xB8,0xBC,3}, {0xEF,0xB8,0xB7,3},
+        {0xEF,0xB8,0xB8,3}, {0xEF,0xB8,0xB1,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xB8,0xB3,3}, {0xEF,0xB8,0xB4,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA7 */ {
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xD0,0x90,0x00,2}, {0xD0,0x91,0x00,2}, {0xD0,0x92,0x00,2}, {0xD0,0x93,0x00,2}, {0xD0,0x94,0x00,2}, {0xD0,0x95,0x00,2}, {0xD0,0x81,0x00,2}, {0xD0,0x96,0x00,2},
+        {0xD0,0x97,0x00,2}, {0xD0,0x98,0x00,2}, {0xD0,0x99,0x00,2}, {0xD0,0x9A,0x00,2}, {0xD0,0x9B,0x00,2}, {0xD0,0x9C,0x00,2}, {0xD0,0x9D,0x00,2}, {0xD0,0x9E,0x00,2},
+        {0xD0,0x9F,0x00,2}, {0xD0,0xA0,0x00,2}, {0xD0,0xA1,0x00,2}, {0xD0,0xA2,0x00,2}, {0xD0,0xA3,0x00,2}, {0xD0,0xA4,0x00,2}, {0xD0,0xA5,0x00,2}, {0xD0,0xA6,0x00,2},
+        {0xD0,0xA7,0x00,2}, {0xD0,0xA8,0x00,2}, {0xD0,0xA9,0x00,2}, {0xD0,0xAA,0x00,2}, {0xD0,0xAB,0x00,2}, {0xD0,0xAC,0x00,2}, {0xD0,0xAD,0x00,2}, {0xD0,0xAE,0x00,2},
+        {0xD0,0xAF,0x00,2}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xD0,0xB0,0x00,2}, {0xD0,0xB1,0x00,2}, {0xD0,0xB2,0x00,2}, {0xD0,0xB3,0x00,2}, {0xD0,0xB4,0x00,2}, {0xD0,0xB5,0x00,2}, {0xD1,0x91,0x00,2}, {0xD0,0xB6,0x00,2},
+        {0xD0,0xB7,0x00,2}, {0xD0,0xB8,0x00,2}, {0xD0,0xB9,0x00,2}, {0xD0,0xBA,0x00,2}, {0xD0,0xBB,0x00,2}, {0xD0,0xBC,0x00,2}, {0xD0,0xBD,0x00,2}, {0xD0,0xBE,0x00,2},
+        {0xD0,0xBF,0x00,2}, {0xD1,0x80,0x00,2}, {0xD1,0x81,0x00,2}, {0xD1,0x82,0x00,2}, {0xD1,0x83,0x00,2}, {0xD1,0x84,0x00,2}, {0xD1,0x85,0x00,2}, {0xD1,0x86,0x00,2},
+        {0xD1,0x87,0x00,2}, {0xD1,0x88,0x00,2}, {0xD1,0x89,0x00,2}, {0xD1,0x8A,0x00,2}, {0xD1,0x8B,0x00,2}, {0xD1,0x8C,0x00,2}, {0xD1,0x8D,0x00,2}, {0xD1,0x8E,0x00,2},
+        {0xD1,0x8F,0x00,2}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA8 */ {
+        {0xCB,0x8A,0x00,2}, {0xCB,0x8B,0x00,2}, {0xCB,0x99,0x00,2}, {0xE2,0x80,0x93,3}, {0xE2,0x80,0x95,3}, {0xE2,0x80,0xA5,3}, {0xE2,0x80,0xB5,3}, {0xE2,0x84,0x85,3},
+        {0xE2,0x84,0x89,3}, {0xE2,0x86,0x96,3}, {0xE2,0x86,0x97,3}, {0xE2,0x86,0x98,3}, {0xE2,0x86,0x99,3}, {0xE2,0x88,0x95,3}, {0xE2,0x88,0x9F,3}, {0xE2,0x88,0xA3,3},
+        {0xE2,0x89,0x92,3}, {0xE2,0x89,0xA6,3}, {0xE2,0x89,0xA7,3}, {0xE2,0x8A,0xBF,3}, {0xE2,0x95,0x90,3}, {0xE2,0x95,0x91,3}, {0xE2,0x95,0x92,3}, {0xE2,0x95,0x93,3},
+        {0xE2,0x95,0x94,3}, {0xE2,0x95,0x95,3}, {0xE2,0x95,0x96,3}, {0xE2,0x95,0x97,3}, {0xE2,0x95,0x98,3}, {0xE2,0x95,0x99,3}, {0xE2,0x95,0x9A,3}, {0xE2,0x95,0x9B,3},
+        {0xE2,0x95,0x9C,3}, {0xE2,0x95,0x9D,3}, {0xE2,0x95,0x9E,3}, {0xE2,0x95,0x9F,3}, {0xE2,0x95,0xA0,3}, {0xE2,0x95,0xA1,3}, {0xE2,0x95,0xA2,3}, {0xE2,0x95,0xA3,3},
+        {0xE2,0x95,0xA4,3}, {0xE2,0x95,0xA5,3}, {0xE2,0x95,0xA6,3}, {0xE2,0x95,0xA7,3}, {0xE2,0x95,0xA8,3}, {0xE2,0x95,0xA9,3}, {0xE2,0x95,0xAA,3}, {0xE2,0x95,0xAB,3},
+        {0xE2,0x95,0xAC,3}, {0xE2,0x95,0xAD,3}, {0xE2,0x95,0xAE,3}, {0xE2,0x95,0xAF,3}, {0xE2,0x95,0xB0,3}, {0xE2,0x95,0xB1,3}, {0xE2,0x95,0xB2,3}, {0xE2,0x95,0xB3,3},
+        {0xE2,0x96,0x81,3}, {0xE2,0x96,0x82,3}, {0xE2,0x96,0x83,3}, {0xE2,0x96,0x84,3}, {0xE2,0x96,0x85,3}, {0xE2,0x96,0x86,3}, {0xE2,0x96,0x87,3}, {0xE2,0x96,0x88,3},
+        {0xE2,0x96,0x89,3}, {0xE2,0x96,0x8A,3}, {0xE2,0x96,0x8B,3}, {0xE2,0x96,0x8C,3}, {0xE2,0x96,0x8D,3}, {0xE2,0x96,0x8E,3}, {0xE2,0x96,0x8F,3}, {0xE2,0x96,0x93,3},
+        {0xE2,0x96,0x94,3}, {0xE2,0x96,0x95,3}, {0xE2,0x96,0xBC,3}, {0xE2,0x96,0xBD,3}, {0xE2,0x97,0xA2,3}, {0xE2,0x97,0xA3,3}, {0xE2,0x97,0xA4,3}, {0xE2,0x97,0xA5,3},
+        {0xE2,0x98,0x89,3}, {0xE2,0x8A,0x95,3}, {0xE3,0x80,0x92,3}, {0xE3,0x80,0x9D,3}, {0xE3,0x80,0x9E,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xC4,0x81,0x00,2}, {0xC3,0xA1,0x00,2}, {0xC7,0x8E,0x00,2}, {0xC3,0xA0,0x00,2}, {0xC4,0x93,0x00,2}, {0xC3,0xA9,0x00,2}, {0xC4,0x9B,0x00,2}, {0xC3,0xA8,0x00,2},
+        {0xC4,0xAB,0x00,2}, {0xC3,0xAD,0x00,2}, {0xC7,0x90,0x00,2}, {0xC3,0xAC,0x00,2}, {0xC5,0x8D,0x00,2}, {0xC3,0xB3,0x00,2}, {0xC7,0x92,0x00,2}, {0xC3,0xB2,0x00,2},
+        {0xC5,0xAB,0x00,2}, {0xC3,0xBA,0x00,2}, {0xC7,0x94,0x00,2}, {0xC3,0xB9,0x00,2}, {0xC7,0x96,0x00,2}, {0xC7,0x98,0x00,2}, {0xC7,0x9A,0x00,2}, {0xC7,0x9C,0x00,2},
+        {0xC3,0xBC,0x00,2}, {0xC3,0xAA,0x00,2}, {0xC9,0x91,0x00,2}, {0xEF,0xBF,0xBD,3}, {0xC5,0x84,0x00,2}, {0xC5,0x88,0x00,2}, {0xEF,0xBF,0xBD,3}, {0xC9,0xA1,0x00,2},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xE3,0x84,0x85,3}, {0xE3,0x84,0x86,3}, {0xE3,0x84,0x87,3}, {0xE3,0x84,0x88,3},
+        {0xE3,0x84,0x89,3}, {0xE3,0x84,0x8A,3}, {0xE3,0x84,0x8B,3}, {0xE3,0x84,0x8C,3}, {0xE3,0x84,0x8D,3}, {0xE3,0x84,0x8E,3}, {0xE3,0x84,0x8F,3}, {0xE3,0x84,0x90,3},
+        {0xE3,0x84,0x91,3}, {0xE3,0x84,0x92,3}, {0xE3,0x84,0x93,3}, {0xE3,0x84,0x94,3}, {0xE3,0x84,0x95,3}, {0xE3,0x84,0x96,3}, {0xE3,0x84,0x97,3}, {0xE3,0x84,0x98,3},
+        {0xE3,0x84,0x99,3}, {0xE3,0x84,0x9A,3}, {0xE3,0x84,0x9B,3}, {0xE3,0x84,0x9C,3}, {0xE3,0x84,0x9D,3}, {0xE3,0x84,0x9E,3}, {0xE3,0x84,0x9F,3}, {0xE3,0x84,0xA0,3},
+        {0xE3,0x84,0xA1,3}, {0xE3,0x84,0xA2,3}, {0xE3,0x84,0xA3,3}, {0xE3,0x84,0xA4,3}, {0xE3,0x84,0xA5,3}, {0xE3,0x84,0xA6,3}, {0xE3,0x84,0xA7,3}, {0xE3,0x84,0xA8,3},
+        {0xE3,0x84,0xA9,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xA9 */ {
+        {0xE3,0x80,0xA1,3}, {0xE3,0x80,0xA2,3}, {0xE3,0x80,0xA3,3}, {0xE3,0x80,0xA4,3}, {0xE3,0x80,0xA5,3}, {0xE3,0x80,0xA6,3}, {0xE3,0x80,0xA7,3}, {0xE3,0x80,0xA8,3},
+        {0xE3,0x80,0xA9,3}, {0xE3,0x8A,0xA3,3}, {0xE3,0x8E,0x8E,3}, {0xE3,0x8E,0x8F,3}, {0xE3,0x8E,0x9C,3}, {0xE3,0x8E,0x9D,3}, {0xE3,0x8E,0x9E,3}, {0xE3,0x8E,0xA1,3},
+        {0xE3,0x8F,0x84,3}, {0xE3,0x8F,0x8E,3}, {0xE3,0x8F,0x91,3}, {0xE3,0x8F,0x92,3}, {0xE3,0x8F,0x95,3}, {0xEF,0xB8,0xB0,3}, {0xEF,0xBF,0xA2,3}, {0xEF,0xBF,0xA4,3},
+        {0xEF,0xBF,0xBD,3}, {0xE2,0x84,0xA1,3}, {0xE3,0x88,0xB1,3}, {0xEF,0xBF,0xBD,3}, {0xE2,0x80,0x90,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xE3,0x83,0xBC,3}, {0xE3,0x82,0x9B,3}, {0xE3,0x82,0x9C,3}, {0xE3,0x83,0xBD,3}, {0xE3,0x83,0xBE,3}, {0xE3,0x80,0x86,3}, {0xE3,0x82,0x9D,3}, {0xE3,0x82,0x9E,3},
+        {0xEF,0xB9,0x89,3}, {0xEF,0xB9,0x8A,3}, {0xEF,0xB9,0x8B,3}, {0xEF,0xB9,0x8C,3}, {0xEF,0xB9,0x8D,3}, {0xEF,0xB9,0x8E,3}, {0xEF,0xB9,0x8F,3}, {0xEF,0xB9,0x90,3},
+        {0xEF,0xB9,0x91,3}, {0xEF,0xB9,0x92,3}, {0xEF,0xB9,0x94,3}, {0xEF,0xB9,0x95,3}, {0xEF,0xB9,0x96,3}, {0xEF,0xB9,0x97,3}, {0xEF,0xB9,0x99,3}, {0xEF,0xB9,0x9A,3},
+        {0xEF,0xB9,0x9B,3}, {0xEF,0xB9,0x9C,3}, {0xEF,0xB9,0x9D,3}, {0xEF,0xB9,0x9E,3}, {0xEF,0xB9,0x9F,3}, {0xEF,0xB9,0xA0,3}, {0xEF,0xB9,0xA1,3}, {0xEF,0xB9,0xA2,3},
+        {0xEF,0xB9,0xA3,3}, {0xEF,0xB9,0xA4,3}, {0xEF,0xB9,0xA5,3}, {0xEF,0xB9,0xA6,3}, {0xEF,0xB9,0xA8,3}, {0xEF,0xB9,0xA9,3}, {0xEF,0xB9,0xAA,3}, {0xEF,0xB9,0xAB,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xE3,0x80,0x87,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xE2,0x94,0x80,3}, {0xE2,0x94,0x81,3}, {0xE2,0x94,0x82,3}, {0xE2,0x94,0x83,3}, {0xE2,0x94,0x84,3},
+        {0xE2,0x94,0x85,3}, {0xE2,0x94,0x86,3}, {0xE2,0x94,0x87,3}, {0xE2,0x94,0x88,3}, {0xE2,0x94,0x89,3}, {0xE2,0x94,0x8A,3}, {0xE2,0x94,0x8B,3}, {0xE2,0x94,0x8C,3},
+        {0xE2,0x94,0x8D,3}, {0xE2,0x94,0x8E,3}, {0xE2,0x94,0x8F,3}, {0xE2,0x94,0x90,3}, {0xE2,0x94,0x91,3}, {0xE2,0x94,0x92,3}, {0xE2,0x94,0x93,3}, {0xE2,0x94,0x94,3},
+        {0xE2,0x94,0x95,3}, {0xE2,0x94,0x96,3}, {0xE2,0x94,0x97,3}, {0xE2,0x94,0x98,3}, {0xE2,0x94,0x99,3}, {0xE2,0x94,0x9A,3}, {0xE2,0x94,0x9B,3}, {0xE2,0x94,0x9C,3},
+        {0xE2,0x94,0x9D,3}, {0xE2,0x94,0x9E,3}, {0xE2,0x94,0x9F,3}, {0xE2,0x94,0xA0,3}, {0xE2,0x94,0xA1,3}, {0xE2,0x94,0xA2,3}, {0xE2,0x94,0xA3,3}, {0xE2,0x94,0xA4,3},
+        {0xE2,0x94,0xA5,3}, {0xE2,0x94,0xA6,3}, {0xE2,0x94,0xA7,3}, {0xE2,0x94,0xA8,3}, {0xE2,0x94,0xA9,3}, {0xE2,0x94,0xAA,3}, {0xE2,0x94,0xAB,3}, {0xE2,0x94,0xAC,3},
+        {0xE2,0x94,0xAD,3}, {0xE2,0x94,0xAE,3}, {0xE2,0x94,0xAF,3}, {0xE2,0x94,0xB0,3}, {0xE2,0x94,0xB1,3}, {0xE2,0x94,0xB2,3}, {0xE2,0x94,0xB3,3}, {0xE2,0x94,0xB4,3},
+        {0xE2,0x94,0xB5,3}, {0xE2,0x94,0xB6,3}, {0xE2,0x94,0xB7,3}, {0xE2,0x94,0xB8,3}, {0xE2,0x94,0xB9,3}, {0xE2,0x94,0xBA,3}, {0xE2,0x94,0xBB,3}, {0xE2,0x94,0xBC,3},
+        {0xE2,0x94,0xBD,3}, {0xE2,0x94,0xBE,3}, {0xE2,0x94,0xBF,3}, {0xE2,0x95,0x80,3}, {0xE2,0x95,0x81,3}, {0xE2,0x95,0x82,3}, {0xE2,0x95,0x83,3}, {0xE2,0x95,0x84,3},
+        {0xE2,0x95,0x85,3}, {0xE2,0x95,0x86,3}, {0xE2,0x95,0x87,3}, {0xE2,0x95,0x88,3}, {0xE2,0x95,0x89,3}, {0xE2,0x95,0x8A,3}, {0xE2,0x95,0x8B,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAA */ {
+        {0xE7,0x8B,0x9C,3}, {0xE7,0x8B,0x9D,3}, {0xE7,0x8B,0x9F,3}, {0xE7,0x8B,0xA2,3}, {0xE7,0x8B,0xA3,3}, {0xE7,0x8B,0xA4,3}, {0xE7,0x8B,0xA5,3}, {0xE7,0x8B,0xA6,3},
+        {0xE7,0x8B,0xA7,3}, {0xE7,0x8B,0xAA,3}, {0xE7,0x8B,0xAB,3}, {0xE7,0x8B,0xB5,3}, {0xE7,0x8B,0xB6,3}, {0xE7,0x8B,0xB9,3}, {0xE7,0x8B,0xBD,3}, {0xE7,0x8B,0xBE,3},
+        {0xE7,0x8B,0xBF,3}, {0xE7,0x8C,0x80,3}, {0xE7,0x8C,0x82,3}, {0xE7,0x8C,0x84,3}, {0xE7,0x8C,0x85,3}, {0xE7,0x8C,0x86,3}, {0xE7,0x8C,0x87,3}, {0xE7,0x8C,0x88,3},
+        {0xE7,0x8C,0x89,3}, {0xE7,0x8C,0x8B,3}, {0xE7,0x8C,0x8C,3}, {0xE7,0x8C,0x8D,3}, {0xE7,0x8C,0x8F,3}, {0xE7,0x8C,0x90,3}, {0xE7,0x8C,0x91,3}, {0xE7,0x8C,0x92,3},
+        {0xE7,0x8C,0x94,3}, {0xE7,0x8C,0x98,3}, {0xE7,0x8C,0x99,3}, {0xE7,0x8C,0x9A,3}, {0xE7,0x8C,0x9F,3}, {0xE7,0x8C,0xA0,3}, {0xE7,0x8C,0xA3,3}, {0xE7,0x8C,0xA4,3},
+        {0xE7,0x8C,0xA6,3}, {0xE7,0x8C,0xA7,3}, {0xE7,0x8C,0xA8,3}, {0xE7,0x8C,0xAD,3}, {0xE7,0x8C,0xAF,3}, {0xE7,0x8C,0xB0,3}, {0xE7,0x8C,0xB2,3}, {0xE7,0x8C,0xB3,3},
+        {0xE7,0x8C,0xB5,3}, {0xE7,0x8C,0xB6,3}, {0xE7,0x8C,0xBA,3}, {0xE7,0x8C,0xBB,3}, {0xE7,0x8C,0xBC,3}, {0xE7,0x8C,0xBD,3}, {0xE7,0x8D,0x80,3}, {0xE7,0x8D,0x81,3},
+        {0xE7,0x8D,0x82,3}, {0xE7,0x8D,0x83,3}, {0xE7,0x8D,0x84,3}, {0xE7,0x8D,0x85,3}, {0xE7,0x8D,0x86,3}, {0xE7,0x8D,0x87,3}, {0xE7,0x8D,0x88,3}, {0xE7,0x8D,0x89,3},
+        {0xE7,0x8D,0x8A,3}, {0xE7,0x8D,0x8B,3}, {0xE7,0x8D,0x8C,3}, {0xE7,0x8D,0x8E,3}, {0xE7,0x8D,0x8F,3}, {0xE7,0x8D,0x91,3}, {0xE7,0x8D,0x93,3}, {0xE7,0x8D,0x94,3},
+        {0xE7,0x8D,0x95,3}, {0xE7,0x8D,0x96,3}, {0xE7,0x8D,0x98,3}, {0xE7,0x8D,0x99,3}, {0xE7,0x8D,0x9A,3}, {0xE7,0x8D,0x9B,3}, {0xE7,0x8D,0x9C,3}, {0xE7,0x8D,0x9D,3},
+        {0xE7,0x8D,0x9E,3}, {0xE7,0x8D,0x9F,3}, {0xE7,0x8D,0xA1,3}, {0xE7,0x8D,0xA2,3}, {0xE7,0x8D,0xA3,3}, {0xE7,0x8D,0xA4,3}, {0xE7,0x8D,0xA5,3}, {0xE7,0x8D,0xA6,3},
+        {0xE7,0x8D,0xA7,3}, {0xE7,0x8D,0xA8,3}, {0xE7,0x8D,0xA9,3}, {0xE7,0x8D,0xAA,3}, {0xE7,0x8D,0xAB,3}, {0xE7,0x8D,0xAE,3}, {0xE7,0x8D,0xB0,3}, {0xE7,0x8D,0xB1,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAB */ {
+        {0xE7,0x8D,0xB2,3}, {0xE7,0x8D,0xB3,3}, {0xE7,0x8D,0xB4,3}, {0xE7,0x8D,0xB5,3}, {0xE7,0x8D,0xB6,3}, {0xE7,0x8D,0xB7,3}, {0xE7,0x8D,0xB8,3}, {0xE7,0x8D,0xB9,3},
+        {0xE7,0x8D,0xBA,3}, {0xE7,0x8D,0xBB,3}, {0xE7,0x8D,0xBC,3}, {0xE7,0x8D,0xBD,3}, {0xE7,0x8D,0xBF,3}, {0xE7,0x8E,0x80,3}, {0xE7,0x8E,0x81,3}, {0xE7,0x8E,0x82,3},
+        {0xE7,0x8E,0x83,3}, {0xE7,0x8E,0x85,3}, {0xE7,0x8E,0x86,3}, {0xE7,0x8E,0x88,3}, {0xE7,0x8E,0x8A,3}, {0xE7,0x8E,0x8C,3}, {0xE7,0x8E,0x8D,3}, {0xE7,0x8E,0x8F,3},
+        {0xE7,0x8E,0x90,3}, {0xE7,0x8E,0x92,3}, {0xE7,0x8E,0x93,3}, {0xE7,0x8E,0x94,3}, {0xE7,0x8E,0x95,3}, {0xE7,0x8E,0x97,3}, {0xE7,0x8E,0x98,3}, {0xE7,0x8E,0x99,3},
+        {0xE7,0x8E,0x9A,3}, {0xE7,0x8E,0x9C,3}, {0xE7,0x8E,0x9D,3}, {0xE7,0x8E,0x9E,3}, {0xE7,0x8E,0xA0,3}, {0xE7,0x8E,0xA1,3}, {0xE7,0x8E,0xA3,3}, {0xE7,0x8E,0xA4,3},
+        {0xE7,0x8E,0xA5,3}, {0xE7,0x8E,0xA6,3}, {0xE7,0x8E,0xA7,3}, {0xE7,0x8E,0xA8,3}, {0xE7,0x8E,0xAA,3}, {0xE7,0x8E,0xAC,3}, {0xE7,0x8E,0xAD,3}, {0xE7,0x8E,0xB1,3},
+        {0xE7,0x8E,0xB4,3}, {0xE7,0x8E,0xB5,3}, {0xE7,0x8E,0xB6,3}, {0xE7,0x8E,0xB8,3}, {0xE7,0x8E,0xB9,3}, {0xE7,0x8E,0xBC,3}, {0xE7,0x8E,0xBD,3}, {0xE7,0x8E,0xBE,3},
+        {0xE7,0x8E,0xBF,3}, {0xE7,0x8F,0x81,3}, {0xE7,0x8F,0x83,3}, {0xE7,0x8F,0x84,3}, {0xE7,0x8F,0x85,3}, {0xE7,0x8F,0x86,3}, {0xE7,0x8F,0x87,3}, {0xE7,0x8F,0x8B,3},
+        {0xE7,0x8F,0x8C,3}, {0xE7,0x8F,0x8E,3}, {0xE7,0x8F,0x92,3}, {0xE7,0x8F,0x93,3}, {0xE7,0x8F,0x94,3}, {0xE7,0x8F,0x95,3}, {0xE7,0x8F,0x96,3}, {0xE7,0x8F,0x97,3},
+        {0xE7,0x8F,0x98,3}, {0xE7,0x8F,0x9A,3}, {0xE7,0x8F,0x9B,3}, {0xE7,0x8F,0x9C,3}, {0xE7,0x8F,0x9D,3}, {0xE7,0x8F,0x9F,3}, {0xE7,0x8F,0xA1,3}, {0xE7,0x8F,0xA2,3},
+        {0xE7,0x8F,0xA3,3}, {0xE7,0x8F,0xA4,3}, {0xE7,0x8F,0xA6,3}, {0xE7,0x8F,0xA8,3}, {0xE7,0x8F,0xAA,3}, {0xE7,0x8F,0xAB,3}, {0xE7,0x8F,0xAC,3}, {0xE7,0x8F,0xAE,3},
+        {0xE7,0x8F,0xAF,3}, {0xE7,0x8F,0xB0,3}, {0xE7,0x8F,0xB1,3}, {0xE7,0x8F,0xB3,3}, {0xE7,0x8F,0xB4,3}, {0xE7,0x8F,0xB5,3}, {0xE7,0x8F,0xB6,3}, {0xE7,0x8F,0xB7,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAC */ {
+        {0xE7,0x8F,0xB8,3}, {0xE7,0x8F,0xB9,3}, {0xE7,0x8F,0xBA,3}, {0xE7,0x8F,0xBB,3}, {0xE7,0x8F,0xBC,3}, {0xE7,0x8F,0xBD,3}, {0xE7,0x8F,0xBE,3}, {0xE7,0x8F,0xBF,3},
+        {0xE7,0x90,0x80,3}, {0xE7,0x90,0x81,3}, {0xE7,0x90,0x82,3}, {0xE7,0x90,0x84,3}, {0xE7,0x90,0x87,3}, {0xE7,0x90,0x88,3}, {0xE7,0x90,0x8B,3}, {0xE7,0x90,0x8C,3},
+        {0xE7,0x90,0x8D,3}, {0xE7,0x90,0x8E,3}, {0xE7,0x90,0x91,3}, {0xE7,0x90,0x92,3}, {0xE7,0x90,0x93,3}, {0xE7,0x90,0x94,3}, {0xE7,0x90,0x95,3}, {0xE7,0x90,0x96,3},
+        {0xE7,0x90,0x97,3}, {0xE7,0x90,0x98,3}, {0xE7,0x90,0x99,3}, {0xE7,0x90,0x9C,3}, {0xE7,0x90,0x9D,3}, {0xE7,0x90,0x9E,3}, {0xE7,0x90,0x9F,3}, {0xE7,0x90,0xA0,3},
+        {0xE7,0x90,0xA1,3}, {0xE7,0x90,0xA3,3}, {0xE7,0x90,0xA4,3}, {0xE7,0x90,0xA7,3}, {0xE7,0x90,0xA9,3}, {0xE7,0x90,0xAB,3}, {0xE7,0x90,0xAD,3}, {0xE7,0x90,0xAF,3},
+        {0xE7,0x90,0xB1,3}, {0xE7,0x90,0xB2,3}, {0xE7,0x90,0xB7,3}, {0xE7,0x90,0xB8,3}, {0xE7,0x90,0xB9,3}, {0xE7,0x90,0xBA,3}, {0xE7,0x90,0xBB,3}, {0xE7,0x90,0xBD,3},
+        {0xE7,0x90,0xBE,3}, {0xE7,0x90,0xBF,3}, {0xE7,0x91,0x80,3}, {0xE7,0x91,0x82,3}, {0xE7,0x91,0x83,3}, {0xE7,0x91,0x84,3}, {0xE7,0x91,0x85,3}, {0xE7,0x91,0x86,3},
+        {0xE7,0x91,0x87,3}, {0xE7,0x91,0x88,3}, {0xE7,0x91,0x89,3}, {0xE7,0x91,0x8A,3}, {0xE7,0x91,0x8B,3}, {0xE7,0x91,0x8C,3}, {0xE7,0x91,0x8D,3}, {0xE7,0x91,0x8E,3},
+        {0xE7,0x91,0x8F,3}, {0xE7,0x91,0x90,3}, {0xE7,0x91,0x91,3}, {0xE7,0x91,0x92,3}, {0xE7,0x91,0x93,3}, {0xE7,0x91,0x94,3}, {0xE7,0x91,0x96,3}, {0xE7,0x91,0x98,3},
+        {0xE7,0x91,0x9D,3}, {0xE7,0x91,0xA0,3}, {0xE7,0x91,0xA1,3}, {0xE7,0x91,0xA2,3}, {0xE7,0x91,0xA3,3}, {0xE7,0x91,0xA4,3}, {0xE7,0x91,0xA5,3}, {0xE7,0x91,0xA6,3},
+        {0xE7,0x91,0xA7,3}, {0xE7,0x91,0xA8,3}, {0xE7,0x91,0xA9,3}, {0xE7,0x91,0xAA,3}, {0xE7,0x91,0xAB,3}, {0xE7,0x91,0xAC,3}, {0xE7,0x91,0xAE,3}, {0xE7,0x91,0xAF,3},
+        {0xE7,0x91,0xB1,3}, {0xE7,0x91,0xB2,3}, {0xE7,0x91,0xB3,3}, {0xE7,0x91,0xB4,3}, {0xE7,0x91,0xB5,3}, {0xE7,0x91,0xB8,3}, {0xE7,0x91,0xB9,3}, {0xE7,0x91,0xBA,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAD */ {
+        {0xE7,0x91,0xBB,3}, {0xE7,0x91,0xBC,3}, {0xE7,0x91,0xBD,3}, {0xE7,0x91,0xBF,3}, {0xE7,0x92,0x82,3}, {0xE7,0x92,0x84,3}, {0xE7,0x92,0x85,3}, {0xE7,0x92,0x86,3},
+        {0xE7,0x92,0x88,3}, {0xE7,0x92,0x89,3}, {0xE7,0x92,0x8A,3}, {0xE7,0x92,0x8C,3}, {0xE7,0x92,0x8D,3}, {0xE7,0x92,0x8F,3}, {0xE7,0x92,0x91,3}, {0xE7,0x92,0x92,3},
+        {0xE7,0x92,0x93,3}, {0xE7,0x92,0x94,3}, {0xE7,0x92,0x95,3}, {0xE7,0x92,0x96,3}, {0xE7,0x92,0x97,3}, {0xE7,0x92,0x98,3}, {0xE7,0x92,0x99,3}, {0xE7,0x92,0x9A,3},
+        {0xE7,0x92,0x9B,3}, {0xE7,0x92,0x9D,3}, {0xE7,0x92,0x9F,3}, {0xE7,0x92,0xA0,3}, {0xE7,0x92,0xA1,3}, {0xE7,0x92,0xA2,3}, {0xE7,0x92,0xA3,3}, {0xE7,0x92,0xA4,3},
+        {0xE7,0x92,0xA5,3}, {0xE7,0x92,0xA6,3}, {0xE7,0x92,0xAA,3}, {0xE7,0x92,0xAB,3}, {0xE7,0x92,0xAC,3}, {0xE7,0x92,0xAD,3}, {0xE7,0x92,0xAE,3}, {0xE7,0x92,0xAF,3},
+        {0xE7,0x92,0xB0,3}, {0xE7,0x92,0xB1,3}, {0xE7,0x92,0xB2,3}, {0xE7,0x92,0xB3,3}, {0xE7,0x92,0xB4,3}, {0xE7,0x92,0xB5,3}, {0xE7,0x92,0xB6,3}, {0xE7,0x92,0xB7,3},
+        {0xE7,0x92,0xB8,3}, {0xE7,0x92,0xB9,3}, {0xE7,0x92,0xBB,3}, {0xE7,0x92,0xBC,3}, {0xE7,0x92,0xBD,3}, {0xE7,0x92,0xBE,3}, {0xE7,0x92,0xBF,3}, {0xE7,0x93,0x80,3},
+        {0xE7,0x93,0x81,3}, {0xE7,0x93,0x82,3}, {0xE7,0x93,0x83,3}, {0xE7,0x93,0x84,3}, {0xE7,0x93,0x85,3}, {0xE7,0x93,0x86,3}, {0xE7,0x93,0x87,3}, {0xE7,0x93,0x88,3},
+        {0xE7,0x93,0x89,3}, {0xE7,0x93,0x8A,3}, {0xE7,0x93,0x8B,3}, {0xE7,0x93,0x8C,3}, {0xE7,0x93,0x8D,3}, {0xE7,0x93,0x8E,3}, {0xE7,0x93,0x8F,3}, {0xE7,0x93,0x90,3},
+        {0xE7,0x93,0x91,3}, {0xE7,0x93,0x93,3}, {0xE7,0x93,0x94,3}, {0xE7,0x93,0x95,3}, {0xE7,0x93,0x96,3}, {0xE7,0x93,0x97,3}, {0xE7,0x93,0x98,3}, {0xE7,0x93,0x99,3},
+        {0xE7,0x93,0x9A,3}, {0xE7,0x93,0x9B,3}, {0xE7,0x93,0x9D,3}, {0xE7,0x93,0x9F,3}, {0xE7,0x93,0xA1,3}, {0xE7,0x93,0xA5,3}, {0xE7,0x93,0xA7,3}, {0xE7,0x93,0xA8,3},
+        {0xE7,0x93,0xA9,3}, {0xE7,0x93,0xAA,3}, {0xE7,0x93,0xAB,3}, {0xE7,0x93,0xAC,3}, {0xE7,0x93,0xAD,3}, {0xE7,0x93,0xB0,3}, {0xE7,0x93,0xB1,3}, {0xE7,0x93,0xB2,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAE */ {
+        {0xE7,0x93,0xB3,3}, {0xE7,0x93,0xB5,3}, {0xE7,0x93,0xB8,3}, {0xE7,0x93,0xB9,3}, {0xE7,0x93,0xBA,3}, {0xE7,0x93,0xBB,3}, {0xE7,0x93,0xBC,3}, {0xE7,0x93,0xBD,3},
+        {0xE7,0x93,0xBE,3}, {0xE7,0x94,0x80,3}, {0xE7,0x94,0x81,3}, {0xE7,0x94,0x82,3}, {0xE7,0x94,0x83,3}, {0xE7,0x94,0x85,3}, {0xE7,0x94,0x86,3}, {0xE7,0x94,0x87,3},
+        {0xE7,0x94,0x88,3}, {0xE7,0x94,0x89,3}, {0xE7,0x94,0x8A,3}, {0xE7,0x94,0x8B,3}, {0xE7,0x94,0x8C,3}, {0xE7,0x94,0x8E,3}, {0xE7,0x94,0x90,3}, {0xE7,0x94,0x92,3},
+        {0xE7,0x94,0x94,3}, {0xE7,0x94,0x95,3}, {0xE7,0x94,0x96,3}, {0xE7,0x94,0x97,3}, {0xE7,0x94,0x9B,3}, {0xE7,0x94,0x9D,3}, {0xE7,0x94,0x9E,3}, {0xE7,0x94,0xA0,3},
+        {0xE7,0x94,0xA1,3}, {0xE7,0x94,0xA2,3}, {0xE7,0x94,0xA3,3}, {0xE7,0x94,0xA4,3}, {0xE7,0x94,0xA6,3}, {0xE7,0x94,0xA7,3}, {0xE7,0x94,0xAA,3}, {0xE7,0x94,0xAE,3},
+        {0xE7,0x94,0xB4,3}, {0xE7,0x94,0xB6,3}, {0xE7,0x94,0xB9,3}, {0xE7,0x94,0xBC,3}, {0xE7,0x94,0xBD,3}, {0xE7,0x94,0xBF,3}, {0xE7,0x95,0x81,3}, {0xE7,0x95,0x82,3},
+        {0xE7,0x95,0x83,3}, {0xE7,0x95,0x84,3}, {0xE7,0x95,0x86,3}, {0xE7,0x95,0x87,3}, {0xE7,0x95,0x89,3}, {0xE7,0x95,0x8A,3}, {0xE7,0x95,0x8D,3}, {0xE7,0x95,0x90,3},
+        {0xE7,0x95,0x91,3}, {0xE7,0x95,0x92,3}, {0xE7,0x95,0x93,3}, {0xE7,0x95,0x95,3}, {0xE7,0x95,0x96,3}, {0xE7,0x95,0x97,3}, {0xE7,0x95,0x98,3}, {0xE7,0x95,0x9D,3},
+        {0xE7,0x95,0x9E,3}, {0xE7,0x95,0x9F,3}, {0xE7,0x95,0xA0,3}, {0xE7,0x95,0xA1,3}, {0xE7,0x95,0xA2,3}, {0xE7,0x95,0xA3,3}, {0xE7,0x95,0xA4,3}, {0xE7,0x95,0xA7,3},
+        {0xE7,0x95,0xA8,3}, {0xE7,0x95,0xA9,3}, {0xE7,0x95,0xAB,3}, {0xE7,0x95,0xAC,3}, {0xE7,0x95,0xAD,3}, {0xE7,0x95,0xAE,3}, {0xE7,0x95,0xAF,3}, {0xE7,0x95,0xB0,3},
+        {0xE7,0x95,0xB1,3}, {0xE7,0x95,0xB3,3}, {0xE7,0x95,0xB5,3}, {0xE7,0x95,0xB6,3}, {0xE7,0x95,0xB7,3}, {0xE7,0x95,0xBA,3}, {0xE7,0x95,0xBB,3}, {0xE7,0x95,0xBC,3},
+        {0xE7,0x95,0xBD,3}, {0xE7,0x95,0xBE,3}, {0xE7,0x96,0x80,3}, {0xE7,0x96,0x81,3}, {0xE7,0x96,0x82,3}, {0xE7,0x96,0x84,3}, {0xE7,0x96,0x85,3}, {0xE7,0x96,0x87,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xAF */ {
+        {0xE7,0x96,0x88,3}, {0xE7,0x96,0x89,3}, {0xE7,0x96,0x8A,3}, {0xE7,0x96,0x8C,3}, {0xE7,0x96,0x8D,3}, {0xE7,0x96,0x8E,3}, {0xE7,0x96,0x90,3}, {0xE7,0x96,0x93,3},
+        {0xE7,0x96,0x95,3}, {0xE7,0x96,0x98,3}, {0xE7,0x96,0x9B,3}, {0xE7,0x96,0x9C,3}, {0xE7,0x96,0x9E,3}, {0xE7,0x96,0xA2,3}, {0xE7,0x96,0xA6,3}, {0xE7,0x96,0xA7,3},
+        {0xE7,0x96,0xA8,3}, {0xE7,0x96,0xA9,3}, {0xE7,0x96,0xAA,3}, {0xE7,0x96,0xAD,3}, {0xE7,0x96,0xB6,3}, {0xE7,0x96,0xB7,3}, {0xE7,0x96,0xBA,3}, {0xE7,0x96,0xBB,3},
+        {0xE7,0x96,0xBF,3}, {0xE7,0x97,0x80,3}, {0xE7,0x97,0x81,3}, {0xE7,0x97,0x86,3}, {0xE7,0x97,0x8B,3}, {0xE7,0x97,0x8C,3}, {0xE7,0x97,0x8E,3}, {0xE7,0x97,0x8F,3},
+        {0xE7,0x97,0x90,3}, {0xE7,0x97,0x91,3}, {0xE7,0x97,0x93,3}, {0xE7,0x97,0x97,3}, {0xE7,0x97,0x99,3}, {0xE7,0x97,0x9A,3}, {0xE7,0x97,0x9C,3}, {0xE7,0x97,0x9D,3},
+        {0xE7,0x97,0x9F,3}, {0xE7,0x97,0xA0,3}, {0xE7,0x97,0xA1,3}, {0xE7,0x97,0xA5,3}, {0xE7,0x97,0xA9,3}, {0xE7,0x97,0xAC,3}, {0xE7,0x97,0xAD,3}, {0xE7,0x97,0xAE,3},
+        {0xE7,0x97,0xAF,3}, {0xE7,0x97,0xB2,3}, {0xE7,0x97,0xB3,3}, {0xE7,0x97,0xB5,3}, {0xE7,0x97,0xB6,3}, {0xE7,0x97,0xB7,3}, {0xE7,0x97,0xB8,3}, {0xE7,0x97,0xBA,3},
+        {0xE7,0x97,0xBB,3}, {0xE7,0x97,0xBD,3}, {0xE7,0x97,0xBE,3}, {0xE7,0x98,0x82,3}, {0xE7,0x98,0x84,3}, {0xE7,0x98,0x86,3}, {0xE7,0x98,0x87,3}, {0xE7,0x98,0x88,3},
+        {0xE7,0x98,0x89,3}, {0xE7,0x98,0x8B,3}, {0xE7,0x98,0x8D,3}, {0xE7,0x98,0x8E,3}, {0xE7,0x98,0x8F,3}, {0xE7,0x98,0x91,3}, {0xE7,0x98,0x92,3}, {0xE7,0x98,0x93,3},
+        {0xE7,0x98,0x94,3}, {0xE7,0x98,0x96,3}, {0xE7,0x98,0x9A,3}, {0xE7,0x98,0x9C,3}, {0xE7,0x98,0x9D,3}, {0xE7,0x98,0x9E,3}, {0xE7,0x98,0xA1,3}, {0xE7,0x98,0xA3,3},
+        {0xE7,0x98,0xA7,3}, {0xE7,0x98,0xA8,3}, {0xE7,0x98,0xAC,3}, {0xE7,0x98,0xAE,3}, {0xE7,0x98,0xAF,3}, {0xE7,0x98,0xB1,3}, {0xE7,0x98,0xB2,3}, {0xE7,0x98,0xB6,3},
+        {0xE7,0x98,0xB7,3}, {0xE7,0x98,0xB9,3}, {0xE7,0x98,0xBA,3}, {0xE7,0x98,0xBB,3}, {0xE7,0x98,0xBD,3}, {0xE7,0x99,0x81,3}, {0xE7,0x99,0x82,3}, {0xE7,0x99,0x84,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xB0 */ {
+        {0xE7,0x99,0x85,3}, {0xE7,0x99,0x86,3}, {0xE7,0x99,0x87,3}, {0xE7,0x99,0x88,3}, {0xE7,0x99,0x89,3}, {0xE7,0x99,0x8A,3}, {0xE7,0x99,0x8B,3}, {0xE7,0x99,0x8E,3},
+        {0xE7,0x99,0x8F,3}, {0xE7,0x99,0x90,3}, {0xE7,0x99,0x91,3}, {0xE7,0x99,0x92,3}, {0xE7,0x99,0x93,3}, {0xE7,0x99,0x95,3}, {0xE7,0x99,0x97,3}, {0xE7,0x99,0x98,3},
+        {0xE7,0x99,0x99,3}, {0xE7,0x99,0x9A,3}, {0xE7,0x99,0x9B,3}, {0xE7,0x99,0x9D,3}, {0xE7,0x99,0x9F,3}, {0xE7,0x99,0xA0,3}, {0xE7,0x99,0xA1,3}, {0xE7,0x99,0xA2,3},
+        {0xE7,0x99,0xA4,3}, {0xE7,0x99,0xA5,3}, {0xE7,0x99,0xA6,3}, {0xE7,0x99,0xA7,3}, {0xE7,0x99,0xA8,3}, {0xE7,0x99,0xA9,3}, {0xE7,0x99,0xAA,3}, {0xE7,0x99,0xAC,3},
+        {0xE7,0x99,0xAD,3}, {0xE7,0x99,0xAE,3}, {0xE7,0x99,0xB0,3}, {0xE7,0x99,0xB1,3}, {0xE7,0x99,0xB2,3}, {0xE7,0x99,0xB3,3}, {0xE7,0x99,0xB4,3}, {0xE7,0x99,0xB5,3},
+        {0xE7,0x99,0xB6,3}, {0xE7,0x99,0xB7,3}, {0xE7,0x99,0xB9,3}, {0xE7,0x99,0xBA,3}, {0xE7,0x99,0xBC,3}, {0xE7,0x99,0xBF,3}, {0xE7,0x9A,0x80,3}, {0xE7,0x9A,0x81,3},
+        {0xE7,0x9A,0x83,3}, {0xE7,0x9A,0x85,3}, {0xE7,0x9A,0x89,3}, {0xE7,0x9A,0x8A,3}, {0xE7,0x9A,0x8C,3}, {0xE7,0x9A,0x8D,3}, {0xE7,0x9A,0x8F,3}, {0xE7,0x9A,0x90,3},
+        {0xE7,0x9A,0x92,3}, {0xE7,0x9A,0x94,3}, {0xE7,0x9A,0x95,3}, {0xE7,0x9A,0x97,3}, {0xE7,0x9A,0x98,3}, {0xE7,0x9A,0x9A,3}, {0xE7,0x9A,0x9B,3}, {0xE7,0x9A,0x9C,3},
+        {0xE7,0x9A,0x9D,3}, {0xE7,0x9A,0x9E,3}, {0xE7,0x9A,0x9F,3}, {0xE7,0x9A,0xA0,3}, {0xE7,0x9A,0xA1,3}, {0xE7,0x9A,0xA2,3}, {0xE7,0x9A,0xA3,3}, {0xE7,0x9A,0xA5,3},
+        {0xE7,0x9A,0xA6,3}, {0xE7,0x9A,0xA7,3}, {0xE7,0x9A,0xA8,3}, {0xE7,0x9A,0xA9,3}, {0xE7,0x9A,0xAA,3}, {0xE7,0x9A,0xAB,3}, {0xE7,0x9A,0xAC,3}, {0xE7,0x9A,0xAD,3},
+        {0xE7,0x9A,0xAF,3}, {0xE7,0x9A,0xB0,3}, {0xE7,0x9A,0xB3,3}, {0xE7,0x9A,0xB5,3}, {0xE7,0x9A,0xB6,3}, {0xE7,0x9A,0xB7,3}, {0xE7,0x9A,0xB8,3}, {0xE7,0x9A,0xB9,3},
+        {0xE7,0x9A,0xBA,3}, {0xE7,0x9A,0xBB,3}, {0xE7,0x9A,0xBC,3}, {0xE7,0x9A,0xBD,3}, {0xE7,0x9A,0xBE,3}, {0xE7,0x9B,0x80,3}, {0xE7,0x9B,0x81,3}, {0xE7,0x9B,0x83,3},
+        {0xE5,0x95,0x8A,3}, {0xE9,0x98,0xBF,3}, {0xE5,0x9F,0x83,3}, {0xE6,0x8C,0xA8,3}, {0xE5,0x93,0x8E,3}, {0xE5,0x94,0x89,3}, {0xE5,0x93,0x80,3}, {0xE7,0x9A,0x91,3},
+        {0xE7,0x99,0x8C,3}, {0xE8,0x94,0xBC,3}, {0xE7,0x9F,0xAE,3}, {0xE8,0x89,0xBE,3}, {0xE7,0xA2,0x8D,3}, {0xE7,0x88,0xB1,3}, {0xE9,0x9A,0x98,3}, {0xE9,0x9E,0x8D,3},
+        {0xE6,0xB0,0xA8,3}, {0xE5,0xAE,0x89,3}, {0xE4,0xBF,0xBA,3}, {0xE6,0x8C,0x89,3}, {0xE6,0x9A,0x97,3}, {0xE5,0xB2,0xB8,3}, {0xE8,0x83,0xBA,3}, {0xE6,0xA1,0x88,3},
+        {0xE8,0x82,0xAE,3}, {0xE6,0x98,0x82,3}, {0xE7,0x9B,0x8E,3}, {0xE5,0x87,0xB9,3}, {0xE6,0x95,0x96,3}, {0xE7,0x86,0xAC,3}, {0xE7,0xBF,0xB1,3}, {0xE8,0xA2,0x84,3},
+        {0xE5,0x82,0xB2,3}, {0xE5,0xA5,0xA5,3}, {0xE6,0x87,0x8A,3}, {0xE6,0xBE,0xB3,3}, {0xE8,0x8A,0xAD,3}, {0xE6,0x8D,0x8C,3}, {0xE6,0x89,0x92,3}, {0xE5,0x8F,0xAD,3},
+        {0xE5,0x90,0xA7,3}, {0xE7,0xAC,0x86,3}, {0xE5,0x85,0xAB,3}, {0xE7,0x96,0xA4,3}, {0xE5,0xB7,0xB4,3}, {0xE6,0x8B,0x94,3}, {0xE8,0xB7,0x8B,3}, {0xE9,0x9D,0xB6,3},
+        {0xE6,0x8A,0x8A,3}, {0xE8,0x80,0x99,3}, {0xE5,0x9D,0x9D,3}, {0xE9,0x9C,0xB8,3}, {0xE7,0xBD,0xA2,3}, {0xE7,0x88,0xB8,3}, {0xE7,0x99,0xBD,3}, {0xE6,0x9F,0x8F,3},
+        {0xE7,0x99,0xBE,3}, {0xE6,0x91,0x86,3}, {0xE4,0xBD,0xB0,3}, {0xE8,0xB4,0xA5,3}, {0xE6,0x8B,0x9C,3}, {0xE7,0xA8,0x97,3}, {0xE6,0x96,0x91,3}, {0xE7,0x8F,0xAD,3},
+        {0xE6,0x90,0xAC,3}, {0xE6,0x89,0xB3,3}, {0xE8,0x88,0xAC,3}, {0xE9,0xA2,0x81,3}, {0xE6,0x9D,0xBF,3}, {0xE7,0x89,0x88,3}, {0xE6,0x89,0xAE,3}, {0xE6,0x8B,0x8C,3},
+        {0xE4,0xBC,0xB4,3}, {0xE7,0x93,0xA3,3}, {0xE5,0x8D,0x8A,3}, {0xE5,0x8A,0x9E,3}, {0xE7,0xBB,0x8A,3}, {0xE9,0x82,0xA6,3}, {0xE5,0xB8,0xAE,3}, {0xE6,0xA2,0x86,3},
+        {0xE6,0xA6,0x9C,3}, {0xE8,0x86,0x80,3}, {0xE7,0xBB,0x91,3}, {0xE6,0xA3,0x92,3}, {0xE7,0xA3,0x85,3}, {0xE8,0x9A,0x8C,3}, {0xE9,0x95,0x91,3}, {0xE5,0x82,0x8D,3},
+        {0xE8,0xB0,0xA4,3}, {0xE8,0x8B,0x9E,3}, {0xE8,0x83,0x9E,3}, {0xE5,0x8C,0x85,3}, {0xE8,0xA4,0x92,3}, {0xE5,0x89,0xA5,3},
+    },
+    /* 0xB1 */ {
+        {0xE7,0x9B,0x84,3}, {0xE7,0x9B,0x87,3}, {0xE7,0x9B,0x89,3}, {0xE7,0x9B,0x8B,3}, {0xE7,0x9B,0x8C,3}, {0xE7,0x9B,0x93,3}, {0xE7,0x9B,0x95,3}, {0xE7,0x9B,0x99,3},
+        {0xE7,0x9B,0x9A,3}, {0xE7,0x9B,0x9C,3}, {0xE7,0x9B,0x9D,3}, {0xE7,0x9B,0x9E,3}, {0xE7,0x9B,0xA0,3}, {0xE7,0x9B,0xA1,3}, {0xE7,0x9B,0xA2,3}, {0xE7,0x9B,0xA3,3},
+        {0xE7,0x9B,0xA4,3}, {0xE7,0x9B,0xA6,3}, {0xE7,0x9B,0xA7,3}, {0xE7,0x9B,0xA8,3}, {0xE7,0x9B,0xA9,3}, {0xE7,0x9B,0xAA,3}, {0xE7,0x9B,0xAB,3}, {0xE7,0x9B,0xAC,3},
+        {0xE7,0x9B,0xAD,3}, {0xE7,0x9B,0xB0,3}, {0xE7,0x9B,0xB3,3}, {0xE7,0x9B,0xB5,3}, {0xE7,0x9B,0xB6,3}, {0xE7,0x9B,0xB7,3}, {0xE7,0x9B,0xBA,3}, {0xE7,0x9B,0xBB,3},
+        {0xE7,0x9B,0xBD,3}, {0xE7,0x9B,0xBF,3}, {0xE7,0x9C,0x80,3}, {0xE7,0x9C,0x82,3}, {0xE7,0x9C,0x83,3}, {0xE7,0x9C,0x85,3}, {0xE7,0x9C,0x86,3}, {0xE7,0x9C,0x8A,3},
+        {0xE7,0x9C,0x8C,3}, {0xE7,0x9C,0x8E,3}, {0xE7,0x9C,0x8F,3}, {0xE7,0x9C,0x90,3}, {0xE7,0x9C,0x91,3}, {0xE7,0x9C,0x92,3}, {0xE7,0x9C,0x93,3}, {0xE7,0x9C,0x94,3},
+        {0xE7,0x9C,0x95,3}, {0xE7,0x9C,0x96,3}, {0xE7,0x9C,0x97,3}, {0xE7,0x9C,0x98,3}, {0xE7,0x9C,0x9B,3}, {0xE7,0x9C,0x9C,3}, {0xE7,0x9C,0x9D,3}, {0xE7,0x9C,0x9E,3},
+        {0xE7,0x9C,0xA1,3}, {0xE7,0x9C,0xA3,3}, {0xE7,0x9C,0xA4,3}, {0xE7,0x9C,0xA5,3}, {0xE7,0x9C,0xA7,3}, {0xE7,0x9C,0xAA,3}, {0xE7,0x9C,0xAB,3}, {0xE7,0x9C,0xAC,3},
+        {0xE7,0x9C,0xAE,3}, {0xE7,0x9C,0xB0,3}, {0xE7,0x9C,0xB1,3}, {0xE7,0x9C,0xB2,3}, {0xE7,0x9C,0xB3,3}, {0xE7,0x9C,0xB4,3}, {0xE7,0x9C,0xB9,3}, {0xE7,0x9C,0xBB,3},
+        {0xE7,0x9C,0xBD,3}, {0xE7,0x9C,0xBE,3}, {0xE7,0x9C,0xBF,3}, {0xE7,0x9D,0x82,3}, {0xE7,0x9D,0x84,3}, {0xE7,0x9D,0x85,3}, {0xE7,0x9D,0x86,3}, {0xE7,0x9D,0x88,3},
+        {0xE7,0x9D,0x89,3}, {0xE7,0x9D,0x8A,3}, {0xE7,0x9D,0x8B,3}, {0xE7,0x9D,0x8C,3}, {0xE7,0x9D,0x8D,3}, {0xE7,0x9D,0x8E,3}, {0xE7,0x9D,0x8F,3}, {0xE7,0x9D,0x92,3},
+        {0xE7,0x9D,0x93,3}, {0xE7,0x9D,0x94,3}, {0xE7,0x9D,0x95,3}, {0xE7,0x9D,0x96,3}, {0xE7,0x9D,0x97,3}, {0xE7,0x9D,0x98,3}, {0xE7,0x9D,0x99,3}, {0xE7,0x9D,0x9C,3},
+        {0xE8,0x96,0x84,3}, {0xE9,0x9B,0xB9,3}, {0xE4,0xBF,0x9D,3}, {0xE5,0xA0,0xA1,3}, {0xE9,0xA5,0xB1,3}, {0xE5,0xAE,0x9D,3}, {0xE6,0x8A,0xB1,3}, {0xE6,0x8A,0xA5,3},
+        {0xE6,0x9A,0xB4,3}, {0xE8,0xB1,0xB9,3}, {0xE9,0xB2,0x8D,3}, {0xE7,0x88,0x86,3}, {0xE6,0x9D,0xAF,3}, {0xE7,0xA2,0x91,3}, {0xE6,0x82,0xB2,3}, {0xE5,0x8D,0x91,3},
+        {0xE5,0x8C,0x97,3}, {0xE8,0xBE,0x88,3}, {0xE8,0x83,0x8C,3}, {0xE8,0xB4,0x9D,3}, {0xE9,0x92,0xA1,3}, {0xE5,0x80,0x8D,3}, {0xE7,0x8B,0x88,3}, {0xE5,0xA4,0x87,3},
+        {0xE6,0x83,0xAB,3}, {0xE7,0x84,0x99,3}, {0xE8,0xA2,0xAB,3}, {0xE5,0xA5,0x94,3}, {0xE8,0x8B,0xAF,3}, {0xE6,0x9C,0xAC,3}, {0xE7,0xAC,0xA8,3}, {0xE5,0xB4,0xA9,3},
+        {0xE7,0xBB,0xB7,3}, {0xE7,0x94,0xAD,3}, {0xE6,0xB3,0xB5,3}, {0xE8,0xB9,0xA6,3}, {0xE8,0xBF,0xB8,3}, {0xE9,0x80,0xBC,3}, {0xE9,0xBC,0xBB,3}, {0xE6,0xAF,0x94,3},
+        {0xE9,0x84,0x99,3}, {0xE7,0xAC,0x94,3}, {0xE5,0xBD,0xBC,3}, {0xE7,0xA2,0xA7,3}, {0xE8,0x93,0x96,3}, {0xE8,0x94,0xBD,3}, {0xE6,0xAF,0x95,3}, {0xE6,0xAF,0x99,3},
+        {0xE6,0xAF,0x96,3}, {0xE5,0xB8,0x81,3}, {0xE5,0xBA,0x87,3}, {0xE7,0x97,0xB9,3}, {0xE9,0x97,0xAD,3}, {0xE6,0x95,0x9D,3}, {0xE5,0xBC,0x8A,3}, {0xE5,0xBF,0x85,3},
+        {0xE8,0xBE,0x9F,3}, {0xE5,0xA3,0x81,3}, {0xE8,0x87,0x82,3}, {0xE9,0x81,0xBF,3}, {0xE9,0x99,0x9B,3}, {0xE9,0x9E,0xAD,3}, {0xE8,0xBE,0xB9,3}, {0xE7,0xBC,0x96,3},
+        {0xE8,0xB4,0xAC,3}, {0xE6,0x89,0x81,3}, {0xE4,0xBE,0xBF,3}, {0xE5,0x8F,0x98,3}, {0xE5,0x8D,0x9E,3}, {0xE8,0xBE,0xA8,3}, {0xE8,0xBE,0xA9,3}, {0xE8,0xBE,0xAB,3},
+        {0xE9,0x81,0x8D,3}, {0xE6,0xA0,0x87,3}, {0xE5,0xBD,0xAA,3}, {0xE8,0x86,0x98,3}, {0xE8,0xA1,0xA8,3}, {0xE9,0xB3,0x96,3}, {0xE6,0x86,0x8B,3}, {0xE5,0x88,0xAB,3},
+        {0xE7,0x98,0xAA,3}, {0xE5,0xBD,0xAC,3}, {0xE6,0x96,0x8C,3}, {0xE6,0xBF,0x92,3}, {0xE6,0xBB,0xA8,3}, {0xE5,0xAE,0xBE,3}, {0xE6,0x91,0x88,3}, {0xE5,0x85,0xB5,3},
+        {0xE5,0x86,0xB0,3}, {0xE6,0x9F,0x84,3}, {0xE4,0xB8,0x99,3}, {0xE7,0xA7,0x89,3}, {0xE9,0xA5,0xBC,3}, {0xE7,0x82,0xB3,3},
+    },
+    /* 0xB2 */ {
+        {0xE7,0x9D,0x9D,3}, {0xE7,0x9D,0x9E,3}, {0xE7,0x9D,0x9F,3}, {0xE7,0x9D,0xA0,3}, {0xE7,0x9D,0xA4,3}, {0xE7,0x9D,0xA7,3}, {0xE7,0x9D,0xA9,3}, {0xE7,0x9D,0xAA,3},
+        {0xE7,0x9D,0xAD,3}, {0xE7,0x9D,0xAE,3}, {0xE7,0x9D,0xAF,3}, {0xE7,0x9D,0xB0,3}, {0xE7,0x9D,0xB1,3}, {0xE7,0x9D,0xB2,3}, {0xE7,0x9D,0xB3,3}, {0xE7,0x9D,0xB4,3},
+        {0xE7,0x9D,0xB5,3}, {0xE7,0x9D,0xB6,3}, {0xE7,0x9D,0xB7,3}, {0xE7,0x9D,0xB8,3}, {0xE7,0x9D,0xBA,3}, {0xE7,0x9D,0xBB,3}, {0xE7,0x9D,0xBC,3}, {0xE7,0x9E,0x81,3},
+        {0xE7,0x9E,0x82,3}, {0xE7,0x9E,0x83,3}, {0xE7,0x9E,0x86,3}, {0xE7,0x9E,0x87,3}, {0xE7,0x9E,0x88,3}, {0xE7,0x9E,0x89,3}, {0xE7,0x9E,0x8A,3}, {0xE7,0x9E,0x8B,3},
+        {0xE7,0x9E,0x8F,3}, {0xE7,0x9E,0x90,3}, {0xE7,0x9E,0x93,3}, {0xE7,0x9E,0x94,3}, {0xE7,0x9E,0x95,3}, {0xE7,0x9E,0x96,3}, {0xE7,0x9E,0x97,3}, {0xE7,0x9E,0x98,3},
+        {0xE7,0x9E,0x99,3}, {0xE7,0x9E,0x9A,3}, {0xE7,0x9E,0x9B,3}, {0xE7,0x9E,0x9C,3}, {0xE7,0x9E,0x9D,3}, {0xE7,0x9E,0x9E,3}, {0xE7,0x9E,0xA1,3}, {0xE7,0x9E,0xA3,3},
+        {0xE7,0x9E,0xA4,3}, {0xE7,0x9E,0xA6,3}, {0xE7,0x9E,0xA8,3}, {0xE7,0x9E,0xAB,3}, {0xE7,0x9E,0xAD,3}, {0xE7,0x9E,0xAE,3}, {0xE7,0x9E,0xAF,3}, {0xE7,0x9E,0xB1,3},
+        {0xE7,0x9E,0xB2,3}, {0xE7,0x9E,0xB4,3}, {0xE7,0x9E,0xB6,3}, {0xE7,0x9E,0xB7,3}, {0xE7,0x9E,0xB8,3}, {0xE7,0x9E,0xB9,3}, {0xE7,0x9E,0xBA,3}, {0xE7,0x9E,0xBC,3},
+        {0xE7,0x9E,0xBE,3}, {0xE7,0x9F,0x80,3}, {0xE7,0x9F,0x81,3}, {0xE7,0x9F,0x82,3}, {0xE7,0x9F,0x83,3}, {0xE7,0x9F,0x84,3}, {0xE7,0x9F,0x85,3}, {0xE7,0x9F,0x86,3},
+        {0xE7,0x9F,0x87,3}, {0xE7,0x9F,0x88,3}, {0xE7,0x9F,0x89,3}, {0xE7,0x9F,0x8A,3}, {0xE7,0x9F,0x8B,3}, {0xE7,0x9F,0x8C,3}, {0xE7,0x9F,0x8E,3}, {0xE7,0x9F,0x8F,3},
+        {0xE7,0x9F,0x90,3}, {0xE7,0x9F,0x91,3}, {0xE7,0x9F,0x92,3}, {0xE7,0x9F,0x93,3}, {0xE7,0x9F,0x94,3}, {0xE7,0x9F,0x95,3}, {0xE7,0x9F,0x96,3}, {0xE7,0x9F,0x98,3},
+        {0xE7,0x9F,0x99,3}, {0xE7,0x9F,0x9A,3}, {0xE7,0x9F,0x9D,3}, {0xE7,0x9F,0x9E,3}, {0xE7,0x9F,0x9F,3}, {0xE7,0x9F,0xA0,3}, {0xE7,0x9F,0xA1,3}, {0xE7,0x9F,0xA4,3},
+        {0xE7,0x97,0x85,3}, {0xE5,0xB9,0xB6,3}, {0xE7,0x8E,0xBB,3}, {0xE8,0x8F,0xA0,3}, {0xE6,0x92,0xAD,3}, {0xE6,0x8B,0xA8,3}, {0xE9,0x92,0xB5,3}, {0xE6,0xB3,0xA2,3},
+        {0xE5,0x8D,0x9A,3}, {0xE5,0x8B,0x83,3}, {0xE6,0x90,0x8F,3}, {0xE9,0x93,0x82,3}, {0xE7,0xAE,0x94,3}, {0xE4,0xBC,0xAF,3}, {0xE5,0xB8,0x9B,3}, {0xE8,0x88,0xB6,3},
+        {0xE8,0x84,0x96,3}, {0xE8,0x86,0x8A,3}, {0xE6,0xB8,0xA4,3}, {0xE6,0xB3,0x8A,3}, {0xE9,0xA9,0xB3,3}, {0xE6,0x8D,0x95,3}, {0xE5,0x8D,0x9C,3}, {0xE5,0x93,0xBA,3},
+        {0xE8,0xA1,0xA5,3}, {0xE5,0x9F,0xA0,3}, {0xE4,0xB8,0x8D,3}, {0xE5,0xB8,0x83,3}, {0xE6,0xAD,0xA5,3}, {0xE7,0xB0,0xBF,3}, {0xE9,0x83,0xA8,3}, {0xE6,0x80,0x96,3},
+        {0xE6,0x93,0xA6,3}, {0xE7,0x8C,0x9C,3}, {0xE8,0xA3,0x81,3}, {0xE6,0x9D,0x90,3}, {0xE6,0x89,0x8D,3}, {0xE8,0xB4,0xA2,3}, {0xE7,0x9D,0xAC,3}, {0xE8,0xB8,0xA9,3},
+        {0xE9,0x87,0x87,3}, {0xE5,0xBD,0xA9,3}, {0xE8,0x8F,0x9C,3}, {0xE8,0x94,0xA1,3}, {0xE9,0xA4,0x90,3}, {0xE5,0x8F,0x82,3}, {0xE8,0x9A,0x95,3}, {0xE6,0xAE,0x8B,3},
+        {0xE6,0x83,0xAD,3}, {0xE6,0x83,0xA8,3}, {0xE7,0x81,0xBF,3}, {0xE8,0x8B,0x8D,3}, {0xE8,0x88,0xB1,3}, {0xE4,0xBB,0x93,3}, {0xE6,0xB2,0xA7,3}, {0xE8,0x97,0x8F,3},
+        {0xE6,0x93,0x8D,3}, {0xE7,0xB3,0x99,3}, {0xE6,0xA7,0xBD,3}, {0xE6,0x9B,0xB9,3}, {0xE8,0x8D,0x89,3}, {0xE5,0x8E,0x95,3}, {0xE7,0xAD,0x96,3}, {0xE4,0xBE,0xA7,3},
+        {0xE5,0x86,0x8C,3}, {0xE6,0xB5,0x8B,3}, {0xE5,0xB1,0x82,3}, {0xE8,0xB9,0xAD,3}, {0xE6,0x8F,0x92,3}, {0xE5,0x8F,0x89,3}, {0xE8,0x8C,0xAC,3}, {0xE8,0x8C,0xB6,3},
+        {0xE6,0x9F,0xA5,3}, {0xE7,0xA2,0xB4,3}, {0xE6,0x90,0xBD,3}, {0xE5,0xAF,0x9F,3}, {0xE5,0xB2,0x94,3}, {0xE5,0xB7,0xAE,3}, {0xE8,0xAF,0xA7,3}, {0xE6,0x8B,0x86,3},
+        {0xE6,0x9F,0xB4,3}, {0xE8,0xB1,0xBA,3}, {0xE6,0x90,0x80,3}, {0xE6,0x8E,0xBA,3}, {0xE8,0x9D,0x89,3}, {0xE9,0xA6,0x8B,3}, {0xE8,0xB0,0x97,3}, {0xE7,0xBC,0xA0,3},
+        {0xE9,0x93,0xB2,3}, {0xE4,0xBA,0xA7,3}, {0xE9,0x98,0x90,3}, {0xE9,0xA2,0xA4,3}, {0xE6,0x98,0x8C,3}, {0xE7,0x8C,0x96,3},
+    },
+    /* 0xB3 */ {
+        {0xE7,0x9F,0xA6,3}, {0xE7,0x9F,0xA8,3}, {0xE7,0x9F,0xAA,3}, {0xE7,0x9F,0xAF,3}, {0xE7,0x9F,0xB0,3}, {0xE7,0x9F,0xB1,3}, {0xE7,0x9F,0xB2,3}, {0xE7,0x9F,0xB4,3},
+        {0xE7,0x9F,0xB5,3}, {0xE7,0x9F,0xB7,3}, {0xE7,0x9F,0xB9,3}, {0xE7,0x9F,0xBA,3}, {0xE7,0x9F,0xBB,3}, {0xE7,0x9F,0xBC,3}, {0xE7,0xA0,0x83,3}, {0xE7,0xA0,0x84,3},
+        {0xE7,0xA0,0x85,3}, {0xE7,0xA0,0x86,3}, {0xE7,0xA0,0x87,3}, {0xE7,0xA0,0x88,3}, {0xE7,0xA0,0x8A,3}, {0xE7,0xA0,0x8B,3}, {0xE7,0xA0,0x8E,3}, {0xE7,0xA0,0x8F,3},
+        {0xE7,0xA0,0x90,3}, {0xE7,0xA0,0x93,3}, {0xE7,0xA0,0x95,3}, {0xE7,0xA0,0x99,3}, {0xE7,0xA0,0x9B,3}, {0xE7,0xA0,0x9E,3}, {0xE7,0xA0,0xA0,3}, {0xE7,0xA0,0xA1,3},
+        {0xE7,0xA0,0xA2,3}, {0xE7,0xA0,0xA4,3}, {0xE7,0xA0,0xA8,3}, {0xE7,0xA0,0xAA,3}, {0xE7,0xA0,0xAB,3}, {0xE7,0xA0,0xAE,3}, {0xE7,0xA0,0xAF,3}, {0xE7,0xA0,0xB1,3},
+        {0xE7,0xA0,0xB2,3}, {0xE7,0xA0,0xB3,3}, {0xE7,0xA0,0xB5,3}, {0xE7,0xA0,0xB6,3}, {0xE7,0xA0,0xBD,3}, {0xE7,0xA0,0xBF,3}, {0xE7,0xA1,0x81,3}, {0xE7,0xA1,0x82,3},
+        {0xE7,0xA1,0x83,3}, {0xE7,0xA1,0x84,3}, {0xE7,0xA1,0x86,3}, {0xE7,0xA1,0x88,3}, {0xE7,0xA1,0x89,3}, {0xE7,0xA1,0x8A,3}, {0xE7,0xA1,0x8B,3}, {0xE7,0xA1,0x8D,3},
+        {0xE7,0xA1,0x8F,3}, {0xE7,0xA1,0x91,3}, {0xE7,0xA1,0x93,3}, {0xE7,0xA1,0x94,3}, {0xE7,0xA1,0x98,3}, {0xE7,0xA1,0x99,3}, {0xE7,0xA1,0x9A,3}, {0xE7,0xA1,0x9B,3},
+        {0xE7,0xA1,0x9C,3}, {0xE7,0xA1,0x9E,3}, {0xE7,0xA1,0x9F,3}, {0xE7,0xA1,0xA0,3}, {0xE7,0xA1,0xA1,3}, {0xE7,0xA1,0xA2,3}, {0xE7,0xA1,0xA3,3}, {0xE7,0xA1,0xA4,3},
+        {0xE7,0xA1,0xA5,3}, {0xE7,0xA1,0xA6,3}, {0xE7,0xA1,0xA7,3}, {0xE7,0xA1,0xA8,3}, {0xE7,0xA1,0xA9,3}, {0xE7,0xA1,0xAF,3}, {0xE7,0xA1,0xB0,3}, {0xE7,0xA1,0xB1,3},
+        {0xE7,0xA1,0xB2,3}, {0xE7,0xA1,0xB3,3}, {0xE7,0xA1,0xB4,3}, {0xE7,0xA1,0xB5,3}, {0xE7,0xA1,0xB6,3}, {0xE7,0xA1,0xB8,3}, {0xE7,0xA1,0xB9,3}, {0xE7,0xA1,0xBA,3},
+        {0xE7,0xA1,0xBB,3}, {0xE7,0xA1,0xBD,3}, {0xE7,0xA1,0xBE,3}, {0xE7,0xA1,0xBF,3}, {0xE7,0xA2,0x80,3}, {0xE7,0xA2,0x81,3}, {0xE7,0xA2,0x82,3}, {0xE7,0xA2,0x83,3},
+        {0xE5,0x9C,0xBA,3}, {0xE5,0xB0,0x9D,3}, {0xE5,0xB8,0xB8,3}, {0xE9,0x95,0xBF,3}, {0xE5,0x81,0xBF,3}, {0xE8,0x82,0xA0,3}, {0xE5,0x8E,0x82,3}, {0xE6,0x95,0x9E,3},
+        {0xE7,0x95,0x85,3}, {0xE5,0x94,0xB1,3}, {0xE5,0x80,0xA1,3}, {0xE8,0xB6,0x85,3}, {0xE6,0x8A,0x84,3}, {0xE9,0x92,0x9E,3}, {0xE6,0x9C,0x9D,3}, {0xE5,0x98,0xB2,3},
+        {0xE6,0xBD,0xAE,3}, {0xE5,0xB7,0xA2,3}, {0xE5,0x90,0xB5,3}, {0xE7,0x82,0x92,3}, {0xE8,0xBD,0xA6,3}, {0xE6,0x89,0xAF,3}, {0xE6,0x92,0xA4,3}, {0xE6,0x8E,0xA3,3},
+        {0xE5,0xBD,0xBB,3}, {0xE6,0xBE,0x88,3}, {0xE9,0x83,0xB4,3}, {0xE8,0x87,0xA3,3}, {0xE8,0xBE,0xB0,3}, {0xE5,0xB0,0x98,3}, {0xE6,0x99,0xA8,3}, {0xE5,0xBF,0xB1,3},
+        {0xE6,0xB2,0x89,3}, {0xE9,0x99,0x88,3}, {0xE8,0xB6,0x81,3}, {0xE8,0xA1,0xAC,3}, {0xE6,0x92,0x91,3}, {0xE7,0xA7,0xB0,3}, {0xE5,0x9F,0x8E,3}, {0xE6,0xA9,0x99,3},
+        {0xE6,0x88,0x90,3}, {0xE5,0x91,0x88,3}, {0xE4,0xB9,0x98,3}, {0xE7,0xA8,0x8B,3}, {0xE6,0x83,0xA9,3}, {0xE6,0xBE,0x84,3}, {0xE8,0xAF,0x9A,3}, {0xE6,0x89,0xBF,3},
+        {0xE9,0x80,0x9E,3}, {0xE9,0xAA,0x8B,3}, {0xE7,0xA7,0xA4,3}, {0xE5,0x90,0x83,3}, {0xE7,0x97,0xB4,3}, {0xE6,0x8C,0x81,3}, {0xE5,0x8C,0x99,3}, {0xE6,0xB1,0xA0,3},
+        {0xE8,0xBF,0x9F,3}, {0xE5,0xBC,0x9B,3}, {0xE9,0xA9,0xB0,3}, {0xE8,0x80,0xBB,3}, {0xE9,0xBD,0xBF,3}, {0xE4,0xBE,0x88,3}, {0xE5,0xB0,0xBA,3}, {0xE8,0xB5,0xA4,3},
+        {0xE7,0xBF,0x85,3}, {0xE6,0x96,0xA5,3}, {0xE7,0x82,0xBD,3}, {0xE5,0x85,0x85,3}, {0xE5,0x86,0xB2,3}, {0xE8,0x99,0xAB,3}, {0xE5,0xB4,0x87,3}, {0xE5,0xAE,0xA0,3},
+        {0xE6,0x8A,0xBD,3}, {0xE9,0x85,0xAC,3}, {0xE7,0x95,0xB4,3}, {0xE8,0xB8,0x8C,3}, {0xE7,0xA8,0xA0,3}, {0xE6,0x84,0x81,3}, {0xE7,0xAD,0xB9,3}, {0xE4,0xBB,0x87,3},
+        {0xE7,0xBB,0xB8,3}, {0xE7,0x9E,0x85,3}, {0xE4,0xB8,0x91,3}, {0xE8,0x87,0xAD,3}, {0xE5,0x88,0x9D,3}, {0xE5,0x87,0xBA,3}, {0xE6,0xA9,0xB1,3}, {0xE5,0x8E,0xA8,3},
+        {0xE8,0xBA,0x87,3}, {0xE9,0x94,0x84,3}, {0xE9,0x9B,0x8F,3}, {0xE6,0xBB,0x81,3}, {0xE9,0x99,0xA4,3}, {0xE6,0xA5,0x9A,3},
+    },
+    /* 0xB4 */ {
+        {0xE7,0xA2,0x84,3}, {0xE7,0xA2,0x85,3}, {0xE7,0xA2,0x86,3}, {0xE7,0xA2,0x88,3}, {0xE7,0xA2,0x8A,3}, {0xE7,0xA2,0x8B,3}, {0xE7,0xA2,0x8F,3}, {0xE7,0xA2,0x90,3},
+        {0xE7,0xA2,0x92,3}, {0xE7,0xA2,0x94,3}, {0xE7,0xA2,0x95,3}, {0xE7,0xA2,0x96,3}, {0xE7,0xA2,0x99,3}, {0xE7,0xA2,0x9D,3}, {0xE7,0xA2,0x9E,3}, {0xE7,0xA2,0xA0,3},
+        {0xE7,0xA2,0xA2,3}, {0xE7,0xA2,0xA4,3}, {0xE7,0xA2,0xA6,3}, {0xE7,0xA2,0xA8,3}, {0xE7,0xA2,0xA9,3}, {0xE7,0xA2,0xAA,3}, {0xE7,0xA2,0xAB,3}, {0xE7,0xA2,0xAC,3},
+        {0xE7,0xA2,0xAD,3}, {0xE7,0xA2,0xAE,3}, {0xE7,0xA2,0xAF,3}, {0xE7,0xA2,0xB5,3}, {0xE7,0xA2,0xB6,3}, {0xE7,0xA2,0xB7,3}, {0xE7,0xA2,0xB8,3}, {0xE7,0xA2,0xBA,3},
+        {0xE7,0xA2,0xBB,3}, {0xE7,0xA2,0xBC,3}, {0xE7,0xA2,0xBD,3}, {0xE7,0xA2,0xBF,3}, {0xE7,0xA3,0x80,3}, {0xE7,0xA3,0x82,3}, {0xE7,0xA3,0x83,3}, {0xE7,0xA3,0x84,3},
+        {0xE7,0xA3,0x86,3}, {0xE7,0xA3,0x87,3}, {0xE7,0xA3,0x88,3}, {0xE7,0xA3,0x8C,3}, {0xE7,0xA3,0x8D,3}, {0xE7,0xA3,0x8E,3}, {0xE7,0xA3,0x8F,3}, {0xE7,0xA3,0x91,3},
+        {0xE7,0xA3,0x92,3}, {0xE7,0xA3,0x93,3}, {0xE7,0xA3,0x96,3}, {0xE7,0xA3,0x97,3}, {0xE7,0xA3,0x98,3}, {0xE7,0xA3,0x9A,3}, {0xE7,0xA3,0x9B,3}, {0xE7,0xA3,0x9C,3},
+        {0xE7,0xA3,0x9D,3}, {0xE7,0xA3,0x9E,3}, {0xE7,0xA3,0x9F,3}, {0xE7,0xA3,0xA0,3}, {0xE7,0xA3,0xA1,3}, {0xE7,0xA3,0xA2,3}, {0xE7,0xA3,0xA3,3}, {0xE7,0xA3,0xA4,3},
+        {0xE7,0xA3,0xA5,3}, {0xE7,0xA3,0xA6,3}, {0xE7,0xA3,0xA7,3}, {0xE7,0xA3,0xA9,3}, {0xE7,0xA3,0xAA,3}, {0xE7,0xA3,0xAB,3}, {0xE7,0xA3,0xAD,3}, {0xE7,0xA3,0xAE,3},
+        {0xE7,0xA3,0xAF,3}, {0xE7,0xA3,0xB0,3}, {0xE7,0xA3,0xB1,3}, {0xE7,0xA3,0xB3,3}, {0xE7,0xA3,0xB5,3}, {0xE7,0xA3,0xB6,3}, {0xE7,0xA3,0xB8,3}, {0xE7,0xA3,0xB9,3},
+        {0xE7,0xA3,0xBB,3}, {0xE7,0xA3,0xBC,3}, {0xE7,0xA3,0xBD,3}, {0xE7,0xA3,0xBE,3}, {0xE7,0xA3,0xBF,3}, {0xE7,0xA4,0x80,3}, {0xE7,0xA4,0x82,3}, {0xE7,0xA4,0x83,3},
+        {0xE7,0xA4,0x84,3}, {0xE7,0xA4,0x86,3}, {0xE7,0xA4,0x87,3}, {0xE7,0xA4,0x88,3}, {0xE7,0xA4,0x89,3}, {0xE7,0xA4,0x8A,3}, {0xE7,0xA4,0x8B,3}, {0xE7,0xA4,0x8C,3},
+        {0xE7,0xA1,0x80,3}, {0xE5,0x82,0xA8,3}, {0xE7,0x9F,0x97,3}, {0xE6,0x90,0x90,3}, {0xE8,0xA7,0xA6,3}, {0xE5,0xA4,0x84,3}, {0xE6,0x8F,0xA3,3}, {0xE5,0xB7,0x9D,3},
+        {0xE7,0xA9,0xBF,3}, {0xE6,0xA4,0xBD,3}, {0xE4,0xBC,0xA0,3}, {0xE8,0x88,0xB9,3}, {0xE5,0x96,0x98,3}, {0xE4,0xB8,0xB2,3}, {0xE7,0x96,0xAE,3}, {0xE7,0xAA,0x97,3},
+        {0xE5,0xB9,0xA2,3}, {0xE5,0xBA,0x8A,3}, {0xE9,0x97,0xAF,3}, {0xE5,0x88,0x9B,3}, {0xE5,0x90,0xB9,3}, {0xE7,0x82,0x8A,3}, {0xE6,0x8D,0xB6,3}, {0xE9,0x94,0xA4,3},
+        {0xE5,0x9E,0x82,3}, {0xE6,0x98,0xA5,3}, {0xE6,0xA4,0xBF,3}, {0xE9,0x86,0x87,3}, {0xE5,0x94,0x87,3}, {0xE6,0xB7,0xB3,3}, {0xE7,0xBA,0xAF,3}, {0xE8,0xA0,0xA2,3},
+        {0xE6,0x88,0xB3,3}, {0xE7,0xBB,0xB0,3}, {0xE7,0x96,0xB5,3}, {0xE8,0x8C,0xA8,3}, {0xE7,0xA3,0x81,3}, {0xE9,0x9B,0x8C,3}, {0xE8,0xBE,0x9E,3}, {0xE6,0x85,0x88,3},
+        {0xE7,0x93,0xB7,3}, {0xE8,0xAF,0x8D,3}, {0xE6,0xAD,0xA4,3}, {0xE5,0x88,0xBA,3}, {0xE8,0xB5,0x90,3}, {0xE6,0xAC,0xA1,3}, {0xE8,0x81,0xAA,3}, {0xE8,0x91,0xB1,3},
+        {0xE5,0x9B,0xB1,3}, {0xE5,0x8C,0x86,3}, {0xE4,0xBB,0x8E,3}, {0xE4,0xB8,0x9B,3}, {0xE5,0x87,0x91,3}, {0xE7,0xB2,0x97,3}, {0xE9,0x86,0x8B,3}, {0xE7,0xB0,0x87,3},
+        {0xE4,0xBF,0x83,3}, {0xE8,0xB9,0xBF,3}, {0xE7,0xAF,0xA1,3}, {0xE7,0xAA,0x9C,3}, {0xE6,0x91,0xA7,3}, {0xE5,0xB4,0x94,3}, {0xE5,0x82,0xAC,3}, {0xE8,0x84,0x86,3},
+        {0xE7,0x98,0x81,3}, {0xE7,0xB2,0xB9,3}, {0xE6,0xB7,0xAC,3}, {0xE7,0xBF,0xA0,3}, {0xE6,0x9D,0x91,3}, {0xE5,0xAD,0x98,3}, {0xE5,0xAF,0xB8,3}, {0xE7,0xA3,0x8B,3},
+        {0xE6,0x92,0xAE,3}, {0xE6,0x90,0x93,3}, {0xE6,0x8E,0xAA,3}, {0xE6,0x8C,0xAB,3}, {0xE9,0x94,0x99,3}, {0xE6,0x90,0xAD,3}, {0xE8,0xBE,0xBE,3}, {0xE7,0xAD,0x94,3},
+        {0xE7,0x98,0xA9,3}, {0xE6,0x89,0x93,3}, {0xE5,0xA4,0xA7,3}, {0xE5,0x91,0x86,3}, {0xE6,0xAD,0xB9,3}, {0xE5,0x82,0xA3,3}, {0xE6,0x88,0xB4,3}, {0xE5,0xB8,0xA6,3},
+        {0xE6,0xAE,0x86,3}, {0xE4,0xBB,0xA3,3}, {0xE8,0xB4,0xB7,3}, {0xE8,0xA2,0x8B,3}, {0xE5,0xBE,0x85,3}, {0xE9,0x80,0xAE,3},
+    },
+    /* 0xB5 */ {
+        {0xE7,0xA4,0x8D,3}, {0xE7,0xA4,0x8E,3}, {0xE7,0xA4,0x8F,3}, {0xE7,0xA4,0x90,3}, {0xE7,0xA4,0x91,3}, {0xE7,0xA4,0x92,3}, {0xE7,0xA4,0x94,3}, {0xE7,0xA4,0x95,3},
+        {0xE7,0xA4,0x96,3}, {0xE7,0xA4,0x97,3}, {0xE7,0xA4,0x98,3}, {0xE7,0xA4,0x99,3}, {0xE7,0xA4,0x9A,3}, {0xE7,0xA4,0x9B,3}, {0xE7,0xA4,0x9C,3}, {0xE7,0xA4,0x9D,3},
+        {0xE7,0xA4,0x9F,3}, {0xE7,0xA4,0xA0,3}, {0xE7,0xA4,0xA1,3}, {0xE7,0xA4,0xA2,3}, {0xE7,0xA4,0xA3,3}, {0xE7,0xA4,0xA5,3}, {0xE7,0xA4,0xA6,3}, {0xE7,0xA4,0xA7,3},
+        {0xE7,0xA4,0xA8,3}, {0xE7,0xA4,0xA9,3}, {0xE7,0xA4,0xAA,3}, {0xE7,0xA4,0xAB,3}, {0xE7,0xA4,0xAC,3}, {0xE7,0xA4,0xAD,3}, {0xE7,0xA4,0xAE,3}, {0xE7,0xA4,0xAF,3},
+        {0xE7,0xA4,0xB0,3}, {0xE7,0xA4,0xB1,3}, {0xE7,0xA4,0xB2,3}, {0xE7,0xA4,0xB3,3}, {0xE7,0xA4,0xB5,3}, {0xE7,0xA4,0xB6,3}, {0xE7,0xA4,0xB7,3}, {0xE7,0xA4,0xB8,3},
+        {0xE7,0xA4,0xB9,3}, {0xE7,0xA4,0xBD,3}, {0xE7,0xA4,0xBF,3}, {0xE7,0xA5,0x82,3}, {0xE7,0xA5,0x83,3}, {0xE7,0xA5,0x84,3}, {0xE7,0xA5,0x85,3}, {0xE7,0xA5,0x87,3},
+        {0xE7,0xA5,0x8A,3}, {0xE7,0xA5,0x8B,3}, {0xE7,0xA5,0x8C,3}, {0xE7,0xA5,0x8D,3}, {0xE7,0xA5,0x8E,3}, {0xE7,0xA5,0x8F,3}, {0xE7,0xA5,0x90,3}, {0xE7,0xA5,0x91,3},
+        {0xE7,0xA5,0x92,3}, {0xE7,0xA5,0x94,3}, {0xE7,0xA5,0x95,3}, {0xE7,0xA5,0x98,3}, {0xE7,0xA5,0x99,3}, {0xE7,0xA5,0xA1,3}, {0xE7,0xA5,0xA3,3}, {0xE7,0xA5,0xA4,3},
+        {0xE7,0xA5,0xA6,3}, {0xE7,0xA5,0xA9,3}, {0xE7,0xA5,0xAA,3}, {0xE7,0xA5,0xAB,3}, {0xE7,0xA5,0xAC,3}, {0xE7,0xA5,0xAE,3}, {0xE7,0xA5,0xB0,3}, {0xE7,0xA5,0xB1,3},
+        {0xE7,0xA5,0xB2,3}, {0xE7,0xA5,0xB3,3}, {0xE7,0xA5,0xB4,3}, {0xE7,0xA5,0xB5,3}, {0xE7,0xA5,0xB6,3}, {0xE7,0xA5,0xB9,3}, {0xE7,0xA5,0xBB,3}, {0xE7,0xA5,0xBC,3},
+        {0xE7,0xA5,0xBD,3}, {0xE7,0xA5,0xBE,3}, {0xE7,0xA5,0xBF,3}, {0xE7,0xA6,0x82,3}, {0xE7,0xA6,0x83,3}, {0xE7,0xA6,0x86,3}, {0xE7,0xA6,0x87,3}, {0xE7,0xA6,0x88,3},
+        {0xE7,0xA6,0x89,3}, {0xE7,0xA6,0x8B,3}, {0xE7,0xA6,0x8C,3}, {0xE7,0xA6,0x8D,3}, {0xE7,0xA6,0x8E,3}, {0xE7,0xA6,0x90,3}, {0xE7,0xA6,0x91,3}, {0xE7,0xA6,0x92,3},
+        {0xE6,0x80,0xA0,3}, {0xE8,0x80,0xBD,3}, {0xE6,0x8B,0x85,3}, {0xE4,0xB8,0xB9,3}, {0xE5,0x8D,0x95,3}, {0xE9,0x83,0xB8,3}, {0xE6,0x8E,0xB8,3}, {0xE8,0x83,0x86,3},
+        {0xE6,0x97,0xA6,3}, {0xE6,0xB0,0xAE,3}, {0xE4,0xBD,0x86,3}, {0xE6,0x83,0xAE,3}, {0xE6,0xB7,0xA1,3}, {0xE8,0xAF,0x9E,3}, {0xE5,0xBC,0xB9,3}, {0xE8,0x9B,0x8B,3},
+        {0xE5,0xBD,0x93,3}, {0xE6,0x8C,0xA1,3}, {0xE5,0x85,0x9A,3}, {0xE8,0x8D,0xA1,3}, {0xE6,0xA1,0xA3,3}, {0xE5,0x88,0x80,3}, {0xE6,0x8D,0xA3,3}, {0xE8,0xB9,0x88,3},
+        {0xE5,0x80,0x92,3}, {0xE5,0xB2,0x9B,3}, {0xE7,0xA5,0xB7,3}, {0xE5,0xAF,0xBC,3}, {0xE5,0x88,0xB0,3}, {0xE7,0xA8,0xBB,3}, {0xE6,0x82,0xBC,3}, {0xE9,0x81,0x93,3},
+        {0xE7,0x9B,0x97,3}, {0xE5,0xBE,0xB7,3}, {0xE5,0xBE,0x97,3}, {0xE7,0x9A,0x84,3}, {0xE8,0xB9,0xAC,3}, {0xE7,0x81,0xAF,3}, {0xE7,0x99,0xBB,3}, {0xE7,0xAD,0x89,3},
+        {0xE7,0x9E,0xAA,3}, {0xE5,0x87,0xB3,3}, {0xE9,0x82,0x93,3}, {0xE5,0xA0,0xA4,3}, {0xE4,0xBD,0x8E,3}, {0xE6,0xBB,0xB4,3}, {0xE8,0xBF,0xAA,3}, {0xE6,0x95,0x8C,3},
+        {0xE7,0xAC,0x9B,3}, {0xE7,0x8B,0x84,3}, {0xE6,0xB6,0xA4,3}, {0xE7,0xBF,0x9F,3}, {0xE5,0xAB,0xA1,3}, {0xE6,0x8A,0xB5,3}, {0xE5,0xBA,0x95,3}, {0xE5,0x9C,0xB0,3},
+        {0xE8,0x92,0x82,3}, {0xE7,0xAC,0xAC,3}, {0xE5,0xB8,0x9D,3}, {0xE5,0xBC,0x9F,3}, {0xE9,0x80,0x92,3}, {0xE7,0xBC,0x94,3}, {0xE9,0xA2,0xA0,3}, {0xE6,0x8E,0x82,3},
+        {0xE6,0xBB,0x87,3}, {0xE7,0xA2,0x98,3}, {0xE7,0x82,0xB9,3}, {0xE5,0x85,0xB8,3}, {0xE9,0x9D,0x9B,3}, {0xE5,0x9E,0xAB,3}, {0xE7,0x94,0xB5,3}, {0xE4,0xBD,0x83,3},
+        {0xE7,0x94,0xB8,3}, {0xE5,0xBA,0x97,3}, {0xE6,0x83,0xA6,3}, {0xE5,0xA5,0xA0,3}, {0xE6,0xB7,0x80,3}, {0xE6,0xAE,0xBF,3}, {0xE7,0xA2,0x89,3}, {0xE5,0x8F,0xBC,3},
+        {0xE9,0x9B,0x95,3}, {0xE5,0x87,0x8B,3}, {0xE5,0x88,0x81,3}, {0xE6,0x8E,0x89,3}, {0xE5,0x90,0x8A,3}, {0xE9,0x92,0x93,3}, {0xE8,0xB0,0x83,3}, {0xE8,0xB7,0x8C,3},
+        {0xE7,0x88,0xB9,3}, {0xE7,0xA2,0x9F,3}, {0xE8,0x9D,0xB6,3}, {0xE8,0xBF,0xAD,3}, {0xE8,0xB0,0x8D,3}, {0xE5,0x8F,0xA0,3},
+    },
+    /* 0xB6 */ {
+        {0xE7,0xA6,0x93,3}, {0xE7,0xA6,0x94,3}, {0xE7,0xA6,0x95,3}, {0xE7,0xA6,0x96,3}, {0xE7,0xA6,0x97,3}, {0xE7,0xA6,0x98,3}, {0xE7,0xA6,0x99,3}, {0xE7,0xA6,0x9B,3},
+        {0xE7,0xA6,0x9C,3}, {0xE7,0xA6,0x9D,3}, {0xE7,0xA6,0x9E,3}, {0xE7,0xA6,0x9F,3}, {0xE7,0xA6,0xA0,3}, {0xE7,0xA6,0xA1,3}, {0xE7,0xA6,0xA2,3}, {0xE7,0xA6,0xA3,3},
+        {0xE7,0xA6,0xA4,3}, {0xE7,0xA6,0xA5,3}, {0xE7,0xA6,0xA6,3}, {0xE7,0xA6,0xA8,3}, {0xE7,0xA6,0xA9,3}, {0xE7,0xA6,0xAA,3}, {0xE7,0xA6,0xAB,3}, {0xE7,0xA6,0xAC,3},
+        {0xE7,0xA6,0xAD,3}, {0xE7,0xA6,0xAE,3}, {0xE7,0xA6,0xAF,3}, {0xE7,0xA6,0xB0,3}, {0xE7,0xA6,0xB1,3}, {0xE7,0xA6,0xB2,3}, {0xE7,0xA6,0xB4,3}, {0xE7,0xA6,0xB5,3},
+        {0xE7,0xA6,0xB6,3}, {0xE7,0xA6,0xB7,3}, {0xE7,0xA6,0xB8,3}, {0xE7,0xA6,0xBC,3}, {0xE7,0xA6,0xBF,3}, {0xE7,0xA7,0x82,3}, {0xE7,0xA7,0x84,3}, {0xE7,0xA7,0x85,3},
+        {0xE7,0xA7,0x87,3}, {0xE7,0xA7,0x88,3}, {0xE7,0xA7,0x8A,3}, {0xE7,0xA7,0x8C,3}, {0xE7,0xA7,0x8E,3}, {0xE7,0xA7,0x8F,3}, {0xE7,0xA7,0x90,3}, {0xE7,0xA7,0x93,3},
+        {0xE7,0xA7,0x94,3}, {0xE7,0xA7,0x96,3}, {0xE7,0xA7,0x97,3}, {0xE7,0xA7,0x99,3}, {0xE7,0xA7,0x9A,3}, {0xE7,0xA7,0x9B,3}, {0xE7,0xA7,0x9C,3}, {0xE7,0xA7,0x9D,3},
+        {0xE7,0xA7,0x9E,3}, {0xE7,0xA7,0xA0,3}, {0xE7,0xA7,0xA1,3}, {0xE7,0xA7,0xA2,3}, {0xE7,0xA7,0xA5,3}, {0xE7,0xA7,0xA8,3}, {0xE7,0xA7,0xAA,3}, {0xE7,0xA7,0xAC,3},
+        {0xE7,0xA7,0xAE,3}, {0xE7,0xA7,0xB1,3}, {0xE7,0xA7,0xB2,3}, {0xE7,0xA7,0xB3,3}, {0xE7,0xA7,0xB4,3}, {0xE7,0xA7,0xB5,3}, {0xE7,0xA7,0xB6,3}, {0xE7,0xA7,0xB7,3},
+        {0xE7,0xA7,0xB9,3}, {0xE7,0xA7,0xBA,3}, {0xE7,0xA7,0xBC,3}, {0xE7,0xA7,0xBE,3}, {0xE7,0xA7,0xBF,3}, {0xE7,0xA8,0x81,3}, {0xE7,0xA8,0x84,3}, {0xE7,0xA8,0x85,3},
+        {0xE7,0xA8,0x87,3}, {0xE7,0xA8,0x88,3}, {0xE7,0xA8,0x89,3}, {0xE7,0xA8,0x8A,3}, {0xE7,0xA8,0x8C,3}, {0xE7,0xA8,0x8F,3}, {0xE7,0xA8,0x90,3}, {0xE7,0xA8,0x91,3},
+        {0xE7,0xA8,0x92,3}, {0xE7,0xA8,0x93,3}, {0xE7,0xA8,0x95,3}, {0xE7,0xA8,0x96,3}, {0xE7,0xA8,0x98,3}, {0xE7,0xA8,0x99,3}, {0xE7,0xA8,0x9B,3}, {0xE7,0xA8,0x9C,3},
+        {0xE4,0xB8,0x81,3}, {0xE7,0x9B,0xAF,3}, {0xE5,0x8F,0xAE,3}, {0xE9,0x92,0x89,3}, {0xE9,0xA1,0xB6,3}, {0xE9,0xBC,0x8E,3}, {0xE9,0x94,0xAD,3}, {0xE5,0xAE,0x9A,3},
+        {0xE8,0xAE,0xA2,3}, {0xE4,0xB8,0xA2,3}, {0xE4,0xB8,0x9C,3}, {0xE5,0x86,0xAC,3}, {0xE8,0x91,0xA3,3}, {0xE6,0x87,0x82,3}, {0xE5,0x8A,0xA8,3}, {0xE6,0xA0,0x8B,3},
+        {0xE4,0xBE,0x97,3}, {0xE6,0x81,0xAB,3}, {0xE5,0x86,0xBB,3}, {0xE6,0xB4,0x9E,3}, {0xE5,0x85,0x9C,3}, {0xE6,0x8A,0x96,3}, {0xE6,0x96,0x97,3}, {0xE9,0x99,0xA1,3},
+        {0xE8,0xB1,0x86,3}, {0xE9,0x80,0x97,3}, {0xE7,0x97,0x98,3}, {0xE9,0x83,0xBD,3}, {0xE7,0x9D,0xA3,3}, {0xE6,0xAF,0x92,3}, {0xE7,0x8A,0x8A,3}, {0xE7,0x8B,0xAC,3},
+        {0xE8,0xAF,0xBB,3}, {0xE5,0xA0,0xB5,3}, {0xE7,0x9D,0xB9,3}, {0xE8,0xB5,0x8C,3}, {0xE6,0x9D,0x9C,3}, {0xE9,0x95,0x80,3}, {0xE8,0x82,0x9A,3}, {0xE5,0xBA,0xA6,3},
+        {0xE6,0xB8,0xA1,3}, {0xE5,0xA6,0x92,3}, {0xE7,0xAB,0xAF,3}, {0xE7,0x9F,0xAD,3}, {0xE9,0x94,0xBB,3}, {0xE6,0xAE,0xB5,3}, {0xE6,0x96,0xAD,3}, {0xE7,0xBC,0x8E,3},
+        {0xE5,0xA0,0x86,3}, {0xE5,0x85,0x91,3}, {0xE9,0x98,0x9F,3}, {0xE5,0xAF,0xB9,3}, {0xE5,0xA2,0xA9,3}, {0xE5,0x90,0xA8,3}, {0xE8,0xB9,0xB2,3}, {0xE6,0x95,0xA6,3},
+        {0xE9,0xA1,0xBF,3}, {0xE5,0x9B,0xA4,3}, {0xE9,0x92,0x9D,3}, {0xE7,0x9B,0xBE,3}, {0xE9,0x81,0x81,3}, {0xE6,0x8E,0x87,3}, {0xE5,0x93,0x86,3}, {0xE5,0xA4,0x9A,3},
+        {0xE5,0xA4,0xBA,3}, {0xE5,0x9E,0x9B,3}, {0xE8,0xBA,0xB2,3}, {0xE6,0x9C,0xB5,3}, {0xE8,0xB7,0xBA,3}, {0xE8,0x88,0xB5,3}, {0xE5,0x89,0x81,3}, {0xE6,0x83,0xB0,3},
+        {0xE5,0xA0,0x95,3}, {0xE8,0x9B,0xBE,3}, {0xE5,0xB3,0xA8,3}, {0xE9,0xB9,0x85,3}, {0xE4,0xBF,0x84,3}, {0xE9,0xA2,0x9D,3}, {0xE8,0xAE,0xB9,3}, {0xE5,0xA8,0xA5,3},
+        {0xE6,0x81,0xB6,3}, {0xE5,0x8E,0x84,3}, {0xE6,0x89,0xBC,3}, {0xE9,0x81,0x8F,3}, {0xE9,0x84,0x82,3}, {0xE9,0xA5,0xBF,3}, {0xE6,0x81,0xA9,3}, {0xE8,0x80,0x8C,3},
+        {0xE5,0x84,0xBF,3}, {0xE8,0x80,0xB3,3}, {0xE5,0xB0,0x94,3}, {0xE9,0xA5,0xB5,3}, {0xE6,0xB4,0xB1,3}, {0xE4,0xBA,0x8C,3},
+    },
+    /* 0xB7 */ {
+        {0xE7,0xA8,0x9D,3}, {0xE7,0xA8,0x9F,3}, {0xE7,0xA8,0xA1,3}, {0xE7,0xA8,0xA2,3}, {0xE7,0xA8,0xA4,3}, {0xE7,0xA8,0xA5,3}, {0xE7,0xA8,0xA6,3}, {0xE7,0xA8,0xA7,3},
+        {0xE7,0xA8,0xA8,3}, {0xE7,0xA8,0xA9,3}, {0xE7,0xA8,0xAA,3}, {0xE7,0xA8,0xAB,3}, {0xE7,0xA8,0xAC,3}, {0xE7,0xA8,0xAD,3}, {0xE7,0xA8,0xAE,3}, {0xE7,0xA8,0xAF,3},
+        {0xE7,0xA8,0xB0,3}, {0xE7,0xA8,0xB1,3}, {0xE7,0xA8,0xB2,3}, {0xE7,0xA8,0xB4,3}, {0xE7,0xA8,0xB5,3}, {0xE7,0xA8,0xB6,3}, {0xE7,0xA8,0xB8,3}, {0xE7,0xA8,0xBA,3},
+        {0xE7,0xA8,0xBE,3}, {0xE7,0xA9,0x80,3}, {0xE7,0xA9,0x81,3}, {0xE7,0xA9,0x82,3}, {0xE7,0xA9,0x83,3}, {0xE7,0xA9,0x84,3}, {0xE7,0xA9,0x85,3}, {0xE7,0xA9,0x87,3},
+        {0xE7,0xA9,0x88,3}, {0xE7,0xA9,0x89,3}, {0xE7,0xA9,0x8A,3}, {0xE7,0xA9,0x8B,3}, {0xE7,0xA9,0x8C,3}, {0xE7,0xA9,0x8D,3}, {0xE7,0xA9,0x8E,3}, {0xE7,0xA9,0x8F,3},
+        {0xE7,0xA9,0x90,3}, {0xE7,0xA9,0x92,3}, {0xE7,0xA9,0x93,3}, {0xE7,0xA9,0x94,3}, {0xE7,0xA9,0x95,3}, {0xE7,0xA9,0x96,3}, {0xE7,0xA9,0x98,3}, {0xE7,0xA9,0x99,3},
+        {0xE7,0xA9,0x9A,3}, {0xE7,0xA9,0x9B,3}, {0xE7,0xA9,0x9C,3}, {0xE7,0xA9,0x9D,3}, {0xE7,0xA9,0x9E,3}, {0xE7,0xA9,0x9F,3}, {0xE7,0xA9,0xA0,3}, {0xE7,0xA9,0xA1,3},
+        {0xE7,0xA9,0xA2,3}, {0xE7,0xA9,0xA3,3}, {0xE7,0xA9,0xA4,3}, {0xE7,0xA9,0xA5,3}, {0xE7,0xA9,0xA6,3}, {0xE7,0xA9,0xA7,3}, {0xE7,0xA9,0xA8,3}, {0xE7,0xA9,0xA9,3},
+        {0xE7,0xA9,0xAA,3}, {0xE7,0xA9,0xAB,3}, {0xE7,0xA9,0xAC,3}, {0xE7,0xA9,0xAD,3}, {0xE7,0xA9,0xAE,3}, {0xE7,0xA9,0xAF,3}, {0xE7,0xA9,0xB1,3}, {0xE7,0xA9,0xB2,3},
+        {0xE7,0xA9,0xB3,3}, {0xE7,0xA9,0xB5,3}, {0xE7,0xA9,0xBB,3}, {0xE7,0xA9,0xBC,3}, {0xE7,0xA9,0xBD,3}, {0xE7,0xA9,0xBE,3}, {0xE7,0xAA,0x82,3}, {0xE7,0xAA,0x85,3},
+        {0xE7,0xAA,0x87,3}, {0xE7,0xAA,0x89,3}, {0xE7,0xAA,0x8A,3}, {0xE7,0xAA,0x8B,3}, {0xE7,0xAA,0x8C,3}, {0xE7,0xAA,0x8E,3}, {0xE7,0xAA,0x8F,3}, {0xE7,0xAA,0x90,3},
+        {0xE7,0xAA,0x93,3}, {0xE7,0xAA,0x94,3}, {0xE7,0xAA,0x99,3}, {0xE7,0xAA,0x9A,3}, {0xE7,0xAA,0x9B,3}, {0xE7,0xAA,0x9E,3}, {0xE7,0xAA,0xA1,3}, {0xE7,0xAA,0xA2,3},
+        {0xE8,0xB4,0xB0,3}, {0xE5,0x8F,0x91,3}, {0xE7,0xBD,0x9A,3}, {0xE7,0xAD,0x8F,3}, {0xE4,0xBC,0x90,3}, {0xE4,0xB9,0x8F,3}, {0xE9,0x98,0x80,3}, {0xE6,0xB3,0x95,3},
+        {0xE7,0x8F,0x90,3}, {0xE8,0x97,0xA9,3}, {0xE5,0xB8,0x86,3}, {0xE7,0x95,0xAA,3}, {0xE7,0xBF,0xBB,3}, {0xE6,0xA8,0x8A,3}, {0xE7,0x9F,0xBE,3}, {0xE9,0x92,0x92,3},
+        {0xE7,0xB9,0x81,3}, {0xE5,0x87,0xA1,3}, {0xE7,0x83,0xA6,3}, {0xE5,0x8F,0x8D,3}, {0xE8,0xBF,0x94,3}, {0xE8,0x8C,0x83,3}, {0xE8,0xB4,0xA9,3}, {0xE7,0x8A,0xAF,3},
+        {0xE9,0xA5,0xAD,3}, {0xE6,0xB3,0x9B,3}, {0xE5,0x9D,0x8A,3}, {0xE8,0x8A,0xB3,3}, {0xE6,0x96,0xB9,3}, {0xE8,0x82,0xAA,3}, {0xE6,0x88,0xBF,3}, {0xE9,0x98,0xB2,3},
+        {0xE5,0xA6,0xA8,3}, {0xE4,0xBB,0xBF,3}, {0xE8,0xAE,0xBF,3}, {0xE7,0xBA,0xBA,3}, {0xE6,0x94,0xBE,3}, {0xE8,0x8F,0xB2,3}, {0xE9,0x9D,0x9E,3}, {0xE5,0x95,0xA1,3},
+        {0xE9,0xA3,0x9E,3}, {0xE8,0x82,0xA5,3}, {0xE5,0x8C,0xAA,3}, {0xE8,0xAF,0xBD,3}, {0xE5,0x90,0xA0,3}, {0xE8,0x82,0xBA,3}, {0xE5,0xBA,0x9F,3}, {0xE6,0xB2,0xB8,3},
+        {0xE8,0xB4,0xB9,3}, {0xE8,0x8A,0xAC,3}, {0xE9,0x85,0x9A,3}, {0xE5,0x90,0xA9,3}, {0xE6,0xB0,0x9B,3}, {0xE5,0x88,0x86,3}, {0xE7,0xBA,0xB7,3}, {0xE5,0x9D,0x9F,3},
+        {0xE7,0x84,0x9A,3}, {0xE6,0xB1,0xBE,3}, {0xE7,0xB2,0x89,3}, {0xE5,0xA5,0x8B,3}, {0xE4,0xBB,0xBD,3}, {0xE5,0xBF,0xBF,3}, {0xE6,0x84,0xA4,3}, {0xE7,0xB2,0xAA,3},
+        {0xE4,0xB8,0xB0,3}, {0xE5,0xB0,0x81,3}, {0xE6,0x9E,0xAB,3}, {0xE8,0x9C,0x82,3}, {0xE5,0xB3,0xB0,3}, {0xE9,0x94,0x8B,3}, {0xE9,0xA3,0x8E,3}, {0xE7,0x96,0xAF,3},
+        {0xE7,0x83,0xBD,3}, {0xE9,0x80,0xA2,3}, {0xE5,0x86,0xAF,3}, {0xE7,0xBC,0x9D,3}, {0xE8,0xAE,0xBD,3}, {0xE5,0xA5,0x89,3}, {0xE5,0x87,0xA4,3}, {0xE4,0xBD,0x9B,3},
+        {0xE5,0x90,0xA6,3}, {0xE5,0xA4,0xAB,3}, {0xE6,0x95,0xB7,3}, {0xE8,0x82,0xA4,3}, {0xE5,0xAD,0xB5,3}, {0xE6,0x89,0xB6,3}, {0xE6,0x8B,0x82,3}, {0xE8,0xBE,0x90,3},
+        {0xE5,0xB9,0x85,3}, {0xE6,0xB0,0x9F,3}, {0xE7,0xAC,0xA6,3}, {0xE4,0xBC,0x8F,3}, {0xE4,0xBF,0x98,3}, {0xE6,0x9C,0x8D,3},
+    },
+    /* 0xB8 */ {
+        {0xE7,0xAA,0xA3,3}, {0xE7,0xAA,0xA4,3}, {0xE7,0xAA,0xA7,3}, {0xE7,0xAA,0xA9,3}, {0xE7,0xAA,0xAA,3}, {0xE7,0xAA,0xAB,3}, {0xE7,0xAA,0xAE,3}, {0xE7,0xAA,0xAF,3},
+        {0xE7,0xAA,0xB0,3}, {0xE7,0xAA,0xB1,3}, {0xE7,0xAA,0xB2,3}, {0xE7,0xAA,0xB4,3}, {0xE7,0xAA,0xB5,3}, {0xE7,0xAA,0xB6,3}, {0xE7,0xAA,0xB7,3}, {0xE7,0xAA,0xB8,3},
+        {0xE7,0xAA,0xB9,3}, {0xE7,0xAA,0xBA,3}, {0xE7,0xAA,0xBB,3}, {0xE7,0xAA,0xBC,3}, {0xE7,0xAA,0xBD,3}, {0xE7,0xAA,0xBE,3}, {0xE7,0xAB,0x80,3}, {0xE7,0xAB,0x81,3},
+        {0xE7,0xAB,0x82,3}, {0xE7,0xAB,0x83,3}, {0xE7,0xAB,0x84,3}, {0xE7,0xAB,0x85,3}, {0xE7,0xAB,0x86,3}, {0xE7,0xAB,0x87,3}, {0xE7,0xAB,0x88,3}, {0xE7,0xAB,0x89,3},
+        {0xE7,0xAB,0x8A,3}, {0xE7,0xAB,0x8C,3}, {0xE7,0xAB,0x8D,3}, {0xE7,0xAB,0x8E,3}, {0xE7,0xAB,0x8F,3}, {0xE7,0xAB,0x90,3}, {0xE7,0xAB,0x91,3}, {0xE7,0xAB,0x92,3},
+        {0xE7,0xAB,0x93,3}, {0xE7,0xAB,0x94,3}, {0xE7,0xAB,0x95,3}, {0xE7,0xAB,0x97,3}, {0xE7,0xAB,0x98,3}, {0xE7,0xAB,0x9A,3}, {0xE7,0xAB,0x9B,3}, {0xE7,0xAB,0x9C,3},
+        {0xE7,0xAB,0x9D,3}, {0xE7,0xAB,0xA1,3}, {0xE7,0xAB,0xA2,3}, {0xE7,0xAB,0xA4,3}, {0xE7,0xAB,0xA7,3}, {0xE7,0xAB,0xA8,3}, {0xE7,0xAB,0xA9,3}, {0xE7,0xAB,0xAA,3},
+        {0xE7,0xAB,0xAB,3}, {0xE7,0xAB,0xAC,3}, {0xE7,0xAB,0xAE,3}, {0xE7,0xAB,0xB0,3}, {0xE7,0xAB,0xB1,3}, {0xE7,0xAB,0xB2,3}, {0xE7,0xAB,0xB3,3}, {0xE7,0xAB,0xB4,3},
+        {0xE7,0xAB,0xB5,3}, {0xE7,0xAB,0xB6,3}, {0xE7,0xAB,0xB7,3}, {0xE7,0xAB,0xB8,3}, {0xE7,0xAB,0xBB,3}, {0xE7,0xAB,0xBC,3}, {0xE7,0xAB,0xBE,3}, {0xE7,0xAC,0x80,3},
+        {0xE7,0xAC,0x81,3}, {0xE7,0xAC,0x82,3}, {0xE7,0xAC,0x85,3}, {0xE7,0xAC,0x87,3}, {0xE7,0xAC,0x89,3}, {0xE7,0xAC,0x8C,3}, {0xE7,0xAC,0x8D,3}, {0xE7,0xAC,0x8E,3},
+        {0xE7,0xAC,0x90,3}, {0xE7,0xAC,0x92,3}, {0xE7,0xAC,0x93,3}, {0xE7,0xAC,0x96,3}, {0xE7,0xAC,0x97,3}, {0xE7,0xAC,0x98,3}, {0xE7,0xAC,0x9A,3}, {0xE7,0xAC,0x9C,3},
+        {0xE7,0xAC,0x9D,3}, {0xE7,0xAC,0x9F,3}, {0xE7,0xAC,0xA1,3}, {0xE7,0xAC,0xA2,3}, {0xE7,0xAC,0xA3,3}, {0xE7,0xAC,0xA7,3}, {0xE7,0xAC,0xA9,3}, {0xE7,0xAC,0xAD,3},
+        {0xE6,0xB5,0xAE,3}, {0xE6,0xB6,0xAA,3}, {0xE7,0xA6,0x8F,3}, {0xE8,0xA2,0xB1,3}, {0xE5,0xBC,0x97,3}, {0xE7,0x94,0xAB,3}, {0xE6,0x8A,0x9A,3}, {0xE8,0xBE,0x85,3},
+        {0xE4,0xBF,0xAF,3}, {0xE9,0x87,0x9C,3}, {0xE6,0x96,0xA7,3}, {0xE8,0x84,0xAF,3}, {0xE8,0x85,0x91,3}, {0xE5,0xBA,0x9C,3}, {0xE8,0x85,0x90,3}, {0xE8,0xB5,0xB4,3},
+        {0xE5,0x89,0xAF,3}, {0xE8,0xA6,0x86,3}, {0xE8,0xB5,0x8B,3}, {0xE5,0xA4,0x8D,3}, {0xE5,0x82,0x85,3}, {0xE4,0xBB,0x98,3}, {0xE9,0x98,0x9C,3}, {0xE7,0x88,0xB6,3},
+        {0xE8,0x85,0xB9,3}, {0xE8,0xB4,0x9F,3}, {0xE5,0xAF,0x8C,3}, {0xE8,0xAE,0xA3,3}, {0xE9,0x99,0x84,3}, {0xE5,0xA6,0x87,3}, {0xE7,0xBC,0x9A,3}, {0xE5,0x92,0x90,3},
+        {0xE5,0x99,0xB6,3}, {0xE5,0x98,0x8E,3}, {0xE8,0xAF,0xA5,3}, {0xE6,0x94,0xB9,3}, {0xE6,0xA6,0x82,3}, {0xE9,0x92,0x99,3}, {0xE7,0x9B,0x96,3}, {0xE6,0xBA,0x89,3},
+        {0xE5,0xB9,0xB2,3}, {0xE7,0x94,0x98,3}, {0xE6,0x9D,0x86,3}, {0xE6,0x9F,0x91,3}, {0xE7,0xAB,0xBF,3}, {0xE8,0x82,0x9D,3}, {0xE8,0xB5,0xB6,3}, {0xE6,0x84,0x9F,3},
+        {0xE7,0xA7,0x86,3}, {0xE6,0x95,0xA2,3}, {0xE8,0xB5,0xA3,3}, {0xE5,0x86,0x88,3}, {0xE5,0x88,0x9A,3}, {0xE9,0x92,0xA2,3}, {0xE7,0xBC,0xB8,3}, {0xE8,0x82,0x9B,3},
+        {0xE7,0xBA,0xB2,3}, {0xE5,0xB2,0x97,3}, {0xE6,0xB8,0xAF,3}, {0xE6,0x9D,0xA0,3}, {0xE7,0xAF,0x99,3}, {0xE7,0x9A,0x8B,3}, {0xE9,0xAB,0x98,3}, {0xE8,0x86,0x8F,3},
+        {0xE7,0xBE,0x94,3}, {0xE7,0xB3,0x95,3}, {0xE6,0x90,0x9E,3}, {0xE9,0x95,0x90,3}, {0xE7,0xA8,0xBF,3}, {0xE5,0x91,0x8A,3}, {0xE5,0x93,0xA5,3}, {0xE6,0xAD,0x8C,3},
+        {0xE6,0x90,0x81,3}, {0xE6,0x88,0x88,3}, {0xE9,0xB8,0xBD,3}, {0xE8,0x83,0xB3,3}, {0xE7,0x96,0x99,3}, {0xE5,0x89,0xB2,3}, {0xE9,0x9D,0xA9,3}, {0xE8,0x91,0x9B,3},
+        {0xE6,0xA0,0xBC,3}, {0xE8,0x9B,0xA4,3}, {0xE9,0x98,0x81,3}, {0xE9,0x9A,0x94,3}, {0xE9,0x93,0xAC,3}, {0xE4,0xB8,0xAA,3}, {0xE5,0x90,0x84,3}, {0xE7,0xBB,0x99,3},
+        {0xE6,0xA0,0xB9,3}, {0xE8,0xB7,0x9F,3}, {0xE8,0x80,0x95,3}, {0xE6,0x9B,0xB4,3}, {0xE5,0xBA,0x9A,3}, {0xE7,0xBE,0xB9,3},
+    },
+    /* 0xB9 */ {
+        {0xE7,0xAC,0xAF,3}, {0xE7,0xAC,0xB0,3}, {0xE7,0xAC,0xB2,3}, {0xE7,0xAC,0xB4,3}, {0xE7,0xAC,0xB5,3}, {0xE7,0xAC,0xB6,3}, {0xE7,0xAC,0xB7,3}, {0xE7,0xAC,0xB9,3},
+        {0xE7,0xAC,0xBB,3}, {0xE7,0xAC,0xBD,3}, {0xE7,0xAC,0xBF,3}, {0xE7,0xAD,0x80,3}, {0xE7,0xAD,0x81,3}, {0xE7,0xAD,0x82,3}, {0xE7,0xAD,0x83,3}, {0xE7,0xAD,0x84,3},
+        {0xE7,0xAD,0x86,3}, {0xE7,0xAD,0x88,3}, {0xE7,0xAD,0x8A,3}, {0xE7,0xAD,0x8D,3}, {0xE7,0xAD,0x8E,3}, {0xE7,0xAD,0x93,3}, {0xE7,0xAD,0x95,3}, {0xE7,0xAD,0x97,3},
+        {0xE7,0xAD,0x99,3}, {0xE7,0xAD,0x9C,3}, {0xE7,0xAD,0x9E,3}, {0xE7,0xAD,0x9F,3}, {0xE7,0xAD,0xA1,3}, {0xE7,0xAD,0xA3,3}, {0xE7,0xAD,0xA4,3}, {0xE7,0xAD,0xA5,3},
+        {0xE7,0xAD,0xA6,3}, {0xE7,0xAD,0xA7,3}, {0xE7,0xAD,0xA8,3}, {0xE7,0xAD,0xA9,3}, {0xE7,0xAD,0xAA,3}, {0xE7,0xAD,0xAB,3}, {0xE7,0xAD,0xAC,3}, {0xE7,0xAD,0xAD,3},
+        {0xE7,0xAD,0xAF,3}, {0xE7,0xAD,0xB0,3}, {0xE7,0xAD,0xB3,3}, {0xE7,0xAD,0xB4,3}, {0xE7,0xAD,0xB6,3}, {0xE7,0xAD,0xB8,3}, {0xE7,0xAD,0xBA,3}, {0xE7,0xAD,0xBC,3},
+        {0xE7,0xAD,0xBD,3}, {0xE7,0xAD,0xBF,3}, {0xE7,0xAE,0x81,3}, {0xE7,0xAE,0x82,3}, {0xE7,0xAE,0x83,3}, {0xE7,0xAE,0x84,3}, {0xE7,0xAE,0x86,3}, {0xE7,0xAE,0x87,3},
+        {0xE7,0xAE,0x88,3}, {0xE7,0xAE,0x89,3}, {0xE7,0xAE,0x8A,3}, {0xE7,0xAE,0x8B,3}, {0xE7,0xAE,0x8C,3}, {0xE7,0xAE,0x8E,3}, {0xE7,0xAE,0x8F,3}, {0xE7,0xAE,0x91,3},
+        {0xE7,0xAE,0x92,3}, {0xE7,0xAE,0x93,3}, {0xE7,0xAE,0x96,3}, {0xE7,0xAE,0x98,3}, {0xE7,0xAE,0x99,3}, {0xE7,0xAE,0x9A,3}, {0xE7,0xAE,0x9B,3}, {0xE7,0xAE,0x9E,3},
+        {0xE7,0xAE,0x9F,3}, {0xE7,0xAE,0xA0,3}, {0xE7,0xAE,0xA3,3}, {0xE7,0xAE,0xA4,3}, {0xE7,0xAE,0xA5,3}, {0xE7,0xAE,0xAE,3}, {0xE7,0xAE,0xAF,3}, {0xE7,0xAE,0xB0,3},
+        {0xE7,0xAE,0xB2,3}, {0xE7,0xAE,0xB3,3}, {0xE7,0xAE,0xB5,3}, {0xE7,0xAE,0xB6,3}, {0xE7,0xAE,0xB7,3}, {0xE7,0xAE,0xB9,3}, {0xE7,0xAE,0xBA,3}, {0xE7,0xAE,0xBB,3},
+        {0xE7,0xAE,0xBC,3}, {0xE7,0xAE,0xBD,3}, {0xE7,0xAE,0xBE,3}, {0xE7,0xAE,0xBF,3}, {0xE7,0xAF,0x80,3}, {0xE7,0xAF,0x82,3}, {0xE7,0xAF,0x83,3}, {0xE7,0xAF,0x84,3},
+        {0xE5,0x9F,0x82,3}, {0xE8,0x80,0xBF,3}, {0xE6,0xA2,0x97,3}, {0xE5,0xB7,0xA5,3}, {0xE6,0x94,0xBB,3}, {0xE5,0x8A,0x9F,3}, {0xE6,0x81,0xAD,3}, {0xE9,0xBE,0x9A,3},
+        {0xE4,0xBE,0x9B,3}, {0xE8,0xBA,0xAC,3}, {0xE5,0x85,0xAC,3}, {0xE5,0xAE,0xAB,3}, {0xE5,0xBC,0x93,3}, {0xE5,0xB7,0xA9,3}, {0xE6,0xB1,0x9E,3}, {0xE6,0x8B,0xB1,3},
+        {0xE8,0xB4,0xA1,3}, {0xE5,0x85,0xB1,3}, {0xE9,0x92,0xA9,3}, {0xE5,0x8B,0xBE,3}, {0xE6,0xB2,0x9F,3}, {0xE8,0x8B,0x9F,3}, {0xE7,0x8B,0x97,3}, {0xE5,0x9E,0xA2,3},
+        {0xE6,0x9E,0x84,3}, {0xE8,0xB4,0xAD,3}, {0xE5,0xA4,0x9F,3}, {0xE8,0xBE,0x9C,3}, {0xE8,0x8F,0x87,3}, {0xE5,0x92,0x95,3}, {0xE7,0xAE,0x8D,3}, {0xE4,0xBC,0xB0,3},
+        {0xE6,0xB2,0xBD,3}, {0xE5,0xAD,0xA4,3}, {0xE5,0xA7,0x91,3}, {0xE9,0xBC,0x93,3}, {0xE5,0x8F,0xA4,3}, {0xE8,0x9B,0x8A,3}, {0xE9,0xAA,0xA8,3}, {0xE8,0xB0,0xB7,3},
+        {0xE8,0x82,0xA1,3}, {0xE6,0x95,0x85,3}, {0xE9,0xA1,0xBE,3}, {0xE5,0x9B,0xBA,3}, {0xE9,0x9B,0x87,3}, {0xE5,0x88,0xAE,3}, {0xE7,0x93,0x9C,3}, {0xE5,0x89,0x90,3},
+        {0xE5,0xAF,0xA1,3}, {0xE6,0x8C,0x82,3}, {0xE8,0xA4,0x82,3}, {0xE4,0xB9,0x96,3}, {0xE6,0x8B,0x90,3}, {0xE6,0x80,0xAA,3}, {0xE6,0xA3,0xBA,3}, {0xE5,0x85,0xB3,3},
+        {0xE5,0xAE,0x98,3}, {0xE5,0x86,0xA0,3}, {0xE8,0xA7,0x82,3}, {0xE7,0xAE,0xA1,3}, {0xE9,0xA6,0x86,3}, {0xE7,0xBD,0x90,3}, {0xE6,0x83,0xAF,3}, {0xE7,0x81,0x8C,3},
+        {0xE8,0xB4,0xAF,3}, {0xE5,0x85,0x89,3}, {0xE5,0xB9,0xBF,3}, {0xE9,0x80,0x9B,3}, {0xE7,0x91,0xB0,3}, {0xE8,0xA7,0x84,3}, {0xE5,0x9C,0xAD,3}, {0xE7,0xA1,0x85,3},
+        {0xE5,0xBD,0x92,3}, {0xE9,0xBE,0x9F,3}, {0xE9,0x97,0xBA,3}, {0xE8,0xBD,0xA8,3}, {0xE9,0xAC,0xBC,3}, {0xE8,0xAF,0xA1,3}, {0xE7,0x99,0xB8,3}, {0xE6,0xA1,0x82,3},
+        {0xE6,0x9F,0x9C,3}, {0xE8,0xB7,0xAA,3}, {0xE8,0xB4,0xB5,3}, {0xE5,0x88,0xBD,3}, {0xE8,0xBE,0x8A,3}, {0xE6,0xBB,0x9A,3}, {0xE6,0xA3,0x8D,3}, {0xE9,0x94,0x85,3},
+        {0xE9,0x83,0xAD,3}, {0xE5,0x9B,0xBD,3}, {0xE6,0x9E,0x9C,3}, {0xE8,0xA3,0xB9,3}, {0xE8,0xBF,0x87,3}, {0xE5,0x93,0x88,3},
+    },
+    /* 0xBA */ {
+        {0xE7,0xAF,0x85,3}, {0xE7,0xAF,0x88,3}, {0xE7,0xAF,0x89,3}, {0xE7,0xAF,0x8A,3}, {0xE7,0xAF,0x8B,3}, {0xE7,0xAF,0x8D,3}, {0xE7,0xAF,0x8E,3}, {0xE7,0xAF,0x8F,3},
+        {0xE7,0xAF,0x90,3}, {0xE7,0xAF,0x92,3}, {0xE7,0xAF,0x94,3}, {0xE7,0xAF,0x95,3}, {0xE7,0xAF,0x96,3}, {0xE7,0xAF,0x97,3}, {0xE7,0xAF,0x98,3}, {0xE7,0xAF,0x9B,3},
+        {0xE7,0xAF,0x9C,3}, {0xE7,0xAF,0x9E,3}, {0xE7,0xAF,0x9F,3}, {0xE7,0xAF,0xA0,3}, {0xE7,0xAF,0xA2,3}, {0xE7,0xAF,0xA3,3}, {0xE7,0xAF,0xA4,3}, {0xE7,0xAF,0xA7,3},
+        {0xE7,0xAF,0xA8,3}, {0xE7,0xAF,0xA9,3}, {0xE7,0xAF,0xAB,3}, {0xE7,0xAF,0xAC,3}, {0xE7,0xAF,0xAD,3}, {0xE7,0xAF,0xAF,3}, {0xE7,0xAF,0xB0,3}, {0xE7,0xAF,0xB2,3},
+        {0xE7,0xAF,0xB3,3}, {0xE7,0xAF,0xB4,3}, {0xE7,0xAF,0xB5,3}, {0xE7,0xAF,0xB6,3}, {0xE7,0xAF,0xB8,3}, {0xE7,0xAF,0xB9,3}, {0xE7,0xAF,0xBA,3}, {0xE7,0xAF,0xBB,3},
+        {0xE7,0xAF,0xBD,3}, {0xE7,0xAF,0xBF,3}, {0xE7,0xB0,0x80,3}, {0xE7,0xB0,0x81,3}, {0xE7,0xB0,0x82,3}, {0xE7,0xB0,0x83,3}, {0xE7,0xB0,0x84,3}, {0xE7,0xB0,0x85,3},
+        {0xE7,0xB0,0x86,3}, {0xE7,0xB0,0x88,3}, {0xE7,0xB0,0x89,3}, {0xE7,0xB0,0x8A,3}, {0xE7,0xB0,0x8D,3}, {0xE7,0xB0,0x8E,3}, {0xE7,0xB0,0x90,3}, {0xE7,0xB0,0x91,3},
+        {0xE7,0xB0,0x92,3}, {0xE7,0xB0,0x93,3}, {0xE7,0xB0,0x94,3}, {0xE7,0xB0,0x95,3}, {0xE7,0xB0,0x97,3}, {0xE7,0xB0,0x98,3}, {0xE7,0xB0,0x99,3}, {0xE7,0xB0,0x9A,3},
+        {0xE7,0xB0,0x9B,3}, {0xE7,0xB0,0x9C,3}, {0xE7,0xB0,0x9D,3}, {0xE7,0xB0,0x9E,3}, {0xE7,0xB0,0xA0,3}, {0xE7,0xB0,0xA1,3}, {0xE7,0xB0,0xA2,3}, {0xE7,0xB0,0xA3,3},
+        {0xE7,0xB0,0xA4,3}, {0xE7,0xB0,0xA5,3}, {0xE7,0xB0,0xA8,3}, {0xE7,0xB0,0xA9,3}, {0xE7,0xB0,0xAB,3}, {0xE7,0xB0,0xAC,3}, {0xE7,0xB0,0xAD,3}, {0xE7,0xB0,0xAE,3},
+        {0xE7,0xB0,0xAF,3}, {0xE7,0xB0,0xB0,3}, {0xE7,0xB0,0xB1,3}, {0xE7,0xB0,0xB2,3}, {0xE7,0xB0,0xB3,3}, {0xE7,0xB0,0xB4,3}, {0xE7,0xB0,0xB5,3}, {0xE7,0xB0,0xB6,3},
+        {0xE7,0xB0,0xB7,3}, {0xE7,0xB0,0xB9,3}, {0xE7,0xB0,0xBA,3}, {0xE7,0xB0,0xBB,3}, {0xE7,0xB0,0xBC,3}, {0xE7,0xB0,0xBD,3}, {0xE7,0xB0,0xBE,3}, {0xE7,0xB1,0x82,3},
+        {0xE9,0xAA,0xB8,3}, {0xE5,0xAD,0xA9,3}, {0xE6,0xB5,0xB7,3}, {0xE6,0xB0,0xA6,3}, {0xE4,0xBA,0xA5,3}, {0xE5,0xAE,0xB3,3}, {0xE9,0xAA,0x87,3}, {0xE9,0x85,0xA3,3},
+        {0xE6,0x86,0xA8,3}, {0xE9,0x82,0xAF,3}, {0xE9,0x9F,0xA9,3}, {0xE5,0x90,0xAB,3}, {0xE6,0xB6,0xB5,3}, {0xE5,0xAF,0x92,3}, {0xE5,0x87,0xBD,3}, {0xE5,0x96,0x8A,3},
+        {0xE7,0xBD,0x95,3}, {0xE7,0xBF,0xB0,3}, {0xE6,0x92,0xBC,3}, {0xE6,0x8D,0x8D,3}, {0xE6,0x97,0xB1,3}, {0xE6,0x86,0xBE,3}, {0xE6,0x82,0x8D,3}, {0xE7,0x84,0x8A,3},
+        {0xE6,0xB1,0x97,3}, {0xE6,0xB1,0x89,3}, {0xE5,0xA4,0xAF,3}, {0xE6,0x9D,0xAD,3}, {0xE8,0x88,0xAA,3}, {0xE5,0xA3,0x95,3}, {0xE5,0x9A,0x8E,3}, {0xE8,0xB1,0xAA,3},
+        {0xE6,0xAF,0xAB,3}, {0xE9,0x83,0x9D,3}, {0xE5,0xA5,0xBD,3}, {0xE8,0x80,0x97,3}, {0xE5,0x8F,0xB7,3}, {0xE6,0xB5,0xA9,3}, {0xE5,0x91,0xB5,3}, {0xE5,0x96,0x9D,3},
+        {0xE8,0x8D,0xB7,3}, {0xE8,0x8F,0x8F,3}, {0xE6,0xA0,0xB8,3}, {0xE7,0xA6,0xBE,3}, {0xE5,0x92,0x8C,3}, {0xE4,0xBD,0x95,3}, {0xE5,0x90,0x88,3}, {0xE7,0x9B,0x92,3},
+        {0xE8,0xB2,0x89,3}, {0xE9,0x98,0x82,3}, {0xE6,0xB2,0xB3,3}, {0xE6,0xB6,0xB8,3}, {0xE8,0xB5,0xAB,3}, {0xE8,0xA4,0x90,3}, {0xE9,0xB9,0xA4,3}, {0xE8,0xB4,0xBA,3},
+        {0xE5,0x98,0xBF,3}, {0xE9,0xBB,0x91,3}, {0xE7,0x97,0x95,3}, {0xE5,0xBE,0x88,3}, {0xE7,0x8B,0xA0,3}, {0xE6,0x81,0xA8,3}, {0xE5,0x93,0xBC,3}, {0xE4,0xBA,0xA8,3},
+        {0xE6,0xA8,0xAA,3}, {0xE8,0xA1,0xA1,3}, {0xE6,0x81,0x92,3}, {0xE8,0xBD,0xB0,3}, {0xE5,0x93,0x84,3}, {0xE7,0x83,0x98,3}, {0xE8,0x99,0xB9,3}, {0xE9,0xB8,0xBF,3},
+        {0xE6,0xB4,0xAA,3}, {0xE5,0xAE,0x8F,3}, {0xE5,0xBC,0x98,3}, {0xE7,0xBA,0xA2,3}, {0xE5,0x96,0x89,3}, {0xE4,0xBE,0xAF,3}, {0xE7,0x8C,0xB4,3}, {0xE5,0x90,0xBC,3},
+        {0xE5,0x8E,0x9A,3}, {0xE5,0x80,0x99,3}, {0xE5,0x90,0x8E,3}, {0xE5,0x91,0xBC,3}, {0xE4,0xB9,0x8E,3}, {0xE5,0xBF,0xBD,3}, {0xE7,0x91,0x9A,3}, {0xE5,0xA3,0xB6,3},
+        {0xE8,0x91,0xAB,3}, {0xE8,0x83,0xA1,3}, {0xE8,0x9D,0xB4,3}, {0xE7,0x8B,0x90,3}, {0xE7,0xB3,0x8A,3}, {0xE6,0xB9,0x96,3},
+    },
+    /* 0xBB */ {
+        {0xE7,0xB1,0x83,3}, {0xE7,0xB1,0x84,3}, {0xE7,0xB1,0x85,3}, {0xE7,0xB1,0x86,3}, {0xE7,0xB1,0x87,3}, {0xE7,0xB1,0x88,3}, {0xE7,0xB1,0x89,3}, {0xE7,0xB1,0x8A,3},
+        {0xE7,0xB1,0x8B,3}, {0xE7,0xB1,0x8C,3}, {0xE7,0xB1,0x8E,3}, {0xE7,0xB1,0x8F,3}, {0xE7,0xB1,0x90,3}, {0xE7,0xB1,0x91,3}, {0xE7,0xB1,0x92,3}, {0xE7,0xB1,0x93,3},
+        {0xE7,0xB1,0x94,3}, {0xE7,0xB1,0x95,3}, {0xE7,0xB1,0x96,3}, {0xE7,0xB1,0x97,3}, {0xE7,0xB1,0x98,3}, {0xE7,0xB1,0x99,3}, {0xE7,0xB1,0x9A,3}, {0xE7,0xB1,0x9B,3},
+        {0xE7,0xB1,0x9C,3}, {0xE7,0xB1,0x9D,3}, {0xE7,0xB1,0x9E,3}, {0xE7,0xB1,0x9F,3}, {0xE7,0xB1,0xA0,3}, {0xE7,0xB1,0xA1,3}, {0xE7,0xB1,0xA2,3}, {0xE7,0xB1,0xA3,3},
+        {0xE7,0xB1,0xA4,3}, {0xE7,0xB1,0xA5,3}, {0xE7,0xB1,0xA6,3}, {0xE7,0xB1,0xA7,3}, {0xE7,0xB1,0xA8,3}, {0xE7,0xB1,0xA9,3}, {0xE7,0xB1,0xAA,3}, {0xE7,0xB1,0xAB,3},
+        {0xE7,0xB1,0xAC,3}, {0xE7,0xB1,0xAD,3}, {0xE7,0xB1,0xAE,3}, {0xE7,0xB1,0xAF,3}, {0xE7,0xB1,0xB0,3}, {0xE7,0xB1,0xB1,3}, {0xE7,0xB1,0xB2,3}, {0xE7,0xB1,0xB5,3},
+        {0xE7,0xB1,0xB6,3}, {0xE7,0xB1,0xB7,3}, {0xE7,0xB1,0xB8,3}, {0xE7,0xB1,0xB9,3}, {0xE7,0xB1,0xBA,3}, {0xE7,0xB1,0xBE,3}, {0xE7,0xB1,0xBF,3}, {0xE7,0xB2,0x80,3},
+        {0xE7,0xB2,0x81,3}, {0xE7,0xB2,0x82,3}, {0xE7,0xB2,0x83,3}, {0xE7,0xB2,0x84,3}, {0xE7,0xB2,0x85,3}, {0xE7,0xB2,0x86,3}, {0xE7,0xB2,0x87,3}, {0xE7,0xB2,0x88,3},
+        {0xE7,0xB2,0x8A,3}, {0xE7,0xB2,0x8B,3}, {0xE7,0xB2,0x8C,3}, {0xE7,0xB2,0x8D,3}, {0xE7,0xB2,0x8E,3}, {0xE7,0xB2,0x8F,3}, {0xE7,0xB2,0x90,3}, {0xE7,0xB2,0x93,3},
+        {0xE7,0xB2,0x94,3}, {0xE7,0xB2,0x96,3}, {0xE7,0xB2,0x99,3}, {0xE7,0xB2,0x9A,3}, {0xE7,0xB2,0x9B,3}, {0xE7,0xB2,0xA0,3}, {0xE7,0xB2,0xA1,3}, {0xE7,0xB2,0xA3,3},
+        {0xE7,0xB2,0xA6,3}, {0xE7,0xB2,0xA7,3}, {0xE7,0xB2,0xA8,3}, {0xE7,0xB2,0xA9,3}, {0xE7,0xB2,0xAB,3}, {0xE7,0xB2,0xAC,3}, {0xE7,0xB2,0xAD,3}, {0xE7,0xB2,0xAF,3},
+        {0xE7,0xB2,0xB0,3}, {0xE7,0xB2,0xB4,3}, {0xE7,0xB2,0xB5,3}, {0xE7,0xB2,0xB6,3}, {0xE7,0xB2,0xB7,3}, {0xE7,0xB2,0xB8,3}, {0xE7,0xB2,0xBA,3}, {0xE7,0xB2,0xBB,3},
+        {0xE5,0xBC,0xA7,3}, {0xE8,0x99,0x8E,3}, {0xE5,0x94,0xAC,3}, {0xE6,0x8A,0xA4,3}, {0xE4,0xBA,0x92,3}, {0xE6,0xB2,0xAA,3}, {0xE6,0x88,0xB7,3}, {0xE8,0x8A,0xB1,3},
+        {0xE5,0x93,0x97,3}, {0xE5,0x8D,0x8E,3}, {0xE7,0x8C,0xBE,3}, {0xE6,0xBB,0x91,3}, {0xE7,0x94,0xBB,3}, {0xE5,0x88,0x92,3}, {0xE5,0x8C,0x96,3}, {0xE8,0xAF,0x9D,3},
+        {0xE6,0xA7,0x90,3}, {0xE5,0xBE,0x8A,3}, {0xE6,0x80,0x80,3}, {0xE6,0xB7,0xAE,3}, {0xE5,0x9D,0x8F,3}, {0xE6,0xAC,0xA2,3}, {0xE7,0x8E,0xAF,3}, {0xE6,0xA1,0x93,3},
+        {0xE8,0xBF,0x98,3}, {0xE7,0xBC,0x93,3}, {0xE6,0x8D,0xA2,3}, {0xE6,0x82,0xA3,3}, {0xE5,0x94,0xA4,3}, {0xE7,0x97,0xAA,3}, {0xE8,0xB1,0xA2,3}, {0xE7,0x84,0x95,3},
+        {0xE6,0xB6,0xA3,3}, {0xE5,0xAE,0xA6,3}, {0xE5,0xB9,0xBB,3}, {0xE8,0x8D,0x92,3}, {0xE6,0x85,0x8C,3}, {0xE9,0xBB,0x84,3}, {0xE7,0xA3,0xBA,3}, {0xE8,0x9D,0x97,3},
+        {0xE7,0xB0,0xA7,3}, {0xE7,0x9A,0x87,3}, {0xE5,0x87,0xB0,3}, {0xE6,0x83,0xB6,3}, {0xE7,0x85,0x8C,3}, {0xE6,0x99,0x83,3}, {0xE5,0xB9,0x8C,3}, {0xE6,0x81,0x8D,3},
+        {0xE8,0xB0,0x8E,3}, {0xE7,0x81,0xB0,3}, {0xE6,0x8C,0xA5,3}, {0xE8,0xBE,0x89,3}, {0xE5,0xBE,0xBD,3}, {0xE6,0x81,0xA2,3}, {0xE8,0x9B,0x94,3}, {0xE5,0x9B,0x9E,3},
+        {0xE6,0xAF,0x81,3}, {0xE6,0x82,0x94,3}, {0xE6,0x85,0xA7,3}, {0xE5,0x8D,0x89,3}, {0xE6,0x83,0xA0,3}, {0xE6,0x99,0xA6,3}, {0xE8,0xB4,0xBF,3}, {0xE7,0xA7,0xBD,3},
+        {0xE4,0xBC,0x9A,3}, {0xE7,0x83,0xA9,3}, {0xE6,0xB1,0x87,3}, {0xE8,0xAE,0xB3,3}, {0xE8,0xAF,0xB2,3}, {0xE7,0xBB,0x98,3}, {0xE8,0x8D,0xA4,3}, {0xE6,0x98,0x8F,3},
+        {0xE5,0xA9,0x9A,3}, {0xE9,0xAD,0x82,3}, {0xE6,0xB5,0x91,3}, {0xE6,0xB7,0xB7,3}, {0xE8,0xB1,0x81,3}, {0xE6,0xB4,0xBB,3}, {0xE4,0xBC,0x99,3}, {0xE7,0x81,0xAB,3},
+        {0xE8,0x8E,0xB7,3}, {0xE6,0x88,0x96,3}, {0xE6,0x83,0x91,3}, {0xE9,0x9C,0x8D,3}, {0xE8,0xB4,0xA7,3}, {0xE7,0xA5,0xB8,3}, {0xE5,0x87,0xBB,3}, {0xE5,0x9C,0xBE,3},
+        {0xE5,0x9F,0xBA,3}, {0xE6,0x9C,0xBA,3}, {0xE7,0x95,0xB8,3}, {0xE7,0xA8,0xBD,3}, {0xE7,0xA7,0xAF,3}, {0xE7,0xAE,0x95,3},
+    },
+    /* 0xBC */ {
+        {0xE7,0xB2,0xBF,3}, {0xE7,0xB3,0x80,3}, {0xE7,0xB3,0x82,3}, {0xE7,0xB3,0x83,3}, {0xE7,0xB3,0x84,3}, {0xE7,0xB3,0x86,3}, {0xE7,0xB3,0x89,3}, {0xE7,0xB3,0x8B,3},
+        {0xE7,0xB3,0x8E,3}, {0xE7,0xB3,0x8F,3}, {0xE7,0xB3,0x90,3}, {0xE7,0xB3,0x91,3}, {0xE7,0xB3,0x92,3}, {0xE7,0xB3,0x93,3}, {0xE7,0xB3,0x94,3}, {0xE7,0xB3,0x98,3},
+        {0xE7,0xB3,0x9A,3}, {0xE7,0xB3,0x9B,3}, {0xE7,0xB3,0x9D,3}, {0xE7,0xB3,0x9E,3}, {0xE7,0xB3,0xA1,3}, {0xE7,0xB3,0xA2,3}, {0xE7,0xB3,0xA3,3}, {0xE7,0xB3,0xA4,3},
+        {0xE7,0xB3,0xA5,3}, {0xE7,0xB3,0xA6,3}, {0xE7,0xB3,0xA7,3}, {0xE7,0xB3,0xA9,3}, {0xE7,0xB3,0xAA,3}, {0xE7,0xB3,0xAB,3}, {0xE7,0xB3,0xAC,3}, {0xE7,0xB3,0xAD,3},
+        {0xE7,0xB3,0xAE,3}, {0xE7,0xB3,0xB0,3}, {0xE7,0xB3,0xB1,3}, {0xE7,0xB3,0xB2,3}, {0xE7,0xB3,0xB3,3}, {0xE7,0xB3,0xB4,3}, {0xE7,0xB3,0xB5,3}, {0xE7,0xB3,0xB6,3},
+        {0xE7,0xB3,0xB7,3}, {0xE7,0xB3,0xB9,3}, {0xE7,0xB3,0xBA,3}, {0xE7,0xB3,0xBC,3}, {0xE7,0xB3,0xBD,3}, {0xE7,0xB3,0xBE,3}, {0xE7,0xB3,0xBF,3}, {0xE7,0xB4,0x80,3},
+        {0xE7,0xB4,0x81,3}, {0xE7,0xB4,0x82,3}, {0xE7,0xB4,0x83,3}, {0xE7,0xB4,0x84,3}, {0xE7,0xB4,0x85,3}, {0xE7,0xB4,0x86,3}, {0xE7,0xB4,0x87,3}, {0xE7,0xB4,0x88,3},
+        {0xE7,0xB4,0x89,3}, {0xE7,0xB4,0x8B,3}, {0xE7,0xB4,0x8C,3}, {0xE7,0xB4,0x8D,3}, {0xE7,0xB4,0x8E,3}, {0xE7,0xB4,0x8F,3}, {0xE7,0xB4,0x90,3}, {0xE7,0xB4,0x91,3},
+        {0xE7,0xB4,0x92,3}, {0xE7,0xB4,0x93,3}, {0xE7,0xB4,0x94,3}, {0xE7,0xB4,0x95,3}, {0xE7,0xB4,0x96,3}, {0xE7,0xB4,0x97,3}, {0xE7,0xB4,0x98,3}, {0xE7,0xB4,0x99,3},
+        {0xE7,0xB4,0x9A,3}, {0xE7,0xB4,0x9B,3}, {0xE7,0xB4,0x9C,3}, {0xE7,0xB4,0x9D,3}, {0xE7,0xB4,0x9E,3}, {0xE7,0xB4,0x9F,3}, {0xE7,0xB4,0xA1,3}, {0xE7,0xB4,0xA3,3},
+        {0xE7,0xB4,0xA4,3}, {0xE7,0xB4,0xA5,3}, {0xE7,0xB4,0xA6,3}, {0xE7,0xB4,0xA8,3}, {0xE7,0xB4,0xA9,3}, {0xE7,0xB4,0xAA,3}, {0xE7,0xB4,0xAC,3}, {0xE7,0xB4,0xAD,3},
+        {0xE7,0xB4,0xAE,3}, {0xE7,0xB4,0xB0,3}, {0xE7,0xB4,0xB1,3}, {0xE7,0xB4,0xB2,3}, {0xE7,0xB4,0xB3,3}, {0xE7,0xB4,0xB4,3}, {0xE7,0xB4,0xB5,3}, {0xE7,0xB4,0xB6,3},
+        {0xE8,0x82,0x8C,3}, {0xE9,0xA5,0xA5,3}, {0xE8,0xBF,0xB9,3}, {0xE6,0xBF,0x80,3}, {0xE8,0xAE,0xA5,3}, {0xE9,0xB8,0xA1,3}, {0xE5,0xA7,0xAC,3}, {0xE7,0xBB,0xA9,3},
+        {0xE7,0xBC,0x89,3}, {0xE5,0x90,0x89,3}, {0xE6,0x9E,0x81,3}, {0xE6,0xA3,0x98,3}, {0xE8,0xBE,0x91,3}, {0xE7,0xB1,0x8D,3}, {0xE9,0x9B,0x86,3}, {0xE5,0x8F,0x8A,3},
+        {0xE6,0x80,0xA5,3}, {0xE7,0x96,0xBE,3}, {0xE6,0xB1,0xB2,3}, {0xE5,0x8D,0xB3,3}, {0xE5,0xAB,0x89,3}, {0xE7,0xBA,0xA7,3}, {0xE6,0x8C,0xA4,3}, {0xE5,0x87,0xA0,3},
+        {0xE8,0x84,0x8A,3}, {0xE5,0xB7,0xB1,3}, {0xE8,0x93,0x9F,3}, {0xE6,0x8A,0x80,3}, {0xE5,0x86,0x80,3}, {0xE5,0xAD,0xA3,3}, {0xE4,0xBC,0x8E,3}, {0xE7,0xA5,0xAD,3},
+        {0xE5,0x89,0x82,3}, {0xE6,0x82,0xB8,3}, {0xE6,0xB5,0x8E,3}, {0xE5,0xAF,0x84,3}, {0xE5,0xAF,0x82,3}, {0xE8,0xAE,0xA1,3}, {0xE8,0xAE,0xB0,3}, {0xE6,0x97,0xA2,3},
+        {0xE5,0xBF,0x8C,3}, {0xE9,0x99,0x85,3}, {0xE5,0xA6,0x93,3}, {0xE7,0xBB,0xA7,3}, {0xE7,0xBA,0xAA,3}, {0xE5,0x98,0x89,3}, {0xE6,0x9E,0xB7,3}, {0xE5,0xA4,0xB9,3},
+        {0xE4,0xBD,0xB3,3}, {0xE5,0xAE,0xB6,3}, {0xE5,0x8A,0xA0,3}, {0xE8,0x8D,0x9A,3}, {0xE9,0xA2,0x8A,3}, {0xE8,0xB4,0xBE,3}, {0xE7,0x94,0xB2,3}, {0xE9,0x92,0xBE,3},
+        {0xE5,0x81,0x87,3}, {0xE7,0xA8,0xBC,3}, {0xE4,0xBB,0xB7,3}, {0xE6,0x9E,0xB6,3}, {0xE9,0xA9,0xBE,3}, {0xE5,0xAB,0x81,3}, {0xE6,0xAD,0xBC,3}, {0xE7,0x9B,0x91,3},
+        {0xE5,0x9D,0x9A,3}, {0xE5,0xB0,0x96,3}, {0xE7,0xAC,0xBA,3}, {0xE9,0x97,0xB4,3}, {0xE7,0x85,0x8E,3}, {0xE5,0x85,0xBC,3}, {0xE8,0x82,0xA9,3}, {0xE8,0x89,0xB0,3},
+        {0xE5,0xA5,0xB8,3}, {0xE7,0xBC,0x84,3}, {0xE8,0x8C,0xA7,3}, {0xE6,0xA3,0x80,3}, {0xE6,0x9F,0xAC,3}, {0xE7,0xA2,0xB1,3}, {0xE7,0xA1,0xB7,3}, {0xE6,0x8B,0xA3,3},
+        {0xE6,0x8D,0xA1,3}, {0xE7,0xAE,0x80,3}, {0xE4,0xBF,0xAD,3}, {0xE5,0x89,0xAA,3}, {0xE5,0x87,0x8F,3}, {0xE8,0x8D,0x90,3}, {0xE6,0xA7,0x9B,3}, {0xE9,0x89,0xB4,3},
+        {0xE8,0xB7,0xB5,3}, {0xE8,0xB4,0xB1,3}, {0xE8,0xA7,0x81,3}, {0xE9,0x94,0xAE,3}, {0xE7,0xAE,0xAD,3}, {0xE4,0xBB,0xB6,3},
+    },
+    /* 0xBD */ {
+        {0xE7,0xB4,0xB7,3}, {0xE7,0xB4,0xB8,3}, {0xE7,0xB4,0xB9,3}, {0xE7,0xB4,0xBA,3}, {0xE7,0xB4,0xBB,3}, {0xE7,0xB4,0xBC,3}, {0xE7,0xB4,0xBD,3}, {0xE7,0xB4,0xBE,3},
+        {0xE7,0xB4,0xBF,3}, {0xE7,0xB5,0x80,3}, {0xE7,0xB5,0x81,3}, {0xE7,0xB5,0x82,3}, {0xE7,0xB5,0x83,3}, {0xE7,0xB5,0x84,3}, {0xE7,0xB5,0x85,3}, {0xE7,0xB5,0x86,3},
+        {0xE7,0xB5,0x87,3}, {0xE7,0xB5,0x88,3}, {0xE7,0xB5,0x89,3}, {0xE7,0xB5,0x8A,3}, {0xE7,0xB5,0x8B,3}, {0xE7,0xB5,0x8C,3}, {0xE7,0xB5,0x8D,3}, {0xE7,0xB5,0x8E,3},
+        {0xE7,0xB5,0x8F,3}, {0xE7,0xB5,0x90,3}, {0xE7,0xB5,0x91,3}, {0xE7,0xB5,0x92,3}, {0xE7,0xB5,0x93,3}, {0xE7,0xB5,0x94,3}, {0xE7,0xB5,0x95,3}, {0xE7,0xB5,0x96,3},
+        {0xE7,0xB5,0x97,3}, {0xE7,0xB5,0x98,3}, {0xE7,0xB5,0x99,3}, {0xE7,0xB5,0x9A,3}, {0xE7,0xB5,0x9B,3}, {0xE7,0xB5,0x9C,3}, {0xE7,0xB5,0x9D,3}, {0xE7,0xB5,0x9E,3},
+        {0xE7,0xB5,0x9F,3}, {0xE7,0xB5,0xA0,3}, {0xE7,0xB5,0xA1,3}, {0xE7,0xB5,0xA2,3}, {0xE7,0xB5,0xA3,3}, {0xE7,0xB5,0xA4,3}, {0xE7,0xB5,0xA5,3}, {0xE7,0xB5,0xA6,3},
+        {0xE7,0xB5,0xA7,3}, {0xE7,0xB5,0xA8,3}, {0xE7,0xB5,0xA9,3}, {0xE7,0xB5,0xAA,3}, {0xE7,0xB5,0xAB,3}, {0xE7,0xB5,0xAC,3}, {0xE7,0xB5,0xAD,3}, {0xE7,0xB5,0xAF,3},
+        {0xE7,0xB5,0xB0,3}, {0xE7,0xB5,0xB1,3}, {0xE7,0xB5,0xB2,3}, {0xE7,0xB5,0xB3,3}, {0xE7,0xB5,0xB4,3}, {0xE7,0xB5,0xB5,3}, {0xE7,0xB5,0xB6,3}, {0xE7,0xB5,0xB8,3},
+        {0xE7,0xB5,0xB9,3}, {0xE7,0xB5,0xBA,3}, {0xE7,0xB5,0xBB,3}, {0xE7,0xB5,0xBC,3}, {0xE7,0xB5,0xBD,3}, {0xE7,0xB5,0xBE,3}, {0xE7,0xB5,0xBF,3}, {0xE7,0xB6,0x80,3},
+        {0xE7,0xB6,0x81,3}, {0xE7,0xB6,0x82,3}, {0xE7,0xB6,0x83,3}, {0xE7,0xB6,0x84,3}, {0xE7,0xB6,0x85,3}, {0xE7,0xB6,0x86,3}, {0xE7,0xB6,0x87,3}, {0xE7,0xB6,0x88,3},
+        {0xE7,0xB6,0x89,3}, {0xE7,0xB6,0x8A,3}, {0xE7,0xB6,0x8B,3}, {0xE7,0xB6,0x8C,3}, {0xE7,0xB6,0x8D,3}, {0xE7,0xB6,0x8E,3}, {0xE7,0xB6,0x8F,3}, {0xE7,0xB6,0x90,3},
+        {0xE7,0xB6,0x91,3}, {0xE7,0xB6,0x92,3}, {0xE7,0xB6,0x93,3}, {0xE7,0xB6,0x94,3}, {0xE7,0xB6,0x95,3}, {0xE7,0xB6,0x96,3}, {0xE7,0xB6,0x97,3}, {0xE7,0xB6,0x98,3},
+        {0xE5,0x81,0xA5,3}, {0xE8,0x88,0xB0,3}, {0xE5,0x89,0x91,3}, {0xE9,0xA5,0xAF,3}, {0xE6,0xB8,0x90,3}, {0xE6,0xBA,0x85,3}, {0xE6,0xB6,0xA7,3}, {0xE5,0xBB,0xBA,3},
+        {0xE5,0x83,0xB5,3}, {0xE5,0xA7,0x9C,3}, {0xE5,0xB0,0x86,3}, {0xE6,0xB5,0x86,3}, {0xE6,0xB1,0x9F,3}, {0xE7,0x96,0x86,3}, {0xE8,0x92,0x8B,3}, {0xE6,0xA1,0xA8,3},
+        {0xE5,0xA5,0x96,3}, {0xE8,0xAE,0xB2,3}, {0xE5,0x8C,0xA0,3}, {0xE9,0x85,0xB1,3}, {0xE9,0x99,0x8D,3}, {0xE8,0x95,0x89,3}, {0xE6,0xA4,0x92,3}, {0xE7,0xA4,0x81,3},
+        {0xE7,0x84,0xA6,3}, {0xE8,0x83,0xB6,3}, {0xE4,0xBA,0xA4,3}, {0xE9,0x83,0x8A,3}, {0xE6,0xB5,0x87,3}, {0xE9,0xAA,0x84,3}, {0xE5,0xA8,0x87,3}, {0xE5,0x9A,0xBC,3},
+        {0xE6,0x90,0x85,3}, {0xE9,0x93,0xB0,3}, {0xE7,0x9F,0xAB,3}, {0xE4,0xBE,0xA5,3}, {0xE8,0x84,0x9A,3}, {0xE7,0x8B,0xA1,3}, {0xE8,0xA7,0x92,3}, {0xE9,0xA5,0xBA,3},
+        {0xE7,0xBC,0xB4,3}, {0xE7,0xBB,0x9E,3}, {0xE5,0x89,0xBF,3}, {0xE6,0x95,0x99,3}, {0xE9,0x85,0xB5,3}, {0xE8,0xBD,0xBF,3}, {0xE8,0xBE,0x83,3}, {0xE5,0x8F,0xAB,3},
+        {0xE7,0xAA,0x96,3}, {0xE6,0x8F,0xAD,3}, {0xE6,0x8E,0xA5,3}, {0xE7,0x9A,0x86,3}, {0xE7,0xA7,0xB8,3}, {0xE8,0xA1,0x97,3}, {0xE9,0x98,0xB6,3}, {0xE6,0x88,0xAA,3},
+        {0xE5,0x8A,0xAB,3}, {0xE8,0x8A,0x82,3}, {0xE6,0xA1,0x94,3}, {0xE6,0x9D,0xB0,3}, {0xE6,0x8D,0xB7,3}, {0xE7,0x9D,0xAB,3}, {0xE7,0xAB,0xAD,3}, {0xE6,0xB4,0x81,3},
+        {0xE7,0xBB,0x93,3}, {0xE8,0xA7,0xA3,3}, {0xE5,0xA7,0x90,3}, {0xE6,0x88,0x92,3}, {0xE8,0x97,0x89,3}, {0xE8,0x8A,0xA5,3}, {0xE7,0x95,0x8C,3}, {0xE5,0x80,0x9F,3},
+        {0xE4,0xBB,0x8B,3}, {0xE7,0x96,0xA5,3}, {0xE8,0xAF,0xAB,3}, {0xE5,0xB1,0x8A,3}, {0xE5,0xB7,0xBE,3}, {0xE7,0xAD,0x8B,3}, {0xE6,0x96,0xA4,3}, {0xE9,0x87,0x91,3},
+        {0xE4,0xBB,0x8A,3}, {0xE6,0xB4,0xA5,3}, {0xE8,0xA5,0x9F,3}, {0xE7,0xB4,0xA7,3}, {0xE9,0x94,0xA6,3}, {0xE4,0xBB,0x85,3}, {0xE8,0xB0,0xA8,3}, {0xE8,0xBF,0x9B,3},
+        {0xE9,0x9D,0xB3,3}, {0xE6,0x99,0x8B,3}, {0xE7,0xA6,0x81,3}, {0xE8,0xBF,0x91,3}, {0xE7,0x83,0xAC,3}, {0xE6,0xB5,0xB8,3},
+    },
+    /* 0xBE */ {
+        {0xE7,0xB6,0x99,3}, {0xE7,0xB6,0x9A,3}, {0xE7,0xB6,0x9B,3}, {0xE7,0xB6,0x9C,3}, {0xE7,0xB6,0x9D,3}, {0xE7,0xB6,0x9E,3}, {0xE7,0xB6,0x9F,3}, {0xE7,0xB6,0xA0,3},
+        {0xE7,0xB6,0xA1,3}, {0xE7,0xB6,0xA2,3}, {0xE7,0xB6,0xA3,3}, {0xE7,0xB6,0xA4,3}, {0xE7,0xB6,0xA5,3}, {0xE7,0xB6,0xA7,3}, {0xE7,0xB6,0xA8,3}, {0xE7,0xB6,0xA9,3},
+        {0xE7,0xB6,0xAA,3}, {0xE7,0xB6,0xAB,3}, {0xE7,0xB6,0xAC,3}, {0xE7,0xB6,0xAD,3}, {0xE7,0xB6,0xAF,3}, {0xE7,0xB6,0xB0,3}, {0xE7,0xB6,0xB1,3}, {0xE7,0xB6,0xB2,3},
+        {0xE7,0xB6,0xB3,3}, {0xE7,0xB6,0xB4,3}, {0xE7,0xB6,0xB5,3}, {0xE7,0xB6,0xB6,3}, {0xE7,0xB6,0xB7,3}, {0xE7,0xB6,0xB8,3}, {0xE7,0xB6,0xB9,3}, {0xE7,0xB6,0xBA,3},
+        {0xE7,0xB6,0xBB,3}, {0xE7,0xB6,0xBC,3}, {0xE7,0xB6,0xBD,3}, {0xE7,0xB6,0xBE,3}, {0xE7,0xB6,0xBF,3}, {0xE7,0xB7,0x80,3}, {0xE7,0xB7,0x81,3}, {0xE7,0xB7,0x82,3},
+        {0xE7,0xB7,0x83,3}, {0xE7,0xB7,0x84,3}, {0xE7,0xB7,0x85,3}, {0xE7,0xB7,0x86,3}, {0xE7,0xB7,0x87,3}, {0xE7,0xB7,0x88,3}, {0xE7,0xB7,0x89,3}, {0xE7,0xB7,0x8A,3},
+        {0xE7,0xB7,0x8B,3}, {0xE7,0xB7,0x8C,3}, {0xE7,0xB7,0x8D,3}, {0xE7,0xB7,0x8E,3}, {0xE7,0xB7,0x8F,3}, {0xE7,0xB7,0x90,3}, {0xE7,0xB7,0x91,3}, {0xE7,0xB7,0x92,3},
+        {0xE7,0xB7,0x93,3}, {0xE7,0xB7,0x94,3}, {0xE7,0xB7,0x95,3}, {0xE7,0xB7,0x96,3}, {0xE7,0xB7,0x97,3}, {0xE7,0xB7,0x98,3}, {0xE7,0xB7,0x99,3}, {0xE7,0xB7,0x9A,3},
+        {0xE7,0xB7,0x9B,3}, {0xE7,0xB7,0x9C,3}, {0xE7,0xB7,0x9D,3}, {0xE7,0xB7,0x9E,3}, {0xE7,0xB7,0x9F,3}, {0xE7,0xB7,0xA0,3}, {0xE7,0xB7,0xA1,3}, {0xE7,0xB7,0xA2,3},
+        {0xE7,0xB7,0xA3,3}, {0xE7,0xB7,0xA4,3}, {0xE7,0xB7,0xA5,3}, {0xE7,0xB7,0xA6,3}, {0xE7,0xB7,0xA7,3}, {0xE7,0xB7,0xA8,3}, {0xE7,0xB7,0xA9,3}, {0xE7,0xB7,0xAA,3},
+        {0xE7,0xB7,0xAB,3}, {0xE7,0xB7,0xAC,3}, {0xE7,0xB7,0xAD,3}, {0xE7,0xB7,0xAE,3}, {0xE7,0xB7,0xAF,3}, {0xE7,0xB7,0xB0,3}, {0xE7,0xB7,0xB1,3}, {0xE7,0xB7,0xB2,3},
+        {0xE7,0xB7,0xB3,3}, {0xE7,0xB7,0xB4,3}, {0xE7,0xB7,0xB5,3}, {0xE7,0xB7,0xB6,3}, {0xE7,0xB7,0xB7,3}, {0xE7,0xB7,0xB8,3}, {0xE7,0xB7,0xB9,3}, {0xE7,0xB7,0xBA,3},
+        {0xE5,0xB0,0xBD,3}, {0xE5,0x8A,0xB2,3}, {0xE8,0x8D,0x86,3}, {0xE5,0x85,0xA2,3}, {0xE8,0x8C,0x8E,3}, {0xE7,0x9D,0x9B,3}, {0xE6,0x99,0xB6,3}, {0xE9,0xB2,0xB8,3},
+        {0xE4,0xBA,0xAC,3}, {0xE6,0x83,0x8A,3}, {0xE7,0xB2,0xBE,3}, {0xE7,0xB2,0xB3,3}, {0xE7,0xBB,0x8F,3}, {0xE4,0xBA,0x95,3}, {0xE8,0xAD,0xA6,3}, {0xE6,0x99,0xAF,3},
+        {0xE9,0xA2,0x88,3}, {0xE9,0x9D,0x99,3}, {0xE5,0xA2,0x83,3}, {0xE6,0x95,0xAC,3}, {0xE9,0x95,0x9C,3}, {0xE5,0xBE,0x84,3}, {0xE7,0x97,0x89,3}, {0xE9,0x9D,0x96,3},
+        {0xE7,0xAB,0x9F,3}, {0xE7,0xAB,0x9E,3}, {0xE5,0x87,0x80,3}, {0xE7,0x82,0xAF,3}, {0xE7,0xAA,0x98,3}, {0xE6,0x8F,0xAA,3}, {0xE7,0xA9,0xB6,3}, {0xE7,0xBA,0xA0,3},
+        {0xE7,0x8E,0x96,3}, {0xE9,0x9F,0xAD,3}, {0xE4,0xB9,0x85,3}, {0xE7,0x81,0xB8,3}, {0xE4,0xB9,0x9D,3}, {0xE9,0x85,0x92,3}, {0xE5,0x8E,0xA9,3}, {0xE6,0x95,0x91,3},
+        {0xE6,0x97,0xA7,3}, {0xE8,0x87,0xBC,3}, {0xE8,0x88,0x85,3}, {0xE5,0x92,0x8E,3}, {0xE5,0xB0,0xB1,3}, {0xE7,0x96,0x9A,3}, {0xE9,0x9E,0xA0,3}, {0xE6,0x8B,0x98,3},
+        {0xE7,0x8B,0x99,3}, {0xE7,0x96,0xBD,3}, {0xE5,0xB1,0x85,3}, {0xE9,0xA9,0xB9,3}, {0xE8,0x8F,0x8A,3}, {0xE5,0xB1,0x80,3}, {0xE5,0x92,0x80,3}, {0xE7,0x9F,0xA9,3},
+        {0xE4,0xB8,0xBE,3}, {0xE6,0xB2,0xAE,3}, {0xE8,0x81,0x9A,3}, {0xE6,0x8B,0x92,3}, {0xE6,0x8D,0xAE,3}, {0xE5,0xB7,0xA8,3}, {0xE5,0x85,0xB7,3}, {0xE8,0xB7,0x9D,3},
+        {0xE8,0xB8,0x9E,3}, {0xE9,0x94,0xAF,3}, {0xE4,0xBF,0xB1,3}, {0xE5,0x8F,0xA5,3}, {0xE6,0x83,0xA7,3}, {0xE7,0x82,0xAC,3}, {0xE5,0x89,0xA7,3}, {0xE6,0x8D,0x90,3},
+        {0xE9,0xB9,0x83,3}, {0xE5,0xA8,0x9F,3}, {0xE5,0x80,0xA6,3}, {0xE7,0x9C,0xB7,3}, {0xE5,0x8D,0xB7,3}, {0xE7,0xBB,0xA2,3}, {0xE6,0x92,0x85,3}, {0xE6,0x94,0xAB,3},
+        {0xE6,0x8A,0x89,3}, {0xE6,0x8E,0x98,3}, {0xE5,0x80,0x94,3}, {0xE7,0x88,0xB5,3}, {0xE8,0xA7,0x89,3}, {0xE5,0x86,0xB3,3}, {0xE8,0xAF,0x80,3}, {0xE7,0xBB,0x9D,3},
+        {0xE5,0x9D,0x87,3}, {0xE8,0x8F,0x8C,3}, {0xE9,0x92,0xA7,3}, {0xE5,0x86,0x9B,3}, {0xE5,0x90,0x9B,3}, {0xE5,0xB3,0xBB,3},
+    },
+    /* 0xBF */ {
+        {0xE7,0xB7,0xBB,3}, {0xE7,0xB7,0xBC,3}, {0xE7,0xB7,0xBD,3}, {0xE7,0xB7,0xBE,3}, {0xE7,0xB7,0xBF,3}, {0xE7,0xB8,0x80,3}, {0xE7,0xB8,0x81,3}, {0xE7,0xB8,0x82,3},
+        {0xE7,0xB8,0x83,3}, {0xE7,0xB8,0x84,3}, {0xE7,0xB8,0x85,3}, {0xE7,0xB8,0x86,3}, {0xE7,0xB8,0x87,3}, {0xE7,0xB8,0x88,3}, {0xE7,0xB8,0x89,3}, {0xE7,0xB8,0x8A,3},
+        {0xE7,0xB8,0x8B,3}, {0xE7,0xB8,0x8C,3}, {0xE7,0xB8,0x8D,3}, {0xE7,0xB8,0x8E,3}, {0xE7,0xB8,0x8F,3}, {0xE7,0xB8,0x90,3}, {0xE7,0xB8,0x91,3}, {0xE7,0xB8,0x92,3},
+        {0xE7,0xB8,0x93,3}, {0xE7,0xB8,0x94,3}, {0xE7,0xB8,0x95,3}, {0xE7,0xB8,0x96,3}, {0xE7,0xB8,0x97,3}, {0xE7,0xB8,0x98,3}, {0xE7,0xB8,0x99,3}, {0xE7,0xB8,0x9A,3},
+        {0xE7,0xB8,0x9B,3}, {0xE7,0xB8,0x9C,3}, {0xE7,0xB8,0x9D,3}, {0xE7,0xB8,0x9E,3}, {0xE7,0xB8,0x9F,3}, {0xE7,0xB8,0xA0,3}, {0xE7,0xB8,0xA1,3}, {0xE7,0xB8,0xA2,3},
+        {0xE7,0xB8,0xA3,3}, {0xE7,0xB8,0xA4,3}, {0xE7,0xB8,0xA5,3}, {0xE7,0xB8,0xA6,3}, {0xE7,0xB8,0xA7,3}, {0xE7,0xB8,0xA8,3}, {0xE7,0xB8,0xA9,3}, {0xE7,0xB8,0xAA,3},
+        {0xE7,0xB8,0xAB,3}, {0xE7,0xB8,0xAC,3}, {0xE7,0xB8,0xAD,3}, {0xE7,0xB8,0xAE,3}, {0xE7,0xB8,0xAF,3}, {0xE7,0xB8,0xB0,3}, {0xE7,0xB8,0xB1,3}, {0xE7,0xB8,0xB2,3},
+        {0xE7,0xB8,0xB3,3}, {0xE7,0xB8,0xB4,3}, {0xE7,0xB8,0xB5,3}, {0xE7,0xB8,0xB6,3}, {0xE7,0xB8,0xB7,3}, {0xE7,0xB8,0xB8,3}, {0xE7,0xB8,0xB9,3}, {0xE7,0xB8,0xBA,3},
+        {0xE7,0xB8,0xBC,3}, {0xE7,0xB8,0xBD,3}, {0xE7,0xB8,0xBE,3}, {0xE7,0xB8,0xBF,3}, {0xE7,0xB9,0x80,3}, {0xE7,0xB9,0x82,3}, {0xE7,0xB9,0x83,3}, {0xE7,0xB9,0x84,3},
+        {0xE7,0xB9,0x85,3}, {0xE7,0xB9,0x86,3}, {0xE7,0xB9,0x88,3}, {0xE7,0xB9,0x89,3}, {0xE7,0xB9,0x8A,3}, {0xE7,0xB9,0x8B,3}, {0xE7,0xB9,0x8C,3}, {0xE7,0xB9,0x8D,3},
+        {0xE7,0xB9,0x8E,3}, {0xE7,0xB9,0x8F,3}, {0xE7,0xB9,0x90,3}, {0xE7,0xB9,0x91,3}, {0xE7,0xB9,0x92,3}, {0xE7,0xB9,0x93,3}, {0xE7,0xB9,0x94,3}, {0xE7,0xB9,0x95,3},
+        {0xE7,0xB9,0x96,3}, {0xE7,0xB9,0x97,3}, {0xE7,0xB9,0x98,3}, {0xE7,0xB9,0x99,3}, {0xE7,0xB9,0x9A,3}, {0xE7,0xB9,0x9B,3}, {0xE7,0xB9,0x9C,3}, {0xE7,0xB9,0x9D,3},
+        {0xE4,0xBF,0x8A,3}, {0xE7,0xAB,0xA3,3}, {0xE6,0xB5,0x9A,3}, {0xE9,0x83,0xA1,3}, {0xE9,0xAA,0x8F,3}, {0xE5,0x96,0x80,3}, {0xE5,0x92,0x96,3}, {0xE5,0x8D,0xA1,3},
+        {0xE5,0x92,0xAF,3}, {0xE5,0xBC,0x80,3}, {0xE6,0x8F,0xA9,3}, {0xE6,0xA5,0xB7,3}, {0xE5,0x87,0xAF,3}, {0xE6,0x85,0xA8,3}, {0xE5,0x88,0x8A,3}, {0xE5,0xA0,0xAA,3},
+        {0xE5,0x8B,0x98,3}, {0xE5,0x9D,0x8E,3}, {0xE7,0xA0,0x8D,3}, {0xE7,0x9C,0x8B,3}, {0xE5,0xBA,0xB7,3}, {0xE6,0x85,0xB7,3}, {0xE7,0xB3,0xA0,3}, {0xE6,0x89,0x9B,3},
+        {0xE6,0x8A,0x97,3}, {0xE4,0xBA,0xA2,3}, {0xE7,0x82,0x95,3}, {0xE8,0x80,0x83,3}, {0xE6,0x8B,0xB7,3}, {0xE7,0x83,0xA4,3}, {0xE9,0x9D,0xA0,3}, {0xE5,0x9D,0xB7,3},
+        {0xE8,0x8B,0x9B,3}, {0xE6,0x9F,0xAF,3}, {0xE6,0xA3,0xB5,3}, {0xE7,0xA3,0x95,3}, {0xE9,0xA2,0x97,3}, {0xE7,0xA7,0x91,3}, {0xE5,0xA3,0xB3,3}, {0xE5,0x92,0xB3,3},
+        {0xE5,0x8F,0xAF,3}, {0xE6,0xB8,0xB4,3}, {0xE5,0x85,0x8B,3}, {0xE5,0x88,0xBB,3}, {0xE5,0xAE,0xA2,3}, {0xE8,0xAF,0xBE,3}, {0xE8,0x82,0xAF,3}, {0xE5,0x95,0x83,3},
+        {0xE5,0x9E,0xA6,3}, {0xE6,0x81,0xB3,3}, {0xE5,0x9D,0x91,3}, {0xE5,0x90,0xAD,3}, {0xE7,0xA9,0xBA,3}, {0xE6,0x81,0x90,3}, {0xE5,0xAD,0x94,3}, {0xE6,0x8E,0xA7,3},
+        {0xE6,0x8A,0xA0,3}, {0xE5,0x8F,0xA3,3}, {0xE6,0x89,0xA3,3}, {0xE5,0xAF,0x87,3}, {0xE6,0x9E,0xAF,3}, {0xE5,0x93,0xAD,3}, {0xE7,0xAA,0x9F,3}, {0xE8,0x8B,0xA6,3},
+        {0xE9,0x85,0xB7,3}, {0xE5,0xBA,0x93,3}, {0xE8,0xA3,0xA4,3}, {0xE5,0xA4,0xB8,3}, {0xE5,0x9E,0xAE,3}, {0xE6,0x8C,0x8E,3}, {0xE8,0xB7,0xA8,3}, {0xE8,0x83,0xAF,3},
+        {0xE5,0x9D,0x97,3}, {0xE7,0xAD,0xB7,3}, {0xE4,0xBE,0xA9,3}, {0xE5,0xBF,0xAB,3}, {0xE5,0xAE,0xBD,3}, {0xE6,0xAC,0xBE,3}, {0xE5,0x8C,0xA1,3}, {0xE7,0xAD,0x90,3},
+        {0xE7,0x8B,0x82,3}, {0xE6,0xA1,0x86,3}, {0xE7,0x9F,0xBF,3}, {0xE7,0x9C,0xB6,3}, {0xE6,0x97,0xB7,3}, {0xE5,0x86,0xB5,3}, {0xE4,0xBA,0x8F,3}, {0xE7,0x9B,0x94,3},
+        {0xE5,0xB2,0xBF,3}, {0xE7,0xAA,0xA5,3}, {0xE8,0x91,0xB5,3}, {0xE5,0xA5,0x8E,3}, {0xE9,0xAD,0x81,3}, {0xE5,0x82,0x80,3},
+    },
+    /* 0xC0 */ {
+        {0xE7,0xB9,0x9E,3}, {0xE7,0xB9,0x9F,3}, {0xE7,0xB9,0xA0,3}, {0xE7,0xB9,0xA1,3}, {0xE7,0xB9,0xA2,3}, {0xE7,0xB9,0xA3,3}, {0xE7,0xB9,0xA4,3}, {0xE7,0xB9,0xA5,3},
+        {0xE7,0xB9,0xA6,3}, {0xE7,0xB9,0xA7,3}, {0xE7,0xB9,0xA8,3}, {0xE7,0xB9,0xA9,3}, {0xE7,0xB9,0xAA,3}, {0xE7,0xB9,0xAB,3}, {0xE7,0xB9,0xAC,3}, {0xE7,0xB9,0xAD,3},
+        {0xE7,0xB9,0xAE,3}, {0xE7,0xB9,0xAF,3}, {0xE7,0xB9,0xB0,3}, {0xE7,0xB9,0xB1,3}, {0xE7,0xB9,0xB2,3}, {0xE7,0xB9,0xB3,3}, {0xE7,0xB9,0xB4,3}, {0xE7,0xB9,0xB5,3},
+        {0xE7,0xB9,0xB6,3}, {0xE7,0xB9,0xB7,3}, {0xE7,0xB9,0xB8,3}, {0xE7,0xB9,0xB9,3}, {0xE7,0xB9,0xBA,3}, {0xE7,0xB9,0xBB,3}, {0xE7,0xB9,0xBC,3}, {0xE7,0xB9,0xBD,3},
+        {0xE7,0xB9,0xBE,3}, {0xE7,0xB9,0xBF,3}, {0xE7,0xBA,0x80,3}, {0xE7,0xBA,0x81,3}, {0xE7,0xBA,0x83,3}, {0xE7,0xBA,0x84,3}, {0xE7,0xBA,0x85,3}, {0xE7,0xBA,0x86,3},
+        {0xE7,0xBA,0x87,3}, {0xE7,0xBA,0x88,3}, {0xE7,0xBA,0x89,3}, {0xE7,0xBA,0x8A,3}, {0xE7,0xBA,0x8B,3}, {0xE7,0xBA,0x8C,3}, {0xE7,0xBA,0x8D,3}, {0xE7,0xBA,0x8E,3},
+        {0xE7,0xBA,0x8F,3}, {0xE7,0xBA,0x90,3}, {0xE7,0xBA,0x91,3}, {0xE7,0xBA,0x92,3}, {0xE7,0xBA,0x93,3}, {0xE7,0xBA,0x94,3}, {0xE7,0xBA,0x95,3}, {0xE7,0xBA,0x96,3},
+        {0xE7,0xBA,0x97,3}, {0xE7,0xBA,0x98,3}, {0xE7,0xBA,0x99,3}, {0xE7,0xBA,0x9A,3}, {0xE7,0xBA,0x9C,3}, {0xE7,0xBA,0x9D,3}, {0xE7,0xBA,0x9E,3}, {0xE7,0xBA,0xAE,3},
+        {0xE7,0xBA,0xB4,3}, {0xE7,0xBA,0xBB,3}, {0xE7,0xBA,0xBC,3}, {0xE7,0xBB,0x96,3}, {0xE7,0xBB,0xA4,3}, {0xE7,0xBB,0xAC,3}, {0xE7,0xBB,0xB9,3}, {0xE7,0xBC,0x8A,3},
+        {0xE7,0xBC,0x90,3}, {0xE7,0xBC,0x9E,3}, {0xE7,0xBC,0xB7,3}, {0xE7,0xBC,0xB9,3}, {0xE7,0xBC,0xBB,3}, {0xE7,0xBC,0xBC,3}, {0xE7,0xBC,0xBD,3}, {0xE7,0xBC,0xBE,3},
+        {0xE7,0xBC,0xBF,3}, {0xE7,0xBD,0x80,3}, {0xE7,0xBD,0x81,3}, {0xE7,0xBD,0x83,3}, {0xE7,0xBD,0x86,3}, {0xE7,0xBD,0x87,3}, {0xE7,0xBD,0x88,3}, {0xE7,0xBD,0x89,3},
+        {0xE7,0xBD,0x8A,3}, {0xE7,0xBD,0x8B,3}, {0xE7,0xBD,0x8C,3}, {0xE7,0xBD,0x8D,3}, {0xE7,0xBD,0x8E,3}, {0xE7,0xBD,0x8F,3}, {0xE7,0xBD,0x92,3}, {0xE7,0xBD,0x93,3},
+        {0xE9,0xA6,0x88,3}, {0xE6,0x84,0xA7,3}, {0xE6,0xBA,0x83,3}, {0xE5,0x9D,0xA4,3}, {0xE6,0x98,0x86,3}, {0xE6,0x8D,0x86,3}, {0xE5,0x9B,0xB0,3}, {0xE6,0x8B,0xAC,3},
+        {0xE6,0x89,0xA9,3}, {0xE5,0xBB,0x93,3}, {0xE9,0x98,0x94,3}, {0xE5,0x9E,0x83,3}, {0xE6,0x8B,0x89,3}, {0xE5,0x96,0x87,3}, {0xE8,0x9C,0xA1,3}, {0xE8,0x85,0x8A,3},
+        {0xE8,0xBE,0xA3,3}, {0xE5,0x95,0xA6,3}, {0xE8,0x8E,0xB1,3}, {0xE6,0x9D,0xA5,3}, {0xE8,0xB5,0x96,3}, {0xE8,0x93,0x9D,3}, {0xE5,0xA9,0xAA,3}, {0xE6,0xA0,0x8F,3},
+        {0xE6,0x8B,0xA6,3}, {0xE7,0xAF,0xAE,3}, {0xE9,0x98,0x91,3}, {0xE5,0x85,0xB0,3}, {0xE6,0xBE,0x9C,3}, {0xE8,0xB0,0xB0,3}, {0xE6,0x8F,0xBD,3}, {0xE8,0xA7,0x88,3},
+        {0xE6,0x87,0x92,3}, {0xE7,0xBC,0x86,3}, {0xE7,0x83,0x82,3}, {0xE6,0xBB,0xA5,3}, {0xE7,0x90,0x85,3}, {0xE6,0xA6,0x94,3}, {0xE7,0x8B,0xBC,3}, {0xE5,0xBB,0x8A,3},
+        {0xE9,0x83,0x8E,3}, {0xE6,0x9C,0x97,3}, {0xE6,0xB5,0xAA,3}, {0xE6,0x8D,0x9E,3}, {0xE5,0x8A,0xB3,3}, {0xE7,0x89,0xA2,3}, {0xE8,0x80,0x81,3}, {0xE4,0xBD,0xAC,3},
+        {0xE5,0xA7,0xA5,3}, {0xE9,0x85,0xAA,3}, {0xE7,0x83,0x99,3}, {0xE6,0xB6,0x9D,3}, {0xE5,0x8B,0x92,3}, {0xE4,0xB9,0x90,3}, {0xE9,0x9B,0xB7,3}, {0xE9,0x95,0xAD,3},
+        {0xE8,0x95,0xBE,3}, {0xE7,0xA3,0x8A,3}, {0xE7,0xB4,0xAF,3}, {0xE5,0x84,0xA1,3}, {0xE5,0x9E,0x92,3}, {0xE6,0x93,0x82,3}, {0xE8,0x82,0x8B,3}, {0xE7,0xB1,0xBB,3},
+        {0xE6,0xB3,0xAA,3}, {0xE6,0xA3,0xB1,3}, {0xE6,0xA5,0x9E,3}, {0xE5,0x86,0xB7,3}, {0xE5,0x8E,0x98,3}, {0xE6,0xA2,0xA8,3}, {0xE7,0x8A,0x81,3}, {0xE9,0xBB,0x8E,3},
+        {0xE7,0xAF,0xB1,3}, {0xE7,0x8B,0xB8,3}, {0xE7,0xA6,0xBB,3}, {0xE6,0xBC,0x93,3}, {0xE7,0x90,0x86,3}, {0xE6,0x9D,0x8E,3}, {0xE9,0x87,0x8C,3}, {0xE9,0xB2,0xA4,3},
+        {0xE7,0xA4,0xBC,3}, {0xE8,0x8E,0x89,3}, {0xE8,0x8D,0x94,3}, {0xE5,0x90,0x8F,3}, {0xE6,0xA0,0x97,3}, {0xE4,0xB8,0xBD,3}, {0xE5,0x8E,0x89,3}, {0xE5,0x8A,0xB1,3},
+        {0xE7,0xA0,0xBE,3}, {0xE5,0x8E,0x86,3}, {0xE5,0x88,0xA9,3}, {0xE5,0x82,0x88,3}, {0xE4,0xBE,0x8B,3}, {0xE4,0xBF,0x90,3},
+    },
+    /* 0xC1 */ {
+        {0xE7,0xBD,0x96,3}, {0xE7,0xBD,0x99,3}, {0xE7,0xBD,0x9B,3}, {0xE7,0xBD,0x9C,3}, {0xE7,0xBD,0x9D,3}, {0xE7,0xBD,0x9E,3}, {0xE7,0xBD,0xA0,3}, {0xE7,0xBD,0xA3,3},
+        {0xE7,0xBD,0xA4,3}, {0xE7,0xBD,0xA5,3}, {0xE7,0xBD,0xA6,3}, {0xE7,0xBD,0xA7,3}, {0xE7,0xBD,0xAB,3}, {0xE7,0xBD,0xAC,3}, {0xE7,0xBD,0xAD,3}, {0xE7,0xBD,0xAF,3},
+        {0xE7,0xBD,0xB0,3}, {0xE7,0xBD,0xB3,3}, {0xE7,0xBD,0xB5,3}, {0xE7,0xBD,0xB6,3}, {0xE7,0xBD,0xB7,3}, {0xE7,0xBD,0xB8,3}, {0xE7,0xBD,0xBA,3}, {0xE7,0xBD,0xBB,3},
+        {0xE7,0xBD,0xBC,3}, {0xE7,0xBD,0xBD,3}, {0xE7,0xBD,0xBF,3}, {0xE7,0xBE,0x80,3}, {0xE7,0xBE,0x82,3}, {0xE7,0xBE,0x83,3}, {0xE7,0xBE,0x84,3}, {0xE7,0xBE,0x85,3},
+        {0xE7,0xBE,0x86,3}, {0xE7,0xBE,0x87,3}, {0xE7,0xBE,0x88,3}, {0xE7,0xBE,0x89,3}, {0xE7,0xBE,0x8B,3}, {0xE7,0xBE,0x8D,3}, {0xE7,0xBE,0x8F,3}, {0xE7,0xBE,0x90,3},
+        {0xE7,0xBE,0x91,3}, {0xE7,0xBE,0x92,3}, {0xE7,0xBE,0x93,3}, {0xE7,0xBE,0x95,3}, {0xE7,0xBE,0x96,3}, {0xE7,0xBE,0x97,3}, {0xE7,0xBE,0x98,3}, {0xE7,0xBE,0x99,3},
+        {0xE7,0xBE,0x9B,3}, {0xE7,0xBE,0x9C,3}, {0xE7,0xBE,0xA0,3}, {0xE7,0xBE,0xA2,3}, {0xE7,0xBE,0xA3,3}, {0xE7,0xBE,0xA5,3}, {0xE7,0xBE,0xA6,3}, {0xE7,0xBE,0xA8,3},
+        {0xE7,0xBE,0xA9,3}, {0xE7,0xBE,0xAA,3}, {0xE7,0xBE,0xAB,3}, {0xE7,0xBE,0xAC,3}, {0xE7,0xBE,0xAD,3}, {0xE7,0xBE,0xAE,3}, {0xE7,0xBE,0xB1,3}, {0xE7,0xBE,0xB3,3},
+        {0xE7,0xBE,0xB4,3}, {0xE7,0xBE,0xB5,3}, {0xE7,0xBE,0xB6,3}, {0xE7,0xBE,0xB7,3}, {0xE7,0xBE,0xBA,3}, {0xE7,0xBE,0xBB,3}, {0xE7,0xBE,0xBE,3}, {0xE7,0xBF,0x80,3},
+        {0xE7,0xBF,0x82,3}, {0xE7,0xBF,0x83,3}, {0xE7,0xBF,0x84,3}, {0xE7,0xBF,0x86,3}, {0xE7,0xBF,0x87,3}, {0xE7,0xBF,0x88,3}, {0xE7,0xBF,0x89,3}, {0xE7,0xBF,0x8B,3},
+        {0xE7,0xBF,0x8D,3}, {0xE7,0xBF,0x8F,3}, {0xE7,0xBF,0x90,3}, {0xE7,0xBF,0x91,3}, {0xE7,0xBF,0x92,3}, {0xE7,0xBF,0x93,3}, {0xE7,0xBF,0x96,3}, {0xE7,0xBF,0x97,3},
+        {0xE7,0xBF,0x99,3}, {0xE7,0xBF,0x9A,3}, {0xE7,0xBF,0x9B,3}, {0xE7,0xBF,0x9C,3}, {0xE7,0xBF,0x9D,3}, {0xE7,0xBF,0x9E,3}, {0xE7,0xBF,0xA2,3}, {0xE7,0xBF,0xA3,3},
+        {0xE7,0x97,0xA2,3}, {0xE7,0xAB,0x8B,3}, {0xE7,0xB2,0x92,3}, {0xE6,0xB2,0xA5,3}, {0xE9,0x9A,0xB6,3}, {0xE5,0x8A,0x9B,3}, {0xE7,0x92,0x83,3}, {0xE5,0x93,0xA9,3},
+        {0xE4,0xBF,0xA9,3}, {0xE8,0x81,0x94,3}, {0xE8,0x8E,0xB2,3}, {0xE8,0xBF,0x9E,3}, {0xE9,0x95,0xB0,3}, {0xE5,0xBB,0x89,3}, {0xE6,0x80,0x9C,3}, {0xE6,0xB6,0x9F,3},
+        {0xE5,0xB8,0x98,3}, {0xE6,0x95,0x9B,3}, {0xE8,0x84,0xB8,3}, {0xE9,0x93,0xBE,3}, {0xE6,0x81,0x8B,3}, {0xE7,0x82,0xBC,3}, {0xE7,0xBB,0x83,3}, {0xE7,0xB2,0xAE,3},
+        {0xE5,0x87,0x89,3}, {0xE6,0xA2,0x81,3}, {0xE7,0xB2,0xB1,3}, {0xE8,0x89,0xAF,3}, {0xE4,0xB8,0xA4,3}, {0xE8,0xBE,0x86,3}, {0xE9,0x87,0x8F,3}, {0xE6,0x99,0xBE,3},
+        {0xE4,0xBA,0xAE,3}, {0xE8,0xB0,0x85,3}, {0xE6,0x92,0xA9,3}, {0xE8,0x81,0x8A,3}, {0xE5,0x83,0x9A,3}, {0xE7,0x96,0x97,3}, {0xE7,0x87,0x8E,3}, {0xE5,0xAF,0xA5,3},
+        {0xE8,0xBE,0xBD,3}, {0xE6,0xBD,0xA6,3}, {0xE4,0xBA,0x86,3}, {0xE6,0x92,0x82,3}, {0xE9,0x95,0xA3,3}, {0xE5,0xBB,0x96,3}, {0xE6,0x96,0x99,3}, {0xE5,0x88,0x97,3},
+        {0xE8,0xA3,0x82,3}, {0xE7,0x83,0x88,3}, {0xE5,0x8A,0xA3,3}, {0xE7,0x8C,0x8E,3}, {0xE7,0x90,0xB3,3}, {0xE6,0x9E,0x97,3}, {0xE7,0xA3,0xB7,3}, {0xE9,0x9C,0x96,3},
+        {0xE4,0xB8,0xB4,3}, {0xE9,0x82,0xBB,3}, {0xE9,0xB3,0x9E,3}, {0xE6,0xB7,0x8B,3}, {0xE5,0x87,0x9B,3}, {0xE8,0xB5,0x81,3}, {0xE5,0x90,0x9D,3}, {0xE6,0x8B,0x8E,3},
+        {0xE7,0x8E,0xB2,3}, {0xE8,0x8F,0xB1,3}, {0xE9,0x9B,0xB6,3}, {0xE9,0xBE,0x84,3}, {0xE9,0x93,0x83,3}, {0xE4,0xBC,0xB6,3}, {0xE7,0xBE,0x9A,3}, {0xE5,0x87,0x8C,3},
+        {0xE7,0x81,0xB5,3}, {0xE9,0x99,0xB5,3}, {0xE5,0xB2,0xAD,3}, {0xE9,0xA2,0x86,3}, {0xE5,0x8F,0xA6,3}, {0xE4,0xBB,0xA4,3}, {0xE6,0xBA,0x9C,3}, {0xE7,0x90,0x89,3},
+        {0xE6,0xA6,0xB4,3}, {0xE7,0xA1,0xAB,3}, {0xE9,0xA6,0x8F,3}, {0xE7,0x95,0x99,3}, {0xE5,0x88,0x98,3}, {0xE7,0x98,0xA4,3}, {0xE6,0xB5,0x81,3}, {0xE6,0x9F,0xB3,3},
+        {0xE5,0x85,0xAD,3}, {0xE9,0xBE,0x99,3}, {0xE8,0x81,0x8B,3}, {0xE5,0x92,0x99,3}, {0xE7,0xAC,0xBC,3}, {0xE7,0xAA,0xBF,3},
+    },
+    /* 0xC2 */ {
+        {0xE7,0xBF,0xA4,3}, {0xE7,0xBF,0xA7,3}, {0xE7,0xBF,0xA8,3}, {0xE7,0xBF,0xAA,3}, {0xE7,0xBF,0xAB,3}, {0xE7,0xBF,0xAC,3}, {0xE7,0xBF,0xAD,3}, {0xE7,0xBF,0xAF,3},
+        {0xE7,0xBF,0xB2,3}, {0xE7,0xBF,0xB4,3}, {0xE7,0xBF,0xB5,3}, {0xE7,0xBF,0xB6,3}, {0xE7,0xBF,0xB7,3}, {0xE7,0xBF,0xB8,3}, {0xE7,0xBF,0xB9,3}, {0xE7,0xBF,0xBA,3},
+        {0xE7,0xBF,0xBD,3}, {0xE7,0xBF,0xBE,3}, {0xE7,0xBF,0xBF,3}, {0xE8,0x80,0x82,3}, {0xE8,0x80,0x87,3}, {0xE8,0x80,0x88,3}, {0xE8,0x80,0x89,3}, {0xE8,0x80,0x8A,3},
+        {0xE8,0x80,0x8E,3}, {0xE8,0x80,0x8F,3}, {0xE8,0x80,0x91,3}, {0xE8,0x80,0x93,3}, {0xE8,0x80,0x9A,3}, {0xE8,0x80,0x9B,3}, {0xE8,0x80,0x9D,3}, {0xE8,0x80,0x9E,3},
+        {0xE8,0x80,0x9F,3}, {0xE8,0x80,0xA1,3}, {0xE8,0x80,0xA3,3}, {0xE8,0x80,0xA4,3}, {0xE8,0x80,0xAB,3}, {0xE8,0x80,0xAC,3}, {0xE8,0x80,0xAD,3}, {0xE8,0x80,0xAE,3},
+        {0xE8,0x80,0xAF,3}, {0xE8,0x80,0xB0,3}, {0xE8,0x80,0xB2,3}, {0xE8,0x80,0xB4,3}, {0xE8,0x80,0xB9,3}, {0xE8,0x80,0xBA,3}, {0xE8,0x80,0xBC,3}, {0xE8,0x80,0xBE,3},
+        {0xE8,0x81,0x80,3}, {0xE8,0x81,0x81,3}, {0xE8,0x81,0x84,3}, {0xE8,0x81,0x85,3}, {0xE8,0x81,0x87,3}, {0xE8,0x81,0x88,3}, {0xE8,0x81,0x89,3}, {0xE8,0x81,0x8E,3},
+        {0xE8,0x81,0x8F,3}, {0xE8,0x81,0x90,3}, {0xE8,0x81,0x91,3}, {0xE8,0x81,0x93,3}, {0xE8,0x81,0x95,3}, {0xE8,0x81,0x96,3}, {0xE8,0x81,0x97,3}, {0xE8,0x81,0x99,3},
+        {0xE8,0x81,0x9B,3}, {0xE8,0x81,0x9C,3}, {0xE8,0x81,0x9D,3}, {0xE8,0x81,0x9E,3}, {0xE8,0x81,0x9F,3}, {0xE8,0x81,0xA0,3}, {0xE8,0x81,0xA1,3}, {0xE8,0x81,0xA2,3},
+        {0xE8,0x81,0xA3,3}, {0xE8,0x81,0xA4,3}, {0xE8,0x81,0xA5,3}, {0xE8,0x81,0xA6,3}, {0xE8,0x81,0xA7,3}, {0xE8,0x81,0xA8,3}, {0xE8,0x81,0xAB,3}, {0xE8,0x81,0xAC,3},
+        {0xE8,0x81,0xAD,3}, {0xE8,0x81,0xAE,3}, {0xE8,0x81,0xAF,3}, {0xE8,0x81,0xB0,3}, {0xE8,0x81,0xB2,3}, {0xE8,0x81,0xB3,3}, {0xE8,0x81,0xB4,3}, {0xE8,0x81,0xB5,3},
+        {0xE8,0x81,0xB6,3}, {0xE8,0x81,0xB7,3}, {0xE8,0x81,0xB8,3}, {0xE8,0x81,0xB9,3}, {0xE8,0x81,0xBA,3}, {0xE8,0x81,0xBB,3}, {0xE8,0x81,0xBC,3}, {0xE8,0x81,0xBD,3},
+        {0xE9,0x9A,0x86,3}, {0xE5,0x9E,0x84,3}, {0xE6,0x8B,0xA2,3}, {0xE9,0x99,0x87,3}, {0xE6,0xA5,0xBC,3}, {0xE5,0xA8,0x84,3}, {0xE6,0x90,0x82,3}, {0xE7,0xAF,0x93,3},
+        {0xE6,0xBC,0x8F,3}, {0xE9,0x99,0x8B,3}, {0xE8,0x8A,0xA6,3}, {0xE5,0x8D,0xA2,3}, {0xE9,0xA2,0x85,3}, {0xE5,0xBA,0x90,3}, {0xE7,0x82,0x89,3}, {0xE6,0x8E,0xB3,3},
+        {0xE5,0x8D,0xA4,3}, {0xE8,0x99,0x8F,3}, {0xE9,0xB2,0x81,3}, {0xE9,0xBA,0x93,3}, {0xE7,0xA2,0x8C,3}, {0xE9,0x9C,0xB2,3}, {0xE8,0xB7,0xAF,3}, {0xE8,0xB5,0x82,3},
+        {0xE9,0xB9,0xBF,3}, {0xE6,0xBD,0x9E,3}, {0xE7,0xA6,0x84,3}, {0xE5,0xBD,0x95,3}, {0xE9,0x99,0x86,3}, {0xE6,0x88,0xAE,3}, {0xE9,0xA9,0xB4,3}, {0xE5,0x90,0x95,3},
+        {0xE9,0x93,0x9D,3}, {0xE4,0xBE,0xA3,3}, {0xE6,0x97,0x85,3}, {0xE5,0xB1,0xA5,3}, {0xE5,0xB1,0xA1,3}, {0xE7,0xBC,0x95,3}, {0xE8,0x99,0x91,3}, {0xE6,0xB0,0xAF,3},
+        {0xE5,0xBE,0x8B,3}, {0xE7,0x8E,0x87,3}, {0xE6,0xBB,0xA4,3}, {0xE7,0xBB,0xBF,3}, {0xE5,0xB3,0xA6,3}, {0xE6,0x8C,0x9B,3}, {0xE5,0xAD,0xAA,3}, {0xE6,0xBB,0xA6,3},
+        {0xE5,0x8D,0xB5,3}, {0xE4,0xB9,0xB1,3}, {0xE6,0x8E,0xA0,3}, {0xE7,0x95,0xA5,3}, {0xE6,0x8A,0xA1,3}, {0xE8,0xBD,0xAE,3}, {0xE4,0xBC,0xA6,3}, {0xE4,0xBB,0x91,3},
+        {0xE6,0xB2,0xA6,3}, {0xE7,0xBA,0xB6,3}, {0xE8,0xAE,0xBA,3}, {0xE8,0x90,0x9D,3}, {0xE8,0x9E,0xBA,3}, {0xE7,0xBD,0x97,3}, {0xE9,0x80,0xBB,3}, {0xE9,0x94,0xA3,3},
+        {0xE7,0xAE,0xA9,3}, {0xE9,0xAA,0xA1,3}, {0xE8,0xA3,0xB8,3}, {0xE8,0x90,0xBD,3}, {0xE6,0xB4,0x9B,3}, {0xE9,0xAA,0x86,3}, {0xE7,0xBB,0x9C,3}, {0xE5,0xA6,0x88,3},
+        {0xE9,0xBA,0xBB,3}, {0xE7,0x8E,0x9B,3}, {0xE7,0xA0,0x81,3}, {0xE8,0x9A,0x82,3}, {0xE9,0xA9,0xAC,3}, {0xE9,0xAA,0x82,3}, {0xE5,0x98,0x9B,3}, {0xE5,0x90,0x97,3},
+        {0xE5,0x9F,0x8B,3}, {0xE4,0xB9,0xB0,3}, {0xE9,0xBA,0xA6,3}, {0xE5,0x8D,0x96,3}, {0xE8,0xBF,0x88,3}, {0xE8,0x84,0x89,3}, {0xE7,0x9E,0x92,3}, {0xE9,0xA6,0x92,3},
+        {0xE8,0x9B,0xAE,3}, {0xE6,0xBB,0xA1,3}, {0xE8,0x94,0x93,3}, {0xE6,0x9B,0xBC,3}, {0xE6,0x85,0xA2,3}, {0xE6,0xBC,0xAB,3},
+    },
+    /* 0xC3 */ {
+        {0xE8,0x81,0xBE,3}, {0xE8,0x82,0x81,3}, {0xE8,0x82,0x82,3}, {0xE8,0x82,0x85,3}, {0xE8,0x82,0x88,3}, {0xE8,0x82,0x8A,3}, {0xE8,0x82,0x8D,3}, {0xE8,0x82,0x8E,3},
+        {0xE8,0x82,0x8F,3}, {0xE8,0x82,0x90,3}, {0xE8,0x82,0x91,3}, {0xE8,0x82,0x92,3}, {0xE8,0x82,0x94,3}, {0xE8,0x82,0x95,3}, {0xE8,0x82,0x97,3}, {0xE8,0x82,0x99,3},
+        {0xE8,0x82,0x9E,3}, {0xE8,0x82,0xA3,3}, {0xE8,0x82,0xA6,3}, {0xE8,0x82,0xA7,3}, {0xE8,0x82,0xA8,3}, {0xE8,0x82,0xAC,3}, {0xE8,0x82,0xB0,3}, {0xE8,0x82,0xB3,3},
+        {0xE8,0x82,0xB5,3}, {0xE8,0x82,0xB6,3}, {0xE8,0x82,0xB8,3}, {0xE8,0x82,0xB9,3}, {0xE8,0x82,0xBB,3}, {0xE8,0x83,0x85,3}, {0xE8,0x83,0x87,3}, {0xE8,0x83,0x88,3},
+        {0xE8,0x83,0x89,3}, {0xE8,0x83,0x8A,3}, {0xE8,0x83,0x8B,3}, {0xE8,0x83,0x8F,3}, {0xE8,0x83,0x90,3}, {0xE8,0x83,0x91,3}, {0xE8,0x83,0x92,3}, {0xE8,0x83,0x93,3},
+        {0xE8,0x83,0x94,3}, {0xE8,0x83,0x95,3}, {0xE8,0x83,0x98,3}, {0xE8,0x83,0x9F,3}, {0xE8,0x83,0xA0,3}, {0xE8,0x83,0xA2,3}, {0xE8,0x83,0xA3,3}, {0xE8,0x83,0xA6,3},
+        {0xE8,0x83,0xAE,3}, {0xE8,0x83,0xB5,3}, {0xE8,0x83,0xB7,3}, {0xE8,0x83,0xB9,3}, {0xE8,0x83,0xBB,3}, {0xE8,0x83,0xBE,3}, {0xE8,0x83,0xBF,3}, {0xE8,0x84,0x80,3},
+        {0xE8,0x84,0x81,3}, {0xE8,0x84,0x83,3}, {0xE8,0x84,0x84,3}, {0xE8,0x84,0x85,3}, {0xE8,0x84,0x87,3}, {0xE8,0x84,0x88,3}, {0xE8,0x84,0x8B,3}, {0xE8,0x84,0x8C,3},
+        {0xE8,0x84,0x95,3}, {0xE8,0x84,0x97,3}, {0xE8,0x84,0x99,3}, {0xE8,0x84,0x9B,3}, {0xE8,0x84,0x9C,3}, {0xE8,0x84,0x9D,3}, {0xE8,0x84,0x9F,3}, {0xE8,0x84,0xA0,3},
+        {0xE8,0x84,0xA1,3}, {0xE8,0x84,0xA2,3}, {0xE8,0x84,0xA3,3}, {0xE8,0x84,0xA4,3}, {0xE8,0x84,0xA5,3}, {0xE8,0x84,0xA6,3}, {0xE8,0x84,0xA7,3}, {0xE8,0x84,0xA8,3},
+        {0xE8,0x84,0xA9,3}, {0xE8,0x84,0xAA,3}, {0xE8,0x84,0xAB,3}, {0xE8,0x84,0xAD,3}, {0xE8,0x84,0xAE,3}, {0xE8,0x84,0xB0,3}, {0xE8,0x84,0xB3,3}, {0xE8,0x84,0xB4,3},
+        {0xE8,0x84,0xB5,3}, {0xE8,0x84,0xB7,3}, {0xE8,0x84,0xB9,3}, {0xE8,0x84,0xBA,3}, {0xE8,0x84,0xBB,3}, {0xE8,0x84,0xBC,3}, {0xE8,0x84,0xBD,3}, {0xE8,0x84,0xBF,3},
+        {0xE8,0xB0,0xA9,3}, {0xE8,0x8A,0x92,3}, {0xE8,0x8C,0xAB,3}, {0xE7,0x9B,0xB2,3}, {0xE6,0xB0,0x93,3}, {0xE5,0xBF,0x99,3}, {0xE8,0x8E,0xBD,3}, {0xE7,0x8C,0xAB,3},
+        {0xE8,0x8C,0x85,3}, {0xE9,0x94,0x9A,3}, {0xE6,0xAF,0x9B,3}, {0xE7,0x9F,0x9B,3}, {0xE9,0x93,0x86,3}, {0xE5,0x8D,0xAF,3}, {0xE8,0x8C,0x82,3}, {0xE5,0x86,0x92,3},
+        {0xE5,0xB8,0xBD,3}, {0xE8,0xB2,0x8C,3}, {0xE8,0xB4,0xB8,3}, {0xE4,0xB9,0x88,3}, {0xE7,0x8E,0xAB,3}, {0xE6,0x9E,0x9A,3}, {0xE6,0xA2,0x85,3}, {0xE9,0x85,0xB6,3},
+        {0xE9,0x9C,0x89,3}, {0xE7,0x85,0xA4,3}, {0xE6,0xB2,0xA1,3}, {0xE7,0x9C,0x89,3}, {0xE5,0xAA,0x92,3}, {0xE9,0x95,0x81,3}, {0xE6,0xAF,0x8F,3}, {0xE7,0xBE,0x8E,3},
+        {0xE6,0x98,0xA7,3}, {0xE5,0xAF,0x90,3}, {0xE5,0xA6,0xB9,3}, {0xE5,0xAA,0x9A,3}, {0xE9,0x97,0xA8,3}, {0xE9,0x97,0xB7,3}, {0xE4,0xBB,0xAC,3}, {0xE8,0x90,0x8C,3},
+        {0xE8,0x92,0x99,3}, {0xE6,0xAA,0xAC,3}, {0xE7,0x9B,0x9F,3}, {0xE9,0x94,0xB0,3}, {0xE7,0x8C,0x9B,3}, {0xE6,0xA2,0xA6,3}, {0xE5,0xAD,0x9F,3}, {0xE7,0x9C,0xAF,3},
+        {0xE9,0x86,0x9A,3}, {0xE9,0x9D,0xA1,3}, {0xE7,0xB3,0x9C,3}, {0xE8,0xBF,0xB7,3}, {0xE8,0xB0,0x9C,3}, {0xE5,0xBC,0xA5,3}, {0xE7,0xB1,0xB3,3}, {0xE7,0xA7,0x98,3},
+        {0xE8,0xA7,0x85,3}, {0xE6,0xB3,0x8C,3}, {0xE8,0x9C,0x9C,3}, {0xE5,0xAF,0x86,3}, {0xE5,0xB9,0x82,3}, {0xE6,0xA3,0x89,3}, {0xE7,0x9C,0xA0,3}, {0xE7,0xBB,0xB5,3},
+        {0xE5,0x86,0x95,3}, {0xE5,0x85,0x8D,3}, {0xE5,0x8B,0x89,3}, {0xE5,0xA8,0xA9,3}, {0xE7,0xBC,0x85,3}, {0xE9,0x9D,0xA2,3}, {0xE8,0x8B,0x97,3}, {0xE6,0x8F,0x8F,3},
+        {0xE7,0x9E,0x84,3}, {0xE8,0x97,0x90,3}, {0xE7,0xA7,0x92,3}, {0xE6,0xB8,0xBA,3}, {0xE5,0xBA,0x99,3}, {0xE5,0xA6,0x99,3}, {0xE8,0x94,0x91,3}, {0xE7,0x81,0xAD,3},
+        {0xE6,0xB0,0x91,3}, {0xE6,0x8A,0xBF,3}, {0xE7,0x9A,0xBF,3}, {0xE6,0x95,0x8F,3}, {0xE6,0x82,0xAF,3}, {0xE9,0x97,0xBD,3}, {0xE6,0x98,0x8E,3}, {0xE8,0x9E,0x9F,3},
+        {0xE9,0xB8,0xA3,3}, {0xE9,0x93,0xAD,3}, {0xE5,0x90,0x8D,3}, {0xE5,0x91,0xBD,3}, {0xE8,0xB0,0xAC,3}, {0xE6,0x91,0xB8,3},
+    },
+    /* 0xC4 */ {
+        {0xE8,0x85,0x80,3}, {0xE8,0x85,0x81,3}, {0xE8,0x85,0x82,3}, {0xE8,0x85,0x83,3}, {0xE8,0x85,0x84,3}, {0xE8,0x85,0x85,3}, {0xE8,0x85,0x87,3}, {0xE8,0x85,0x89,3},
+        {0xE8,0x85,0x8D,3}, {0xE8,0x85,0x8E,3}, {0xE8,0x85,0x8F,3}, {0xE8,0x85,0x92,3}, {0xE8,0x85,0x96,3}, {0xE8,0x85,0x97,3}, {0xE8,0x85,0x98,3}, {0xE8,0x85,0x9B,3},
+        {0xE8,0x85,0x9C,3}, {0xE8,0x85,0x9D,3}, {0xE8,0x85,0x9E,3}, {0xE8,0x85,0x9F,3}, {0xE8,0x85,0xA1,3}, {0xE8,0x85,0xA2,3}, {0xE8,0x85,0xA3,3}, {0xE8,0x85,0xA4,3},
+        {0xE8,0x85,0xA6,3}, {0xE8,0x85,0xA8,3}, {0xE8,0x85,0xAA,3}, {0xE8,0x85,0xAB,3}, {0xE8,0x85,0xAC,3}, {0xE8,0x85,0xAF,3}, {0xE8,0x85,0xB2,3}, {0xE8,0x85,0xB3,3},
+        {0xE8,0x85,0xB5,3}, {0xE8,0x85,0xB6,3}, {0xE8,0x85,0xB7,3}, {0xE8,0x85,0xB8,3}, {0xE8,0x86,0x81,3}, {0xE8,0x86,0x83,3}, {0xE8,0x86,0x84,3}, {0xE8,0x86,0x85,3},
+        {0xE8,0x86,0x86,3}, {0xE8,0x86,0x87,3}, {0xE8,0x86,0x89,3}, {0xE8,0x86,0x8B,3}, {0xE8,0x86,0x8C,3}, {0xE8,0x86,0x8D,3}, {0xE8,0x86,0x8E,3}, {0xE8,0x86,0x90,3},
+        {0xE8,0x86,0x92,3}, {0xE8,0x86,0x93,3}, {0xE8,0x86,0x94,3}, {0xE8,0x86,0x95,3}, {0xE8,0x86,0x96,3}, {0xE8,0x86,0x97,3}, {0xE8,0x86,0x99,3}, {0xE8,0x86,0x9A,3},
+        {0xE8,0x86,0x9E,3}, {0xE8,0x86,0x9F,3}, {0xE8,0x86,0xA0,3}, {0xE8,0x86,0xA1,3}, {0xE8,0x86,0xA2,3}, {0xE8,0x86,0xA4,3}, {0xE8,0x86,0xA5,3}, {0xE8,0x86,0xA7,3},
+        {0xE8,0x86,0xA9,3}, {0xE8,0x86,0xAB,3}, {0xE8,0x86,0xAC,3}, {0xE8,0x86,0xAD,3}, {0xE8,0x86,0xAE,3}, {0xE8,0x86,0xAF,3}, {0xE8,0x86,0xB0,3}, {0xE8,0x86,0xB1,3},
+        {0xE8,0x86,0xB2,3}, {0xE8,0x86,0xB4,3}, {0xE8,0x86,0xB5,3}, {0xE8,0x86,0xB6,3}, {0xE8,0x86,0xB7,3}, {0xE8,0x86,0xB8,3}, {0xE8,0x86,0xB9,3}, {0xE8,0x86,0xBC,3},
+        {0xE8,0x86,0xBD,3}, {0xE8,0x86,0xBE,3}, {0xE8,0x86,0xBF,3}, {0xE8,0x87,0x84,3}, {0xE8,0x87,0x85,3}, {0xE8,0x87,0x87,3}, {0xE8,0x87,0x88,3}, {0xE8,0x87,0x89,3},
+        {0xE8,0x87,0x8B,3}, {0xE8,0x87,0x8D,3}, {0xE8,0x87,0x8E,3}, {0xE8,0x87,0x8F,3}, {0xE8,0x87,0x90,3}, {0xE8,0x87,0x91,3}, {0xE8,0x87,0x92,3}, {0xE8,0x87,0x93,3},
+        {0xE6,0x91,0xB9,3}, {0xE8,0x98,0x91,3}, {0xE6,0xA8,0xA1,3}, {0xE8,0x86,0x9C,3}, {0xE7,0xA3,0xA8,3}, {0xE6,0x91,0xA9,3}, {0xE9,0xAD,0x94,3}, {0xE6,0x8A,0xB9,3},
+        {0xE6,0x9C,0xAB,3}, {0xE8,0x8E,0xAB,3}, {0xE5,0xA2,0xA8,3}, {0xE9,0xBB,0x98,3}, {0xE6,0xB2,0xAB,3}, {0xE6,0xBC,0xA0,3}, {0xE5,0xAF,0x9E,3}, {0xE9,0x99,0x8C,3},
+        {0xE8,0xB0,0x8B,3}, {0xE7,0x89,0x9F,3}, {0xE6,0x9F,0x90,3}, {0xE6,0x8B,0x87,3}, {0xE7,0x89,0xA1,3}, {0xE4,0xBA,0xA9,3}, {0xE5,0xA7,0x86,3}, {0xE6,0xAF,0x8D,3},
+        {0xE5,0xA2,0x93,3}, {0xE6,0x9A,0xAE,3}, {0xE5,0xB9,0x95,3}, {0xE5,0x8B,0x9F,3}, {0xE6,0x85,0x95,3}, {0xE6,0x9C,0xA8,3}, {0xE7,0x9B,0xAE,3}, {0xE7,0x9D,0xA6,3},
+        {0xE7,0x89,0xA7,3}, {0xE7,0xA9,0x86,3}, {0xE6,0x8B,0xBF,3}, {0xE5,0x93,0xAA,3}, {0xE5,0x91,0x90,3}, {0xE9,0x92,0xA0,3}, {0xE9,0x82,0xA3,3}, {0xE5,0xA8,0x9C,3},
+        {0xE7,0xBA,0xB3,3}, {0xE6,0xB0,0x96,3}, {0xE4,0xB9,0x83,3}, {0xE5,0xA5,0xB6,3}, {0xE8,0x80,0x90,3}, {0xE5,0xA5,0x88,3}, {0xE5,0x8D,0x97,3}, {0xE7,0x94,0xB7,3},
+        {0xE9,0x9A,0xBE,3}, {0xE5,0x9B,0x8A,3}, {0xE6,0x8C,0xA0,3}, {0xE8,0x84,0x91,3}, {0xE6,0x81,0xBC,3}, {0xE9,0x97,0xB9,3}, {0xE6,0xB7,0x96,3}, {0xE5,0x91,0xA2,3},
+        {0xE9,0xA6,0x81,3}, {0xE5,0x86,0x85,3}, {0xE5,0xAB,0xA9,3}, {0xE8,0x83,0xBD,3}, {0xE5,0xA6,0xAE,3}, {0xE9,0x9C,0x93,3}, {0xE5,0x80,0xAA,3}, {0xE6,0xB3,0xA5,3},
+        {0xE5,0xB0,0xBC,3}, {0xE6,0x8B,0x9F,3}, {0xE4,0xBD,0xA0,3}, {0xE5,0x8C,0xBF,3}, {0xE8,0x85,0xBB,3}, {0xE9,0x80,0x86,3}, {0xE6,0xBA,0xBA,3}, {0xE8,0x94,0xAB,3},
+        {0xE6,0x8B,0x88,3}, {0xE5,0xB9,0xB4,3}, {0xE7,0xA2,0xBE,3}, {0xE6,0x92,0xB5,3}, {0xE6,0x8D,0xBB,3}, {0xE5,0xBF,0xB5,3}, {0xE5,0xA8,0x98,3}, {0xE9,0x85,0xBF,3},
+        {0xE9,0xB8,0x9F,3}, {0xE5,0xB0,0xBF,3}, {0xE6,0x8D,0x8F,3}, {0xE8,0x81,0x82,3}, {0xE5,0xAD,0xBD,3}, {0xE5,0x95,0xAE,3}, {0xE9,0x95,0x8A,3}, {0xE9,0x95,0x8D,3},
+        {0xE6,0xB6,0x85,3}, {0xE6,0x82,0xA8,3}, {0xE6,0x9F,0xA0,3}, {0xE7,0x8B,0x9E,3}, {0xE5,0x87,0x9D,3}, {0xE5,0xAE,0x81,3},
+    },
+    /* 0xC5 */ {
+        {0xE8,0x87,0x94,3}, {0xE8,0x87,0x95,3}, {0xE8,0x87,0x96,3}, {0xE8,0x87,0x97,3}, {0xE8,0x87,0x98,3}, {0xE8,0x87,0x99,3}, {0xE8,0x87,0x9A,3}, {0xE8,0x87,0x9B,3},
+        {0xE8,0x87,0x9C,3}, {0xE8,0x87,0x9D,3}, {0xE8,0x87,0x9E,3}, {0xE8,0x87,0x9F,3}, {0xE8,0x87,0xA0,3}, {0xE8,0x87,0xA1,3}, {0xE8,0x87,0xA2,3}, {0xE8,0x87,0xA4,3},
+        {0xE8,0x87,0xA5,3}, {0xE8,0x87,0xA6,3}, {0xE8,0x87,0xA8,3}, {0xE8,0x87,0xA9,3}, {0xE8,0x87,0xAB,3}, {0xE8,0x87,0xAE,3}, {0xE8,0x87,0xAF,3}, {0xE8,0x87,0xB0,3},
+        {0xE8,0x87,0xB1,3}, {0xE8,0x87,0xB2,3}, {0xE8,0x87,0xB5,3}, {0xE8,0x87,0xB6,3}, {0xE8,0x87,0xB7,3}, {0xE8,0x87,0xB8,3}, {0xE8,0x87,0xB9,3}, {0xE8,0x87,0xBA,3},
+        {0xE8,0x87,0xBD,3}, {0xE8,0x87,0xBF,3}, {0xE8,0x88,0x83,3}, {0xE8,0x88,0x87,3}, {0xE8,0x88,0x88,3}, {0xE8,0x88,0x89,3}, {0xE8,0x88,0x8A,3}, {0xE8,0x88,0x8B,3},
+        {0xE8,0x88,0x8E,3}, {0xE8,0x88,0x8F,3}, {0xE8,0x88,0x91,3}, {0xE8,0x88,0x93,3}, {0xE8,0x88,0x95,3}, {0xE8,0x88,0x96,3}, {0xE8,0x88,0x97,3}, {0xE8,0x88,0x98,3},
+        {0xE8,0x88,0x99,3}, {0xE8,0x88,0x9A,3}, {0xE8,0x88,0x9D,3}, {0xE8,0x88,0xA0,3}, {0xE8,0x88,0xA4,3}, {0xE8,0x88,0xA5,3}, {0xE8,0x88,0xA6,3}, {0xE8,0x88,0xA7,3},
+        {0xE8,0x88,0xA9,3}, {0xE8,0x88,0xAE,3}, {0xE8,0x88,0xB2,3}, {0xE8,0x88,0xBA,3}, {0xE8,0x88,0xBC,3}, {0xE8,0x88,0xBD,3}, {0xE8,0x88,0xBF,3}, {0xE8,0x89,0x80,3},
+        {0xE8,0x89,0x81,3}, {0xE8,0x89,0x82,3}, {0xE8,0x89,0x83,3}, {0xE8,0x89,0x85,3}, {0xE8,0x89,0x86,3}, {0xE8,0x89,0x88,3}, {0xE8,0x89,0x8A,3}, {0xE8,0x89,0x8C,3},
+        {0xE8,0x89,0x8D,3}, {0xE8,0x89,0x8E,3}, {0xE8,0x89,0x90,3}, {0xE8,0x89,0x91,3}, {0xE8,0x89,0x92,3}, {0xE8,0x89,0x93,3}, {0xE8,0x89,0x94,3}, {0xE8,0x89,0x95,3},
+        {0xE8,0x89,0x96,3}, {0xE8,0x89,0x97,3}, {0xE8,0x89,0x99,3}, {0xE8,0x89,0x9B,3}, {0xE8,0x89,0x9C,3}, {0xE8,0x89,0x9D,3}, {0xE8,0x89,0x9E,3}, {0xE8,0x89,0xA0,3},
+        {0xE8,0x89,0xA1,3}, {0xE8,0x89,0xA2,3}, {0xE8,0x89,0xA3,3}, {0xE8,0x89,0xA4,3}, {0xE8,0x89,0xA5,3}, {0xE8,0x89,0xA6,3}, {0xE8,0x89,0xA7,3}, {0xE8,0x89,0xA9,3},
+        {0xE6,0x8B,0xA7,3}, {0xE6,0xB3,0x9E,3}, {0xE7,0x89,0x9B,3}, {0xE6,0x89,0xAD,3}, {0xE9,0x92,0xAE,3}, {0xE7,0xBA,0xBD,3}, {0xE8,0x84,0x93,3}, {0xE6,0xB5,0x93,3},
+        {0xE5,0x86,0x9C,3}, {0xE5,0xBC,0x84,3}, {0xE5,0xA5,0xB4,3}, {0xE5,0x8A,0xAA,3}, {0xE6,0x80,0x92,3}, {0xE5,0xA5,0xB3,3}, {0xE6,0x9A,0x96,3}, {0xE8,0x99,0x90,3},
+        {0xE7,0x96,0x9F,3}, {0xE6,0x8C,0xAA,3}, {0xE6,0x87,0xA6,3}, {0xE7,0xB3,0xAF,3}, {0xE8,0xAF,0xBA,3}, {0xE5,0x93,0xA6,3}, {0xE6,0xAC,0xA7,3}, {0xE9,0xB8,0xA5,3},
+        {0xE6,0xAE,0xB4,3}, {0xE8,0x97,0x95,3}, {0xE5,0x91,0x95,3}, {0xE5,0x81,0xB6,3}, {0xE6,0xB2,0xA4,3}, {0xE5,0x95,0xAA,3}, {0xE8,0xB6,0xB4,3}, {0xE7,0x88,0xAC,3},
+        {0xE5,0xB8,0x95,3}, {0xE6,0x80,0x95,3}, {0xE7,0x90,0xB6,3}, {0xE6,0x8B,0x8D,3}, {0xE6,0x8E,0x92,3}, {0xE7,0x89,0x8C,3}, {0xE5,0xBE,0x98,3}, {0xE6,0xB9,0x83,3},
+        {0xE6,0xB4,0xBE,3}, {0xE6,0x94,0x80,3}, {0xE6,0xBD,0x98,3}, {0xE7,0x9B,0x98,3}, {0xE7,0xA3,0x90,3}, {0xE7,0x9B,0xBC,3}, {0xE7,0x95,0x94,3}, {0xE5,0x88,0xA4,3},
+        {0xE5,0x8F,0x9B,3}, {0xE4,0xB9,0x93,3}, {0xE5,0xBA,0x9E,3}, {0xE6,0x97,0x81,3}, {0xE8,0x80,0xAA,3}, {0xE8,0x83,0x96,3}, {0xE6,0x8A,0x9B,3}, {0xE5,0x92,0x86,3},
+        {0xE5,0x88,0xA8,3}, {0xE7,0x82,0xAE,3}, {0xE8,0xA2,0x8D,3}, {0xE8,0xB7,0x91,3}, {0xE6,0xB3,0xA1,3}, {0xE5,0x91,0xB8,3}, {0xE8,0x83,0x9A,3}, {0xE5,0x9F,0xB9,3},
+        {0xE8,0xA3,0xB4,3}, {0xE8,0xB5,0x94,3}, {0xE9,0x99,0xAA,3}, {0xE9,0x85,0x8D,3}, {0xE4,0xBD,0xA9,3}, {0xE6,0xB2,0x9B,3}, {0xE5,0x96,0xB7,3}, {0xE7,0x9B,0x86,3},
+        {0xE7,0xA0,0xB0,3}, {0xE6,0x8A,0xA8,3}, {0xE7,0x83,0xB9,3}, {0xE6,0xBE,0x8E,3}, {0xE5,0xBD,0xAD,3}, {0xE8,0x93,0xAC,3}, {0xE6,0xA3,0x9A,3}, {0xE7,0xA1,0xBC,3},
+        {0xE7,0xAF,0xB7,3}, {0xE8,0x86,0xA8,3}, {0xE6,0x9C,0x8B,3}, {0xE9,0xB9,0x8F,3}, {0xE6,0x8D,0xA7,3}, {0xE7,0xA2,0xB0,3}, {0xE5,0x9D,0xAF,3}, {0xE7,0xA0,0x92,3},
+        {0xE9,0x9C,0xB9,3}, {0xE6,0x89,0xB9,3}, {0xE6,0x8A,0xAB,3}, {0xE5,0x8A,0x88,3}, {0xE7,0x90,0xB5,3}, {0xE6,0xAF,0x97,3},
+    },
+    /* 0xC6 */ {
+        {0xE8,0x89,0xAA,3}, {0xE8,0x89,0xAB,3}, {0xE8,0x89,0xAC,3}, {0xE8,0x89,0xAD,3}, {0xE8,0x89,0xB1,3}, {0xE8,0x89,0xB5,3}, {0xE8,0x89,0xB6,3}, {0xE8,0x89,0xB7,3},
+        {0xE8,0x89,0xB8,3}, {0xE8,0x89,0xBB,3}, {0xE8,0x89,0xBC,3}, {0xE8,0x8A,0x80,3}, {0xE8,0x8A,0x81,3}, {0xE8,0x8A,0x83,3}, {0xE8,0x8A,0x85,3}, {0xE8,0x8A,0x86,3},
+        {0xE8,0x8A,0x87,3}, {0xE8,0x8A,0x89,3}, {0xE8,0x8A,0x8C,3}, {0xE8,0x8A,0x90,3}, {0xE8,0x8A,0x93,3}, {0xE8,0x8A,0x94,3}, {0xE8,0x8A,0x95,3}, {0xE8,0x8A,0x96,3},
+        {0xE8,0x8A,0x9A,3}, {0xE8,0x8A,0x9B,3}, {0xE8,0x8A,0x9E,3}, {0xE8,0x8A,0xA0,3}, {0xE8,0x8A,0xA2,3}, {0xE8,0x8A,0xA3,3}, {0xE8,0x8A,0xA7,3}, {0xE8,0x8A,0xB2,3},
+        {0xE8,0x8A,0xB5,3}, {0xE8,0x8A,0xB6,3}, {0xE8,0x8A,0xBA,3}, {0xE8,0x8A,0xBB,3}, {0xE8,0x8A,0xBC,3}, {0xE8,0x8A,0xBF,3}, {0xE8,0x8B,0x80,3}, {0xE8,0x8B,0x82,3},
+        {0xE8,0x8B,0x83,3}, {0xE8,0x8B,0x85,3}, {0xE8,0x8B,0x86,3}, {0xE8,0x8B,0x89,3}, {0xE8,0x8B,0x90,3}, {0xE8,0x8B,0x96,3}, {0xE8,0x8B,0x99,3}, {0xE8,0x8B,0x9A,3},
+        {0xE8,0x8B,0x9D,3}, {0xE8,0x8B,0xA2,3}, {0xE8,0x8B,0xA7,3}, {0xE8,0x8B,0xA8,3}, {0xE8,0x8B,0xA9,3}, {0xE8,0x8B,0xAA,3}, {0xE8,0x8B,0xAC,3}, {0xE8,0x8B,0xAD,3},
+        {0xE8,0x8B,0xAE,3}, {0xE8,0x8B,0xB0,3}, {0xE8,0x8B,0xB2,3}, {0xE8,0x8B,0xB3,3}, {0xE8,0x8B,0xB5,3}, {0xE8,0x8B,0xB6,3}, {0xE8,0x8B,0xB8,3}, {0xE8,0x8B,0xBA,3},
+        {0xE8,0x8B,0xBC,3}, {0xE8,0x8B,0xBD,3}, {0xE8,0x8B,0xBE,3}, {0xE8,0x8B,0xBF,3}, {0xE8,0x8C,0x80,3}, {0xE8,0x8C,0x8A,3}, {0xE8,0x8C,0x8B,3}, {0xE8,0x8C,0x8D,3},
+        {0xE8,0x8C,0x90,3}, {0xE8,0x8C,0x92,3}, {0xE8,0x8C,0x93,3}, {0xE8,0x8C,0x96,3}, {0xE8,0x8C,0x98,3}, {0xE8,0x8C,0x99,3}, {0xE8,0x8C,0x9D,3}, {0xE8,0x8C,0x9E,3},
+        {0xE8,0x8C,0x9F,3}, {0xE8,0x8C,0xA0,3}, {0xE8,0x8C,0xA1,3}, {0xE8,0x8C,0xA2,3}, {0xE8,0x8C,0xA3,3}, {0xE8,0x8C,0xA4,3}, {0xE8,0x8C,0xA5,3}, {0xE8,0x8C,0xA6,3},
+        {0xE8,0x8C,0xA9,3}, {0xE8,0x8C,0xAA,3}, {0xE8,0x8C,0xAE,3}, {0xE8,0x8C,0xB0,3}, {0xE8,0x8C,0xB2,3}, {0xE8,0x8C,0xB7,3}, {0xE8,0x8C,0xBB,3}, {0xE8,0x8C,0xBD,3},
+        {0xE5,0x95,0xA4,3}, {0xE8,0x84,0xBE,3}, {0xE7,0x96,0xB2,3}, {0xE7,0x9A,0xAE,3}, {0xE5,0x8C,0xB9,3}, {0xE7,0x97,0x9E,3}, {0xE5,0x83,0xBB,3}, {0xE5,0xB1,0x81,3},
+        {0xE8,0xAD,0xAC,3}, {0xE7,0xAF,0x87,3}, {0xE5,0x81,0x8F,3}, {0xE7,0x89,0x87,3}, {0xE9,0xAA,0x97,3}, {0xE9,0xA3,0x98,3}, {0xE6,0xBC,0x82,3}, {0xE7,0x93,0xA2,3},
+        {0xE7,0xA5,0xA8,3}, {0xE6,0x92,0x87,3}, {0xE7,0x9E,0xA5,3}, {0xE6,0x8B,0xBC,3}, {0xE9,0xA2,0x91,3}, {0xE8,0xB4,0xAB,3}, {0xE5,0x93,0x81,3}, {0xE8,0x81,0x98,3},
+        {0xE4,0xB9,0x92,3}, {0xE5,0x9D,0xAA,3}, {0xE8,0x8B,0xB9,3}, {0xE8,0x90,0x8D,3}, {0xE5,0xB9,0xB3,3}, {0xE5,0x87,0xAD,3}, {0xE7,0x93,0xB6,3}, {0xE8,0xAF,0x84,3},
+        {0xE5,0xB1,0x8F,3}, {0xE5,0x9D,0xA1,3}, {0xE6,0xB3,0xBC,3}, {0xE9,0xA2,0x87,3}, {0xE5,0xA9,0x86,3}, {0xE7,0xA0,0xB4,3}, {0xE9,0xAD,0x84,3}, {0xE8,0xBF,0xAB,3},
+        {0xE7,0xB2,0x95,3}, {0xE5,0x89,0x96,3}, {0xE6,0x89,0x91,3}, {0xE9,0x93,0xBA,3}, {0xE4,0xBB,0x86,3}, {0xE8,0x8E,0x86,3}, {0xE8,0x91,0xA1,3}, {0xE8,0x8F,0xA9,3},
+        {0xE8,0x92,0xB2,3}, {0xE5,0x9F,0x94,3}, {0xE6,0x9C,0xB4,3}, {0xE5,0x9C,0x83,3}, {0xE6,0x99,0xAE,3}, {0xE6,0xB5,0xA6,3}, {0xE8,0xB0,0xB1,3}, {0xE6,0x9B,0x9D,3},
+        {0xE7,0x80,0x91,3}, {0xE6,0x9C,0x9F,3}, {0xE6,0xAC,0xBA,3}, {0xE6,0xA0,0x96,3}, {0xE6,0x88,0x9A,3}, {0xE5,0xA6,0xBB,3}, {0xE4,0xB8,0x83,3}, {0xE5,0x87,0x84,3},
+        {0xE6,0xBC,0x86,3}, {0xE6,0x9F,0x92,3}, {0xE6,0xB2,0x8F,3}, {0xE5,0x85,0xB6,3}, {0xE6,0xA3,0x8B,3}, {0xE5,0xA5,0x87,3}, {0xE6,0xAD,0xA7,3}, {0xE7,0x95,0xA6,3},
+        {0xE5,0xB4,0x8E,3}, {0xE8,0x84,0x90,3}, {0xE9,0xBD,0x90,3}, {0xE6,0x97,0x97,3}, {0xE7,0xA5,0x88,3}, {0xE7,0xA5,0x81,3}, {0xE9,0xAA,0x91,3}, {0xE8,0xB5,0xB7,3},
+        {0xE5,0xB2,0x82,3}, {0xE4,0xB9,0x9E,3}, {0xE4,0xBC,0x81,3}, {0xE5,0x90,0xAF,3}, {0xE5,0xA5,0x91,3}, {0xE7,0xA0,0x8C,3}, {0xE5,0x99,0xA8,3}, {0xE6,0xB0,0x94,3},
+        {0xE8,0xBF,0x84,3}, {0xE5,0xBC,0x83,3}, {0xE6,0xB1,0xBD,3}, {0xE6,0xB3,0xA3,3}, {0xE8,0xAE,0xAB,3}, {0xE6,0x8E,0x90,3},
+    },
+    /* 0xC7 */ {
+        {0xE8,0x8C,0xBE,3}, {0xE8,0x8C,0xBF,3}, {0xE8,0x8D,0x81,3}, {0xE8,0x8D,0x82,3}, {0xE8,0x8D,0x84,3}, {0xE8,0x8D,0x85,3}, {0xE8,0x8D,0x88,3}, {0xE8,0x8D,0x8A,3},
+        {0xE8,0x8D,0x8B,3}, {0xE8,0x8D,0x8C,3}, {0xE8,0x8D,0x8D,3}, {0xE8,0x8D,0x8E,3}, {0xE8,0x8D,0x93,3}, {0xE8,0x8D,0x95,3}, {0xE8,0x8D,0x96,3}, {0xE8,0x8D,0x97,3},
+        {0xE8,0x8D,0x98,3}, {0xE8,0x8D,0x99,3}, {0xE8,0x8D,0x9D,3}, {0xE8,0x8D,0xA2,3}, {0xE8,0x8D,0xB0,3}, {0xE8,0x8D,0xB1,3}, {0xE8,0x8D,0xB2,3}, {0xE8,0x8D,0xB3,3},
+        {0xE8,0x8D,0xB4,3}, {0xE8,0x8D,0xB5,3}, {0xE8,0x8D,0xB6,3}, {0xE8,0x8D,0xB9,3}, {0xE8,0x8D,0xBA,3}, {0xE8,0x8D,0xBE,3}, {0xE8,0x8D,0xBF,3}, {0xE8,0x8E,0x80,3},
+        {0xE8,0x8E,0x81,3}, {0xE8,0x8E,0x82,3}, {0xE8,0x8E,0x83,3}, {0xE8,0x8E,0x84,3}, {0xE8,0x8E,0x87,3}, {0xE8,0x8E,0x88,3}, {0xE8,0x8E,0x8A,3}, {0xE8,0x8E,0x8B,3},
+        {0xE8,0x8E,0x8C,3}, {0xE8,0x8E,0x8D,3}, {0xE8,0x8E,0x8F,3}, {0xE8,0x8E,0x90,3}, {0xE8,0x8E,0x91,3}, {0xE8,0x8E,0x94,3}, {0xE8,0x8E,0x95,3}, {0xE8,0x8E,0x96,3},
+        {0xE8,0x8E,0x97,3}, {0xE8,0x8E,0x99,3}, {0xE8,0x8E,0x9A,3}, {0xE8,0x8E,0x9D,3}, {0xE8,0x8E,0x9F,3}, {0xE8,0x8E,0xA1,3}, {0xE8,0x8E,0xA2,3}, {0xE8,0x8E,0xA3,3},
+        {0xE8,0x8E,0xA4,3}, {0xE8,0x8E,0xA5,3}, {0xE8,0x8E,0xA6,3}, {0xE8,0x8E,0xA7,3}, {0xE8,0x8E,0xAC,3}, {0xE8,0x8E,0xAD,3}, {0xE8,0x8E,0xAE,3}, {0xE8,0x8E,0xAF,3},
+        {0xE8,0x8E,0xB5,3}, {0xE8,0x8E,0xBB,3}, {0xE8,0x8E,0xBE,3}, {0xE8,0x8E,0xBF,3}, {0xE8,0x8F,0x82,3}, {0xE8,0x8F,0x83,3}, {0xE8,0x8F,0x84,3}, {0xE8,0x8F,0x86,3},
+        {0xE8,0x8F,0x88,3}, {0xE8,0x8F,0x89,3}, {0xE8,0x8F,0x8B,3}, {0xE8,0x8F,0x8D,3}, {0xE8,0x8F,0x8E,3}, {0xE8,0x8F,0x90,3}, {0xE8,0x8F,0x91,3}, {0xE8,0x8F,0x92,3},
+        {0xE8,0x8F,0x93,3}, {0xE8,0x8F,0x95,3}, {0xE8,0x8F,0x97,3}, {0xE8,0x8F,0x99,3}, {0xE8,0x8F,0x9A,3}, {0xE8,0x8F,0x9B,3}, {0xE8,0x8F,0x9E,3}, {0xE8,0x8F,0xA2,3},
+        {0xE8,0x8F,0xA3,3}, {0xE8,0x8F,0xA4,3}, {0xE8,0x8F,0xA6,3}, {0xE8,0x8F,0xA7,3}, {0xE8,0x8F,0xA8,3}, {0xE8,0x8F,0xAB,3}, {0xE8,0x8F,0xAC,3}, {0xE8,0x8F,0xAD,3},
+        {0xE6,0x81,0xB0,3}, {0xE6,0xB4,0xBD,3}, {0xE7,0x89,0xB5,3}, {0xE6,0x89,0xA6,3}, {0xE9,0x92,0x8E,3}, {0xE9,0x93,0x85,3}, {0xE5,0x8D,0x83,3}, {0xE8,0xBF,0x81,3},
+        {0xE7,0xAD,0xBE,3}, {0xE4,0xBB,0x9F,3}, {0xE8,0xB0,0xA6,3}, {0xE4,0xB9,0xBE,3}, {0xE9,0xBB,0x94,3}, {0xE9,0x92,0xB1,3}, {0xE9,0x92,0xB3,3}, {0xE5,0x89,0x8D,3},
+        {0xE6,0xBD,0x9C,3}, {0xE9,0x81,0xA3,3}, {0xE6,0xB5,0x85,3}, {0xE8,0xB0,0xB4,3}, {0xE5,0xA0,0x91,3}, {0xE5,0xB5,0x8C,3}, {0xE6,0xAC,0xA0,3}, {0xE6,0xAD,0x89,3},
+        {0xE6,0x9E,0xAA,3}, {0xE5,0x91,0x9B,3}, {0xE8,0x85,0x94,3}, {0xE7,0xBE,0x8C,3}, {0xE5,0xA2,0x99,3}, {0xE8,0x94,0xB7,3}, {0xE5,0xBC,0xBA,3}, {0xE6,0x8A,0xA2,3},
+        {0xE6,0xA9,0x87,3}, {0xE9,0x94,0xB9,3}, {0xE6,0x95,0xB2,3}, {0xE6,0x82,0x84,3}, {0xE6,0xA1,0xA5,3}, {0xE7,0x9E,0xA7,3}, {0xE4,0xB9,0x94,3}, {0xE4,0xBE,0xA8,3},
+        {0xE5,0xB7,0xA7,3}, {0xE9,0x9E,0x98,3}, {0xE6,0x92,0xAC,3}, {0xE7,0xBF,0x98,3}, {0xE5,0xB3,0xAD,3}, {0xE4,0xBF,0x8F,3}, {0xE7,0xAA,0x8D,3}, {0xE5,0x88,0x87,3},
+        {0xE8,0x8C,0x84,3}, {0xE4,0xB8,0x94,3}, {0xE6,0x80,0xAF,3}, {0xE7,0xAA,0x83,3}, {0xE9,0x92,0xA6,3}, {0xE4,0xBE,0xB5,3}, {0xE4,0xBA,0xB2,3}, {0xE7,0xA7,0xA6,3},
+        {0xE7,0x90,0xB4,3}, {0xE5,0x8B,0xA4,3}, {0xE8,0x8A,0xB9,3}, {0xE6,0x93,0x92,3}, {0xE7,0xA6,0xBD,3}, {0xE5,0xAF,0x9D,3}, {0xE6,0xB2,0x81,3}, {0xE9,0x9D,0x92,3},
+        {0xE8,0xBD,0xBB,3}, {0xE6,0xB0,0xA2,3}, {0xE5,0x80,0xBE,3}, {0xE5,0x8D,0xBF,3}, {0xE6,0xB8,0x85,3}, {0xE6,0x93,0x8E,3}, {0xE6,0x99,0xB4,3}, {0xE6,0xB0,0xB0,3},
+        {0xE6,0x83,0x85,3}, {0xE9,0xA1,0xB7,3}, {0xE8,0xAF,0xB7,3}, {0xE5,0xBA,0x86,3}, {0xE7,0x90,0xBC,3}, {0xE7,0xA9,0xB7,3}, {0xE7,0xA7,0x8B,3}, {0xE4,0xB8,0x98,3},
+        {0xE9,0x82,0xB1,3}, {0xE7,0x90,0x83,3}, {0xE6,0xB1,0x82,3}, {0xE5,0x9B,0x9A,3}, {0xE9,0x85,0x8B,3}, {0xE6,0xB3,0x85,3}, {0xE8,0xB6,0x8B,3}, {0xE5,0x8C,0xBA,3},
+        {0xE8,0x9B,0x86,3}, {0xE6,0x9B,0xB2,3}, {0xE8,0xBA,0xAF,3}, {0xE5,0xB1,0x88,3}, {0xE9,0xA9,0xB1,3}, {0xE6,0xB8,0xA0,3},
+    },
+    /* 0xC8 */ {
+        {0xE8,0x8F,0xAE,3}, {0xE8,0x8F,0xAF,3}, {0xE8,0x8F,0xB3,3}, {0xE8,0x8F,0xB4,3}, {0xE8,0x8F,0xB5,3}, {0xE8,0x8F,0xB6,3}, {0xE8,0x8F,0xB7,3}, {0xE8,0x8F,0xBA,3},
+        {0xE8,0x8F,0xBB,3}, {0xE8,0x8F,0xBC,3}, {0xE8,0x8F,0xBE,3}, {0xE8,0x8F,0xBF,3}, {0xE8,0x90,0x80,3}, {0xE8,0x90,0x82,3}, {0xE8,0x90,0x85,3}, {0xE8,0x90,0x87,3},
+        {0xE8,0x90,0x88,3}, {0xE8,0x90,0x89,3}, {0xE8,0x90,0x8A,3}, {0xE8,0x90,0x90,3}, {0xE8,0x90,0x92,3}, {0xE8,0x90,0x93,3}, {0xE8,0x90,0x94,3}, {0xE8,0x90,0x95,3},
+        {0xE8,0x90,0x96,3}, {0xE8,0x90,0x97,3}, {0xE8,0x90,0x99,3}, {0xE8,0x90,0x9A,3}, {0xE8,0x90,0x9B,3}, {0xE8,0x90,0x9E,3}, {0xE8,0x90,0x9F,3}, {0xE8,0x90,0xA0,3},
+        {0xE8,0x90,0xA1,3}, {0xE8,0x90,0xA2,3}, {0xE8,0x90,0xA3,3}, {0xE8,0x90,0xA9,3}, {0xE8,0x90,0xAA,3}, {0xE8,0x90,0xAB,3}, {0xE8,0x90,0xAC,3}, {0xE8,0x90,0xAD,3},
+        {0xE8,0x90,0xAE,3}, {0xE8,0x90,0xAF,3}, {0xE8,0x90,0xB0,3}, {0xE8,0x90,0xB2,3}, {0xE8,0x90,0xB3,3}, {0xE8,0x90,0xB4,3}, {0xE8,0x90,0xB5,3}, {0xE8,0x90,0xB6,3},
+        {0xE8,0x90,0xB7,3}, {0xE8,0x90,0xB9,3}, {0xE8,0x90,0xBA,3}, {0xE8,0x90,0xBB,3}, {0xE8,0x90,0xBE,3}, {0xE8,0x90,0xBF,3}, {0xE8,0x91,0x80,3}, {0xE8,0x91,0x81,3},
+        {0xE8,0x91,0x82,3}, {0xE8,0x91,0x83,3}, {0xE8,0x91,0x84,3}, {0xE8,0x91,0x85,3}, {0xE8,0x91,0x87,3}, {0xE8,0x91,0x88,3}, {0xE8,0x91,0x89,3}, {0xE8,0x91,0x8A,3},
+        {0xE8,0x91,0x8B,3}, {0xE8,0x91,0x8C,3}, {0xE8,0x91,0x8D,3}, {0xE8,0x91,0x8E,3}, {0xE8,0x91,0x8F,3}, {0xE8,0x91,0x90,3}, {0xE8,0x91,0x92,3}, {0xE8,0x91,0x93,3},
+        {0xE8,0x91,0x94,3}, {0xE8,0x91,0x95,3}, {0xE8,0x91,0x96,3}, {0xE8,0x91,0x98,3}, {0xE8,0x91,0x9D,3}, {0xE8,0x91,0x9E,3}, {0xE8,0x91,0x9F,3}, {0xE8,0x91,0xA0,3},
+        {0xE8,0x91,0xA2,3}, {0xE8,0x91,0xA4,3}, {0xE8,0x91,0xA5,3}, {0xE8,0x91,0xA6,3}, {0xE8,0x91,0xA7,3}, {0xE8,0x91,0xA8,3}, {0xE8,0x91,0xAA,3}, {0xE8,0x91,0xAE,3},
+        {0xE8,0x91,0xAF,3}, {0xE8,0x91,0xB0,3}, {0xE8,0x91,0xB2,3}, {0xE8,0x91,0xB4,3}, {0xE8,0x91,0xB7,3}, {0xE8,0x91,0xB9,3}, {0xE8,0x91,0xBB,3}, {0xE8,0x91,0xBC,3},
+        {0xE5,0x8F,0x96,3}, {0xE5,0xA8,0xB6,3}, {0xE9,0xBE,0x8B,3}, {0xE8,0xB6,0xA3,3}, {0xE5,0x8E,0xBB,3}, {0xE5,0x9C,0x88,3}, {0xE9,0xA2,0xA7,3}, {0xE6,0x9D,0x83,3},
+        {0xE9,0x86,0x9B,3}, {0xE6,0xB3,0x89,3}, {0xE5,0x85,0xA8,3}, {0xE7,0x97,0x8A,3}, {0xE6,0x8B,0xB3,3}, {0xE7,0x8A,0xAC,3}, {0xE5,0x88,0xB8,3}, {0xE5,0x8A,0x9D,3},
+        {0xE7,0xBC,0xBA,3}, {0xE7,0x82,0x94,3}, {0xE7,0x98,0xB8,3}, {0xE5,0x8D,0xB4,3}, {0xE9,0xB9,0x8A,3}, {0xE6,0xA6,0xB7,3}, {0xE7,0xA1,0xAE,3}, {0xE9,0x9B,0x80,3},
+        {0xE8,0xA3,0x99,3}, {0xE7,0xBE,0xA4,3}, {0xE7,0x84,0xB6,3}, {0xE7,0x87,0x83,3}, {0xE5,0x86,0x89,3}, {0xE6,0x9F,0x93,3}, {0xE7,0x93,0xA4,3}, {0xE5,0xA3,0xA4,3},
+        {0xE6,0x94,0x98,3}, {0xE5,0x9A,0xB7,3}, {0xE8,0xAE,0xA9,3}, {0xE9,0xA5,0xB6,3}, {0xE6,0x89,0xB0,3}, {0xE7,0xBB,0x95,3}, {0xE6,0x83,0xB9,3}, {0xE7,0x83,0xAD,3},
+        {0xE5,0xA3,0xAC,3}, {0xE4,0xBB,0x81,3}, {0xE4,0xBA,0xBA,3}, {0xE5,0xBF,0x8D,3}, {0xE9,0x9F,0xA7,3}, {0xE4,0xBB,0xBB,3}, {0xE8,0xAE,0xA4,3}, {0xE5,0x88,0x83,3},
+        {0xE5,0xA6,0x8A,3}, {0xE7,0xBA,0xAB,3}, {0xE6,0x89,0x94,3}, {0xE4,0xBB,0x8D,3}, {0xE6,0x97,0xA5,3}, {0xE6,0x88,0x8E,3}, {0xE8,0x8C,0xB8,3}, {0xE8,0x93,0x89,3},
+        {0xE8,0x8D,0xA3,3}, {0xE8,0x9E,0x8D,3}, {0xE7,0x86,0x94,3}, {0xE6,0xBA,0xB6,3}, {0xE5,0xAE,0xB9,3}, {0xE7,0xBB,0x92,3}, {0xE5,0x86,0x97,3}, {0xE6,0x8F,0x89,3},
+        {0xE6,0x9F,0x94,3}, {0xE8,0x82,0x89,3}, {0xE8,0x8C,0xB9,3}, {0xE8,0xA0,0x95,3}, {0xE5,0x84,0x92,3}, {0xE5,0xAD,0xBA,3}, {0xE5,0xA6,0x82,3}, {0xE8,0xBE,0xB1,3},
+        {0xE4,0xB9,0xB3,3}, {0xE6,0xB1,0x9D,3}, {0xE5,0x85,0xA5,3}, {0xE8,0xA4,0xA5,3}, {0xE8,0xBD,0xAF,3}, {0xE9,0x98,0xAE,3}, {0xE8,0x95,0x8A,3}, {0xE7,0x91,0x9E,3},
+        {0xE9,0x94,0x90,3}, {0xE9,0x97,0xB0,3}, {0xE6,0xB6,0xA6,3}, {0xE8,0x8B,0xA5,3}, {0xE5,0xBC,0xB1,3}, {0xE6,0x92,0x92,3}, {0xE6,0xB4,0x92,3}, {0xE8,0x90,0xA8,3},
+        {0xE8,0x85,0xAE,3}, {0xE9,0xB3,0x83,3}, {0xE5,0xA1,0x9E,3}, {0xE8,0xB5,0x9B,3}, {0xE4,0xB8,0x89,3}, {0xE5,0x8F,0x81,3},
+    },
+    /* 0xC9 */ {
+        {0xE8,0x91,0xBD,3}, {0xE8,0x91,0xBE,3}, {0xE8,0x91,0xBF,3}, {0xE8,0x92,0x80,3}, {0xE8,0x92,0x81,3}, {0xE8,0x92,0x83,3}, {0xE8,0x92,0x84,3}, {0xE8,0x92,0x85,3},
+        {0xE8,0x92,0x86,3}, {0xE8,0x92,0x8A,3}, {0xE8,0x92,0x8D,3}, {0xE8,0x92,0x8F,3}, {0xE8,0x92,0x90,3}, {0xE8,0x92,0x91,3}, {0xE8,0x92,0x92,3}, {0xE8,0x92,0x93,3},
+        {0xE8,0x92,0x94,3}, {0xE8,0x92,0x95,3}, {0xE8,0x92,0x96,3}, {0xE8,0x92,0x98,3}, {0xE8,0x92,0x9A,3}, {0xE8,0x92,0x9B,3}, {0xE8,0x92,0x9D,3}, {0xE8,0x92,0x9E,3},
+        {0xE8,0x92,0x9F,3}, {0xE8,0x92,0xA0,3}, {0xE8,0x92,0xA2,3}, {0xE8,0x92,0xA3,3}, {0xE8,0x92,0xA4,3}, {0xE8,0x92,0xA5,3}, {0xE8,0x92,0xA6,3}, {0xE8,0x92,0xA7,3},
+        {0xE8,0x92,0xA8,3}, {0xE8,0x92,0xA9,3}, {0xE8,0x92,0xAA,3}, {0xE8,0x92,0xAB,3}, {0xE8,0x92,0xAC,3}, {0xE8,0x92,0xAD,3}, {0xE8,0x92,0xAE,3}, {0xE8,0x92,0xB0,3},
+        {0xE8,0x92,0xB1,3}, {0xE8,0x92,0xB3,3}, {0xE8,0x92,0xB5,3}, {0xE8,0x92,0xB6,3}, {0xE8,0x92,0xB7,3}, {0xE8,0x92,0xBB,3}, {0xE8,0x92,0xBC,3}, {0xE8,0x92,0xBE,3},
+        {0xE8,0x93,0x80,3}, {0xE8,0x93,0x82,3}, {0xE8,0x93,0x83,3}, {0xE8,0x93,0x85,3}, {0xE8,0x93,0x86,3}, {0xE8,0x93,0x87,3}, {0xE8,0x93,0x88,3}, {0xE8,0x93,0x8B,3},
+        {0xE8,0x93,0x8C,3}, {0xE8,0x93,0x8E,3}, {0xE8,0x93,0x8F,3}, {0xE8,0x93,0x92,3}, {0xE8,0x93,0x94,3}, {0xE8,0x93,0x95,3}, {0xE8,0x93,0x97,3}, {0xE8,0x93,0x98,3},
+        {0xE8,0x93,0x99,3}, {0xE8,0x93,0x9A,3}, {0xE8,0x93,0x9B,3}, {0xE8,0x93,0x9C,3}, {0xE8,0x93,0x9E,3}, {0xE8,0x93,0xA1,3}, {0xE8,0x93,0xA2,3}, {0xE8,0x93,0xA4,3},
+        {0xE8,0x93,0xA7,3}, {0xE8,0x93,0xA8,3}, {0xE8,0x93,0xA9,3}, {0xE8,0x93,0xAA,3}, {0xE8,0x93,0xAB,3}, {0xE8,0x93,0xAD,3}, {0xE8,0x93,0xAE,3}, {0xE8,0x93,0xAF,3},
+        {0xE8,0x93,0xB1,3}, {0xE8,0x93,0xB2,3}, {0xE8,0x93,0xB3,3}, {0xE8,0x93,0xB4,3}, {0xE8,0x93,0xB5,3}, {0xE8,0x93,0xB6,3}, {0xE8,0x93,0xB7,3}, {0xE8,0x93,0xB8,3},
+        {0xE8,0x93,0xB9,3}, {0xE8,0x93,0xBA,3}, {0xE8,0x93,0xBB,3}, {0xE8,0x93,0xBD,3}, {0xE8,0x93,0xBE,3}, {0xE8,0x94,0x80,3}, {0xE8,0x94,0x81,3}, {0xE8,0x94,0x82,3},
+        {0xE4,0xBC,0x9E,3}, {0xE6,0x95,0xA3,3}, {0xE6,0xA1,0x91,3}, {0xE5,0x97,0x93,3}, {0xE4,0xB8,0xA7,3}, {0xE6,0x90,0x94,3}, {0xE9,0xAA,0x9A,3}, {0xE6,0x89,0xAB,3},
+        {0xE5,0xAB,0x82,3}, {0xE7,0x91,0x9F,3}, {0xE8,0x89,0xB2,3}, {0xE6,0xB6,0xA9,3}, {0xE6,0xA3,0xAE,3}, {0xE5,0x83,0xA7,3}, {0xE8,0x8E,0x8E,3}, {0xE7,0xA0,0x82,3},
+        {0xE6,0x9D,0x80,3}, {0xE5,0x88,0xB9,3}, {0xE6,0xB2,0x99,3}, {0xE7,0xBA,0xB1,3}, {0xE5,0x82,0xBB,3}, {0xE5,0x95,0xA5,3}, {0xE7,0x85,0x9E,3}, {0xE7,0xAD,0x9B,3},
+        {0xE6,0x99,0x92,3}, {0xE7,0x8F,0x8A,3}, {0xE8,0x8B,0xAB,3}, {0xE6,0x9D,0x89,3}, {0xE5,0xB1,0xB1,3}, {0xE5,0x88,0xA0,3}, {0xE7,0x85,0xBD,3}, {0xE8,0xA1,0xAB,3},
+        {0xE9,0x97,0xAA,3}, {0xE9,0x99,0x95,3}, {0xE6,0x93,0x85,3}, {0xE8,0xB5,0xA1,3}, {0xE8,0x86,0xB3,3}, {0xE5,0x96,0x84,3}, {0xE6,0xB1,0x95,3}, {0xE6,0x89,0x87,3},
+        {0xE7,0xBC,0xAE,3}, {0xE5,0xA2,0x92,3}, {0xE4,0xBC,0xA4,3}, {0xE5,0x95,0x86,3}, {0xE8,0xB5,0x8F,3}, {0xE6,0x99,0x8C,3}, {0xE4,0xB8,0x8A,3}, {0xE5,0xB0,0x9A,3},
+        {0xE8,0xA3,0xB3,3}, {0xE6,0xA2,0xA2,3}, {0xE6,0x8D,0x8E,3}, {0xE7,0xA8,0x8D,3}, {0xE7,0x83,0xA7,3}, {0xE8,0x8A,0x8D,3}, {0xE5,0x8B,0xBA,3}, {0xE9,0x9F,0xB6,3},
+        {0xE5,0xB0,0x91,3}, {0xE5,0x93,0xA8,3}, {0xE9,0x82,0xB5,3}, {0xE7,0xBB,0x8D,3}, {0xE5,0xA5,0xA2,3}, {0xE8,0xB5,0x8A,3}, {0xE8,0x9B,0x87,3}, {0xE8,0x88,0x8C,3},
+        {0xE8,0x88,0x8D,3}, {0xE8,0xB5,0xA6,3}, {0xE6,0x91,0x84,3}, {0xE5,0xB0,0x84,3}, {0xE6,0x85,0x91,3}, {0xE6,0xB6,0x89,3}, {0xE7,0xA4,0xBE,3}, {0xE8,0xAE,0xBE,3},
+        {0xE7,0xA0,0xB7,3}, {0xE7,0x94,0xB3,3}, {0xE5,0x91,0xBB,3}, {0xE4,0xBC,0xB8,3}, {0xE8,0xBA,0xAB,3}, {0xE6,0xB7,0xB1,3}, {0xE5,0xA8,0xA0,3}, {0xE7,0xBB,0x85,3},
+        {0xE7,0xA5,0x9E,3}, {0xE6,0xB2,0x88,3}, {0xE5,0xAE,0xA1,3}, {0xE5,0xA9,0xB6,3}, {0xE7,0x94,0x9A,3}, {0xE8,0x82,0xBE,3}, {0xE6,0x85,0x8E,3}, {0xE6,0xB8,0x97,3},
+        {0xE5,0xA3,0xB0,3}, {0xE7,0x94,0x9F,3}, {0xE7,0x94,0xA5,3}, {0xE7,0x89,0xB2,3}, {0xE5,0x8D,0x87,3}, {0xE7,0xBB,0xB3,3},
+    },
+    /* 0xCA */ {
+        {0xE8,0x94,0x83,3}, {0xE8,0x94,0x84,3}, {0xE8,0x94,0x85,3}, {0xE8,0x94,0x86,3}, {0xE8,0x94,0x87,3}, {0xE8,0x94,0x88,3}, {0xE8,0x94,0x89,3}, {0xE8,0x94,0x8A,3},
+        {0xE8,0x94,0x8B,3}, {0xE8,0x94,0x8D,3}, {0xE8,0x94,0x8E,3}, {0xE8,0x94,0x8F,3}, {0xE8,0x94,0x90,3}, {0xE8,0x94,0x92,3}, {0xE8,0x94,0x94,3}, {0xE8,0x94,0x95,3},
+        {0xE8,0x94,0x96,3}, {0xE8,0x94,0x98,3}, {0xE8,0x94,0x99,3}, {0xE8,0x94,0x9B,3}, {0xE8,0x94,0x9C,3}, {0xE8,0x94,0x9D,3}, {0xE8,0x94,0x9E,3}, {0xE8,0x94,0xA0,3},
+        {0xE8,0x94,0xA2,3}, {0xE8,0x94,0xA3,3}, {0xE8,0x94,0xA4,3}, {0xE8,0x94,0xA5,3}, {0xE8,0x94,0xA6,3}, {0xE8,0x94,0xA7,3}, {0xE8,0x94,0xA8,3}, {0xE8,0x94,0xA9,3},
+        {0xE8,0x94,0xAA,3}, {0xE8,0x94,0xAD,3}, {0xE8,0x94,0xAE,3}, {0xE8,0x94,0xAF,3}, {0xE8,0x94,0xB0,3}, {0xE8,0x94,0xB1,3}, {0xE8,0x94,0xB2,3}, {0xE8,0x94,0xB3,3},
+        {0xE8,0x94,0xB4,3}, {0xE8,0x94,0xB5,3}, {0xE8,0x94,0xB6,3}, {0xE8,0x94,0xBE,3}, {0xE8,0x94,0xBF,3}, {0xE8,0x95,0x80,3}, {0xE8,0x95,0x81,3}, {0xE8,0x95,0x82,3},
+        {0xE8,0x95,0x84,3}, {0xE8,0x95,0x85,3}, {0xE8,0x95,0x86,3}, {0xE8,0x95,0x87,3}, {0xE8,0x95,0x8B,3}, {0xE8,0x95,0x8C,3}, {0xE8,0x95,0x8D,3}, {0xE8,0x95,0x8E,3},
+        {0xE8,0x95,0x8F,3}, {0xE8,0x95,0x90,3}, {0xE8,0x95,0x91,3}, {0xE8,0x95,0x92,3}, {0xE8,0x95,0x93,3}, {0xE8,0x95,0x94,3}, {0xE8,0x95,0x95,3}, {0xE8,0x95,0x97,3},
+        {0xE8,0x95,0x98,3}, {0xE8,0x95,0x9A,3}, {0xE8,0x95,0x9B,3}, {0xE8,0x95,0x9C,3}, {0xE8,0x95,0x9D,3}, {0xE8,0x95,0x9F,3}, {0xE8,0x95,0xA0,3}, {0xE8,0x95,0xA1,3},
+        {0xE8,0x95,0xA2,3}, {0xE8,0x95,0xA3,3}, {0xE8,0x95,0xA5,3}, {0xE8,0x95,0xA6,3}, {0xE8,0x95,0xA7,3}, {0xE8,0x95,0xA9,3}, {0xE8,0x95,0xAA,3}, {0xE8,0x95,0xAB,3},
+        {0xE8,0x95,0xAC,3}, {0xE8,0x95,0xAD,3}, {0xE8,0x95,0xAE,3}, {0xE8,0x95,0xAF,3}, {0xE8,0x95,0xB0,3}, {0xE8,0x95,0xB1,3}, {0xE8,0x95,0xB3,3}, {0xE8,0x95,0xB5,3},
+        {0xE8,0x95,0xB6,3}, {0xE8,0x95,0xB7,3}, {0xE8,0x95,0xB8,3}, {0xE8,0x95,0xBC,3}, {0xE8,0x95,0xBD,3}, {0xE8,0x95,0xBF,3}, {0xE8,0x96,0x80,3}, {0xE8,0x96,0x81,3},
+        {0xE7,0x9C,0x81,3}, {0xE7,0x9B,0x9B,3}, {0xE5,0x89,0xA9,3}, {0xE8,0x83,0x9C,3}, {0xE5,0x9C,0xA3,3}, {0xE5,0xB8,0x88,3}, {0xE5,0xA4,0xB1,3}, {0xE7,0x8B,0xAE,3},
+        {0xE6,0x96,0xBD,3}, {0xE6,0xB9,0xBF,3}, {0xE8,0xAF,0x97,3}, {0xE5,0xB0,0xB8,3}, {0xE8,0x99,0xB1,3}, {0xE5,0x8D,0x81,3}, {0xE7,0x9F,0xB3,3}, {0xE6,0x8B,0xBE,3},
+        {0xE6,0x97,0xB6,3}, {0xE4,0xBB,0x80,3}, {0xE9,0xA3,0x9F,3}, {0xE8,0x9A,0x80,3}, {0xE5,0xAE,0x9E,3}, {0xE8,0xAF,0x86,3}, {0xE5,0x8F,0xB2,3}, {0xE7,0x9F,0xA2,3},
+        {0xE4,0xBD,0xBF,3}, {0xE5,0xB1,0x8E,3}, {0xE9,0xA9,0xB6,3}, {0xE5,0xA7,0x8B,3}, {0xE5,0xBC,0x8F,3}, {0xE7,0xA4,0xBA,3}, {0xE5,0xA3,0xAB,3}, {0xE4,0xB8,0x96,3},
+        {0xE6,0x9F,0xBF,3}, {0xE4,0xBA,0x8B,3}, {0xE6,0x8B,0xAD,3}, {0xE8,0xAA,0x93,3}, {0xE9,0x80,0x9D,3}, {0xE5,0x8A,0xBF,3}, {0xE6,0x98,0xAF,3}, {0xE5,0x97,0x9C,3},
+        {0xE5,0x99,0xAC,3}, {0xE9,0x80,0x82,3}, {0xE4,0xBB,0x95,3}, {0xE4,0xBE,0x8D,3}, {0xE9,0x87,0x8A,3}, {0xE9,0xA5,0xB0,3}, {0xE6,0xB0,0x8F,3}, {0xE5,0xB8,0x82,3},
+        {0xE6,0x81,0x83,3}, {0xE5,0xAE,0xA4,3}, {0xE8,0xA7,0x86,3}, {0xE8,0xAF,0x95,3}, {0xE6,0x94,0xB6,3}, {0xE6,0x89,0x8B,3}, {0xE9,0xA6,0x96,3}, {0xE5,0xAE,0x88,3},
+        {0xE5,0xAF,0xBF,3}, {0xE6,0x8E,0x88,3}, {0xE5,0x94,0xAE,3}, {0xE5,0x8F,0x97,3}, {0xE7,0x98,0xA6,3}, {0xE5,0x85,0xBD,3}, {0xE8,0x94,0xAC,3}, {0xE6,0x9E,0xA2,3},
+        {0xE6,0xA2,0xB3,3}, {0xE6,0xAE,0x8A,3}, {0xE6,0x8A,0x92,3}, {0xE8,0xBE,0x93,3}, {0xE5,0x8F,0x94,3}, {0xE8,0x88,0x92,3}, {0xE6,0xB7,0x91,3}, {0xE7,0x96,0x8F,3},
+        {0xE4,0xB9,0xA6,3}, {0xE8,0xB5,0x8E,3}, {0xE5,0xAD,0xB0,3}, {0xE7,0x86,0x9F,3}, {0xE8,0x96,0xAF,3}, {0xE6,0x9A,0x91,3}, {0xE6,0x9B,0x99,3}, {0xE7,0xBD,0xB2,3},
+        {0xE8,0x9C,0x80,3}, {0xE9,0xBB,0x8D,3}, {0xE9,0xBC,0xA0,3}, {0xE5,0xB1,0x9E,3}, {0xE6,0x9C,0xAF,3}, {0xE8,0xBF,0xB0,3}, {0xE6,0xA0,0x91,3}, {0xE6,0x9D,0x9F,3},
+        {0xE6,0x88,0x8D,3}, {0xE7,0xAB,0x96,3}, {0xE5,0xA2,0x85,3}, {0xE5,0xBA,0xB6,3}, {0xE6,0x95,0xB0,3}, {0xE6,0xBC,0xB1,3},
+    },
+    /* 0xCB */ {
+        {0xE8,0x96,0x82,3}, {0xE8,0x96,0x83,3}, {0xE8,0x96,0x86,3}, {0xE8,0x96,0x88,3}, {0xE8,0x96,0x89,3}, {0xE8,0x96,0x8A,3}, {0xE8,0x96,0x8B,3}, {0xE8,0x96,0x8C,3},
+        {0xE8,0x96,0x8D,3}, {0xE8,0x96,0x8E,3}, {0xE8,0x96,0x90,3}, {0xE8,0x96,0x91,3}, {0xE8,0x96,0x92,3}, {0xE8,0x96,0x93,3}, {0xE8,0x96,0x94,3}, {0xE8,0x96,0x95,3},
+        {0xE8,0x96,0x96,3}, {0xE8,0x96,0x97,3}, {0xE8,0x96,0x98,3}, {0xE8,0x96,0x99,3}, {0xE8,0x96,0x9A,3}, {0xE8,0x96,0x9D,3}, {0xE8,0x96,0x9E,3}, {0xE8,0x96,0x9F,3},
+        {0xE8,0x96,0xA0,3}, {0xE8,0x96,0xA1,3}, {0xE8,0x96,0xA2,3}, {0xE8,0x96,0xA3,3}, {0xE8,0x96,0xA5,3}, {0xE8,0x96,0xA6,3}, {0xE8,0x96,0xA7,3}, {0xE8,0x96,0xA9,3},
+        {0xE8,0x96,0xAB,3}, {0xE8,0x96,0xAC,3}, {0xE8,0x96,0xAD,3}, {0xE8,0x96,0xB1,3}, {0xE8,0x96,0xB2,3}, {0xE8,0x96,0xB3,3}, {0xE8,0x96,0xB4,3}, {0xE8,0x96,0xB5,3},
+        {0xE8,0x96,0xB6,3}, {0xE8,0x96,0xB8,3}, {0xE8,0x96,0xBA,3}, {0xE8,0x96,0xBB,3}, {0xE8,0x96,0xBC,3}, {0xE8,0x96,0xBD,3}, {0xE8,0x96,0xBE,3}, {0xE8,0x96,0xBF,3},
+        {0xE8,0x97,0x80,3}, {0xE8,0x97,0x82,3}, {0xE8,0x97,0x83,3}, {0xE8,0x97,0x84,3}, {0xE8,0x97,0x85,3}, {0xE8,0x97,0x86,3}, {0xE8,0x97,0x87,3}, {0xE8,0x97,0x88,3},
+        {0xE8,0x97,0x8A,3}, {0xE8,0x97,0x8B,3}, {0xE8,0x97,0x8C,3}, {0xE8,0x97,0x8D,3}, {0xE8,0x97,0x8E,3}, {0xE8,0x97,0x91,3}, {0xE8,0x97,0x92,3}, {0xE8,0x97,0x94,3},
+        {0xE8,0x97,0x96,3}, {0xE8,0x97,0x97,3}, {0xE8,0x97,0x98,3}, {0xE8,0x97,0x99,3}, {0xE8,0x97,0x9A,3}, {0xE8,0x97,0x9B,3}, {0xE8,0x97,0x9D,3}, {0xE8,0x97,0x9E,3},
+        {0xE8,0x97,0x9F,3}, {0xE8,0x97,0xA0,3}, {0xE8,0x97,0xA1,3}, {0xE8,0x97,0xA2,3}, {0xE8,0x97,0xA3,3}, {0xE8,0x97,0xA5,3}, {0xE8,0x97,0xA6,3}, {0xE8,0x97,0xA7,3},
+        {0xE8,0x97,0xA8,3}, {0xE8,0x97,0xAA,3}, {0xE8,0x97,0xAB,3}, {0xE8,0x97,0xAC,3}, {0xE8,0x97,0xAD,3}, {0xE8,0x97,0xAE,3}, {0xE8,0x97,0xAF,3}, {0xE8,0x97,0xB0,3},
+        {0xE8,0x97,0xB1,3}, {0xE8,0x97,0xB2,3}, {0xE8,0x97,0xB3,3}, {0xE8,0x97,0xB4,3}, {0xE8,0x97,0xB5,3}, {0xE8,0x97,0xB6,3}, {0xE8,0x97,0xB7,3}, {0xE8,0x97,0xB8,3},
+        {0xE6,0x81,0x95,3}, {0xE5,0x88,0xB7,3}, {0xE8,0x80,0x8D,3}, {0xE6,0x91,0x94,3}, {0xE8,0xA1,0xB0,3}, {0xE7,0x94,0xA9,3}, {0xE5,0xB8,0x85,3}, {0xE6,0xA0,0x93,3},
+        {0xE6,0x8B,0xB4,3}, {0xE9,0x9C,0x9C,3}, {0xE5,0x8F,0x8C,3}, {0xE7,0x88,0xBD,3}, {0xE8,0xB0,0x81,3}, {0xE6,0xB0,0xB4,3}, {0xE7,0x9D,0xA1,3}, {0xE7,0xA8,0x8E,3},
+        {0xE5,0x90,0xAE,3}, {0xE7,0x9E,0xAC,3}, {0xE9,0xA1,0xBA,3}, {0xE8,0x88,0x9C,3}, {0xE8,0xAF,0xB4,3}, {0xE7,0xA1,0x95,3}, {0xE6,0x9C,0x94,3}, {0xE7,0x83,0x81,3},
+        {0xE6,0x96,0xAF,3}, {0xE6,0x92,0x95,3}, {0xE5,0x98,0xB6,3}, {0xE6,0x80,0x9D,3}, {0xE7,0xA7,0x81,3}, {0xE5,0x8F,0xB8,3}, {0xE4,0xB8,0x9D,3}, {0xE6,0xAD,0xBB,3},
+        {0xE8,0x82,0x86,3}, {0xE5,0xAF,0xBA,3}, {0xE5,0x97,0xA3,3}, {0xE5,0x9B,0x9B,3}, {0xE4,0xBC,0xBA,3}, {0xE4,0xBC,0xBC,3}, {0xE9,0xA5,0xB2,3}, {0xE5,0xB7,0xB3,3},
+        {0xE6,0x9D,0xBE,3}, {0xE8,0x80,0xB8,3}, {0xE6,0x80,0x82,3}, {0xE9,0xA2,0x82,3}, {0xE9,0x80,0x81,3}, {0xE5,0xAE,0x8B,3}, {0xE8,0xAE,0xBC,3}, {0xE8,0xAF,0xB5,3},
+        {0xE6,0x90,0x9C,3}, {0xE8,0x89,0x98,3}, {0xE6,0x93,0x9E,3}, {0xE5,0x97,0xBD,3}, {0xE8,0x8B,0x8F,3}, {0xE9,0x85,0xA5,3}, {0xE4,0xBF,0x97,3}, {0xE7,0xB4,0xA0,3},
+        {0xE9,0x80,0x9F,3}, {0xE7,0xB2,0x9F,3}, {0xE5,0x83,0xB3,3}, {0xE5,0xA1,0x91,3}, {0xE6,0xBA,0xAF,3}, {0xE5,0xAE,0xBF,3}, {0xE8,0xAF,0x89,3}, {0xE8,0x82,0x83,3},
+        {0xE9,0x85,0xB8,3}, {0xE8,0x92,0x9C,3}, {0xE7,0xAE,0x97,3}, {0xE8,0x99,0xBD,3}, {0xE9,0x9A,0x8B,3}, {0xE9,0x9A,0x8F,3}, {0xE7,0xBB,0xA5,3}, {0xE9,0xAB,0x93,3},
+        {0xE7,0xA2,0x8E,3}, {0xE5,0xB2,0x81,3}, {0xE7,0xA9,0x97,3}, {0xE9,0x81,0x82,3}, {0xE9,0x9A,0xA7,3}, {0xE7,0xA5,0x9F,3}, {0xE5,0xAD,0x99,3}, {0xE6,0x8D,0x9F,3},
+        {0xE7,0xAC,0x8B,3}, {0xE8,0x93,0x91,3}, {0xE6,0xA2,0xAD,3}, {0xE5,0x94,0x86,3}, {0xE7,0xBC,0xA9,3}, {0xE7,0x90,0x90,3}, {0xE7,0xB4,0xA2,3}, {0xE9,0x94,0x81,3},
+        {0xE6,0x89,0x80,3}, {0xE5,0xA1,0x8C,3}, {0xE4,0xBB,0x96,3}, {0xE5,0xAE,0x83,3}, {0xE5,0xA5,0xB9,3}, {0xE5,0xA1,0x94,3},
+    },
+    /* 0xCC */ {
+        {0xE8,0x97,0xB9,3}, {0xE8,0x97,0xBA,3}, {0xE8,0x97,0xBC,3}, {0xE8,0x97,0xBD,3}, {0xE8,0x97,0xBE,3}, {0xE8,0x98,0x80,3}, {0xE8,0x98,0x81,3}, {0xE8,0x98,0x82,3},
+        {0xE8,0x98,0x83,3}, {0xE8,0x98,0x84,3}, {0xE8,0x98,0x86,3}, {0xE8,0x98,0x87,3}, {0xE8,0x98,0x88,3}, {0xE8,0x98,0x89,3}, {0xE8,0x98,0x8A,3}, {0xE8,0x98,0x8B,3},
+        {0xE8,0x98,0x8C,3}, {0xE8,0x98,0x8D,3}, {0xE8,0x98,0x8E,3}, {0xE8,0x98,0x8F,3}, {0xE8,0x98,0x90,3}, {0xE8,0x98,0x92,3}, {0xE8,0x98,0x93,3}, {0xE8,0x98,0x94,3},
+        {0xE8,0x98,0x95,3}, {0xE8,0x98,0x97,3}, {0xE8,0x98,0x98,3}, {0xE8,0x98,0x99,3}, {0xE8,0x98,0x9A,3}, {0xE8,0x98,0x9B,3}, {0xE8,0x98,0x9C,3}, {0xE8,0x98,0x9D,3},
+        {0xE8,0x98,0x9E,3}, {0xE8,0x98,0x9F,3}, {0xE8,0x98,0xA0,3}, {0xE8,0x98,0xA1,3}, {0xE8,0x98,0xA2,3}, {0xE8,0x98,0xA3,3}, {0xE8,0x98,0xA4,3}, {0xE8,0x98,0xA5,3},
+        {0xE8,0x98,0xA6,3}, {0xE8,0x98,0xA8,3}, {0xE8,0x98,0xAA,3}, {0xE8,0x98,0xAB,3}, {0xE8,0x98,0xAC,3}, {0xE8,0x98,0xAD,3}, {0xE8,0x98,0xAE,3}, {0xE8,0x98,0xAF,3},
+        {0xE8,0x98,0xB0,3}, {0xE8,0x98,0xB1,3}, {0xE8,0x98,0xB2,3}, {0xE8,0x98,0xB3,3}, {0xE8,0x98,0xB4,3}, {0xE8,0x98,0xB5,3}, {0xE8,0x98,0xB6,3}, {0xE8,0x98,0xB7,3},
+        {0xE8,0x98,0xB9,3}, {0xE8,0x98,0xBA,3}, {0xE8,0x98,0xBB,3}, {0xE8,0x98,0xBD,3}, {0xE8,0x98,0xBE,3}, {0xE8,0x98,0xBF,3}, {0xE8,0x99,0x80,3}, {0xE8,0x99,0x81,3},
+        {0xE8,0x99,0x82,3}, {0xE8,0x99,0x83,3}, {0xE8,0x99,0x84,3}, {0xE8,0x99,0x85,3}, {0xE8,0x99,0x86,3}, {0xE8,0x99,0x87,3}, {0xE8,0x99,0x88,3}, {0xE8,0x99,0x89,3},
+        {0xE8,0x99,0x8A,3}, {0xE8,0x99,0x8B,3}, {0xE8,0x99,0x8C,3}, {0xE8,0x99,0x92,3}, {0xE8,0x99,0x93,3}, {0xE8,0x99,0x95,3}, {0xE8,0x99,0x96,3}, {0xE8,0x99,0x97,3},
+        {0xE8,0x99,0x98,3}, {0xE8,0x99,0x99,3}, {0xE8,0x99,0x9B,3}, {0xE8,0x99,0x9C,3}, {0xE8,0x99,0x9D,3}, {0xE8,0x99,0x9F,3}, {0xE8,0x99,0xA0,3}, {0xE8,0x99,0xA1,3},
+        {0xE8,0x99,0xA3,3}, {0xE8,0x99,0xA4,3}, {0xE8,0x99,0xA5,3}, {0xE8,0x99,0xA6,3}, {0xE8,0x99,0xA7,3}, {0xE8,0x99,0xA8,3}, {0xE8,0x99,0xA9,3}, {0xE8,0x99,0xAA,3},
+        {0xE7,0x8D,0xAD,3}, {0xE6,0x8C,0x9E,3}, {0xE8,0xB9,0x8B,3}, {0xE8,0xB8,0x8F,3}, {0xE8,0x83,0x8E,3}, {0xE8,0x8B,0x94,3}, {0xE6,0x8A,0xAC,3}, {0xE5,0x8F,0xB0,3},
+        {0xE6,0xB3,0xB0,3}, {0xE9,0x85,0x9E,3}, {0xE5,0xA4,0xAA,3}, {0xE6,0x80,0x81,3}, {0xE6,0xB1,0xB0,3}, {0xE5,0x9D,0x8D,3}, {0xE6,0x91,0x8A,3}, {0xE8,0xB4,0xAA,3},
+        {0xE7,0x98,0xAB,3}, {0xE6,0xBB,0xA9,3}, {0xE5,0x9D,0x9B,3}, {0xE6,0xAA,0x80,3}, {0xE7,0x97,0xB0,3}, {0xE6,0xBD,0xAD,3}, {0xE8,0xB0,0xAD,3}, {0xE8,0xB0,0x88,3},
+        {0xE5,0x9D,0xA6,3}, {0xE6,0xAF,0xAF,3}, {0xE8,0xA2,0x92,3}, {0xE7,0xA2,0xB3,3}, {0xE6,0x8E,0xA2,3}, {0xE5,0x8F,0xB9,3}, {0xE7,0x82,0xAD,3}, {0xE6,0xB1,0xA4,3},
+        {0xE5,0xA1,0x98,3}, {0xE6,0x90,0xAA,3}, {0xE5,0xA0,0x82,3}, {0xE6,0xA3,0xA0,3}, {0xE8,0x86,0x9B,3}, {0xE5,0x94,0x90,3}, {0xE7,0xB3,0x96,3}, {0xE5,0x80,0x98,3},
+        {0xE8,0xBA,0xBA,3}, {0xE6,0xB7,0x8C,3}, {0xE8,0xB6,0x9F,3}, {0xE7,0x83,0xAB,3}, {0xE6,0x8E,0x8F,3}, {0xE6,0xB6,0x9B,3}, {0xE6,0xBB,0x94,3}, {0xE7,0xBB,0xA6,3},
+        {0xE8,0x90,0x84,3}, {0xE6,0xA1,0x83,3}, {0xE9,0x80,0x83,3}, {0xE6,0xB7,0x98,3}, {0xE9,0x99,0xB6,3}, {0xE8,0xAE,0xA8,3}, {0xE5,0xA5,0x97,3}, {0xE7,0x89,0xB9,3},
+        {0xE8,0x97,0xA4,3}, {0xE8,0x85,0xBE,3}, {0xE7,0x96,0xBC,3}, {0xE8,0xAA,0x8A,3}, {0xE6,0xA2,0xAF,3}, {0xE5,0x89,0x94,3}, {0xE8,0xB8,0xA2,3}, {0xE9,0x94,0x91,3},
+        {0xE6,0x8F,0x90,3}, {0xE9,0xA2,0x98,3}, {0xE8,0xB9,0x84,3}, {0xE5,0x95,0xBC,3}, {0xE4,0xBD,0x93,3}, {0xE6,0x9B,0xBF,3}, {0xE5,0x9A,0x8F,3}, {0xE6,0x83,0x95,3},
+        {0xE6,0xB6,0x95,3}, {0xE5,0x89,0x83,3}, {0xE5,0xB1,0x89,3}, {0xE5,0xA4,0xA9,3}, {0xE6,0xB7,0xBB,3}, {0xE5,0xA1,0xAB,3}, {0xE7,0x94,0xB0,3}, {0xE7,0x94,0x9C,3},
+        {0xE6,0x81,0xAC,3}, {0xE8,0x88,0x94,3}, {0xE8,0x85,0x86,3}, {0xE6,0x8C,0x91,3}, {0xE6,0x9D,0xA1,3}, {0xE8,0xBF,0xA2,3}, {0xE7,0x9C,0xBA,3}, {0xE8,0xB7,0xB3,3},
+        {0xE8,0xB4,0xB4,3}, {0xE9,0x93,0x81,3}, {0xE5,0xB8,0x96,3}, {0xE5,0x8E,0x85,3}, {0xE5,0x90,0xAC,3}, {0xE7,0x83,0x83,3},
+    },
+    /* 0xCD */ {
+        {0xE8,0x99,0xAD,3}, {0xE8,0x99,0xAF,3}, {0xE8,0x99,0xB0,3}, {0xE8,0x99,0xB2,3}, {0xE8,0x99,0xB3,3}, {0xE8,0x99,0xB4,3}, {0xE8,0x99,0xB5,3}, {0xE8,0x99,0xB6,3},
+        {0xE8,0x99,0xB7,3}, {0xE8,0x99,0xB8,3}, {0xE8,0x9A,0x83,3}, {0xE8,0x9A,0x84,3}, {0xE8,0x9A,0x85,3}, {0xE8,0x9A,0x86,3}, {0xE8,0x9A,0x87,3}, {0xE8,0x9A,0x88,3},
+        {0xE8,0x9A,0x89,3}, {0xE8,0x9A,0x8E,3}, {0xE8,0x9A,0x8F,3}, {0xE8,0x9A,0x90,3}, {0xE8,0x9A,0x91,3}, {0xE8,0x9A,0x92,3}, {0xE8,0x9A,0x94,3}, {0xE8,0x9A,0x96,3},
+        {0xE8,0x9A,0x97,3}, {0xE8,0x9A,0x98,3}, {0xE8,0x9A,0x99,3}, {0xE8,0x9A,0x9A,3}, {0xE8,0x9A,0x9B,3}, {0xE8,0x9A,0x9E,3}, {0xE8,0x9A,0x9F,3}, {0xE8,0x9A,0xA0,3},
+        {0xE8,0x9A,0xA1,3}, {0xE8,0x9A,0xA2,3}, {0xE8,0x9A,0xA5,3}, {0xE8,0x9A,0xA6,3}, {0xE8,0x9A,0xAB,3}, {0xE8,0x9A,0xAD,3}, {0xE8,0x9A,0xAE,3}, {0xE8,0x9A,0xB2,3},
+        {0xE8,0x9A,0xB3,3}, {0xE8,0x9A,0xB7,3}, {0xE8,0x9A,0xB8,3}, {0xE8,0x9A,0xB9,3}, {0xE8,0x9A,0xBB,3}, {0xE8,0x9A,0xBC,3}, {0xE8,0x9A,0xBD,3}, {0xE8,0x9A,0xBE,3},
+        {0xE8,0x9A,0xBF,3}, {0xE8,0x9B,0x81,3}, {0xE8,0x9B,0x82,3}, {0xE8,0x9B,0x83,3}, {0xE8,0x9B,0x85,3}, {0xE8,0x9B,0x88,3}, {0xE8,0x9B,0x8C,3}, {0xE8,0x9B,0x8D,3},
+        {0xE8,0x9B,0x92,3}, {0xE8,0x9B,0x93,3}, {0xE8,0x9B,0x95,3}, {0xE8,0x9B,0x96,3}, {0xE8,0x9B,0x97,3}, {0xE8,0x9B,0x9A,3}, {0xE8,0x9B,0x9C,3}, {0xE8,0x9B,0x9D,3},
+        {0xE8,0x9B,0xA0,3}, {0xE8,0x9B,0xA1,3}, {0xE8,0x9B,0xA2,3}, {0xE8,0x9B,0xA3,3}, {0xE8,0x9B,0xA5,3}, {0xE8,0x9B,0xA6,3}, {0xE8,0x9B,0xA7,3}, {0xE8,0x9B,0xA8,3},
+        {0xE8,0x9B,0xAA,3}, {0xE8,0x9B,0xAB,3}, {0xE8,0x9B,0xAC,3}, {0xE8,0x9B,0xAF,3}, {0xE8,0x9B,0xB5,3}, {0xE8,0x9B,0xB6,3}, {0xE8,0x9B,0xB7,3}, {0xE8,0x9B,0xBA,3},
+        {0xE8,0x9B,0xBB,3}, {0xE8,0x9B,0xBC,3}, {0xE8,0x9B,0xBD,3}, {0xE8,0x9B,0xBF,3}, {0xE8,0x9C,0x81,3}, {0xE8,0x9C,0x84,3}, {0xE8,0x9C,0x85,3}, {0xE8,0x9C,0x86,3},
+        {0xE8,0x9C,0x8B,3}, {0xE8,0x9C,0x8C,3}, {0xE8,0x9C,0x8E,3}, {0xE8,0x9C,0x8F,3}, {0xE8,0x9C,0x90,3}, {0xE8,0x9C,0x91,3}, {0xE8,0x9C,0x94,3}, {0xE8,0x9C,0x96,3},
+        {0xE6,0xB1,0x80,3}, {0xE5,0xBB,0xB7,3}, {0xE5,0x81,0x9C,3}, {0xE4,0xBA,0xAD,3}, {0xE5,0xBA,0xAD,3}, {0xE6,0x8C,0xBA,3}, {0xE8,0x89,0x87,3}, {0xE9,0x80,0x9A,3},
+        {0xE6,0xA1,0x90,3}, {0xE9,0x85,0xAE,3}, {0xE7,0x9E,0xB3,3}, {0xE5,0x90,0x8C,3}, {0xE9,0x93,0x9C,3}, {0xE5,0xBD,0xA4,3}, {0xE7,0xAB,0xA5,3}, {0xE6,0xA1,0xB6,3},
+        {0xE6,0x8D,0x85,3}, {0xE7,0xAD,0x92,3}, {0xE7,0xBB,0x9F,3}, {0xE7,0x97,0x9B,3}, {0xE5,0x81,0xB7,3}, {0xE6,0x8A,0x95,3}, {0xE5,0xA4,0xB4,3}, {0xE9,0x80,0x8F,3},
+        {0xE5,0x87,0xB8,3}, {0xE7,0xA7,0x83,3}, {0xE7,0xAA,0x81,3}, {0xE5,0x9B,0xBE,3}, {0xE5,0xBE,0x92,3}, {0xE9,0x80,0x94,3}, {0xE6,0xB6,0x82,3}, {0xE5,0xB1,0xA0,3},
+        {0xE5,0x9C,0x9F,3}, {0xE5,0x90,0x90,3}, {0xE5,0x85,0x94,3}, {0xE6,0xB9,0x8D,3}, {0xE5,0x9B,0xA2,3}, {0xE6,0x8E,0xA8,3}, {0xE9,0xA2,0x93,3}, {0xE8,0x85,0xBF,3},
+        {0xE8,0x9C,0x95,3}, {0xE8,0xA4,0xAA,3}, {0xE9,0x80,0x80,3}, {0xE5,0x90,0x9E,3}, {0xE5,0xB1,0xAF,3}, {0xE8,0x87,0x80,3}, {0xE6,0x8B,0x96,3}, {0xE6,0x89,0x98,3},
+        {0xE8,0x84,0xB1,3}, {0xE9,0xB8,0xB5,3}, {0xE9,0x99,0x80,3}, {0xE9,0xA9,0xAE,3}, {0xE9,0xA9,0xBC,3}, {0xE6,0xA4,0xAD,3}, {0xE5,0xA6,0xA5,3}, {0xE6,0x8B,0x93,3},
+        {0xE5,0x94,0xBE,3}, {0xE6,0x8C,0x96,3}, {0xE5,0x93,0x87,3}, {0xE8,0x9B,0x99,3}, {0xE6,0xB4,0xBC,3}, {0xE5,0xA8,0x83,3}, {0xE7,0x93,0xA6,3}, {0xE8,0xA2,0x9C,3},
+        {0xE6,0xAD,0xAA,3}, {0xE5,0xA4,0x96,3}, {0xE8,0xB1,0x8C,3}, {0xE5,0xBC,0xAF,3}, {0xE6,0xB9,0xBE,3}, {0xE7,0x8E,0xA9,3}, {0xE9,0xA1,0xBD,3}, {0xE4,0xB8,0xB8,3},
+        {0xE7,0x83,0xB7,3}, {0xE5,0xAE,0x8C,3}, {0xE7,0xA2,0x97,3}, {0xE6,0x8C,0xBD,3}, {0xE6,0x99,0x9A,3}, {0xE7,0x9A,0x96,3}, {0xE6,0x83,0x8B,3}, {0xE5,0xAE,0x9B,3},
+        {0xE5,0xA9,0x89,3}, {0xE4,0xB8,0x87,3}, {0xE8,0x85,0x95,3}, {0xE6,0xB1,0xAA,3}, {0xE7,0x8E,0x8B,3}, {0xE4,0xBA,0xA1,3}, {0xE6,0x9E,0x89,3}, {0xE7,0xBD,0x91,3},
+        {0xE5,0xBE,0x80,3}, {0xE6,0x97,0xBA,3}, {0xE6,0x9C,0x9B,3}, {0xE5,0xBF,0x98,3}, {0xE5,0xA6,0x84,3}, {0xE5,0xA8,0x81,3},
+    },
+    /* 0xCE */ {
+        {0xE8,0x9C,0x99,3}, {0xE8,0x9C,0x9B,3}, {0xE8,0x9C,0x9D,3}, {0xE8,0x9C,0x9F,3}, {0xE8,0x9C,0xA0,3}, {0xE8,0x9C,0xA4,3}, {0xE8,0x9C,0xA6,3}, {0xE8,0x9C,0xA7,3},
+        {0xE8,0x9C,0xA8,3}, {0xE8,0x9C,0xAA,3}, {0xE8,0x9C,0xAB,3}, {0xE8,0x9C,0xAC,3}, {0xE8,0x9C,0xAD,3}, {0xE8,0x9C,0xAF,3}, {0xE8,0x9C,0xB0,3}, {0xE8,0x9C,0xB2,3},
+        {0xE8,0x9C,0xB3,3}, {0xE8,0x9C,0xB5,3}, {0xE8,0x9C,0xB6,3}, {0xE8,0x9C,0xB8,3}, {0xE8,0x9C,0xB9,3}, {0xE8,0x9C,0xBA,3}, {0xE8,0x9C,0xBC,3}, {0xE8,0x9C,0xBD,3},
+        {0xE8,0x9D,0x80,3}, {0xE8,0x9D,0x81,3}, {0xE8,0x9D,0x82,3}, {0xE8,0x9D,0x83,3}, {0xE8,0x9D,0x84,3}, {0xE8,0x9D,0x85,3}, {0xE8,0x9D,0x86,3}, {0xE8,0x9D,0x8A,3},
+        {0xE8,0x9D,0x8B,3}, {0xE8,0x9D,0x8D,3}, {0xE8,0x9D,0x8F,3}, {0xE8,0x9D,0x90,3}, {0xE8,0x9D,0x91,3}, {0xE8,0x9D,0x92,3}, {0xE8,0x9D,0x94,3}, {0xE8,0x9D,0x95,3},
+        {0xE8,0x9D,0x96,3}, {0xE8,0x9D,0x98,3}, {0xE8,0x9D,0x9A,3}, {0xE8,0x9D,0x9B,3}, {0xE8,0x9D,0x9C,3}, {0xE8,0x9D,0x9D,3}, {0xE8,0x9D,0x9E,3}, {0xE8,0x9D,0x9F,3},
+        {0xE8,0x9D,0xA1,3}, {0xE8,0x9D,0xA2,3}, {0xE8,0x9D,0xA6,3}, {0xE8,0x9D,0xA7,3}, {0xE8,0x9D,0xA8,3}, {0xE8,0x9D,0xA9,3}, {0xE8,0x9D,0xAA,3}, {0xE8,0x9D,0xAB,3},
+        {0xE8,0x9D,0xAC,3}, {0xE8,0x9D,0xAD,3}, {0xE8,0x9D,0xAF,3}, {0xE8,0x9D,0xB1,3}, {0xE8,0x9D,0xB2,3}, {0xE8,0x9D,0xB3,3}, {0xE8,0x9D,0xB5,3}, {0xE8,0x9D,0xB7,3},
+        {0xE8,0x9D,0xB8,3}, {0xE8,0x9D,0xB9,3}, {0xE8,0x9D,0xBA,3}, {0xE8,0x9D,0xBF,3}, {0xE8,0x9E,0x80,3}, {0xE8,0x9E,0x81,3}, {0xE8,0x9E,0x84,3}, {0xE8,0x9E,0x86,3},
+        {0xE8,0x9E,0x87,3}, {0xE8,0x9E,0x89,3}, {0xE8,0x9E,0x8A,3}, {0xE8,0x9E,0x8C,3}, {0xE8,0x9E,0x8E,3}, {0xE8,0x9E,0x8F,3}, {0xE8,0x9E,0x90,3}, {0xE8,0x9E,0x91,3},
+        {0xE8,0x9E,0x92,3}, {0xE8,0x9E,0x94,3}, {0xE8,0x9E,0x95,3}, {0xE8,0x9E,0x96,3}, {0xE8,0x9E,0x98,3}, {0xE8,0x9E,0x99,3}, {0xE8,0x9E,0x9A,3}, {0xE8,0x9E,0x9B,3},
+        {0xE8,0x9E,0x9C,3}, {0xE8,0x9E,0x9D,3}, {0xE8,0x9E,0x9E,3}, {0xE8,0x9E,0xA0,3}, {0xE8,0x9E,0xA1,3}, {0xE8,0x9E,0xA2,3}, {0xE8,0x9E,0xA3,3}, {0xE8,0x9E,0xA4,3},
+        {0xE5,0xB7,0x8D,3}, {0xE5,0xBE,0xAE,3}, {0xE5,0x8D,0xB1,3}, {0xE9,0x9F,0xA6,3}, {0xE8,0xBF,0x9D,3}, {0xE6,0xA1,0x85,3}, {0xE5,0x9B,0xB4,3}, {0xE5,0x94,0xAF,3},
+        {0xE6,0x83,0x9F,3}, {0xE4,0xB8,0xBA,3}, {0xE6,0xBD,0x8D,3}, {0xE7,0xBB,0xB4,3}, {0xE8,0x8B,0x87,3}, {0xE8,0x90,0x8E,3}, {0xE5,0xA7,0x94,3}, {0xE4,0xBC,0x9F,3},
+        {0xE4,0xBC,0xAA,3}, {0xE5,0xB0,0xBE,3}, {0xE7,0xBA,0xAC,3}, {0xE6,0x9C,0xAA,3}, {0xE8,0x94,0x9A,3}, {0xE5,0x91,0xB3,3}, {0xE7,0x95,0x8F,3}, {0xE8,0x83,0x83,3},
+        {0xE5,0x96,0x82,3}, {0xE9,0xAD,0x8F,3}, {0xE4,0xBD,0x8D,3}, {0xE6,0xB8,0xAD,3}, {0xE8,0xB0,0x93,3}, {0xE5,0xB0,0x89,3}, {0xE6,0x85,0xB0,3}, {0xE5,0x8D,0xAB,3},
+        {0xE7,0x98,0x9F,3}, {0xE6,0xB8,0xA9,3}, {0xE8,0x9A,0x8A,3}, {0xE6,0x96,0x87,3}, {0xE9,0x97,0xBB,3}, {0xE7,0xBA,0xB9,3}, {0xE5,0x90,0xBB,3}, {0xE7,0xA8,0xB3,3},
+        {0xE7,0xB4,0x8A,3}, {0xE9,0x97,0xAE,3}, {0xE5,0x97,0xA1,3}, {0xE7,0xBF,0x81,3}, {0xE7,0x93,0xAE,3}, {0xE6,0x8C,0x9D,3}, {0xE8,0x9C,0x97,3}, {0xE6,0xB6,0xA1,3},
+        {0xE7,0xAA,0x9D,3}, {0xE6,0x88,0x91,3}, {0xE6,0x96,0xA1,3}, {0xE5,0x8D,0xA7,3}, {0xE6,0x8F,0xA1,3}, {0xE6,0xB2,0x83,3}, {0xE5,0xB7,0xAB,3}, {0xE5,0x91,0x9C,3},
+        {0xE9,0x92,0xA8,3}, {0xE4,0xB9,0x8C,3}, {0xE6,0xB1,0xA1,3}, {0xE8,0xAF,0xAC,3}, {0xE5,0xB1,0x8B,3}, {0xE6,0x97,0xA0,3}, {0xE8,0x8A,0x9C,3}, {0xE6,0xA2,0xA7,3},
+        {0xE5,0x90,0xBE,3}, {0xE5,0x90,0xB4,3}, {0xE6,0xAF,0x8B,3}, {0xE6,0xAD,0xA6,3}, {0xE4,0xBA,0x94,3}, {0xE6,0x8D,0x82,3}, {0xE5,0x8D,0x88,3}, {0xE8,0x88,0x9E,3},
+        {0xE4,0xBC,0x8D,3}, {0xE4,0xBE,0xAE,3}, {0xE5,0x9D,0x9E,3}, {0xE6,0x88,0x8A,3}, {0xE9,0x9B,0xBE,3}, {0xE6,0x99,0xA4,3}, {0xE7,0x89,0xA9,3}, {0xE5,0x8B,0xBF,3},
+        {0xE5,0x8A,0xA1,3}, {0xE6,0x82,0x9F,3}, {0xE8,0xAF,0xAF,3}, {0xE6,0x98,0x94,3}, {0xE7,0x86,0x99,3}, {0xE6,0x9E,0x90,3}, {0xE8,0xA5,0xBF,3}, {0xE7,0xA1,0x92,3},
+        {0xE7,0x9F,0xBD,3}, {0xE6,0x99,0xB0,3}, {0xE5,0x98,0xBB,3}, {0xE5,0x90,0xB8,3}, {0xE9,0x94,0xA1,3}, {0xE7,0x89,0xBA,3},
+    },
+    /* 0xCF */ {
+        {0xE8,0x9E,0xA5,3}, {0xE8,0x9E,0xA6,3}, {0xE8,0x9E,0xA7,3}, {0xE8,0x9E,0xA9,3}, {0xE8,0x9E,0xAA,3}, {0xE8,0x9E,0xAE,3}, {0xE8,0x9E,0xB0,3}, {0xE8,0x9E,0xB1,3},
+        {0xE8,0x9E,0xB2,3}, {0xE8,0x9E,0xB4,3}, {0xE8,0x9E,0xB6,3}, {0xE8,0x9E,0xB7,3}, {0xE8,0x9E,0xB8,3}, {0xE8,0x9E,0xB9,3}, {0xE8,0x9E,0xBB,3}, {0xE8,0x9E,0xBC,3},
+        {0xE8,0x9E,0xBE,3}, {0xE8,0x9E,0xBF,3}, {0xE8,0x9F,0x81,3}, {0xE8,0x9F,0x82,3}, {0xE8,0x9F,0x83,3}, {0xE8,0x9F,0x84,3}, {0xE8,0x9F,0x85,3}, {0xE8,0x9F,0x87,3},
+        {0xE8,0x9F,0x88,3}, {0xE8,0x9F,0x89,3}, {0xE8,0x9F,0x8C,3}, {0xE8,0x9F,0x8D,3}, {0xE8,0x9F,0x8E,3}, {0xE8,0x9F,0x8F,3}, {0xE8,0x9F,0x90,3}, {0xE8,0x9F,0x94,3},
+        {0xE8,0x9F,0x95,3}, {0xE8,0x9F,0x96,3}, {0xE8,0x9F,0x97,3}, {0xE8,0x9F,0x98,3}, {0xE8,0x9F,0x99,3}, {0xE8,0x9F,0x9A,3}, {0xE8,0x9F,0x9C,3}, {0xE8,0x9F,0x9D,3},
+        {0xE8,0x9F,0x9E,3}, {0xE8,0x9F,0x9F,3}, {0xE8,0x9F,0xA1,3}, {0xE8,0x9F,0xA2,3}, {0xE8,0x9F,0xA3,3}, {0xE8,0x9F,0xA4,3}, {0xE8,0x9F,0xA6,3}, {0xE8,0x9F,0xA7,3},
+        {0xE8,0x9F,0xA8,3}, {0xE8,0x9F,0xA9,3}, {0xE8,0x9F,0xAB,3}, {0xE8,0x9F,0xAC,3}, {0xE8,0x9F,0xAD,3}, {0xE8,0x9F,0xAF,3}, {0xE8,0x9F,0xB0,3}, {0xE8,0x9F,0xB1,3},
+        {0xE8,0x9F,0xB2,3}, {0xE8,0x9F,0xB3,3}, {0xE8,0x9F,0xB4,3}, {0xE8,0x9F,0xB5,3}, {0xE8,0x9F,0xB6,3}, {0xE8,0x9F,0xB7,3}, {0xE8,0x9F,0xB8,3}, {0xE8,0x9F,0xBA,3},
+        {0xE8,0x9F,0xBB,3}, {0xE8,0x9F,0xBC,3}, {0xE8,0x9F,0xBD,3}, {0xE8,0x9F,0xBF,3}, {0xE8,0xA0,0x80,3}, {0xE8,0xA0,0x81,3}, {0xE8,0xA0,0x82,3}, {0xE8,0xA0,0x84,3},
+        {0xE8,0xA0,0x85,3}, {0xE8,0xA0,0x86,3}, {0xE8,0xA0,0x87,3}, {0xE8,0xA0,0x88,3}, {0xE8,0xA0,0x89,3}, {0xE8,0xA0,0x8B,3}, {0xE8,0xA0,0x8C,3}, {0xE8,0xA0,0x8D,3},
+        {0xE8,0xA0,0x8E,3}, {0xE8,0xA0,0x8F,3}, {0xE8,0xA0,0x90,3}, {0xE8,0xA0,0x91,3}, {0xE8,0xA0,0x92,3}, {0xE8,0xA0,0x94,3}, {0xE8,0xA0,0x97,3}, {0xE8,0xA0,0x98,3},
+        {0xE8,0xA0,0x99,3}, {0xE8,0xA0,0x9A,3}, {0xE8,0xA0,0x9C,3}, {0xE8,0xA0,0x9D,3}, {0xE8,0xA0,0x9E,3}, {0xE8,0xA0,0x9F,3}, {0xE8,0xA0,0xA0,3}, {0xE8,0xA0,0xA3,3},
+        {0xE7,0xA8,0x80,3}, {0xE6,0x81,0xAF,3}, {0xE5,0xB8,0x8C,3}, {0xE6,0x82,0x89,3}, {0xE8,0x86,0x9D,3}, {0xE5,0xA4,0x95,3}, {0xE6,0x83,0x9C,3}, {0xE7,0x86,0x84,3},
+        {0xE7,0x83,0xAF,3}, {0xE6,0xBA,0xAA,3}, {0xE6,0xB1,0x90,3}, {0xE7,0x8A,0x80,3}, {0xE6,0xAA,0x84,3}, {0xE8,0xA2,0xAD,3}, {0xE5,0xB8,0xAD,3}, {0xE4,0xB9,0xA0,3},
+        {0xE5,0xAA,0xB3,3}, {0xE5,0x96,0x9C,3}, {0xE9,0x93,0xA3,3}, {0xE6,0xB4,0x97,3}, {0xE7,0xB3,0xBB,3}, {0xE9,0x9A,0x99,3}, {0xE6,0x88,0x8F,3}, {0xE7,0xBB,0x86,3},
+        {0xE7,0x9E,0x8E,3}, {0xE8,0x99,0xBE,3}, {0xE5,0x8C,0xA3,3}, {0xE9,0x9C,0x9E,3}, {0xE8,0xBE,0x96,3}, {0xE6,0x9A,0x87,3}, {0xE5,0xB3,0xA1,3}, {0xE4,0xBE,0xA0,3},
+        {0xE7,0x8B,0xAD,3}, {0xE4,0xB8,0x8B,3}, {0xE5,0x8E,0xA6,3}, {0xE5,0xA4,0x8F,3}, {0xE5,0x90,0x93,3}, {0xE6,0x8E,0x80,3}, {0xE9,0x94,0xA8,3}, {0xE5,0x85,0x88,3},
+        {0xE4,0xBB,0x99,3}, {0xE9,0xB2,0x9C,3}, {0xE7,0xBA,0xA4,3}, {0xE5,0x92,0xB8,3}, {0xE8,0xB4,0xA4,3}, {0xE8,0xA1,0x94,3}, {0xE8,0x88,0xB7,3}, {0xE9,0x97,0xB2,3},
+        {0xE6,0xB6,0x8E,3}, {0xE5,0xBC,0xA6,3}, {0xE5,0xAB,0x8C,3}, {0xE6,0x98,0xBE,3}, {0xE9,0x99,0xA9,3}, {0xE7,0x8E,0xB0,3}, {0xE7,0x8C,0xAE,3}, {0xE5,0x8E,0xBF,3},
+        {0xE8,0x85,0xBA,3}, {0xE9,0xA6,0x85,3}, {0xE7,0xBE,0xA1,3}, {0xE5,0xAE,0xAA,3}, {0xE9,0x99,0xB7,3}, {0xE9,0x99,0x90,3}, {0xE7,0xBA,0xBF,3}, {0xE7,0x9B,0xB8,3},
+        {0xE5,0x8E,0xA2,3}, {0xE9,0x95,0xB6,3}, {0xE9,0xA6,0x99,3}, {0xE7,0xAE,0xB1,3}, {0xE8,0xA5,0x84,3}, {0xE6,0xB9,0x98,3}, {0xE4,0xB9,0xA1,3}, {0xE7,0xBF,0x94,3},
+        {0xE7,0xA5,0xA5,3}, {0xE8,0xAF,0xA6,3}, {0xE6,0x83,0xB3,3}, {0xE5,0x93,0x8D,3}, {0xE4,0xBA,0xAB,3}, {0xE9,0xA1,0xB9,3}, {0xE5,0xB7,0xB7,3}, {0xE6,0xA9,0xA1,3},
+        {0xE5,0x83,0x8F,3}, {0xE5,0x90,0x91,3}, {0xE8,0xB1,0xA1,3}, {0xE8,0x90,0xA7,3}, {0xE7,0xA1,0x9D,3}, {0xE9,0x9C,0x84,3}, {0xE5,0x89,0x8A,3}, {0xE5,0x93,0xAE,3},
+        {0xE5,0x9A,0xA3,3}, {0xE9,0x94,0x80,3}, {0xE6,0xB6,0x88,3}, {0xE5,0xAE,0xB5,3}, {0xE6,0xB7,0x86,3}, {0xE6,0x99,0x93,3},
+    },
+    /* 0xD0 */ {
+        {0xE8,0xA0,0xA4,3}, {0xE8,0xA0,0xA5,3}, {0xE8,0xA0,0xA6,3}, {0xE8,0xA0,0xA7,3}, {0xE8,0xA0,0xA8,3}, {0xE8,0xA0,0xA9,3}, {0xE8,0xA0,0xAA,3}, {0xE8,0xA0,0xAB,3},
+        {0xE8,0xA0,0xAC,3}, {0xE8,0xA0,0xAD,3}, {0xE8,0xA0,0xAE,3}, {0xE8,0xA0,0xAF,3}, {0xE8,0xA0,0xB0,3}, {0xE8,0xA0,0xB1,3}, {0xE8,0xA0,0xB3,3}, {0xE8,0xA0,0xB4,3},
+        {0xE8,0xA0,0xB5,3}, {0xE8,0xA0,0xB6,3}, {0xE8,0xA0,0xB7,3}, {0xE8,0xA0,0xB8,3}, {0xE8,0xA0,0xBA,3}, {0xE8,0xA0,0xBB,3}, {0xE8,0xA0,0xBD,3}, {0xE8,0xA0,0xBE,3},
+        {0xE8,0xA0,0xBF,3}, {0xE8,0xA1,0x81,3}, {0xE8,0xA1,0x82,3}, {0xE8,0xA1,0x83,3}, {0xE8,0xA1,0x86,3}, {0xE8,0xA1,0x87,3}, {0xE8,0xA1,0x88,3}, {0xE8,0xA1,0x89,3},
+        {0xE8,0xA1,0x8A,3}, {0xE8,0xA1,0x8B,3}, {0xE8,0xA1,0x8E,3}, {0xE8,0xA1,0x8F,3}, {0xE8,0xA1,0x90,3}, {0xE8,0xA1,0x91,3}, {0xE8,0xA1,0x92,3}, {0xE8,0xA1,0x93,3},
+        {0xE8,0xA1,0x95,3}, {0xE8,0xA1,0x96,3}, {0xE8,0xA1,0x98,3}, {0xE8,0xA1,0x9A,3}, {0xE8,0xA1,0x9B,3}, {0xE8,0xA1,0x9C,3}, {0xE8,0xA1,0x9D,3}, {0xE8,0xA1,0x9E,3},
+        {0xE8,0xA1,0x9F,3}, {0xE8,0xA1,0xA0,3}, {0xE8,0xA1,0xA6,3}, {0xE8,0xA1,0xA7,3}, {0xE8,0xA1,0xAA,3}, {0xE8,0xA1,0xAD,3}, {0xE8,0xA1,0xAF,3}, {0xE8,0xA1,0xB1,3},
+        {0xE8,0xA1,0xB3,3}, {0xE8,0xA1,0xB4,3}, {0xE8,0xA1,0xB5,3}, {0xE8,0xA1,0xB6,3}, {0xE8,0xA1,0xB8,3}, {0xE8,0xA1,0xB9,3}, {0xE8,0xA1,0xBA,3}, {0xE8,0xA1,0xBB,3},
+        {0xE8,0xA1,0xBC,3}, {0xE8,0xA2,0x80,3}, {0xE8,0xA2,0x83,3}, {0xE8,0xA2,0x86,3}, {0xE8,0xA2,0x87,3}, {0xE8,0xA2,0x89,3}, {0xE8,0xA2,0x8A,3}, {0xE8,0xA2,0x8C,3},
+        {0xE8,0xA2,0x8E,3}, {0xE8,0xA2,0x8F,3}, {0xE8,0xA2,0x90,3}, {0xE8,0xA2,0x91,3}, {0xE8,0xA2,0x93,3}, {0xE8,0xA2,0x94,3}, {0xE8,0xA2,0x95,3}, {0xE8,0xA2,0x97,3},
+        {0xE8,0xA2,0x98,3}, {0xE8,0xA2,0x99,3}, {0xE8,0xA2,0x9A,3}, {0xE8,0xA2,0x9B,3}, {0xE8,0xA2,0x9D,3}, {0xE8,0xA2,0x9E,3}, {0xE8,0xA2,0x9F,3}, {0xE8,0xA2,0xA0,3},
+        {0xE8,0xA2,0xA1,3}, {0xE8,0xA2,0xA3,3}, {0xE8,0xA2,0xA5,3}, {0xE8,0xA2,0xA6,3}, {0xE8,0xA2,0xA7,3}, {0xE8,0xA2,0xA8,3}, {0xE8,0xA2,0xA9,3}, {0xE8,0xA2,0xAA,3},
+        {0xE5,0xB0,0x8F,3}, {0xE5,0xAD,0x9D,3}, {0xE6,0xA0,0xA1,3}, {0xE8,0x82,0x96,3}, {0xE5,0x95,0xB8,3}, {0xE7,0xAC,0x91,3}, {0xE6,0x95,0x88,3}, {0xE6,0xA5,0x94,3},
+        {0xE4,0xBA,0x9B,3}, {0xE6,0xAD,0x87,3}, {0xE8,0x9D,0x8E,3}, {0xE9,0x9E,0x8B,3}, {0xE5,0x8D,0x8F,3}, {0xE6,0x8C,0x9F,3}, {0xE6,0x90,0xBA,3}, {0xE9,0x82,0xAA,3},
+        {0xE6,0x96,0x9C,3}, {0xE8,0x83,0x81,3}, {0xE8,0xB0,0x90,3}, {0xE5,0x86,0x99,3}, {0xE6,0xA2,0xB0,3}, {0xE5,0x8D,0xB8,3}, {0xE8,0x9F,0xB9,3}, {0xE6,0x87,0x88,3},
+        {0xE6,0xB3,0x84,3}, {0xE6,0xB3,0xBB,3}, {0xE8,0xB0,0xA2,3}, {0xE5,0xB1,0x91,3}, {0xE8,0x96,0xAA,3}, {0xE8,0x8A,0xAF,3}, {0xE9,0x94,0x8C,3}, {0xE6,0xAC,0xA3,3},
+        {0xE8,0xBE,0x9B,3}, {0xE6,0x96,0xB0,3}, {0xE5,0xBF,0xBB,3}, {0xE5,0xBF,0x83,3}, {0xE4,0xBF,0xA1,3}, {0xE8,0xA1,0x85,3}, {0xE6,0x98,0x9F,3}, {0xE8,0x85,0xA5,3},
+        {0xE7,0x8C,0xA9,3}, {0xE6,0x83,0xBA,3}, {0xE5,0x85,0xB4,3}, {0xE5,0x88,0x91,3}, {0xE5,0x9E,0x8B,3}, {0xE5,0xBD,0xA2,3}, {0xE9,0x82,0xA2,3}, {0xE8,0xA1,0x8C,3},
+        {0xE9,0x86,0x92,3}, {0xE5,0xB9,0xB8,3}, {0xE6,0x9D,0x8F,3}, {0xE6,0x80,0xA7,3}, {0xE5,0xA7,0x93,3}, {0xE5,0x85,0x84,3}, {0xE5,0x87,0xB6,3}, {0xE8,0x83,0xB8,3},
+        {0xE5,0x8C,0x88,3}, {0xE6,0xB1,0xB9,3}, {0xE9,0x9B,0x84,3}, {0xE7,0x86,0x8A,3}, {0xE4,0xBC,0x91,3}, {0xE4,0xBF,0xAE,3}, {0xE7,0xBE,0x9E,3}, {0xE6,0x9C,0xBD,3},
+        {0xE5,0x97,0x85,3}, {0xE9,0x94,0x88,3}, {0xE7,0xA7,0x80,3}, {0xE8,0xA2,0x96,3}, {0xE7,0xBB,0xA3,3}, {0xE5,0xA2,0x9F,3}, {0xE6,0x88,0x8C,3}, {0xE9,0x9C,0x80,3},
+        {0xE8,0x99,0x9A,3}, {0xE5,0x98,0x98,3}, {0xE9,0xA1,0xBB,3}, {0xE5,0xBE,0x90,3}, {0xE8,0xAE,0xB8,3}, {0xE8,0x93,0x84,3}, {0xE9,0x85,0x97,3}, {0xE5,0x8F,0x99,3},
+        {0xE6,0x97,0xAD,3}, {0xE5,0xBA,0x8F,3}, {0xE7,0x95,0x9C,3}, {0xE6,0x81,0xA4,3}, {0xE7,0xB5,0xAE,3}, {0xE5,0xA9,0xBF,3}, {0xE7,0xBB,0xAA,3}, {0xE7,0xBB,0xAD,3},
+        {0xE8,0xBD,0xA9,3}, {0xE5,0x96,0xA7,3}, {0xE5,0xAE,0xA3,3}, {0xE6,0x82,0xAC,3}, {0xE6,0x97,0x8B,3}, {0xE7,0x8E,0x84,3},
+    },
+    /* 0xD1 */ {
+        {0xE8,0xA2,0xAC,3}, {0xE8,0xA2,0xAE,3}, {0xE8,0xA2,0xAF,3}, {0xE8,0xA2,0xB0,3}, {0xE8,0xA2,0xB2,3}, {0xE8,0xA2,0xB3,3}, {0xE8,0xA2,0xB4,3}, {0xE8,0xA2,0xB5,3},
+        {0xE8,0xA2,0xB6,3}, {0xE8,0xA2,0xB8,3}, {0xE8,0xA2,0xB9,3}, {0xE8,0xA2,0xBA,3}, {0xE8,0xA2,0xBB,3}, {0xE8,0xA2,0xBD,3}, {0xE8,0xA2,0xBE,3}, {0xE8,0xA2,0xBF,3},
+        {0xE8,0xA3,0x80,3}, {0xE8,0xA3,0x83,3}, {0xE8,0xA3,0x84,3}, {0xE8,0xA3,0x87,3}, {0xE8,0xA3,0x88,3}, {0xE8,0xA3,0x8A,3}, {0xE8,0xA3,0x8B,3}, {0xE8,0xA3,0x8C,3},
+        {0xE8,0xA3,0x8D,3}, {0xE8,0xA3,0x8F,3}, {0xE8,0xA3,0x90,3}, {0xE8,0xA3,0x91,3}, {0xE8,0xA3,0x93,3}, {0xE8,0xA3,0x96,3}, {0xE8,0xA3,0x97,3}, {0xE8,0xA3,0x9A,3},
+        {0xE8,0xA3,0x9B,3}, {0xE8,0xA3,0x9C,3}, {0xE8,0xA3,0x9D,3}, {0xE8,0xA3,0x9E,3}, {0xE8,0xA3,0xA0,3}, {0xE8,0xA3,0xA1,3}, {0xE8,0xA3,0xA6,3}, {0xE8,0xA3,0xA7,3},
+        {0xE8,0xA3,0xA9,3}, {0xE8,0xA3,0xAA,3}, {0xE8,0xA3,0xAB,3}, {0xE8,0xA3,0xAC,3}, {0xE8,0xA3,0xAD,3}, {0xE8,0xA3,0xAE,3}, {0xE8,0xA3,0xAF,3}, {0xE8,0xA3,0xB2,3},
+        {0xE8,0xA3,0xB5,3}, {0xE8,0xA3,0xB6,3}, {0xE8,0xA3,0xB7,3}, {0xE8,0xA3,0xBA,3}, {0xE8,0xA3,0xBB,3}, {0xE8,0xA3,0xBD,3}, {0xE8,0xA3,0xBF,3}, {0xE8,0xA4,0x80,3},
+        {0xE8,0xA4,0x81,3}, {0xE8,0xA4,0x83,3}, {0xE8,0xA4,0x84,3}, {0xE8,0xA4,0x85,3}, {0xE8,0xA4,0x86,3}, {0xE8,0xA4,0x87,3}, {0xE8,0xA4,0x88,3}, {0xE8,0xA4,0x89,3},
+        {0xE8,0xA4,0x8B,3}, {0xE8,0xA4,0x8C,3}, {0xE8,0xA4,0x8D,3}, {0xE8,0xA4,0x8E,3}, {0xE8,0xA4,0x8F,3}, {0xE8,0xA4,0x91,3}, {0xE8,0xA4,0x94,3}, {0xE8,0xA4,0x95,3},
+        {0xE8,0xA4,0x96,3}, {0xE8,0xA4,0x97,3}, {0xE8,0xA4,0x98,3}, {0xE8,0xA4,0x9C,3}, {0xE8,0xA4,0x9D,3}, {0xE8,0xA4,0x9E,3}, {0xE8,0xA4,0x9F,3}, {0xE8,0xA4,0xA0,3},
+        {0xE8,0xA4,0xA2,3}, {0xE8,0xA4,0xA3,3}, {0xE8,0xA4,0xA4,3}, {0xE8,0xA4,0xA6,3}, {0xE8,0xA4,0xA7,3}, {0xE8,0xA4,0xA8,3}, {0xE8,0xA4,0xA9,3}, {0xE8,0xA4,0xAC,3},
+        {0xE8,0xA4,0xAD,3}, {0xE8,0xA4,0xAE,3}, {0xE8,0xA4,0xAF,3}, {0xE8,0xA4,0xB1,3}, {0xE8,0xA4,0xB2,3}, {0xE8,0xA4,0xB3,3}, {0xE8,0xA4,0xB5,3}, {0xE8,0xA4,0xB7,3},
+        {0xE9,0x80,0x89,3}, {0xE7,0x99,0xA3,3}, {0xE7,0x9C,0xA9,3}, {0xE7,0xBB,0x9A,3}, {0xE9,0x9D,0xB4,3}, {0xE8,0x96,0x9B,3}, {0xE5,0xAD,0xA6,3}, {0xE7,0xA9,0xB4,3},
+        {0xE9,0x9B,0xAA,3}, {0xE8,0xA1,0x80,3}, {0xE5,0x8B,0x8B,3}, {0xE7,0x86,0x8F,3}, {0xE5,0xBE,0xAA,3}, {0xE6,0x97,0xAC,3}, {0xE8,0xAF,0xA2,3}, {0xE5,0xAF,0xBB,3},
+        {0xE9,0xA9,0xAF,3}, {0xE5,0xB7,0xA1,3}, {0xE6,0xAE,0x89,3}, {0xE6,0xB1,0x9B,3}, {0xE8,0xAE,0xAD,3}, {0xE8,0xAE,0xAF,3}, {0xE9,0x80,0x8A,3}, {0xE8,0xBF,0x85,3},
+        {0xE5,0x8E,0x8B,3}, {0xE6,0x8A,0xBC,3}, {0xE9,0xB8,0xA6,3}, {0xE9,0xB8,0xAD,3}, {0xE5,0x91,0x80,3}, {0xE4,0xB8,0xAB,3}, {0xE8,0x8A,0xBD,3}, {0xE7,0x89,0x99,3},
+        {0xE8,0x9A,0x9C,3}, {0xE5,0xB4,0x96,3}, {0xE8,0xA1,0x99,3}, {0xE6,0xB6,0xAF,3}, {0xE9,0x9B,0x85,3}, {0xE5,0x93,0x91,3}, {0xE4,0xBA,0x9A,3}, {0xE8,0xAE,0xB6,3},
+        {0xE7,0x84,0x89,3}, {0xE5,0x92,0xBD,3}, {0xE9,0x98,0x89,3}, {0xE7,0x83,0x9F,3}, {0xE6,0xB7,0xB9,3}, {0xE7,0x9B,0x90,3}, {0xE4,0xB8,0xA5,3}, {0xE7,0xA0,0x94,3},
+        {0xE8,0x9C,0x92,3}, {0xE5,0xB2,0xA9,3}, {0xE5,0xBB,0xB6,3}, {0xE8,0xA8,0x80,3}, {0xE9,0xA2,0x9C,3}, {0xE9,0x98,0x8E,3}, {0xE7,0x82,0x8E,3}, {0xE6,0xB2,0xBF,3},
+        {0xE5,0xA5,0x84,3}, {0xE6,0x8E,0xA9,3}, {0xE7,0x9C,0xBC,3}, {0xE8,0xA1,0x8D,3}, {0xE6,0xBC,0x94,3}, {0xE8,0x89,0xB3,3}, {0xE5,0xA0,0xB0,3}, {0xE7,0x87,0x95,3},
+        {0xE5,0x8E,0x8C,3}, {0xE7,0xA0,0x9A,3}, {0xE9,0x9B,0x81,3}, {0xE5,0x94,0x81,3}, {0xE5,0xBD,0xA6,3}, {0xE7,0x84,0xB0,3}, {0xE5,0xAE,0xB4,3}, {0xE8,0xB0,0x9A,3},
+        {0xE9,0xAA,0x8C,3}, {0xE6,0xAE,0x83,3}, {0xE5,0xA4,0xAE,3}, {0xE9,0xB8,0xAF,3}, {0xE7,0xA7,0xA7,3}, {0xE6,0x9D,0xA8,3}, {0xE6,0x89,0xAC,3}, {0xE4,0xBD,0xAF,3},
+        {0xE7,0x96,0xA1,3}, {0xE7,0xBE,0x8A,3}, {0xE6,0xB4,0x8B,3}, {0xE9,0x98,0xB3,3}, {0xE6,0xB0,0xA7,3}, {0xE4,0xBB,0xB0,3}, {0xE7,0x97,0x92,3}, {0xE5,0x85,0xBB,3},
+        {0xE6,0xA0,0xB7,3}, {0xE6,0xBC,0xBE,3}, {0xE9,0x82,0x80,3}, {0xE8,0x85,0xB0,3}, {0xE5,0xA6,0x96,3}, {0xE7,0x91,0xB6,3},
+    },
+    /* 0xD2 */ {
+        {0xE8,0xA4,0xB8,3}, {0xE8,0xA4,0xB9,3}, {0xE8,0xA4,0xBA,3}, {0xE8,0xA4,0xBB,3}, {0xE8,0xA4,0xBC,3}, {0xE8,0xA4,0xBD,3}, {0xE8,0xA4,0xBE,3}, {0xE8,0xA4,0xBF,3},
+        {0xE8,0xA5,0x80,3}, {0xE8,0xA5,0x82,3}, {0xE8,0xA5,0x83,3}, {0xE8,0xA5,0x85,3}, {0xE8,0xA5,0x86,3}, {0xE8,0xA5,0x87,3}, {0xE8,0xA5,0x88,3}, {0xE8,0xA5,0x89,3},
+        {0xE8,0xA5,0x8A,3}, {0xE8,0xA5,0x8B,3}, {0xE8,0xA5,0x8C,3}, {0xE8,0xA5,0x8D,3}, {0xE8,0xA5,0x8E,3}, {0xE8,0xA5,0x8F,3}, {0xE8,0xA5,0x90,3}, {0xE8,0xA5,0x91,3},
+        {0xE8,0xA5,0x92,3}, {0xE8,0xA5,0x93,3}, {0xE8,0xA5,0x94,3}, {0xE8,0xA5,0x95,3}, {0xE8,0xA5,0x96,3}, {0xE8,0xA5,0x97,3}, {0xE8,0xA5,0x98,3}, {0xE8,0xA5,0x99,3},
+        {0xE8,0xA5,0x9A,3}, {0xE8,0xA5,0x9B,3}, {0xE8,0xA5,0x9C,3}, {0xE8,0xA5,0x9D,3}, {0xE8,0xA5,0xA0,3}, {0xE8,0xA5,0xA1,3}, {0xE8,0xA5,0xA2,3}, {0xE8,0xA5,0xA3,3},
+        {0xE8,0xA5,0xA4,3}, {0xE8,0xA5,0xA5,3}, {0xE8,0xA5,0xA7,3}, {0xE8,0xA5,0xA8,3}, {0xE8,0xA5,0xA9,3}, {0xE8,0xA5,0xAA,3}, {0xE8,0xA5,0xAB,3}, {0xE8,0xA5,0xAC,3},
+        {0xE8,0xA5,0xAD,3}, {0xE8,0xA5,0xAE,3}, {0xE8,0xA5,0xAF,3}, {0xE8,0xA5,0xB0,3}, {0xE8,0xA5,0xB1,3}, {0xE8,0xA5,0xB2,3}, {0xE8,0xA5,0xB3,3}, {0xE8,0xA5,0xB4,3},
+        {0xE8,0xA5,0xB5,3}, {0xE8,0xA5,0xB6,3}, {0xE8,0xA5,0xB7,3}, {0xE8,0xA5,0xB8,3}, {0xE8,0xA5,0xB9,3}, {0xE8,0xA5,0xBA,3}, {0xE8,0xA5,0xBC,3}, {0xE8,0xA5,0xBD,3},
+        {0xE8,0xA5,0xBE,3}, {0xE8,0xA6,0x80,3}, {0xE8,0xA6,0x82,3}, {0xE8,0xA6,0x84,3}, {0xE8,0xA6,0x85,3}, {0xE8,0xA6,0x87,3}, {0xE8,0xA6,0x88,3}, {0xE8,0xA6,0x89,3},
+        {0xE8,0xA6,0x8A,3}, {0xE8,0xA6,0x8B,3}, {0xE8,0xA6,0x8C,3}, {0xE8,0xA6,0x8D,3}, {0xE8,0xA6,0x8E,3}, {0xE8,0xA6,0x8F,3}, {0xE8,0xA6,0x90,3}, {0xE8,0xA6,0x91,3},
+        {0xE8,0xA6,0x92,3}, {0xE8,0xA6,0x93,3}, {0xE8,0xA6,0x94,3}, {0xE8,0xA6,0x95,3}, {0xE8,0xA6,0x96,3}, {0xE8,0xA6,0x97,3}, {0xE8,0xA6,0x98,3}, {0xE8,0xA6,0x99,3},
+        {0xE8,0xA6,0x9A,3}, {0xE8,0xA6,0x9B,3}, {0xE8,0xA6,0x9C,3}, {0xE8,0xA6,0x9D,3}, {0xE8,0xA6,0x9E,3}, {0xE8,0xA6,0x9F,3}, {0xE8,0xA6,0xA0,3}, {0xE8,0xA6,0xA1,3},
+        {0xE6,0x91,0x87,3}, {0xE5,0xB0,0xA7,3}, {0xE9,0x81,0xA5,3}, {0xE7,0xAA,0x91,3}, {0xE8,0xB0,0xA3,3}, {0xE5,0xA7,0x9A,3}, {0xE5,0x92,0xAC,3}, {0xE8,0x88,0x80,3},
+        {0xE8,0x8D,0xAF,3}, {0xE8,0xA6,0x81,3}, {0xE8,0x80,0x80,3}, {0xE6,0xA4,0xB0,3}, {0xE5,0x99,0x8E,3}, {0xE8,0x80,0xB6,3}, {0xE7,0x88,0xB7,3}, {0xE9,0x87,0x8E,3},
+        {0xE5,0x86,0xB6,3}, {0xE4,0xB9,0x9F,3}, {0xE9,0xA1,0xB5,3}, {0xE6,0x8E,0x96,3}, {0xE4,0xB8,0x9A,3}, {0xE5,0x8F,0xB6,3}, {0xE6,0x9B,0xB3,3}, {0xE8,0x85,0x8B,3},
+        {0xE5,0xA4,0x9C,3}, {0xE6,0xB6,0xB2,3}, {0xE4,0xB8,0x80,3}, {0xE5,0xA3,0xB9,3}, {0xE5,0x8C,0xBB,3}, {0xE6,0x8F,0x96,3}, {0xE9,0x93,0xB1,3}, {0xE4,0xBE,0x9D,3},
+        {0xE4,0xBC,0x8A,3}, {0xE8,0xA1,0xA3,3}, {0xE9,0xA2,0x90,3}, {0xE5,0xA4,0xB7,3}, {0xE9,0x81,0x97,3}, {0xE7,0xA7,0xBB,3}, {0xE4,0xBB,0xAA,3}, {0xE8,0x83,0xB0,3},
+        {0xE7,0x96,0x91,3}, {0xE6,0xB2,0x82,3}, {0xE5,0xAE,0x9C,3}, {0xE5,0xA7,0xA8,3}, {0xE5,0xBD,0x9D,3}, {0xE6,0xA4,0x85,3}, {0xE8,0x9A,0x81,3}, {0xE5,0x80,0x9A,3},
+        {0xE5,0xB7,0xB2,3}, {0xE4,0xB9,0x99,3}, {0xE7,0x9F,0xA3,3}, {0xE4,0xBB,0xA5,3}, {0xE8,0x89,0xBA,3}, {0xE6,0x8A,0x91,3}, {0xE6,0x98,0x93,3}, {0xE9,0x82,0x91,3},
+        {0xE5,0xB1,0xB9,3}, {0xE4,0xBA,0xBF,3}, {0xE5,0xBD,0xB9,3}, {0xE8,0x87,0x86,3}, {0xE9,0x80,0xB8,3}, {0xE8,0x82,0x84,3}, {0xE7,0x96,0xAB,3}, {0xE4,0xBA,0xA6,3},
+        {0xE8,0xA3,0x94,3}, {0xE6,0x84,0x8F,3}, {0xE6,0xAF,0x85,3}, {0xE5,0xBF,0x86,3}, {0xE4,0xB9,0x89,3}, {0xE7,0x9B,0x8A,3}, {0xE6,0xBA,0xA2,3}, {0xE8,0xAF,0xA3,3},
+        {0xE8,0xAE,0xAE,3}, {0xE8,0xB0,0x8A,3}, {0xE8,0xAF,0x91,3}, {0xE5,0xBC,0x82,3}, {0xE7,0xBF,0xBC,3}, {0xE7,0xBF,0x8C,3}, {0xE7,0xBB,0x8E,3}, {0xE8,0x8C,0xB5,3},
+        {0xE8,0x8D,0xAB,3}, {0xE5,0x9B,0xA0,3}, {0xE6,0xAE,0xB7,3}, {0xE9,0x9F,0xB3,3}, {0xE9,0x98,0xB4,3}, {0xE5,0xA7,0xBB,3}, {0xE5,0x90,0x9F,3}, {0xE9,0x93,0xB6,3},
+        {0xE6,0xB7,0xAB,3}, {0xE5,0xAF,0x85,3}, {0xE9,0xA5,0xAE,3}, {0xE5,0xB0,0xB9,3}, {0xE5,0xBC,0x95,3}, {0xE9,0x9A,0x90,3},
+    },
+    /* 0xD3 */ {
+        {0xE8,0xA6,0xA2,3}, {0xE8,0xA6,0xA3,3}, {0xE8,0xA6,0xA4,3}, {0xE8,0xA6,0xA5,3}, {0xE8,0xA6,0xA6,3}, {0xE8,0xA6,0xA7,3}, {0xE8,0xA6,0xA8,3}, {0xE8,0xA6,0xA9,3},
+        {0xE8,0xA6,0xAA,3}, {0xE8,0xA6,0xAB,3}, {0xE8,0xA6,0xAC,3}, {0xE8,0xA6,0xAD,3}, {0xE8,0xA6,0xAE,3}, {0xE8,0xA6,0xAF,3}, {0xE8,0xA6,0xB0,3}, {0xE8,0xA6,0xB1,3},
+        {0xE8,0xA6,0xB2,3}, {0xE8,0xA6,0xB3,3}, {0xE8,0xA6,0xB4,3}, {0xE8,0xA6,0xB5,3}, {0xE8,0xA6,0xB6,3}, {0xE8,0xA6,0xB7,3}, {0xE8,0xA6,0xB8,3}, {0xE8,0xA6,0xB9,3},
+        {0xE8,0xA6,0xBA,3}, {0xE8,0xA6,0xBB,3}, {0xE8,0xA6,0xBC,3}, {0xE8,0xA6,0xBD,3}, {0xE8,0xA6,0xBE,3}, {0xE8,0xA6,0xBF,3}, {0xE8,0xA7,0x80,3}, {0xE8,0xA7,0x83,3},
+        {0xE8,0xA7,0x8D,3}, {0xE8,0xA7,0x93,3}, {0xE8,0xA7,0x94,3}, {0xE8,0xA7,0x95,3}, {0xE8,0xA7,0x97,3}, {0xE8,0xA7,0x98,3}, {0xE8,0xA7,0x99,3}, {0xE8,0xA7,0x9B,3},
+        {0xE8,0xA7,0x9D,3}, {0xE8,0xA7,0x9F,3}, {0xE8,0xA7,0xA0,3}, {0xE8,0xA7,0xA1,3}, {0xE8,0xA7,0xA2,3}, {0xE8,0xA7,0xA4,3}, {0xE8,0xA7,0xA7,3}, {0xE8,0xA7,0xA8,3},
+        {0xE8,0xA7,0xA9,3}, {0xE8,0xA7,0xAA,3}, {0xE8,0xA7,0xAC,3}, {0xE8,0xA7,0xAD,3}, {0xE8,0xA7,0xAE,3}, {0xE8,0xA7,0xB0,3}, {0xE8,0xA7,0xB1,3}, {0xE8,0xA7,0xB2,3},
+        {0xE8,0xA7,0xB4,3}, {0xE8,0xA7,0xB5,3}, {0xE8,0xA7,0xB6,3}, {0xE8,0xA7,0xB7,3}, {0xE8,0xA7,0xB8,3}, {0xE8,0xA7,0xB9,3}, {0xE8,0xA7,0xBA,3}, {0xE8,0xA7,0xBB,3},
+        {0xE8,0xA7,0xBC,3}, {0xE8,0xA7,0xBD,3}, {0xE8,0xA7,0xBE,3}, {0xE8,0xA7,0xBF,3}, {0xE8,0xA8,0x81,3}, {0xE8,0xA8,0x82,3}, {0xE8,0xA8,0x83,3}, {0xE8,0xA8,0x84,3},
+        {0xE8,0xA8,0x85,3}, {0xE8,0xA8,0x86,3}, {0xE8,0xA8,0x88,3}, {0xE8,0xA8,0x89,3}, {0xE8,0xA8,0x8A,3}, {0xE8,0xA8,0x8B,3}, {0xE8,0xA8,0x8C,3}, {0xE8,0xA8,0x8D,3},
+        {0xE8,0xA8,0x8E,3}, {0xE8,0xA8,0x8F,3}, {0xE8,0xA8,0x90,3}, {0xE8,0xA8,0x91,3}, {0xE8,0xA8,0x92,3}, {0xE8,0xA8,0x93,3}, {0xE8,0xA8,0x94,3}, {0xE8,0xA8,0x95,3},
+        {0xE8,0xA8,0x96,3}, {0xE8,0xA8,0x97,3}, {0xE8,0xA8,0x98,3}, {0xE8,0xA8,0x99,3}, {0xE8,0xA8,0x9A,3}, {0xE8,0xA8,0x9B,3}, {0xE8,0xA8,0x9C,3}, {0xE8,0xA8,0x9D,3},
+        {0xE5,0x8D,0xB0,3}, {0xE8,0x8B,0xB1,3}, {0xE6,0xA8,0xB1,3}, {0xE5,0xA9,0xB4,3}, {0xE9,0xB9,0xB0,3}, {0xE5,0xBA,0x94,3}, {0xE7,0xBC,0xA8,3}, {0xE8,0x8E,0xB9,3},
+        {0xE8,0x90,0xA4,3}, {0xE8,0x90,0xA5,3}, {0xE8,0x8D,0xA7,3}, {0xE8,0x9D,0x87,3}, {0xE8,0xBF,0x8E,3}, {0xE8,0xB5,0xA2,3}, {0xE7,0x9B,0x88,3}, {0xE5,0xBD,0xB1,3},
+        {0xE9,0xA2,0x96,3}, {0xE7,0xA1,0xAC,3}, {0xE6,0x98,0xA0,3}, {0xE5,0x93,0x9F,3}, {0xE6,0x8B,0xA5,3}, {0xE4,0xBD,0xA3,3}, {0xE8,0x87,0x83,3}, {0xE7,0x97,0x88,3},
+        {0xE5,0xBA,0xB8,3}, {0xE9,0x9B,0x8D,3}, {0xE8,0xB8,0x8A,3}, {0xE8,0x9B,0xB9,3}, {0xE5,0x92,0x8F,3}, {0xE6,0xB3,0xB3,3}, {0xE6,0xB6,0x8C,3}, {0xE6,0xB0,0xB8,3},
+        {0xE6,0x81,0xBF,3}, {0xE5,0x8B,0x87,3}, {0xE7,0x94,0xA8,3}, {0xE5,0xB9,0xBD,3}, {0xE4,0xBC,0x98,3}, {0xE6,0x82,0xA0,3}, {0xE5,0xBF,0xA7,3}, {0xE5,0xB0,0xA4,3},
+        {0xE7,0x94,0xB1,3}, {0xE9,0x82,0xAE,3}, {0xE9,0x93,0x80,3}, {0xE7,0x8A,0xB9,3}, {0xE6,0xB2,0xB9,3}, {0xE6,0xB8,0xB8,3}, {0xE9,0x85,0x89,3}, {0xE6,0x9C,0x89,3},
+        {0xE5,0x8F,0x8B,3}, {0xE5,0x8F,0xB3,3}, {0xE4,0xBD,0x91,3}, {0xE9,0x87,0x89,3}, {0xE8,0xAF,0xB1,3}, {0xE5,0x8F,0x88,3}, {0xE5,0xB9,0xBC,3}, {0xE8,0xBF,0x82,3},
+        {0xE6,0xB7,0xA4,3}, {0xE4,0xBA,0x8E,3}, {0xE7,0x9B,0x82,3}, {0xE6,0xA6,0x86,3}, {0xE8,0x99,0x9E,3}, {0xE6,0x84,0x9A,3}, {0xE8,0x88,0x86,3}, {0xE4,0xBD,0x99,3},
+        {0xE4,0xBF,0x9E,3}, {0xE9,0x80,0xBE,3}, {0xE9,0xB1,0xBC,3}, {0xE6,0x84,0x89,3}, {0xE6,0xB8,0x9D,3}, {0xE6,0xB8,0x94,3}, {0xE9,0x9A,0x85,3}, {0xE4,0xBA,0x88,3},
+        {0xE5,0xA8,0xB1,3}, {0xE9,0x9B,0xA8,3}, {0xE4,0xB8,0x8E,3}, {0xE5,0xB1,0xBF,3}, {0xE7,0xA6,0xB9,3}, {0xE5,0xAE,0x87,3}, {0xE8,0xAF,0xAD,3}, {0xE7,0xBE,0xBD,3},
+        {0xE7,0x8E,0x89,3}, {0xE5,0x9F,0x9F,3}, {0xE8,0x8A,0x8B,3}, {0xE9,0x83,0x81,3}, {0xE5,0x90,0x81,3}, {0xE9,0x81,0x87,3}, {0xE5,0x96,0xBB,3}, {0xE5,0xB3,0xAA,3},
+        {0xE5,0xBE,0xA1,3}, {0xE6,0x84,0x88,3}, {0xE6,0xAC,0xB2,3}, {0xE7,0x8B,0xB1,3}, {0xE8,0x82,0xB2,3}, {0xE8,0xAA,0x89,3},
+    },
+    /* 0xD4 */ {
+        {0xE8,0xA8,0x9E,3}, {0xE8,0xA8,0x9F,3}, {0xE8,0xA8,0xA0,3}, {0xE8,0xA8,0xA1,3}, {0xE8,0xA8,0xA2,3}, {0xE8,0xA8,0xA3,3}, {0xE8,0xA8,0xA4,3}, {0xE8,0xA8,0xA5,3},
+        {0xE8,0xA8,0xA6,3}, {0xE8,0xA8,0xA7,3}, {0xE8,0xA8,0xA8,3}, {0xE8,0xA8,0xA9,3}, {0xE8,0xA8,0xAA,3}, {0xE8,0xA8,0xAB,3}, {0xE8,0xA8,0xAC,3}, {0xE8,0xA8,0xAD,3},
+        {0xE8,0xA8,0xAE,3}, {0xE8,0xA8,0xAF,3}, {0xE8,0xA8,0xB0,3}, {0xE8,0xA8,0xB1,3}, {0xE8,0xA8,0xB2,3}, {0xE8,0xA8,0xB3,3}, {0xE8,0xA8,0xB4,3}, {0xE8,0xA8,0xB5,3},
+        {0xE8,0xA8,0xB6,3}, {0xE8,0xA8,0xB7,3}, {0xE8,0xA8,0xB8,3}, {0xE8,0xA8,0xB9,3}, {0xE8,0xA8,0xBA,3}, {0xE8,0xA8,0xBB,3}, {0xE8,0xA8,0xBC,3}, {0xE8,0xA8,0xBD,3},
+        {0xE8,0xA8,0xBF,3}, {0xE8,0xA9,0x80,3}, {0xE8,0xA9,0x81,3}, {0xE8,0xA9,0x82,3}, {0xE8,0xA9,0x83,3}, {0xE8,0xA9,0x84,3}, {0xE8,0xA9,0x85,3}, {0xE8,0xA9,0x86,3},
+        {0xE8,0xA9,0x87,3}, {0xE8,0xA9,0x89,3}, {0xE8,0xA9,0x8A,3}, {0xE8,0xA9,0x8B,3}, {0xE8,0xA9,0x8C,3}, {0xE8,0xA9,0x8D,3}, {0xE8,0xA9,0x8E,3}, {0xE8,0xA9,0x8F,3},
+        {0xE8,0xA9,0x90,3}, {0xE8,0xA9,0x91,3}, {0xE8,0xA9,0x92,3}, {0xE8,0xA9,0x93,3}, {0xE8,0xA9,0x94,3}, {0xE8,0xA9,0x95,3}, {0xE8,0xA9,0x96,3}, {0xE8,0xA9,0x97,3},
+        {0xE8,0xA9,0x98,3}, {0xE8,0xA9,0x99,3}, {0xE8,0xA9,0x9A,3}, {0xE8,0xA9,0x9B,3}, {0xE8,0xA9,0x9C,3}, {0xE8,0xA9,0x9D,3}, {0xE8,0xA9,0x9E,3}, {0xE8,0xA9,0x9F,3},
+        {0xE8,0xA9,0xA0,3}, {0xE8,0xA9,0xA1,3}, {0xE8,0xA9,0xA2,3}, {0xE8,0xA9,0xA3,3}, {0xE8,0xA9,0xA4,3}, {0xE8,0xA9,0xA5,3}, {0xE8,0xA9,0xA6,3}, {0xE8,0xA9,0xA7,3},
+        {0xE8,0xA9,0xA8,3}, {0xE8,0xA9,0xA9,3}, {0xE8,0xA9,0xAA,3}, {0xE8,0xA9,0xAB,3}, {0xE8,0xA9,0xAC,3}, {0xE8,0xA9,0xAD,3}, {0xE8,0xA9,0xAE,3}, {0xE8,0xA9,0xAF,3},
+        {0xE8,0xA9,0xB0,3}, {0xE8,0xA9,0xB1,3}, {0xE8,0xA9,0xB2,3}, {0xE8,0xA9,0xB3,3}, {0xE8,0xA9,0xB4,3}, {0xE8,0xA9,0xB5,3}, {0xE8,0xA9,0xB6,3}, {0xE8,0xA9,0xB7,3},
+        {0xE8,0xA9,0xB8,3}, {0xE8,0xA9,0xBA,3}, {0xE8,0xA9,0xBB,3}, {0xE8,0xA9,0xBC,3}, {0xE8,0xA9,0xBD,3}, {0xE8,0xA9,0xBE,3}, {0xE8,0xA9,0xBF,3}, {0xE8,0xAA,0x80,3},
+        {0xE6,0xB5,0xB4,3}, {0xE5,0xAF,0x93,3}, {0xE8,0xA3,0x95,3}, {0xE9,0xA2,0x84,3}, {0xE8,0xB1,0xAB,3}, {0xE9,0xA9,0xAD,3}, {0xE9,0xB8,0xB3,3}, {0xE6,0xB8,0x8A,3},
+        {0xE5,0x86,0xA4,3}, {0xE5,0x85,0x83,3}, {0xE5,0x9E,0xA3,3}, {0xE8,0xA2,0x81,3}, {0xE5,0x8E,0x9F,3}, {0xE6,0x8F,0xB4,3}, {0xE8,0xBE,0x95,3}, {0xE5,0x9B,0xAD,3},
+        {0xE5,0x91,0x98,3}, {0xE5,0x9C,0x86,3}, {0xE7,0x8C,0xBF,3}, {0xE6,0xBA,0x90,3}, {0xE7,0xBC,0x98,3}, {0xE8,0xBF,0x9C,3}, {0xE8,0x8B,0x91,3}, {0xE6,0x84,0xBF,3},
+        {0xE6,0x80,0xA8,3}, {0xE9,0x99,0xA2,3}, {0xE6,0x9B,0xB0,3}, {0xE7,0xBA,0xA6,3}, {0xE8,0xB6,0x8A,3}, {0xE8,0xB7,0x83,3}, {0xE9,0x92,0xA5,3}, {0xE5,0xB2,0xB3,3},
+        {0xE7,0xB2,0xA4,3}, {0xE6,0x9C,0x88,3}, {0xE6,0x82,0xA6,3}, {0xE9,0x98,0x85,3}, {0xE8,0x80,0x98,3}, {0xE4,0xBA,0x91,3}, {0xE9,0x83,0xA7,3}, {0xE5,0x8C,0x80,3},
+        {0xE9,0x99,0xA8,3}, {0xE5,0x85,0x81,3}, {0xE8,0xBF,0x90,3}, {0xE8,0x95,0xB4,3}, {0xE9,0x85,0x9D,3}, {0xE6,0x99,0x95,3}, {0xE9,0x9F,0xB5,3}, {0xE5,0xAD,0x95,3},
+        {0xE5,0x8C,0x9D,3}, {0xE7,0xA0,0xB8,3}, {0xE6,0x9D,0x82,3}, {0xE6,0xA0,0xBD,3}, {0xE5,0x93,0x89,3}, {0xE7,0x81,0xBE,3}, {0xE5,0xAE,0xB0,3}, {0xE8,0xBD,0xBD,3},
+        {0xE5,0x86,0x8D,3}, {0xE5,0x9C,0xA8,3}, {0xE5,0x92,0xB1,3}, {0xE6,0x94,0x92,3}, {0xE6,0x9A,0x82,3}, {0xE8,0xB5,0x9E,3}, {0xE8,0xB5,0x83,3}, {0xE8,0x84,0x8F,3},
+        {0xE8,0x91,0xAC,3}, {0xE9,0x81,0xAD,3}, {0xE7,0xB3,0x9F,3}, {0xE5,0x87,0xBF,3}, {0xE8,0x97,0xBB,3}, {0xE6,0x9E,0xA3,3}, {0xE6,0x97,0xA9,3}, {0xE6,0xBE,0xA1,3},
+        {0xE8,0x9A,0xA4,3}, {0xE8,0xBA,0x81,3}, {0xE5,0x99,0xAA,3}, {0xE9,0x80,0xA0,3}, {0xE7,0x9A,0x82,3}, {0xE7,0x81,0xB6,3}, {0xE7,0x87,0xA5,3}, {0xE8,0xB4,0xA3,3},
+        {0xE6,0x8B,0xA9,3}, {0xE5,0x88,0x99,3}, {0xE6,0xB3,0xBD,3}, {0xE8,0xB4,0xBC,3}, {0xE6,0x80,0x8E,3}, {0xE5,0xA2,0x9E,3}, {0xE6,0x86,0x8E,3}, {0xE6,0x9B,0xBE,3},
+        {0xE8,0xB5,0xA0,3}, {0xE6,0x89,0x8E,3}, {0xE5,0x96,0xB3,3}, {0xE6,0xB8,0xA3,3}, {0xE6,0x9C,0xAD,3}, {0xE8,0xBD,0xA7,3},
+    },
+    /* 0xD5 */ {
+        {0xE8,0xAA,0x81,3}, {0xE8,0xAA,0x82,3}, {0xE8,0xAA,0x83,3}, {0xE8,0xAA,0x84,3}, {0xE8,0xAA,0x85,3}, {0xE8,0xAA,0x86,3}, {0xE8,0xAA,0x87,3}, {0xE8,0xAA,0x88,3},
+        {0xE8,0xAA,0x8B,3}, {0xE8,0xAA,0x8C,3}, {0xE8,0xAA,0x8D,3}, {0xE8,0xAA,0x8E,3}, {0xE8,0xAA,0x8F,3}, {0xE8,0xAA,0x90,3}, {0xE8,0xAA,0x91,3}, {0xE8,0xAA,0x92,3},
+        {0xE8,0xAA,0x94,3}, {0xE8,0xAA,0x95,3}, {0xE8,0xAA,0x96,3}, {0xE8,0xAA,0x97,3}, {0xE8,0xAA,0x98,3}, {0xE8,0xAA,0x99,3}, {0xE8,0xAA,0x9A,3}, {0xE8,0xAA,0x9B,3},
+        {0xE8,0xAA,0x9C,3}, {0xE8,0xAA,0x9D,3}, {0xE8,0xAA,0x9E,3}, {0xE8,0xAA,0x9F,3}, {0xE8,0xAA,0xA0,3}, {0xE8,0xAA,0xA1,3}, {0xE8,0xAA,0xA2,3}, {0xE8,0xAA,0xA3,3},
+        {0xE8,0xAA,0xA4,3}, {0xE8,0xAA,0xA5,3}, {0xE8,0xAA,0xA6,3}, {0xE8,0xAA,0xA7,3}, {0xE8,0xAA,0xA8,3}, {0xE8,0xAA,0xA9,3}, {0xE8,0xAA,0xAA,3}, {0xE8,0xAA,0xAB,3},
+        {0xE8,0xAA,0xAC,3}, {0xE8,0xAA,0xAD,3}, {0xE8,0xAA,0xAE,3}, {0xE8,0xAA,0xAF,3}, {0xE8,0xAA,0xB0,3}, {0xE8,0xAA,0xB1,3}, {0xE8,0xAA,0xB2,3}, {0xE8,0xAA,0xB3,3},
+        {0xE8,0xAA,0xB4,3}, {0xE8,0xAA,0xB5,3}, {0xE8,0xAA,0xB6,3}, {0xE8,0xAA,0xB7,3}, {0xE8,0xAA,0xB8,3}, {0xE8,0xAA,0xB9,3}, {0xE8,0xAA,0xBA,3}, {0xE8,0xAA,0xBB,3},
+        {0xE8,0xAA,0xBC,3}, {0xE8,0xAA,0xBD,3}, {0xE8,0xAA,0xBE,3}, {0xE8,0xAA,0xBF,3}, {0xE8,0xAB,0x80,3}, {0xE8,0xAB,0x81,3}, {0xE8,0xAB,0x82,3}, {0xE8,0xAB,0x83,3},
+        {0xE8,0xAB,0x84,3}, {0xE8,0xAB,0x85,3}, {0xE8,0xAB,0x86,3}, {0xE8,0xAB,0x87,3}, {0xE8,0xAB,0x88,3}, {0xE8,0xAB,0x89,3}, {0xE8,0xAB,0x8A,3}, {0xE8,0xAB,0x8B,3},
+        {0xE8,0xAB,0x8C,3}, {0xE8,0xAB,0x8D,3}, {0xE8,0xAB,0x8E,3}, {0xE8,0xAB,0x8F,3}, {0xE8,0xAB,0x90,3}, {0xE8,0xAB,0x91,3}, {0xE8,0xAB,0x92,3}, {0xE8,0xAB,0x93,3},
+        {0xE8,0xAB,0x94,3}, {0xE8,0xAB,0x95,3}, {0xE8,0xAB,0x96,3}, {0xE8,0xAB,0x97,3}, {0xE8,0xAB,0x98,3}, {0xE8,0xAB,0x99,3}, {0xE8,0xAB,0x9A,3}, {0xE8,0xAB,0x9B,3},
+        {0xE8,0xAB,0x9C,3}, {0xE8,0xAB,0x9D,3}, {0xE8,0xAB,0x9E,3}, {0xE8,0xAB,0x9F,3}, {0xE8,0xAB,0xA0,3}, {0xE8,0xAB,0xA1,3}, {0xE8,0xAB,0xA2,3}, {0xE8,0xAB,0xA3,3},
+        {0xE9,0x93,0xA1,3}, {0xE9,0x97,0xB8,3}, {0xE7,0x9C,0xA8,3}, {0xE6,0xA0,0x85,3}, {0xE6,0xA6,0xA8,3}, {0xE5,0x92,0x8B,3}, {0xE4,0xB9,0x8D,3}, {0xE7,0x82,0xB8,3},
+        {0xE8,0xAF,0x88,3}, {0xE6,0x91,0x98,3}, {0xE6,0x96,0x8B,3}, {0xE5,0xAE,0x85,3}, {0xE7,0xAA,0x84,3}, {0xE5,0x80,0xBA,3}, {0xE5,0xAF,0xA8,3}, {0xE7,0x9E,0xBB,3},
+        {0xE6,0xAF,0xA1,3}, {0xE8,0xA9,0xB9,3}, {0xE7,0xB2,0x98,3}, {0xE6,0xB2,0xBE,3}, {0xE7,0x9B,0x8F,3}, {0xE6,0x96,0xA9,3}, {0xE8,0xBE,0x97,3}, {0xE5,0xB4,0xAD,3},
+        {0xE5,0xB1,0x95,3}, {0xE8,0x98,0xB8,3}, {0xE6,0xA0,0x88,3}, {0xE5,0x8D,0xA0,3}, {0xE6,0x88,0x98,3}, {0xE7,0xAB,0x99,3}, {0xE6,0xB9,0x9B,3}, {0xE7,0xBB,0xBD,3},
+        {0xE6,0xA8,0x9F,3}, {0xE7,0xAB,0xA0,3}, {0xE5,0xBD,0xB0,3}, {0xE6,0xBC,0xB3,3}, {0xE5,0xBC,0xA0,3}, {0xE6,0x8E,0x8C,3}, {0xE6,0xB6,0xA8,3}, {0xE6,0x9D,0x96,3},
+        {0xE4,0xB8,0x88,3}, {0xE5,0xB8,0x90,3}, {0xE8,0xB4,0xA6,3}, {0xE4,0xBB,0x97,3}, {0xE8,0x83,0x80,3}, {0xE7,0x98,0xB4,3}, {0xE9,0x9A,0x9C,3}, {0xE6,0x8B,0x9B,3},
+        {0xE6,0x98,0xAD,3}, {0xE6,0x89,0xBE,3}, {0xE6,0xB2,0xBC,3}, {0xE8,0xB5,0xB5,3}, {0xE7,0x85,0xA7,3}, {0xE7,0xBD,0xA9,3}, {0xE5,0x85,0x86,3}, {0xE8,0x82,0x87,3},
+        {0xE5,0x8F,0xAC,3}, {0xE9,0x81,0xAE,3}, {0xE6,0x8A,0x98,3}, {0xE5,0x93,0xB2,3}, {0xE8,0x9B,0xB0,3}, {0xE8,0xBE,0x99,3}, {0xE8,0x80,0x85,3}, {0xE9,0x94,0x97,3},
+        {0xE8,0x94,0x97,3}, {0xE8,0xBF,0x99,3}, {0xE6,0xB5,0x99,3}, {0xE7,0x8F,0x8D,3}, {0xE6,0x96,0x9F,3}, {0xE7,0x9C,0x9F,3}, {0xE7,0x94,0x84,3}, {0xE7,0xA0,0xA7,3},
+        {0xE8,0x87,0xBB,3}, {0xE8,0xB4,0x9E,3}, {0xE9,0x92,0x88,3}, {0xE4,0xBE,0xA6,3}, {0xE6,0x9E,0x95,3}, {0xE7,0x96,0xB9,3}, {0xE8,0xAF,0x8A,3}, {0xE9,0x9C,0x87,3},
+        {0xE6,0x8C,0xAF,3}, {0xE9,0x95,0x87,3}, {0xE9,0x98,0xB5,3}, {0xE8,0x92,0xB8,3}, {0xE6,0x8C,0xA3,3}, {0xE7,0x9D,0x81,3}, {0xE5,0xBE,0x81,3}, {0xE7,0x8B,0xB0,3},
+        {0xE4,0xBA,0x89,3}, {0xE6,0x80,0x94,3}, {0xE6,0x95,0xB4,3}, {0xE6,0x8B,0xAF,3}, {0xE6,0xAD,0xA3,3}, {0xE6,0x94,0xBF,3},
+    },
+    /* 0xD6 */ {
+        {0xE8,0xAB,0xA4,3}, {0xE8,0xAB,0xA5,3}, {0xE8,0xAB,0xA6,3}, {0xE8,0xAB,0xA7,3}, {0xE8,0xAB,0xA8,3}, {0xE8,0xAB,0xA9,3}, {0xE8,0xAB,0xAA,3}, {0xE8,0xAB,0xAB,3},
+        {0xE8,0xAB,0xAC,3}, {0xE8,0xAB,0xAD,3}, {0xE8,0xAB,0xAE,3}, {0xE8,0xAB,0xAF,3}, {0xE8,0xAB,0xB0,3}, {0xE8,0xAB,0xB1,3}, {0xE8,0xAB,0xB2,3}, {0xE8,0xAB,0xB3,3},
+        {0xE8,0xAB,0xB4,3}, {0xE8,0xAB,0xB5,3}, {0xE8,0xAB,0xB6,3}, {0xE8,0xAB,0xB7,3}, {0xE8,0xAB,0xB8,3}, {0xE8,0xAB,0xB9,3}, {0xE8,0xAB,0xBA,3}, {0xE8,0xAB,0xBB,3},
+        {0xE8,0xAB,0xBC,3}, {0xE8,0xAB,0xBD,3}, {0xE8,0xAB,0xBE,3}, {0xE8,0xAB,0xBF,3}, {0xE8,0xAC,0x80,3}, {0xE8,0xAC,0x81,3}, {0xE8,0xAC,0x82,3}, {0xE8,0xAC,0x83,3},
+        {0xE8,0xAC,0x84,3}, {0xE8,0xAC,0x85,3}, {0xE8,0xAC,0x86,3}, {0xE8,0xAC,0x88,3}, {0xE8,0xAC,0x89,3}, {0xE8,0xAC,0x8A,3}, {0xE8,0xAC,0x8B,3}, {0xE8,0xAC,0x8C,3},
+        {0xE8,0xAC,0x8D,3}, {0xE8,0xAC,0x8E,3}, {0xE8,0xAC,0x8F,3}, {0xE8,0xAC,0x90,3}, {0xE8,0xAC,0x91,3}, {0xE8,0xAC,0x92,3}, {0xE8,0xAC,0x93,3}, {0xE8,0xAC,0x94,3},
+        {0xE8,0xAC,0x95,3}, {0xE8,0xAC,0x96,3}, {0xE8,0xAC,0x97,3}, {0xE8,0xAC,0x98,3}, {0xE8,0xAC,0x99,3}, {0xE8,0xAC,0x9A,3}, {0xE8,0xAC,0x9B,3}, {0xE8,0xAC,0x9C,3},
+        {0xE8,0xAC,0x9D,3}, {0xE8,0xAC,0x9E,3}, {0xE8,0xAC,0x9F,3}, {0xE8,0xAC,0xA0,3}, {0xE8,0xAC,0xA1,3}, {0xE8,0xAC,0xA2,3}, {0xE8,0xAC,0xA3,3}, {0xE8,0xAC,0xA4,3},
+        {0xE8,0xAC,0xA5,3}, {0xE8,0xAC,0xA7,3}, {0xE8,0xAC,0xA8,3}, {0xE8,0xAC,0xA9,3}, {0xE8,0xAC,0xAA,3}, {0xE8,0xAC,0xAB,3}, {0xE8,0xAC,0xAC,3}, {0xE8,0xAC,0xAD,3},
+        {0xE8,0xAC,0xAE,3}, {0xE8,0xAC,0xAF,3}, {0xE8,0xAC,0xB0,3}, {0xE8,0xAC,0xB1,3}, {0xE8,0xAC,0xB2,3}, {0xE8,0xAC,0xB3,3}, {0xE8,0xAC,0xB4,3}, {0xE8,0xAC,0xB5,3},
+        {0xE8,0xAC,0xB6,3}, {0xE8,0xAC,0xB7,3}, {0xE8,0xAC,0xB8,3}, {0xE8,0xAC,0xB9,3}, {0xE8,0xAC,0xBA,3}, {0xE8,0xAC,0xBB,3}, {0xE8,0xAC,0xBC,3}, {0xE8,0xAC,0xBD,3},
+        {0xE8,0xAC,0xBE,3}, {0xE8,0xAC,0xBF,3}, {0xE8,0xAD,0x80,3}, {0xE8,0xAD,0x81,3}, {0xE8,0xAD,0x82,3}, {0xE8,0xAD,0x83,3}, {0xE8,0xAD,0x84,3}, {0xE8,0xAD,0x85,3},
+        {0xE5,0xB8,0xA7,3}, {0xE7,0x97,0x87,3}, {0xE9,0x83,0x91,3}, {0xE8,0xAF,0x81,3}, {0xE8,0x8A,0x9D,3}, {0xE6,0x9E,0x9D,3}, {0xE6,0x94,0xAF,3}, {0xE5,0x90,0xB1,3},
+        {0xE8,0x9C,0x98,3}, {0xE7,0x9F,0xA5,3}, {0xE8,0x82,0xA2,3}, {0xE8,0x84,0x82,3}, {0xE6,0xB1,0x81,3}, {0xE4,0xB9,0x8B,3}, {0xE7,0xBB,0x87,3}, {0xE8,0x81,0x8C,3},
+        {0xE7,0x9B,0xB4,3}, {0xE6,0xA4,0x8D,3}, {0xE6,0xAE,0x96,3}, {0xE6,0x89,0xA7,3}, {0xE5,0x80,0xBC,3}, {0xE4,0xBE,0x84,3}, {0xE5,0x9D,0x80,3}, {0xE6,0x8C,0x87,3},
+        {0xE6,0xAD,0xA2,3}, {0xE8,0xB6,0xBE,3}, {0xE5,0x8F,0xAA,3}, {0xE6,0x97,0xA8,3}, {0xE7,0xBA,0xB8,3}, {0xE5,0xBF,0x97,3}, {0xE6,0x8C,0x9A,3}, {0xE6,0x8E,0xB7,3},
+        {0xE8,0x87,0xB3,3}, {0xE8,0x87,0xB4,3}, {0xE7,0xBD,0xAE,3}, {0xE5,0xB8,0x9C,3}, {0xE5,0xB3,0x99,3}, {0xE5,0x88,0xB6,3}, {0xE6,0x99,0xBA,3}, {0xE7,0xA7,0xA9,3},
+        {0xE7,0xA8,0x9A,3}, {0xE8,0xB4,0xA8,3}, {0xE7,0x82,0x99,3}, {0xE7,0x97,0x94,3}, {0xE6,0xBB,0x9E,3}, {0xE6,0xB2,0xBB,3}, {0xE7,0xAA,0x92,3}, {0xE4,0xB8,0xAD,3},
+        {0xE7,0x9B,0x85,3}, {0xE5,0xBF,0xA0,3}, {0xE9,0x92,0x9F,3}, {0xE8,0xA1,0xB7,3}, {0xE7,0xBB,0x88,3}, {0xE7,0xA7,0x8D,3}, {0xE8,0x82,0xBF,3}, {0xE9,0x87,0x8D,3},
+        {0xE4,0xBB,0xB2,3}, {0xE4,0xBC,0x97,3}, {0xE8,0x88,0x9F,3}, {0xE5,0x91,0xA8,3}, {0xE5,0xB7,0x9E,3}, {0xE6,0xB4,0xB2,3}, {0xE8,0xAF,0x8C,3}, {0xE7,0xB2,0xA5,3},
+        {0xE8,0xBD,0xB4,3}, {0xE8,0x82,0x98,3}, {0xE5,0xB8,0x9A,3}, {0xE5,0x92,0x92,3}, {0xE7,0x9A,0xB1,3}, {0xE5,0xAE,0x99,3}, {0xE6,0x98,0xBC,3}, {0xE9,0xAA,0xA4,3},
+        {0xE7,0x8F,0xA0,3}, {0xE6,0xA0,0xAA,3}, {0xE8,0x9B,0x9B,3}, {0xE6,0x9C,0xB1,3}, {0xE7,0x8C,0xAA,3}, {0xE8,0xAF,0xB8,3}, {0xE8,0xAF,0x9B,3}, {0xE9,0x80,0x90,3},
+        {0xE7,0xAB,0xB9,3}, {0xE7,0x83,0x9B,3}, {0xE7,0x85,0xAE,3}, {0xE6,0x8B,0x84,3}, {0xE7,0x9E,0xA9,3}, {0xE5,0x98,0xB1,3}, {0xE4,0xB8,0xBB,3}, {0xE8,0x91,0x97,3},
+        {0xE6,0x9F,0xB1,3}, {0xE5,0x8A,0xA9,3}, {0xE8,0x9B,0x80,3}, {0xE8,0xB4,0xAE,3}, {0xE9,0x93,0xB8,3}, {0xE7,0xAD,0x91,3},
+    },
+    /* 0xD7 */ {
+        {0xE8,0xAD,0x86,3}, {0xE8,0xAD,0x87,3}, {0xE8,0xAD,0x88,3}, {0xE8,0xAD,0x89,3}, {0xE8,0xAD,0x8A,3}, {0xE8,0xAD,0x8B,3}, {0xE8,0xAD,0x8C,3}, {0xE8,0xAD,0x8D,3},
+        {0xE8,0xAD,0x8E,3}, {0xE8,0xAD,0x8F,3}, {0xE8,0xAD,0x90,3}, {0xE8,0xAD,0x91,3}, {0xE8,0xAD,0x92,3}, {0xE8,0xAD,0x93,3}, {0xE8,0xAD,0x94,3}, {0xE8,0xAD,0x95,3},
+        {0xE8,0xAD,0x96,3}, {0xE8,0xAD,0x97,3}, {0xE8,0xAD,0x98,3}, {0xE8,0xAD,0x99,3}, {0xE8,0xAD,0x9A,3}, {0xE8,0xAD,0x9B,3}, {0xE8,0xAD,0x9C,3}, {0xE8,0xAD,0x9D,3},
+        {0xE8,0xAD,0x9E,3}, {0xE8,0xAD,0x9F,3}, {0xE8,0xAD,0xA0,3}, {0xE8,0xAD,0xA1,3}, {0xE8,0xAD,0xA2,3}, {0xE8,0xAD,0xA3,3}, {0xE8,0xAD,0xA4,3}, {0xE8,0xAD,0xA5,3},
+        {0xE8,0xAD,0xA7,3}, {0xE8,0xAD,0xA8,3}, {0xE8,0xAD,0xA9,3}, {0xE8,0xAD,0xAA,3}, {0xE8,0xAD,0xAB,3}, {0xE8,0xAD,0xAD,3}, {0xE8,0xAD,0xAE,3}, {0xE8,0xAD,0xAF,3},
+        {0xE8,0xAD,0xB0,3}, {0xE8,0xAD,0xB1,3}, {0xE8,0xAD,0xB2,3}, {0xE8,0xAD,0xB3,3}, {0xE8,0xAD,0xB4,3}, {0xE8,0xAD,0xB5,3}, {0xE8,0xAD,0xB6,3}, {0xE8,0xAD,0xB7,3},
+        {0xE8,0xAD,0xB8,3}, {0xE8,0xAD,0xB9,3}, {0xE8,0xAD,0xBA,3}, {0xE8,0xAD,0xBB,3}, {0xE8,0xAD,0xBC,3}, {0xE8,0xAD,0xBD,3}, {0xE8,0xAD,0xBE,3}, {0xE8,0xAD,0xBF,3},
+        {0xE8,0xAE,0x80,3}, {0xE8,0xAE,0x81,3}, {0xE8,0xAE,0x82,3}, {0xE8,0xAE,0x83,3}, {0xE8,0xAE,0x84,3}, {0xE8,0xAE,0x85,3}, {0xE8,0xAE,0x86,3}, {0xE8,0xAE,0x87,3},
+        {0xE8,0xAE,0x88,3}, {0xE8,0xAE,0x89,3}, {0xE8,0xAE,0x8A,3}, {0xE8,0xAE,0x8B,3}, {0xE8,0xAE,0x8C,3}, {0xE8,0xAE,0x8D,3}, {0xE8,0xAE,0x8E,3}, {0xE8,0xAE,0x8F,3},
+        {0xE8,0xAE,0x90,3}, {0xE8,0xAE,0x91,3}, {0xE8,0xAE,0x92,3}, {0xE8,0xAE,0x93,3}, {0xE8,0xAE,0x94,3}, {0xE8,0xAE,0x95,3}, {0xE8,0xAE,0x96,3}, {0xE8,0xAE,0x97,3},
+        {0xE8,0xAE,0x98,3}, {0xE8,0xAE,0x99,3}, {0xE8,0xAE,0x9A,3}, {0xE8,0xAE,0x9B,3}, {0xE8,0xAE,0x9C,3}, {0xE8,0xAE,0x9D,3}, {0xE8,0xAE,0x9E,3}, {0xE8,0xAE,0x9F,3},
+        {0xE8,0xAE,0xAC,3}, {0xE8,0xAE,0xB1,3}, {0xE8,0xAE,0xBB,3}, {0xE8,0xAF,0x87,3}, {0xE8,0xAF,0x90,3}, {0xE8,0xAF,0xAA,3}, {0xE8,0xB0,0x89,3}, {0xE8,0xB0,0x9E,3},
+        {0xE4,0xBD,0x8F,3}, {0xE6,0xB3,0xA8,3}, {0xE7,0xA5,0x9D,3}, {0xE9,0xA9,0xBB,3}, {0xE6,0x8A,0x93,3}, {0xE7,0x88,0xAA,3}, {0xE6,0x8B,0xBD,3}, {0xE4,0xB8,0x93,3},
+        {0xE7,0xA0,0x96,3}, {0xE8,0xBD,0xAC,3}, {0xE6,0x92,0xB0,3}, {0xE8,0xB5,0x9A,3}, {0xE7,0xAF,0x86,3}, {0xE6,0xA1,0xA9,3}, {0xE5,0xBA,0x84,3}, {0xE8,0xA3,0x85,3},
+        {0xE5,0xA6,0x86,3}, {0xE6,0x92,0x9E,3}, {0xE5,0xA3,0xAE,3}, {0xE7,0x8A,0xB6,3}, {0xE6,0xA4,0x8E,3}, {0xE9,0x94,0xA5,3}, {0xE8,0xBF,0xBD,3}, {0xE8,0xB5,0x98,3},
+        {0xE5,0x9D,0xA0,3}, {0xE7,0xBC,0x80,3}, {0xE8,0xB0,0x86,3}, {0xE5,0x87,0x86,3}, {0xE6,0x8D,0x89,3}, {0xE6,0x8B,0x99,3}, {0xE5,0x8D,0x93,3}, {0xE6,0xA1,0x8C,3},
+        {0xE7,0x90,0xA2,3}, {0xE8,0x8C,0x81,3}, {0xE9,0x85,0x8C,3}, {0xE5,0x95,0x84,3}, {0xE7,0x9D,0x80,3}, {0xE7,0x81,0xBC,3}, {0xE6,0xB5,0x8A,3}, {0xE5,0x85,0xB9,3},
+        {0xE5,0x92,0xA8,3}, {0xE8,0xB5,0x84,3}, {0xE5,0xA7,0xBF,3}, {0xE6,0xBB,0x8B,3}, {0xE6,0xB7,0x84,3}, {0xE5,0xAD,0x9C,3}, {0xE7,0xB4,0xAB,3}, {0xE4,0xBB,0x94,3},
+        {0xE7,0xB1,0xBD,3}, {0xE6,0xBB,0x93,3}, {0xE5,0xAD,0x90,3}, {0xE8,0x87,0xAA,3}, {0xE6,0xB8,0x8D,3}, {0xE5,0xAD,0x97,3}, {0xE9,0xAC,0x83,3}, {0xE6,0xA3,0x95,3},
+        {0xE8,0xB8,0xAA,3}, {0xE5,0xAE,0x97,3}, {0xE7,0xBB,0xBC,3}, {0xE6,0x80,0xBB,3}, {0xE7,0xBA,0xB5,3}, {0xE9,0x82,0xB9,3}, {0xE8,0xB5,0xB0,3}, {0xE5,0xA5,0x8F,3},
+        {0xE6,0x8F,0x8D,3}, {0xE7,0xA7,0x9F,3}, {0xE8,0xB6,0xB3,3}, {0xE5,0x8D,0x92,3}, {0xE6,0x97,0x8F,3}, {0xE7,0xA5,0x96,3}, {0xE8,0xAF,0x85,3}, {0xE9,0x98,0xBB,3},
+        {0xE7,0xBB,0x84,3}, {0xE9,0x92,0xBB,3}, {0xE7,0xBA,0x82,3}, {0xE5,0x98,0xB4,3}, {0xE9,0x86,0x89,3}, {0xE6,0x9C,0x80,3}, {0xE7,0xBD,0xAA,3}, {0xE5,0xB0,0x8A,3},
+        {0xE9,0x81,0xB5,3}, {0xE6,0x98,0xA8,3}, {0xE5,0xB7,0xA6,3}, {0xE4,0xBD,0x90,3}, {0xE6,0x9F,0x9E,3}, {0xE5,0x81,0x9A,3}, {0xE4,0xBD,0x9C,3}, {0xE5,0x9D,0x90,3},
+        {0xE5,0xBA,0xA7,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xD8 */ {
+        {0xE8,0xB0,0xB8,3}, {0xE8,0xB0,0xB9,3}, {0xE8,0xB0,0xBA,3}, {0xE8,0xB0,0xBB,3}, {0xE8,0xB0,0xBC,3}, {0xE8,0xB0,0xBD,3}, {0xE8,0xB0,0xBE,3}, {0xE8,0xB0,0xBF,3},
+        {0xE8,0xB1,0x80,3}, {0xE8,0xB1,0x82,3}, {0xE8,0xB1,0x83,3}, {0xE8,0xB1,0x84,3}, {0xE8,0xB1,0x85,3}, {0xE8,0xB1,0x88,3}, {0xE8,0xB1,0x8A,3}, {0xE8,0xB1,0x8B,3},
+        {0xE8,0xB1,0x8D,3}, {0xE8,0xB1,0x8E,3}, {0xE8,0xB1,0x8F,3}, {0xE8,0xB1,0x90,3}, {0xE8,0xB1,0x91,3}, {0xE8,0xB1,0x92,3}, {0xE8,0xB1,0x93,3}, {0xE8,0xB1,0x94,3},
+        {0xE8,0xB1,0x96,3}, {0xE8,0xB1,0x97,3}, {0xE8,0xB1,0x98,3}, {0xE8,0xB1,0x99,3}, {0xE8,0xB1,0x9B,3}, {0xE8,0xB1,0x9C,3}, {0xE8,0xB1,0x9D,3}, {0xE8,0xB1,0x9E,3},
+        {0xE8,0xB1,0x9F,3}, {0xE8,0xB1,0xA0,3}, {0xE8,0xB1,0xA3,3}, {0xE8,0xB1,0xA4,3}, {0xE8,0xB1,0xA5,3}, {0xE8,0xB1,0xA6,3}, {0xE8,0xB1,0xA7,3}, {0xE8,0xB1,0xA8,3},
+        {0xE8,0xB1,0xA9,3}, {0xE8,0xB1,0xAC,3}, {0xE8,0xB1,0xAD,3}, {0xE8,0xB1,0xAE,3}, {0xE8,0xB1,0xAF,3}, {0xE8,0xB1,0xB0,3}, {0xE8,0xB1,0xB1,3}, {0xE8,0xB1,0xB2,3},
+        {0xE8,0xB1,0xB4,3}, {0xE8,0xB1,0xB5,3}, {0xE8,0xB1,0xB6,3}, {0xE8,0xB1,0xB7,3}, {0xE8,0xB1,0xBB,3}, {0xE8,0xB1,0xBC,3}, {0xE8,0xB1,0xBD,3}, {0xE8,0xB1,0xBE,3},
+        {0xE8,0xB1,0xBF,3}, {0xE8,0xB2,0x80,3}, {0xE8,0xB2,0x81,3}, {0xE8,0xB2,0x83,3}, {0xE8,0xB2,0x84,3}, {0xE8,0xB2,0x86,3}, {0xE8,0xB2,0x87,3}, {0xE8,0xB2,0x88,3},
+        {0xE8,0xB2,0x8B,3}, {0xE8,0xB2,0x8D,3}, {0xE8,0xB2,0x8E,3}, {0xE8,0xB2,0x8F,3}, {0xE8,0xB2,0x90,3}, {0xE8,0xB2,0x91,3}, {0xE8,0xB2,0x92,3}, {0xE8,0xB2,0x93,3},
+        {0xE8,0xB2,0x95,3}, {0xE8,0xB2,0x96,3}, {0xE8,0xB2,0x97,3}, {0xE8,0xB2,0x99,3}, {0xE8,0xB2,0x9A,3}, {0xE8,0xB2,0x9B,3}, {0xE8,0xB2,0x9C,3}, {0xE8,0xB2,0x9D,3},
+        {0xE8,0xB2,0x9E,3}, {0xE8,0xB2,0x9F,3}, {0xE8,0xB2,0xA0,3}, {0xE8,0xB2,0xA1,3}, {0xE8,0xB2,0xA2,3}, {0xE8,0xB2,0xA3,3}, {0xE8,0xB2,0xA4,3}, {0xE8,0xB2,0xA5,3},
+        {0xE8,0xB2,0xA6,3}, {0xE8,0xB2,0xA7,3}, {0xE8,0xB2,0xA8,3}, {0xE8,0xB2,0xA9,3}, {0xE8,0xB2,0xAA,3}, {0xE8,0xB2,0xAB,3}, {0xE8,0xB2,0xAC,3}, {0xE8,0xB2,0xAD,3},
+        {0xE4,0xBA,0x8D,3}, {0xE4,0xB8,0x8C,3}, {0xE5,0x85,0x80,3}, {0xE4,0xB8,0x90,3}, {0xE5,0xBB,0xBF,3}, {0xE5,0x8D,0x85,3}, {0xE4,0xB8,0x95,3}, {0xE4,0xBA,0x98,3},
+        {0xE4,0xB8,0x9E,3}, {0xE9,0xAC,0xB2,3}, {0xE5,0xAD,0xAC,3}, {0xE5,0x99,0xA9,3}, {0xE4,0xB8,0xA8,3}, {0xE7,0xA6,0xBA,3}, {0xE4,0xB8,0xBF,3}, {0xE5,0x8C,0x95,3},
+        {0xE4,0xB9,0x87,3}, {0xE5,0xA4,0xAD,3}, {0xE7,0x88,0xBB,3}, {0xE5,0x8D,0xAE,3}, {0xE6,0xB0,0x90,3}, {0xE5,0x9B,0x9F,3}, {0xE8,0x83,0xA4,3}, {0xE9,0xA6,0x97,3},
+        {0xE6,0xAF,0x93,3}, {0xE7,0x9D,0xBE,3}, {0xE9,0xBC,0x97,3}, {0xE4,0xB8,0xB6,3}, {0xE4,0xBA,0x9F,3}, {0xE9,0xBC,0x90,3}, {0xE4,0xB9,0x9C,3}, {0xE4,0xB9,0xA9,3},
+        {0xE4,0xBA,0x93,3}, {0xE8,0x8A,0x88,3}, {0xE5,0xAD,0x9B,3}, {0xE5,0x95,0xAC,3}, {0xE5,0x98,0x8F,3}, {0xE4,0xBB,0x84,3}, {0xE5,0x8E,0x8D,3}, {0xE5,0x8E,0x9D,3},
+        {0xE5,0x8E,0xA3,3}, {0xE5,0x8E,0xA5,3}, {0xE5,0x8E,0xAE,3}, {0xE9,0x9D,0xA5,3}, {0xE8,0xB5,0x9D,3}, {0xE5,0x8C,0x9A,3}, {0xE5,0x8F,0xB5,3}, {0xE5,0x8C,0xA6,3},
+        {0xE5,0x8C,0xAE,3}, {0xE5,0x8C,0xBE,3}, {0xE8,0xB5,0x9C,3}, {0xE5,0x8D,0xA6,3}, {0xE5,0x8D,0xA3,3}, {0xE5,0x88,0x82,3}, {0xE5,0x88,0x88,3}, {0xE5,0x88,0x8E,3},
+        {0xE5,0x88,0xAD,3}, {0xE5,0x88,0xB3,3}, {0xE5,0x88,0xBF,3}, {0xE5,0x89,0x80,3}, {0xE5,0x89,0x8C,3}, {0xE5,0x89,0x9E,3}, {0xE5,0x89,0xA1,3}, {0xE5,0x89,0x9C,3},
+        {0xE8,0x92,0xAF,3}, {0xE5,0x89,0xBD,3}, {0xE5,0x8A,0x82,3}, {0xE5,0x8A,0x81,3}, {0xE5,0x8A,0x90,3}, {0xE5,0x8A,0x93,3}, {0xE5,0x86,0x82,3}, {0xE7,0xBD,0x94,3},
+        {0xE4,0xBA,0xBB,3}, {0xE4,0xBB,0x83,3}, {0xE4,0xBB,0x89,3}, {0xE4,0xBB,0x82,3}, {0xE4,0xBB,0xA8,3}, {0xE4,0xBB,0xA1,3}, {0xE4,0xBB,0xAB,3}, {0xE4,0xBB,0x9E,3},
+        {0xE4,0xBC,0x9B,3}, {0xE4,0xBB,0xB3,3}, {0xE4,0xBC,0xA2,3}, {0xE4,0xBD,0xA4,3}, {0xE4,0xBB,0xB5,3}, {0xE4,0xBC,0xA5,3}, {0xE4,0xBC,0xA7,3}, {0xE4,0xBC,0x89,3},
+        {0xE4,0xBC,0xAB,3}, {0xE4,0xBD,0x9E,3}, {0xE4,0xBD,0xA7,3}, {0xE6,0x94,0xB8,3}, {0xE4,0xBD,0x9A,3}, {0xE4,0xBD,0x9D,3},
+    },
+    /* 0xD9 */ {
+        {0xE8,0xB2,0xAE,3}, {0xE8,0xB2,0xAF,3}, {0xE8,0xB2,0xB0,3}, {0xE8,0xB2,0xB1,3}, {0xE8,0xB2,0xB2,3}, {0xE8,0xB2,0xB3,3}, {0xE8,0xB2,0xB4,3}, {0xE8,0xB2,0xB5,3},
+        {0xE8,0xB2,0xB6,3}, {0xE8,0xB2,0xB7,3}, {0xE8,0xB2,0xB8,3}, {0xE8,0xB2,0xB9,3}, {0xE8,0xB2,0xBA,3}, {0xE8,0xB2,0xBB,3}, {0xE8,0xB2,0xBC,3}, {0xE8,0xB2,0xBD,3},
+        {0xE8,0xB2,0xBE,3}, {0xE8,0xB2,0xBF,3}, {0xE8,0xB3,0x80,3}, {0xE8,0xB3,0x81,3}, {0xE8,0xB3,0x82,3}, {0xE8,0xB3,0x83,3}, {0xE8,0xB3,0x84,3}, {0xE8,0xB3,0x85,3},
+        {0xE8,0xB3,0x86,3}, {0xE8,0xB3,0x87,3}, {0xE8,0xB3,0x88,3}, {0xE8,0xB3,0x89,3}, {0xE8,0xB3,0x8A,3}, {0xE8,0xB3,0x8B,3}, {0xE8,0xB3,0x8C,3}, {0xE8,0xB3,0x8D,3},
+        {0xE8,0xB3,0x8E,3}, {0xE8,0xB3,0x8F,3}, {0xE8,0xB3,0x90,3}, {0xE8,0xB3,0x91,3}, {0xE8,0xB3,0x92,3}, {0xE8,0xB3,0x93,3}, {0xE8,0xB3,0x94,3}, {0xE8,0xB3,0x95,3},
+        {0xE8,0xB3,0x96,3}, {0xE8,0xB3,0x97,3}, {0xE8,0xB3,0x98,3}, {0xE8,0xB3,0x99,3}, {0xE8,0xB3,0x9A,3}, {0xE8,0xB3,0x9B,3}, {0xE8,0xB3,0x9C,3}, {0xE8,0xB3,0x9D,3},
+        {0xE8,0xB3,0x9E,3}, {0xE8,0xB3,0x9F,3}, {0xE8,0xB3,0xA0,3}, {0xE8,0xB3,0xA1,3}, {0xE8,0xB3,0xA2,3}, {0xE8,0xB3,0xA3,3}, {0xE8,0xB3,0xA4,3}, {0xE8,0xB3,0xA5,3},
+        {0xE8,0xB3,0xA6,3}, {0xE8,0xB3,0xA7,3}, {0xE8,0xB3,0xA8,3}, {0xE8,0xB3,0xA9,3}, {0xE8,0xB3,0xAA,3}, {0xE8,0xB3,0xAB,3}, {0xE8,0xB3,0xAC,3}, {0xE8,0xB3,0xAD,3},
+        {0xE8,0xB3,0xAE,3}, {0xE8,0xB3,0xAF,3}, {0xE8,0xB3,0xB0,3}, {0xE8,0xB3,0xB1,3}, {0xE8,0xB3,0xB2,3}, {0xE8,0xB3,0xB3,3}, {0xE8,0xB3,0xB4,3}, {0xE8,0xB3,0xB5,3},
+        {0xE8,0xB3,0xB6,3}, {0xE8,0xB3,0xB7,3}, {0xE8,0xB3,0xB8,3}, {0xE8,0xB3,0xB9,3}, {0xE8,0xB3,0xBA,3}, {0xE8,0xB3,0xBB,3}, {0xE8,0xB3,0xBC,3}, {0xE8,0xB3,0xBD,3},
+        {0xE8,0xB3,0xBE,3}, {0xE8,0xB3,0xBF,3}, {0xE8,0xB4,0x80,3}, {0xE8,0xB4,0x81,3}, {0xE8,0xB4,0x82,3}, {0xE8,0xB4,0x83,3}, {0xE8,0xB4,0x84,3}, {0xE8,0xB4,0x85,3},
+        {0xE8,0xB4,0x86,3}, {0xE8,0xB4,0x87,3}, {0xE8,0xB4,0x88,3}, {0xE8,0xB4,0x89,3}, {0xE8,0xB4,0x8A,3}, {0xE8,0xB4,0x8B,3}, {0xE8,0xB4,0x8C,3}, {0xE8,0xB4,0x8D,3},
+        {0xE4,0xBD,0x9F,3}, {0xE4,0xBD,0x97,3}, {0xE4,0xBC,0xB2,3}, {0xE4,0xBC,0xBD,3}, {0xE4,0xBD,0xB6,3}, {0xE4,0xBD,0xB4,3}, {0xE4,0xBE,0x91,3}, {0xE4,0xBE,0x89,3},
+        {0xE4,0xBE,0x83,3}, {0xE4,0xBE,0x8F,3}, {0xE4,0xBD,0xBE,3}, {0xE4,0xBD,0xBB,3}, {0xE4,0xBE,0xAA,3}, {0xE4,0xBD,0xBC,3}, {0xE4,0xBE,0xAC,3}, {0xE4,0xBE,0x94,3},
+        {0xE4,0xBF,0xA6,3}, {0xE4,0xBF,0xA8,3}, {0xE4,0xBF,0xAA,3}, {0xE4,0xBF,0x85,3}, {0xE4,0xBF,0x9A,3}, {0xE4,0xBF,0xA3,3}, {0xE4,0xBF,0x9C,3}, {0xE4,0xBF,0x91,3},
+        {0xE4,0xBF,0x9F,3}, {0xE4,0xBF,0xB8,3}, {0xE5,0x80,0xA9,3}, {0xE5,0x81,0x8C,3}, {0xE4,0xBF,0xB3,3}, {0xE5,0x80,0xAC,3}, {0xE5,0x80,0x8F,3}, {0xE5,0x80,0xAE,3},
+        {0xE5,0x80,0xAD,3}, {0xE4,0xBF,0xBE,3}, {0xE5,0x80,0x9C,3}, {0xE5,0x80,0x8C,3}, {0xE5,0x80,0xA5,3}, {0xE5,0x80,0xA8,3}, {0xE5,0x81,0xBE,3}, {0xE5,0x81,0x83,3},
+        {0xE5,0x81,0x95,3}, {0xE5,0x81,0x88,3}, {0xE5,0x81,0x8E,3}, {0xE5,0x81,0xAC,3}, {0xE5,0x81,0xBB,3}, {0xE5,0x82,0xA5,3}, {0xE5,0x82,0xA7,3}, {0xE5,0x82,0xA9,3},
+        {0xE5,0x82,0xBA,3}, {0xE5,0x83,0x96,3}, {0xE5,0x84,0x86,3}, {0xE5,0x83,0xAD,3}, {0xE5,0x83,0xAC,3}, {0xE5,0x83,0xA6,3}, {0xE5,0x83,0xAE,3}, {0xE5,0x84,0x87,3},
+        {0xE5,0x84,0x8B,3}, {0xE4,0xBB,0x9D,3}, {0xE6,0xB0,0xBD,3}, {0xE4,0xBD,0x98,3}, {0xE4,0xBD,0xA5,3}, {0xE4,0xBF,0x8E,3}, {0xE9,0xBE,0xA0,3}, {0xE6,0xB1,0x86,3},
+        {0xE7,0xB1,0xB4,3}, {0xE5,0x85,0xAE,3}, {0xE5,0xB7,0xBD,3}, {0xE9,0xBB,0x89,3}, {0xE9,0xA6,0x98,3}, {0xE5,0x86,0x81,3}, {0xE5,0xA4,0x94,3}, {0xE5,0x8B,0xB9,3},
+        {0xE5,0x8C,0x8D,3}, {0xE8,0xA8,0x87,3}, {0xE5,0x8C,0x90,3}, {0xE5,0x87,0xAB,3}, {0xE5,0xA4,0x99,3}, {0xE5,0x85,0x95,3}, {0xE4,0xBA,0xA0,3}, {0xE5,0x85,0x96,3},
+        {0xE4,0xBA,0xB3,3}, {0xE8,0xA1,0xAE,3}, {0xE8,0xA2,0xA4,3}, {0xE4,0xBA,0xB5,3}, {0xE8,0x84,0x94,3}, {0xE8,0xA3,0x92,3}, {0xE7,0xA6,0x80,3}, {0xE5,0xAC,0xB4,3},
+        {0xE8,0xA0,0x83,3}, {0xE7,0xBE,0xB8,3}, {0xE5,0x86,0xAB,3}, {0xE5,0x86,0xB1,3}, {0xE5,0x86,0xBD,3}, {0xE5,0x86,0xBC,3},
+    },
+    /* 0xDA */ {
+        {0xE8,0xB4,0x8E,3}, {0xE8,0xB4,0x8F,3}, {0xE8,0xB4,0x90,3}, {0xE8,0xB4,0x91,3}, {0xE8,0xB4,0x92,3}, {0xE8,0xB4,0x93,3}, {0xE8,0xB4,0x94,3}, {0xE8,0xB4,0x95,3},
+        {0xE8,0xB4,0x96,3}, {0xE8,0xB4,0x97,3}, {0xE8,0xB4,0x98,3}, {0xE8,0xB4,0x99,3}, {0xE8,0xB4,0x9A,3}, {0xE8,0xB4,0x9B,3}, {0xE8,0xB4,0x9C,3}, {0xE8,0xB4,0xA0,3},
+        {0xE8,0xB5,0x91,3}, {0xE8,0xB5,0x92,3}, {0xE8,0xB5,0x97,3}, {0xE8,0xB5,0x9F,3}, {0xE8,0xB5,0xA5,3}, {0xE8,0xB5,0xA8,3}, {0xE8,0xB5,0xA9,3}, {0xE8,0xB5,0xAA,3},
+        {0xE8,0xB5,0xAC,3}, {0xE8,0xB5,0xAE,3}, {0xE8,0xB5,0xAF,3}, {0xE8,0xB5,0xB1,3}, {0xE8,0xB5,0xB2,3}, {0xE8,0xB5,0xB8,3}, {0xE8,0xB5,0xB9,3}, {0xE8,0xB5,0xBA,3},
+        {0xE8,0xB5,0xBB,3}, {0xE8,0xB5,0xBC,3}, {0xE8,0xB5,0xBD,3}, {0xE8,0xB5,0xBE,3}, {0xE8,0xB5,0xBF,3}, {0xE8,0xB6,0x80,3}, {0xE8,0xB6,0x82,3}, {0xE8,0xB6,0x83,3},
+        {0xE8,0xB6,0x86,3}, {0xE8,0xB6,0x87,3}, {0xE8,0xB6,0x88,3}, {0xE8,0xB6,0x89,3}, {0xE8,0xB6,0x8C,3}, {0xE8,0xB6,0x8D,3}, {0xE8,0xB6,0x8E,3}, {0xE8,0xB6,0x8F,3},
+        {0xE8,0xB6,0x90,3}, {0xE8,0xB6,0x92,3}, {0xE8,0xB6,0x93,3}, {0xE8,0xB6,0x95,3}, {0xE8,0xB6,0x96,3}, {0xE8,0xB6,0x97,3}, {0xE8,0xB6,0x98,3}, {0xE8,0xB6,0x99,3},
+        {0xE8,0xB6,0x9A,3}, {0xE8,0xB6,0x9B,3}, {0xE8,0xB6,0x9C,3}, {0xE8,0xB6,0x9D,3}, {0xE8,0xB6,0x9E,3}, {0xE8,0xB6,0xA0,3}, {0xE8,0xB6,0xA1,3}, {0xE8,0xB6,0xA2,3},
+        {0xE8,0xB6,0xA4,3}, {0xE8,0xB6,0xA5,3}, {0xE8,0xB6,0xA6,3}, {0xE8,0xB6,0xA7,3}, {0xE8,0xB6,0xA8,3}, {0xE8,0xB6,0xA9,3}, {0xE8,0xB6,0xAA,3}, {0xE8,0xB6,0xAB,3},
+        {0xE8,0xB6,0xAC,3}, {0xE8,0xB6,0xAD,3}, {0xE8,0xB6,0xAE,3}, {0xE8,0xB6,0xAF,3}, {0xE8,0xB6,0xB0,3}, {0xE8,0xB6,0xB2,3}, {0xE8,0xB6,0xB6,3}, {0xE8,0xB6,0xB7,3},
+        {0xE8,0xB6,0xB9,3}, {0xE8,0xB6,0xBB,3}, {0xE8,0xB6,0xBD,3}, {0xE8,0xB7,0x80,3}, {0xE8,0xB7,0x81,3}, {0xE8,0xB7,0x82,3}, {0xE8,0xB7,0x85,3}, {0xE8,0xB7,0x87,3},
+        {0xE8,0xB7,0x88,3}, {0xE8,0xB7,0x89,3}, {0xE8,0xB7,0x8A,3}, {0xE8,0xB7,0x8D,3}, {0xE8,0xB7,0x90,3}, {0xE8,0xB7,0x92,3}, {0xE8,0xB7,0x93,3}, {0xE8,0xB7,0x94,3},
+        {0xE5,0x87,0x87,3}, {0xE5,0x86,0x96,3}, {0xE5,0x86,0xA2,3}, {0xE5,0x86,0xA5,3}, {0xE8,0xAE,0xA0,3}, {0xE8,0xAE,0xA6,3}, {0xE8,0xAE,0xA7,3}, {0xE8,0xAE,0xAA,3},
+        {0xE8,0xAE,0xB4,3}, {0xE8,0xAE,0xB5,3}, {0xE8,0xAE,0xB7,3}, {0xE8,0xAF,0x82,3}, {0xE8,0xAF,0x83,3}, {0xE8,0xAF,0x8B,3}, {0xE8,0xAF,0x8F,3}, {0xE8,0xAF,0x8E,3},
+        {0xE8,0xAF,0x92,3}, {0xE8,0xAF,0x93,3}, {0xE8,0xAF,0x94,3}, {0xE8,0xAF,0x96,3}, {0xE8,0xAF,0x98,3}, {0xE8,0xAF,0x99,3}, {0xE8,0xAF,0x9C,3}, {0xE8,0xAF,0x9F,3},
+        {0xE8,0xAF,0xA0,3}, {0xE8,0xAF,0xA4,3}, {0xE8,0xAF,0xA8,3}, {0xE8,0xAF,0xA9,3}, {0xE8,0xAF,0xAE,3}, {0xE8,0xAF,0xB0,3}, {0xE8,0xAF,0xB3,3}, {0xE8,0xAF,0xB6,3},
+        {0xE8,0xAF,0xB9,3}, {0xE8,0xAF,0xBC,3}, {0xE8,0xAF,0xBF,3}, {0xE8,0xB0,0x80,3}, {0xE8,0xB0,0x82,3}, {0xE8,0xB0,0x84,3}, {0xE8,0xB0,0x87,3}, {0xE8,0xB0,0x8C,3},
+        {0xE8,0xB0,0x8F,3}, {0xE8,0xB0,0x91,3}, {0xE8,0xB0,0x92,3}, {0xE8,0xB0,0x94,3}, {0xE8,0xB0,0x95,3}, {0xE8,0xB0,0x96,3}, {0xE8,0xB0,0x99,3}, {0xE8,0xB0,0x9B,3},
+        {0xE8,0xB0,0x98,3}, {0xE8,0xB0,0x9D,3}, {0xE8,0xB0,0x9F,3}, {0xE8,0xB0,0xA0,3}, {0xE8,0xB0,0xA1,3}, {0xE8,0xB0,0xA5,3}, {0xE8,0xB0,0xA7,3}, {0xE8,0xB0,0xAA,3},
+        {0xE8,0xB0,0xAB,3}, {0xE8,0xB0,0xAE,3}, {0xE8,0xB0,0xAF,3}, {0xE8,0xB0,0xB2,3}, {0xE8,0xB0,0xB3,3}, {0xE8,0xB0,0xB5,3}, {0xE8,0xB0,0xB6,3}, {0xE5,0x8D,0xA9,3},
+        {0xE5,0x8D,0xBA,3}, {0xE9,0x98,0x9D,3}, {0xE9,0x98,0xA2,3}, {0xE9,0x98,0xA1,3}, {0xE9,0x98,0xB1,3}, {0xE9,0x98,0xAA,3}, {0xE9,0x98,0xBD,3}, {0xE9,0x98,0xBC,3},
+        {0xE9,0x99,0x82,3}, {0xE9,0x99,0x89,3}, {0xE9,0x99,0x94,3}, {0xE9,0x99,0x9F,3}, {0xE9,0x99,0xA7,3}, {0xE9,0x99,0xAC,3}, {0xE9,0x99,0xB2,3}, {0xE9,0x99,0xB4,3},
+        {0xE9,0x9A,0x88,3}, {0xE9,0x9A,0x8D,3}, {0xE9,0x9A,0x97,3}, {0xE9,0x9A,0xB0,3}, {0xE9,0x82,0x97,3}, {0xE9,0x82,0x9B,3}, {0xE9,0x82,0x9D,3}, {0xE9,0x82,0x99,3},
+        {0xE9,0x82,0xAC,3}, {0xE9,0x82,0xA1,3}, {0xE9,0x82,0xB4,3}, {0xE9,0x82,0xB3,3}, {0xE9,0x82,0xB6,3}, {0xE9,0x82,0xBA,3},
+    },
+    /* 0xDB */ {
+        {0xE8,0xB7,0x95,3}, {0xE8,0xB7,0x98,3}, {0xE8,0xB7,0x99,3}, {0xE8,0xB7,0x9C,3}, {0xE8,0xB7,0xA0,3}, {0xE8,0xB7,0xA1,3}, {0xE8,0xB7,0xA2,3}, {0xE8,0xB7,0xA5,3},
+        {0xE8,0xB7,0xA6,3}, {0xE8,0xB7,0xA7,3}, {0xE8,0xB7,0xA9,3}, {0xE8,0xB7,0xAD,3}, {0xE8,0xB7,0xAE,3}, {0xE8,0xB7,0xB0,3}, {0xE8,0xB7,0xB1,3}, {0xE8,0xB7,0xB2,3},
+        {0xE8,0xB7,0xB4,3}, {0xE8,0xB7,0xB6,3}, {0xE8,0xB7,0xBC,3}, {0xE8,0xB7,0xBE,3}, {0xE8,0xB7,0xBF,3}, {0xE8,0xB8,0x80,3}, {0xE8,0xB8,0x81,3}, {0xE8,0xB8,0x82,3},
+        {0xE8,0xB8,0x83,3}, {0xE8,0xB8,0x84,3}, {0xE8,0xB8,0x86,3}, {0xE8,0xB8,0x87,3}, {0xE8,0xB8,0x88,3}, {0xE8,0xB8,0x8B,3}, {0xE8,0xB8,0x8D,3}, {0xE8,0xB8,0x8E,3},
+        {0xE8,0xB8,0x90,3}, {0xE8,0xB8,0x91,3}, {0xE8,0xB8,0x92,3}, {0xE8,0xB8,0x93,3}, {0xE8,0xB8,0x95,3}, {0xE8,0xB8,0x96,3}, {0xE8,0xB8,0x97,3}, {0xE8,0xB8,0x98,3},
+        {0xE8,0xB8,0x99,3}, {0xE8,0xB8,0x9A,3}, {0xE8,0xB8,0x9B,3}, {0xE8,0xB8,0x9C,3}, {0xE8,0xB8,0xA0,3}, {0xE8,0xB8,0xA1,3}, {0xE8,0xB8,0xA4,3}, {0xE8,0xB8,0xA5,3},
+        {0xE8,0xB8,0xA6,3}, {0xE8,0xB8,0xA7,3}, {0xE8,0xB8,0xA8,3}, {0xE8,0xB8,0xAB,3}, {0xE8,0xB8,0xAD,3}, {0xE8,0xB8,0xB0,3}, {0xE8,0xB8,0xB2,3}, {0xE8,0xB8,0xB3,3},
+        {0xE8,0xB8,0xB4,3}, {0xE8,0xB8,0xB6,3}, {0xE8,0xB8,0xB7,3}, {0xE8,0xB8,0xB8,3}, {0xE8,0xB8,0xBB,3}, {0xE8,0xB8,0xBC,3}, {0xE8,0xB8,0xBE,3}, {0xE8,0xB8,0xBF,3},
+        {0xE8,0xB9,0x83,3}, {0xE8,0xB9,0x85,3}, {0xE8,0xB9,0x86,3}, {0xE8,0xB9,0x8C,3}, {0xE8,0xB9,0x8D,3}, {0xE8,0xB9,0x8E,3}, {0xE8,0xB9,0x8F,3}, {0xE8,0xB9,0x90,3},
+        {0xE8,0xB9,0x93,3}, {0xE8,0xB9,0x94,3}, {0xE8,0xB9,0x95,3}, {0xE8,0xB9,0x96,3}, {0xE8,0xB9,0x97,3}, {0xE8,0xB9,0x98,3}, {0xE8,0xB9,0x9A,3}, {0xE8,0xB9,0x9B,3},
+        {0xE8,0xB9,0x9C,3}, {0xE8,0xB9,0x9D,3}, {0xE8,0xB9,0x9E,3}, {0xE8,0xB9,0x9F,3}, {0xE8,0xB9,0xA0,3}, {0xE8,0xB9,0xA1,3}, {0xE8,0xB9,0xA2,3}, {0xE8,0xB9,0xA3,3},
+        {0xE8,0xB9,0xA4,3}, {0xE8,0xB9,0xA5,3}, {0xE8,0xB9,0xA7,3}, {0xE8,0xB9,0xA8,3}, {0xE8,0xB9,0xAA,3}, {0xE8,0xB9,0xAB,3}, {0xE8,0xB9,0xAE,3}, {0xE8,0xB9,0xB1,3},
+        {0xE9,0x82,0xB8,3}, {0xE9,0x82,0xB0,3}, {0xE9,0x83,0x8F,3}, {0xE9,0x83,0x85,3}, {0xE9,0x82,0xBE,3}, {0xE9,0x83,0x90,3}, {0xE9,0x83,0x84,3}, {0xE9,0x83,0x87,3},
+        {0xE9,0x83,0x93,3}, {0xE9,0x83,0xA6,3}, {0xE9,0x83,0xA2,3}, {0xE9,0x83,0x9C,3}, {0xE9,0x83,0x97,3}, {0xE9,0x83,0x9B,3}, {0xE9,0x83,0xAB,3}, {0xE9,0x83,0xAF,3},
+        {0xE9,0x83,0xBE,3}, {0xE9,0x84,0x84,3}, {0xE9,0x84,0xA2,3}, {0xE9,0x84,0x9E,3}, {0xE9,0x84,0xA3,3}, {0xE9,0x84,0xB1,3}, {0xE9,0x84,0xAF,3}, {0xE9,0x84,0xB9,3},
+        {0xE9,0x85,0x83,3}, {0xE9,0x85,0x86,3}, {0xE5,0x88,0x8D,3}, {0xE5,0xA5,0x82,3}, {0xE5,0x8A,0xA2,3}, {0xE5,0x8A,0xAC,3}, {0xE5,0x8A,0xAD,3}, {0xE5,0x8A,0xBE,3},
+        {0xE5,0x93,0xBF,3}, {0xE5,0x8B,0x90,3}, {0xE5,0x8B,0x96,3}, {0xE5,0x8B,0xB0,3}, {0xE5,0x8F,0x9F,3}, {0xE7,0x87,0xAE,3}, {0xE7,0x9F,0x8D,3}, {0xE5,0xBB,0xB4,3},
+        {0xE5,0x87,0xB5,3}, {0xE5,0x87,0xBC,3}, {0xE9,0xAC,0xAF,3}, {0xE5,0x8E,0xB6,3}, {0xE5,0xBC,0x81,3}, {0xE7,0x95,0x9A,3}, {0xE5,0xB7,0xAF,3}, {0xE5,0x9D,0x8C,3},
+        {0xE5,0x9E,0xA9,3}, {0xE5,0x9E,0xA1,3}, {0xE5,0xA1,0xBE,3}, {0xE5,0xA2,0xBC,3}, {0xE5,0xA3,0x85,3}, {0xE5,0xA3,0x91,3}, {0xE5,0x9C,0xA9,3}, {0xE5,0x9C,0xAC,3},
+        {0xE5,0x9C,0xAA,3}, {0xE5,0x9C,0xB3,3}, {0xE5,0x9C,0xB9,3}, {0xE5,0x9C,0xAE,3}, {0xE5,0x9C,0xAF,3}, {0xE5,0x9D,0x9C,3}, {0xE5,0x9C,0xBB,3}, {0xE5,0x9D,0x82,3},
+        {0xE5,0x9D,0xA9,3}, {0xE5,0x9E,0x85,3}, {0xE5,0x9D,0xAB,3}, {0xE5,0x9E,0x86,3}, {0xE5,0x9D,0xBC,3}, {0xE5,0x9D,0xBB,3}, {0xE5,0x9D,0xA8,3}, {0xE5,0x9D,0xAD,3},
+        {0xE5,0x9D,0xB6,3}, {0xE5,0x9D,0xB3,3}, {0xE5,0x9E,0xAD,3}, {0xE5,0x9E,0xA4,3}, {0xE5,0x9E,0x8C,3}, {0xE5,0x9E,0xB2,3}, {0xE5,0x9F,0x8F,3}, {0xE5,0x9E,0xA7,3},
+        {0xE5,0x9E,0xB4,3}, {0xE5,0x9E,0x93,3}, {0xE5,0x9E,0xA0,3}, {0xE5,0x9F,0x95,3}, {0xE5,0x9F,0x98,3}, {0xE5,0x9F,0x9A,3}, {0xE5,0x9F,0x99,3}, {0xE5,0x9F,0x92,3},
+        {0xE5,0x9E,0xB8,3}, {0xE5,0x9F,0xB4,3}, {0xE5,0x9F,0xAF,3}, {0xE5,0x9F,0xB8,3}, {0xE5,0x9F,0xA4,3}, {0xE5,0x9F,0x9D,3},
+    },
+    /* 0xDC */ {
+        {0xE8,0xB9,0xB3,3}, {0xE8,0xB9,0xB5,3}, {0xE8,0xB9,0xB7,3}, {0xE8,0xB9,0xB8,3}, {0xE8,0xB9,0xB9,3}, {0xE8,0xB9,0xBA,3}, {0xE8,0xB9,0xBB,3}, {0xE8,0xB9,0xBD,3},
+        {0xE8,0xB9,0xBE,3}, {0xE8,0xBA,0x80,3}, {0xE8,0xBA,0x82,3}, {0xE8,0xBA,0x83,3}, {0xE8,0xBA,0x84,3}, {0xE8,0xBA,0x86,3}, {0xE8,0xBA,0x88,3}, {0xE8,0xBA,0x89,3},
+        {0xE8,0xBA,0x8A,3}, {0xE8,0xBA,0x8B,3}, {0xE8,0xBA,0x8C,3}, {0xE8,0xBA,0x8D,3}, {0xE8,0xBA,0x8E,3}, {0xE8,0xBA,0x91,3}, {0xE8,0xBA,0x92,3}, {0xE8,0xBA,0x93,3},
+        {0xE8,0xBA,0x95,3}, {0xE8,0xBA,0x96,3}, {0xE8,0xBA,0x97,3}, {0xE8,0xBA,0x98,3}, {0xE8,0xBA,0x99,3}, {0xE8,0xBA,0x9A,3}, {0xE8,0xBA,0x9B,3}, {0xE8,0xBA,0x9D,3},
+        {0xE8,0xBA,0x9F,3}, {0xE8,0xBA,0xA0,3}, {0xE8,0xBA,0xA1,3}, {0xE8,0xBA,0xA2,3}, {0xE8,0xBA,0xA3,3}, {0xE8,0xBA,0xA4,3}, {0xE8,0xBA,0xA5,3}, {0xE8,0xBA,0xA6,3},
+        {0xE8,0xBA,0xA7,3}, {0xE8,0xBA,0xA8,3}, {0xE8,0xBA,0xA9,3}, {0xE8,0xBA,0xAA,3}, {0xE8,0xBA,0xAD,3}, {0xE8,0xBA,0xAE,3}, {0xE8,0xBA,0xB0,3}, {0xE8,0xBA,0xB1,3},
+        {0xE8,0xBA,0xB3,3}, {0xE8,0xBA,0xB4,3}, {0xE8,0xBA,0xB5,3}, {0xE8,0xBA,0xB6,3}, {0xE8,0xBA,0xB7,3}, {0xE8,0xBA,0xB8,3}, {0xE8,0xBA,0xB9,3}, {0xE8,0xBA,0xBB,3},
+        {0xE8,0xBA,0xBC,3}, {0xE8,0xBA,0xBD,3}, {0xE8,0xBA,0xBE,3}, {0xE8,0xBA,0xBF,3}, {0xE8,0xBB,0x80,3}, {0xE8,0xBB,0x81,3}, {0xE8,0xBB,0x82,3}, {0xE8,0xBB,0x83,3},
+        {0xE8,0xBB,0x84,3}, {0xE8,0xBB,0x85,3}, {0xE8,0xBB,0x86,3}, {0xE8,0xBB,0x87,3}, {0xE8,0xBB,0x88,3}, {0xE8,0xBB,0x89,3}, {0xE8,0xBB,0x8A,3}, {0xE8,0xBB,0x8B,3},
+        {0xE8,0xBB,0x8C,3}, {0xE8,0xBB,0x8D,3}, {0xE8,0xBB,0x8F,3}, {0xE8,0xBB,0x90,3}, {0xE8,0xBB,0x91,3}, {0xE8,0xBB,0x92,3}, {0xE8,0xBB,0x93,3}, {0xE8,0xBB,0x94,3},
+        {0xE8,0xBB,0x95,3}, {0xE8,0xBB,0x96,3}, {0xE8,0xBB,0x97,3}, {0xE8,0xBB,0x98,3}, {0xE8,0xBB,0x99,3}, {0xE8,0xBB,0x9A,3}, {0xE8,0xBB,0x9B,3}, {0xE8,0xBB,0x9C,3},
+        {0xE8,0xBB,0x9D,3}, {0xE8,0xBB,0x9E,3}, {0xE8,0xBB,0x9F,3}, {0xE8,0xBB,0xA0,3}, {0xE8,0xBB,0xA1,3}, {0xE8,0xBB,0xA2,3}, {0xE8,0xBB,0xA3,3}, {0xE8,0xBB,0xA4,3},
+        {0xE5,0xA0,0x8B,3}, {0xE5,0xA0,0x8D,3}, {0xE5,0x9F,0xBD,3}, {0xE5,0x9F,0xAD,3}, {0xE5,0xA0,0x80,3}, {0xE5,0xA0,0x9E,3}, {0xE5,0xA0,0x99,3}, {0xE5,0xA1,0x84,3},
+        {0xE5,0xA0,0xA0,3}, {0xE5,0xA1,0xA5,3}, {0xE5,0xA1,0xAC,3}, {0xE5,0xA2,0x81,3}, {0xE5,0xA2,0x89,3}, {0xE5,0xA2,0x9A,3}, {0xE5,0xA2,0x80,3}, {0xE9,0xA6,0xA8,3},
+        {0xE9,0xBC,0x99,3}, {0xE6,0x87,0xBF,3}, {0xE8,0x89,0xB9,3}, {0xE8,0x89,0xBD,3}, {0xE8,0x89,0xBF,3}, {0xE8,0x8A,0x8F,3}, {0xE8,0x8A,0x8A,3}, {0xE8,0x8A,0xA8,3},
+        {0xE8,0x8A,0x84,3}, {0xE8,0x8A,0x8E,3}, {0xE8,0x8A,0x91,3}, {0xE8,0x8A,0x97,3}, {0xE8,0x8A,0x99,3}, {0xE8,0x8A,0xAB,3}, {0xE8,0x8A,0xB8,3}, {0xE8,0x8A,0xBE,3},
+        {0xE8,0x8A,0xB0,3}, {0xE8,0x8B,0x88,3}, {0xE8,0x8B,0x8A,3}, {0xE8,0x8B,0xA3,3}, {0xE8,0x8A,0x98,3}, {0xE8,0x8A,0xB7,3}, {0xE8,0x8A,0xAE,3}, {0xE8,0x8B,0x8B,3},
+        {0xE8,0x8B,0x8C,3}, {0xE8,0x8B,0x81,3}, {0xE8,0x8A,0xA9,3}, {0xE8,0x8A,0xB4,3}, {0xE8,0x8A,0xA1,3}, {0xE8,0x8A,0xAA,3}, {0xE8,0x8A,0x9F,3}, {0xE8,0x8B,0x84,3},
+        {0xE8,0x8B,0x8E,3}, {0xE8,0x8A,0xA4,3}, {0xE8,0x8B,0xA1,3}, {0xE8,0x8C,0x89,3}, {0xE8,0x8B,0xB7,3}, {0xE8,0x8B,0xA4,3}, {0xE8,0x8C,0x8F,3}, {0xE8,0x8C,0x87,3},
+        {0xE8,0x8B,0x9C,3}, {0xE8,0x8B,0xB4,3}, {0xE8,0x8B,0x92,3}, {0xE8,0x8B,0x98,3}, {0xE8,0x8C,0x8C,3}, {0xE8,0x8B,0xBB,3}, {0xE8,0x8B,0x93,3}, {0xE8,0x8C,0x91,3},
+        {0xE8,0x8C,0x9A,3}, {0xE8,0x8C,0x86,3}, {0xE8,0x8C,0x94,3}, {0xE8,0x8C,0x95,3}, {0xE8,0x8B,0xA0,3}, {0xE8,0x8B,0x95,3}, {0xE8,0x8C,0x9C,3}, {0xE8,0x8D,0x91,3},
+        {0xE8,0x8D,0x9B,3}, {0xE8,0x8D,0x9C,3}, {0xE8,0x8C,0x88,3}, {0xE8,0x8E,0x92,3}, {0xE8,0x8C,0xBC,3}, {0xE8,0x8C,0xB4,3}, {0xE8,0x8C,0xB1,3}, {0xE8,0x8E,0x9B,3},
+        {0xE8,0x8D,0x9E,3}, {0xE8,0x8C,0xAF,3}, {0xE8,0x8D,0x8F,3}, {0xE8,0x8D,0x87,3}, {0xE8,0x8D,0x83,3}, {0xE8,0x8D,0x9F,3}, {0xE8,0x8D,0x80,3}, {0xE8,0x8C,0x97,3},
+        {0xE8,0x8D,0xA0,3}, {0xE8,0x8C,0xAD,3}, {0xE8,0x8C,0xBA,3}, {0xE8,0x8C,0xB3,3}, {0xE8,0x8D,0xA6,3}, {0xE8,0x8D,0xA5,3},
+    },
+    /* 0xDD */ {
+        {0xE8,0xBB,0xA5,3}, {0xE8,0xBB,0xA6,3}, {0xE8,0xBB,0xA7,3}, {0xE8,0xBB,0xA8,3}, {0xE8,0xBB,0xA9,3}, {0xE8,0xBB,0xAA,3}, {0xE8,0xBB,0xAB,3}, {0xE8,0xBB,0xAC,3},
+        {0xE8,0xBB,0xAD,3}, {0xE8,0xBB,0xAE,3}, {0xE8,0xBB,0xAF,3}, {0xE8,0xBB,0xB0,3}, {0xE8,0xBB,0xB1,3}, {0xE8,0xBB,0xB2,3}, {0xE8,0xBB,0xB3,3}, {0xE8,0xBB,0xB4,3},
+        {0xE8,0xBB,0xB5,3}, {0xE8,0xBB,0xB6,3}, {0xE8,0xBB,0xB7,3}, {0xE8,0xBB,0xB8,3}, {0xE8,0xBB,0xB9,3}, {0xE8,0xBB,0xBA,3}, {0xE8,0xBB,0xBB,3}, {0xE8,0xBB,0xBC,3},
+        {0xE8,0xBB,0xBD,3}, {0xE8,0xBB,0xBE,3}, {0xE8,0xBB,0xBF,3}, {0xE8,0xBC,0x80,3}, {0xE8,0xBC,0x81,3}, {0xE8,0xBC,0x82,3}, {0xE8,0xBC,0x83,3}, {0xE8,0xBC,0x84,3},
+        {0xE8,0xBC,0x85,3}, {0xE8,0xBC,0x86,3}, {0xE8,0xBC,0x87,3}, {0xE8,0xBC,0x88,3}, {0xE8,0xBC,0x89,3}, {0xE8,0xBC,0x8A,3}, {0xE8,0xBC,0x8B,3}, {0xE8,0xBC,0x8C,3},
+        {0xE8,0xBC,0x8D,3}, {0xE8,0xBC,0x8E,3}, {0xE8,0xBC,0x8F,3}, {0xE8,0xBC,0x90,3}, {0xE8,0xBC,0x91,3}, {0xE8,0xBC,0x92,3}, {0xE8,0xBC,0x93,3}, {0xE8,0xBC,0x94,3},
+        {0xE8,0xBC,0x95,3}, {0xE8,0xBC,0x96,3}, {0xE8,0xBC,0x97,3}, {0xE8,0xBC,0x98,3}, {0xE8,0xBC,0x99,3}, {0xE8,0xBC,0x9A,3}, {0xE8,0xBC,0x9B,3}, {0xE8,0xBC,0x9C,3},
+        {0xE8,0xBC,0x9D,3}, {0xE8,0xBC,0x9E,3}, {0xE8,0xBC,0x9F,3}, {0xE8,0xBC,0xA0,3}, {0xE8,0xBC,0xA1,3}, {0xE8,0xBC,0xA2,3}, {0xE8,0xBC,0xA3,3}, {0xE8,0xBC,0xA4,3},
+        {0xE8,0xBC,0xA5,3}, {0xE8,0xBC,0xA6,3}, {0xE8,0xBC,0xA7,3}, {0xE8,0xBC,0xA8,3}, {0xE8,0xBC,0xA9,3}, {0xE8,0xBC,0xAA,3}, {0xE8,0xBC,0xAB,3}, {0xE8,0xBC,0xAC,3},
+        {0xE8,0xBC,0xAD,3}, {0xE8,0xBC,0xAE,3}, {0xE8,0xBC,0xAF,3}, {0xE8,0xBC,0xB0,3}, {0xE8,0xBC,0xB1,3}, {0xE8,0xBC,0xB2,3}, {0xE8,0xBC,0xB3,3}, {0xE8,0xBC,0xB4,3},
+        {0xE8,0xBC,0xB5,3}, {0xE8,0xBC,0xB6,3}, {0xE8,0xBC,0xB7,3}, {0xE8,0xBC,0xB8,3}, {0xE8,0xBC,0xB9,3}, {0xE8,0xBC,0xBA,3}, {0xE8,0xBC,0xBB,3}, {0xE8,0xBC,0xBC,3},
+        {0xE8,0xBC,0xBD,3}, {0xE8,0xBC,0xBE,3}, {0xE8,0xBC,0xBF,3}, {0xE8,0xBD,0x80,3}, {0xE8,0xBD,0x81,3}, {0xE8,0xBD,0x82,3}, {0xE8,0xBD,0x83,3}, {0xE8,0xBD,0x84,3},
+        {0xE8,0x8D,0xA8,3}, {0xE8,0x8C,0x9B,3}, {0xE8,0x8D,0xA9,3}, {0xE8,0x8D,0xAC,3}, {0xE8,0x8D,0xAA,3}, {0xE8,0x8D,0xAD,3}, {0xE8,0x8D,0xAE,3}, {0xE8,0x8E,0xB0,3},
+        {0xE8,0x8D,0xB8,3}, {0xE8,0x8E,0xB3,3}, {0xE8,0x8E,0xB4,3}, {0xE8,0x8E,0xA0,3}, {0xE8,0x8E,0xAA,3}, {0xE8,0x8E,0x93,3}, {0xE8,0x8E,0x9C,3}, {0xE8,0x8E,0x85,3},
+        {0xE8,0x8D,0xBC,3}, {0xE8,0x8E,0xB6,3}, {0xE8,0x8E,0xA9,3}, {0xE8,0x8D,0xBD,3}, {0xE8,0x8E,0xB8,3}, {0xE8,0x8D,0xBB,3}, {0xE8,0x8E,0x98,3}, {0xE8,0x8E,0x9E,3},
+        {0xE8,0x8E,0xA8,3}, {0xE8,0x8E,0xBA,3}, {0xE8,0x8E,0xBC,3}, {0xE8,0x8F,0x81,3}, {0xE8,0x90,0x81,3}, {0xE8,0x8F,0xA5,3}, {0xE8,0x8F,0x98,3}, {0xE5,0xA0,0x87,3},
+        {0xE8,0x90,0x98,3}, {0xE8,0x90,0x8B,3}, {0xE8,0x8F,0x9D,3}, {0xE8,0x8F,0xBD,3}, {0xE8,0x8F,0x96,3}, {0xE8,0x90,0x9C,3}, {0xE8,0x90,0xB8,3}, {0xE8,0x90,0x91,3},
+        {0xE8,0x90,0x86,3}, {0xE8,0x8F,0x94,3}, {0xE8,0x8F,0x9F,3}, {0xE8,0x90,0x8F,3}, {0xE8,0x90,0x83,3}, {0xE8,0x8F,0xB8,3}, {0xE8,0x8F,0xB9,3}, {0xE8,0x8F,0xAA,3},
+        {0xE8,0x8F,0x85,3}, {0xE8,0x8F,0x80,3}, {0xE8,0x90,0xA6,3}, {0xE8,0x8F,0xB0,3}, {0xE8,0x8F,0xA1,3}, {0xE8,0x91,0x9C,3}, {0xE8,0x91,0x91,3}, {0xE8,0x91,0x9A,3},
+        {0xE8,0x91,0x99,3}, {0xE8,0x91,0xB3,3}, {0xE8,0x92,0x87,3}, {0xE8,0x92,0x88,3}, {0xE8,0x91,0xBA,3}, {0xE8,0x92,0x89,3}, {0xE8,0x91,0xB8,3}, {0xE8,0x90,0xBC,3},
+        {0xE8,0x91,0x86,3}, {0xE8,0x91,0xA9,3}, {0xE8,0x91,0xB6,3}, {0xE8,0x92,0x8C,3}, {0xE8,0x92,0x8E,3}, {0xE8,0x90,0xB1,3}, {0xE8,0x91,0xAD,3}, {0xE8,0x93,0x81,3},
+        {0xE8,0x93,0x8D,3}, {0xE8,0x93,0x90,3}, {0xE8,0x93,0xA6,3}, {0xE8,0x92,0xBD,3}, {0xE8,0x93,0x93,3}, {0xE8,0x93,0x8A,3}, {0xE8,0x92,0xBF,3}, {0xE8,0x92,0xBA,3},
+        {0xE8,0x93,0xA0,3}, {0xE8,0x92,0xA1,3}, {0xE8,0x92,0xB9,3}, {0xE8,0x92,0xB4,3}, {0xE8,0x92,0x97,3}, {0xE8,0x93,0xA5,3}, {0xE8,0x93,0xA3,3}, {0xE8,0x94,0x8C,3},
+        {0xE7,0x94,0x8D,3}, {0xE8,0x94,0xB8,3}, {0xE8,0x93,0xB0,3}, {0xE8,0x94,0xB9,3}, {0xE8,0x94,0x9F,3}, {0xE8,0x94,0xBA,3},
+    },
+    /* 0xDE */ {
+        {0xE8,0xBD,0x85,3}, {0xE8,0xBD,0x86,3}, {0xE8,0xBD,0x87,3}, {0xE8,0xBD,0x88,3}, {0xE8,0xBD,0x89,3}, {0xE8,0xBD,0x8A,3}, {0xE8,0xBD,0x8B,3}, {0xE8,0xBD,0x8C,3},
+        {0xE8,0xBD,0x8D,3}, {0xE8,0xBD,0x8E,3}, {0xE8,0xBD,0x8F,3}, {0xE8,0xBD,0x90,3}, {0xE8,0xBD,0x91,3}, {0xE8,0xBD,0x92,3}, {0xE8,0xBD,0x93,3}, {0xE8,0xBD,0x94,3},
+        {0xE8,0xBD,0x95,3}, {0xE8,0xBD,0x96,3}, {0xE8,0xBD,0x97,3}, {0xE8,0xBD,0x98,3}, {0xE8,0xBD,0x99,3}, {0xE8,0xBD,0x9A,3}, {0xE8,0xBD,0x9B,3}, {0xE8,0xBD,0x9C,3},
+        {0xE8,0xBD,0x9D,3}, {0xE8,0xBD,0x9E,3}, {0xE8,0xBD,0x9F,3}, {0xE8,0xBD,0xA0,3}, {0xE8,0xBD,0xA1,3}, {0xE8,0xBD,0xA2,3}, {0xE8,0xBD,0xA3,3}, {0xE8,0xBD,0xA4,3},
+        {0xE8,0xBD,0xA5,3}, {0xE8,0xBD,0xAA,3}, {0xE8,0xBE,0x80,3}, {0xE8,0xBE,0x8C,3}, {0xE8,0xBE,0x92,3}, {0xE8,0xBE,0x9D,3}, {0xE8,0xBE,0xA0,3}, {0xE8,0xBE,0xA1,3},
+        {0xE8,0xBE,0xA2,3}, {0xE8,0xBE,0xA4,3}, {0xE8,0xBE,0xA5,3}, {0xE8,0xBE,0xA6,3}, {0xE8,0xBE,0xA7,3}, {0xE8,0xBE,0xAA,3}, {0xE8,0xBE,0xAC,3}, {0xE8,0xBE,0xAD,3},
+        {0xE8,0xBE,0xAE,3}, {0xE8,0xBE,0xAF,3}, {0xE8,0xBE,0xB2,3}, {0xE8,0xBE,0xB3,3}, {0xE8,0xBE,0xB4,3}, {0xE8,0xBE,0xB5,3}, {0xE8,0xBE,0xB7,3}, {0xE8,0xBE,0xB8,3},
+        {0xE8,0xBE,0xBA,3}, {0xE8,0xBE,0xBB,3}, {0xE8,0xBE,0xBC,3}, {0xE8,0xBE,0xBF,3}, {0xE8,0xBF,0x80,3}, {0xE8,0xBF,0x83,3}, {0xE8,0xBF,0x86,3}, {0xE8,0xBF,0x89,3},
+        {0xE8,0xBF,0x8A,3}, {0xE8,0xBF,0x8B,3}, {0xE8,0xBF,0x8C,3}, {0xE8,0xBF,0x8D,3}, {0xE8,0xBF,0x8F,3}, {0xE8,0xBF,0x92,3}, {0xE8,0xBF,0x96,3}, {0xE8,0xBF,0x97,3},
+        {0xE8,0xBF,0x9A,3}, {0xE8,0xBF,0xA0,3}, {0xE8,0xBF,0xA1,3}, {0xE8,0xBF,0xA3,3}, {0xE8,0xBF,0xA7,3}, {0xE8,0xBF,0xAC,3}, {0xE8,0xBF,0xAF,3}, {0xE8,0xBF,0xB1,3},
+        {0xE8,0xBF,0xB2,3}, {0xE8,0xBF,0xB4,3}, {0xE8,0xBF,0xB5,3}, {0xE8,0xBF,0xB6,3}, {0xE8,0xBF,0xBA,3}, {0xE8,0xBF,0xBB,3}, {0xE8,0xBF,0xBC,3}, {0xE8,0xBF,0xBE,3},
+        {0xE8,0xBF,0xBF,3}, {0xE9,0x80,0x87,3}, {0xE9,0x80,0x88,3}, {0xE9,0x80,0x8C,3}, {0xE9,0x80,0x8E,3}, {0xE9,0x80,0x93,3}, {0xE9,0x80,0x95,3}, {0xE9,0x80,0x98,3},
+        {0xE8,0x95,0x96,3}, {0xE8,0x94,0xBB,3}, {0xE8,0x93,0xBF,3}, {0xE8,0x93,0xBC,3}, {0xE8,0x95,0x99,3}, {0xE8,0x95,0x88,3}, {0xE8,0x95,0xA8,3}, {0xE8,0x95,0xA4,3},
+        {0xE8,0x95,0x9E,3}, {0xE8,0x95,0xBA,3}, {0xE7,0x9E,0xA2,3}, {0xE8,0x95,0x83,3}, {0xE8,0x95,0xB2,3}, {0xE8,0x95,0xBB,3}, {0xE8,0x96,0xA4,3}, {0xE8,0x96,0xA8,3},
+        {0xE8,0x96,0x87,3}, {0xE8,0x96,0x8F,3}, {0xE8,0x95,0xB9,3}, {0xE8,0x96,0xAE,3}, {0xE8,0x96,0x9C,3}, {0xE8,0x96,0x85,3}, {0xE8,0x96,0xB9,3}, {0xE8,0x96,0xB7,3},
+        {0xE8,0x96,0xB0,3}, {0xE8,0x97,0x93,3}, {0xE8,0x97,0x81,3}, {0xE8,0x97,0x9C,3}, {0xE8,0x97,0xBF,3}, {0xE8,0x98,0xA7,3}, {0xE8,0x98,0x85,3}, {0xE8,0x98,0xA9,3},
+        {0xE8,0x98,0x96,3}, {0xE8,0x98,0xBC,3}, {0xE5,0xBB,0xBE,3}, {0xE5,0xBC,0x88,3}, {0xE5,0xA4,0xBC,3}, {0xE5,0xA5,0x81,3}, {0xE8,0x80,0xB7,3}, {0xE5,0xA5,0x95,3},
+        {0xE5,0xA5,0x9A,3}, {0xE5,0xA5,0x98,3}, {0xE5,0x8C,0x8F,3}, {0xE5,0xB0,0xA2,3}, {0xE5,0xB0,0xA5,3}, {0xE5,0xB0,0xAC,3}, {0xE5,0xB0,0xB4,3}, {0xE6,0x89,0x8C,3},
+        {0xE6,0x89,0xAA,3}, {0xE6,0x8A,0x9F,3}, {0xE6,0x8A,0xBB,3}, {0xE6,0x8B,0x8A,3}, {0xE6,0x8B,0x9A,3}, {0xE6,0x8B,0x97,3}, {0xE6,0x8B,0xAE,3}, {0xE6,0x8C,0xA2,3},
+        {0xE6,0x8B,0xB6,3}, {0xE6,0x8C,0xB9,3}, {0xE6,0x8D,0x8B,3}, {0xE6,0x8D,0x83,3}, {0xE6,0x8E,0xAD,3}, {0xE6,0x8F,0xB6,3}, {0xE6,0x8D,0xB1,3}, {0xE6,0x8D,0xBA,3},
+        {0xE6,0x8E,0x8E,3}, {0xE6,0x8E,0xB4,3}, {0xE6,0x8D,0xAD,3}, {0xE6,0x8E,0xAC,3}, {0xE6,0x8E,0x8A,3}, {0xE6,0x8D,0xA9,3}, {0xE6,0x8E,0xAE,3}, {0xE6,0x8E,0xBC,3},
+        {0xE6,0x8F,0xB2,3}, {0xE6,0x8F,0xB8,3}, {0xE6,0x8F,0xA0,3}, {0xE6,0x8F,0xBF,3}, {0xE6,0x8F,0x84,3}, {0xE6,0x8F,0x9E,3}, {0xE6,0x8F,0x8E,3}, {0xE6,0x91,0x92,3},
+        {0xE6,0x8F,0x86,3}, {0xE6,0x8E,0xBE,3}, {0xE6,0x91,0x85,3}, {0xE6,0x91,0x81,3}, {0xE6,0x90,0x8B,3}, {0xE6,0x90,0x9B,3}, {0xE6,0x90,0xA0,3}, {0xE6,0x90,0x8C,3},
+        {0xE6,0x90,0xA6,3}, {0xE6,0x90,0xA1,3}, {0xE6,0x91,0x9E,3}, {0xE6,0x92,0x84,3}, {0xE6,0x91,0xAD,3}, {0xE6,0x92,0x96,3},
+    },
+    /* 0xDF */ {
+        {0xE9,0x80,0x99,3}, {0xE9,0x80,0x9C,3}, {0xE9,0x80,0xA3,3}, {0xE9,0x80,0xA4,3}, {0xE9,0x80,0xA5,3}, {0xE9,0x80,0xA7,3}, {0xE9,0x80,0xA8,3}, {0xE9,0x80,0xA9,3},
+        {0xE9,0x80,0xAA,3}, {0xE9,0x80,0xAB,3}, {0xE9,0x80,0xAC,3}, {0xE9,0x80,0xB0,3}, {0xE9,0x80,0xB1,3}, {0xE9,0x80,0xB2,3}, {0xE9,0x80,0xB3,3}, {0xE9,0x80,0xB4,3},
+        {0xE9,0x80,0xB7,3}, {0xE9,0x80,0xB9,3}, {0xE9,0x80,0xBA,3}, {0xE9,0x80,0xBD,3}, {0xE9,0x80,0xBF,3}, {0xE9,0x81,0x80,3}, {0xE9,0x81,0x83,3}, {0xE9,0x81,0x85,3},
+        {0xE9,0x81,0x86,3}, {0xE9,0x81,0x88,3}, {0xE9,0x81,0x89,3}, {0xE9,0x81,0x8A,3}, {0xE9,0x81,0x8B,3}, {0xE9,0x81,0x8C,3}, {0xE9,0x81,0x8E,3}, {0xE9,0x81,0x94,3},
+        {0xE9,0x81,0x95,3}, {0xE9,0x81,0x96,3}, {0xE9,0x81,0x99,3}, {0xE9,0x81,0x9A,3}, {0xE9,0x81,0x9C,3}, {0xE9,0x81,0x9D,3}, {0xE9,0x81,0x9E,3}, {0xE9,0x81,0x9F,3},
+        {0xE9,0x81,0xA0,3}, {0xE9,0x81,0xA1,3}, {0xE9,0x81,0xA4,3}, {0xE9,0x81,0xA6,3}, {0xE9,0x81,0xA7,3}, {0xE9,0x81,0xA9,3}, {0xE9,0x81,0xAA,3}, {0xE9,0x81,0xAB,3},
+        {0xE9,0x81,0xAC,3}, {0xE9,0x81,0xAF,3}, {0xE9,0x81,0xB0,3}, {0xE9,0x81,0xB1,3}, {0xE9,0x81,0xB2,3}, {0xE9,0x81,0xB3,3}, {0xE9,0x81,0xB6,3}, {0xE9,0x81,0xB7,3},
+        {0xE9,0x81,0xB8,3}, {0xE9,0x81,0xB9,3}, {0xE9,0x81,0xBA,3}, {0xE9,0x81,0xBB,3}, {0xE9,0x81,0xBC,3}, {0xE9,0x81,0xBE,3}, {0xE9,0x82,0x81,3}, {0xE9,0x82,0x84,3},
+        {0xE9,0x82,0x85,3}, {0xE9,0x82,0x86,3}, {0xE9,0x82,0x87,3}, {0xE9,0x82,0x89,3}, {0xE9,0x82,0x8A,3}, {0xE9,0x82,0x8C,3}, {0xE9,0x82,0x8D,3}, {0xE9,0x82,0x8E,3},
+        {0xE9,0x82,0x8F,3}, {0xE9,0x82,0x90,3}, {0xE9,0x82,0x92,3}, {0xE9,0x82,0x94,3}, {0xE9,0x82,0x96,3}, {0xE9,0x82,0x98,3}, {0xE9,0x82,0x9A,3}, {0xE9,0x82,0x9C,3},
+        {0xE9,0x82,0x9E,3}, {0xE9,0x82,0x9F,3}, {0xE9,0x82,0xA0,3}, {0xE9,0x82,0xA4,3}, {0xE9,0x82,0xA5,3}, {0xE9,0x82,0xA7,3}, {0xE9,0x82,0xA8,3}, {0xE9,0x82,0xA9,3},
+        {0xE9,0x82,0xAB,3}, {0xE9,0x82,0xAD,3}, {0xE9,0x82,0xB2,3}, {0xE9,0x82,0xB7,3}, {0xE9,0x82,0xBC,3}, {0xE9,0x82,0xBD,3}, {0xE9,0x82,0xBF,3}, {0xE9,0x83,0x80,3},
+        {0xE6,0x91,0xBA,3}, {0xE6,0x92,0xB7,3}, {0xE6,0x92,0xB8,3}, {0xE6,0x92,0x99,3}, {0xE6,0x92,0xBA,3}, {0xE6,0x93,0x80,3}, {0xE6,0x93,0x90,3}, {0xE6,0x93,0x97,3},
+        {0xE6,0x93,0xA4,3}, {0xE6,0x93,0xA2,3}, {0xE6,0x94,0x89,3}, {0xE6,0x94,0xA5,3}, {0xE6,0x94,0xAE,3}, {0xE5,0xBC,0x8B,3}, {0xE5,0xBF,0x92,3}, {0xE7,0x94,0x99,3},
+        {0xE5,0xBC,0x91,3}, {0xE5,0x8D,0x9F,3}, {0xE5,0x8F,0xB1,3}, {0xE5,0x8F,0xBD,3}, {0xE5,0x8F,0xA9,3}, {0xE5,0x8F,0xA8,3}, {0xE5,0x8F,0xBB,3}, {0xE5,0x90,0x92,3},
+        {0xE5,0x90,0x96,3}, {0xE5,0x90,0x86,3}, {0xE5,0x91,0x8B,3}, {0xE5,0x91,0x92,3}, {0xE5,0x91,0x93,3}, {0xE5,0x91,0x94,3}, {0xE5,0x91,0x96,3}, {0xE5,0x91,0x83,3},
+        {0xE5,0x90,0xA1,3}, {0xE5,0x91,0x97,3}, {0xE5,0x91,0x99,3}, {0xE5,0x90,0xA3,3}, {0xE5,0x90,0xB2,3}, {0xE5,0x92,0x82,3}, {0xE5,0x92,0x94,3}, {0xE5,0x91,0xB7,3},
+        {0xE5,0x91,0xB1,3}, {0xE5,0x91,0xA4,3}, {0xE5,0x92,0x9A,3}, {0xE5,0x92,0x9B,3}, {0xE5,0x92,0x84,3}, {0xE5,0x91,0xB6,3}, {0xE5,0x91,0xA6,3}, {0xE5,0x92,0x9D,3},
+        {0xE5,0x93,0x90,3}, {0xE5,0x92,0xAD,3}, {0xE5,0x93,0x82,3}, {0xE5,0x92,0xB4,3}, {0xE5,0x93,0x92,3}, {0xE5,0x92,0xA7,3}, {0xE5,0x92,0xA6,3}, {0xE5,0x93,0x93,3},
+        {0xE5,0x93,0x94,3}, {0xE5,0x91,0xB2,3}, {0xE5,0x92,0xA3,3}, {0xE5,0x93,0x95,3}, {0xE5,0x92,0xBB,3}, {0xE5,0x92,0xBF,3}, {0xE5,0x93,0x8C,3}, {0xE5,0x93,0x99,3},
+        {0xE5,0x93,0x9A,3}, {0xE5,0x93,0x9C,3}, {0xE5,0x92,0xA9,3}, {0xE5,0x92,0xAA,3}, {0xE5,0x92,0xA4,3}, {0xE5,0x93,0x9D,3}, {0xE5,0x93,0x8F,3}, {0xE5,0x93,0x9E,3},
+        {0xE5,0x94,0x9B,3}, {0xE5,0x93,0xA7,3}, {0xE5,0x94,0xA0,3}, {0xE5,0x93,0xBD,3}, {0xE5,0x94,0x94,3}, {0xE5,0x93,0xB3,3}, {0xE5,0x94,0xA2,3}, {0xE5,0x94,0xA3,3},
+        {0xE5,0x94,0x8F,3}, {0xE5,0x94,0x91,3}, {0xE5,0x94,0xA7,3}, {0xE5,0x94,0xAA,3}, {0xE5,0x95,0xA7,3}, {0xE5,0x96,0x8F,3}, {0xE5,0x96,0xB5,3}, {0xE5,0x95,0x89,3},
+        {0xE5,0x95,0xAD,3}, {0xE5,0x95,0x81,3}, {0xE5,0x95,0x95,3}, {0xE5,0x94,0xBF,3}, {0xE5,0x95,0x90,3}, {0xE5,0x94,0xBC,3},
+    },
+    /* 0xE0 */ {
+        {0xE9,0x83,0x82,3}, {0xE9,0x83,0x83,3}, {0xE9,0x83,0x86,3}, {0xE9,0x83,0x88,3}, {0xE9,0x83,0x89,3}, {0xE9,0x83,0x8B,3}, {0xE9,0x83,0x8C,3}, {0xE9,0x83,0x8D,3},
+        {0xE9,0x83,0x92,3}, {0xE9,0x83,0x94,3}, {0xE9,0x83,0x95,3}, {0xE9,0x83,0x96,3}, {0xE9,0x83,0x98,3}, {0xE9,0x83,0x99,3}, {0xE9,0x83,0x9A,3}, {0xE9,0x83,0x9E,3},
+        {0xE9,0x83,0x9F,3}, {0xE9,0x83,0xA0,3}, {0xE9,0x83,0xA3,3}, {0xE9,0x83,0xA4,3}, {0xE9,0x83,0xA5,3}, {0xE9,0x83,0xA9,3}, {0xE9,0x83,0xAA,3}, {0xE9,0x83,0xAC,3},
+        {0xE9,0x83,0xAE,3}, {0xE9,0x83,0xB0,3}, {0xE9,0x83,0xB1,3}, {0xE9,0x83,0xB2,3}, {0xE9,0x83,0xB3,3}, {0xE9,0x83,0xB5,3}, {0xE9,0x83,0xB6,3}, {0xE9,0x83,0xB7,3},
+        {0xE9,0x83,0xB9,3}, {0xE9,0x83,0xBA,3}, {0xE9,0x83,0xBB,3}, {0xE9,0x83,0xBC,3}, {0xE9,0x83,0xBF,3}, {0xE9,0x84,0x80,3}, {0xE9,0x84,0x81,3}, {0xE9,0x84,0x83,3},
+        {0xE9,0x84,0x85,3}, {0xE9,0x84,0x86,3}, {0xE9,0x84,0x87,3}, {0xE9,0x84,0x88,3}, {0xE9,0x84,0x89,3}, {0xE9,0x84,0x8A,3}, {0xE9,0x84,0x8B,3}, {0xE9,0x84,0x8C,3},
+        {0xE9,0x84,0x8D,3}, {0xE9,0x84,0x8E,3}, {0xE9,0x84,0x8F,3}, {0xE9,0x84,0x90,3}, {0xE9,0x84,0x91,3}, {0xE9,0x84,0x92,3}, {0xE9,0x84,0x93,3}, {0xE9,0x84,0x94,3},
+        {0xE9,0x84,0x95,3}, {0xE9,0x84,0x96,3}, {0xE9,0x84,0x97,3}, {0xE9,0x84,0x98,3}, {0xE9,0x84,0x9A,3}, {0xE9,0x84,0x9B,3}, {0xE9,0x84,0x9C,3}, {0xE9,0x84,0x9D,3},
+        {0xE9,0x84,0x9F,3}, {0xE9,0x84,0xA0,3}, {0xE9,0x84,0xA1,3}, {0xE9,0x84,0xA4,3}, {0xE9,0x84,0xA5,3}, {0xE9,0x84,0xA6,3}, {0xE9,0x84,0xA7,3}, {0xE9,0x84,0xA8,3},
+        {0xE9,0x84,0xA9,3}, {0xE9,0x84,0xAA,3}, {0xE9,0x84,0xAB,3}, {0xE9,0x84,0xAC,3}, {0xE9,0x84,0xAD,3}, {0xE9,0x84,0xAE,3}, {0xE9,0x84,0xB0,3}, {0xE9,0x84,0xB2,3},
+        {0xE9,0x84,0xB3,3}, {0xE9,0x84,0xB4,3}, {0xE9,0x84,0xB5,3}, {0xE9,0x84,0xB6,3}, {0xE9,0x84,0xB7,3}, {0xE9,0x84,0xB8,3}, {0xE9,0x84,0xBA,3}, {0xE9,0x84,0xBB,3},
+        {0xE9,0x84,0xBC,3}, {0xE9,0x84,0xBD,3}, {0xE9,0x84,0xBE,3}, {0xE9,0x84,0xBF,3}, {0xE9,0x85,0x80,3}, {0xE9,0x85,0x81,3}, {0xE9,0x85,0x82,3}, {0xE9,0x85,0x84,3},
+        {0xE5,0x94,0xB7,3}, {0xE5,0x95,0x96,3}, {0xE5,0x95,0xB5,3}, {0xE5,0x95,0xB6,3}, {0xE5,0x95,0xB7,3}, {0xE5,0x94,0xB3,3}, {0xE5,0x94,0xB0,3}, {0xE5,0x95,0x9C,3},
+        {0xE5,0x96,0x8B,3}, {0xE5,0x97,0x92,3}, {0xE5,0x96,0x83,3}, {0xE5,0x96,0xB1,3}, {0xE5,0x96,0xB9,3}, {0xE5,0x96,0x88,3}, {0xE5,0x96,0x81,3}, {0xE5,0x96,0x9F,3},
+        {0xE5,0x95,0xBE,3}, {0xE5,0x97,0x96,3}, {0xE5,0x96,0x91,3}, {0xE5,0x95,0xBB,3}, {0xE5,0x97,0x9F,3}, {0xE5,0x96,0xBD,3}, {0xE5,0x96,0xBE,3}, {0xE5,0x96,0x94,3},
+        {0xE5,0x96,0x99,3}, {0xE5,0x97,0xAA,3}, {0xE5,0x97,0xB7,3}, {0xE5,0x97,0x89,3}, {0xE5,0x98,0x9F,3}, {0xE5,0x97,0x91,3}, {0xE5,0x97,0xAB,3}, {0xE5,0x97,0xAC,3},
+        {0xE5,0x97,0x94,3}, {0xE5,0x97,0xA6,3}, {0xE5,0x97,0x9D,3}, {0xE5,0x97,0x84,3}, {0xE5,0x97,0xAF,3}, {0xE5,0x97,0xA5,3}, {0xE5,0x97,0xB2,3}, {0xE5,0x97,0xB3,3},
+        {0xE5,0x97,0x8C,3}, {0xE5,0x97,0x8D,3}, {0xE5,0x97,0xA8,3}, {0xE5,0x97,0xB5,3}, {0xE5,0x97,0xA4,3}, {0xE8,0xBE,0x94,3}, {0xE5,0x98,0x9E,3}, {0xE5,0x98,0x88,3},
+        {0xE5,0x98,0x8C,3}, {0xE5,0x98,0x81,3}, {0xE5,0x98,0xA4,3}, {0xE5,0x98,0xA3,3}, {0xE5,0x97,0xBE,3}, {0xE5,0x98,0x80,3}, {0xE5,0x98,0xA7,3}, {0xE5,0x98,0xAD,3},
+        {0xE5,0x99,0x98,3}, {0xE5,0x98,0xB9,3}, {0xE5,0x99,0x97,3}, {0xE5,0x98,0xAC,3}, {0xE5,0x99,0x8D,3}, {0xE5,0x99,0xA2,3}, {0xE5,0x99,0x99,3}, {0xE5,0x99,0x9C,3},
+        {0xE5,0x99,0x8C,3}, {0xE5,0x99,0x94,3}, {0xE5,0x9A,0x86,3}, {0xE5,0x99,0xA4,3}, {0xE5,0x99,0xB1,3}, {0xE5,0x99,0xAB,3}, {0xE5,0x99,0xBB,3}, {0xE5,0x99,0xBC,3},
+        {0xE5,0x9A,0x85,3}, {0xE5,0x9A,0x93,3}, {0xE5,0x9A,0xAF,3}, {0xE5,0x9B,0x94,3}, {0xE5,0x9B,0x97,3}, {0xE5,0x9B,0x9D,3}, {0xE5,0x9B,0xA1,3}, {0xE5,0x9B,0xB5,3},
+        {0xE5,0x9B,0xAB,3}, {0xE5,0x9B,0xB9,3}, {0xE5,0x9B,0xBF,3}, {0xE5,0x9C,0x84,3}, {0xE5,0x9C,0x8A,3}, {0xE5,0x9C,0x89,3}, {0xE5,0x9C,0x9C,3}, {0xE5,0xB8,0x8F,3},
+        {0xE5,0xB8,0x99,3}, {0xE5,0xB8,0x94,3}, {0xE5,0xB8,0x91,3}, {0xE5,0xB8,0xB1,3}, {0xE5,0xB8,0xBB,3}, {0xE5,0xB8,0xBC,3},
+    },
+    /* 0xE1 */ {
+        {0xE9,0x85,0x85,3}, {0xE9,0x85,0x87,3}, {0xE9,0x85,0x88,3}, {0xE9,0x85,0x91,3}, {0xE9,0x85,0x93,3}, {0xE9,0x85,0x94,3}, {0xE9,0x85,0x95,3}, {0xE9,0x85,0x96,3},
+        {0xE9,0x85,0x98,3}, {0xE9,0x85,0x99,3}, {0xE9,0x85,0x9B,3}, {0xE9,0x85,0x9C,3}, {0xE9,0x85,0x9F,3}, {0xE9,0x85,0xA0,3}, {0xE9,0x85,0xA6,3}, {0xE9,0x85,0xA7,3},
+        {0xE9,0x85,0xA8,3}, {0xE9,0x85,0xAB,3}, {0xE9,0x85,0xAD,3}, {0xE9,0x85,0xB3,3}, {0xE9,0x85,0xBA,3}, {0xE9,0x85,0xBB,3}, {0xE9,0x85,0xBC,3}, {0xE9,0x86,0x80,3},
+        {0xE9,0x86,0x81,3}, {0xE9,0x86,0x82,3}, {0xE9,0x86,0x83,3}, {0xE9,0x86,0x84,3}, {0xE9,0x86,0x86,3}, {0xE9,0x86,0x88,3}, {0xE9,0x86,0x8A,3}, {0xE9,0x86,0x8E,3},
+        {0xE9,0x86,0x8F,3}, {0xE9,0x86,0x93,3}, {0xE9,0x86,0x94,3}, {0xE9,0x86,0x95,3}, {0xE9,0x86,0x96,3}, {0xE9,0x86,0x97,3}, {0xE9,0x86,0x98,3}, {0xE9,0x86,0x99,3},
+        {0xE9,0x86,0x9C,3}, {0xE9,0x86,0x9D,3}, {0xE9,0x86,0x9E,3}, {0xE9,0x86,0x9F,3}, {0xE9,0x86,0xA0,3}, {0xE9,0x86,0xA1,3}, {0xE9,0x86,0xA4,3}, {0xE9,0x86,0xA5,3},
+        {0xE9,0x86,0xA6,3}, {0xE9,0x86,0xA7,3}, {0xE9,0x86,0xA8,3}, {0xE9,0x86,0xA9,3}, {0xE9,0x86,0xAB,3}, {0xE9,0x86,0xAC,3}, {0xE9,0x86,0xB0,3}, {0xE9,0x86,0xB1,3},
+        {0xE9,0x86,0xB2,3}, {0xE9,0x86,0xB3,3}, {0xE9,0x86,0xB6,3}, {0xE9,0x86,0xB7,3}, {0xE9,0x86,0xB8,3}, {0xE9,0x86,0xB9,3}, {0xE9,0x86,0xBB,3}, {0xE9,0x86,0xBC,3},
+        {0xE9,0x86,0xBD,3}, {0xE9,0x86,0xBE,3}, {0xE9,0x86,0xBF,3}, {0xE9,0x87,0x80,3}, {0xE9,0x87,0x81,3}, {0xE9,0x87,0x82,3}, {0xE9,0x87,0x83,3}, {0xE9,0x87,0x84,3},
+        {0xE9,0x87,0x85,3}, {0xE9,0x87,0x86,3}, {0xE9,0x87,0x88,3}, {0xE9,0x87,0x8B,3}, {0xE9,0x87,0x90,3}, {0xE9,0x87,0x92,3}, {0xE9,0x87,0x93,3}, {0xE9,0x87,0x94,3},
+        {0xE9,0x87,0x95,3}, {0xE9,0x87,0x96,3}, {0xE9,0x87,0x97,3}, {0xE9,0x87,0x98,3}, {0xE9,0x87,0x99,3}, {0xE9,0x87,0x9A,3}, {0xE9,0x87,0x9B,3}, {0xE9,0x87,0x9D,3},
+        {0xE9,0x87,0x9E,3}, {0xE9,0x87,0x9F,3}, {0xE9,0x87,0xA0,3}, {0xE9,0x87,0xA1,3}, {0xE9,0x87,0xA2,3}, {0xE9,0x87,0xA3,3}, {0xE9,0x87,0xA4,3}, {0xE9,0x87,0xA5,3},
+        {0xE5,0xB8,0xB7,3}, {0xE5,0xB9,0x84,3}, {0xE5,0xB9,0x94,3}, {0xE5,0xB9,0x9B,3}, {0xE5,0xB9,0x9E,3}, {0xE5,0xB9,0xA1,3}, {0xE5,0xB2,0x8C,3}, {0xE5,0xB1,0xBA,3},
+        {0xE5,0xB2,0x8D,3}, {0xE5,0xB2,0x90,3}, {0xE5,0xB2,0x96,3}, {0xE5,0xB2,0x88,3}, {0xE5,0xB2,0x98,3}, {0xE5,0xB2,0x99,3}, {0xE5,0xB2,0x91,3}, {0xE5,0xB2,0x9A,3},
+        {0xE5,0xB2,0x9C,3}, {0xE5,0xB2,0xB5,3}, {0xE5,0xB2,0xA2,3}, {0xE5,0xB2,0xBD,3}, {0xE5,0xB2,0xAC,3}, {0xE5,0xB2,0xAB,3}, {0xE5,0xB2,0xB1,3}, {0xE5,0xB2,0xA3,3},
+        {0xE5,0xB3,0x81,3}, {0xE5,0xB2,0xB7,3}, {0xE5,0xB3,0x84,3}, {0xE5,0xB3,0x92,3}, {0xE5,0xB3,0xA4,3}, {0xE5,0xB3,0x8B,3}, {0xE5,0xB3,0xA5,3}, {0xE5,0xB4,0x82,3},
+        {0xE5,0xB4,0x83,3}, {0xE5,0xB4,0xA7,3}, {0xE5,0xB4,0xA6,3}, {0xE5,0xB4,0xAE,3}, {0xE5,0xB4,0xA4,3}, {0xE5,0xB4,0x9E,3}, {0xE5,0xB4,0x86,3}, {0xE5,0xB4,0x9B,3},
+        {0xE5,0xB5,0x98,3}, {0xE5,0xB4,0xBE,3}, {0xE5,0xB4,0xB4,3}, {0xE5,0xB4,0xBD,3}, {0xE5,0xB5,0xAC,3}, {0xE5,0xB5,0x9B,3}, {0xE5,0xB5,0xAF,3}, {0xE5,0xB5,0x9D,3},
+        {0xE5,0xB5,0xAB,3}, {0xE5,0xB5,0x8B,3}, {0xE5,0xB5,0x8A,3}, {0xE5,0xB5,0xA9,3}, {0xE5,0xB5,0xB4,3}, {0xE5,0xB6,0x82,3}, {0xE5,0xB6,0x99,3}, {0xE5,0xB6,0x9D,3},
+        {0xE8,0xB1,0xB3,3}, {0xE5,0xB6,0xB7,3}, {0xE5,0xB7,0x85,3}, {0xE5,0xBD,0xB3,3}, {0xE5,0xBD,0xB7,3}, {0xE5,0xBE,0x82,3}, {0xE5,0xBE,0x87,3}, {0xE5,0xBE,0x89,3},
+        {0xE5,0xBE,0x8C,3}, {0xE5,0xBE,0x95,3}, {0xE5,0xBE,0x99,3}, {0xE5,0xBE,0x9C,3}, {0xE5,0xBE,0xA8,3}, {0xE5,0xBE,0xAD,3}, {0xE5,0xBE,0xB5,3}, {0xE5,0xBE,0xBC,3},
+        {0xE8,0xA1,0xA2,3}, {0xE5,0xBD,0xA1,3}, {0xE7,0x8A,0xAD,3}, {0xE7,0x8A,0xB0,3}, {0xE7,0x8A,0xB4,3}, {0xE7,0x8A,0xB7,3}, {0xE7,0x8A,0xB8,3}, {0xE7,0x8B,0x83,3},
+        {0xE7,0x8B,0x81,3}, {0xE7,0x8B,0x8E,3}, {0xE7,0x8B,0x8D,3}, {0xE7,0x8B,0x92,3}, {0xE7,0x8B,0xA8,3}, {0xE7,0x8B,0xAF,3}, {0xE7,0x8B,0xA9,3}, {0xE7,0x8B,0xB2,3},
+        {0xE7,0x8B,0xB4,3}, {0xE7,0x8B,0xB7,3}, {0xE7,0x8C,0x81,3}, {0xE7,0x8B,0xB3,3}, {0xE7,0x8C,0x83,3}, {0xE7,0x8B,0xBA,3},
+    },
+    /* 0xE2 */ {
+        {0xE9,0x87,0xA6,3}, {0xE9,0x87,0xA7,3}, {0xE9,0x87,0xA8,3}, {0xE9,0x87,0xA9,3}, {0xE9,0x87,0xAA,3}, {0xE9,0x87,0xAB,3}, {0xE9,0x87,0xAC,3}, {0xE9,0x87,0xAD,3},
+        {0xE9,0x87,0xAE,3}, {0xE9,0x87,0xAF,3}, {0xE9,0x87,0xB0,3}, {0xE9,0x87,0xB1,3}, {0xE9,0x87,0xB2,3}, {0xE9,0x87,0xB3,3}, {0xE9,0x87,0xB4,3}, {0xE9,0x87,0xB5,3},
+        {0xE9,0x87,0xB6,3}, {0xE9,0x87,0xB7,3}, {0xE9,0x87,0xB8,3}, {0xE9,0x87,0xB9,3}, {0xE9,0x87,0xBA,3}, {0xE9,0x87,0xBB,3}, {0xE9,0x87,0xBC,3}, {0xE9,0x87,0xBD,3},
+        {0xE9,0x87,0xBE,3}, {0xE9,0x87,0xBF,3}, {0xE9,0x88,0x80,3}, {0xE9,0x88,0x81,3}, {0xE9,0x88,0x82,3}, {0xE9,0x88,0x83,3}, {0xE9,0x88,0x84,3}, {0xE9,0x88,0x85,3},
+        {0xE9,0x88,0x86,3}, {0xE9,0x88,0x87,3}, {0xE9,0x88,0x88,3}, {0xE9,0x88,0x89,3}, {0xE9,0x88,0x8A,3}, {0xE9,0x88,0x8B,3}, {0xE9,0x88,0x8C,3}, {0xE9,0x88,0x8D,3},
+        {0xE9,0x88,0x8E,3}, {0xE9,0x88,0x8F,3}, {0xE9,0x88,0x90,3}, {0xE9,0x88,0x91,3}, {0xE9,0x88,0x92,3}, {0xE9,0x88,0x93,3}, {0xE9,0x88,0x94,3}, {0xE9,0x88,0x95,3},
+        {0xE9,0x88,0x96,3}, {0xE9,0x88,0x97,3}, {0xE9,0x88,0x98,3}, {0xE9,0x88,0x99,3}, {0xE9,0x88,0x9A,3}, {0xE9,0x88,0x9B,3}, {0xE9,0x88,0x9C,3}, {0xE9,0x88,0x9D,3},
+        {0xE9,0x88,0x9E,3}, {0xE9,0x88,0x9F,3}, {0xE9,0x88,0xA0,3}, {0xE9,0x88,0xA1,3}, {0xE9,0x88,0xA2,3}, {0xE9,0x88,0xA3,3}, {0xE9,0x88,0xA4,3}, {0xE9,0x88,0xA5,3},
+        {0xE9,0x88,0xA6,3}, {0xE9,0x88,0xA7,3}, {0xE9,0x88,0xA8,3}, {0xE9,0x88,0xA9,3}, {0xE9,0x88,0xAA,3}, {0xE9,0x88,0xAB,3}, {0xE9,0x88,0xAC,3}, {0xE9,0x88,0xAD,3},
+        {0xE9,0x88,0xAE,3}, {0xE9,0x88,0xAF,3}, {0xE9,0x88,0xB0,3}, {0xE9,0x88,0xB1,3}, {0xE9,0x88,0xB2,3}, {0xE9,0x88,0xB3,3}, {0xE9,0x88,0xB4,3}, {0xE9,0x88,0xB5,3},
+        {0xE9,0x88,0xB6,3}, {0xE9,0x88,0xB7,3}, {0xE9,0x88,0xB8,3}, {0xE9,0x88,0xB9,3}, {0xE9,0x88,0xBA,3}, {0xE9,0x88,0xBB,3}, {0xE9,0x88,0xBC,3}, {0xE9,0x88,0xBD,3},
+        {0xE9,0x88,0xBE,3}, {0xE9,0x88,0xBF,3}, {0xE9,0x89,0x80,3}, {0xE9,0x89,0x81,3}, {0xE9,0x89,0x82,3}, {0xE9,0x89,0x83,3}, {0xE9,0x89,0x84,3}, {0xE9,0x89,0x85,3},
+        {0xE7,0x8B,0xBB,3}, {0xE7,0x8C,0x97,3}, {0xE7,0x8C,0x93,3}, {0xE7,0x8C,0xA1,3}, {0xE7,0x8C,0x8A,3}, {0xE7,0x8C,0x9E,3}, {0xE7,0x8C,0x9D,3}, {0xE7,0x8C,0x95,3},
+        {0xE7,0x8C,0xA2,3}, {0xE7,0x8C,0xB9,3}, {0xE7,0x8C,0xA5,3}, {0xE7,0x8C,0xAC,3}, {0xE7,0x8C,0xB8,3}, {0xE7,0x8C,0xB1,3}, {0xE7,0x8D,0x90,3}, {0xE7,0x8D,0x8D,3},
+        {0xE7,0x8D,0x97,3}, {0xE7,0x8D,0xA0,3}, {0xE7,0x8D,0xAC,3}, {0xE7,0x8D,0xAF,3}, {0xE7,0x8D,0xBE,3}, {0xE8,0x88,0x9B,3}, {0xE5,0xA4,0xA5,3}, {0xE9,0xA3,0xA7,3},
+        {0xE5,0xA4,0xA4,3}, {0xE5,0xA4,0x82,3}, {0xE9,0xA5,0xA3,3}, {0xE9,0xA5,0xA7,3}, {0xE9,0xA5,0xA8,3}, {0xE9,0xA5,0xA9,3}, {0xE9,0xA5,0xAA,3}, {0xE9,0xA5,0xAB,3},
+        {0xE9,0xA5,0xAC,3}, {0xE9,0xA5,0xB4,3}, {0xE9,0xA5,0xB7,3}, {0xE9,0xA5,0xBD,3}, {0xE9,0xA6,0x80,3}, {0xE9,0xA6,0x84,3}, {0xE9,0xA6,0x87,3}, {0xE9,0xA6,0x8A,3},
+        {0xE9,0xA6,0x8D,3}, {0xE9,0xA6,0x90,3}, {0xE9,0xA6,0x91,3}, {0xE9,0xA6,0x93,3}, {0xE9,0xA6,0x94,3}, {0xE9,0xA6,0x95,3}, {0xE5,0xBA,0x80,3}, {0xE5,0xBA,0x91,3},
+        {0xE5,0xBA,0x8B,3}, {0xE5,0xBA,0x96,3}, {0xE5,0xBA,0xA5,3}, {0xE5,0xBA,0xA0,3}, {0xE5,0xBA,0xB9,3}, {0xE5,0xBA,0xB5,3}, {0xE5,0xBA,0xBE,3}, {0xE5,0xBA,0xB3,3},
+        {0xE8,0xB5,0x93,3}, {0xE5,0xBB,0x92,3}, {0xE5,0xBB,0x91,3}, {0xE5,0xBB,0x9B,3}, {0xE5,0xBB,0xA8,3}, {0xE5,0xBB,0xAA,3}, {0xE8,0x86,0xBA,3}, {0xE5,0xBF,0x84,3},
+        {0xE5,0xBF,0x89,3}, {0xE5,0xBF,0x96,3}, {0xE5,0xBF,0x8F,3}, {0xE6,0x80,0x83,3}, {0xE5,0xBF,0xAE,3}, {0xE6,0x80,0x84,3}, {0xE5,0xBF,0xA1,3}, {0xE5,0xBF,0xA4,3},
+        {0xE5,0xBF,0xBE,3}, {0xE6,0x80,0x85,3}, {0xE6,0x80,0x86,3}, {0xE5,0xBF,0xAA,3}, {0xE5,0xBF,0xAD,3}, {0xE5,0xBF,0xB8,3}, {0xE6,0x80,0x99,3}, {0xE6,0x80,0xB5,3},
+        {0xE6,0x80,0xA6,3}, {0xE6,0x80,0x9B,3}, {0xE6,0x80,0x8F,3}, {0xE6,0x80,0x8D,3}, {0xE6,0x80,0xA9,3}, {0xE6,0x80,0xAB,3}, {0xE6,0x80,0x8A,3}, {0xE6,0x80,0xBF,3},
+        {0xE6,0x80,0xA1,3}, {0xE6,0x81,0xB8,3}, {0xE6,0x81,0xB9,3}, {0xE6,0x81,0xBB,3}, {0xE6,0x81,0xBA,3}, {0xE6,0x81,0x82,3},
+    },
+    /* 0xE3 */ {
+        {0xE9,0x89,0x86,3}, {0xE9,0x89,0x87,3}, {0xE9,0x89,0x88,3}, {0xE9,0x89,0x89,3}, {0xE9,0x89,0x8A,3}, {0xE9,0x89,0x8B,3}, {0xE9,0x89,0x8C,3}, {0xE9,0x89,0x8D,3},
+        {0xE9,0x89,0x8E,3}, {0xE9,0x89,0x8F,3}, {0xE9,0x89,0x90,3}, {0xE9,0x89,0x91,3}, {0xE9,0x89,0x92,3}, {0xE9,0x89,0x93,3}, {0xE9,0x89,0x94,3}, {0xE9,0x89,0x95,3},
+        {0xE9,0x89,0x96,3}, {0xE9,0x89,0x97,3}, {0xE9,0x89,0x98,3}, {0xE9,0x89,0x99,3}, {0xE9,0x89,0x9A,3}, {0xE9,0x89,0x9B,3}, {0xE9,0x89,0x9C,3}, {0xE9,0x89,0x9D,3},
+        {0xE9,0x89,0x9E,3}, {0xE9,0x89,0x9F,3}, {0xE9,0x89,0xA0,3}, {0xE9,0x89,0xA1,3}, {0xE9,0x89,0xA2,3}, {0xE9,0x89,0xA3,3}, {0xE9,0x89,0xA4,3}, {0xE9,0x89,0xA5,3},
+        {0xE9,0x89,0xA6,3}, {0xE9,0x89,0xA7,3}, {0xE9,0x89,0xA8,3}, {0xE9,0x89,0xA9,3}, {0xE9,0x89,0xAA,3}, {0xE9,0x89,0xAB,3}, {0xE9,0x89,0xAC,3}, {0xE9,0x89,0xAD,3},
+        {0xE9,0x89,0xAE,3}, {0xE9,0x89,0xAF,3}, {0xE9,0x89,0xB0,3}, {0xE9,0x89,0xB1,3}, {0xE9,0x89,0xB2,3}, {0xE9,0x89,0xB3,3}, {0xE9,0x89,0xB5,3}, {0xE9,0x89,0xB6,3},
+        {0xE9,0x89,0xB7,3}, {0xE9,0x89,0xB8,3}, {0xE9,0x89,0xB9,3}, {0xE9,0x89,0xBA,3}, {0xE9,0x89,0xBB,3}, {0xE9,0x89,0xBC,3}, {0xE9,0x89,0xBD,3}, {0xE9,0x89,0xBE,3},
+        {0xE9,0x89,0xBF,3}, {0xE9,0x8A,0x80,3}, {0xE9,0x8A,0x81,3}, {0xE9,0x8A,0x82,3}, {0xE9,0x8A,0x83,3}, {0xE9,0x8A,0x84,3}, {0xE9,0x8A,0x85,3}, {0xE9,0x8A,0x86,3},
+        {0xE9,0x8A,0x87,3}, {0xE9,0x8A,0x88,3}, {0xE9,0x8A,0x89,3}, {0xE9,0x8A,0x8A,3}, {0xE9,0x8A,0x8B,3}, {0xE9,0x8A,0x8C,3}, {0xE9,0x8A,0x8D,3}, {0xE9,0x8A,0x8F,3},
+        {0xE9,0x8A,0x90,3}, {0xE9,0x8A,0x91,3}, {0xE9,0x8A,0x92,3}, {0xE9,0x8A,0x93,3}, {0xE9,0x8A,0x94,3}, {0xE9,0x8A,0x95,3}, {0xE9,0x8A,0x96,3}, {0xE9,0x8A,0x97,3},
+        {0xE9,0x8A,0x98,3}, {0xE9,0x8A,0x99,3}, {0xE9,0x8A,0x9A,3}, {0xE9,0x8A,0x9B,3}, {0xE9,0x8A,0x9C,3}, {0xE9,0x8A,0x9D,3}, {0xE9,0x8A,0x9E,3}, {0xE9,0x8A,0x9F,3},
+        {0xE9,0x8A,0xA0,3}, {0xE9,0x8A,0xA1,3}, {0xE9,0x8A,0xA2,3}, {0xE9,0x8A,0xA3,3}, {0xE9,0x8A,0xA4,3}, {0xE9,0x8A,0xA5,3}, {0xE9,0x8A,0xA6,3}, {0xE9,0x8A,0xA7,3},
+        {0xE6,0x81,0xAA,3}, {0xE6,0x81,0xBD,3}, {0xE6,0x82,0x96,3}, {0xE6,0x82,0x9A,3}, {0xE6,0x82,0xAD,3}, {0xE6,0x82,0x9D,3}, {0xE6,0x82,0x83,3}, {0xE6,0x82,0x92,3},
+        {0xE6,0x82,0x8C,3}, {0xE6,0x82,0x9B,3}, {0xE6,0x83,0xAC,3}, {0xE6,0x82,0xBB,3}, {0xE6,0x82,0xB1,3}, {0xE6,0x83,0x9D,3}, {0xE6,0x83,0x98,3}, {0xE6,0x83,0x86,3},
+        {0xE6,0x83,0x9A,3}, {0xE6,0x82,0xB4,3}, {0xE6,0x84,0xA0,3}, {0xE6,0x84,0xA6,3}, {0xE6,0x84,0x95,3}, {0xE6,0x84,0xA3,3}, {0xE6,0x83,0xB4,3}, {0xE6,0x84,0x80,3},
+        {0xE6,0x84,0x8E,3}, {0xE6,0x84,0xAB,3}, {0xE6,0x85,0x8A,3}, {0xE6,0x85,0xB5,3}, {0xE6,0x86,0xAC,3}, {0xE6,0x86,0x94,3}, {0xE6,0x86,0xA7,3}, {0xE6,0x86,0xB7,3},
+        {0xE6,0x87,0x94,3}, {0xE6,0x87,0xB5,3}, {0xE5,0xBF,0x9D,3}, {0xE9,0x9A,0xB3,3}, {0xE9,0x97,0xA9,3}, {0xE9,0x97,0xAB,3}, {0xE9,0x97,0xB1,3}, {0xE9,0x97,0xB3,3},
+        {0xE9,0x97,0xB5,3}, {0xE9,0x97,0xB6,3}, {0xE9,0x97,0xBC,3}, {0xE9,0x97,0xBE,3}, {0xE9,0x98,0x83,3}, {0xE9,0x98,0x84,3}, {0xE9,0x98,0x86,3}, {0xE9,0x98,0x88,3},
+        {0xE9,0x98,0x8A,3}, {0xE9,0x98,0x8B,3}, {0xE9,0x98,0x8C,3}, {0xE9,0x98,0x8D,3}, {0xE9,0x98,0x8F,3}, {0xE9,0x98,0x92,3}, {0xE9,0x98,0x95,3}, {0xE9,0x98,0x96,3},
+        {0xE9,0x98,0x97,3}, {0xE9,0x98,0x99,3}, {0xE9,0x98,0x9A,3}, {0xE4,0xB8,0xAC,3}, {0xE7,0x88,0xBF,3}, {0xE6,0x88,0x95,3}, {0xE6,0xB0,0xB5,3}, {0xE6,0xB1,0x94,3},
+        {0xE6,0xB1,0x9C,3}, {0xE6,0xB1,0x8A,3}, {0xE6,0xB2,0xA3,3}, {0xE6,0xB2,0x85,3}, {0xE6,0xB2,0x90,3}, {0xE6,0xB2,0x94,3}, {0xE6,0xB2,0x8C,3}, {0xE6,0xB1,0xA8,3},
+        {0xE6,0xB1,0xA9,3}, {0xE6,0xB1,0xB4,3}, {0xE6,0xB1,0xB6,3}, {0xE6,0xB2,0x86,3}, {0xE6,0xB2,0xA9,3}, {0xE6,0xB3,0x90,3}, {0xE6,0xB3,0x94,3}, {0xE6,0xB2,0xAD,3},
+        {0xE6,0xB3,0xB7,3}, {0xE6,0xB3,0xB8,3}, {0xE6,0xB3,0xB1,3}, {0xE6,0xB3,0x97,3}, {0xE6,0xB2,0xB2,3}, {0xE6,0xB3,0xA0,3}, {0xE6,0xB3,0x96,3}, {0xE6,0xB3,0xBA,3},
+        {0xE6,0xB3,0xAB,3}, {0xE6,0xB3,0xAE,3}, {0xE6,0xB2,0xB1,3}, {0xE6,0xB3,0x93,3}, {0xE6,0xB3,0xAF,3}, {0xE6,0xB3,0xBE,3},
+    },
+    /* 0xE4 */ {
+        {0xE9,0x8A,0xA8,3}, {0xE9,0x8A,0xA9,3}, {0xE9,0x8A,0xAA,3}, {0xE9,0x8A,0xAB,3}, {0xE9,0x8A,0xAC,3}, {0xE9,0x8A,0xAD,3}, {0xE9,0x8A,0xAF,3}, {0xE9,0x8A,0xB0,3},
+        {0xE9,0x8A,0xB1,3}, {0xE9,0x8A,0xB2,3}, {0xE9,0x8A,0xB3,3}, {0xE9,0x8A,0xB4,3}, {0xE9,0x8A,0xB5,3}, {0xE9,0x8A,0xB6,3}, {0xE9,0x8A,0xB7,3}, {0xE9,0x8A,0xB8,3},
+        {0xE9,0x8A,0xB9,3}, {0xE9,0x8A,0xBA,3}, {0xE9,0x8A,0xBB,3}, {0xE9,0x8A,0xBC,3}, {0xE9,0x8A,0xBD,3}, {0xE9,0x8A,0xBE,3}, {0xE9,0x8A,0xBF,3}, {0xE9,0x8B,0x80,3},
+        {0xE9,0x8B,0x81,3}, {0xE9,0x8B,0x82,3}, {0xE9,0x8B,0x83,3}, {0xE9,0x8B,0x84,3}, {0xE9,0x8B,0x85,3}, {0xE9,0x8B,0x86,3}, {0xE9,0x8B,0x87,3}, {0xE9,0x8B,0x89,3},
+        {0xE9,0x8B,0x8A,3}, {0xE9,0x8B,0x8B,3}, {0xE9,0x8B,0x8C,3}, {0xE9,0x8B,0x8D,3}, {0xE9,0x8B,0x8E,3}, {0xE9,0x8B,0x8F,3}, {0xE9,0x8B,0x90,3}, {0xE9,0x8B,0x91,3},
+        {0xE9,0x8B,0x92,3}, {0xE9,0x8B,0x93,3}, {0xE9,0x8B,0x94,3}, {0xE9,0x8B,0x95,3}, {0xE9,0x8B,0x96,3}, {0xE9,0x8B,0x97,3}, {0xE9,0x8B,0x98,3}, {0xE9,0x8B,0x99,3},
+        {0xE9,0x8B,0x9A,3}, {0xE9,0x8B,0x9B,3}, {0xE9,0x8B,0x9C,3}, {0xE9,0x8B,0x9D,3}, {0xE9,0x8B,0x9E,3}, {0xE9,0x8B,0x9F,3}, {0xE9,0x8B,0xA0,3}, {0xE9,0x8B,0xA1,3},
+        {0xE9,0x8B,0xA2,3}, {0xE9,0x8B,0xA3,3}, {0xE9,0x8B,0xA4,3}, {0xE9,0x8B,0xA5,3}, {0xE9,0x8B,0xA6,3}, {0xE9,0x8B,0xA7,3}, {0xE9,0x8B,0xA8,3}, {0xE9,0x8B,0xA9,3},
+        {0xE9,0x8B,0xAA,3}, {0xE9,0x8B,0xAB,3}, {0xE9,0x8B,0xAC,3}, {0xE9,0x8B,0xAD,3}, {0xE9,0x8B,0xAE,3}, {0xE9,0x8B,0xAF,3}, {0xE9,0x8B,0xB0,3}, {0xE9,0x8B,0xB1,3},
+        {0xE9,0x8B,0xB2,3}, {0xE9,0x8B,0xB3,3}, {0xE9,0x8B,0xB4,3}, {0xE9,0x8B,0xB5,3}, {0xE9,0x8B,0xB6,3}, {0xE9,0x8B,0xB7,3}, {0xE9,0x8B,0xB8,3}, {0xE9,0x8B,0xB9,3},
+        {0xE9,0x8B,0xBA,3}, {0xE9,0x8B,0xBB,3}, {0xE9,0x8B,0xBC,3}, {0xE9,0x8B,0xBD,3}, {0xE9,0x8B,0xBE,3}, {0xE9,0x8B,0xBF,3}, {0xE9,0x8C,0x80,3}, {0xE9,0x8C,0x81,3},
+        {0xE9,0x8C,0x82,3}, {0xE9,0x8C,0x83,3}, {0xE9,0x8C,0x84,3}, {0xE9,0x8C,0x85,3}, {0xE9,0x8C,0x86,3}, {0xE9,0x8C,0x87,3}, {0xE9,0x8C,0x88,3}, {0xE9,0x8C,0x89,3},
+        {0xE6,0xB4,0xB9,3}, {0xE6,0xB4,0xA7,3}, {0xE6,0xB4,0x8C,3}, {0xE6,0xB5,0x83,3}, {0xE6,0xB5,0x88,3}, {0xE6,0xB4,0x87,3}, {0xE6,0xB4,0x84,3}, {0xE6,0xB4,0x99,3},
+        {0xE6,0xB4,0x8E,3}, {0xE6,0xB4,0xAB,3}, {0xE6,0xB5,0x8D,3}, {0xE6,0xB4,0xAE,3}, {0xE6,0xB4,0xB5,3}, {0xE6,0xB4,0x9A,3}, {0xE6,0xB5,0x8F,3}, {0xE6,0xB5,0x92,3},
+        {0xE6,0xB5,0x94,3}, {0xE6,0xB4,0xB3,3}, {0xE6,0xB6,0x91,3}, {0xE6,0xB5,0xAF,3}, {0xE6,0xB6,0x9E,3}, {0xE6,0xB6,0xA0,3}, {0xE6,0xB5,0x9E,3}, {0xE6,0xB6,0x93,3},
+        {0xE6,0xB6,0x94,3}, {0xE6,0xB5,0x9C,3}, {0xE6,0xB5,0xA0,3}, {0xE6,0xB5,0xBC,3}, {0xE6,0xB5,0xA3,3}, {0xE6,0xB8,0x9A,3}, {0xE6,0xB7,0x87,3}, {0xE6,0xB7,0x85,3},
+        {0xE6,0xB7,0x9E,3}, {0xE6,0xB8,0x8E,3}, {0xE6,0xB6,0xBF,3}, {0xE6,0xB7,0xA0,3}, {0xE6,0xB8,0x91,3}, {0xE6,0xB7,0xA6,3}, {0xE6,0xB7,0x9D,3}, {0xE6,0xB7,0x99,3},
+        {0xE6,0xB8,0x96,3}, {0xE6,0xB6,0xAB,3}, {0xE6,0xB8,0x8C,3}, {0xE6,0xB6,0xAE,3}, {0xE6,0xB8,0xAB,3}, {0xE6,0xB9,0xAE,3}, {0xE6,0xB9,0x8E,3}, {0xE6,0xB9,0xAB,3},
+        {0xE6,0xBA,0xB2,3}, {0xE6,0xB9,0x9F,3}, {0xE6,0xBA,0x86,3}, {0xE6,0xB9,0x93,3}, {0xE6,0xB9,0x94,3}, {0xE6,0xB8,0xB2,3}, {0xE6,0xB8,0xA5,3}, {0xE6,0xB9,0x84,3},
+        {0xE6,0xBB,0x9F,3}, {0xE6,0xBA,0xB1,3}, {0xE6,0xBA,0x98,3}, {0xE6,0xBB,0xA0,3}, {0xE6,0xBC,0xAD,3}, {0xE6,0xBB,0xA2,3}, {0xE6,0xBA,0xA5,3}, {0xE6,0xBA,0xA7,3},
+        {0xE6,0xBA,0xBD,3}, {0xE6,0xBA,0xBB,3}, {0xE6,0xBA,0xB7,3}, {0xE6,0xBB,0x97,3}, {0xE6,0xBA,0xB4,3}, {0xE6,0xBB,0x8F,3}, {0xE6,0xBA,0x8F,3}, {0xE6,0xBB,0x82,3},
+        {0xE6,0xBA,0x9F,3}, {0xE6,0xBD,0xA2,3}, {0xE6,0xBD,0x86,3}, {0xE6,0xBD,0x87,3}, {0xE6,0xBC,0xA4,3}, {0xE6,0xBC,0x95,3}, {0xE6,0xBB,0xB9,3}, {0xE6,0xBC,0xAF,3},
+        {0xE6,0xBC,0xB6,3}, {0xE6,0xBD,0x8B,3}, {0xE6,0xBD,0xB4,3}, {0xE6,0xBC,0xAA,3}, {0xE6,0xBC,0x89,3}, {0xE6,0xBC,0xA9,3}, {0xE6,0xBE,0x89,3}, {0xE6,0xBE,0x8D,3},
+        {0xE6,0xBE,0x8C,3}, {0xE6,0xBD,0xB8,3}, {0xE6,0xBD,0xB2,3}, {0xE6,0xBD,0xBC,3}, {0xE6,0xBD,0xBA,3}, {0xE6,0xBF,0x91,3},
+    },
+    /* 0xE5 */ {
+        {0xE9,0x8C,0x8A,3}, {0xE9,0x8C,0x8B,3}, {0xE9,0x8C,0x8C,3}, {0xE9,0x8C,0x8D,3}, {0xE9,0x8C,0x8E,3}, {0xE9,0x8C,0x8F,3}, {0xE9,0x8C,0x90,3}, {0xE9,0x8C,0x91,3},
+        {0xE9,0x8C,0x92,3}, {0xE9,0x8C,0x93,3}, {0xE9,0x8C,0x94,3}, {0xE9,0x8C,0x95,3}, {0xE9,0x8C,0x96,3}, {0xE9,0x8C,0x97,3}, {0xE9,0x8C,0x98,3}, {0xE9,0x8C,0x99,3},
+        {0xE9,0x8C,0x9A,3}, {0xE9,0x8C,0x9B,3}, {0xE9,0x8C,0x9C,3}, {0xE9,0x8C,0x9D,3}, {0xE9,0x8C,0x9E,3}, {0xE9,0x8C,0x9F,3}, {0xE9,0x8C,0xA0,3}, {0xE9,0x8C,0xA1,3},
+        {0xE9,0x8C,0xA2,3}, {0xE9,0x8C,0xA3,3}, {0xE9,0x8C,0xA4,3}, {0xE9,0x8C,0xA5,3}, {0xE9,0x8C,0xA6,3}, {0xE9,0x8C,0xA7,3}, {0xE9,0x8C,0xA8,3}, {0xE9,0x8C,0xA9,3},
+        {0xE9,0x8C,0xAA,3}, {0xE9,0x8C,0xAB,3}, {0xE9,0x8C,0xAC,3}, {0xE9,0x8C,0xAD,3}, {0xE9,0x8C,0xAE,3}, {0xE9,0x8C,0xAF,3}, {0xE9,0x8C,0xB0,3}, {0xE9,0x8C,0xB1,3},
+        {0xE9,0x8C,0xB2,3}, {0xE9,0x8C,0xB3,3}, {0xE9,0x8C,0xB4,3}, {0xE9,0x8C,0xB5,3}, {0xE9,0x8C,0xB6,3}, {0xE9,0x8C,0xB7,3}, {0xE9,0x8C,0xB8,3}, {0xE9,0x8C,0xB9,3},
+        {0xE9,0x8C,0xBA,3}, {0xE9,0x8C,0xBB,3}, {0xE9,0x8C,0xBC,3}, {0xE9,0x8C,0xBD,3}, {0xE9,0x8C,0xBF,3}, {0xE9,0x8D,0x80,3}, {0xE9,0x8D,0x81,3}, {0xE9,0x8D,0x82,3},
+        {0xE9,0x8D,0x83,3}, {0xE9,0x8D,0x84,3}, {0xE9,0x8D,0x85,3}, {0xE9,0x8D,0x86,3}, {0xE9,0x8D,0x87,3}, {0xE9,0x8D,0x88,3}, {0xE9,0x8D,0x89,3}, {0xE9,0x8D,0x8A,3},
+        {0xE9,0x8D,0x8B,3}, {0xE9,0x8D,0x8C,3}, {0xE9,0x8D,0x8D,3}, {0xE9,0x8D,0x8E,3}, {0xE9,0x8D,0x8F,3}, {0xE9,0x8D,0x90,3}, {0xE9,0x8D,0x91,3}, {0xE9,0x8D,0x92,3},
+        {0xE9,0x8D,0x93,3}, {0xE9,0x8D,0x94,3}, {0xE9,0x8D,0x95,3}, {0xE9,0x8D,0x96,3}, {0xE9,0x8D,0x97,3}, {0xE9,0x8D,0x98,3}, {0xE9,0x8D,0x99,3}, {0xE9,0x8D,0x9A,3},
+        {0xE9,0x8D,0x9B,3}, {0xE9,0x8D,0x9C,3}, {0xE9,0x8D,0x9D,3}, {0xE9,0x8D,0x9E,3}, {0xE9,0x8D,0x9F,3}, {0xE9,0x8D,0xA0,3}, {0xE9,0x8D,0xA1,3}, {0xE9,0x8D,0xA2,3},
+        {0xE9,0x8D,0xA3,3}, {0xE9,0x8D,0xA4,3}, {0xE9,0x8D,0xA5,3}, {0xE9,0x8D,0xA6,3}, {0xE9,0x8D,0xA7,3}, {0xE9,0x8D,0xA8,3}, {0xE9,0x8D,0xA9,3}, {0xE9,0x8D,0xAB,3},
+        {0xE6,0xBF,0x89,3}, {0xE6,0xBE,0xA7,3}, {0xE6,0xBE,0xB9,3}, {0xE6,0xBE,0xB6,3}, {0xE6,0xBF,0x82,3}, {0xE6,0xBF,0xA1,3}, {0xE6,0xBF,0xAE,3}, {0xE6,0xBF,0x9E,3},
+        {0xE6,0xBF,0xA0,3}, {0xE6,0xBF,0xAF,3}, {0xE7,0x80,0x9A,3}, {0xE7,0x80,0xA3,3}, {0xE7,0x80,0x9B,3}, {0xE7,0x80,0xB9,3}, {0xE7,0x80,0xB5,3}, {0xE7,0x81,0x8F,3},
+        {0xE7,0x81,0x9E,3}, {0xE5,0xAE,0x80,3}, {0xE5,0xAE,0x84,3}, {0xE5,0xAE,0x95,3}, {0xE5,0xAE,0x93,3}, {0xE5,0xAE,0xA5,3}, {0xE5,0xAE,0xB8,3}, {0xE7,0x94,0xAF,3},
+        {0xE9,0xAA,0x9E,3}, {0xE6,0x90,0xB4,3}, {0xE5,0xAF,0xA4,3}, {0xE5,0xAF,0xAE,3}, {0xE8,0xA4,0xB0,3}, {0xE5,0xAF,0xB0,3}, {0xE8,0xB9,0x87,3}, {0xE8,0xAC,0x87,3},
+        {0xE8,0xBE,0xB6,3}, {0xE8,0xBF,0x93,3}, {0xE8,0xBF,0x95,3}, {0xE8,0xBF,0xA5,3}, {0xE8,0xBF,0xAE,3}, {0xE8,0xBF,0xA4,3}, {0xE8,0xBF,0xA9,3}, {0xE8,0xBF,0xA6,3},
+        {0xE8,0xBF,0xB3,3}, {0xE8,0xBF,0xA8,3}, {0xE9,0x80,0x85,3}, {0xE9,0x80,0x84,3}, {0xE9,0x80,0x8B,3}, {0xE9,0x80,0xA6,3}, {0xE9,0x80,0x91,3}, {0xE9,0x80,0x8D,3},
+        {0xE9,0x80,0x96,3}, {0xE9,0x80,0xA1,3}, {0xE9,0x80,0xB5,3}, {0xE9,0x80,0xB6,3}, {0xE9,0x80,0xAD,3}, {0xE9,0x80,0xAF,3}, {0xE9,0x81,0x84,3}, {0xE9,0x81,0x91,3},
+        {0xE9,0x81,0x92,3}, {0xE9,0x81,0x90,3}, {0xE9,0x81,0xA8,3}, {0xE9,0x81,0x98,3}, {0xE9,0x81,0xA2,3}, {0xE9,0x81,0x9B,3}, {0xE6,0x9A,0xB9,3}, {0xE9,0x81,0xB4,3},
+        {0xE9,0x81,0xBD,3}, {0xE9,0x82,0x82,3}, {0xE9,0x82,0x88,3}, {0xE9,0x82,0x83,3}, {0xE9,0x82,0x8B,3}, {0xE5,0xBD,0x90,3}, {0xE5,0xBD,0x97,3}, {0xE5,0xBD,0x96,3},
+        {0xE5,0xBD,0x98,3}, {0xE5,0xB0,0xBB,3}, {0xE5,0x92,0xAB,3}, {0xE5,0xB1,0x90,3}, {0xE5,0xB1,0x99,3}, {0xE5,0xAD,0xB1,3}, {0xE5,0xB1,0xA3,3}, {0xE5,0xB1,0xA6,3},
+        {0xE7,0xBE,0xBC,3}, {0xE5,0xBC,0xAA,3}, {0xE5,0xBC,0xA9,3}, {0xE5,0xBC,0xAD,3}, {0xE8,0x89,0xB4,3}, {0xE5,0xBC,0xBC,3}, {0xE9,0xAC,0xBB,3}, {0xE5,0xB1,0xAE,3},
+        {0xE5,0xA6,0x81,3}, {0xE5,0xA6,0x83,3}, {0xE5,0xA6,0x8D,3}, {0xE5,0xA6,0xA9,3}, {0xE5,0xA6,0xAA,3}, {0xE5,0xA6,0xA3,3},
+    },
+    /* 0xE6 */ {
+        {0xE9,0x8D,0xAC,3}, {0xE9,0x8D,0xAD,3}, {0xE9,0x8D,0xAE,3}, {0xE9,0x8D,0xAF,3}, {0xE9,0x8D,0xB0,3}, {0xE9,0x8D,0xB1,3}, {0xE9,0x8D,0xB2,3}, {0xE9,0x8D,0xB3,3},
+        {0xE9,0x8D,0xB4,3}, {0xE9,0x8D,0xB5,3}, {0xE9,0x8D,0xB6,3}, {0xE9,0x8D,0xB7,3}, {0xE9,0x8D,0xB8,3}, {0xE9,0x8D,0xB9,3}, {0xE9,0x8D,0xBA,3}, {0xE9,0x8D,0xBB,3},
+        {0xE9,0x8D,0xBC,3}, {0xE9,0x8D,0xBD,3}, {0xE9,0x8D,0xBE,3}, {0xE9,0x8D,0xBF,3}, {0xE9,0x8E,0x80,3}, {0xE9,0x8E,0x81,3}, {0xE9,0x8E,0x82,3}, {0xE9,0x8E,0x83,3},
+        {0xE9,0x8E,0x84,3}, {0xE9,0x8E,0x85,3}, {0xE9,0x8E,0x86,3}, {0xE9,0x8E,0x87,3}, {0xE9,0x8E,0x88,3}, {0xE9,0x8E,0x89,3}, {0xE9,0x8E,0x8A,3}, {0xE9,0x8E,0x8B,3},
+        {0xE9,0x8E,0x8C,3}, {0xE9,0x8E,0x8D,3}, {0xE9,0x8E,0x8E,3}, {0xE9,0x8E,0x90,3}, {0xE9,0x8E,0x91,3}, {0xE9,0x8E,0x92,3}, {0xE9,0x8E,0x93,3}, {0xE9,0x8E,0x94,3},
+        {0xE9,0x8E,0x95,3}, {0xE9,0x8E,0x96,3}, {0xE9,0x8E,0x97,3}, {0xE9,0x8E,0x98,3}, {0xE9,0x8E,0x99,3}, {0xE9,0x8E,0x9A,3}, {0xE9,0x8E,0x9B,3}, {0xE9,0x8E,0x9C,3},
+        {0xE9,0x8E,0x9D,3}, {0xE9,0x8E,0x9E,3}, {0xE9,0x8E,0x9F,3}, {0xE9,0x8E,0xA0,3}, {0xE9,0x8E,0xA1,3}, {0xE9,0x8E,0xA2,3}, {0xE9,0x8E,0xA3,3}, {0xE9,0x8E,0xA4,3},
+        {0xE9,0x8E,0xA5,3}, {0xE9,0x8E,0xA6,3}, {0xE9,0x8E,0xA7,3}, {0xE9,0x8E,0xA8,3}, {0xE9,0x8E,0xA9,3}, {0xE9,0x8E,0xAA,3}, {0xE9,0x8E,0xAB,3}, {0xE9,0x8E,0xAC,3},
+        {0xE9,0x8E,0xAD,3}, {0xE9,0x8E,0xAE,3}, {0xE9,0x8E,0xAF,3}, {0xE9,0x8E,0xB0,3}, {0xE9,0x8E,0xB1,3}, {0xE9,0x8E,0xB2,3}, {0xE9,0x8E,0xB3,3}, {0xE9,0x8E,0xB4,3},
+        {0xE9,0x8E,0xB5,3}, {0xE9,0x8E,0xB6,3}, {0xE9,0x8E,0xB7,3}, {0xE9,0x8E,0xB8,3}, {0xE9,0x8E,0xB9,3}, {0xE9,0x8E,0xBA,3}, {0xE9,0x8E,0xBB,3}, {0xE9,0x8E,0xBC,3},
+        {0xE9,0x8E,0xBD,3}, {0xE9,0x8E,0xBE,3}, {0xE9,0x8E,0xBF,3}, {0xE9,0x8F,0x80,3}, {0xE9,0x8F,0x81,3}, {0xE9,0x8F,0x82,3}, {0xE9,0x8F,0x83,3}, {0xE9,0x8F,0x84,3},
+        {0xE9,0x8F,0x85,3}, {0xE9,0x8F,0x86,3}, {0xE9,0x8F,0x87,3}, {0xE9,0x8F,0x88,3}, {0xE9,0x8F,0x89,3}, {0xE9,0x8F,0x8B,3}, {0xE9,0x8F,0x8C,3}, {0xE9,0x8F,0x8D,3},
+        {0xE5,0xA6,0x97,3}, {0xE5,0xA7,0x8A,3}, {0xE5,0xA6,0xAB,3}, {0xE5,0xA6,0x9E,3}, {0xE5,0xA6,0xA4,3}, {0xE5,0xA7,0x92,3}, {0xE5,0xA6,0xB2,3}, {0xE5,0xA6,0xAF,3},
+        {0xE5,0xA7,0x97,3}, {0xE5,0xA6,0xBE,3}, {0xE5,0xA8,0x85,3}, {0xE5,0xA8,0x86,3}, {0xE5,0xA7,0x9D,3}, {0xE5,0xA8,0x88,3}, {0xE5,0xA7,0xA3,3}, {0xE5,0xA7,0x98,3},
+        {0xE5,0xA7,0xB9,3}, {0xE5,0xA8,0x8C,3}, {0xE5,0xA8,0x89,3}, {0xE5,0xA8,0xB2,3}, {0xE5,0xA8,0xB4,3}, {0xE5,0xA8,0x91,3}, {0xE5,0xA8,0xA3,3}, {0xE5,0xA8,0x93,3},
+        {0xE5,0xA9,0x80,3}, {0xE5,0xA9,0xA7,3}, {0xE5,0xA9,0x8A,3}, {0xE5,0xA9,0x95,3}, {0xE5,0xA8,0xBC,3}, {0xE5,0xA9,0xA2,3}, {0xE5,0xA9,0xB5,3}, {0xE8,0x83,0xAC,3},
+        {0xE5,0xAA,0xAA,3}, {0xE5,0xAA,0x9B,3}, {0xE5,0xA9,0xB7,3}, {0xE5,0xA9,0xBA,3}, {0xE5,0xAA,0xBE,3}, {0xE5,0xAB,0xAB,3}, {0xE5,0xAA,0xB2,3}, {0xE5,0xAB,0x92,3},
+        {0xE5,0xAB,0x94,3}, {0xE5,0xAA,0xB8,3}, {0xE5,0xAB,0xA0,3}, {0xE5,0xAB,0xA3,3}, {0xE5,0xAB,0xB1,3}, {0xE5,0xAB,0x96,3}, {0xE5,0xAB,0xA6,3}, {0xE5,0xAB,0x98,3},
+        {0xE5,0xAB,0x9C,3}, {0xE5,0xAC,0x89,3}, {0xE5,0xAC,0x97,3}, {0xE5,0xAC,0x96,3}, {0xE5,0xAC,0xB2,3}, {0xE5,0xAC,0xB7,3}, {0xE5,0xAD,0x80,3}, {0xE5,0xB0,0x95,3},
+        {0xE5,0xB0,0x9C,3}, {0xE5,0xAD,0x9A,3}, {0xE5,0xAD,0xA5,3}, {0xE5,0xAD,0xB3,3}, {0xE5,0xAD,0x91,3}, {0xE5,0xAD,0x93,3}, {0xE5,0xAD,0xA2,3}, {0xE9,0xA9,0xB5,3},
+        {0xE9,0xA9,0xB7,3}, {0xE9,0xA9,0xB8,3}, {0xE9,0xA9,0xBA,3}, {0xE9,0xA9,0xBF,3}, {0xE9,0xA9,0xBD,3}, {0xE9,0xAA,0x80,3}, {0xE9,0xAA,0x81,3}, {0xE9,0xAA,0x85,3},
+        {0xE9,0xAA,0x88,3}, {0xE9,0xAA,0x8A,3}, {0xE9,0xAA,0x90,3}, {0xE9,0xAA,0x92,3}, {0xE9,0xAA,0x93,3}, {0xE9,0xAA,0x96,3}, {0xE9,0xAA,0x98,3}, {0xE9,0xAA,0x9B,3},
+        {0xE9,0xAA,0x9C,3}, {0xE9,0xAA,0x9D,3}, {0xE9,0xAA,0x9F,3}, {0xE9,0xAA,0xA0,3}, {0xE9,0xAA,0xA2,3}, {0xE9,0xAA,0xA3,3}, {0xE9,0xAA,0xA5,3}, {0xE9,0xAA,0xA7,3},
+        {0xE7,0xBA,0x9F,3}, {0xE7,0xBA,0xA1,3}, {0xE7,0xBA,0xA3,3}, {0xE7,0xBA,0xA5,3}, {0xE7,0xBA,0xA8,3}, {0xE7,0xBA,0xA9,3},
+    },
+    /* 0xE7 */ {
+        {0xE9,0x8F,0x8E,3}, {0xE9,0x8F,0x8F,3}, {0xE9,0x8F,0x90,3}, {0xE9,0x8F,0x91,3}, {0xE9,0x8F,0x92,3}, {0xE9,0x8F,0x93,3}, {0xE9,0x8F,0x94,3}, {0xE9,0x8F,0x95,3},
+        {0xE9,0x8F,0x97,3}, {0xE9,0x8F,0x98,3}, {0xE9,0x8F,0x99,3}, {0xE9,0x8F,0x9A,3}, {0xE9,0x8F,0x9B,3}, {0xE9,0x8F,0x9C,3}, {0xE9,0x8F,0x9D,3}, {0xE9,0x8F,0x9E,3},
+        {0xE9,0x8F,0x9F,3}, {0xE9,0x8F,0xA0,3}, {0xE9,0x8F,0xA1,3}, {0xE9,0x8F,0xA2,3}, {0xE9,0x8F,0xA3,3}, {0xE9,0x8F,0xA4,3}, {0xE9,0x8F,0xA5,3}, {0xE9,0x8F,0xA6,3},
+        {0xE9,0x8F,0xA7,3}, {0xE9,0x8F,0xA8,3}, {0xE9,0x8F,0xA9,3}, {0xE9,0x8F,0xAA,3}, {0xE9,0x8F,0xAB,3}, {0xE9,0x8F,0xAC,3}, {0xE9,0x8F,0xAD,3}, {0xE9,0x8F,0xAE,3},
+        {0xE9,0x8F,0xAF,3}, {0xE9,0x8F,0xB0,3}, {0xE9,0x8F,0xB1,3}, {0xE9,0x8F,0xB2,3}, {0xE9,0x8F,0xB3,3}, {0xE9,0x8F,0xB4,3}, {0xE9,0x8F,0xB5,3}, {0xE9,0x8F,0xB6,3},
+        {0xE9,0x8F,0xB7,3}, {0xE9,0x8F,0xB8,3}, {0xE9,0x8F,0xB9,3}, {0xE9,0x8F,0xBA,3}, {0xE9,0x8F,0xBB,3}, {0xE9,0x8F,0xBC,3}, {0xE9,0x8F,0xBD,3}, {0xE9,0x8F,0xBE,3},
+        {0xE9,0x8F,0xBF,3}, {0xE9,0x90,0x80,3}, {0xE9,0x90,0x81,3}, {0xE9,0x90,0x82,3}, {0xE9,0x90,0x83,3}, {0xE9,0x90,0x84,3}, {0xE9,0x90,0x85,3}, {0xE9,0x90,0x86,3},
+        {0xE9,0x90,0x87,3}, {0xE9,0x90,0x88,3}, {0xE9,0x90,0x89,3}, {0xE9,0x90,0x8A,3}, {0xE9,0x90,0x8B,3}, {0xE9,0x90,0x8C,3}, {0xE9,0x90,0x8D,3}, {0xE9,0x90,0x8E,3},
+        {0xE9,0x90,0x8F,3}, {0xE9,0x90,0x90,3}, {0xE9,0x90,0x91,3}, {0xE9,0x90,0x92,3}, {0xE9,0x90,0x93,3}, {0xE9,0x90,0x94,3}, {0xE9,0x90,0x95,3}, {0xE9,0x90,0x96,3},
+        {0xE9,0x90,0x97,3}, {0xE9,0x90,0x98,3}, {0xE9,0x90,0x99,3}, {0xE9,0x90,0x9A,3}, {0xE9,0x90,0x9B,3}, {0xE9,0x90,0x9C,3}, {0xE9,0x90,0x9D,3}, {0xE9,0x90,0x9E,3},
+        {0xE9,0x90,0x9F,3}, {0xE9,0x90,0xA0,3}, {0xE9,0x90,0xA1,3}, {0xE9,0x90,0xA2,3}, {0xE9,0x90,0xA3,3}, {0xE9,0x90,0xA4,3}, {0xE9,0x90,0xA5,3}, {0xE9,0x90,0xA6,3},
+        {0xE9,0x90,0xA7,3}, {0xE9,0x90,0xA8,3}, {0xE9,0x90,0xA9,3}, {0xE9,0x90,0xAA,3}, {0xE9,0x90,0xAB,3}, {0xE9,0x90,0xAC,3}, {0xE9,0x90,0xAD,3}, {0xE9,0x90,0xAE,3},
+        {0xE7,0xBA,0xAD,3}, {0xE7,0xBA,0xB0,3}, {0xE7,0xBA,0xBE,3}, {0xE7,0xBB,0x80,3}, {0xE7,0xBB,0x81,3}, {0xE7,0xBB,0x82,3}, {0xE7,0xBB,0x89,3}, {0xE7,0xBB,0x8B,3},
+        {0xE7,0xBB,0x8C,3}, {0xE7,0xBB,0x90,3}, {0xE7,0xBB,0x94,3}, {0xE7,0xBB,0x97,3}, {0xE7,0xBB,0x9B,3}, {0xE7,0xBB,0xA0,3}, {0xE7,0xBB,0xA1,3}, {0xE7,0xBB,0xA8,3},
+        {0xE7,0xBB,0xAB,3}, {0xE7,0xBB,0xAE,3}, {0xE7,0xBB,0xAF,3}, {0xE7,0xBB,0xB1,3}, {0xE7,0xBB,0xB2,3}, {0xE7,0xBC,0x8D,3}, {0xE7,0xBB,0xB6,3}, {0xE7,0xBB,0xBA,3},
+        {0xE7,0xBB,0xBB,3}, {0xE7,0xBB,0xBE,3}, {0xE7,0xBC,0x81,3}, {0xE7,0xBC,0x82,3}, {0xE7,0xBC,0x83,3}, {0xE7,0xBC,0x87,3}, {0xE7,0xBC,0x88,3}, {0xE7,0xBC,0x8B,3},
+        {0xE7,0xBC,0x8C,3}, {0xE7,0xBC,0x8F,3}, {0xE7,0xBC,0x91,3}, {0xE7,0xBC,0x92,3}, {0xE7,0xBC,0x97,3}, {0xE7,0xBC,0x99,3}, {0xE7,0xBC,0x9C,3}, {0xE7,0xBC,0x9B,3},
+        {0xE7,0xBC,0x9F,3}, {0xE7,0xBC,0xA1,3}, {0xE7,0xBC,0xA2,3}, {0xE7,0xBC,0xA3,3}, {0xE7,0xBC,0xA4,3}, {0xE7,0xBC,0xA5,3}, {0xE7,0xBC,0xA6,3}, {0xE7,0xBC,0xA7,3},
+        {0xE7,0xBC,0xAA,3}, {0xE7,0xBC,0xAB,3}, {0xE7,0xBC,0xAC,3}, {0xE7,0xBC,0xAD,3}, {0xE7,0xBC,0xAF,3}, {0xE7,0xBC,0xB0,3}, {0xE7,0xBC,0xB1,3}, {0xE7,0xBC,0xB2,3},
+        {0xE7,0xBC,0xB3,3}, {0xE7,0xBC,0xB5,3}, {0xE5,0xB9,0xBA,3}, {0xE7,0x95,0xBF,3}, {0xE5,0xB7,0x9B,3}, {0xE7,0x94,0xBE,3}, {0xE9,0x82,0x95,3}, {0xE7,0x8E,0x8E,3},
+        {0xE7,0x8E,0x91,3}, {0xE7,0x8E,0xAE,3}, {0xE7,0x8E,0xA2,3}, {0xE7,0x8E,0x9F,3}, {0xE7,0x8F,0x8F,3}, {0xE7,0x8F,0x82,3}, {0xE7,0x8F,0x91,3}, {0xE7,0x8E,0xB7,3},
+        {0xE7,0x8E,0xB3,3}, {0xE7,0x8F,0x80,3}, {0xE7,0x8F,0x89,3}, {0xE7,0x8F,0x88,3}, {0xE7,0x8F,0xA5,3}, {0xE7,0x8F,0x99,3}, {0xE9,0xA1,0xBC,3}, {0xE7,0x90,0x8A,3},
+        {0xE7,0x8F,0xA9,3}, {0xE7,0x8F,0xA7,3}, {0xE7,0x8F,0x9E,3}, {0xE7,0x8E,0xBA,3}, {0xE7,0x8F,0xB2,3}, {0xE7,0x90,0x8F,3}, {0xE7,0x90,0xAA,3}, {0xE7,0x91,0x9B,3},
+        {0xE7,0x90,0xA6,3}, {0xE7,0x90,0xA5,3}, {0xE7,0x90,0xA8,3}, {0xE7,0x90,0xB0,3}, {0xE7,0x90,0xAE,3}, {0xE7,0x90,0xAC,3},
+    },
+    /* 0xE8 */ {
+        {0xE9,0x90,0xAF,3}, {0xE9,0x90,0xB0,3}, {0xE9,0x90,0xB1,3}, {0xE9,0x90,0xB2,3}, {0xE9,0x90,0xB3,3}, {0xE9,0x90,0xB4,3}, {0xE9,0x90,0xB5,3}, {0xE9,0x90,0xB6,3},
+        {0xE9,0x90,0xB7,3}, {0xE9,0x90,0xB8,3}, {0xE9,0x90,0xB9,3}, {0xE9,0x90,0xBA,3}, {0xE9,0x90,0xBB,3}, {0xE9,0x90,0xBC,3}, {0xE9,0x90,0xBD,3}, {0xE9,0x90,0xBF,3},
+        {0xE9,0x91,0x80,3}, {0xE9,0x91,0x81,3}, {0xE9,0x91,0x82,3}, {0xE9,0x91,0x83,3}, {0xE9,0x91,0x84,3}, {0xE9,0x91,0x85,3}, {0xE9,0x91,0x86,3}, {0xE9,0x91,0x87,3},
+        {0xE9,0x91,0x88,3}, {0xE9,0x91,0x89,3}, {0xE9,0x91,0x8A,3}, {0xE9,0x91,0x8B,3}, {0xE9,0x91,0x8C,3}, {0xE9,0x91,0x8D,3}, {0xE9,0x91,0x8E,3}, {0xE9,0x91,0x8F,3},
+        {0xE9,0x91,0x90,3}, {0xE9,0x91,0x91,3}, {0xE9,0x91,0x92,3}, {0xE9,0x91,0x93,3}, {0xE9,0x91,0x94,3}, {0xE9,0x91,0x95,3}, {0xE9,0x91,0x96,3}, {0xE9,0x91,0x97,3},
+        {0xE9,0x91,0x98,3}, {0xE9,0x91,0x99,3}, {0xE9,0x91,0x9A,3}, {0xE9,0x91,0x9B,3}, {0xE9,0x91,0x9C,3}, {0xE9,0x91,0x9D,3}, {0xE9,0x91,0x9E,3}, {0xE9,0x91,0x9F,3},
+        {0xE9,0x91,0xA0,3}, {0xE9,0x91,0xA1,3}, {0xE9,0x91,0xA2,3}, {0xE9,0x91,0xA3,3}, {0xE9,0x91,0xA4,3}, {0xE9,0x91,0xA5,3}, {0xE9,0x91,0xA6,3}, {0xE9,0x91,0xA7,3},
+        {0xE9,0x91,0xA8,3}, {0xE9,0x91,0xA9,3}, {0xE9,0x91,0xAA,3}, {0xE9,0x91,0xAC,3}, {0xE9,0x91,0xAD,3}, {0xE9,0x91,0xAE,3}, {0xE9,0x91,0xAF,3}, {0xE9,0x91,0xB0,3},
+        {0xE9,0x91,0xB1,3}, {0xE9,0x91,0xB2,3}, {0xE9,0x91,0xB3,3}, {0xE9,0x91,0xB4,3}, {0xE9,0x91,0xB5,3}, {0xE9,0x91,0xB6,3}, {0xE9,0x91,0xB7,3}, {0xE9,0x91,0xB8,3},
+        {0xE9,0x91,0xB9,3}, {0xE9,0x91,0xBA,3}, {0xE9,0x91,0xBB,3}, {0xE9,0x91,0xBC,3}, {0xE9,0x91,0xBD,3}, {0xE9,0x91,0xBE,3}, {0xE9,0x91,0xBF,3}, {0xE9,0x92,0x80,3},
+        {0xE9,0x92,0x81,3}, {0xE9,0x92,0x82,3}, {0xE9,0x92,0x83,3}, {0xE9,0x92,0x84,3}, {0xE9,0x92,0x91,3}, {0xE9,0x92,0x96,3}, {0xE9,0x92,0x98,3}, {0xE9,0x93,0x87,3},
+        {0xE9,0x93,0x8F,3}, {0xE9,0x93,0x93,3}, {0xE9,0x93,0x94,3}, {0xE9,0x93,0x9A,3}, {0xE9,0x93,0xA6,3}, {0xE9,0x93,0xBB,3}, {0xE9,0x94,0x9C,3}, {0xE9,0x94,0xA0,3},
+        {0xE7,0x90,0x9B,3}, {0xE7,0x90,0x9A,3}, {0xE7,0x91,0x81,3}, {0xE7,0x91,0x9C,3}, {0xE7,0x91,0x97,3}, {0xE7,0x91,0x95,3}, {0xE7,0x91,0x99,3}, {0xE7,0x91,0xB7,3},
+        {0xE7,0x91,0xAD,3}, {0xE7,0x91,0xBE,3}, {0xE7,0x92,0x9C,3}, {0xE7,0x92,0x8E,3}, {0xE7,0x92,0x80,3}, {0xE7,0x92,0x81,3}, {0xE7,0x92,0x87,3}, {0xE7,0x92,0x8B,3},
+        {0xE7,0x92,0x9E,3}, {0xE7,0x92,0xA8,3}, {0xE7,0x92,0xA9,3}, {0xE7,0x92,0x90,3}, {0xE7,0x92,0xA7,3}, {0xE7,0x93,0x92,3}, {0xE7,0x92,0xBA,3}, {0xE9,0x9F,0xAA,3},
+        {0xE9,0x9F,0xAB,3}, {0xE9,0x9F,0xAC,3}, {0xE6,0x9D,0x8C,3}, {0xE6,0x9D,0x93,3}, {0xE6,0x9D,0x9E,3}, {0xE6,0x9D,0x88,3}, {0xE6,0x9D,0xA9,3}, {0xE6,0x9E,0xA5,3},
+        {0xE6,0x9E,0x87,3}, {0xE6,0x9D,0xAA,3}, {0xE6,0x9D,0xB3,3}, {0xE6,0x9E,0x98,3}, {0xE6,0x9E,0xA7,3}, {0xE6,0x9D,0xB5,3}, {0xE6,0x9E,0xA8,3}, {0xE6,0x9E,0x9E,3},
+        {0xE6,0x9E,0xAD,3}, {0xE6,0x9E,0x8B,3}, {0xE6,0x9D,0xB7,3}, {0xE6,0x9D,0xBC,3}, {0xE6,0x9F,0xB0,3}, {0xE6,0xA0,0x89,3}, {0xE6,0x9F,0x98,3}, {0xE6,0xA0,0x8A,3},
+        {0xE6,0x9F,0xA9,3}, {0xE6,0x9E,0xB0,3}, {0xE6,0xA0,0x8C,3}, {0xE6,0x9F,0x99,3}, {0xE6,0x9E,0xB5,3}, {0xE6,0x9F,0x9A,3}, {0xE6,0x9E,0xB3,3}, {0xE6,0x9F,0x9D,3},
+        {0xE6,0xA0,0x80,3}, {0xE6,0x9F,0x83,3}, {0xE6,0x9E,0xB8,3}, {0xE6,0x9F,0xA2,3}, {0xE6,0xA0,0x8E,3}, {0xE6,0x9F,0x81,3}, {0xE6,0x9F,0xBD,3}, {0xE6,0xA0,0xB2,3},
+        {0xE6,0xA0,0xB3,3}, {0xE6,0xA1,0xA0,3}, {0xE6,0xA1,0xA1,3}, {0xE6,0xA1,0x8E,3}, {0xE6,0xA1,0xA2,3}, {0xE6,0xA1,0x84,3}, {0xE6,0xA1,0xA4,3}, {0xE6,0xA2,0x83,3},
+        {0xE6,0xA0,0x9D,3}, {0xE6,0xA1,0x95,3}, {0xE6,0xA1,0xA6,3}, {0xE6,0xA1,0x81,3}, {0xE6,0xA1,0xA7,3}, {0xE6,0xA1,0x80,3}, {0xE6,0xA0,0xBE,3}, {0xE6,0xA1,0x8A,3},
+        {0xE6,0xA1,0x89,3}, {0xE6,0xA0,0xA9,3}, {0xE6,0xA2,0xB5,3}, {0xE6,0xA2,0x8F,3}, {0xE6,0xA1,0xB4,3}, {0xE6,0xA1,0xB7,3}, {0xE6,0xA2,0x93,3}, {0xE6,0xA1,0xAB,3},
+        {0xE6,0xA3,0x82,3}, {0xE6,0xA5,0xAE,3}, {0xE6,0xA3,0xBC,3}, {0xE6,0xA4,0x9F,3}, {0xE6,0xA4,0xA0,3}, {0xE6,0xA3,0xB9,3},
+    },
+    /* 0xE9 */ {
+        {0xE9,0x94,0xA7,3}, {0xE9,0x94,0xB3,3}, {0xE9,0x94,0xBD,3}, {0xE9,0x95,0x83,3}, {0xE9,0x95,0x88,3}, {0xE9,0x95,0x8B,3}, {0xE9,0x95,0x95,3}, {0xE9,0x95,0x9A,3},
+        {0xE9,0x95,0xA0,3}, {0xE9,0x95,0xAE,3}, {0xE9,0x95,0xB4,3}, {0xE9,0x95,0xB5,3}, {0xE9,0x95,0xB7,3}, {0xE9,0x95,0xB8,3}, {0xE9,0x95,0xB9,3}, {0xE9,0x95,0xBA,3},
+        {0xE9,0x95,0xBB,3}, {0xE9,0x95,0xBC,3}, {0xE9,0x95,0xBD,3}, {0xE9,0x95,0xBE,3}, {0xE9,0x96,0x80,3}, {0xE9,0x96,0x81,3}, {0xE9,0x96,0x82,3}, {0xE9,0x96,0x83,3},
+        {0xE9,0x96,0x84,3}, {0xE9,0x96,0x85,3}, {0xE9,0x96,0x86,3}, {0xE9,0x96,0x87,3}, {0xE9,0x96,0x88,3}, {0xE9,0x96,0x89,3}, {0xE9,0x96,0x8A,3}, {0xE9,0x96,0x8B,3},
+        {0xE9,0x96,0x8C,3}, {0xE9,0x96,0x8D,3}, {0xE9,0x96,0x8E,3}, {0xE9,0x96,0x8F,3}, {0xE9,0x96,0x90,3}, {0xE9,0x96,0x91,3}, {0xE9,0x96,0x92,3}, {0xE9,0x96,0x93,3},
+        {0xE9,0x96,0x94,3}, {0xE9,0x96,0x95,3}, {0xE9,0x96,0x96,3}, {0xE9,0x96,0x97,3}, {0xE9,0x96,0x98,3}, {0xE9,0x96,0x99,3}, {0xE9,0x96,0x9A,3}, {0xE9,0x96,0x9B,3},
+        {0xE9,0x96,0x9C,3}, {0xE9,0x96,0x9D,3}, {0xE9,0x96,0x9E,3}, {0xE9,0x96,0x9F,3}, {0xE9,0x96,0xA0,3}, {0xE9,0x96,0xA1,3}, {0xE9,0x96,0xA2,3}, {0xE9,0x96,0xA3,3},
+        {0xE9,0x96,0xA4,3}, {0xE9,0x96,0xA5,3}, {0xE9,0x96,0xA6,3}, {0xE9,0x96,0xA7,3}, {0xE9,0x96,0xA8,3}, {0xE9,0x96,0xA9,3}, {0xE9,0x96,0xAA,3}, {0xE9,0x96,0xAB,3},
+        {0xE9,0x96,0xAC,3}, {0xE9,0x96,0xAD,3}, {0xE9,0x96,0xAE,3}, {0xE9,0x96,0xAF,3}, {0xE9,0x96,0xB0,3}, {0xE9,0x96,0xB1,3}, {0xE9,0x96,0xB2,3}, {0xE9,0x96,0xB3,3},
+        {0xE9,0x96,0xB4,3}, {0xE9,0x96,0xB5,3}, {0xE9,0x96,0xB6,3}, {0xE9,0x96,0xB7,3}, {0xE9,0x96,0xB8,3}, {0xE9,0x96,0xB9,3}, {0xE9,0x96,0xBA,3}, {0xE9,0x96,0xBB,3},
+        {0xE9,0x96,0xBC,3}, {0xE9,0x96,0xBD,3}, {0xE9,0x96,0xBE,3}, {0xE9,0x96,0xBF,3}, {0xE9,0x97,0x80,3}, {0xE9,0x97,0x81,3}, {0xE9,0x97,0x82,3}, {0xE9,0x97,0x83,3},
+        {0xE9,0x97,0x84,3}, {0xE9,0x97,0x85,3}, {0xE9,0x97,0x86,3}, {0xE9,0x97,0x87,3}, {0xE9,0x97,0x88,3}, {0xE9,0x97,0x89,3}, {0xE9,0x97,0x8A,3}, {0xE9,0x97,0x8B,3},
+        {0xE6,0xA4,0xA4,3}, {0xE6,0xA3,0xB0,3}, {0xE6,0xA4,0x8B,3}, {0xE6,0xA4,0x81,3}, {0xE6,0xA5,0x97,3}, {0xE6,0xA3,0xA3,3}, {0xE6,0xA4,0x90,3}, {0xE6,0xA5,0xB1,3},
+        {0xE6,0xA4,0xB9,3}, {0xE6,0xA5,0xA0,3}, {0xE6,0xA5,0x82,3}, {0xE6,0xA5,0x9D,3}, {0xE6,0xA6,0x84,3}, {0xE6,0xA5,0xAB,3}, {0xE6,0xA6,0x80,3}, {0xE6,0xA6,0x98,3},
+        {0xE6,0xA5,0xB8,3}, {0xE6,0xA4,0xB4,3}, {0xE6,0xA7,0x8C,3}, {0xE6,0xA6,0x87,3}, {0xE6,0xA6,0x88,3}, {0xE6,0xA7,0x8E,3}, {0xE6,0xA6,0x89,3}, {0xE6,0xA5,0xA6,3},
+        {0xE6,0xA5,0xA3,3}, {0xE6,0xA5,0xB9,3}, {0xE6,0xA6,0x9B,3}, {0xE6,0xA6,0xA7,3}, {0xE6,0xA6,0xBB,3}, {0xE6,0xA6,0xAB,3}, {0xE6,0xA6,0xAD,3}, {0xE6,0xA7,0x94,3},
+        {0xE6,0xA6,0xB1,3}, {0xE6,0xA7,0x81,3}, {0xE6,0xA7,0x8A,3}, {0xE6,0xA7,0x9F,3}, {0xE6,0xA6,0x95,3}, {0xE6,0xA7,0xA0,3}, {0xE6,0xA6,0x8D,3}, {0xE6,0xA7,0xBF,3},
+        {0xE6,0xA8,0xAF,3}, {0xE6,0xA7,0xAD,3}, {0xE6,0xA8,0x97,3}, {0xE6,0xA8,0x98,3}, {0xE6,0xA9,0xA5,3}, {0xE6,0xA7,0xB2,3}, {0xE6,0xA9,0x84,3}, {0xE6,0xA8,0xBE,3},
+        {0xE6,0xAA,0xA0,3}, {0xE6,0xA9,0x90,3}, {0xE6,0xA9,0x9B,3}, {0xE6,0xA8,0xB5,3}, {0xE6,0xAA,0x8E,3}, {0xE6,0xA9,0xB9,3}, {0xE6,0xA8,0xBD,3}, {0xE6,0xA8,0xA8,3},
+        {0xE6,0xA9,0x98,3}, {0xE6,0xA9,0xBC,3}, {0xE6,0xAA,0x91,3}, {0xE6,0xAA,0x90,3}, {0xE6,0xAA,0xA9,3}, {0xE6,0xAA,0x97,3}, {0xE6,0xAA,0xAB,3}, {0xE7,0x8C,0xB7,3},
+        {0xE7,0x8D,0x92,3}, {0xE6,0xAE,0x81,3}, {0xE6,0xAE,0x82,3}, {0xE6,0xAE,0x87,3}, {0xE6,0xAE,0x84,3}, {0xE6,0xAE,0x92,3}, {0xE6,0xAE,0x93,3}, {0xE6,0xAE,0x8D,3},
+        {0xE6,0xAE,0x9A,3}, {0xE6,0xAE,0x9B,3}, {0xE6,0xAE,0xA1,3}, {0xE6,0xAE,0xAA,3}, {0xE8,0xBD,0xAB,3}, {0xE8,0xBD,0xAD,3}, {0xE8,0xBD,0xB1,3}, {0xE8,0xBD,0xB2,3},
+        {0xE8,0xBD,0xB3,3}, {0xE8,0xBD,0xB5,3}, {0xE8,0xBD,0xB6,3}, {0xE8,0xBD,0xB8,3}, {0xE8,0xBD,0xB7,3}, {0xE8,0xBD,0xB9,3}, {0xE8,0xBD,0xBA,3}, {0xE8,0xBD,0xBC,3},
+        {0xE8,0xBD,0xBE,3}, {0xE8,0xBE,0x81,3}, {0xE8,0xBE,0x82,3}, {0xE8,0xBE,0x84,3}, {0xE8,0xBE,0x87,3}, {0xE8,0xBE,0x8B,3},
+    },
+    /* 0xEA */ {
+        {0xE9,0x97,0x8C,3}, {0xE9,0x97,0x8D,3}, {0xE9,0x97,0x8E,3}, {0xE9,0x97,0x8F,3}, {0xE9,0x97,0x90,3}, {0xE9,0x97,0x91,3}, {0xE9,0x97,0x92,3}, {0xE9,0x97,0x93,3},
+        {0xE9,0x97,0x94,3}, {0xE9,0x97,0x95,3}, {0xE9,0x97,0x96,3}, {0xE9,0x97,0x97,3}, {0xE9,0x97,0x98,3}, {0xE9,0x97,0x99,3}, {0xE9,0x97,0x9A,3}, {0xE9,0x97,0x9B,3},
+        {0xE9,0x97,0x9C,3}, {0xE9,0x97,0x9D,3}, {0xE9,0x97,0x9E,3}, {0xE9,0x97,0x9F,3}, {0xE9,0x97,0xA0,3}, {0xE9,0x97,0xA1,3}, {0xE9,0x97,0xA2,3}, {0xE9,0x97,0xA3,3},
+        {0xE9,0x97,0xA4,3}, {0xE9,0x97,0xA5,3}, {0xE9,0x97,0xA6,3}, {0xE9,0x97,0xA7,3}, {0xE9,0x97,0xAC,3}, {0xE9,0x97,0xBF,3}, {0xE9,0x98,0x87,3}, {0xE9,0x98,0x93,3},
+        {0xE9,0x98,0x98,3}, {0xE9,0x98,0x9B,3}, {0xE9,0x98,0x9E,3}, {0xE9,0x98,0xA0,3}, {0xE9,0x98,0xA3,3}, {0xE9,0x98,0xA4,3}, {0xE9,0x98,0xA5,3}, {0xE9,0x98,0xA6,3},
+        {0xE9,0x98,0xA7,3}, {0xE9,0x98,0xA8,3}, {0xE9,0x98,0xA9,3}, {0xE9,0x98,0xAB,3}, {0xE9,0x98,0xAC,3}, {0xE9,0x98,0xAD,3}, {0xE9,0x98,0xAF,3}, {0xE9,0x98,0xB0,3},
+        {0xE9,0x98,0xB7,3}, {0xE9,0x98,0xB8,3}, {0xE9,0x98,0xB9,3}, {0xE9,0x98,0xBA,3}, {0xE9,0x98,0xBE,3}, {0xE9,0x99,0x81,3}, {0xE9,0x99,0x83,3}, {0xE9,0x99,0x8A,3},
+        {0xE9,0x99,0x8E,3}, {0xE9,0x99,0x8F,3}, {0xE9,0x99,0x91,3}, {0xE9,0x99,0x92,3}, {0xE9,0x99,0x93,3}, {0xE9,0x99,0x96,3}, {0xE9,0x99,0x97,3}, {0xE9,0x99,0x98,3},
+        {0xE9,0x99,0x99,3}, {0xE9,0x99,0x9A,3}, {0xE9,0x99,0x9C,3}, {0xE9,0x99,0x9D,3}, {0xE9,0x99,0x9E,3}, {0xE9,0x99,0xA0,3}, {0xE9,0x99,0xA3,3}, {0xE9,0x99,0xA5,3},
+        {0xE9,0x99,0xA6,3}, {0xE9,0x99,0xAB,3}, {0xE9,0x99,0xAD,3}, {0xE9,0x99,0xAE,3}, {0xE9,0x99,0xAF,3}, {0xE9,0x99,0xB0,3}, {0xE9,0x99,0xB1,3}, {0xE9,0x99,0xB3,3},
+        {0xE9,0x99,0xB8,3}, {0xE9,0x99,0xB9,3}, {0xE9,0x99,0xBA,3}, {0xE9,0x99,0xBB,3}, {0xE9,0x99,0xBC,3}, {0xE9,0x99,0xBD,3}, {0xE9,0x99,0xBE,3}, {0xE9,0x99,0xBF,3},
+        {0xE9,0x9A,0x80,3}, {0xE9,0x9A,0x81,3}, {0xE9,0x9A,0x82,3}, {0xE9,0x9A,0x83,3}, {0xE9,0x9A,0x84,3}, {0xE9,0x9A,0x87,3}, {0xE9,0x9A,0x89,3}, {0xE9,0x9A,0x8A,3},
+        {0xE8,0xBE,0x8D,3}, {0xE8,0xBE,0x8E,3}, {0xE8,0xBE,0x8F,3}, {0xE8,0xBE,0x98,3}, {0xE8,0xBE,0x9A,3}, {0xE8,0xBB,0x8E,3}, {0xE6,0x88,0x8B,3}, {0xE6,0x88,0x97,3},
+        {0xE6,0x88,0x9B,3}, {0xE6,0x88,0x9F,3}, {0xE6,0x88,0xA2,3}, {0xE6,0x88,0xA1,3}, {0xE6,0x88,0xA5,3}, {0xE6,0x88,0xA4,3}, {0xE6,0x88,0xAC,3}, {0xE8,0x87,0xA7,3},
+        {0xE7,0x93,0xAF,3}, {0xE7,0x93,0xB4,3}, {0xE7,0x93,0xBF,3}, {0xE7,0x94,0x8F,3}, {0xE7,0x94,0x91,3}, {0xE7,0x94,0x93,3}, {0xE6,0x94,0xB4,3}, {0xE6,0x97,0xAE,3},
+        {0xE6,0x97,0xAF,3}, {0xE6,0x97,0xB0,3}, {0xE6,0x98,0x8A,3}, {0xE6,0x98,0x99,3}, {0xE6,0x9D,0xB2,3}, {0xE6,0x98,0x83,3}, {0xE6,0x98,0x95,3}, {0xE6,0x98,0x80,3},
+        {0xE7,0x82,0x85,3}, {0xE6,0x9B,0xB7,3}, {0xE6,0x98,0x9D,3}, {0xE6,0x98,0xB4,3}, {0xE6,0x98,0xB1,3}, {0xE6,0x98,0xB6,3}, {0xE6,0x98,0xB5,3}, {0xE8,0x80,0x86,3},
+        {0xE6,0x99,0x9F,3}, {0xE6,0x99,0x94,3}, {0xE6,0x99,0x81,3}, {0xE6,0x99,0x8F,3}, {0xE6,0x99,0x96,3}, {0xE6,0x99,0xA1,3}, {0xE6,0x99,0x97,3}, {0xE6,0x99,0xB7,3},
+        {0xE6,0x9A,0x84,3}, {0xE6,0x9A,0x8C,3}, {0xE6,0x9A,0xA7,3}, {0xE6,0x9A,0x9D,3}, {0xE6,0x9A,0xBE,3}, {0xE6,0x9B,0x9B,3}, {0xE6,0x9B,0x9C,3}, {0xE6,0x9B,0xA6,3},
+        {0xE6,0x9B,0xA9,3}, {0xE8,0xB4,0xB2,3}, {0xE8,0xB4,0xB3,3}, {0xE8,0xB4,0xB6,3}, {0xE8,0xB4,0xBB,3}, {0xE8,0xB4,0xBD,3}, {0xE8,0xB5,0x80,3}, {0xE8,0xB5,0x85,3},
+        {0xE8,0xB5,0x86,3}, {0xE8,0xB5,0x88,3}, {0xE8,0xB5,0x89,3}, {0xE8,0xB5,0x87,3}, {0xE8,0xB5,0x8D,3}, {0xE8,0xB5,0x95,3}, {0xE8,0xB5,0x99,3}, {0xE8,0xA7,0x87,3},
+        {0xE8,0xA7,0x8A,3}, {0xE8,0xA7,0x8B,3}, {0xE8,0xA7,0x8C,3}, {0xE8,0xA7,0x8E,3}, {0xE8,0xA7,0x8F,3}, {0xE8,0xA7,0x90,3}, {0xE8,0xA7,0x91,3}, {0xE7,0x89,0xAE,3},
+        {0xE7,0x8A,0x9F,3}, {0xE7,0x89,0x9D,3}, {0xE7,0x89,0xA6,3}, {0xE7,0x89,0xAF,3}, {0xE7,0x89,0xBE,3}, {0xE7,0x89,0xBF,3}, {0xE7,0x8A,0x84,3}, {0xE7,0x8A,0x8B,3},
+        {0xE7,0x8A,0x8D,3}, {0xE7,0x8A,0x8F,3}, {0xE7,0x8A,0x92,3}, {0xE6,0x8C,0x88,3}, {0xE6,0x8C,0xB2,3}, {0xE6,0x8E,0xB0,3},
+    },
+    /* 0xEB */ {
+        {0xE9,0x9A,0x8C,3}, {0xE9,0x9A,0x8E,3}, {0xE9,0x9A,0x91,3}, {0xE9,0x9A,0x92,3}, {0xE9,0x9A,0x93,3}, {0xE9,0x9A,0x95,3}, {0xE9,0x9A,0x96,3}, {0xE9,0x9A,0x9A,3},
+        {0xE9,0x9A,0x9B,3}, {0xE9,0x9A,0x9D,3}, {0xE9,0x9A,0x9E,3}, {0xE9,0x9A,0x9F,3}, {0xE9,0x9A,0xA0,3}, {0xE9,0x9A,0xA1,3}, {0xE9,0x9A,0xA2,3}, {0xE9,0x9A,0xA3,3},
+        {0xE9,0x9A,0xA4,3}, {0xE9,0x9A,0xA5,3}, {0xE9,0x9A,0xA6,3}, {0xE9,0x9A,0xA8,3}, {0xE9,0x9A,0xA9,3}, {0xE9,0x9A,0xAA,3}, {0xE9,0x9A,0xAB,3}, {0xE9,0x9A,0xAC,3},
+        {0xE9,0x9A,0xAD,3}, {0xE9,0x9A,0xAE,3}, {0xE9,0x9A,0xAF,3}, {0xE9,0x9A,0xB1,3}, {0xE9,0x9A,0xB2,3}, {0xE9,0x9A,0xB4,3}, {0xE9,0x9A,0xB5,3}, {0xE9,0x9A,0xB7,3},
+        {0xE9,0x9A,0xB8,3}, {0xE9,0x9A,0xBA,3}, {0xE9,0x9A,0xBB,3}, {0xE9,0x9A,0xBF,3}, {0xE9,0x9B,0x82,3}, {0xE9,0x9B,0x83,3}, {0xE9,0x9B,0x88,3}, {0xE9,0x9B,0x8A,3},
+        {0xE9,0x9B,0x8B,3}, {0xE9,0x9B,0x90,3}, {0xE9,0x9B,0x91,3}, {0xE9,0x9B,0x93,3}, {0xE9,0x9B,0x94,3}, {0xE9,0x9B,0x96,3}, {0xE9,0x9B,0x97,3}, {0xE9,0x9B,0x98,3},
+        {0xE9,0x9B,0x99,3}, {0xE9,0x9B,0x9A,3}, {0xE9,0x9B,0x9B,3}, {0xE9,0x9B,0x9C,3}, {0xE9,0x9B,0x9D,3}, {0xE9,0x9B,0x9E,3}, {0xE9,0x9B,0x9F,3}, {0xE9,0x9B,0xA1,3},
+        {0xE9,0x9B,0xA2,3}, {0xE9,0x9B,0xA3,3}, {0xE9,0x9B,0xA4,3}, {0xE9,0x9B,0xA5,3}, {0xE9,0x9B,0xA6,3}, {0xE9,0x9B,0xA7,3}, {0xE9,0x9B,0xAB,3}, {0xE9,0x9B,0xAC,3},
+        {0xE9,0x9B,0xAD,3}, {0xE9,0x9B,0xAE,3}, {0xE9,0x9B,0xB0,3}, {0xE9,0x9B,0xB1,3}, {0xE9,0x9B,0xB2,3}, {0xE9,0x9B,0xB4,3}, {0xE9,0x9B,0xB5,3}, {0xE9,0x9B,0xB8,3},
+        {0xE9,0x9B,0xBA,3}, {0xE9,0x9B,0xBB,3}, {0xE9,0x9B,0xBC,3}, {0xE9,0x9B,0xBD,3}, {0xE9,0x9B,0xBF,3}, {0xE9,0x9C,0x82,3}, {0xE9,0x9C,0x83,3}, {0xE9,0x9C,0x85,3},
+        {0xE9,0x9C,0x8A,3}, {0xE9,0x9C,0x8B,3}, {0xE9,0x9C,0x8C,3}, {0xE9,0x9C,0x90,3}, {0xE9,0x9C,0x91,3}, {0xE9,0x9C,0x92,3}, {0xE9,0x9C,0x94,3}, {0xE9,0x9C,0x95,3},
+        {0xE9,0x9C,0x97,3}, {0xE9,0x9C,0x98,3}, {0xE9,0x9C,0x99,3}, {0xE9,0x9C,0x9A,3}, {0xE9,0x9C,0x9B,3}, {0xE9,0x9C,0x9D,3}, {0xE9,0x9C,0x9F,3}, {0xE9,0x9C,0xA0,3},
+        {0xE6,0x90,0xBF,3}, {0xE6,0x93,0x98,3}, {0xE8,0x80,0x84,3}, {0xE6,0xAF,0xAA,3}, {0xE6,0xAF,0xB3,3}, {0xE6,0xAF,0xBD,3}, {0xE6,0xAF,0xB5,3}, {0xE6,0xAF,0xB9,3},
+        {0xE6,0xB0,0x85,3}, {0xE6,0xB0,0x87,3}, {0xE6,0xB0,0x86,3}, {0xE6,0xB0,0x8D,3}, {0xE6,0xB0,0x95,3}, {0xE6,0xB0,0x98,3}, {0xE6,0xB0,0x99,3}, {0xE6,0xB0,0x9A,3},
+        {0xE6,0xB0,0xA1,3}, {0xE6,0xB0,0xA9,3}, {0xE6,0xB0,0xA4,3}, {0xE6,0xB0,0xAA,3}, {0xE6,0xB0,0xB2,3}, {0xE6,0x94,0xB5,3}, {0xE6,0x95,0x95,3}, {0xE6,0x95,0xAB,3},
+        {0xE7,0x89,0x8D,3}, {0xE7,0x89,0x92,3}, {0xE7,0x89,0x96,3}, {0xE7,0x88,0xB0,3}, {0xE8,0x99,0xA2,3}, {0xE5,0x88,0x96,3}, {0xE8,0x82,0x9F,3}, {0xE8,0x82,0x9C,3},
+        {0xE8,0x82,0x93,3}, {0xE8,0x82,0xBC,3}, {0xE6,0x9C,0x8A,3}, {0xE8,0x82,0xBD,3}, {0xE8,0x82,0xB1,3}, {0xE8,0x82,0xAB,3}, {0xE8,0x82,0xAD,3}, {0xE8,0x82,0xB4,3},
+        {0xE8,0x82,0xB7,3}, {0xE8,0x83,0xA7,3}, {0xE8,0x83,0xA8,3}, {0xE8,0x83,0xA9,3}, {0xE8,0x83,0xAA,3}, {0xE8,0x83,0x9B,3}, {0xE8,0x83,0x82,3}, {0xE8,0x83,0x84,3},
+        {0xE8,0x83,0x99,3}, {0xE8,0x83,0x8D,3}, {0xE8,0x83,0x97,3}, {0xE6,0x9C,0x90,3}, {0xE8,0x83,0x9D,3}, {0xE8,0x83,0xAB,3}, {0xE8,0x83,0xB1,3}, {0xE8,0x83,0xB4,3},
+        {0xE8,0x83,0xAD,3}, {0xE8,0x84,0x8D,3}, {0xE8,0x84,0x8E,3}, {0xE8,0x83,0xB2,3}, {0xE8,0x83,0xBC,3}, {0xE6,0x9C,0x95,3}, {0xE8,0x84,0x92,3}, {0xE8,0xB1,0x9A,3},
+        {0xE8,0x84,0xB6,3}, {0xE8,0x84,0x9E,3}, {0xE8,0x84,0xAC,3}, {0xE8,0x84,0x98,3}, {0xE8,0x84,0xB2,3}, {0xE8,0x85,0x88,3}, {0xE8,0x85,0x8C,3}, {0xE8,0x85,0x93,3},
+        {0xE8,0x85,0xB4,3}, {0xE8,0x85,0x99,3}, {0xE8,0x85,0x9A,3}, {0xE8,0x85,0xB1,3}, {0xE8,0x85,0xA0,3}, {0xE8,0x85,0xA9,3}, {0xE8,0x85,0xBC,3}, {0xE8,0x85,0xBD,3},
+        {0xE8,0x85,0xAD,3}, {0xE8,0x85,0xA7,3}, {0xE5,0xA1,0x8D,3}, {0xE5,0xAA,0xB5,3}, {0xE8,0x86,0x88,3}, {0xE8,0x86,0x82,3}, {0xE8,0x86,0x91,3}, {0xE6,0xBB,0x95,3},
+        {0xE8,0x86,0xA3,3}, {0xE8,0x86,0xAA,3}, {0xE8,0x87,0x8C,3}, {0xE6,0x9C,0xA6,3}, {0xE8,0x87,0x8A,3}, {0xE8,0x86,0xBB,3},
+    },
+    /* 0xEC */ {
+        {0xE9,0x9C,0xA1,3}, {0xE9,0x9C,0xA2,3}, {0xE9,0x9C,0xA3,3}, {0xE9,0x9C,0xA4,3}, {0xE9,0x9C,0xA5,3}, {0xE9,0x9C,0xA6,3}, {0xE9,0x9C,0xA7,3}, {0xE9,0x9C,0xA8,3},
+        {0xE9,0x9C,0xA9,3}, {0xE9,0x9C,0xAB,3}, {0xE9,0x9C,0xAC,3}, {0xE9,0x9C,0xAE,3}, {0xE9,0x9C,0xAF,3}, {0xE9,0x9C,0xB1,3}, {0xE9,0x9C,0xB3,3}, {0xE9,0x9C,0xB4,3},
+        {0xE9,0x9C,0xB5,3}, {0xE9,0x9C,0xB6,3}, {0xE9,0x9C,0xB7,3}, {0xE9,0x9C,0xBA,3}, {0xE9,0x9C,0xBB,3}, {0xE9,0x9C,0xBC,3}, {0xE9,0x9C,0xBD,3}, {0xE9,0x9C,0xBF,3},
+        {0xE9,0x9D,0x80,3}, {0xE9,0x9D,0x81,3}, {0xE9,0x9D,0x82,3}, {0xE9,0x9D,0x83,3}, {0xE9,0x9D,0x84,3}, {0xE9,0x9D,0x85,3}, {0xE9,0x9D,0x86,3}, {0xE9,0x9D,0x87,3},
+        {0xE9,0x9D,0x88,3}, {0xE9,0x9D,0x89,3}, {0xE9,0x9D,0x8A,3}, {0xE9,0x9D,0x8B,3}, {0xE9,0x9D,0x8C,3}, {0xE9,0x9D,0x8D,3}, {0xE9,0x9D,0x8E,3}, {0xE9,0x9D,0x8F,3},
+        {0xE9,0x9D,0x90,3}, {0xE9,0x9D,0x91,3}, {0xE9,0x9D,0x94,3}, {0xE9,0x9D,0x95,3}, {0xE9,0x9D,0x97,3}, {0xE9,0x9D,0x98,3}, {0xE9,0x9D,0x9A,3}, {0xE9,0x9D,0x9C,3},
+        {0xE9,0x9D,0x9D,3}, {0xE9,0x9D,0x9F,3}, {0xE9,0x9D,0xA3,3}, {0xE9,0x9D,0xA4,3}, {0xE9,0x9D,0xA6,3}, {0xE9,0x9D,0xA7,3}, {0xE9,0x9D,0xA8,3}, {0xE9,0x9D,0xAA,3},
+        {0xE9,0x9D,0xAB,3}, {0xE9,0x9D,0xAC,3}, {0xE9,0x9D,0xAD,3}, {0xE9,0x9D,0xAE,3}, {0xE9,0x9D,0xAF,3}, {0xE9,0x9D,0xB0,3}, {0xE9,0x9D,0xB1,3}, {0xE9,0x9D,0xB2,3},
+        {0xE9,0x9D,0xB5,3}, {0xE9,0x9D,0xB7,3}, {0xE9,0x9D,0xB8,3}, {0xE9,0x9D,0xB9,3}, {0xE9,0x9D,0xBA,3}, {0xE9,0x9D,0xBB,3}, {0xE9,0x9D,0xBD,3}, {0xE9,0x9D,0xBE,3},
+        {0xE9,0x9D,0xBF,3}, {0xE9,0x9E,0x80,3}, {0xE9,0x9E,0x81,3}, {0xE9,0x9E,0x82,3}, {0xE9,0x9E,0x83,3}, {0xE9,0x9E,0x84,3}, {0xE9,0x9E,0x86,3}, {0xE9,0x9E,0x87,3},
+        {0xE9,0x9E,0x88,3}, {0xE9,0x9E,0x89,3}, {0xE9,0x9E,0x8A,3}, {0xE9,0x9E,0x8C,3}, {0xE9,0x9E,0x8E,3}, {0xE9,0x9E,0x8F,3}, {0xE9,0x9E,0x90,3}, {0xE9,0x9E,0x93,3},
+        {0xE9,0x9E,0x95,3}, {0xE9,0x9E,0x96,3}, {0xE9,0x9E,0x97,3}, {0xE9,0x9E,0x99,3}, {0xE9,0x9E,0x9A,3}, {0xE9,0x9E,0x9B,3}, {0xE9,0x9E,0x9C,3}, {0xE9,0x9E,0x9D,3},
+        {0xE8,0x87,0x81,3}, {0xE8,0x86,0xA6,3}, {0xE6,0xAC,0xA4,3}, {0xE6,0xAC,0xB7,3}, {0xE6,0xAC,0xB9,3}, {0xE6,0xAD,0x83,3}, {0xE6,0xAD,0x86,3}, {0xE6,0xAD,0x99,3},
+        {0xE9,0xA3,0x91,3}, {0xE9,0xA3,0x92,3}, {0xE9,0xA3,0x93,3}, {0xE9,0xA3,0x95,3}, {0xE9,0xA3,0x99,3}, {0xE9,0xA3,0x9A,3}, {0xE6,0xAE,0xB3,3}, {0xE5,0xBD,0x80,3},
+        {0xE6,0xAF,0x82,3}, {0xE8,0xA7,0xB3,3}, {0xE6,0x96,0x90,3}, {0xE9,0xBD,0x91,3}, {0xE6,0x96,0x93,3}, {0xE6,0x96,0xBC,3}, {0xE6,0x97,0x86,3}, {0xE6,0x97,0x84,3},
+        {0xE6,0x97,0x83,3}, {0xE6,0x97,0x8C,3}, {0xE6,0x97,0x8E,3}, {0xE6,0x97,0x92,3}, {0xE6,0x97,0x96,3}, {0xE7,0x82,0x80,3}, {0xE7,0x82,0x9C,3}, {0xE7,0x82,0x96,3},
+        {0xE7,0x82,0x9D,3}, {0xE7,0x82,0xBB,3}, {0xE7,0x83,0x80,3}, {0xE7,0x82,0xB7,3}, {0xE7,0x82,0xAB,3}, {0xE7,0x82,0xB1,3}, {0xE7,0x83,0xA8,3}, {0xE7,0x83,0x8A,3},
+        {0xE7,0x84,0x90,3}, {0xE7,0x84,0x93,3}, {0xE7,0x84,0x96,3}, {0xE7,0x84,0xAF,3}, {0xE7,0x84,0xB1,3}, {0xE7,0x85,0xB3,3}, {0xE7,0x85,0x9C,3}, {0xE7,0x85,0xA8,3},
+        {0xE7,0x85,0x85,3}, {0xE7,0x85,0xB2,3}, {0xE7,0x85,0x8A,3}, {0xE7,0x85,0xB8,3}, {0xE7,0x85,0xBA,3}, {0xE7,0x86,0x98,3}, {0xE7,0x86,0xB3,3}, {0xE7,0x86,0xB5,3},
+        {0xE7,0x86,0xA8,3}, {0xE7,0x86,0xA0,3}, {0xE7,0x87,0xA0,3}, {0xE7,0x87,0x94,3}, {0xE7,0x87,0xA7,3}, {0xE7,0x87,0xB9,3}, {0xE7,0x88,0x9D,3}, {0xE7,0x88,0xA8,3},
+        {0xE7,0x81,0xAC,3}, {0xE7,0x84,0x98,3}, {0xE7,0x85,0xA6,3}, {0xE7,0x86,0xB9,3}, {0xE6,0x88,0xBE,3}, {0xE6,0x88,0xBD,3}, {0xE6,0x89,0x83,3}, {0xE6,0x89,0x88,3},
+        {0xE6,0x89,0x89,3}, {0xE7,0xA4,0xBB,3}, {0xE7,0xA5,0x80,3}, {0xE7,0xA5,0x86,3}, {0xE7,0xA5,0x89,3}, {0xE7,0xA5,0x9B,3}, {0xE7,0xA5,0x9C,3}, {0xE7,0xA5,0x93,3},
+        {0xE7,0xA5,0x9A,3}, {0xE7,0xA5,0xA2,3}, {0xE7,0xA5,0x97,3}, {0xE7,0xA5,0xA0,3}, {0xE7,0xA5,0xAF,3}, {0xE7,0xA5,0xA7,3}, {0xE7,0xA5,0xBA,3}, {0xE7,0xA6,0x85,3},
+        {0xE7,0xA6,0x8A,3}, {0xE7,0xA6,0x9A,3}, {0xE7,0xA6,0xA7,3}, {0xE7,0xA6,0xB3,3}, {0xE5,0xBF,0x91,3}, {0xE5,0xBF,0x90,3},
+    },
+    /* 0xED */ {
+        {0xE9,0x9E,0x9E,3}, {0xE9,0x9E,0x9F,3}, {0xE9,0x9E,0xA1,3}, {0xE9,0x9E,0xA2,3}, {0xE9,0x9E,0xA4,3}, {0xE9,0x9E,0xA5,3}, {0xE9,0x9E,0xA6,3}, {0xE9,0x9E,0xA7,3},
+        {0xE9,0x9E,0xA8,3}, {0xE9,0x9E,0xA9,3}, {0xE9,0x9E,0xAA,3}, {0xE9,0x9E,0xAC,3}, {0xE9,0x9E,0xAE,3}, {0xE9,0x9E,0xB0,3}, {0xE9,0x9E,0xB1,3}, {0xE9,0x9E,0xB3,3},
+        {0xE9,0x9E,0xB5,3}, {0xE9,0x9E,0xB6,3}, {0xE9,0x9E,0xB7,3}, {0xE9,0x9E,0xB8,3}, {0xE9,0x9E,0xB9,3}, {0xE9,0x9E,0xBA,3}, {0xE9,0x9E,0xBB,3}, {0xE9,0x9E,0xBC,3},
+        {0xE9,0x9E,0xBD,3}, {0xE9,0x9E,0xBE,3}, {0xE9,0x9E,0xBF,3}, {0xE9,0x9F,0x80,3}, {0xE9,0x9F,0x81,3}, {0xE9,0x9F,0x82,3}, {0xE9,0x9F,0x83,3}, {0xE9,0x9F,0x84,3},
+        {0xE9,0x9F,0x85,3}, {0xE9,0x9F,0x86,3}, {0xE9,0x9F,0x87,3}, {0xE9,0x9F,0x88,3}, {0xE9,0x9F,0x89,3}, {0xE9,0x9F,0x8A,3}, {0xE9,0x9F,0x8B,3}, {0xE9,0x9F,0x8C,3},
+        {0xE9,0x9F,0x8D,3}, {0xE9,0x9F,0x8E,3}, {0xE9,0x9F,0x8F,3}, {0xE9,0x9F,0x90,3}, {0xE9,0x9F,0x91,3}, {0xE9,0x9F,0x92,3}, {0xE9,0x9F,0x93,3}, {0xE9,0x9F,0x94,3},
+        {0xE9,0x9F,0x95,3}, {0xE9,0x9F,0x96,3}, {0xE9,0x9F,0x97,3}, {0xE9,0x9F,0x98,3}, {0xE9,0x9F,0x99,3}, {0xE9,0x9F,0x9A,3}, {0xE9,0x9F,0x9B,3}, {0xE9,0x9F,0x9C,3},
+        {0xE9,0x9F,0x9D,3}, {0xE9,0x9F,0x9E,3}, {0xE9,0x9F,0x9F,3}, {0xE9,0x9F,0xA0,3}, {0xE9,0x9F,0xA1,3}, {0xE9,0x9F,0xA2,3}, {0xE9,0x9F,0xA3,3}, {0xE9,0x9F,0xA4,3},
+        {0xE9,0x9F,0xA5,3}, {0xE9,0x9F,0xA8,3}, {0xE9,0x9F,0xAE,3}, {0xE9,0x9F,0xAF,3}, {0xE9,0x9F,0xB0,3}, {0xE9,0x9F,0xB1,3}, {0xE9,0x9F,0xB2,3}, {0xE9,0x9F,0xB4,3},
+        {0xE9,0x9F,0xB7,3}, {0xE9,0x9F,0xB8,3}, {0xE9,0x9F,0xB9,3}, {0xE9,0x9F,0xBA,3}, {0xE9,0x9F,0xBB,3}, {0xE9,0x9F,0xBC,3}, {0xE9,0x9F,0xBD,3}, {0xE9,0x9F,0xBE,3},
+        {0xE9,0x9F,0xBF,3}, {0xE9,0xA0,0x80,3}, {0xE9,0xA0,0x81,3}, {0xE9,0xA0,0x82,3}, {0xE9,0xA0,0x83,3}, {0xE9,0xA0,0x84,3}, {0xE9,0xA0,0x85,3}, {0xE9,0xA0,0x86,3},
+        {0xE9,0xA0,0x87,3}, {0xE9,0xA0,0x88,3}, {0xE9,0xA0,0x89,3}, {0xE9,0xA0,0x8A,3}, {0xE9,0xA0,0x8B,3}, {0xE9,0xA0,0x8C,3}, {0xE9,0xA0,0x8D,3}, {0xE9,0xA0,0x8E,3},
+        {0xE6,0x80,0xBC,3}, {0xE6,0x81,0x9D,3}, {0xE6,0x81,0x9A,3}, {0xE6,0x81,0xA7,3}, {0xE6,0x81,0x81,3}, {0xE6,0x81,0x99,3}, {0xE6,0x81,0xA3,3}, {0xE6,0x82,0xAB,3},
+        {0xE6,0x84,0x86,3}, {0xE6,0x84,0x8D,3}, {0xE6,0x85,0x9D,3}, {0xE6,0x86,0xA9,3}, {0xE6,0x86,0x9D,3}, {0xE6,0x87,0x8B,3}, {0xE6,0x87,0x91,3}, {0xE6,0x88,0x86,3},
+        {0xE8,0x82,0x80,3}, {0xE8,0x81,0xBF,3}, {0xE6,0xB2,0x93,3}, {0xE6,0xB3,0xB6,3}, {0xE6,0xB7,0xBC,3}, {0xE7,0x9F,0xB6,3}, {0xE7,0x9F,0xB8,3}, {0xE7,0xA0,0x80,3},
+        {0xE7,0xA0,0x89,3}, {0xE7,0xA0,0x97,3}, {0xE7,0xA0,0x98,3}, {0xE7,0xA0,0x91,3}, {0xE6,0x96,0xAB,3}, {0xE7,0xA0,0xAD,3}, {0xE7,0xA0,0x9C,3}, {0xE7,0xA0,0x9D,3},
+        {0xE7,0xA0,0xB9,3}, {0xE7,0xA0,0xBA,3}, {0xE7,0xA0,0xBB,3}, {0xE7,0xA0,0x9F,3}, {0xE7,0xA0,0xBC,3}, {0xE7,0xA0,0xA5,3}, {0xE7,0xA0,0xAC,3}, {0xE7,0xA0,0xA3,3},
+        {0xE7,0xA0,0xA9,3}, {0xE7,0xA1,0x8E,3}, {0xE7,0xA1,0xAD,3}, {0xE7,0xA1,0x96,3}, {0xE7,0xA1,0x97,3}, {0xE7,0xA0,0xA6,3}, {0xE7,0xA1,0x90,3}, {0xE7,0xA1,0x87,3},
+        {0xE7,0xA1,0x8C,3}, {0xE7,0xA1,0xAA,3}, {0xE7,0xA2,0x9B,3}, {0xE7,0xA2,0x93,3}, {0xE7,0xA2,0x9A,3}, {0xE7,0xA2,0x87,3}, {0xE7,0xA2,0x9C,3}, {0xE7,0xA2,0xA1,3},
+        {0xE7,0xA2,0xA3,3}, {0xE7,0xA2,0xB2,3}, {0xE7,0xA2,0xB9,3}, {0xE7,0xA2,0xA5,3}, {0xE7,0xA3,0x94,3}, {0xE7,0xA3,0x99,3}, {0xE7,0xA3,0x89,3}, {0xE7,0xA3,0xAC,3},
+        {0xE7,0xA3,0xB2,3}, {0xE7,0xA4,0x85,3}, {0xE7,0xA3,0xB4,3}, {0xE7,0xA4,0x93,3}, {0xE7,0xA4,0xA4,3}, {0xE7,0xA4,0x9E,3}, {0xE7,0xA4,0xB4,3}, {0xE9,0xBE,0x9B,3},
+        {0xE9,0xBB,0xB9,3}, {0xE9,0xBB,0xBB,3}, {0xE9,0xBB,0xBC,3}, {0xE7,0x9B,0xB1,3}, {0xE7,0x9C,0x84,3}, {0xE7,0x9C,0x8D,3}, {0xE7,0x9B,0xB9,3}, {0xE7,0x9C,0x87,3},
+        {0xE7,0x9C,0x88,3}, {0xE7,0x9C,0x9A,3}, {0xE7,0x9C,0xA2,3}, {0xE7,0x9C,0x99,3}, {0xE7,0x9C,0xAD,3}, {0xE7,0x9C,0xA6,3}, {0xE7,0x9C,0xB5,3}, {0xE7,0x9C,0xB8,3},
+        {0xE7,0x9D,0x90,3}, {0xE7,0x9D,0x91,3}, {0xE7,0x9D,0x87,3}, {0xE7,0x9D,0x83,3}, {0xE7,0x9D,0x9A,3}, {0xE7,0x9D,0xA8,3},
+    },
+    /* 0xEE */ {
+        {0xE9,0xA0,0x8F,3}, {0xE9,0xA0,0x90,3}, {0xE9,0xA0,0x91,3}, {0xE9,0xA0,0x92,3}, {0xE9,0xA0,0x93,3}, {0xE9,0xA0,0x94,3}, {0xE9,0xA0,0x95,3}, {0xE9,0xA0,0x96,3},
+        {0xE9,0xA0,0x97,3}, {0xE9,0xA0,0x98,3}, {0xE9,0xA0,0x99,3}, {0xE9,0xA0,0x9A,3}, {0xE9,0xA0,0x9B,3}, {0xE9,0xA0,0x9C,3}, {0xE9,0xA0,0x9D,3}, {0xE9,0xA0,0x9E,3},
+        {0xE9,0xA0,0x9F,3}, {0xE9,0xA0,0xA0,3}, {0xE9,0xA0,0xA1,3}, {0xE9,0xA0,0xA2,3}, {0xE9,0xA0,0xA3,3}, {0xE9,0xA0,0xA4,3}, {0xE9,0xA0,0xA5,3}, {0xE9,0xA0,0xA6,3},
+        {0xE9,0xA0,0xA7,3}, {0xE9,0xA0,0xA8,3}, {0xE9,0xA0,0xA9,3}, {0xE9,0xA0,0xAA,3}, {0xE9,0xA0,0xAB,3}, {0xE9,0xA0,0xAC,3}, {0xE9,0xA0,0xAD,3}, {0xE9,0xA0,0xAE,3},
+        {0xE9,0xA0,0xAF,3}, {0xE9,0xA0,0xB0,3}, {0xE9,0xA0,0xB1,3}, {0xE9,0xA0,0xB2,3}, {0xE9,0xA0,0xB3,3}, {0xE9,0xA0,0xB4,3}, {0xE9,0xA0,0xB5,3}, {0xE9,0xA0,0xB6,3},
+        {0xE9,0xA0,0xB7,3}, {0xE9,0xA0,0xB8,3}, {0xE9,0xA0,0xB9,3}, {0xE9,0xA0,0xBA,3}, {0xE9,0xA0,0xBB,3}, {0xE9,0xA0,0xBC,3}, {0xE9,0xA0,0xBD,3}, {0xE9,0xA0,0xBE,3},
+        {0xE9,0xA0,0xBF,3}, {0xE9,0xA1,0x80,3}, {0xE9,0xA1,0x81,3}, {0xE9,0xA1,0x82,3}, {0xE9,0xA1,0x83,3}, {0xE9,0xA1,0x84,3}, {0xE9,0xA1,0x85,3}, {0xE9,0xA1,0x86,3},
+        {0xE9,0xA1,0x87,3}, {0xE9,0xA1,0x88,3}, {0xE9,0xA1,0x89,3}, {0xE9,0xA1,0x8A,3}, {0xE9,0xA1,0x8B,3}, {0xE9,0xA1,0x8C,3}, {0xE9,0xA1,0x8D,3}, {0xE9,0xA1,0x8E,3},
+        {0xE9,0xA1,0x8F,3}, {0xE9,0xA1,0x90,3}, {0xE9,0xA1,0x91,3}, {0xE9,0xA1,0x92,3}, {0xE9,0xA1,0x93,3}, {0xE9,0xA1,0x94,3}, {0xE9,0xA1,0x95,3}, {0xE9,0xA1,0x96,3},
+        {0xE9,0xA1,0x97,3}, {0xE9,0xA1,0x98,3}, {0xE9,0xA1,0x99,3}, {0xE9,0xA1,0x9A,3}, {0xE9,0xA1,0x9B,3}, {0xE9,0xA1,0x9C,3}, {0xE9,0xA1,0x9D,3}, {0xE9,0xA1,0x9E,3},
+        {0xE9,0xA1,0x9F,3}, {0xE9,0xA1,0xA0,3}, {0xE9,0xA1,0xA1,3}, {0xE9,0xA1,0xA2,3}, {0xE9,0xA1,0xA3,3}, {0xE9,0xA1,0xA4,3}, {0xE9,0xA1,0xA5,3}, {0xE9,0xA1,0xA6,3},
+        {0xE9,0xA1,0xA7,3}, {0xE9,0xA1,0xA8,3}, {0xE9,0xA1,0xA9,3}, {0xE9,0xA1,0xAA,3}, {0xE9,0xA1,0xAB,3}, {0xE9,0xA1,0xAC,3}, {0xE9,0xA1,0xAD,3}, {0xE9,0xA1,0xAE,3},
+        {0xE7,0x9D,0xA2,3}, {0xE7,0x9D,0xA5,3}, {0xE7,0x9D,0xBF,3}, {0xE7,0x9E,0x8D,3}, {0xE7,0x9D,0xBD,3}, {0xE7,0x9E,0x80,3}, {0xE7,0x9E,0x8C,3}, {0xE7,0x9E,0x91,3},
+        {0xE7,0x9E,0x9F,3}, {0xE7,0x9E,0xA0,3}, {0xE7,0x9E,0xB0,3}, {0xE7,0x9E,0xB5,3}, {0xE7,0x9E,0xBD,3}, {0xE7,0x94,0xBA,3}, {0xE7,0x95,0x80,3}, {0xE7,0x95,0x8E,3},
+        {0xE7,0x95,0x8B,3}, {0xE7,0x95,0x88,3}, {0xE7,0x95,0x9B,3}, {0xE7,0x95,0xB2,3}, {0xE7,0x95,0xB9,3}, {0xE7,0x96,0x83,3}, {0xE7,0xBD,0x98,3}, {0xE7,0xBD,0xA1,3},
+        {0xE7,0xBD,0x9F,3}, {0xE8,0xA9,0x88,3}, {0xE7,0xBD,0xA8,3}, {0xE7,0xBD,0xB4,3}, {0xE7,0xBD,0xB1,3}, {0xE7,0xBD,0xB9,3}, {0xE7,0xBE,0x81,3}, {0xE7,0xBD,0xBE,3},
+        {0xE7,0x9B,0x8D,3}, {0xE7,0x9B,0xA5,3}, {0xE8,0xA0,0xB2,3}, {0xE9,0x92,0x85,3}, {0xE9,0x92,0x86,3}, {0xE9,0x92,0x87,3}, {0xE9,0x92,0x8B,3}, {0xE9,0x92,0x8A,3},
+        {0xE9,0x92,0x8C,3}, {0xE9,0x92,0x8D,3}, {0xE9,0x92,0x8F,3}, {0xE9,0x92,0x90,3}, {0xE9,0x92,0x94,3}, {0xE9,0x92,0x97,3}, {0xE9,0x92,0x95,3}, {0xE9,0x92,0x9A,3},
+        {0xE9,0x92,0x9B,3}, {0xE9,0x92,0x9C,3}, {0xE9,0x92,0xA3,3}, {0xE9,0x92,0xA4,3}, {0xE9,0x92,0xAB,3}, {0xE9,0x92,0xAA,3}, {0xE9,0x92,0xAD,3}, {0xE9,0x92,0xAC,3},
+        {0xE9,0x92,0xAF,3}, {0xE9,0x92,0xB0,3}, {0xE9,0x92,0xB2,3}, {0xE9,0x92,0xB4,3}, {0xE9,0x92,0xB6,3}, {0xE9,0x92,0xB7,3}, {0xE9,0x92,0xB8,3}, {0xE9,0x92,0xB9,3},
+        {0xE9,0x92,0xBA,3}, {0xE9,0x92,0xBC,3}, {0xE9,0x92,0xBD,3}, {0xE9,0x92,0xBF,3}, {0xE9,0x93,0x84,3}, {0xE9,0x93,0x88,3}, {0xE9,0x93,0x89,3}, {0xE9,0x93,0x8A,3},
+        {0xE9,0x93,0x8B,3}, {0xE9,0x93,0x8C,3}, {0xE9,0x93,0x8D,3}, {0xE9,0x93,0x8E,3}, {0xE9,0x93,0x90,3}, {0xE9,0x93,0x91,3}, {0xE9,0x93,0x92,3}, {0xE9,0x93,0x95,3},
+        {0xE9,0x93,0x96,3}, {0xE9,0x93,0x97,3}, {0xE9,0x93,0x99,3}, {0xE9,0x93,0x98,3}, {0xE9,0x93,0x9B,3}, {0xE9,0x93,0x9E,3}, {0xE9,0x93,0x9F,3}, {0xE9,0x93,0xA0,3},
+        {0xE9,0x93,0xA2,3}, {0xE9,0x93,0xA4,3}, {0xE9,0x93,0xA5,3}, {0xE9,0x93,0xA7,3}, {0xE9,0x93,0xA8,3}, {0xE9,0x93,0xAA,3},
+    },
+    /* 0xEF */ {
+        {0xE9,0xA1,0xAF,3}, {0xE9,0xA1,0xB0,3}, {0xE9,0xA1,0xB1,3}, {0xE9,0xA1,0xB2,3}, {0xE9,0xA1,0xB3,3}, {0xE9,0xA1,0xB4,3}, {0xE9,0xA2,0x8B,3}, {0xE9,0xA2,0x8E,3},
+        {0xE9,0xA2,0x92,3}, {0xE9,0xA2,0x95,3}, {0xE9,0xA2,0x99,3}, {0xE9,0xA2,0xA3,3}, {0xE9,0xA2,0xA8,3}, {0xE9,0xA2,0xA9,3}, {0xE9,0xA2,0xAA,3}, {0xE9,0xA2,0xAB,3},
+        {0xE9,0xA2,0xAC,3}, {0xE9,0xA2,0xAD,3}, {0xE9,0xA2,0xAE,3}, {0xE9,0xA2,0xAF,3}, {0xE9,0xA2,0xB0,3}, {0xE9,0xA2,0xB1,3}, {0xE9,0xA2,0xB2,3}, {0xE9,0xA2,0xB3,3},
+        {0xE9,0xA2,0xB4,3}, {0xE9,0xA2,0xB5,3}, {0xE9,0xA2,0xB6,3}, {0xE9,0xA2,0xB7,3}, {0xE9,0xA2,0xB8,3}, {0xE9,0xA2,0xB9,3}, {0xE9,0xA2,0xBA,3}, {0xE9,0xA2,0xBB,3},
+        {0xE9,0xA2,0xBC,3}, {0xE9,0xA2,0xBD,3}, {0xE9,0xA2,0xBE,3}, {0xE9,0xA2,0xBF,3}, {0xE9,0xA3,0x80,3}, {0xE9,0xA3,0x81,3}, {0xE9,0xA3,0x82,3}, {0xE9,0xA3,0x83,3},
+        {0xE9,0xA3,0x84,3}, {0xE9,0xA3,0x85,3}, {0xE9,0xA3,0x86,3}, {0xE9,0xA3,0x87,3}, {0xE9,0xA3,0x88,3}, {0xE9,0xA3,0x89,3}, {0xE9,0xA3,0x8A,3}, {0xE9,0xA3,0x8B,3},
+        {0xE9,0xA3,0x8C,3}, {0xE9,0xA3,0x8D,3}, {0xE9,0xA3,0x8F,3}, {0xE9,0xA3,0x90,3}, {0xE9,0xA3,0x94,3}, {0xE9,0xA3,0x96,3}, {0xE9,0xA3,0x97,3}, {0xE9,0xA3,0x9B,3},
+        {0xE9,0xA3,0x9C,3}, {0xE9,0xA3,0x9D,3}, {0xE9,0xA3,0xA0,3}, {0xE9,0xA3,0xA1,3}, {0xE9,0xA3,0xA2,3}, {0xE9,0xA3,0xA3,3}, {0xE9,0xA3,0xA4,3}, {0xE9,0xA3,0xA5,3},
+        {0xE9,0xA3,0xA6,3}, {0xE9,0xA3,0xA9,3}, {0xE9,0xA3,0xAA,3}, {0xE9,0xA3,0xAB,3}, {0xE9,0xA3,0xAC,3}, {0xE9,0xA3,0xAD,3}, {0xE9,0xA3,0xAE,3}, {0xE9,0xA3,0xAF,3},
+        {0xE9,0xA3,0xB0,3}, {0xE9,0xA3,0xB1,3}, {0xE9,0xA3,0xB2,3}, {0xE9,0xA3,0xB3,3}, {0xE9,0xA3,0xB4,3}, {0xE9,0xA3,0xB5,3}, {0xE9,0xA3,0xB6,3}, {0xE9,0xA3,0xB7,3},
+        {0xE9,0xA3,0xB8,3}, {0xE9,0xA3,0xB9,3}, {0xE9,0xA3,0xBA,3}, {0xE9,0xA3,0xBB,3}, {0xE9,0xA3,0xBC,3}, {0xE9,0xA3,0xBD,3}, {0xE9,0xA3,0xBE,3}, {0xE9,0xA3,0xBF,3},
+        {0xE9,0xA4,0x80,3}, {0xE9,0xA4,0x81,3}, {0xE9,0xA4,0x82,3}, {0xE9,0xA4,0x83,3}, {0xE9,0xA4,0x84,3}, {0xE9,0xA4,0x85,3}, {0xE9,0xA4,0x86,3}, {0xE9,0xA4,0x87,3},
+        {0xE9,0x93,0xA9,3}, {0xE9,0x93,0xAB,3}, {0xE9,0x93,0xAE,3}, {0xE9,0x93,0xAF,3}, {0xE9,0x93,0xB3,3}, {0xE9,0x93,0xB4,3}, {0xE9,0x93,0xB5,3}, {0xE9,0x93,0xB7,3},
+        {0xE9,0x93,0xB9,3}, {0xE9,0x93,0xBC,3}, {0xE9,0x93,0xBD,3}, {0xE9,0x93,0xBF,3}, {0xE9,0x94,0x83,3}, {0xE9,0x94,0x82,3}, {0xE9,0x94,0x86,3}, {0xE9,0x94,0x87,3},
+        {0xE9,0x94,0x89,3}, {0xE9,0x94,0x8A,3}, {0xE9,0x94,0x8D,3}, {0xE9,0x94,0x8E,3}, {0xE9,0x94,0x8F,3}, {0xE9,0x94,0x92,3}, {0xE9,0x94,0x93,3}, {0xE9,0x94,0x94,3},
+        {0xE9,0x94,0x95,3}, {0xE9,0x94,0x96,3}, {0xE9,0x94,0x98,3}, {0xE9,0x94,0x9B,3}, {0xE9,0x94,0x9D,3}, {0xE9,0x94,0x9E,3}, {0xE9,0x94,0x9F,3}, {0xE9,0x94,0xA2,3},
+        {0xE9,0x94,0xAA,3}, {0xE9,0x94,0xAB,3}, {0xE9,0x94,0xA9,3}, {0xE9,0x94,0xAC,3}, {0xE9,0x94,0xB1,3}, {0xE9,0x94,0xB2,3}, {0xE9,0x94,0xB4,3}, {0xE9,0x94,0xB6,3},
+        {0xE9,0x94,0xB7,3}, {0xE9,0x94,0xB8,3}, {0xE9,0x94,0xBC,3}, {0xE9,0x94,0xBE,3}, {0xE9,0x94,0xBF,3}, {0xE9,0x95,0x82,3}, {0xE9,0x94,0xB5,3}, {0xE9,0x95,0x84,3},
+        {0xE9,0x95,0x85,3}, {0xE9,0x95,0x86,3}, {0xE9,0x95,0x89,3}, {0xE9,0x95,0x8C,3}, {0xE9,0x95,0x8E,3}, {0xE9,0x95,0x8F,3}, {0xE9,0x95,0x92,3}, {0xE9,0x95,0x93,3},
+        {0xE9,0x95,0x94,3}, {0xE9,0x95,0x96,3}, {0xE9,0x95,0x97,3}, {0xE9,0x95,0x98,3}, {0xE9,0x95,0x99,3}, {0xE9,0x95,0x9B,3}, {0xE9,0x95,0x9E,3}, {0xE9,0x95,0x9F,3},
+        {0xE9,0x95,0x9D,3}, {0xE9,0x95,0xA1,3}, {0xE9,0x95,0xA2,3}, {0xE9,0x95,0xA4,3}, {0xE9,0x95,0xA5,3}, {0xE9,0x95,0xA6,3}, {0xE9,0x95,0xA7,3}, {0xE9,0x95,0xA8,3},
+        {0xE9,0x95,0xA9,3}, {0xE9,0x95,0xAA,3}, {0xE9,0x95,0xAB,3}, {0xE9,0x95,0xAC,3}, {0xE9,0x95,0xAF,3}, {0xE9,0x95,0xB1,3}, {0xE9,0x95,0xB2,3}, {0xE9,0x95,0xB3,3},
+        {0xE9,0x94,0xBA,3}, {0xE7,0x9F,0xA7,3}, {0xE7,0x9F,0xAC,3}, {0xE9,0x9B,0x89,3}, {0xE7,0xA7,0x95,3}, {0xE7,0xA7,0xAD,3}, {0xE7,0xA7,0xA3,3}, {0xE7,0xA7,0xAB,3},
+        {0xE7,0xA8,0x86,3}, {0xE5,0xB5,0x87,3}, {0xE7,0xA8,0x83,3}, {0xE7,0xA8,0x82,3}, {0xE7,0xA8,0x9E,3}, {0xE7,0xA8,0x94,3},
+    },
+    /* 0xF0 */ {
+        {0xE9,0xA4,0x88,3}, {0xE9,0xA4,0x89,3}, {0xE9,0xA4,0x8A,3}, {0xE9,0xA4,0x8B,3}, {0xE9,0xA4,0x8C,3}, {0xE9,0xA4,0x8E,3}, {0xE9,0xA4,0x8F,3}, {0xE9,0xA4,0x91,3},
+        {0xE9,0xA4,0x92,3}, {0xE9,0xA4,0x93,3}, {0xE9,0xA4,0x94,3}, {0xE9,0xA4,0x95,3}, {0xE9,0xA4,0x96,3}, {0xE9,0xA4,0x97,3}, {0xE9,0xA4,0x98,3}, {0xE9,0xA4,0x99,3},
+        {0xE9,0xA4,0x9A,3}, {0xE9,0xA4,0x9B,3}, {0xE9,0xA4,0x9C,3}, {0xE9,0xA4,0x9D,3}, {0xE9,0xA4,0x9E,3}, {0xE9,0xA4,0x9F,3}, {0xE9,0xA4,0xA0,3}, {0xE9,0xA4,0xA1,3},
+        {0xE9,0xA4,0xA2,3}, {0xE9,0xA4,0xA3,3}, {0xE9,0xA4,0xA4,3}, {0xE9,0xA4,0xA5,3}, {0xE9,0xA4,0xA6,3}, {0xE9,0xA4,0xA7,3}, {0xE9,0xA4,0xA8,3}, {0xE9,0xA4,0xA9,3},
+        {0xE9,0xA4,0xAA,3}, {0xE9,0xA4,0xAB,3}, {0xE9,0xA4,0xAC,3}, {0xE9,0xA4,0xAD,3}, {0xE9,0xA4,0xAF,3}, {0xE9,0xA4,0xB0,3}, {0xE9,0xA4,0xB1,3}, {0xE9,0xA4,0xB2,3},
+        {0xE9,0xA4,0xB3,3}, {0xE9,0xA4,0xB4,3}, {0xE9,0xA4,0xB5,3}, {0xE9,0xA4,0xB6,3}, {0xE9,0xA4,0xB7,3}, {0xE9,0xA4,0xB8,3}, {0xE9,0xA4,0xB9,3}, {0xE9,0xA4,0xBA,3},
+        {0xE9,0xA4,0xBB,3}, {0xE9,0xA4,0xBC,3}, {0xE9,0xA4,0xBD,3}, {0xE9,0xA4,0xBE,3}, {0xE9,0xA4,0xBF,3}, {0xE9,0xA5,0x80,3}, {0xE9,0xA5,0x81,3}, {0xE9,0xA5,0x82,3},
+        {0xE9,0xA5,0x83,3}, {0xE9,0xA5,0x84,3}, {0xE9,0xA5,0x85,3}, {0xE9,0xA5,0x86,3}, {0xE9,0xA5,0x87,3}, {0xE9,0xA5,0x88,3}, {0xE9,0xA5,0x89,3}, {0xE9,0xA5,0x8A,3},
+        {0xE9,0xA5,0x8B,3}, {0xE9,0xA5,0x8C,3}, {0xE9,0xA5,0x8D,3}, {0xE9,0xA5,0x8E,3}, {0xE9,0xA5,0x8F,3}, {0xE9,0xA5,0x90,3}, {0xE9,0xA5,0x91,3}, {0xE9,0xA5,0x92,3},
+        {0xE9,0xA5,0x93,3}, {0xE9,0xA5,0x96,3}, {0xE9,0xA5,0x97,3}, {0xE9,0xA5,0x98,3}, {0xE9,0xA5,0x99,3}, {0xE9,0xA5,0x9A,3}, {0xE9,0xA5,0x9B,3}, {0xE9,0xA5,0x9C,3},
+        {0xE9,0xA5,0x9D,3}, {0xE9,0xA5,0x9E,3}, {0xE9,0xA5,0x9F,3}, {0xE9,0xA5,0xA0,3}, {0xE9,0xA5,0xA1,3}, {0xE9,0xA5,0xA2,3}, {0xE9,0xA5,0xA4,3}, {0xE9,0xA5,0xA6,3},
+        {0xE9,0xA5,0xB3,3}, {0xE9,0xA5,0xB8,3}, {0xE9,0xA5,0xB9,3}, {0xE9,0xA5,0xBB,3}, {0xE9,0xA5,0xBE,3}, {0xE9,0xA6,0x82,3}, {0xE9,0xA6,0x83,3}, {0xE9,0xA6,0x89,3},
+        {0xE7,0xA8,0xB9,3}, {0xE7,0xA8,0xB7,3}, {0xE7,0xA9,0x91,3}, {0xE9,0xBB,0x8F,3}, {0xE9,0xA6,0xA5,3}, {0xE7,0xA9,0xB0,3}, {0xE7,0x9A,0x88,3}, {0xE7,0x9A,0x8E,3},
+        {0xE7,0x9A,0x93,3}, {0xE7,0x9A,0x99,3}, {0xE7,0x9A,0xA4,3}, {0xE7,0x93,0x9E,3}, {0xE7,0x93,0xA0,3}, {0xE7,0x94,0xAC,3}, {0xE9,0xB8,0xA0,3}, {0xE9,0xB8,0xA2,3},
+        {0xE9,0xB8,0xA8,3}, {0xE9,0xB8,0xA9,3}, {0xE9,0xB8,0xAA,3}, {0xE9,0xB8,0xAB,3}, {0xE9,0xB8,0xAC,3}, {0xE9,0xB8,0xB2,3}, {0xE9,0xB8,0xB1,3}, {0xE9,0xB8,0xB6,3},
+        {0xE9,0xB8,0xB8,3}, {0xE9,0xB8,0xB7,3}, {0xE9,0xB8,0xB9,3}, {0xE9,0xB8,0xBA,3}, {0xE9,0xB8,0xBE,3}, {0xE9,0xB9,0x81,3}, {0xE9,0xB9,0x82,3}, {0xE9,0xB9,0x84,3},
+        {0xE9,0xB9,0x86,3}, {0xE9,0xB9,0x87,3}, {0xE9,0xB9,0x88,3}, {0xE9,0xB9,0x89,3}, {0xE9,0xB9,0x8B,3}, {0xE9,0xB9,0x8C,3}, {0xE9,0xB9,0x8E,3}, {0xE9,0xB9,0x91,3},
+        {0xE9,0xB9,0x95,3}, {0xE9,0xB9,0x97,3}, {0xE9,0xB9,0x9A,3}, {0xE9,0xB9,0x9B,3}, {0xE9,0xB9,0x9C,3}, {0xE9,0xB9,0x9E,3}, {0xE9,0xB9,0xA3,3}, {0xE9,0xB9,0xA6,3},
+        {0xE9,0xB9,0xA7,3}, {0xE9,0xB9,0xA8,3}, {0xE9,0xB9,0xA9,3}, {0xE9,0xB9,0xAA,3}, {0xE9,0xB9,0xAB,3}, {0xE9,0xB9,0xAC,3}, {0xE9,0xB9,0xB1,3}, {0xE9,0xB9,0xAD,3},
+        {0xE9,0xB9,0xB3,3}, {0xE7,0x96,0x92,3}, {0xE7,0x96,0x94,3}, {0xE7,0x96,0x96,3}, {0xE7,0x96,0xA0,3}, {0xE7,0x96,0x9D,3}, {0xE7,0x96,0xAC,3}, {0xE7,0x96,0xA3,3},
+        {0xE7,0x96,0xB3,3}, {0xE7,0x96,0xB4,3}, {0xE7,0x96,0xB8,3}, {0xE7,0x97,0x84,3}, {0xE7,0x96,0xB1,3}, {0xE7,0x96,0xB0,3}, {0xE7,0x97,0x83,3}, {0xE7,0x97,0x82,3},
+        {0xE7,0x97,0x96,3}, {0xE7,0x97,0x8D,3}, {0xE7,0x97,0xA3,3}, {0xE7,0x97,0xA8,3}, {0xE7,0x97,0xA6,3}, {0xE7,0x97,0xA4,3}, {0xE7,0x97,0xAB,3}, {0xE7,0x97,0xA7,3},
+        {0xE7,0x98,0x83,3}, {0xE7,0x97,0xB1,3}, {0xE7,0x97,0xBC,3}, {0xE7,0x97,0xBF,3}, {0xE7,0x98,0x90,3}, {0xE7,0x98,0x80,3}, {0xE7,0x98,0x85,3}, {0xE7,0x98,0x8C,3},
+        {0xE7,0x98,0x97,3}, {0xE7,0x98,0x8A,3}, {0xE7,0x98,0xA5,3}, {0xE7,0x98,0x98,3}, {0xE7,0x98,0x95,3}, {0xE7,0x98,0x99,3},
+    },
+    /* 0xF1 */ {
+        {0xE9,0xA6,0x8C,3}, {0xE9,0xA6,0x8E,3}, {0xE9,0xA6,0x9A,3}, {0xE9,0xA6,0x9B,3}, {0xE9,0xA6,0x9C,3}, {0xE9,0xA6,0x9D,3}, {0xE9,0xA6,0x9E,3}, {0xE9,0xA6,0x9F,3},
+        {0xE9,0xA6,0xA0,3}, {0xE9,0xA6,0xA1,3}, {0xE9,0xA6,0xA2,3}, {0xE9,0xA6,0xA3,3}, {0xE9,0xA6,0xA4,3}, {0xE9,0xA6,0xA6,3}, {0xE9,0xA6,0xA7,3}, {0xE9,0xA6,0xA9,3},
+        {0xE9,0xA6,0xAA,3}, {0xE9,0xA6,0xAB,3}, {0xE9,0xA6,0xAC,3}, {0xE9,0xA6,0xAD,3}, {0xE9,0xA6,0xAE,3}, {0xE9,0xA6,0xAF,3}, {0xE9,0xA6,0xB0,3}, {0xE9,0xA6,0xB1,3},
+        {0xE9,0xA6,0xB2,3}, {0xE9,0xA6,0xB3,3}, {0xE9,0xA6,0xB4,3}, {0xE9,0xA6,0xB5,3}, {0xE9,0xA6,0xB6,3}, {0xE9,0xA6,0xB7,3}, {0xE9,0xA6,0xB8,3}, {0xE9,0xA6,0xB9,3},
+        {0xE9,0xA6,0xBA,3}, {0xE9,0xA6,0xBB,3}, {0xE9,0xA6,0xBC,3}, {0xE9,0xA6,0xBD,3}, {0xE9,0xA6,0xBE,3}, {0xE9,0xA6,0xBF,3}, {0xE9,0xA7,0x80,3}, {0xE9,0xA7,0x81,3},
+        {0xE9,0xA7,0x82,3}, {0xE9,0xA7,0x83,3}, {0xE9,0xA7,0x84,3}, {0xE9,0xA7,0x85,3}, {0xE9,0xA7,0x86,3}, {0xE9,0xA7,0x87,3}, {0xE9,0xA7,0x88,3}, {0xE9,0xA7,0x89,3},
+        {0xE9,0xA7,0x8A,3}, {0xE9,0xA7,0x8B,3}, {0xE9,0xA7,0x8C,3}, {0xE9,0xA7,0x8D,3}, {0xE9,0xA7,0x8E,3}, {0xE9,0xA7,0x8F,3}, {0xE9,0xA7,0x90,3}, {0xE9,0xA7,0x91,3},
+        {0xE9,0xA7,0x92,3}, {0xE9,0xA7,0x93,3}, {0xE9,0xA7,0x94,3}, {0xE9,0xA7,0x95,3}, {0xE9,0xA7,0x96,3}, {0xE9,0xA7,0x97,3}, {0xE9,0xA7,0x98,3}, {0xE9,0xA7,0x99,3},
+        {0xE9,0xA7,0x9A,3}, {0xE9,0xA7,0x9B,3}, {0xE9,0xA7,0x9C,3}, {0xE9,0xA7,0x9D,3}, {0xE9,0xA7,0x9E,3}, {0xE9,0xA7,0x9F,3}, {0xE9,0xA7,0xA0,3}, {0xE9,0xA7,0xA1,3},
+        {0xE9,0xA7,0xA2,3}, {0xE9,0xA7,0xA3,3}, {0xE9,0xA7,0xA4,3}, {0xE9,0xA7,0xA5,3}, {0xE9,0xA7,0xA6,3}, {0xE9,0xA7,0xA7,3}, {0xE9,0xA7,0xA8,3}, {0xE9,0xA7,0xA9,3},
+        {0xE9,0xA7,0xAA,3}, {0xE9,0xA7,0xAB,3}, {0xE9,0xA7,0xAC,3}, {0xE9,0xA7,0xAD,3}, {0xE9,0xA7,0xAE,3}, {0xE9,0xA7,0xAF,3}, {0xE9,0xA7,0xB0,3}, {0xE9,0xA7,0xB1,3},
+        {0xE9,0xA7,0xB2,3}, {0xE9,0xA7,0xB3,3}, {0xE9,0xA7,0xB4,3}, {0xE9,0xA7,0xB5,3}, {0xE9,0xA7,0xB6,3}, {0xE9,0xA7,0xB7,3}, {0xE9,0xA7,0xB8,3}, {0xE9,0xA7,0xB9,3},
+        {0xE7,0x98,0x9B,3}, {0xE7,0x98,0xBC,3}, {0xE7,0x98,0xA2,3}, {0xE7,0x98,0xA0,3}, {0xE7,0x99,0x80,3}, {0xE7,0x98,0xAD,3}, {0xE7,0x98,0xB0,3}, {0xE7,0x98,0xBF,3},
+        {0xE7,0x98,0xB5,3}, {0xE7,0x99,0x83,3}, {0xE7,0x98,0xBE,3}, {0xE7,0x98,0xB3,3}, {0xE7,0x99,0x8D,3}, {0xE7,0x99,0x9E,3}, {0xE7,0x99,0x94,3}, {0xE7,0x99,0x9C,3},
+        {0xE7,0x99,0x96,3}, {0xE7,0x99,0xAB,3}, {0xE7,0x99,0xAF,3}, {0xE7,0xBF,0x8A,3}, {0xE7,0xAB,0xA6,3}, {0xE7,0xA9,0xB8,3}, {0xE7,0xA9,0xB9,3}, {0xE7,0xAA,0x80,3},
+        {0xE7,0xAA,0x86,3}, {0xE7,0xAA,0x88,3}, {0xE7,0xAA,0x95,3}, {0xE7,0xAA,0xA6,3}, {0xE7,0xAA,0xA0,3}, {0xE7,0xAA,0xAC,3}, {0xE7,0xAA,0xA8,3}, {0xE7,0xAA,0xAD,3},
+        {0xE7,0xAA,0xB3,3}, {0xE8,0xA1,0xA4,3}, {0xE8,0xA1,0xA9,3}, {0xE8,0xA1,0xB2,3}, {0xE8,0xA1,0xBD,3}, {0xE8,0xA1,0xBF,3}, {0xE8,0xA2,0x82,3}, {0xE8,0xA2,0xA2,3},
+        {0xE8,0xA3,0x86,3}, {0xE8,0xA2,0xB7,3}, {0xE8,0xA2,0xBC,3}, {0xE8,0xA3,0x89,3}, {0xE8,0xA3,0xA2,3}, {0xE8,0xA3,0x8E,3}, {0xE8,0xA3,0xA3,3}, {0xE8,0xA3,0xA5,3},
+        {0xE8,0xA3,0xB1,3}, {0xE8,0xA4,0x9A,3}, {0xE8,0xA3,0xBC,3}, {0xE8,0xA3,0xA8,3}, {0xE8,0xA3,0xBE,3}, {0xE8,0xA3,0xB0,3}, {0xE8,0xA4,0xA1,3}, {0xE8,0xA4,0x99,3},
+        {0xE8,0xA4,0x93,3}, {0xE8,0xA4,0x9B,3}, {0xE8,0xA4,0x8A,3}, {0xE8,0xA4,0xB4,3}, {0xE8,0xA4,0xAB,3}, {0xE8,0xA4,0xB6,3}, {0xE8,0xA5,0x81,3}, {0xE8,0xA5,0xA6,3},
+        {0xE8,0xA5,0xBB,3}, {0xE7,0x96,0x8B,3}, {0xE8,0x83,0xA5,3}, {0xE7,0x9A,0xB2,3}, {0xE7,0x9A,0xB4,3}, {0xE7,0x9F,0x9C,3}, {0xE8,0x80,0x92,3}, {0xE8,0x80,0x94,3},
+        {0xE8,0x80,0x96,3}, {0xE8,0x80,0x9C,3}, {0xE8,0x80,0xA0,3}, {0xE8,0x80,0xA2,3}, {0xE8,0x80,0xA5,3}, {0xE8,0x80,0xA6,3}, {0xE8,0x80,0xA7,3}, {0xE8,0x80,0xA9,3},
+        {0xE8,0x80,0xA8,3}, {0xE8,0x80,0xB1,3}, {0xE8,0x80,0x8B,3}, {0xE8,0x80,0xB5,3}, {0xE8,0x81,0x83,3}, {0xE8,0x81,0x86,3}, {0xE8,0x81,0x8D,3}, {0xE8,0x81,0x92,3},
+        {0xE8,0x81,0xA9,3}, {0xE8,0x81,0xB1,3}, {0xE8,0xA6,0x83,3}, {0xE9,0xA1,0xB8,3}, {0xE9,0xA2,0x80,3}, {0xE9,0xA2,0x83,3},
+    },
+    /* 0xF2 */ {
+        {0xE9,0xA7,0xBA,3}, {0xE9,0xA7,0xBB,3}, {0xE9,0xA7,0xBC,3}, {0xE9,0xA7,0xBD,3}, {0xE9,0xA7,0xBE,3}, {0xE9,0xA7,0xBF,3}, {0xE9,0xA8,0x80,3}, {0xE9,0xA8,0x81,3},
+        {0xE9,0xA8,0x82,3}, {0xE9,0xA8,0x83,3}, {0xE9,0xA8,0x84,3}, {0xE9,0xA8,0x85,3}, {0xE9,0xA8,0x86,3}, {0xE9,0xA8,0x87,3}, {0xE9,0xA8,0x88,3}, {0xE9,0xA8,0x89,3},
+        {0xE9,0xA8,0x8A,3}, {0xE9,0xA8,0x8B,3}, {0xE9,0xA8,0x8C,3}, {0xE9,0xA8,0x8D,3}, {0xE9,0xA8,0x8E,3}, {0xE9,0xA8,0x8F,3}, {0xE9,0xA8,0x90,3}, {0xE9,0xA8,0x91,3},
+        {0xE9,0xA8,0x92,3}, {0xE9,0xA8,0x93,3}, {0xE9,0xA8,0x94,3}, {0xE9,0xA8,0x95,3}, {0xE9,0xA8,0x96,3}, {0xE9,0xA8,0x97,3}, {0xE9,0xA8,0x98,3}, {0xE9,0xA8,0x99,3},
+        {0xE9,0xA8,0x9A,3}, {0xE9,0xA8,0x9B,3}, {0xE9,0xA8,0x9C,3}, {0xE9,0xA8,0x9D,3}, {0xE9,0xA8,0x9E,3}, {0xE9,0xA8,0x9F,3}, {0xE9,0xA8,0xA0,3}, {0xE9,0xA8,0xA1,3},
+        {0xE9,0xA8,0xA2,3}, {0xE9,0xA8,0xA3,3}, {0xE9,0xA8,0xA4,3}, {0xE9,0xA8,0xA5,3}, {0xE9,0xA8,0xA6,3}, {0xE9,0xA8,0xA7,3}, {0xE9,0xA8,0xA8,3}, {0xE9,0xA8,0xA9,3},
+        {0xE9,0xA8,0xAA,3}, {0xE9,0xA8,0xAB,3}, {0xE9,0xA8,0xAC,3}, {0xE9,0xA8,0xAD,3}, {0xE9,0xA8,0xAE,3}, {0xE9,0xA8,0xAF,3}, {0xE9,0xA8,0xB0,3}, {0xE9,0xA8,0xB1,3},
+        {0xE9,0xA8,0xB2,3}, {0xE9,0xA8,0xB3,3}, {0xE9,0xA8,0xB4,3}, {0xE9,0xA8,0xB5,3}, {0xE9,0xA8,0xB6,3}, {0xE9,0xA8,0xB7,3}, {0xE9,0xA8,0xB8,3}, {0xE9,0xA8,0xB9,3},
+        {0xE9,0xA8,0xBA,3}, {0xE9,0xA8,0xBB,3}, {0xE9,0xA8,0xBC,3}, {0xE9,0xA8,0xBD,3}, {0xE9,0xA8,0xBE,3}, {0xE9,0xA8,0xBF,3}, {0xE9,0xA9,0x80,3}, {0xE9,0xA9,0x81,3},
+        {0xE9,0xA9,0x82,3}, {0xE9,0xA9,0x83,3}, {0xE9,0xA9,0x84,3}, {0xE9,0xA9,0x85,3}, {0xE9,0xA9,0x86,3}, {0xE9,0xA9,0x87,3}, {0xE9,0xA9,0x88,3}, {0xE9,0xA9,0x89,3},
+        {0xE9,0xA9,0x8A,3}, {0xE9,0xA9,0x8B,3}, {0xE9,0xA9,0x8C,3}, {0xE9,0xA9,0x8D,3}, {0xE9,0xA9,0x8E,3}, {0xE9,0xA9,0x8F,3}, {0xE9,0xA9,0x90,3}, {0xE9,0xA9,0x91,3},
+        {0xE9,0xA9,0x92,3}, {0xE9,0xA9,0x93,3}, {0xE9,0xA9,0x94,3}, {0xE9,0xA9,0x95,3}, {0xE9,0xA9,0x96,3}, {0xE9,0xA9,0x97,3}, {0xE9,0xA9,0x98,3}, {0xE9,0xA9,0x99,3},
+        {0xE9,0xA2,0x89,3}, {0xE9,0xA2,0x8C,3}, {0xE9,0xA2,0x8D,3}, {0xE9,0xA2,0x8F,3}, {0xE9,0xA2,0x94,3}, {0xE9,0xA2,0x9A,3}, {0xE9,0xA2,0x9B,3}, {0xE9,0xA2,0x9E,3},
+        {0xE9,0xA2,0x9F,3}, {0xE9,0xA2,0xA1,3}, {0xE9,0xA2,0xA2,3}, {0xE9,0xA2,0xA5,3}, {0xE9,0xA2,0xA6,3}, {0xE8,0x99,0x8D,3}, {0xE8,0x99,0x94,3}, {0xE8,0x99,0xAC,3},
+        {0xE8,0x99,0xAE,3}, {0xE8,0x99,0xBF,3}, {0xE8,0x99,0xBA,3}, {0xE8,0x99,0xBC,3}, {0xE8,0x99,0xBB,3}, {0xE8,0x9A,0xA8,3}, {0xE8,0x9A,0x8D,3}, {0xE8,0x9A,0x8B,3},
+        {0xE8,0x9A,0xAC,3}, {0xE8,0x9A,0x9D,3}, {0xE8,0x9A,0xA7,3}, {0xE8,0x9A,0xA3,3}, {0xE8,0x9A,0xAA,3}, {0xE8,0x9A,0x93,3}, {0xE8,0x9A,0xA9,3}, {0xE8,0x9A,0xB6,3},
+        {0xE8,0x9B,0x84,3}, {0xE8,0x9A,0xB5,3}, {0xE8,0x9B,0x8E,3}, {0xE8,0x9A,0xB0,3}, {0xE8,0x9A,0xBA,3}, {0xE8,0x9A,0xB1,3}, {0xE8,0x9A,0xAF,3}, {0xE8,0x9B,0x89,3},
+        {0xE8,0x9B,0x8F,3}, {0xE8,0x9A,0xB4,3}, {0xE8,0x9B,0xA9,3}, {0xE8,0x9B,0xB1,3}, {0xE8,0x9B,0xB2,3}, {0xE8,0x9B,0xAD,3}, {0xE8,0x9B,0xB3,3}, {0xE8,0x9B,0x90,3},
+        {0xE8,0x9C,0x93,3}, {0xE8,0x9B,0x9E,3}, {0xE8,0x9B,0xB4,3}, {0xE8,0x9B,0x9F,3}, {0xE8,0x9B,0x98,3}, {0xE8,0x9B,0x91,3}, {0xE8,0x9C,0x83,3}, {0xE8,0x9C,0x87,3},
+        {0xE8,0x9B,0xB8,3}, {0xE8,0x9C,0x88,3}, {0xE8,0x9C,0x8A,3}, {0xE8,0x9C,0x8D,3}, {0xE8,0x9C,0x89,3}, {0xE8,0x9C,0xA3,3}, {0xE8,0x9C,0xBB,3}, {0xE8,0x9C,0x9E,3},
+        {0xE8,0x9C,0xA5,3}, {0xE8,0x9C,0xAE,3}, {0xE8,0x9C,0x9A,3}, {0xE8,0x9C,0xBE,3}, {0xE8,0x9D,0x88,3}, {0xE8,0x9C,0xB4,3}, {0xE8,0x9C,0xB1,3}, {0xE8,0x9C,0xA9,3},
+        {0xE8,0x9C,0xB7,3}, {0xE8,0x9C,0xBF,3}, {0xE8,0x9E,0x82,3}, {0xE8,0x9C,0xA2,3}, {0xE8,0x9D,0xBD,3}, {0xE8,0x9D,0xBE,3}, {0xE8,0x9D,0xBB,3}, {0xE8,0x9D,0xA0,3},
+        {0xE8,0x9D,0xB0,3}, {0xE8,0x9D,0x8C,3}, {0xE8,0x9D,0xAE,3}, {0xE8,0x9E,0x8B,3}, {0xE8,0x9D,0x93,3}, {0xE8,0x9D,0xA3,3}, {0xE8,0x9D,0xBC,3}, {0xE8,0x9D,0xA4,3},
+        {0xE8,0x9D,0x99,3}, {0xE8,0x9D,0xA5,3}, {0xE8,0x9E,0x93,3}, {0xE8,0x9E,0xAF,3}, {0xE8,0x9E,0xA8,3}, {0xE8,0x9F,0x92,3},
+    },
+    /* 0xF3 */ {
+        {0xE9,0xA9,0x9A,3}, {0xE9,0xA9,0x9B,3}, {0xE9,0xA9,0x9C,3}, {0xE9,0xA9,0x9D,3}, {0xE9,0xA9,0x9E,3}, {0xE9,0xA9,0x9F,3}, {0xE9,0xA9,0xA0,3}, {0xE9,0xA9,0xA1,3},
+        {0xE9,0xA9,0xA2,3}, {0xE9,0xA9,0xA3,3}, {0xE9,0xA9,0xA4,3}, {0xE9,0xA9,0xA5,3}, {0xE9,0xA9,0xA6,3}, {0xE9,0xA9,0xA7,3}, {0xE9,0xA9,0xA8,3}, {0xE9,0xA9,0xA9,3},
+        {0xE9,0xA9,0xAA,3}, {0xE9,0xA9,0xAB,3}, {0xE9,0xA9,0xB2,3}, {0xE9,0xAA,0x83,3}, {0xE9,0xAA,0x89,3}, {0xE9,0xAA,0x8D,3}, {0xE9,0xAA,0x8E,3}, {0xE9,0xAA,0x94,3},
+        {0xE9,0xAA,0x95,3}, {0xE9,0xAA,0x99,3}, {0xE9,0xAA,0xA6,3}, {0xE9,0xAA,0xA9,3}, {0xE9,0xAA,0xAA,3}, {0xE9,0xAA,0xAB,3}, {0xE9,0xAA,0xAC,3}, {0xE9,0xAA,0xAD,3},
+        {0xE9,0xAA,0xAE,3}, {0xE9,0xAA,0xAF,3}, {0xE9,0xAA,0xB2,3}, {0xE9,0xAA,0xB3,3}, {0xE9,0xAA,0xB4,3}, {0xE9,0xAA,0xB5,3}, {0xE9,0xAA,0xB9,3}, {0xE9,0xAA,0xBB,3},
+        {0xE9,0xAA,0xBD,3}, {0xE9,0xAA,0xBE,3}, {0xE9,0xAA,0xBF,3}, {0xE9,0xAB,0x83,3}, {0xE9,0xAB,0x84,3}, {0xE9,0xAB,0x86,3}, {0xE9,0xAB,0x87,3}, {0xE9,0xAB,0x88,3},
+        {0xE9,0xAB,0x89,3}, {0xE9,0xAB,0x8A,3}, {0xE9,0xAB,0x8D,3}, {0xE9,0xAB,0x8E,3}, {0xE9,0xAB,0x8F,3}, {0xE9,0xAB,0x90,3}, {0xE9,0xAB,0x92,3}, {0xE9,0xAB,0x94,3},
+        {0xE9,0xAB,0x95,3}, {0xE9,0xAB,0x96,3}, {0xE9,0xAB,0x97,3}, {0xE9,0xAB,0x99,3}, {0xE9,0xAB,0x9A,3}, {0xE9,0xAB,0x9B,3}, {0xE9,0xAB,0x9C,3}, {0xE9,0xAB,0x9D,3},
+        {0xE9,0xAB,0x9E,3}, {0xE9,0xAB,0xA0,3}, {0xE9,0xAB,0xA2,3}, {0xE9,0xAB,0xA3,3}, {0xE9,0xAB,0xA4,3}, {0xE9,0xAB,0xA5,3}, {0xE9,0xAB,0xA7,3}, {0xE9,0xAB,0xA8,3},
+        {0xE9,0xAB,0xA9,3}, {0xE9,0xAB,0xAA,3}, {0xE9,0xAB,0xAC,3}, {0xE9,0xAB,0xAE,3}, {0xE9,0xAB,0xB0,3}, {0xE9,0xAB,0xB1,3}, {0xE9,0xAB,0xB2,3}, {0xE9,0xAB,0xB3,3},
+        {0xE9,0xAB,0xB4,3}, {0xE9,0xAB,0xB5,3}, {0xE9,0xAB,0xB6,3}, {0xE9,0xAB,0xB7,3}, {0xE9,0xAB,0xB8,3}, {0xE9,0xAB,0xBA,3}, {0xE9,0xAB,0xBC,3}, {0xE9,0xAB,0xBD,3},
+        {0xE9,0xAB,0xBE,3}, {0xE9,0xAB,0xBF,3}, {0xE9,0xAC,0x80,3}, {0xE9,0xAC,0x81,3}, {0xE9,0xAC,0x82,3}, {0xE9,0xAC,0x84,3}, {0xE9,0xAC,0x85,3}, {0xE9,0xAC,0x86,3},
+        {0xE8,0x9F,0x86,3}, {0xE8,0x9E,0x88,3}, {0xE8,0x9E,0x85,3}, {0xE8,0x9E,0xAD,3}, {0xE8,0x9E,0x97,3}, {0xE8,0x9E,0x83,3}, {0xE8,0x9E,0xAB,3}, {0xE8,0x9F,0xA5,3},
+        {0xE8,0x9E,0xAC,3}, {0xE8,0x9E,0xB5,3}, {0xE8,0x9E,0xB3,3}, {0xE8,0x9F,0x8B,3}, {0xE8,0x9F,0x93,3}, {0xE8,0x9E,0xBD,3}, {0xE8,0x9F,0x91,3}, {0xE8,0x9F,0x80,3},
+        {0xE8,0x9F,0x8A,3}, {0xE8,0x9F,0x9B,3}, {0xE8,0x9F,0xAA,3}, {0xE8,0x9F,0xA0,3}, {0xE8,0x9F,0xAE,3}, {0xE8,0xA0,0x96,3}, {0xE8,0xA0,0x93,3}, {0xE8,0x9F,0xBE,3},
+        {0xE8,0xA0,0x8A,3}, {0xE8,0xA0,0x9B,3}, {0xE8,0xA0,0xA1,3}, {0xE8,0xA0,0xB9,3}, {0xE8,0xA0,0xBC,3}, {0xE7,0xBC,0xB6,3}, {0xE7,0xBD,0x82,3}, {0xE7,0xBD,0x84,3},
+        {0xE7,0xBD,0x85,3}, {0xE8,0x88,0x90,3}, {0xE7,0xAB,0xBA,3}, {0xE7,0xAB,0xBD,3}, {0xE7,0xAC,0x88,3}, {0xE7,0xAC,0x83,3}, {0xE7,0xAC,0x84,3}, {0xE7,0xAC,0x95,3},
+        {0xE7,0xAC,0x8A,3}, {0xE7,0xAC,0xAB,3}, {0xE7,0xAC,0x8F,3}, {0xE7,0xAD,0x87,3}, {0xE7,0xAC,0xB8,3}, {0xE7,0xAC,0xAA,3}, {0xE7,0xAC,0x99,3}, {0xE7,0xAC,0xAE,3},
+        {0xE7,0xAC,0xB1,3}, {0xE7,0xAC,0xA0,3}, {0xE7,0xAC,0xA5,3}, {0xE7,0xAC,0xA4,3}, {0xE7,0xAC,0xB3,3}, {0xE7,0xAC,0xBE,3}, {0xE7,0xAC,0x9E,3}, {0xE7,0xAD,0x98,3},
+        {0xE7,0xAD,0x9A,3}, {0xE7,0xAD,0x85,3}, {0xE7,0xAD,0xB5,3}, {0xE7,0xAD,0x8C,3}, {0xE7,0xAD,0x9D,3}, {0xE7,0xAD,0xA0,3}, {0xE7,0xAD,0xAE,3}, {0xE7,0xAD,0xBB,3},
+        {0xE7,0xAD,0xA2,3}, {0xE7,0xAD,0xB2,3}, {0xE7,0xAD,0xB1,3}, {0xE7,0xAE,0x90,3}, {0xE7,0xAE,0xA6,3}, {0xE7,0xAE,0xA7,3}, {0xE7,0xAE,0xB8,3}, {0xE7,0xAE,0xAC,3},
+        {0xE7,0xAE,0x9D,3}, {0xE7,0xAE,0xA8,3}, {0xE7,0xAE,0x85,3}, {0xE7,0xAE,0xAA,3}, {0xE7,0xAE,0x9C,3}, {0xE7,0xAE,0xA2,3}, {0xE7,0xAE,0xAB,3}, {0xE7,0xAE,0xB4,3},
+        {0xE7,0xAF,0x91,3}, {0xE7,0xAF,0x81,3}, {0xE7,0xAF,0x8C,3}, {0xE7,0xAF,0x9D,3}, {0xE7,0xAF,0x9A,3}, {0xE7,0xAF,0xA5,3}, {0xE7,0xAF,0xA6,3}, {0xE7,0xAF,0xAA,3},
+        {0xE7,0xB0,0x8C,3}, {0xE7,0xAF,0xBE,3}, {0xE7,0xAF,0xBC,3}, {0xE7,0xB0,0x8F,3}, {0xE7,0xB0,0x96,3}, {0xE7,0xB0,0x8B,3},
+    },
+    /* 0xF4 */ {
+        {0xE9,0xAC,0x87,3}, {0xE9,0xAC,0x89,3}, {0xE9,0xAC,0x8A,3}, {0xE9,0xAC,0x8B,3}, {0xE9,0xAC,0x8C,3}, {0xE9,0xAC,0x8D,3}, {0xE9,0xAC,0x8E,3}, {0xE9,0xAC,0x90,3},
+        {0xE9,0xAC,0x91,3}, {0xE9,0xAC,0x92,3}, {0xE9,0xAC,0x94,3}, {0xE9,0xAC,0x95,3}, {0xE9,0xAC,0x96,3}, {0xE9,0xAC,0x97,3}, {0xE9,0xAC,0x98,3}, {0xE9,0xAC,0x99,3},
+        {0xE9,0xAC,0x9A,3}, {0xE9,0xAC,0x9B,3}, {0xE9,0xAC,0x9C,3}, {0xE9,0xAC,0x9D,3}, {0xE9,0xAC,0x9E,3}, {0xE9,0xAC,0xA0,3}, {0xE9,0xAC,0xA1,3}, {0xE9,0xAC,0xA2,3},
+        {0xE9,0xAC,0xA4,3}, {0xE9,0xAC,0xA5,3}, {0xE9,0xAC,0xA6,3}, {0xE9,0xAC,0xA7,3}, {0xE9,0xAC,0xA8,3}, {0xE9,0xAC,0xA9,3}, {0xE9,0xAC,0xAA,3}, {0xE9,0xAC,0xAB,3},
+        {0xE9,0xAC,0xAC,3}, {0xE9,0xAC,0xAD,3}, {0xE9,0xAC,0xAE,3}, {0xE9,0xAC,0xB0,3}, {0xE9,0xAC,0xB1,3}, {0xE9,0xAC,0xB3,3}, {0xE9,0xAC,0xB4,3}, {0xE9,0xAC,0xB5,3},
+        {0xE9,0xAC,0xB6,3}, {0xE9,0xAC,0xB7,3}, {0xE9,0xAC,0xB8,3}, {0xE9,0xAC,0xB9,3}, {0xE9,0xAC,0xBA,3}, {0xE9,0xAC,0xBD,3}, {0xE9,0xAC,0xBE,3}, {0xE9,0xAC,0xBF,3},
+        {0xE9,0xAD,0x80,3}, {0xE9,0xAD,0x86,3}, {0xE9,0xAD,0x8A,3}, {0xE9,0xAD,0x8B,3}, {0xE9,0xAD,0x8C,3}, {0xE9,0xAD,0x8E,3}, {0xE9,0xAD,0x90,3}, {0xE9,0xAD,0x92,3},
+        {0xE9,0xAD,0x93,3}, {0xE9,0xAD,0x95,3}, {0xE9,0xAD,0x96,3}, {0xE9,0xAD,0x97,3}, {0xE9,0xAD,0x98,3}, {0xE9,0xAD,0x99,3}, {0xE9,0xAD,0x9A,3}, {0xE9,0xAD,0x9B,3},
+        {0xE9,0xAD,0x9C,3}, {0xE9,0xAD,0x9D,3}, {0xE9,0xAD,0x9E,3}, {0xE9,0xAD,0x9F,3}, {0xE9,0xAD,0xA0,3}, {0xE9,0xAD,0xA1,3}, {0xE9,0xAD,0xA2,3}, {0xE9,0xAD,0xA3,3},
+        {0xE9,0xAD,0xA4,3}, {0xE9,0xAD,0xA5,3}, {0xE9,0xAD,0xA6,3}, {0xE9,0xAD,0xA7,3}, {0xE9,0xAD,0xA8,3}, {0xE9,0xAD,0xA9,3}, {0xE9,0xAD,0xAA,3}, {0xE9,0xAD,0xAB,3},
+        {0xE9,0xAD,0xAC,3}, {0xE9,0xAD,0xAD,3}, {0xE9,0xAD,0xAE,3}, {0xE9,0xAD,0xAF,3}, {0xE9,0xAD,0xB0,3}, {0xE9,0xAD,0xB1,3}, {0xE9,0xAD,0xB2,3}, {0xE9,0xAD,0xB3,3},
+        {0xE9,0xAD,0xB4,3}, {0xE9,0xAD,0xB5,3}, {0xE9,0xAD,0xB6,3}, {0xE9,0xAD,0xB7,3}, {0xE9,0xAD,0xB8,3}, {0xE9,0xAD,0xB9,3}, {0xE9,0xAD,0xBA,3}, {0xE9,0xAD,0xBB,3},
+        {0xE7,0xB0,0x9F,3}, {0xE7,0xB0,0xAA,3}, {0xE7,0xB0,0xA6,3}, {0xE7,0xB0,0xB8,3}, {0xE7,0xB1,0x81,3}, {0xE7,0xB1,0x80,3}, {0xE8,0x87,0xBE,3}, {0xE8,0x88,0x81,3},
+        {0xE8,0x88,0x82,3}, {0xE8,0x88,0x84,3}, {0xE8,0x87,0xAC,3}, {0xE8,0xA1,0x84,3}, {0xE8,0x88,0xA1,3}, {0xE8,0x88,0xA2,3}, {0xE8,0x88,0xA3,3}, {0xE8,0x88,0xAD,3},
+        {0xE8,0x88,0xAF,3}, {0xE8,0x88,0xA8,3}, {0xE8,0x88,0xAB,3}, {0xE8,0x88,0xB8,3}, {0xE8,0x88,0xBB,3}, {0xE8,0x88,0xB3,3}, {0xE8,0x88,0xB4,3}, {0xE8,0x88,0xBE,3},
+        {0xE8,0x89,0x84,3}, {0xE8,0x89,0x89,3}, {0xE8,0x89,0x8B,3}, {0xE8,0x89,0x8F,3}, {0xE8,0x89,0x9A,3}, {0xE8,0x89,0x9F,3}, {0xE8,0x89,0xA8,3}, {0xE8,0xA1,0xBE,3},
+        {0xE8,0xA2,0x85,3}, {0xE8,0xA2,0x88,3}, {0xE8,0xA3,0x98,3}, {0xE8,0xA3,0x9F,3}, {0xE8,0xA5,0x9E,3}, {0xE7,0xBE,0x9D,3}, {0xE7,0xBE,0x9F,3}, {0xE7,0xBE,0xA7,3},
+        {0xE7,0xBE,0xAF,3}, {0xE7,0xBE,0xB0,3}, {0xE7,0xBE,0xB2,3}, {0xE7,0xB1,0xBC,3}, {0xE6,0x95,0x89,3}, {0xE7,0xB2,0x91,3}, {0xE7,0xB2,0x9D,3}, {0xE7,0xB2,0x9C,3},
+        {0xE7,0xB2,0x9E,3}, {0xE7,0xB2,0xA2,3}, {0xE7,0xB2,0xB2,3}, {0xE7,0xB2,0xBC,3}, {0xE7,0xB2,0xBD,3}, {0xE7,0xB3,0x81,3}, {0xE7,0xB3,0x87,3}, {0xE7,0xB3,0x8C,3},
+        {0xE7,0xB3,0x8D,3}, {0xE7,0xB3,0x88,3}, {0xE7,0xB3,0x85,3}, {0xE7,0xB3,0x97,3}, {0xE7,0xB3,0xA8,3}, {0xE8,0x89,0xAE,3}, {0xE6,0x9A,0xA8,3}, {0xE7,0xBE,0xBF,3},
+        {0xE7,0xBF,0x8E,3}, {0xE7,0xBF,0x95,3}, {0xE7,0xBF,0xA5,3}, {0xE7,0xBF,0xA1,3}, {0xE7,0xBF,0xA6,3}, {0xE7,0xBF,0xA9,3}, {0xE7,0xBF,0xAE,3}, {0xE7,0xBF,0xB3,3},
+        {0xE7,0xB3,0xB8,3}, {0xE7,0xB5,0xB7,3}, {0xE7,0xB6,0xA6,3}, {0xE7,0xB6,0xAE,3}, {0xE7,0xB9,0x87,3}, {0xE7,0xBA,0x9B,3}, {0xE9,0xBA,0xB8,3}, {0xE9,0xBA,0xB4,3},
+        {0xE8,0xB5,0xB3,3}, {0xE8,0xB6,0x84,3}, {0xE8,0xB6,0x94,3}, {0xE8,0xB6,0x91,3}, {0xE8,0xB6,0xB1,3}, {0xE8,0xB5,0xA7,3}, {0xE8,0xB5,0xAD,3}, {0xE8,0xB1,0x87,3},
+        {0xE8,0xB1,0x89,3}, {0xE9,0x85,0x8A,3}, {0xE9,0x85,0x90,3}, {0xE9,0x85,0x8E,3}, {0xE9,0x85,0x8F,3}, {0xE9,0x85,0xA4,3},
+    },
+    /* 0xF5 */ {
+        {0xE9,0xAD,0xBC,3}, {0xE9,0xAD,0xBD,3}, {0xE9,0xAD,0xBE,3}, {0xE9,0xAD,0xBF,3}, {0xE9,0xAE,0x80,3}, {0xE9,0xAE,0x81,3}, {0xE9,0xAE,0x82,3}, {0xE9,0xAE,0x83,3},
+        {0xE9,0xAE,0x84,3}, {0xE9,0xAE,0x85,3}, {0xE9,0xAE,0x86,3}, {0xE9,0xAE,0x87,3}, {0xE9,0xAE,0x88,3}, {0xE9,0xAE,0x89,3}, {0xE9,0xAE,0x8A,3}, {0xE9,0xAE,0x8B,3},
+        {0xE9,0xAE,0x8C,3}, {0xE9,0xAE,0x8D,3}, {0xE9,0xAE,0x8E,3}, {0xE9,0xAE,0x8F,3}, {0xE9,0xAE,0x90,3}, {0xE9,0xAE,0x91,3}, {0xE9,0xAE,0x92,3}, {0xE9,0xAE,0x93,3},
+        {0xE9,0xAE,0x94,3}, {0xE9,0xAE,0x95,3}, {0xE9,0xAE,0x96,3}, {0xE9,0xAE,0x97,3}, {0xE9,0xAE,0x98,3}, {0xE9,0xAE,0x99,3}, {0xE9,0xAE,0x9A,3}, {0xE9,0xAE,0x9B,3},
+        {0xE9,0xAE,0x9C,3}, {0xE9,0xAE,0x9D,3}, {0xE9,0xAE,0x9E,3}, {0xE9,0xAE,0x9F,3}, {0xE9,0xAE,0xA0,3}, {0xE9,0xAE,0xA1,3}, {0xE9,0xAE,0xA2,3}, {0xE9,0xAE,0xA3,3},
+        {0xE9,0xAE,0xA4,3}, {0xE9,0xAE,0xA5,3}, {0xE9,0xAE,0xA6,3}, {0xE9,0xAE,0xA7,3}, {0xE9,0xAE,0xA8,3}, {0xE9,0xAE,0xA9,3}, {0xE9,0xAE,0xAA,3}, {0xE9,0xAE,0xAB,3},
+        {0xE9,0xAE,0xAC,3}, {0xE9,0xAE,0xAD,3}, {0xE9,0xAE,0xAE,3}, {0xE9,0xAE,0xAF,3}, {0xE9,0xAE,0xB0,3}, {0xE9,0xAE,0xB1,3}, {0xE9,0xAE,0xB2,3}, {0xE9,0xAE,0xB3,3},
+        {0xE9,0xAE,0xB4,3}, {0xE9,0xAE,0xB5,3}, {0xE9,0xAE,0xB6,3}, {0xE9,0xAE,0xB7,3}, {0xE9,0xAE,0xB8,3}, {0xE9,0xAE,0xB9,3}, {0xE9,0xAE,0xBA,3}, {0xE9,0xAE,0xBB,3},
+        {0xE9,0xAE,0xBC,3}, {0xE9,0xAE,0xBD,3}, {0xE9,0xAE,0xBE,3}, {0xE9,0xAE,0xBF,3}, {0xE9,0xAF,0x80,3}, {0xE9,0xAF,0x81,3}, {0xE9,0xAF,0x82,3}, {0xE9,0xAF,0x83,3},
+        {0xE9,0xAF,0x84,3}, {0xE9,0xAF,0x85,3}, {0xE9,0xAF,0x86,3}, {0xE9,0xAF,0x87,3}, {0xE9,0xAF,0x88,3}, {0xE9,0xAF,0x89,3}, {0xE9,0xAF,0x8A,3}, {0xE9,0xAF,0x8B,3},
+        {0xE9,0xAF,0x8C,3}, {0xE9,0xAF,0x8D,3}, {0xE9,0xAF,0x8E,3}, {0xE9,0xAF,0x8F,3}, {0xE9,0xAF,0x90,3}, {0xE9,0xAF,0x91,3}, {0xE9,0xAF,0x92,3}, {0xE9,0xAF,0x93,3},
+        {0xE9,0xAF,0x94,3}, {0xE9,0xAF,0x95,3}, {0xE9,0xAF,0x96,3}, {0xE9,0xAF,0x97,3}, {0xE9,0xAF,0x98,3}, {0xE9,0xAF,0x99,3}, {0xE9,0xAF,0x9A,3}, {0xE9,0xAF,0x9B,3},
+        {0xE9,0x85,0xA2,3}, {0xE9,0x85,0xA1,3}, {0xE9,0x85,0xB0,3}, {0xE9,0x85,0xA9,3}, {0xE9,0x85,0xAF,3}, {0xE9,0x85,0xBD,3}, {0xE9,0x85,0xBE,3}, {0xE9,0x85,0xB2,3},
+        {0xE9,0x85,0xB4,3}, {0xE9,0x85,0xB9,3}, {0xE9,0x86,0x8C,3}, {0xE9,0x86,0x85,3}, {0xE9,0x86,0x90,3}, {0xE9,0x86,0x8D,3}, {0xE9,0x86,0x91,3}, {0xE9,0x86,0xA2,3},
+        {0xE9,0x86,0xA3,3}, {0xE9,0x86,0xAA,3}, {0xE9,0x86,0xAD,3}, {0xE9,0x86,0xAE,3}, {0xE9,0x86,0xAF,3}, {0xE9,0x86,0xB5,3}, {0xE9,0x86,0xB4,3}, {0xE9,0x86,0xBA,3},
+        {0xE8,0xB1,0x95,3}, {0xE9,0xB9,0xBE,3}, {0xE8,0xB6,0xB8,3}, {0xE8,0xB7,0xAB,3}, {0xE8,0xB8,0x85,3}, {0xE8,0xB9,0x99,3}, {0xE8,0xB9,0xA9,3}, {0xE8,0xB6,0xB5,3},
+        {0xE8,0xB6,0xBF,3}, {0xE8,0xB6,0xBC,3}, {0xE8,0xB6,0xBA,3}, {0xE8,0xB7,0x84,3}, {0xE8,0xB7,0x96,3}, {0xE8,0xB7,0x97,3}, {0xE8,0xB7,0x9A,3}, {0xE8,0xB7,0x9E,3},
+        {0xE8,0xB7,0x8E,3}, {0xE8,0xB7,0x8F,3}, {0xE8,0xB7,0x9B,3}, {0xE8,0xB7,0x86,3}, {0xE8,0xB7,0xAC,3}, {0xE8,0xB7,0xB7,3}, {0xE8,0xB7,0xB8,3}, {0xE8,0xB7,0xA3,3},
+        {0xE8,0xB7,0xB9,3}, {0xE8,0xB7,0xBB,3}, {0xE8,0xB7,0xA4,3}, {0xE8,0xB8,0x89,3}, {0xE8,0xB7,0xBD,3}, {0xE8,0xB8,0x94,3}, {0xE8,0xB8,0x9D,3}, {0xE8,0xB8,0x9F,3},
+        {0xE8,0xB8,0xAC,3}, {0xE8,0xB8,0xAE,3}, {0xE8,0xB8,0xA3,3}, {0xE8,0xB8,0xAF,3}, {0xE8,0xB8,0xBA,3}, {0xE8,0xB9,0x80,3}, {0xE8,0xB8,0xB9,3}, {0xE8,0xB8,0xB5,3},
+        {0xE8,0xB8,0xBD,3}, {0xE8,0xB8,0xB1,3}, {0xE8,0xB9,0x89,3}, {0xE8,0xB9,0x81,3}, {0xE8,0xB9,0x82,3}, {0xE8,0xB9,0x91,3}, {0xE8,0xB9,0x92,3}, {0xE8,0xB9,0x8A,3},
+        {0xE8,0xB9,0xB0,3}, {0xE8,0xB9,0xB6,3}, {0xE8,0xB9,0xBC,3}, {0xE8,0xB9,0xAF,3}, {0xE8,0xB9,0xB4,3}, {0xE8,0xBA,0x85,3}, {0xE8,0xBA,0x8F,3}, {0xE8,0xBA,0x94,3},
+        {0xE8,0xBA,0x90,3}, {0xE8,0xBA,0x9C,3}, {0xE8,0xBA,0x9E,3}, {0xE8,0xB1,0xB8,3}, {0xE8,0xB2,0x82,3}, {0xE8,0xB2,0x8A,3}, {0xE8,0xB2,0x85,3}, {0xE8,0xB2,0x98,3},
+        {0xE8,0xB2,0x94,3}, {0xE6,0x96,0x9B,3}, {0xE8,0xA7,0x96,3}, {0xE8,0xA7,0x9E,3}, {0xE8,0xA7,0x9A,3}, {0xE8,0xA7,0x9C,3},
+    },
+    /* 0xF6 */ {
+        {0xE9,0xAF,0x9C,3}, {0xE9,0xAF,0x9D,3}, {0xE9,0xAF,0x9E,3}, {0xE9,0xAF,0x9F,3}, {0xE9,0xAF,0xA0,3}, {0xE9,0xAF,0xA1,3}, {0xE9,0xAF,0xA2,3}, {0xE9,0xAF,0xA3,3},
+        {0xE9,0xAF,0xA4,3}, {0xE9,0xAF,0xA5,3}, {0xE9,0xAF,0xA6,3}, {0xE9,0xAF,0xA7,3}, {0xE9,0xAF,0xA8,3}, {0xE9,0xAF,0xA9,3}, {0xE9,0xAF,0xAA,3}, {0xE9,0xAF,0xAB,3},
+        {0xE9,0xAF,0xAC,3}, {0xE9,0xAF,0xAD,3}, {0xE9,0xAF,0xAE,3}, {0xE9,0xAF,0xAF,3}, {0xE9,0xAF,0xB0,3}, {0xE9,0xAF,0xB1,3}, {0xE9,0xAF,0xB2,3}, {0xE9,0xAF,0xB3,3},
+        {0xE9,0xAF,0xB4,3}, {0xE9,0xAF,0xB5,3}, {0xE9,0xAF,0xB6,3}, {0xE9,0xAF,0xB7,3}, {0xE9,0xAF,0xB8,3}, {0xE9,0xAF,0xB9,3}, {0xE9,0xAF,0xBA,3}, {0xE9,0xAF,0xBB,3},
+        {0xE9,0xAF,0xBC,3}, {0xE9,0xAF,0xBD,3}, {0xE9,0xAF,0xBE,3}, {0xE9,0xAF,0xBF,3}, {0xE9,0xB0,0x80,3}, {0xE9,0xB0,0x81,3}, {0xE9,0xB0,0x82,3}, {0xE9,0xB0,0x83,3},
+        {0xE9,0xB0,0x84,3}, {0xE9,0xB0,0x85,3}, {0xE9,0xB0,0x86,3}, {0xE9,0xB0,0x87,3}, {0xE9,0xB0,0x88,3}, {0xE9,0xB0,0x89,3}, {0xE9,0xB0,0x8A,3}, {0xE9,0xB0,0x8B,3},
+        {0xE9,0xB0,0x8C,3}, {0xE9,0xB0,0x8D,3}, {0xE9,0xB0,0x8E,3}, {0xE9,0xB0,0x8F,3}, {0xE9,0xB0,0x90,3}, {0xE9,0xB0,0x91,3}, {0xE9,0xB0,0x92,3}, {0xE9,0xB0,0x93,3},
+        {0xE9,0xB0,0x94,3}, {0xE9,0xB0,0x95,3}, {0xE9,0xB0,0x96,3}, {0xE9,0xB0,0x97,3}, {0xE9,0xB0,0x98,3}, {0xE9,0xB0,0x99,3}, {0xE9,0xB0,0x9A,3}, {0xE9,0xB0,0x9B,3},
+        {0xE9,0xB0,0x9C,3}, {0xE9,0xB0,0x9D,3}, {0xE9,0xB0,0x9E,3}, {0xE9,0xB0,0x9F,3}, {0xE9,0xB0,0xA0,3}, {0xE9,0xB0,0xA1,3}, {0xE9,0xB0,0xA2,3}, {0xE9,0xB0,0xA3,3},
+        {0xE9,0xB0,0xA4,3}, {0xE9,0xB0,0xA5,3}, {0xE9,0xB0,0xA6,3}, {0xE9,0xB0,0xA7,3}, {0xE9,0xB0,0xA8,3}, {0xE9,0xB0,0xA9,3}, {0xE9,0xB0,0xAA,3}, {0xE9,0xB0,0xAB,3},
+        {0xE9,0xB0,0xAC,3}, {0xE9,0xB0,0xAD,3}, {0xE9,0xB0,0xAE,3}, {0xE9,0xB0,0xAF,3}, {0xE9,0xB0,0xB0,3}, {0xE9,0xB0,0xB1,3}, {0xE9,0xB0,0xB2,3}, {0xE9,0xB0,0xB3,3},
+        {0xE9,0xB0,0xB4,3}, {0xE9,0xB0,0xB5,3}, {0xE9,0xB0,0xB6,3}, {0xE9,0xB0,0xB7,3}, {0xE9,0xB0,0xB8,3}, {0xE9,0xB0,0xB9,3}, {0xE9,0xB0,0xBA,3}, {0xE9,0xB0,0xBB,3},
+        {0xE8,0xA7,0xA5,3}, {0xE8,0xA7,0xAB,3}, {0xE8,0xA7,0xAF,3}, {0xE8,0xA8,0xBE,3}, {0xE8,0xAC,0xA6,3}, {0xE9,0x9D,0x93,3}, {0xE9,0x9B,0xA9,3}, {0xE9,0x9B,0xB3,3},
+        {0xE9,0x9B,0xAF,3}, {0xE9,0x9C,0x86,3}, {0xE9,0x9C,0x81,3}, {0xE9,0x9C,0x88,3}, {0xE9,0x9C,0x8F,3}, {0xE9,0x9C,0x8E,3}, {0xE9,0x9C,0xAA,3}, {0xE9,0x9C,0xAD,3},
+        {0xE9,0x9C,0xB0,3}, {0xE9,0x9C,0xBE,3}, {0xE9,0xBE,0x80,3}, {0xE9,0xBE,0x83,3}, {0xE9,0xBE,0x85,3}, {0xE9,0xBE,0x86,3}, {0xE9,0xBE,0x87,3}, {0xE9,0xBE,0x88,3},
+        {0xE9,0xBE,0x89,3}, {0xE9,0xBE,0x8A,3}, {0xE9,0xBE,0x8C,3}, {0xE9,0xBB,0xBE,3}, {0xE9,0xBC,0x8B,3}, {0xE9,0xBC,0x8D,3}, {0xE9,0x9A,0xB9,3}, {0xE9,0x9A,0xBC,3},
+        {0xE9,0x9A,0xBD,3}, {0xE9,0x9B,0x8E,3}, {0xE9,0x9B,0x92,3}, {0xE7,0x9E,0xBF,3}, {0xE9,0x9B,0xA0,3}, {0xE9,0x8A,0x8E,3}, {0xE9,0x8A,0xAE,3}, {0xE9,0x8B,0x88,3},
+        {0xE9,0x8C,0xBE,3}, {0xE9,0x8D,0xAA,3}, {0xE9,0x8F,0x8A,3}, {0xE9,0x8E,0x8F,3}, {0xE9,0x90,0xBE,3}, {0xE9,0x91,0xAB,3}, {0xE9,0xB1,0xBF,3}, {0xE9,0xB2,0x82,3},
+        {0xE9,0xB2,0x85,3}, {0xE9,0xB2,0x86,3}, {0xE9,0xB2,0x87,3}, {0xE9,0xB2,0x88,3}, {0xE7,0xA8,0xA3,3}, {0xE9,0xB2,0x8B,3}, {0xE9,0xB2,0x8E,3}, {0xE9,0xB2,0x90,3},
+        {0xE9,0xB2,0x91,3}, {0xE9,0xB2,0x92,3}, {0xE9,0xB2,0x94,3}, {0xE9,0xB2,0x95,3}, {0xE9,0xB2,0x9A,3}, {0xE9,0xB2,0x9B,3}, {0xE9,0xB2,0x9E,3}, {0xE9,0xB2,0x9F,3},
+        {0xE9,0xB2,0xA0,3}, {0xE9,0xB2,0xA1,3}, {0xE9,0xB2,0xA2,3}, {0xE9,0xB2,0xA3,3}, {0xE9,0xB2,0xA5,3}, {0xE9,0xB2,0xA6,3}, {0xE9,0xB2,0xA7,3}, {0xE9,0xB2,0xA8,3},
+        {0xE9,0xB2,0xA9,3}, {0xE9,0xB2,0xAB,3}, {0xE9,0xB2,0xAD,3}, {0xE9,0xB2,0xAE,3}, {0xE9,0xB2,0xB0,3}, {0xE9,0xB2,0xB1,3}, {0xE9,0xB2,0xB2,3}, {0xE9,0xB2,0xB3,3},
+        {0xE9,0xB2,0xB4,3}, {0xE9,0xB2,0xB5,3}, {0xE9,0xB2,0xB6,3}, {0xE9,0xB2,0xB7,3}, {0xE9,0xB2,0xBA,3}, {0xE9,0xB2,0xBB,3}, {0xE9,0xB2,0xBC,3}, {0xE9,0xB2,0xBD,3},
+        {0xE9,0xB3,0x84,3}, {0xE9,0xB3,0x85,3}, {0xE9,0xB3,0x86,3}, {0xE9,0xB3,0x87,3}, {0xE9,0xB3,0x8A,3}, {0xE9,0xB3,0x8B,3},
+    },
+    /* 0xF7 */ {
+        {0xE9,0xB0,0xBC,3}, {0xE9,0xB0,0xBD,3}, {0xE9,0xB0,0xBE,3}, {0xE9,0xB0,0xBF,3}, {0xE9,0xB1,0x80,3}, {0xE9,0xB1,0x81,3}, {0xE9,0xB1,0x82,3}, {0xE9,0xB1,0x83,3},
+        {0xE9,0xB1,0x84,3}, {0xE9,0xB1,0x85,3}, {0xE9,0xB1,0x86,3}, {0xE9,0xB1,0x87,3}, {0xE9,0xB1,0x88,3}, {0xE9,0xB1,0x89,3}, {0xE9,0xB1,0x8A,3}, {0xE9,0xB1,0x8B,3},
+        {0xE9,0xB1,0x8C,3}, {0xE9,0xB1,0x8D,3}, {0xE9,0xB1,0x8E,3}, {0xE9,0xB1,0x8F,3}, {0xE9,0xB1,0x90,3}, {0xE9,0xB1,0x91,3}, {0xE9,0xB1,0x92,3}, {0xE9,0xB1,0x93,3},
+        {0xE9,0xB1,0x94,3}, {0xE9,0xB1,0x95,3}, {0xE9,0xB1,0x96,3}, {0xE9,0xB1,0x97,3}, {0xE9,0xB1,0x98,3}, {0xE9,0xB1,0x99,3}, {0xE9,0xB1,0x9A,3}, {0xE9,0xB1,0x9B,3},
+        {0xE9,0xB1,0x9C,3}, {0xE9,0xB1,0x9D,3}, {0xE9,0xB1,0x9E,3}, {0xE9,0xB1,0x9F,3}, {0xE9,0xB1,0xA0,3}, {0xE9,0xB1,0xA1,3}, {0xE9,0xB1,0xA2,3}, {0xE9,0xB1,0xA3,3},
+        {0xE9,0xB1,0xA4,3}, {0xE9,0xB1,0xA5,3}, {0xE9,0xB1,0xA6,3}, {0xE9,0xB1,0xA7,3}, {0xE9,0xB1,0xA8,3}, {0xE9,0xB1,0xA9,3}, {0xE9,0xB1,0xAA,3}, {0xE9,0xB1,0xAB,3},
+        {0xE9,0xB1,0xAC,3}, {0xE9,0xB1,0xAD,3}, {0xE9,0xB1,0xAE,3}, {0xE9,0xB1,0xAF,3}, {0xE9,0xB1,0xB0,3}, {0xE9,0xB1,0xB1,3}, {0xE9,0xB1,0xB2,3}, {0xE9,0xB1,0xB3,3},
+        {0xE9,0xB1,0xB4,3}, {0xE9,0xB1,0xB5,3}, {0xE9,0xB1,0xB6,3}, {0xE9,0xB1,0xB7,3}, {0xE9,0xB1,0xB8,3}, {0xE9,0xB1,0xB9,3}, {0xE9,0xB1,0xBA,3}, {0xE9,0xB1,0xBB,3},
+        {0xE9,0xB1,0xBD,3}, {0xE9,0xB1,0xBE,3}, {0xE9,0xB2,0x80,3}, {0xE9,0xB2,0x83,3}, {0xE9,0xB2,0x84,3}, {0xE9,0xB2,0x89,3}, {0xE9,0xB2,0x8A,3}, {0xE9,0xB2,0x8C,3},
+        {0xE9,0xB2,0x8F,3}, {0xE9,0xB2,0x93,3}, {0xE9,0xB2,0x96,3}, {0xE9,0xB2,0x97,3}, {0xE9,0xB2,0x98,3}, {0xE9,0xB2,0x99,3}, {0xE9,0xB2,0x9D,3}, {0xE9,0xB2,0xAA,3},
+        {0xE9,0xB2,0xAC,3}, {0xE9,0xB2,0xAF,3}, {0xE9,0xB2,0xB9,3}, {0xE9,0xB2,0xBE,3}, {0xE9,0xB2,0xBF,3}, {0xE9,0xB3,0x80,3}, {0xE9,0xB3,0x81,3}, {0xE9,0xB3,0x82,3},
+        {0xE9,0xB3,0x88,3}, {0xE9,0xB3,0x89,3}, {0xE9,0xB3,0x91,3}, {0xE9,0xB3,0x92,3}, {0xE9,0xB3,0x9A,3}, {0xE9,0xB3,0x9B,3}, {0xE9,0xB3,0xA0,3}, {0xE9,0xB3,0xA1,3},
+        {0xE9,0xB3,0x8C,3}, {0xE9,0xB3,0x8D,3}, {0xE9,0xB3,0x8E,3}, {0xE9,0xB3,0x8F,3}, {0xE9,0xB3,0x90,3}, {0xE9,0xB3,0x93,3}, {0xE9,0xB3,0x94,3}, {0xE9,0xB3,0x95,3},
+        {0xE9,0xB3,0x97,3}, {0xE9,0xB3,0x98,3}, {0xE9,0xB3,0x99,3}, {0xE9,0xB3,0x9C,3}, {0xE9,0xB3,0x9D,3}, {0xE9,0xB3,0x9F,3}, {0xE9,0xB3,0xA2,3}, {0xE9,0x9D,0xBC,3},
+        {0xE9,0x9E,0x85,3}, {0xE9,0x9E,0x91,3}, {0xE9,0x9E,0x92,3}, {0xE9,0x9E,0x94,3}, {0xE9,0x9E,0xAF,3}, {0xE9,0x9E,0xAB,3}, {0xE9,0x9E,0xA3,3}, {0xE9,0x9E,0xB2,3},
+        {0xE9,0x9E,0xB4,3}, {0xE9,0xAA,0xB1,3}, {0xE9,0xAA,0xB0,3}, {0xE9,0xAA,0xB7,3}, {0xE9,0xB9,0x98,3}, {0xE9,0xAA,0xB6,3}, {0xE9,0xAA,0xBA,3}, {0xE9,0xAA,0xBC,3},
+        {0xE9,0xAB,0x81,3}, {0xE9,0xAB,0x80,3}, {0xE9,0xAB,0x85,3}, {0xE9,0xAB,0x82,3}, {0xE9,0xAB,0x8B,3}, {0xE9,0xAB,0x8C,3}, {0xE9,0xAB,0x91,3}, {0xE9,0xAD,0x85,3},
+        {0xE9,0xAD,0x83,3}, {0xE9,0xAD,0x87,3}, {0xE9,0xAD,0x89,3}, {0xE9,0xAD,0x88,3}, {0xE9,0xAD,0x8D,3}, {0xE9,0xAD,0x91,3}, {0xE9,0xA3,0xA8,3}, {0xE9,0xA4,0x8D,3},
+        {0xE9,0xA4,0xAE,3}, {0xE9,0xA5,0x95,3}, {0xE9,0xA5,0x94,3}, {0xE9,0xAB,0x9F,3}, {0xE9,0xAB,0xA1,3}, {0xE9,0xAB,0xA6,3}, {0xE9,0xAB,0xAF,3}, {0xE9,0xAB,0xAB,3},
+        {0xE9,0xAB,0xBB,3}, {0xE9,0xAB,0xAD,3}, {0xE9,0xAB,0xB9,3}, {0xE9,0xAC,0x88,3}, {0xE9,0xAC,0x8F,3}, {0xE9,0xAC,0x93,3}, {0xE9,0xAC,0x9F,3}, {0xE9,0xAC,0xA3,3},
+        {0xE9,0xBA,0xBD,3}, {0xE9,0xBA,0xBE,3}, {0xE7,0xB8,0xBB,3}, {0xE9,0xBA,0x82,3}, {0xE9,0xBA,0x87,3}, {0xE9,0xBA,0x88,3}, {0xE9,0xBA,0x8B,3}, {0xE9,0xBA,0x92,3},
+        {0xE9,0x8F,0x96,3}, {0xE9,0xBA,0x9D,3}, {0xE9,0xBA,0x9F,3}, {0xE9,0xBB,0x9B,3}, {0xE9,0xBB,0x9C,3}, {0xE9,0xBB,0x9D,3}, {0xE9,0xBB,0xA0,3}, {0xE9,0xBB,0x9F,3},
+        {0xE9,0xBB,0xA2,3}, {0xE9,0xBB,0xA9,3}, {0xE9,0xBB,0xA7,3}, {0xE9,0xBB,0xA5,3}, {0xE9,0xBB,0xAA,3}, {0xE9,0xBB,0xAF,3}, {0xE9,0xBC,0xA2,3}, {0xE9,0xBC,0xAC,3},
+        {0xE9,0xBC,0xAF,3}, {0xE9,0xBC,0xB9,3}, {0xE9,0xBC,0xB7,3}, {0xE9,0xBC,0xBD,3}, {0xE9,0xBC,0xBE,3}, {0xE9,0xBD,0x84,3},
+    },
+    /* 0xF8 */ {
+        {0xE9,0xB3,0xA3,3}, {0xE9,0xB3,0xA4,3}, {0xE9,0xB3,0xA5,3}, {0xE9,0xB3,0xA6,3}, {0xE9,0xB3,0xA7,3}, {0xE9,0xB3,0xA8,3}, {0xE9,0xB3,0xA9,3}, {0xE9,0xB3,0xAA,3},
+        {0xE9,0xB3,0xAB,3}, {0xE9,0xB3,0xAC,3}, {0xE9,0xB3,0xAD,3}, {0xE9,0xB3,0xAE,3}, {0xE9,0xB3,0xAF,3}, {0xE9,0xB3,0xB0,3}, {0xE9,0xB3,0xB1,3}, {0xE9,0xB3,0xB2,3},
+        {0xE9,0xB3,0xB3,3}, {0xE9,0xB3,0xB4,3}, {0xE9,0xB3,0xB5,3}, {0xE9,0xB3,0xB6,3}, {0xE9,0xB3,0xB7,3}, {0xE9,0xB3,0xB8,3}, {0xE9,0xB3,0xB9,3}, {0xE9,0xB3,0xBA,3},
+        {0xE9,0xB3,0xBB,3}, {0xE9,0xB3,0xBC,3}, {0xE9,0xB3,0xBD,3}, {0xE9,0xB3,0xBE,3}, {0xE9,0xB3,0xBF,3}, {0xE9,0xB4,0x80,3}, {0xE9,0xB4,0x81,3}, {0xE9,0xB4,0x82,3},
+        {0xE9,0xB4,0x83,3}, {0xE9,0xB4,0x84,3}, {0xE9,0xB4,0x85,3}, {0xE9,0xB4,0x86,3}, {0xE9,0xB4,0x87,3}, {0xE9,0xB4,0x88,3}, {0xE9,0xB4,0x89,3}, {0xE9,0xB4,0x8A,3},
+        {0xE9,0xB4,0x8B,3}, {0xE9,0xB4,0x8C,3}, {0xE9,0xB4,0x8D,3}, {0xE9,0xB4,0x8E,3}, {0xE9,0xB4,0x8F,3}, {0xE9,0xB4,0x90,3}, {0xE9,0xB4,0x91,3}, {0xE9,0xB4,0x92,3},
+        {0xE9,0xB4,0x93,3}, {0xE9,0xB4,0x94,3}, {0xE9,0xB4,0x95,3}, {0xE9,0xB4,0x96,3}, {0xE9,0xB4,0x97,3}, {0xE9,0xB4,0x98,3}, {0xE9,0xB4,0x99,3}, {0xE9,0xB4,0x9A,3},
+        {0xE9,0xB4,0x9B,3}, {0xE9,0xB4,0x9C,3}, {0xE9,0xB4,0x9D,3}, {0xE9,0xB4,0x9E,3}, {0xE9,0xB4,0x9F,3}, {0xE9,0xB4,0xA0,3}, {0xE9,0xB4,0xA1,3}, {0xE9,0xB4,0xA2,3},
+        {0xE9,0xB4,0xA3,3}, {0xE9,0xB4,0xA4,3}, {0xE9,0xB4,0xA5,3}, {0xE9,0xB4,0xA6,3}, {0xE9,0xB4,0xA7,3}, {0xE9,0xB4,0xA8,3}, {0xE9,0xB4,0xA9,3}, {0xE9,0xB4,0xAA,3},
+        {0xE9,0xB4,0xAB,3}, {0xE9,0xB4,0xAC,3}, {0xE9,0xB4,0xAD,3}, {0xE9,0xB4,0xAE,3}, {0xE9,0xB4,0xAF,3}, {0xE9,0xB4,0xB0,3}, {0xE9,0xB4,0xB1,3}, {0xE9,0xB4,0xB2,3},
+        {0xE9,0xB4,0xB3,3}, {0xE9,0xB4,0xB4,3}, {0xE9,0xB4,0xB5,3}, {0xE9,0xB4,0xB6,3}, {0xE9,0xB4,0xB7,3}, {0xE9,0xB4,0xB8,3}, {0xE9,0xB4,0xB9,3}, {0xE9,0xB4,0xBA,3},
+        {0xE9,0xB4,0xBB,3}, {0xE9,0xB4,0xBC,3}, {0xE9,0xB4,0xBD,3}, {0xE9,0xB4,0xBE,3}, {0xE9,0xB4,0xBF,3}, {0xE9,0xB5,0x80,3}, {0xE9,0xB5,0x81,3}, {0xE9,0xB5,0x82,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xF9 */ {
+        {0xE9,0xB5,0x83,3}, {0xE9,0xB5,0x84,3}, {0xE9,0xB5,0x85,3}, {0xE9,0xB5,0x86,3}, {0xE9,0xB5,0x87,3}, {0xE9,0xB5,0x88,3}, {0xE9,0xB5,0x89,3}, {0xE9,0xB5,0x8A,3},
+        {0xE9,0xB5,0x8B,3}, {0xE9,0xB5,0x8C,3}, {0xE9,0xB5,0x8D,3}, {0xE9,0xB5,0x8E,3}, {0xE9,0xB5,0x8F,3}, {0xE9,0xB5,0x90,3}, {0xE9,0xB5,0x91,3}, {0xE9,0xB5,0x92,3},
+        {0xE9,0xB5,0x93,3}, {0xE9,0xB5,0x94,3}, {0xE9,0xB5,0x95,3}, {0xE9,0xB5,0x96,3}, {0xE9,0xB5,0x97,3}, {0xE9,0xB5,0x98,3}, {0xE9,0xB5,0x99,3}, {0xE9,0xB5,0x9A,3},
+        {0xE9,0xB5,0x9B,3}, {0xE9,0xB5,0x9C,3}, {0xE9,0xB5,0x9D,3}, {0xE9,0xB5,0x9E,3}, {0xE9,0xB5,0x9F,3}, {0xE9,0xB5,0xA0,3}, {0xE9,0xB5,0xA1,3}, {0xE9,0xB5,0xA2,3},
+        {0xE9,0xB5,0xA3,3}, {0xE9,0xB5,0xA4,3}, {0xE9,0xB5,0xA5,3}, {0xE9,0xB5,0xA6,3}, {0xE9,0xB5,0xA7,3}, {0xE9,0xB5,0xA8,3}, {0xE9,0xB5,0xA9,3}, {0xE9,0xB5,0xAA,3},
+        {0xE9,0xB5,0xAB,3}, {0xE9,0xB5,0xAC,3}, {0xE9,0xB5,0xAD,3}, {0xE9,0xB5,0xAE,3}, {0xE9,0xB5,0xAF,3}, {0xE9,0xB5,0xB0,3}, {0xE9,0xB5,0xB1,3}, {0xE9,0xB5,0xB2,3},
+        {0xE9,0xB5,0xB3,3}, {0xE9,0xB5,0xB4,3}, {0xE9,0xB5,0xB5,3}, {0xE9,0xB5,0xB6,3}, {0xE9,0xB5,0xB7,3}, {0xE9,0xB5,0xB8,3}, {0xE9,0xB5,0xB9,3}, {0xE9,0xB5,0xBA,3},
+        {0xE9,0xB5,0xBB,3}, {0xE9,0xB5,0xBC,3}, {0xE9,0xB5,0xBD,3}, {0xE9,0xB5,0xBE,3}, {0xE9,0xB5,0xBF,3}, {0xE9,0xB6,0x80,3}, {0xE9,0xB6,0x81,3}, {0xE9,0xB6,0x82,3},
+        {0xE9,0xB6,0x83,3}, {0xE9,0xB6,0x84,3}, {0xE9,0xB6,0x85,3}, {0xE9,0xB6,0x86,3}, {0xE9,0xB6,0x87,3}, {0xE9,0xB6,0x88,3}, {0xE9,0xB6,0x89,3}, {0xE9,0xB6,0x8A,3},
+        {0xE9,0xB6,0x8B,3}, {0xE9,0xB6,0x8C,3}, {0xE9,0xB6,0x8D,3}, {0xE9,0xB6,0x8E,3}, {0xE9,0xB6,0x8F,3}, {0xE9,0xB6,0x90,3}, {0xE9,0xB6,0x91,3}, {0xE9,0xB6,0x92,3},
+        {0xE9,0xB6,0x93,3}, {0xE9,0xB6,0x94,3}, {0xE9,0xB6,0x95,3}, {0xE9,0xB6,0x96,3}, {0xE9,0xB6,0x97,3}, {0xE9,0xB6,0x98,3}, {0xE9,0xB6,0x99,3}, {0xE9,0xB6,0x9A,3},
+        {0xE9,0xB6,0x9B,3}, {0xE9,0xB6,0x9C,3}, {0xE9,0xB6,0x9D,3}, {0xE9,0xB6,0x9E,3}, {0xE9,0xB6,0x9F,3}, {0xE9,0xB6,0xA0,3}, {0xE9,0xB6,0xA1,3}, {0xE9,0xB6,0xA2,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xFA */ {
+        {0xE9,0xB6,0xA3,3}, {0xE9,0xB6,0xA4,3}, {0xE9,0xB6,0xA5,3}, {0xE9,0xB6,0xA6,3}, {0xE9,0xB6,0xA7,3}, {0xE9,0xB6,0xA8,3}, {0xE9,0xB6,0xA9,3}, {0xE9,0xB6,0xAA,3},
+        {0xE9,0xB6,0xAB,3}, {0xE9,0xB6,0xAC,3}, {0xE9,0xB6,0xAD,3}, {0xE9,0xB6,0xAE,3}, {0xE9,0xB6,0xAF,3}, {0xE9,0xB6,0xB0,3}, {0xE9,0xB6,0xB1,3}, {0xE9,0xB6,0xB2,3},
+        {0xE9,0xB6,0xB3,3}, {0xE9,0xB6,0xB4,3}, {0xE9,0xB6,0xB5,3}, {0xE9,0xB6,0xB6,3}, {0xE9,0xB6,0xB7,3}, {0xE9,0xB6,0xB8,3}, {0xE9,0xB6,0xB9,3}, {0xE9,0xB6,0xBA,3},
+        {0xE9,0xB6,0xBB,3}, {0xE9,0xB6,0xBC,3}, {0xE9,0xB6,0xBD,3}, {0xE9,0xB6,0xBE,3}, {0xE9,0xB6,0xBF,3}, {0xE9,0xB7,0x80,3}, {0xE9,0xB7,0x81,3}, {0xE9,0xB7,0x82,3},
+        {0xE9,0xB7,0x83,3}, {0xE9,0xB7,0x84,3}, {0xE9,0xB7,0x85,3}, {0xE9,0xB7,0x86,3}, {0xE9,0xB7,0x87,3}, {0xE9,0xB7,0x88,3}, {0xE9,0xB7,0x89,3}, {0xE9,0xB7,0x8A,3},
+        {0xE9,0xB7,0x8B,3}, {0xE9,0xB7,0x8C,3}, {0xE9,0xB7,0x8D,3}, {0xE9,0xB7,0x8E,3}, {0xE9,0xB7,0x8F,3}, {0xE9,0xB7,0x90,3}, {0xE9,0xB7,0x91,3}, {0xE9,0xB7,0x92,3},
+        {0xE9,0xB7,0x93,3}, {0xE9,0xB7,0x94,3}, {0xE9,0xB7,0x95,3}, {0xE9,0xB7,0x96,3}, {0xE9,0xB7,0x97,3}, {0xE9,0xB7,0x98,3}, {0xE9,0xB7,0x99,3}, {0xE9,0xB7,0x9A,3},
+        {0xE9,0xB7,0x9B,3}, {0xE9,0xB7,0x9C,3}, {0xE9,0xB7,0x9D,3}, {0xE9,0xB7,0x9E,3}, {0xE9,0xB7,0x9F,3}, {0xE9,0xB7,0xA0,3}, {0xE9,0xB7,0xA1,3}, {0xE9,0xB7,0xA2,3},
+        {0xE9,0xB7,0xA3,3}, {0xE9,0xB7,0xA4,3}, {0xE9,0xB7,0xA5,3}, {0xE9,0xB7,0xA6,3}, {0xE9,0xB7,0xA7,3}, {0xE9,0xB7,0xA8,3}, {0xE9,0xB7,0xA9,3}, {0xE9,0xB7,0xAA,3},
+        {0xE9,0xB7,0xAB,3}, {0xE9,0xB7,0xAC,3}, {0xE9,0xB7,0xAD,3}, {0xE9,0xB7,0xAE,3}, {0xE9,0xB7,0xAF,3}, {0xE9,0xB7,0xB0,3}, {0xE9,0xB7,0xB1,3}, {0xE9,0xB7,0xB2,3},
+        {0xE9,0xB7,0xB3,3}, {0xE9,0xB7,0xB4,3}, {0xE9,0xB7,0xB5,3}, {0xE9,0xB7,0xB6,3}, {0xE9,0xB7,0xB7,3}, {0xE9,0xB7,0xB8,3}, {0xE9,0xB7,0xB9,3}, {0xE9,0xB7,0xBA,3},
+        {0xE9,0xB7,0xBB,3}, {0xE9,0xB7,0xBC,3}, {0xE9,0xB7,0xBD,3}, {0xE9,0xB7,0xBE,3}, {0xE9,0xB7,0xBF,3}, {0xE9,0xB8,0x80,3}, {0xE9,0xB8,0x81,3}, {0xE9,0xB8,0x82,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xFB */ {
+        {0xE9,0xB8,0x83,3}, {0xE9,0xB8,0x84,3}, {0xE9,0xB8,0x85,3}, {0xE9,0xB8,0x86,3}, {0xE9,0xB8,0x87,3}, {0xE9,0xB8,0x88,3}, {0xE9,0xB8,0x89,3}, {0xE9,0xB8,0x8A,3},
+        {0xE9,0xB8,0x8B,3}, {0xE9,0xB8,0x8C,3}, {0xE9,0xB8,0x8D,3}, {0xE9,0xB8,0x8E,3}, {0xE9,0xB8,0x8F,3}, {0xE9,0xB8,0x90,3}, {0xE9,0xB8,0x91,3}, {0xE9,0xB8,0x92,3},
+        {0xE9,0xB8,0x93,3}, {0xE9,0xB8,0x94,3}, {0xE9,0xB8,0x95,3}, {0xE9,0xB8,0x96,3}, {0xE9,0xB8,0x97,3}, {0xE9,0xB8,0x98,3}, {0xE9,0xB8,0x99,3}, {0xE9,0xB8,0x9A,3},
+        {0xE9,0xB8,0x9B,3}, {0xE9,0xB8,0x9C,3}, {0xE9,0xB8,0x9D,3}, {0xE9,0xB8,0x9E,3}, {0xE9,0xB8,0xA4,3}, {0xE9,0xB8,0xA7,3}, {0xE9,0xB8,0xAE,3}, {0xE9,0xB8,0xB0,3},
+        {0xE9,0xB8,0xB4,3}, {0xE9,0xB8,0xBB,3}, {0xE9,0xB8,0xBC,3}, {0xE9,0xB9,0x80,3}, {0xE9,0xB9,0x8D,3}, {0xE9,0xB9,0x90,3}, {0xE9,0xB9,0x92,3}, {0xE9,0xB9,0x93,3},
+        {0xE9,0xB9,0x94,3}, {0xE9,0xB9,0x96,3}, {0xE9,0xB9,0x99,3}, {0xE9,0xB9,0x9D,3}, {0xE9,0xB9,0x9F,3}, {0xE9,0xB9,0xA0,3}, {0xE9,0xB9,0xA1,3}, {0xE9,0xB9,0xA2,3},
+        {0xE9,0xB9,0xA5,3}, {0xE9,0xB9,0xAE,3}, {0xE9,0xB9,0xAF,3}, {0xE9,0xB9,0xB2,3}, {0xE9,0xB9,0xB4,3}, {0xE9,0xB9,0xB5,3}, {0xE9,0xB9,0xB6,3}, {0xE9,0xB9,0xB7,3},
+        {0xE9,0xB9,0xB8,3}, {0xE9,0xB9,0xB9,3}, {0xE9,0xB9,0xBA,3}, {0xE9,0xB9,0xBB,3}, {0xE9,0xB9,0xBC,3}, {0xE9,0xB9,0xBD,3}, {0xE9,0xBA,0x80,3}, {0xE9,0xBA,0x81,3},
+        {0xE9,0xBA,0x83,3}, {0xE9,0xBA,0x84,3}, {0xE9,0xBA,0x85,3}, {0xE9,0xBA,0x86,3}, {0xE9,0xBA,0x89,3}, {0xE9,0xBA,0x8A,3}, {0xE9,0xBA,0x8C,3}, {0xE9,0xBA,0x8D,3},
+        {0xE9,0xBA,0x8E,3}, {0xE9,0xBA,0x8F,3}, {0xE9,0xBA,0x90,3}, {0xE9,0xBA,0x91,3}, {0xE9,0xBA,0x94,3}, {0xE9,0xBA,0x95,3}, {0xE9,0xBA,0x96,3}, {0xE9,0xBA,0x97,3},
+        {0xE9,0xBA,0x98,3}, {0xE9,0xBA,0x99,3}, {0xE9,0xBA,0x9A,3}, {0xE9,0xBA,0x9B,3}, {0xE9,0xBA,0x9C,3}, {0xE9,0xBA,0x9E,3}, {0xE9,0xBA,0xA0,3}, {0xE9,0xBA,0xA1,3},
+        {0xE9,0xBA,0xA2,3}, {0xE9,0xBA,0xA3,3}, {0xE9,0xBA,0xA4,3}, {0xE9,0xBA,0xA5,3}, {0xE9,0xBA,0xA7,3}, {0xE9,0xBA,0xA8,3}, {0xE9,0xBA,0xA9,3}, {0xE9,0xBA,0xAA,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xFC */ {
+        {0xE9,0xBA,0xAB,3}, {0xE9,0xBA,0xAC,3}, {0xE9,0xBA,0xAD,3}, {0xE9,0xBA,0xAE,3}, {0xE9,0xBA,0xAF,3}, {0xE9,0xBA,0xB0,3}, {0xE9,0xBA,0xB1,3}, {0xE9,0xBA,0xB2,3},
+        {0xE9,0xBA,0xB3,3}, {0xE9,0xBA,0xB5,3}, {0xE9,0xBA,0xB6,3}, {0xE9,0xBA,0xB7,3}, {0xE9,0xBA,0xB9,3}, {0xE9,0xBA,0xBA,3}, {0xE9,0xBA,0xBC,3}, {0xE9,0xBA,0xBF,3},
+        {0xE9,0xBB,0x80,3}, {0xE9,0xBB,0x81,3}, {0xE9,0xBB,0x82,3}, {0xE9,0xBB,0x83,3}, {0xE9,0xBB,0x85,3}, {0xE9,0xBB,0x86,3}, {0xE9,0xBB,0x87,3}, {0xE9,0xBB,0x88,3},
+        {0xE9,0xBB,0x8A,3}, {0xE9,0xBB,0x8B,3}, {0xE9,0xBB,0x8C,3}, {0xE9,0xBB,0x90,3}, {0xE9,0xBB,0x92,3}, {0xE9,0xBB,0x93,3}, {0xE9,0xBB,0x95,3}, {0xE9,0xBB,0x96,3},
+        {0xE9,0xBB,0x97,3}, {0xE9,0xBB,0x99,3}, {0xE9,0xBB,0x9A,3}, {0xE9,0xBB,0x9E,3}, {0xE9,0xBB,0xA1,3}, {0xE9,0xBB,0xA3,3}, {0xE9,0xBB,0xA4,3}, {0xE9,0xBB,0xA6,3},
+        {0xE9,0xBB,0xA8,3}, {0xE9,0xBB,0xAB,3}, {0xE9,0xBB,0xAC,3}, {0xE9,0xBB,0xAD,3}, {0xE9,0xBB,0xAE,3}, {0xE9,0xBB,0xB0,3}, {0xE9,0xBB,0xB1,3}, {0xE9,0xBB,0xB2,3},
+        {0xE9,0xBB,0xB3,3}, {0xE9,0xBB,0xB4,3}, {0xE9,0xBB,0xB5,3}, {0xE9,0xBB,0xB6,3}, {0xE9,0xBB,0xB7,3}, {0xE9,0xBB,0xB8,3}, {0xE9,0xBB,0xBA,3}, {0xE9,0xBB,0xBD,3},
+        {0xE9,0xBB,0xBF,3}, {0xE9,0xBC,0x80,3}, {0xE9,0xBC,0x81,3}, {0xE9,0xBC,0x82,3}, {0xE9,0xBC,0x83,3}, {0xE9,0xBC,0x84,3}, {0xE9,0xBC,0x85,3}, {0xE9,0xBC,0x86,3},
+        {0xE9,0xBC,0x87,3}, {0xE9,0xBC,0x88,3}, {0xE9,0xBC,0x89,3}, {0xE9,0xBC,0x8A,3}, {0xE9,0xBC,0x8C,3}, {0xE9,0xBC,0x8F,3}, {0xE9,0xBC,0x91,3}, {0xE9,0xBC,0x92,3},
+        {0xE9,0xBC,0x94,3}, {0xE9,0xBC,0x95,3}, {0xE9,0xBC,0x96,3}, {0xE9,0xBC,0x98,3}, {0xE9,0xBC,0x9A,3}, {0xE9,0xBC,0x9B,3}, {0xE9,0xBC,0x9C,3}, {0xE9,0xBC,0x9D,3},
+        {0xE9,0xBC,0x9E,3}, {0xE9,0xBC,0x9F,3}, {0xE9,0xBC,0xA1,3}, {0xE9,0xBC,0xA3,3}, {0xE9,0xBC,0xA4,3}, {0xE9,0xBC,0xA5,3}, {0xE9,0xBC,0xA6,3}, {0xE9,0xBC,0xA7,3},
+        {0xE9,0xBC,0xA8,3}, {0xE9,0xBC,0xA9,3}, {0xE9,0xBC,0xAA,3}, {0xE9,0xBC,0xAB,3}, {0xE9,0xBC,0xAD,3}, {0xE9,0xBC,0xAE,3}, {0xE9,0xBC,0xB0,3}, {0xE9,0xBC,0xB1,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xFD */ {
+        {0xE9,0xBC,0xB2,3}, {0xE9,0xBC,0xB3,3}, {0xE9,0xBC,0xB4,3}, {0xE9,0xBC,0xB5,3}, {0xE9,0xBC,0xB6,3}, {0xE9,0xBC,0xB8,3}, {0xE9,0xBC,0xBA,3}, {0xE9,0xBC,0xBC,3},
+        {0xE9,0xBC,0xBF,3}, {0xE9,0xBD,0x80,3}, {0xE9,0xBD,0x81,3}, {0xE9,0xBD,0x82,3}, {0xE9,0xBD,0x83,3}, {0xE9,0xBD,0x85,3}, {0xE9,0xBD,0x86,3}, {0xE9,0xBD,0x87,3},
+        {0xE9,0xBD,0x88,3}, {0xE9,0xBD,0x89,3}, {0xE9,0xBD,0x8A,3}, {0xE9,0xBD,0x8B,3}, {0xE9,0xBD,0x8C,3}, {0xE9,0xBD,0x8D,3}, {0xE9,0xBD,0x8E,3}, {0xE9,0xBD,0x8F,3},
+        {0xE9,0xBD,0x92,3}, {0xE9,0xBD,0x93,3}, {0xE9,0xBD,0x94,3}, {0xE9,0xBD,0x95,3}, {0xE9,0xBD,0x96,3}, {0xE9,0xBD,0x97,3}, {0xE9,0xBD,0x98,3}, {0xE9,0xBD,0x99,3},
+        {0xE9,0xBD,0x9A,3}, {0xE9,0xBD,0x9B,3}, {0xE9,0xBD,0x9C,3}, {0xE9,0xBD,0x9D,3}, {0xE9,0xBD,0x9E,3}, {0xE9,0xBD,0x9F,3}, {0xE9,0xBD,0xA0,3}, {0xE9,0xBD,0xA1,3},
+        {0xE9,0xBD,0xA2,3}, {0xE9,0xBD,0xA3,3}, {0xE9,0xBD,0xA4,3}, {0xE9,0xBD,0xA5,3}, {0xE9,0xBD,0xA6,3}, {0xE9,0xBD,0xA7,3}, {0xE9,0xBD,0xA8,3}, {0xE9,0xBD,0xA9,3},
+        {0xE9,0xBD,0xAA,3}, {0xE9,0xBD,0xAB,3}, {0xE9,0xBD,0xAC,3}, {0xE9,0xBD,0xAD,3}, {0xE9,0xBD,0xAE,3}, {0xE9,0xBD,0xAF,3}, {0xE9,0xBD,0xB0,3}, {0xE9,0xBD,0xB1,3},
+        {0xE9,0xBD,0xB2,3}, {0xE9,0xBD,0xB3,3}, {0xE9,0xBD,0xB4,3}, {0xE9,0xBD,0xB5,3}, {0xE9,0xBD,0xB6,3}, {0xE9,0xBD,0xB7,3}, {0xE9,0xBD,0xB8,3}, {0xE9,0xBD,0xB9,3},
+        {0xE9,0xBD,0xBA,3}, {0xE9,0xBD,0xBB,3}, {0xE9,0xBD,0xBC,3}, {0xE9,0xBD,0xBD,3}, {0xE9,0xBD,0xBE,3}, {0xE9,0xBE,0x81,3}, {0xE9,0xBE,0x82,3}, {0xE9,0xBE,0x8D,3},
+        {0xE9,0xBE,0x8E,3}, {0xE9,0xBE,0x8F,3}, {0xE9,0xBE,0x90,3}, {0xE9,0xBE,0x91,3}, {0xE9,0xBE,0x92,3}, {0xE9,0xBE,0x93,3}, {0xE9,0xBE,0x94,3}, {0xE9,0xBE,0x95,3},
+        {0xE9,0xBE,0x96,3}, {0xE9,0xBE,0x97,3}, {0xE9,0xBE,0x98,3}, {0xE9,0xBE,0x9C,3}, {0xE9,0xBE,0x9D,3}, {0xE9,0xBE,0x9E,3}, {0xE9,0xBE,0xA1,3}, {0xE9,0xBE,0xA2,3},
+        {0xE9,0xBE,0xA3,3}, {0xE9,0xBE,0xA4,3}, {0xE9,0xBE,0xA5,3}, {0xEF,0xA4,0xAC,3}, {0xEF,0xA5,0xB9,3}, {0xEF,0xA6,0x95,3}, {0xEF,0xA7,0xA7,3}, {0xEF,0xA7,0xB1,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+    /* 0xFE */ {
+        {0xEF,0xA8,0x8C,3}, {0xEF,0xA8,0x8D,3}, {0xEF,0xA8,0x8E,3}, {0xEF,0xA8,0x8F,3}, {0xEF,0xA8,0x91,3}, {0xEF,0xA8,0x93,3}, {0xEF,0xA8,0x94,3}, {0xEF,0xA8,0x98,3},
+        {0xEF,0xA8,0x9F,3}, {0xEF,0xA8,0xA0,3}, {0xEF,0xA8,0xA1,3}, {0xEF,0xA8,0xA3,3}, {0xEF,0xA8,0xA4,3}, {0xEF,0xA8,0xA7,3}, {0xEF,0xA8,0xA8,3}, {0xEF,0xA8,0xA9,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+        {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3}, {0xEF,0xBF,0xBD,3},
+    },
+};
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "esp_err.h"
 
@@ -32,12 +33,30 @@ typedef enum {
  */
 text_encoding_t text_encoding_detect(const char* buf, size_t len);
 
+/**
+ * @brief 严格校验 UTF-8，返回首个非法序列的偏移。
+ *
+ * 拒绝续字节开头、C0/C1/F5-FF、overlong、代理区 (U+D800-DFFF) 和
+ * 超出 U+10FFFF 的序列。ASCII 按 8 字节整字跳过。
+ * incomplete 非 NULL 时，末尾合法但不完整的序列不算错误，其字节数写入
+ * *incomplete，调用方把这几个字节接到下一段开头继续校验；incomplete 为
+ * NULL 时视为非法。
+ *
+ * @param buf         字节缓冲区
+ * @param len         缓冲区长度
+ * @param incomplete  输出: 末尾不完整序列的字节数 (0-3)，可为 NULL
+ * @return 首个非法序列的偏移；全部合法返回 len
+ */
+size_t text_encoding_utf8_validate(const char* buf, size_t len,
+                                   size_t* incomplete);
+
 /**
  * @brief 将 GBK 编码的缓冲区转换为 UTF-8。
  *
- * ASCII 字节直接输出，GBK 双字节通过映射表转为 UTF-8。
- * 无法映射的序列输出 U+FFFD (EF BF BD)。
+ * ASCII 字节直接输出（连续 8 个整字复制），GBK 双字节查预编码的
+ * UTF-8 表输出。无法映射的序列输出 U+FFFD (EF BF BD)。
  * 目标缓冲区不足时截断到最后一个完整 UTF-8 字符。
+ * dst 中 *dst_len 之后、容量以内的字节可能被改写。
  *
  * @param src      GBK 源缓冲区
  * @param src_len  源缓冲区长度
@@ -48,6 +67,22 @@ text_encoding_t text_encoding_detect(const char* buf, size_t len);
 esp_err_t text_encoding_gbk_to_utf8(const char* src, size_t src_len,
                                      char* dst, size_t* dst_len);
 
+/**
+ * @brief 计算 GBK 缓冲区转换为 UTF-8 后的字节数（不写出数据）。
+ *
+ * 与 text_encoding_gbk_to_utf8 逐字符一致。src_final 为 false 时，
+ * 末尾可能被截断的双字节首字节不计入，src_used 返回实际消耗的源字节数；
+ * 下一段从 src + *src_used 继续，分段结果与整体转换完全一致。
+ *
+ * @param src        GBK 源缓冲区
+ * @param src_len    源缓冲区长度
+ * @param src_final  是否为源数据的最后一段
+ * @param src_used   输出: 消耗的源字节数（可为 NULL）
+ * @return 转换后的 UTF-8 字节数
+ */
+size_t text_encoding_gbk_utf8_len(const char* src, size_t src_len,
+                                  bool src_final, size_t* src_used);
+
 #ifdef __cplusplus
 }
 #endif
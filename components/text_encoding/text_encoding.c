@@ -7,8 +7,14 @@
 #include <stdint.h>
 #include <string.h>
 
-/* GBK→Unicode 映射表（由 generate_gbk_table.py 生成） */
-extern const uint16_t gbk_to_unicode[126][190];
+/* GBK→UTF-8 预编码表（由 generate_gbk_table.py 生成）：{字节 0-2, 字节数} */
+extern const uint8_t gbk_utf8_table[126][190][4];
+
+/* U+FFFD，与预编码表单元格式相同 */
+static const uint8_t k_replacement[4] = {0xEF, 0xBF, 0xBD, 3};
+
+/* 8 个字节的最高位：全为 0 即 8 个 ASCII */
+#define ASCII_MASK8 0x8080808080808080ULL
 
 /**
  * @brief 计算 GBK 次字节的列索引。
@@ -19,72 +25,104 @@ static inline int gbk_col(uint8_t lo) {
     return (lo < 0x80) ? (lo - 0x40) : (lo - 0x41);
 }
 
+/** @brief src 起的 8 个字节是否全为 ASCII。 */
+static inline bool ascii8(const uint8_t* src) {
+    uint64_t w;
+    memcpy(&w, src, 8);
+    return (w & ASCII_MASK8) == 0;
+}
+
 // ════════════════════════════════════════════════════════════════
-//  编码检测
+//  UTF-8 校验
 // ════════════════════════════════════════════════════════════════
 
-text_encoding_t text_encoding_detect(const char* buf, size_t len) {
-    if (!buf || len == 0) {
-        return TEXT_ENCODING_UTF8;
+/**
+ * @brief 多字节序列首字节的长度与第二字节的合法范围。
+ *
+ * 第二字节范围排除 overlong (E0 80-9F, F0 80-8F)、代理区 (ED A0-BF)
+ * 和超出 U+10FFFF 的码位 (F4 90-BF)。
+ * @return 序列长度 2-4，非法首字节返回 0
+ */
+static inline int utf8_lead(uint8_t b, uint8_t* lo, uint8_t* hi) {
+    *lo = 0x80;
+    *hi = 0xBF;
+    if (b >= 0xC2 && b <= 0xDF) return 2;
+    if (b >= 0xE0 && b <= 0xEF) {
+        if (b == 0xE0) *lo = 0xA0;
+        if (b == 0xED) *hi = 0x9F;
+        return 3;
+    }
+    if (b >= 0xF0 && b <= 0xF4) {
+        if (b == 0xF0) *lo = 0x90;
+        if (b == 0xF4) *hi = 0x8F;
+        return 4;
     }
+    return 0;  /* 80-BF 续字节、C0-C1、F5-FF */
+}
 
+size_t text_encoding_utf8_validate(const char* buf, size_t len,
+                                   size_t* incomplete) {
     const uint8_t* p = (const uint8_t*)buf;
+    size_t i = 0;
 
-    /* 1. BOM 检测 */
-    if (len >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
-        return TEXT_ENCODING_UTF8_BOM;
-    }
+    if (incomplete) *incomplete = 0;
+    if (!buf) return 0;
 
-    /* 2. UTF-8 严格校验 */
-    size_t i = 0;
     while (i < len) {
         uint8_t b = p[i];
 
         if (b < 0x80) {
-            /* ASCII */
+            /* ASCII: 整字跳过 */
             i++;
+            while (len - i >= 8 && ascii8(p + i)) i += 8;
             continue;
         }
 
-        /* 确定多字节序列长度 */
-        int seq_len;
-        if (b >= 0xC2 && b <= 0xDF) {
-            seq_len = 2;
-        } else if (b >= 0xE0 && b <= 0xEF) {
-            seq_len = 3;
-        } else if (b >= 0xF0 && b <= 0xF4) {
-            seq_len = 4;
-        } else {
-            /* C0-C1, F5-FF 或 80-BF 开头 → 非法 UTF-8 */
-            return TEXT_ENCODING_GBK;
-        }
-
-        /* 探测缓冲区末尾的不完整序列：视为截断而非非法 UTF-8 */
-        if (i + seq_len > len) {
-            break;
-        }
+        uint8_t lo, hi;
+        int seq_len = utf8_lead(b, &lo, &hi);
+        if (seq_len == 0) return i;
 
-        /* 验证 continuation bytes (0x80-0xBF) */
-        for (int j = 1; j < seq_len; j++) {
-            if ((p[i + j] & 0xC0) != 0x80) {
-                return TEXT_ENCODING_GBK;
-            }
-        }
-
-        /* 检查 overlong 编码 */
-        if (seq_len == 3 && b == 0xE0 && p[i + 1] < 0xA0) {
-            return TEXT_ENCODING_GBK;
+        /* 缓冲区末尾的不完整序列：已有部分合法时交给下一段补全 */
+        size_t avail = len - i;
+        size_t check = (avail < (size_t)seq_len) ? avail : (size_t)seq_len;
+        if (check >= 2 && (p[i + 1] < lo || p[i + 1] > hi)) return i;
+        for (size_t j = 2; j < check; j++) {
+            if ((p[i + j] & 0xC0) != 0x80) return i;
         }
-        if (seq_len == 4 && b == 0xF0 && p[i + 1] < 0x90) {
-            return TEXT_ENCODING_GBK;
-        }
-        if (seq_len == 4 && b == 0xF4 && p[i + 1] > 0x8F) {
-            return TEXT_ENCODING_GBK;
+        if (avail < (size_t)seq_len) {
+            if (!incomplete) return i;
+            *incomplete = avail;
+            return len;
         }
 
         i += seq_len;
     }
 
+    return len;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  编码检测
+// ════════════════════════════════════════════════════════════════
+
+text_encoding_t text_encoding_detect(const char* buf, size_t len) {
+    if (!buf || len == 0) {
+        return TEXT_ENCODING_UTF8;
+    }
+
+    const uint8_t* p = (const uint8_t*)buf;
+
+    /* 1. BOM 检测 */
+    if (len >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+        return TEXT_ENCODING_UTF8_BOM;
+    }
+
+    /* 2. UTF-8 严格校验（探测缓冲区末尾的不完整序列视为截断而非非法） */
+    size_t tail = 0;
+    if (text_encoding_utf8_validate(buf, len, &tail) != len) {
+        return TEXT_ENCODING_GBK;
+    }
+
     return TEXT_ENCODING_UTF8;
 }
 
@@ -93,26 +131,15 @@ text_encoding_t text_encoding_detect(const char* buf, size_t len) {
 // ════════════════════════════════════════════════════════════════
 
 /**
- * @brief 将 Unicode codepoint 编码为 UTF-8，写入 dst。
- * @return 写入的字节数 (1-3)，0 表示空间不足。
+ * @brief GBK 双字节对应的预编码 UTF-8 单元。
+ *
+ * 次字节越界与无映射的码位都得到 U+FFFD。
  */
-static size_t encode_utf8(uint16_t cp, char* dst, size_t remaining) {
-    if (cp < 0x80) {
-        if (remaining < 1) return 0;
-        dst[0] = (char)cp;
-        return 1;
-    } else if (cp < 0x800) {
-        if (remaining < 2) return 0;
-        dst[0] = (char)(0xC0 | (cp >> 6));
-        dst[1] = (char)(0x80 | (cp & 0x3F));
-        return 2;
-    } else {
-        if (remaining < 3) return 0;
-        dst[0] = (char)(0xE0 | (cp >> 12));
-        dst[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
-        dst[2] = (char)(0x80 | (cp & 0x3F));
-        return 3;
+static inline const uint8_t* gbk_cell(uint8_t hi, uint8_t lo) {
+    if (lo >= 0x40 && lo <= 0xFE && lo != 0x7F) {
+        return gbk_utf8_table[hi - 0x81][gbk_col(lo)];
     }
+    return k_replacement;
 }
 
 esp_err_t text_encoding_gbk_to_utf8(const char* src, size_t src_len,
@@ -121,50 +148,72 @@ esp_err_t text_encoding_gbk_to_utf8(const char* src, size_t src_len,
         return ESP_FAIL;
     }
 
+    const uint8_t* p = (const uint8_t*)src;
     size_t capacity = *dst_len;
     size_t di = 0;  /* 目标偏移 */
     size_t si = 0;  /* 源偏移 */
 
+    /* 主循环：源至少剩 8 字节、目标至少剩 8 字节，每步输出不超过 8 字节，
+     * 省去逐字符的边界检查 */
+    while (src_len - si >= 8 && capacity - di >= 8) {
+        uint8_t b = p[si];
+
+        if (b < 0x80) {
+            if (ascii8(p + si)) {
+                memcpy(dst + di, p + si, 8);
+                di += 8;
+                si += 8;
+            } else {
+                dst[di++] = (char)b;
+                si++;
+            }
+        } else if (b != 0x80 && b != 0xFF) {
+            /* 整单元写入；第 4 字节随后被覆盖或落在有效长度之外 */
+            const uint8_t* cell = gbk_cell(b, p[si + 1]);
+            memcpy(dst + di, cell, 4);
+            di += cell[3];
+            si += 2;
+        } else {
+            memcpy(dst + di, k_replacement, 3);
+            di += 3;
+            si++;
+        }
+    }
+
+    /* 尾部：逐字符检查边界 */
     while (si < src_len) {
-        uint8_t b = (uint8_t)src[si];
+        uint8_t b = p[si];
 
         if (b < 0x80) {
-            /* ASCII: 直接输出 */
+            /* ASCII: 连续 8 个一次复制，不足 8 个逐字节输出 */
+            if (src_len - si >= 8 && capacity - di >= 8 && ascii8(p + si)) {
+                memcpy(dst + di, p + si, 8);
+                di += 8;
+                si += 8;
+                continue;
+            }
             if (di >= capacity) break;
             dst[di++] = (char)b;
             si++;
         } else if (b >= 0x81 && b <= 0xFE && si + 1 < src_len) {
-            /* GBK 双字节 */
-            uint8_t lo = (uint8_t)src[si + 1];
-
-            if (lo >= 0x40 && lo <= 0xFE && lo != 0x7F) {
-                int row = b - 0x81;
-                int col = gbk_col(lo);
-                uint16_t cp = gbk_to_unicode[row][col];
-
-                if (cp != 0) {
-                    size_t n = encode_utf8(cp, dst + di, capacity - di);
-                    if (n == 0) break;  /* 空间不足，截断 */
-                    di += n;
-                } else {
-                    /* 映射值为 0：无效 → U+FFFD */
-                    size_t n = encode_utf8(0xFFFD, dst + di, capacity - di);
-                    if (n == 0) break;
-                    di += n;
-                }
-                si += 2;
+            /* GBK 双字节：查预编码表 */
+            const uint8_t* cell = gbk_cell(b, p[si + 1]);
+            size_t n = cell[3];
+            if (capacity - di >= 4) {
+                /* 整单元写入；第 4 字节随后被覆盖或落在有效长度之外 */
+                memcpy(dst + di, cell, 4);
+            } else if (capacity - di >= n) {
+                memcpy(dst + di, cell, n);
             } else {
-                /* 次字节越界 → U+FFFD */
-                size_t n = encode_utf8(0xFFFD, dst + di, capacity - di);
-                if (n == 0) break;
-                di += n;
-                si += 2;
+                break;  /* 空间不足，截断 */
             }
+            di += n;
+            si += 2;
         } else {
             /* 孤立高字节 → U+FFFD */
-            size_t n = encode_utf8(0xFFFD, dst + di, capacity - di);
-            if (n == 0) break;
-            di += n;
+            if (capacity - di < 3) break;
+            memcpy(dst + di, k_replacement, 3);
+            di += 3;
             si++;
         }
     }
@@ -172,3 +221,37 @@ esp_err_t text_encoding_gbk_to_utf8(const char* src, size_t src_len,
     *dst_len = di;
     return ESP_OK;
 }
+
+size_t text_encoding_gbk_utf8_len(const char* src, size_t src_len,
+                                  bool src_final, size_t* src_used) {
+    const uint8_t* p = (const uint8_t*)src;
+    size_t total = 0;
+    size_t si = 0;
+
+    while (si < src_len) {
+        uint8_t b = p[si];
+
+        if (b < 0x80) {
+            if (src_len - si >= 8 && ascii8(p + si)) {
+                total += 8;
+                si += 8;
+            } else {
+                total += 1;
+                si++;
+            }
+        } else if (b >= 0x81 && b <= 0xFE && si + 1 < src_len) {
+            total += gbk_cell(b, p[si + 1])[3];
+            si += 2;
+        } else if (b >= 0x81 && b <= 0xFE && !src_final) {
+            /* 末尾首字节：次字节在下一段，留给下一段处理 */
+            break;
+        } else {
+            /* 孤立高字节 → U+FFFD */
+            total += 3;
+            si++;
+        }
+    }
+
+    if (src_used) *src_used = si;
+    return total;
+}
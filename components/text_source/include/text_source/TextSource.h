@@ -1,20 +1,32 @@
 /**
  * @file TextSource.h
- * @brief 流式 UTF-8 文本访问层 — 滑动窗口 + GBK 后台转换。
+ * @brief 流式 UTF-8 文本访问层 — 块缓存 + GBK 随机访问转换。
  *
- * 提供统一的 UTF-8 文本按 offset 读取接口。内部使用 512KB PSRAM
- * 滑动缓冲区按需加载文本，GBK 文件通过后台 FreeRTOS task 流式转换
- * 到 SD 卡缓存。
+ * 提供统一的 UTF-8 文本按 offset 读取接口。内部使用 PSRAM 块缓存
+ * （固定大小对齐块 + LRU 淘汰）按需加载文本。GBK 文件先由后台
+ * FreeRTOS task 扫描出分段 checkpoint 映射，任意位置的段可按需转换到
+ * SD 卡缓存，其余段由后台补齐。
+ *
+ * UTF-8 判定只探测文件开头；打开后后台校验整个文件，发现非法序列时
+ * 切换到 GBK 转换路径并递增 contentVersion()，消费者据此重新分页。
+ *
+ * 多个消费者（后台分页、前台渲染）应各自持有一个 TextCursor：
+ * 游标 pin 住自己当前所在的块，互不淘汰对方的工作集。
  */
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <mutex>
 
 // Forward declarations for internal types
-struct TextWindow;
+struct BlockCache;
 struct EncodingConverter;
+struct ReadAhead;
+struct Utf8Validator;
 
 namespace ink {
 
@@ -23,15 +35,92 @@ enum class TextSourceState {
     Closed,      ///< 未打开
     Preparing,   ///< 正在检测编码、加载首块
     Available,   ///< 首块已就绪，可顺序阅读
-    Converting,  ///< GBK 后台转换进行中（首块已可读）
+    Converting,  ///< GBK 后台转换进行中（已扫描范围可按需读取）
     Ready,       ///< 全部文本可访问
     Error,       ///< 打开失败
 };
 
+/// 阅读方向（用于后台预读）
+enum class ReadDirection {
+    Forward,   ///< 向后翻页，预读后续块
+    Backward,  ///< 向前翻页，预读之前的块
+};
+
+/// tryRead() 结果
+enum class ReadStatus {
+    Ok,           ///< 文本已在缓存中，span 有效
+    Pending,      ///< 需要磁盘 I/O，已交给后台预读，载入后调用就绪回调
+    Unavailable,  ///< offset 超出可用范围或数据源未打开
+};
+
 /// 文本片段 — 指向内部缓冲区的 UTF-8 文本
 struct TextSpan {
     const char* data;   ///< 指向内部缓冲区，下次 read() 或 close() 前有效
-    uint32_t length;    ///< 从该 offset 起可用的连续字节数
+    uint32_t length;    ///< 从该 offset 起可用的连续字节数（read() 止于缓存块末尾）
+};
+
+/// 游标访问模式
+enum class CursorMode {
+    Interactive,  ///< 交互阅读：访问的块按 LRU 正常保留
+    Sequential,   ///< 顺序扫描（如分页）：读过的块不提升 LRU，优先被淘汰
+};
+
+class TextSource;
+
+/// 独立读取游标 — 每个消费者一个，持有当前片段所在块的 pin。
+///
+/// 游标返回的片段在该游标下次读取、release() 或 close() 之前有效，
+/// 不受其他游标或 TextSource::read() 的并发读取影响。
+/// 游标本身不是线程安全的，应只在一个线程中使用；必须先于其
+/// TextSource 销毁（或先 bind(nullptr)）。
+class TextCursor {
+public:
+    explicit TextCursor(CursorMode mode = CursorMode::Interactive);
+    ~TextCursor();
+
+    // 不可拷贝、不可移动（pin 与游标地址无关，但避免重复释放）
+    TextCursor(const TextCursor&) = delete;
+    TextCursor& operator=(const TextCursor&) = delete;
+
+    /// 绑定数据源，释放旧数据源上的 pin。传 nullptr 解除绑定。
+    void bind(TextSource* source);
+
+    /// 读取 offset 处的文本并 pin 住其所在块（释放上一次的 pin）
+    /// @return offset 超出可用范围或未绑定时返回 {nullptr, 0}
+    TextSpan read(uint32_t offset);
+
+    /// 读取至少 minLen 字节的连续文本（到达可用范围末尾时可更短）。
+    /// 单块足够时直接返回 pin 住的块内片段；跨块时拼接到游标自己的
+    /// PSRAM 拼接缓冲区。片段止于完整 UTF-8 字符，内容与块边界位置无关。
+    /// 片段在该游标下次读取、release() 或析构前有效。
+    TextSpan readRange(uint32_t offset, uint32_t minLen);
+
+    /// 非阻塞读取，语义同 TextSource::tryRead()，返回 Ok 时 pin 住块
+    ReadStatus tryRead(uint32_t offset, TextSpan* out);
+
+    /// 非阻塞的 readRange()：所需的块都已缓存时返回 Ok 和拼接好的片段；
+    /// 任一块未缓存时返回 Pending，该块交给后台预读
+    ReadStatus tryReadRange(uint32_t offset, uint32_t minLen, TextSpan* out);
+
+    /// 释放 pin，之前返回的片段随即失效
+    void release();
+
+    TextSource* source() const { return source_; }
+
+private:
+    friend class TextSource;
+
+    /// readRange() / tryReadRange() 共用：wait 为 false 时不做 I/O
+    ReadStatus readRangeImpl(uint32_t offset, uint32_t minLen, bool wait,
+                             TextSpan* out);
+
+    TextSource* source_ = nullptr;
+    CursorMode mode_;
+    int32_t pinSlot_ = -1;   ///< 被 pin 的缓存槽位（-1 表示无）
+    uint32_t pinGen_ = 0;    ///< 槽位代数，槽位被重新加载后 pin 自动失效
+
+    char* stitchBuf_ = nullptr;  ///< 跨块拼接缓冲区（PSRAM，按需扩容）
+    uint32_t stitchCap_ = 0;
 };
 
 /// 流式 UTF-8 文本源
@@ -52,18 +141,32 @@ public:
     /// @return true 如果打开成功
     bool open(const char* filePath, const char* cacheDirPath);
 
-    /// 关闭并释放所有资源（PSRAM 缓冲区、文件句柄、后台 task）
+    /// 关闭并释放所有资源（PSRAM 块缓存、文件句柄、后台 task）
     void close();
 
-    /// 读取指定 offset 处的 UTF-8 文本。
+    /// 读取指定 offset 处的 UTF-8 文本（不 pin 块）。
+    /// 有多个并发消费者时片段可能被其他读取淘汰，此时应使用 TextCursor。
     /// @param offset UTF-8 字节偏移量
     /// @return TextSpan，offset 超出可用范围时返回 {nullptr, 0}
     TextSpan read(uint32_t offset);
 
+    /// 非阻塞读取：文本已缓存时立即返回 Ok；否则不做 I/O，
+    /// 请求后台预读加载并返回 Pending，块载入后调用就绪回调。
+    /// 预读 task 未能启动时退化为阻塞读取。
+    /// @param out 输出片段，仅在返回 Ok 时有效
+    ReadStatus tryRead(uint32_t offset, TextSpan* out);
+
+    /// 设置就绪回调：tryRead() 返回 Pending 的块载入后调用
+    /// （在预读 task 中调用，应只做通知性工作，如请求重绘）
+    void setReadReadyCallback(std::function<void()> callback);
+
+    /// 报告当前阅读位置和方向，后台预读沿该方向提前加载后续块
+    void reportAccess(uint32_t offset, ReadDirection direction);
+
     /// 当前状态
     TextSourceState state() const;
 
-    /// UTF-8 文本总大小（字节）。GBK 转换未完成时返回 0。
+    /// UTF-8 文本总大小（字节）。GBK 长度扫描未完成时返回 0。
     uint32_t totalSize() const;
 
     /// 当前可访问的 UTF-8 字节范围上限
@@ -78,31 +181,87 @@ public:
     /// 原始文件大小（字节）
     uint32_t originalFileSize() const;
 
+    /// 内容版本号。后台校验发现文件不是 UTF-8 并切换到 GBK 转换后递增，
+    /// 此前读取的文本和基于它的 offset 全部失效。
+    uint32_t contentVersion() const;
+
+    /// 按 UTF-8 直接读取原文件时的文本大小（原文件大小减去 BOM）
+    uint32_t rawTextSize() const;
+
+    /// 原始 offset（切换编码前按 UTF-8 直接读取原文件得到的 offset）换算为
+    /// 当前文本中的 offset：GBK 转换时经 text.map 换算，否则原样返回。
+    /// 可能读取一段源文件，只在重新定位时调用。
+    /// @param version 输出换算结果对应的内容版本（可为 nullptr）
+    uint32_t translateRawOffset(uint32_t rawOffset,
+                                uint32_t* version = nullptr) const;
+
+    /// 设置内容切换回调（在后台 task 中调用，应只做通知性工作）
+    void setContentChangedCallback(std::function<void()> callback);
+
+    /// 阻塞等待可用范围达到 minSize：后台长度扫描推进到水位线时唤醒，
+    /// 消费者不必轮询 availableSize()。
+    /// @return true 如果 availableSize() >= minSize 或 totalSize() 已知；
+    ///         超时、关闭、出错、内容切换或 wakeWaiters() 时返回 false
+    bool waitForAvailable(uint32_t minSize, uint32_t timeoutMs);
+
+    /// 唤醒所有 waitForAvailable() 的等待者（消费者停止时调用）
+    void wakeWaiters();
+
 private:
+    // 状态字段为原子变量，查询不加锁；mutex_ 串行化打开、关闭和
+    // 切换编码等多字段变更（contentVersion_ 最后递增）
     mutable std::mutex mutex_;
-    TextSourceState state_ = TextSourceState::Closed;
+    std::atomic<TextSourceState> state_{TextSourceState::Closed};
 
     // 文件信息
     char filePath_[256] = {};
     char cacheDirPath_[256] = {};
-    uint32_t originalFileSize_ = 0;
-    int detectedEncoding_ = 0;  // text_encoding_t
+    std::atomic<uint32_t> originalFileSize_{0};
+    uint32_t originalMtime_ = 0;  // 原始文件修改时间（校验结果的有效性键）
+    std::atomic<int> detectedEncoding_{0};  // text_encoding_t
+    uint32_t rawSkip_ = 0;  // 按 UTF-8 读取原文件时跳过的 BOM 字节数
 
-    // 文本访问
-    TextWindow* window_ = nullptr;
+    // 文本访问（首次 open 时创建，析构时释放；close 只释放其内存）
+    BlockCache* cache_ = nullptr;
+    ReadAhead* readAhead_ = nullptr;
+    std::atomic<ReadDirection> lastDirection_{ReadDirection::Forward};
+    std::function<void()> readReadyCallback_;  // mutex_ 保护
 
     // GBK 转换
-    EncodingConverter* converter_ = nullptr;
+    std::atomic<EncodingConverter*> converter_{nullptr};
+
+    // 整文件 UTF-8 校验
+    Utf8Validator* validator_ = nullptr;
+    std::atomic<uint32_t> contentVersion_{0};
+    std::function<void()> contentChangedCallback_;
 
     // UTF-8 文件路径（原始 UTF-8 文件或缓存的 text.utf8）
     char utf8FilePath_[256] = {};
-    uint32_t totalSize_ = 0;       // UTF-8 总大小
-    uint32_t availableSize_ = 0;   // 当前可用大小
+    std::atomic<uint32_t> totalSize_{0};      // UTF-8 总大小
+    std::atomic<uint32_t> availableSize_{0};  // 当前可用大小
 
-    // 首块内存缓冲区（GBK 转换首 128KB 用于立即显示）
-    char* firstChunkBuf_ = nullptr;
-    uint32_t firstChunkSize_ = 0;
-    bool usingFirstChunk_ = true;  // 是否仍从首块内存读取
+    // 可用范围等待（mutex_ 保护）：只在达到等待者的水位线时通知
+    std::condition_variable availCv_;
+    uint32_t watermark_ = UINT32_MAX;  ///< 等待者要求的最小可用大小
+    uint32_t wakeGen_ = 0;             ///< wakeWaiters() 计数
+
+    /// 可用范围或状态变化后唤醒等待者（持有 mutex_ 调用）
+    void notifyWaitersLocked(bool force);
+
+    /// 检查 offset 是否可读（不加锁）
+    bool readable(uint32_t offset) const;
+
+    /// 游标读取：释放 cursor 原有 pin 后读取并 pin 住新块
+    TextSpan readPinned(uint32_t offset, TextCursor* cursor);
+
+    /// 游标非阻塞读取
+    ReadStatus tryReadPinned(uint32_t offset, TextSpan* out, TextCursor* cursor);
+
+    /// 释放游标的 pin
+    void unpin(TextCursor* cursor);
+
+    /// 预读 task 载入 tryRead() 未命中的块后调用
+    static void onReadAheadLoaded(void* ctx);
 
     /// 检测编码并初始化
     bool initEncoding();
@@ -110,19 +269,36 @@ private:
     /// 初始化 UTF-8 文件（直接使用原文件）
     bool initUtf8();
 
-    /// 初始化 GBK 文件（首块转换 + 后台 task）
+    /// 初始化 GBK 文件（首段转换 + 后台扫描/转换 task）
     bool initGbk();
 
+    /// 按 Kconfig 预算创建块缓存
+    bool createCache();
+
     /// 检查缓存是否有效
     bool checkCache();
 
+    /// 后台启动整文件 UTF-8 校验（文件超出探测范围时）
+    void startValidation(uint32_t skipBytes);
+
+    /// 校验完成回调（由 Utf8Validator 的后台 task 调用）
+    void onValidationComplete(bool valid, uint32_t firstInvalid);
+
+    /// 校验失败：改为 GBK 随机访问转换（在校验 task 中调用）
+    void switchToGbk();
+
     /// 后台转换完成回调（由 EncodingConverter 调用）
     void onConversionComplete(uint32_t utf8Size);
 
+    /// GBK 长度扫描完成回调，此后 totalSize() 可用（由 EncodingConverter 调用）
+    void onSizingComplete(uint32_t utf8Size);
+
     /// 更新可用大小（由 EncodingConverter 的后台 task 调用）
     void updateAvailableSize(uint32_t size);
 
     friend struct ::EncodingConverter;
+    friend struct ::Utf8Validator;
+    friend class TextCursor;
 };
 
 }  // namespace ink
@@ -0,0 +1,379 @@
+/**
+ * @file BlockCache.cpp
+ * @brief BlockCache 实现 — 对齐块 + LRU 淘汰的 PSRAM 文本缓存。
+ */
+
+#include "BlockCache.h"
+
+extern "C" {
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+}
+
+static const char* TAG = "BlockCache";
+
+BlockCache::BlockCache() = default;
+
+BlockCache::~BlockCache() {
+    deinit();
+}
+
+bool BlockCache::init(uint32_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (arena_) return true;
+
+    constexpr uint32_t slotBytes = BLOCK_SIZE + TAIL_GUARD;
+    uint32_t count = budgetBytes / slotBytes;
+    if (count < MIN_BLOCKS) count = MIN_BLOCKS;
+
+    arena_ = static_cast<char*>(
+        heap_caps_malloc(count * slotBytes, MALLOC_CAP_SPIRAM));
+    if (!arena_) {
+        ESP_LOGE(TAG, "Failed to allocate %lu bytes in PSRAM",
+                 (unsigned long)(count * slotBytes));
+        return false;
+    }
+
+    slots_ = new Slot[count];
+    for (uint32_t i = 0; i < count; i++) {
+        slots_[i].data = arena_ + i * slotBytes;
+    }
+    slotCount_ = count;
+    useClock_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+
+    ESP_LOGI(TAG, "Block cache: %lu x %luKB blocks",
+             (unsigned long)count, (unsigned long)(BLOCK_SIZE / 1024));
+    return true;
+}
+
+void BlockCache::deinit() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitForLoads(lock);
+
+    if (arena_) {
+        ESP_LOGI(TAG, "Block cache stats: %lu hits, %lu misses",
+                 (unsigned long)hits_, (unsigned long)misses_);
+        heap_caps_free(arena_);
+        arena_ = nullptr;
+    }
+    delete[] slots_;
+    slots_ = nullptr;
+    slotCount_ = 0;
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+    fileSize_ = 0;
+    fileBaseOffset_ = 0;
+    readFn_ = nullptr;
+    readCtx_ = nullptr;
+}
+
+void BlockCache::setFile(FILE* file, uint32_t fileSize,
+                         uint32_t fileBaseOffset) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // 进行中的加载仍在使用旧文件句柄
+    waitForLoads(lock);
+
+    if (file_ && file_ != file) {
+        fclose(file_);
+    }
+    file_ = file;
+    fileSize_ = fileSize;
+    fileBaseOffset_ = fileBaseOffset;
+    readFn_ = nullptr;
+    readCtx_ = nullptr;
+    // 新文件内容与旧块无关，全部丢弃
+    for (uint32_t i = 0; i < slotCount_; i++) {
+        slots_[i].state = SlotState::Empty;
+        slots_[i].size = 0;
+        slots_[i].pins = 0;
+        slots_[i].gen = ++genClock_;  // 旧 pin 失效
+    }
+}
+
+void BlockCache::setReader(ReadFn fn, void* ctx, uint32_t size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitForLoads(lock);
+
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+    readFn_ = fn;
+    readCtx_ = ctx;
+    fileSize_ = size;
+    fileBaseOffset_ = 0;
+    for (uint32_t i = 0; i < slotCount_; i++) {
+        slots_[i].state = SlotState::Empty;
+        slots_[i].size = 0;
+        slots_[i].pins = 0;
+        slots_[i].gen = ++genClock_;  // 旧 pin 失效
+    }
+}
+
+void BlockCache::growSource(uint32_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 已缓存内容不变，被截短的块在访问时由 extendBlock() 补读
+    if (size > fileSize_) {
+        fileSize_ = size;
+    }
+}
+
+void BlockCache::invalidate() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waitForLoads(lock);
+    for (uint32_t i = 0; i < slotCount_; i++) {
+        slots_[i].state = SlotState::Empty;
+        slots_[i].size = 0;
+        slots_[i].pins = 0;
+        slots_[i].gen = ++genClock_;  // 旧 pin 失效
+    }
+}
+
+ink::TextSpan BlockCache::read(uint32_t offset, Pin* pin, bool promote) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // 先释放旧 pin，使本消费者的上一个块可以被淘汰
+    if (pin) unpinLocked(pin);
+
+    for (;;) {
+        if ((!file_ && !readFn_) || !arena_ || offset >= fileSize_) {
+            return {nullptr, 0};
+        }
+
+        uint32_t block = offset / BLOCK_SIZE;
+        Slot* slot = findSlot(block);
+        if (slot && slot->state == SlotState::Ready) {
+            if (slot->size < wantedSize(block)) {
+                // 数据源已增长，块在旧末尾处被截短
+                extendBlock(slot, lock);
+                continue;
+            }
+            hits_++;
+            return spanFromSlot(slot, offset, pin, promote);
+        }
+        if (slot && slot->state == SlotState::Loading) {
+            // 预读 task 正在加载该块，等待而不是重复读取
+            loaded_.wait(lock);
+            continue;
+        }
+
+        misses_++;
+        slot = loadBlock(block, promote, lock);
+        if (!slot) {
+            return {nullptr, 0};
+        }
+        if (slot->state != SlotState::Ready || slot->block != block) {
+            continue;  // 加载后到重新加锁之间被并发淘汰，重试
+        }
+        return spanFromSlot(slot, offset, pin, promote);
+    }
+}
+
+bool BlockCache::tryRead(uint32_t offset, ink::TextSpan* out, Pin* pin,
+                         bool promote) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    uint32_t block = offset / BLOCK_SIZE;
+    Slot* slot = findSlot(block);
+    if (!slot || slot->state != SlotState::Ready ||
+        slot->size < wantedSize(block)) {
+        return false;
+    }
+    hits_++;
+    if (pin) unpinLocked(pin);
+    *out = spanFromSlot(slot, offset, pin, promote);
+    return true;
+}
+
+void BlockCache::unpin(Pin* pin) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    unpinLocked(pin);
+}
+
+void BlockCache::unpinLocked(Pin* pin) {
+    if (pin->slot >= 0 && slots_ &&
+        static_cast<uint32_t>(pin->slot) < slotCount_) {
+        Slot& s = slots_[pin->slot];
+        if (s.gen == pin->gen && s.pins > 0) {
+            s.pins--;
+        }
+    }
+    pin->slot = -1;
+    pin->gen = 0;
+}
+
+void BlockCache::prefetch(uint32_t block) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if ((!file_ && !readFn_) || !arena_) return;
+    if (block * BLOCK_SIZE >= fileSize_) return;
+
+    Slot* slot = findSlot(block);
+    if (slot) {
+        // 已在加载；或已缓存，仅在被截短时补读
+        if (slot->state == SlotState::Ready &&
+            slot->size < wantedSize(block)) {
+            extendBlock(slot, lock);
+        }
+        return;
+    }
+
+    loadBlock(block, true, lock);
+}
+
+uint32_t BlockCache::sourceSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fileSize_;
+}
+
+BlockCache::Slot* BlockCache::findSlot(uint32_t block) {
+    for (uint32_t i = 0; i < slotCount_; i++) {
+        if (slots_[i].state != SlotState::Empty && slots_[i].block == block) {
+            return &slots_[i];
+        }
+    }
+    return nullptr;
+}
+
+BlockCache::Slot* BlockCache::loadBlock(uint32_t block, bool promote,
+                                        std::unique_lock<std::mutex>& lock) {
+    // 选择空槽位或最久未用的槽位（跳过正在加载和被 pin 的槽位）
+    Slot* victim = nullptr;
+    for (uint32_t i = 0; i < slotCount_; i++) {
+        Slot* s = &slots_[i];
+        if (s->state == SlotState::Loading || s->pins > 0) continue;
+        if (s->state == SlotState::Empty) {
+            victim = s;
+            break;
+        }
+        if (!victim || s->lastUse < victim->lastUse) {
+            victim = s;
+        }
+    }
+    if (!victim) {
+        ESP_LOGW(TAG, "No evictable block (all pinned or loading)");
+        return nullptr;
+    }
+
+    uint32_t start = block * BLOCK_SIZE;
+    uint32_t readSize = wantedSize(block);
+
+    victim->state = SlotState::Loading;
+    victim->block = block;
+    victim->size = 0;
+    victim->gen = ++genClock_;
+    // 顺序扫描加载的块放在 LRU 末端，下一次淘汰优先选中
+    victim->lastUse = promote ? ++useClock_ : 0;
+    loadingCount_++;
+
+    char* dst = victim->data;
+
+    // 文件读取在锁外进行，其他线程可继续访问已缓存的块
+    lock.unlock();
+    uint32_t bytesRead = readSource(dst, start, readSize);
+    lock.lock();
+
+    loadingCount_--;
+    if (bytesRead == 0) {
+        ESP_LOGE(TAG, "Failed to read block %lu", (unsigned long)block);
+        victim->state = SlotState::Empty;
+    } else {
+        victim->size = bytesRead;
+        victim->state = SlotState::Ready;
+        ESP_LOGD(TAG, "Block loaded: [%lu, %lu)",
+                 (unsigned long)start,
+                 (unsigned long)(start + victim->size));
+    }
+    loaded_.notify_all();
+
+    return victim->state == SlotState::Ready ? victim : nullptr;
+}
+
+uint32_t BlockCache::wantedSize(uint32_t block) const {
+    uint32_t start = block * BLOCK_SIZE;
+    if (start >= fileSize_) return 0;
+    uint32_t size = BLOCK_SIZE + TAIL_GUARD;
+    return (fileSize_ - start < size) ? fileSize_ - start : size;
+}
+
+void BlockCache::extendBlock(Slot* slot, std::unique_lock<std::mutex>& lock) {
+    uint32_t have = slot->size;
+    uint32_t want = wantedSize(slot->block);
+    uint32_t start = slot->block * BLOCK_SIZE;
+
+    // 标记 Loading：新读者等待，已持有片段的读者只访问 [0, have)，不受影响
+    slot->state = SlotState::Loading;
+    loadingCount_++;
+    lock.unlock();
+    uint32_t bytesRead = readSource(slot->data + have, start + have, want - have);
+    lock.lock();
+    loadingCount_--;
+
+    slot->size = have + bytesRead;
+    slot->state = SlotState::Ready;
+    if (bytesRead < want - have) {
+        ESP_LOGE(TAG, "Failed to extend block %lu", (unsigned long)slot->block);
+        // 避免反复补读：按实际数据截短数据源视图
+        if (start + slot->size < fileSize_) fileSize_ = start + slot->size;
+    }
+    loaded_.notify_all();
+}
+
+uint32_t BlockCache::readSource(char* dst, uint32_t offset, uint32_t len) {
+    if (readFn_) {
+        return readFn_(readCtx_, dst, offset, len);
+    }
+    std::lock_guard<std::mutex> io(ioMutex_);
+    fseek(file_, fileBaseOffset_ + offset, SEEK_SET);
+    return static_cast<uint32_t>(fread(dst, 1, len, file_));
+}
+
+ink::TextSpan BlockCache::spanFromSlot(Slot* slot, uint32_t offset, Pin* pin,
+                                       bool promote) {
+    if (promote) {
+        slot->lastUse = ++useClock_;
+    }
+    if (pin) {
+        slot->pins++;
+        pin->slot = static_cast<int32_t>(slot - slots_);
+        pin->gen = slot->gen;
+    }
+
+    uint32_t blockStart = slot->block * BLOCK_SIZE;
+    uint32_t pos = offset - blockStart;
+    if (pos >= slot->size) return {nullptr, 0};
+
+    // 文件末尾之前的片段截断到完整字符，避免调用方看到半个多字节序列
+    uint32_t end = slot->size;
+    if (blockStart + end < fileSize_) {
+        end = alignUtf8Backward(slot->data, end);
+    }
+    if (end <= pos) return {nullptr, 0};
+
+    return {slot->data + pos, end - pos};
+}
+
+void BlockCache::waitForLoads(std::unique_lock<std::mutex>& lock) {
+    loaded_.wait(lock, [this] { return loadingCount_ == 0; });
+}
+
+uint32_t BlockCache::alignUtf8Backward(const char* buf, uint32_t size) {
+    // 从末尾向前找到最后一个字符起始字节，检查其序列是否完整
+    uint32_t back = 0;
+    while (back < size && back < 4) {
+        uint8_t b = static_cast<uint8_t>(buf[size - 1 - back]);
+        back++;
+        if ((b & 0xC0) == 0x80) continue;  // continuation byte
+
+        uint32_t need = 1;
+        if ((b & 0xE0) == 0xC0) need = 2;
+        else if ((b & 0xF0) == 0xE0) need = 3;
+        else if ((b & 0xF8) == 0xF0) need = 4;
+        return (back >= need) ? size : size - back;
+    }
+    return size;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file BlockCache.h
+ * @brief PSRAM 块缓存 — 按固定大小对齐的块从文件加载 UTF-8 文本，LRU 淘汰。
+ *
+ * 内部自带锁：块元数据由 mutex 保护，文件读取在锁外进行，因此后台预读
+ * 加载一个块时，其他线程对已缓存块的读取不会被 SD 卡 I/O 阻塞。
+ *
+ * 读取可以 pin 住片段所在的块：被 pin 的块不会被淘汰，供 TextCursor
+ * 在多个消费者之间保持各自的工作集。
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+
+#include "text_source/TextSource.h"
+
+/// PSRAM 块缓存，以 BLOCK_SIZE 对齐的块为单位缓存文件内容
+struct BlockCache {
+    static constexpr uint32_t BLOCK_SIZE = 32 * 1024;       // 32KB 对齐块
+    static constexpr uint32_t TAIL_GUARD = 4 * 1024;        // 每块额外读入的后续字节
+    static constexpr uint32_t MIN_BLOCKS = 4;               // 预算过小时的最少块数
+    static constexpr uint32_t DEFAULT_BUDGET = 512 * 1024;  // 默认内存预算
+
+    /// 数据源读取回调：把 [offset, offset + len) 读入 dst，返回实际读取字节数。
+    /// 在缓存锁外调用，可阻塞（如按需转换）；回调自行负责线程安全。
+    using ReadFn = uint32_t (*)(void* ctx, char* dst, uint32_t offset,
+                                uint32_t len);
+
+    /// 块 pin 句柄。slot 为 -1 表示未 pin；gen 用于识别槽位已被重新加载
+    struct Pin {
+        int32_t slot = -1;
+        uint32_t gen = 0;
+    };
+
+    BlockCache();
+    ~BlockCache();
+
+    // 不可拷贝
+    BlockCache(const BlockCache&) = delete;
+    BlockCache& operator=(const BlockCache&) = delete;
+
+    /// 按内存预算分配 PSRAM 块槽位
+    /// @param budgetBytes 缓存总内存上限（含 TAIL_GUARD），至少容纳 MIN_BLOCKS 块
+    bool init(uint32_t budgetBytes = DEFAULT_BUDGET);
+
+    /// 等待进行中的加载结束，释放全部槽位和文件句柄
+    void deinit();
+
+    /// 设置文件源，丢弃所有已缓存的块
+    /// @param fileBaseOffset 文件中有效内容的起始偏移（如 UTF-8 BOM 需跳过 3 字节）
+    void setFile(FILE* file, uint32_t fileSize, uint32_t fileBaseOffset = 0);
+
+    /// 设置回调数据源（如按需转换的 GBK 缓存），丢弃所有已缓存的块
+    /// @param size 当前可读大小，之后可通过 growSource() 增长
+    void setReader(ReadFn fn, void* ctx, uint32_t size);
+
+    /// 增长数据源大小。此前在旧末尾处被截短的块在下次访问时补读尾部。
+    void growSource(uint32_t size);
+
+    /// 获取 offset 处的文本片段。块未命中时从文件读取一个块（淘汰最久未用的块），
+    /// 块正由其他线程加载时等待其完成。
+    /// 返回的片段止于块末（含 TAIL_GUARD）并截断到完整 UTF-8 字符。
+    /// @param pin 非空时先释放 *pin 原先持有的块，再 pin 住本次片段所在的块
+    /// @param promote false 时不更新 LRU（顺序扫描的块优先被淘汰）
+    ink::TextSpan read(uint32_t offset, Pin* pin = nullptr, bool promote = true);
+
+    /// 非阻塞读取：块已缓存时写入 *out 并返回 true，否则返回 false（不做 I/O）。
+    /// pin / promote 语义同 read()，返回 false 时 *pin 保持不变。
+    bool tryRead(uint32_t offset, ink::TextSpan* out, Pin* pin = nullptr,
+                 bool promote = true);
+
+    /// 释放 pin（槽位已被 deinit 或重新加载时安全忽略）
+    void unpin(Pin* pin);
+
+    /// 预取块：未缓存且未在加载时读入，已缓存时不更新 LRU 时间戳
+    void prefetch(uint32_t block);
+
+    /// 丢弃所有已缓存的块
+    void invalidate();
+
+    /// 获取数据源大小
+    uint32_t sourceSize() const;
+
+    /// 槽位数
+    uint32_t blockCount() const { return slotCount_; }
+
+    /// 命中/未命中计数（调试统计）
+    uint32_t hits() const { return hits_; }
+    uint32_t misses() const { return misses_; }
+
+    /// 截断到完整 UTF-8 字符（向前扫描末尾未完成的多字节序列）
+    static uint32_t alignUtf8Backward(const char* buf, uint32_t size);
+
+private:
+    /// 槽位状态
+    enum class SlotState : uint8_t {
+        Empty,    // 无数据
+        Loading,  // 正在锁外读取文件
+        Ready,    // 数据有效
+    };
+
+    /// 一个缓存槽位
+    struct Slot {
+        char* data = nullptr;     // BLOCK_SIZE + TAIL_GUARD 字节
+        uint32_t block = 0;       // 块序号（offset / BLOCK_SIZE）
+        uint32_t size = 0;        // 有效数据大小
+        uint32_t lastUse = 0;     // LRU 时间戳
+        uint32_t gen = 0;         // 每次重新加载递增，使旧 pin 失效
+        uint16_t pins = 0;        // pin 计数，大于 0 时不可淘汰
+        SlotState state = SlotState::Empty;
+    };
+
+    mutable std::mutex mutex_;        // 保护槽位元数据和数据源
+    std::mutex ioMutex_;              // 串行化 FILE* 的 fseek + fread
+    std::condition_variable loaded_;  // 块加载结束时通知
+
+    Slot* slots_ = nullptr;
+    uint32_t slotCount_ = 0;
+    char* arena_ = nullptr;        // 所有槽位共用的 PSRAM 内存
+    uint32_t useClock_ = 0;        // 单调递增的访问计数
+    uint32_t genClock_ = 0;        // 槽位代数计数，跨 init/deinit 不重置
+    uint32_t loadingCount_ = 0;    // 正在锁外读取的槽位数
+    uint32_t hits_ = 0;
+    uint32_t misses_ = 0;
+
+    // 文件源
+    FILE* file_ = nullptr;
+    uint32_t fileSize_ = 0;        // 数据源有效大小（不含 baseOffset）
+    uint32_t fileBaseOffset_ = 0;  // 文件中有效内容起始偏移
+
+    // 回调源
+    ReadFn readFn_ = nullptr;
+    void* readCtx_ = nullptr;
+
+    /// 查找包含该块的槽位（任意状态），未找到返回 nullptr
+    Slot* findSlot(uint32_t block);
+
+    /// 在锁内选中最久未用的、未 pin 且非加载的槽位并标记为 Loading，
+    /// 随后在锁外读取文件。调用时持有 lock，返回时仍持有 lock。失败返回 nullptr。
+    Slot* loadBlock(uint32_t block, bool promote,
+                    std::unique_lock<std::mutex>& lock);
+
+    /// 块在当前数据源大小下应有的数据量（含 TAIL_GUARD）
+    uint32_t wantedSize(uint32_t block) const;
+
+    /// 补读被截短的块的尾部（数据源增长后）。调用时持有 lock，返回时仍持有。
+    /// 已读部分不变，持有该块片段的其他读者不受影响。
+    void extendBlock(Slot* slot, std::unique_lock<std::mutex>& lock);
+
+    /// 从数据源读取（锁外调用）
+    uint32_t readSource(char* dst, uint32_t offset, uint32_t len);
+
+    /// 在锁内由 Ready 槽位构造片段，按需更新 LRU 和 pin
+    ink::TextSpan spanFromSlot(Slot* slot, uint32_t offset, Pin* pin,
+                               bool promote);
+
+    /// 在锁内释放 pin
+    void unpinLocked(Pin* pin);
+
+    /// 等待全部锁外读取结束（调用时持有 lock）
+    void waitForLoads(std::unique_lock<std::mutex>& lock);
+};
@@ -1,12 +1,14 @@
 /**
  * @file EncodingConverter.cpp
- * @brief EncodingConverter 实现 — GBK -> UTF-8 后台流式转换。
+ * @brief EncodingConverter 实现 — checkpoint 映射 + 按需分段转换。
  */
 
 #include "EncodingConverter.h"
 #include "text_source/TextSource.h"
 
+#include <algorithm>
 #include <cstring>
+#include <unistd.h>
 
 extern "C" {
 #include "esp_log.h"
@@ -23,236 +25,741 @@ EncodingConverter::~EncodingConverter() {
 }
 
 // ════════════════════════════════════════════════════════════════
-//  首块同步转换
+//  打开与关闭
 // ════════════════════════════════════════════════════════════════
 
-bool EncodingConverter::convertFirstChunk(const char* srcPath, char* outBuf,
-                                           uint32_t outCapacity,
-                                           uint32_t* outSize) {
-    FILE* f = fopen(srcPath, "rb");
-    if (!f) {
+bool EncodingConverter::open(const char* srcPath, const char* dstPath,
+                             const char* mapPath, const char* journalPath,
+                             uint32_t srcFileSize, ink::TextSource* owner) {
+    strncpy(srcPath_, srcPath, sizeof(srcPath_) - 1);
+    strncpy(journalPath_, journalPath, sizeof(journalPath_) - 1);
+    srcFileSize_ = srcFileSize;
+    owner_ = owner;
+    complete_ = false;
+
+    srcFile_ = fopen(srcPath, "rb");
+    if (!srcFile_) {
         ESP_LOGE(TAG, "Failed to open source: %s", srcPath);
         return false;
     }
 
-    // 读取首块 GBK 数据
-    uint32_t readSize = FIRST_CHUNK_SRC_SIZE;
-    char* srcBuf = static_cast<char*>(
-        heap_caps_malloc(readSize, MALLOC_CAP_SPIRAM));
-    if (!srcBuf) {
-        fclose(f);
-        ESP_LOGE(TAG, "Failed to allocate src buffer for first chunk");
+    srcBuf_ = static_cast<char*>(
+        heap_caps_malloc(CHUNK_SRC_SIZE, MALLOC_CAP_SPIRAM));
+    dstBuf_ = static_cast<char*>(
+        heap_caps_malloc(CHUNK_DST_CAP, MALLOC_CAP_SPIRAM));
+    writeBuf_ = static_cast<char*>(
+        heap_caps_malloc(WRITE_ALIGN, MALLOC_CAP_SPIRAM));
+    if (!srcBuf_ || !dstBuf_ || !writeBuf_) {
+        ESP_LOGE(TAG, "Failed to allocate conversion buffers");
+        stop();
         return false;
     }
 
-    size_t bytesRead = fread(srcBuf, 1, readSize, f);
-    fclose(f);
-
-    if (bytesRead == 0) {
-        heap_caps_free(srcBuf);
+    if (!loadMap(mapPath)) {
+        stop();
         return false;
     }
 
-    // 回退到 GBK 双字节字符边界（避免截断）
-    uint32_t safeLen = static_cast<uint32_t>(bytesRead);
-    if (safeLen > 0) {
-        // GBK 首字节 0x81-0xFE，次字节 0x40-0x7E/0x80-0xFE（次字节与首字节范围重叠）。
-        // 从末尾向前数连续 >=0x81 的字节：奇数个 = 末尾有孤立首字节需截掉。
-        int highCount = 0;
-        for (int i = static_cast<int>(safeLen) - 1;
-             i >= 0 && static_cast<uint8_t>(srcBuf[i]) >= 0x81; i--) {
-            highCount++;
+    // 日志有效则在原 text.utf8 上续转，否则重新开始
+    if (loadJournal()) {
+        dstFile_ = fopen(dstPath, "r+b");
+        if (!dstFile_) {
+            ESP_LOGW(TAG, "Journal without output file, restarting");
+            std::lock_guard<std::mutex> lock(mapMutex_);
+            converted_.assign(chunks_.size(), 0);
+            convertedCount_ = 0;
+            convertedSrc_ = 0;
         }
-        if (highCount % 2 == 1) {
-            safeLen--;
+    }
+    if (!dstFile_) {
+        // 各段按映射偏移随机写入
+        dstFile_ = fopen(dstPath, "w+b");
+        if (!dstFile_ || !resetJournal()) {
+            ESP_LOGE(TAG, "Failed to create output: %s", dstPath);
+            stop();
+            return false;
         }
     }
+    // 首次打开：同步扫描首段，使文本开头立即可读
+    if (chunks_.empty() && !sizeNextChunk(srcFile_, srcBuf_)) {
+        ESP_LOGE(TAG, "Failed to size first chunk");
+        stop();
+        return false;
+    }
 
-    // 转换 GBK -> UTF-8
-    size_t dstLen = outCapacity;
-    esp_err_t err = text_encoding_gbk_to_utf8(srcBuf, safeLen, outBuf, &dstLen);
-    heap_caps_free(srcBuf);
-
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "First chunk conversion failed: %d", (int)err);
+    bool converted;
+    {
+        std::lock_guard<std::mutex> conv(convertMutex_);
+        converted = converted_[0] || convertChunk(0);
+    }
+    if (!converted) {
+        stop();
         return false;
     }
 
-    *outSize = static_cast<uint32_t>(dstLen);
-    ESP_LOGI(TAG, "First chunk: %lu GBK -> %lu UTF-8 bytes",
-             (unsigned long)safeLen, (unsigned long)dstLen);
+    ESP_LOGI(TAG, "Opened: %u chunks mapped (%s), %lu bytes UTF-8 addressable",
+             (unsigned)chunks_.size(), sized_ ? "complete" : "partial",
+             (unsigned long)sizedUtf8());
     return true;
 }
 
-// ════════════════════════════════════════════════════════════════
-//  后台转换
-// ════════════════════════════════════════════════════════════════
-
-bool EncodingConverter::startBackgroundConversion(const char* srcPath,
-                                                   const char* dstPath,
-                                                   uint32_t srcFileSize,
-                                                   ink::TextSource* owner) {
-    strncpy(srcPath_, srcPath, sizeof(srcPath_) - 1);
-    strncpy(dstPath_, dstPath, sizeof(dstPath_) - 1);
-    srcFileSize_ = srcFileSize;
-    owner_ = owner;
-    stopRequested_ = false;
-    complete_ = false;
-
+bool EncodingConverter::startBackground() {
+    taskExited_ = false;
+    if (!isSized()) sizeJob_.start();
+    job_.start();
     BaseType_t ret = xTaskCreatePinnedToCore(
         taskFunc, "enc_conv", 8192, this,
         tskIDLE_PRIORITY + 2, &taskHandle_, 1);
 
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create conversion task");
+        taskHandle_ = nullptr;
+        sizeJob_.finish();
+        job_.finish();
         return false;
     }
 
-    ESP_LOGI(TAG, "Background conversion started: %s -> %s", srcPath, dstPath);
+    ESP_LOGI(TAG, "Background conversion started: %s", srcPath_);
     return true;
 }
 
 void EncodingConverter::stop() {
-    if (!taskHandle_) return;
+    if (taskHandle_) {
+        sizeJob_.cancel();
+        job_.cancel();
 
-    stopRequested_ = true;
+        // 等待 task 退出（最多 10 秒）
+        for (int i = 0; i < 100 && !taskExited_; i++) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+
+        if (!taskExited_) {
+            // task 未能正常退出，强制删除
+            ESP_LOGW(TAG, "Conversion task did not exit cleanly, forcing delete");
+            vTaskDelete(taskHandle_);
+            sizeJob_.finish();
+            job_.finish();
+        }
+        taskHandle_ = nullptr;
+    }
+    job_.cancel();
+
+    std::lock_guard<std::mutex> conv(convertMutex_);
+    // 写出暂存并提交剩余的已转换段，下次打开从这里继续
+    flushOutput();
+    commitJournal();
+    if (journalFile_) {
+        fclose(journalFile_);
+        journalFile_ = nullptr;
+    }
+    if (mapFile_) {
+        fclose(mapFile_);
+        mapFile_ = nullptr;
+    }
+    if (srcFile_) {
+        fclose(srcFile_);
+        srcFile_ = nullptr;
+    }
+    if (dstFile_) {
+        fclose(dstFile_);
+        dstFile_ = nullptr;
+    }
+    if (srcBuf_) {
+        heap_caps_free(srcBuf_);
+        srcBuf_ = nullptr;
+    }
+    if (dstBuf_) {
+        heap_caps_free(dstBuf_);
+        dstBuf_ = nullptr;
+    }
+    if (writeBuf_) {
+        heap_caps_free(writeBuf_);
+        writeBuf_ = nullptr;
+    }
+    writeLen_ = 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  checkpoint 映射
+// ════════════════════════════════════════════════════════════════
 
-    // 等待 task 退出（最多 10 秒）
-    for (int i = 0; i < 100 && !complete_; i++) {
-        vTaskDelay(pdMS_TO_TICKS(100));
+bool EncodingConverter::loadMap(const char* mapPath) {
+    FILE* f = fopen(mapPath, "r+b");
+    if (f) {
+        MapHeader header;
+        bool valid = fread(&header, sizeof(header), 1, f) == 1 &&
+                     memcmp(header.magic, "GMAP", 4) == 0 &&
+                     header.version == MAP_VERSION &&
+                     header.srcSize == srcFileSize_ &&
+                     header.chunkSize == CHUNK_SRC_SIZE;
+
+        // 逐条读取记录，遇到截断或不单调的记录即停止（写入中途断电）
+        Checkpoint prev = {0, 0};
+        Checkpoint cp;
+        while (valid && fread(&cp, sizeof(cp), 1, f) == 1) {
+            if (cp.srcEnd <= prev.srcEnd || cp.srcEnd > srcFileSize_ ||
+                cp.srcEnd - prev.srcEnd > CHUNK_SRC_SIZE ||
+                cp.utf8End <= prev.utf8End) {
+                break;
+            }
+            chunks_.push_back(cp);
+            prev = cp;
+        }
+
+        if (valid) {
+            // 截掉无效尾部，后续记录从此处追加
+            long end = static_cast<long>(sizeof(MapHeader) +
+                                         chunks_.size() * sizeof(Checkpoint));
+            fseek(f, end, SEEK_SET);
+            converted_.assign(chunks_.size(), 0);
+            sized_ = !chunks_.empty() && prev.srcEnd >= srcFileSize_;
+            mapFile_ = f;
+            ESP_LOGI(TAG, "Checkpoint map loaded: %u chunks",
+                     (unsigned)chunks_.size());
+            return true;
+        }
+
+        fclose(f);
+        chunks_.clear();
+        ESP_LOGW(TAG, "Checkpoint map invalid, rebuilding: %s", mapPath);
     }
 
-    if (!complete_) {
-        // task 未能正常退出，强制删除
-        ESP_LOGW(TAG, "Conversion task did not exit cleanly, forcing delete");
-        vTaskDelete(taskHandle_);
+    mapFile_ = fopen(mapPath, "w+b");
+    if (!mapFile_) {
+        ESP_LOGE(TAG, "Failed to create checkpoint map: %s", mapPath);
+        return false;
     }
-    taskHandle_ = nullptr;
+    MapHeader header;
+    memcpy(header.magic, "GMAP", 4);
+    header.version = MAP_VERSION;
+    header.srcSize = srcFileSize_;
+    header.chunkSize = CHUNK_SRC_SIZE;
+    fwrite(&header, sizeof(header), 1, mapFile_);
+    return true;
 }
 
-void EncodingConverter::taskFunc(void* param) {
-    auto* self = static_cast<EncodingConverter*>(param);
-    self->doConversion();
-    self->taskHandle_ = nullptr;
-    vTaskDelete(nullptr);
+// ════════════════════════════════════════════════════════════════
+//  转换日志
+// ════════════════════════════════════════════════════════════════
+
+bool EncodingConverter::loadJournal() {
+    FILE* f = fopen(journalPath_, "r+b");
+    if (!f) return false;
+
+    JournalHeader header;
+    bool valid = fread(&header, sizeof(header), 1, f) == 1 &&
+                 memcmp(header.magic, "GJNL", 4) == 0 &&
+                 header.version == JOURNAL_VERSION &&
+                 header.srcSize == srcFileSize_ &&
+                 header.chunkSize == CHUNK_SRC_SIZE;
+    if (!valid) {
+        fclose(f);
+        ESP_LOGW(TAG, "Journal invalid, restarting conversion");
+        return false;
+    }
+
+    // 日志只会引用已写入映射的段；超出映射的记录说明映射已重建，整体丢弃
+    uint32_t records = 0;
+    uint32_t idx;
+    std::lock_guard<std::mutex> lock(mapMutex_);
+    while (fread(&idx, sizeof(idx), 1, f) == 1) {
+        if (idx >= chunks_.size()) {
+            fclose(f);
+            converted_.assign(chunks_.size(), 0);
+            convertedCount_ = 0;
+            convertedSrc_ = 0;
+            ESP_LOGW(TAG, "Journal does not match checkpoint map, restarting");
+            return false;
+        }
+        records++;
+        if (converted_[idx]) continue;
+        uint32_t srcStart = idx > 0 ? chunks_[idx - 1].srcEnd : 0;
+        converted_[idx] = 1;
+        convertedCount_++;
+        convertedSrc_ += chunks_[idx].srcEnd - srcStart;
+    }
+
+    // 截断的尾部记录被覆盖
+    fseek(f, static_cast<long>(sizeof(JournalHeader) + records * sizeof(uint32_t)),
+          SEEK_SET);
+    journalFile_ = f;
+    ESP_LOGI(TAG, "Journal loaded: %lu/%u chunks already converted",
+             (unsigned long)convertedCount_, (unsigned)chunks_.size());
+    return true;
 }
 
-void EncodingConverter::doConversion() {
-    FILE* srcFile = fopen(srcPath_, "rb");
-    if (!srcFile) {
-        ESP_LOGE(TAG, "BG: Failed to open source: %s", srcPath_);
-        complete_ = true;
-        return;
+bool EncodingConverter::resetJournal() {
+    if (journalFile_) {
+        fclose(journalFile_);
     }
+    journalFile_ = fopen(journalPath_, "w+b");
+    if (!journalFile_) {
+        ESP_LOGE(TAG, "Failed to create journal: %s", journalPath_);
+        return false;
+    }
+    JournalHeader header;
+    memcpy(header.magic, "GJNL", 4);
+    header.version = JOURNAL_VERSION;
+    header.srcSize = srcFileSize_;
+    header.chunkSize = CHUNK_SRC_SIZE;
+    fwrite(&header, sizeof(header), 1, journalFile_);
+    fflush(journalFile_);
+    return true;
+}
 
-    FILE* dstFile = fopen(dstPath_, "wb");
-    if (!dstFile) {
-        ESP_LOGE(TAG, "BG: Failed to create output: %s", dstPath_);
-        fclose(srcFile);
-        complete_ = true;
-        return;
+void EncodingConverter::commitJournal() {
+    if (uncommitted_.empty() || !journalFile_ || !dstFile_) return;
+
+    // 先让段数据落盘，再记录其序号：日志中的段一定完整
+    if (!flushOutput()) return;
+    fflush(dstFile_);
+    fsync(fileno(dstFile_));
+    fwrite(uncommitted_.data(), sizeof(uint32_t), uncommitted_.size(),
+           journalFile_);
+    fflush(journalFile_);
+    fsync(fileno(journalFile_));
+    uncommitted_.clear();
+}
+
+bool EncodingConverter::sizeNextChunk(FILE* f, char* buf) {
+    uint32_t srcStart;
+    uint32_t utf8Start;
+    {
+        std::lock_guard<std::mutex> lock(mapMutex_);
+        if (sized_) return false;
+        srcStart = chunks_.empty() ? 0 : chunks_.back().srcEnd;
+        utf8Start = chunks_.empty() ? 0 : chunks_.back().utf8End;
     }
 
-    // 分配转换缓冲区（GBK 输入 + UTF-8 输出）
-    char* srcBuf = static_cast<char*>(
-        heap_caps_malloc(CONVERT_BLOCK_SIZE, MALLOC_CAP_SPIRAM));
-    // UTF-8 最坏情况：每个 GBK 字节 → 3 字节 UTF-8
-    uint32_t dstBufSize = CONVERT_BLOCK_SIZE * 3 / 2 + 16;
-    char* dstBuf = static_cast<char*>(
-        heap_caps_malloc(dstBufSize, MALLOC_CAP_SPIRAM));
-
-    if (!srcBuf || !dstBuf) {
-        ESP_LOGE(TAG, "BG: Failed to allocate conversion buffers");
-        if (srcBuf) heap_caps_free(srcBuf);
-        if (dstBuf) heap_caps_free(dstBuf);
-        fclose(srcFile);
-        fclose(dstFile);
-        complete_ = true;
-        return;
+    // 顺序扫描时流已在段起点：fseek 会丢弃 stdio 缓冲中多读的部分
+    if (ftell(f) != static_cast<long>(srcStart)) fseek(f, srcStart, SEEK_SET);
+    size_t bytesRead = fread(buf, 1, CHUNK_SRC_SIZE, f);
+    if (bytesRead == 0) {
+        ESP_LOGE(TAG, "Sizing read failed at %lu", (unsigned long)srcStart);
+        return false;
     }
 
-    uint32_t totalWritten = 0;
-    char pendingByte = 0;
-    bool hasPending = false;
+    // 段末尾被截断的双字节首字节留给下一段，段边界总在完整字符处
+    bool final = srcStart + bytesRead >= srcFileSize_;
+    size_t used = 0;
+    size_t utf8Len = text_encoding_gbk_utf8_len(buf, bytesRead, final, &used);
+    if (used == 0) return false;
+
+    Checkpoint cp = {srcStart + static_cast<uint32_t>(used),
+                     utf8Start + static_cast<uint32_t>(utf8Len)};
+    {
+        std::lock_guard<std::mutex> lock(mapMutex_);
+        chunks_.push_back(cp);
+        converted_.push_back(0);
+        sized_ = cp.srcEnd >= srcFileSize_;
+    }
 
-    while (!stopRequested_) {
-        // 如果上一块有未完成的 GBK 双字节首字节，先放到缓冲区开头
-        uint32_t prefixLen = 0;
-        if (hasPending) {
-            srcBuf[0] = pendingByte;
-            prefixLen = 1;
-            hasPending = false;
+    if (mapFile_) {
+        fwrite(&cp, sizeof(cp), 1, mapFile_);
+        if (++unflushedChunks_ >= MAP_FLUSH_CHUNKS || sized_) {
+            fflush(mapFile_);
+            unflushedChunks_ = 0;
         }
+    }
+    return true;
+}
 
-        size_t bytesRead = fread(srcBuf + prefixLen, 1,
-                                  CONVERT_BLOCK_SIZE - prefixLen, srcFile);
-        if (bytesRead == 0 && prefixLen == 0) break;
+void EncodingConverter::chunkRange(uint32_t idx, uint32_t* srcStart,
+                                   uint32_t* srcEnd, uint32_t* utf8Start,
+                                   uint32_t* utf8End) const {
+    *srcStart = idx > 0 ? chunks_[idx - 1].srcEnd : 0;
+    *utf8Start = idx > 0 ? chunks_[idx - 1].utf8End : 0;
+    *srcEnd = chunks_[idx].srcEnd;
+    *utf8End = chunks_[idx].utf8End;
+}
 
-        uint32_t blockLen = static_cast<uint32_t>(bytesRead) + prefixLen;
+int32_t EncodingConverter::findChunk(uint32_t utf8Offset) const {
+    // 第一个 utf8End > offset 的段
+    auto it = std::upper_bound(
+        chunks_.begin(), chunks_.end(), utf8Offset,
+        [](uint32_t off, const Checkpoint& cp) { return off < cp.utf8End; });
+    if (it == chunks_.end()) return -1;
+    return static_cast<int32_t>(it - chunks_.begin());
+}
 
-        // 检查末尾是否截断 GBK 双字节字符
-        // GBK 次字节范围 0x80-0xFE 与首字节 0x81-0xFE 重叠，不能只看末字节。
-        // 从末尾向前数连续 >=0x81 的字节：奇数个 = 末尾有孤立首字节。
-        if (blockLen > 0) {
-            int highCount = 0;
-            for (int i = static_cast<int>(blockLen) - 1;
-                 i >= 0 && static_cast<uint8_t>(srcBuf[i]) >= 0x81; i--) {
-                highCount++;
-            }
-            if (highCount % 2 == 1) {
-                pendingByte = srcBuf[blockLen - 1];
-                hasPending = true;
-                blockLen--;
+uint32_t EncodingConverter::sizedUtf8() const {
+    std::lock_guard<std::mutex> lock(mapMutex_);
+    return chunks_.empty() ? 0 : chunks_.back().utf8End;
+}
+
+bool EncodingConverter::isSized() const {
+    std::lock_guard<std::mutex> lock(mapMutex_);
+    return sized_;
+}
+
+uint32_t EncodingConverter::utf8OffsetOf(const char* srcPath,
+                                         const char* mapPath,
+                                         uint32_t srcFileSize,
+                                         uint32_t srcOffset) {
+    if (srcOffset > srcFileSize) srcOffset = srcFileSize;
+
+    // 不超过 srcOffset 的最后一个 checkpoint 作为起点（记录校验同 loadMap）
+    uint32_t srcPos = 0;
+    uint32_t utf8Pos = 0;
+    FILE* f = fopen(mapPath, "rb");
+    if (f) {
+        MapHeader header;
+        if (fread(&header, sizeof(header), 1, f) == 1 &&
+            memcmp(header.magic, "GMAP", 4) == 0 &&
+            header.version == MAP_VERSION &&
+            header.srcSize == srcFileSize &&
+            header.chunkSize == CHUNK_SRC_SIZE) {
+            Checkpoint cp;
+            while (fread(&cp, sizeof(cp), 1, f) == 1) {
+                if (cp.srcEnd <= srcPos || cp.srcEnd > srcOffset ||
+                    cp.srcEnd - srcPos > CHUNK_SRC_SIZE ||
+                    cp.utf8End <= utf8Pos) {
+                    break;
+                }
+                srcPos = cp.srcEnd;
+                utf8Pos = cp.utf8End;
             }
         }
+        fclose(f);
+    }
+    if (srcPos >= srcOffset) return utf8Pos;
+
+    // 其余部分按 GBK 计算长度；落在双字节字符中间时停在该字符起点
+    f = fopen(srcPath, "rb");
+    if (!f) return utf8Pos;
+    char* buf = static_cast<char*>(
+        heap_caps_malloc(CHUNK_SRC_SIZE, MALLOC_CAP_SPIRAM));
+    if (!buf) {
+        fclose(f);
+        return utf8Pos;
+    }
+    fseek(f, srcPos, SEEK_SET);
+    while (srcPos < srcOffset) {
+        uint32_t want = std::min(srcOffset - srcPos, CHUNK_SRC_SIZE);
+        size_t bytesRead = fread(buf, 1, want, f);
+        if (bytesRead == 0) break;
+        size_t used = 0;
+        utf8Pos += static_cast<uint32_t>(
+            text_encoding_gbk_utf8_len(buf, bytesRead, false, &used));
+        if (used == 0) break;
+        srcPos += static_cast<uint32_t>(used);
+        if (used < bytesRead) fseek(f, srcPos, SEEK_SET);
+    }
+    heap_caps_free(buf);
+    fclose(f);
+    return utf8Pos;
+}
+
+float EncodingConverter::progress() const {
+    if (srcFileSize_ == 0) return 0.0f;
+    return static_cast<float>(convertedSrc_.load(std::memory_order_relaxed)) /
+           static_cast<float>(srcFileSize_);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  按需转换
+// ════════════════════════════════════════════════════════════════
+
+uint32_t EncodingConverter::read(char* dst, uint32_t offset, uint32_t len) {
+    if (!ensureRange(offset, offset + len)) return 0;
+
+    std::lock_guard<std::mutex> conv(convertMutex_);
+    if (!dstFile_) return 0;
+    // 请求范围落在暂存中时先写出，其余情况不打断簇合并
+    if (writeLen_ > 0 && offset < writeStart_ + writeLen_ &&
+        offset + len > writeStart_ && !flushOutput()) {
+        return 0;
+    }
+    fseek(dstFile_, offset, SEEK_SET);
+    return static_cast<uint32_t>(fread(dst, 1, len, dstFile_));
+}
+
+uint32_t EncodingConverter::readThunk(void* ctx, char* dst, uint32_t offset,
+                                      uint32_t len) {
+    return static_cast<EncodingConverter*>(ctx)->read(dst, offset, len);
+}
 
-        if (blockLen == 0) continue;
+void EncodingConverter::prioritize(uint32_t utf8Offset) {
+    std::lock_guard<std::mutex> lock(mapMutex_);
+    int32_t idx = findChunk(utf8Offset);
+    if (idx >= 0) hintChunk_ = idx;
+}
 
-        // 转换这一块
-        size_t outLen = dstBufSize;
-        esp_err_t err = text_encoding_gbk_to_utf8(srcBuf, blockLen,
-                                                    dstBuf, &outLen);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "BG: Conversion error at offset ~%lu",
-                     (unsigned long)totalWritten);
-            break;
+bool EncodingConverter::ensureRange(uint32_t start, uint32_t end) {
+    for (;;) {
+        if (job_.cancelled()) return false;
+
+        int32_t pending = -1;
+        {
+            std::lock_guard<std::mutex> lock(mapMutex_);
+            if (sized_ && convertedCount_ == chunks_.size()) return true;
+
+            int32_t idx = findChunk(start);
+            if (idx < 0) return false;  // 尚未扫描到
+            for (uint32_t i = idx; i < chunks_.size(); i++) {
+                uint32_t chunkStart = i > 0 ? chunks_[i - 1].utf8End : 0;
+                if (chunkStart >= end) break;
+                if (!converted_[i]) {
+                    pending = static_cast<int32_t>(i);
+                    break;
+                }
+            }
+            if (pending < 0) {
+                return end <= (chunks_.empty() ? 0 : chunks_.back().utf8End);
+            }
         }
 
-        // 写入输出文件
-        size_t written = fwrite(dstBuf, 1, outLen, dstFile);
-        if (written != outLen) {
-            ESP_LOGE(TAG, "BG: Write error");
-            break;
+        // 读者优先：后台 task 看到等待者时暂停领取新段
+        priorityWaiters_++;
+        std::lock_guard<std::mutex> conv(convertMutex_);
+        priorityWaiters_--;
+
+        bool done;
+        {
+            std::lock_guard<std::mutex> lock(mapMutex_);
+            done = converted_[pending] != 0;
+        }
+        if (!done && !convertChunk(static_cast<uint32_t>(pending))) {
+            return false;
         }
+    }
+}
+
+bool EncodingConverter::convertChunk(uint32_t idx) {
+    if (!srcFile_ || !dstFile_) return false;
+
+    uint32_t srcStart, srcEnd, utf8Start, utf8End;
+    {
+        std::lock_guard<std::mutex> lock(mapMutex_);
+        if (idx >= chunks_.size()) return false;
+        if (converted_[idx]) return true;
+        chunkRange(idx, &srcStart, &srcEnd, &utf8Start, &utf8End);
+    }
 
-        totalWritten += static_cast<uint32_t>(written);
+    uint32_t srcLen = srcEnd - srcStart;
+    if (ftell(srcFile_) != static_cast<long>(srcStart)) {
+        fseek(srcFile_, srcStart, SEEK_SET);
+    }
+    if (fread(srcBuf_, 1, srcLen, srcFile_) != srcLen) {
+        ESP_LOGE(TAG, "Chunk %u: source read failed", (unsigned)idx);
+        return false;
+    }
+
+    // 段起点总在完整字符处，单独转换的结果与整体顺序转换一致
+    size_t outLen = CHUNK_DST_CAP;
+    text_encoding_gbk_to_utf8(srcBuf_, srcLen, dstBuf_, &outLen);
+    if (outLen != utf8End - utf8Start) {
+        ESP_LOGE(TAG, "Chunk %u: size mismatch (%lu, mapped %lu)",
+                 (unsigned)idx, (unsigned long)outLen,
+                 (unsigned long)(utf8End - utf8Start));
+        return false;
+    }
+
+    if (!writeOutput(utf8Start, dstBuf_, outLen)) {
+        ESP_LOGE(TAG, "Chunk %u: write failed", (unsigned)idx);
+        return false;
+    }
+
+    markConverted(idx, srcLen);
+    return true;
+}
+
+void EncodingConverter::markConverted(uint32_t idx, uint32_t srcLen) {
+    {
+        std::lock_guard<std::mutex> lock(mapMutex_);
+        if (converted_[idx]) return;
+        converted_[idx] = 1;
+        convertedCount_++;
+        convertedSrc_ += srcLen;
+    }
+
+    uncommitted_.push_back(idx);
+    if (uncommitted_.size() >= JOURNAL_COMMIT_CHUNKS) {
+        commitJournal();
+    }
+}
 
-        // 更新 TextSource 的可用大小
-        if (owner_) {
-            owner_->updateAvailableSize(totalWritten);
+// ════════════════════════════════════════════════════════════════
+//  对齐写入
+// ════════════════════════════════════════════════════════════════
+
+bool EncodingConverter::writeOutput(uint32_t offset, const char* data,
+                                    uint32_t len) {
+    if (!dstFile_) return false;
+
+    // 与暂存不相邻：先写出暂存
+    if (writeLen_ > 0 && offset != writeStart_ + writeLen_ && !flushOutput()) {
+        return false;
+    }
+    if (writeLen_ == 0) writeStart_ = offset;
+
+    while (len > 0) {
+        uint32_t end = writeStart_ + writeLen_;
+        if (writeLen_ == 0 && end % WRITE_ALIGN == 0 && len >= WRITE_ALIGN) {
+            // 对齐的整簇直接写出，不经暂存
+            uint32_t n = len - len % WRITE_ALIGN;
+            fseek(dstFile_, end, SEEK_SET);
+            if (fwrite(data, 1, n, dstFile_) != n) return false;
+            writeStart_ = end + n;
+            data += n;
+            len -= n;
+            continue;
         }
 
-        // 让出 CPU，确保 IDLE task 能喂看门狗
-        vTaskDelay(1);
+        // 暂存到下一个簇边界，凑满即写出
+        uint32_t n = std::min(WRITE_ALIGN - end % WRITE_ALIGN, len);
+        memcpy(writeBuf_ + writeLen_, data, n);
+        writeLen_ += n;
+        data += n;
+        len -= n;
+        if ((writeStart_ + writeLen_) % WRITE_ALIGN == 0 && !flushOutput()) {
+            return false;
+        }
     }
+    return true;
+}
 
-    if (!stopRequested_) {
-        // 写入完成标记 "DONE"
-        fwrite("DONE", 1, 4, dstFile);
-        fflush(dstFile);
+bool EncodingConverter::flushOutput() {
+    if (writeLen_ == 0) return true;
+    if (!dstFile_) return false;
 
-        ESP_LOGI(TAG, "BG: Conversion complete: %lu bytes UTF-8",
-                 (unsigned long)totalWritten);
+    fseek(dstFile_, writeStart_, SEEK_SET);
+    bool ok = fwrite(writeBuf_, 1, writeLen_, dstFile_) == writeLen_;
+    writeStart_ += writeLen_;
+    writeLen_ = 0;
+    if (!ok) {
+        ESP_LOGE(TAG, "Output write failed at %lu", (unsigned long)writeStart_);
     }
+    return ok;
+}
 
-    heap_caps_free(srcBuf);
-    heap_caps_free(dstBuf);
-    fclose(srcFile);
-    fclose(dstFile);
+// ════════════════════════════════════════════════════════════════
+//  后台 task
+// ════════════════════════════════════════════════════════════════
+
+int32_t EncodingConverter::nextChunk() {
+    std::lock_guard<std::mutex> lock(mapMutex_);
+
+    // 最近访问位置之后的几段优先
+    if (hintChunk_ >= 0) {
+        uint32_t end = std::min<uint32_t>(hintChunk_ + PRIORITY_CHUNKS,
+                                          chunks_.size());
+        for (uint32_t i = hintChunk_; i < end; i++) {
+            if (!converted_[i]) return static_cast<int32_t>(i);
+        }
+    }
 
-    if (!stopRequested_ && owner_) {
-        owner_->onConversionComplete(totalWritten);
+    while (seqNext_ < chunks_.size() && converted_[seqNext_]) {
+        seqNext_++;
     }
+    return seqNext_ < chunks_.size() ? static_cast<int32_t>(seqNext_) : -1;
+}
 
+void EncodingConverter::finish() {
+    uint32_t total = sizedUtf8();
+    {
+        std::lock_guard<std::mutex> conv(convertMutex_);
+        // 写入完成标记 "DONE"，之后 text.utf8 自身即完整缓存，日志不再需要
+        flushOutput();
+        fseek(dstFile_, total, SEEK_SET);
+        fwrite("DONE", 1, 4, dstFile_);
+        fflush(dstFile_);
+        fsync(fileno(dstFile_));
+        uncommitted_.clear();
+        if (journalFile_) {
+            fclose(journalFile_);
+            journalFile_ = nullptr;
+        }
+        remove(journalPath_);
+    }
     complete_ = true;
+
+    ESP_LOGI(TAG, "BG: Conversion complete: %lu bytes UTF-8",
+             (unsigned long)total);
+    if (owner_) {
+        owner_->onConversionComplete(total);
+    }
+}
+
+void EncodingConverter::taskFunc(void* param) {
+    auto* self = static_cast<EncodingConverter*>(param);
+    self->doBackground();
+    self->sizeJob_.finish();
+    self->job_.finish();
+    self->taskExited_ = true;
+    vTaskDelete(nullptr);
+}
+
+void EncodingConverter::doBackground() {
+    // 1. 长度扫描：只读源文件、查表计算长度，不写输出
+    if (!isSized()) {
+        ink::JobSlice slice(sizeJob_);
+        FILE* f = fopen(srcPath_, "rb");
+        char* buf = static_cast<char*>(
+            heap_caps_malloc(CHUNK_SRC_SIZE, MALLOC_CAP_SPIRAM));
+        if (!f || !buf) {
+            ESP_LOGE(TAG, "BG: Failed to start sizing pass");
+            if (f) fclose(f);
+            if (buf) heap_caps_free(buf);
+            return;
+        }
+
+        // 扫描以 I/O 为主，时间片用完才让出 CPU 喂看门狗
+        while (slice.yieldPoint() && sizeNextChunk(f, buf)) {
+            if (owner_) owner_->updateAvailableSize(sizedUtf8());
+        }
+        fclose(f);
+        heap_caps_free(buf);
+
+        if (job_.cancelled()) return;
+        if (!isSized()) {
+            ESP_LOGE(TAG, "BG: Sizing pass failed");
+            return;
+        }
+    }
+    sizeJob_.finish();
+
+    if (mapFile_) {
+        fclose(mapFile_);
+        mapFile_ = nullptr;
+    }
+    uint32_t total = sizedUtf8();
+    ESP_LOGI(TAG, "BG: Sizing complete: %lu bytes UTF-8",
+             (unsigned long)total);
+    if (owner_) owner_->onSizingComplete(total);
+
+    // 2. 转换：访问位置附近优先，其余顺序补齐
+    ink::JobSlice slice(job_);
+    while (slice.yieldPoint()) {
+        // 读者正在等待按需转换时让路
+        slice.beginWait();
+        while (priorityWaiters_ > 0 && !job_.cancelled()) {
+            vTaskDelay(1);
+        }
+        slice.endWait();
+
+        int32_t idx = nextChunk();
+        if (idx < 0) break;
+
+        std::lock_guard<std::mutex> conv(convertMutex_);
+        if (!convertChunk(static_cast<uint32_t>(idx))) {
+            ESP_LOGE(TAG, "BG: Conversion failed at chunk %ld", (long)idx);
+            return;
+        }
+    }
+
+    bool allConverted;
+    {
+        std::lock_guard<std::mutex> lock(mapMutex_);
+        allConverted = convertedCount_ == chunks_.size();
+    }
+    if (!job_.cancelled() && !allConverted) {
+        ESP_LOGE(TAG, "BG: Conversion stopped with %lu/%u chunks",
+                 (unsigned long)convertedCount_, (unsigned)chunks_.size());
+        return;
+    }
+
+    if (!job_.cancelled()) {
+        finish();
+    }
 }
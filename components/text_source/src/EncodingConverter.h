@@ -1,24 +1,45 @@
 /**
  * @file EncodingConverter.h
- * @brief GBK -> UTF-8 后台流式转换器。
+ * @brief GBK -> UTF-8 随机访问转换器。
+ *
+ * 源文件按 64KB 分段，段边界对齐到完整 GBK 字符。后台先做一遍只计算
+ * 输出长度的快速扫描，得到每段在 UTF-8 输出中的起止偏移（checkpoint
+ * 映射，分批追加到 text.map）；之后任意段都能独立转换并写到 text.utf8
+ * 的对应位置。读者访问未转换的段时在调用线程中按需转换，后台 task
+ * 先转换最近访问位置附近的段，再顺序补齐其余段。
+ *
+ * 已转换的段序号分批提交到 text.jnl（先同步 text.utf8 再追加日志），
+ * 中途关闭或断电后再次打开时保留已提交的段，只转换剩余部分。
+ *
+ * 后台逐段串行转换：读、转码、写共用一条 SD 总线，转码只占几个百分点，
+ * 另起 I/O task 重叠也省不下时间。输出经暂存缓冲按 32KB（FAT 簇）对齐
+ * 写入，相邻段的首尾合并为整簇。
  */
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <mutex>
+#include <vector>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "job_scheduler/JobScheduler.h"
 
 namespace ink {
 class TextSource;
 }
 
-/// GBK -> UTF-8 后台流式转换器
+/// GBK -> UTF-8 随机访问转换器
 struct EncodingConverter {
-    static constexpr uint32_t FIRST_CHUNK_SRC_SIZE = 128 * 1024;  // 128KB GBK 源
-    static constexpr uint32_t CONVERT_BLOCK_SIZE = 64 * 1024;     // 64KB 转换块
+    static constexpr uint32_t CHUNK_SRC_SIZE = 64 * 1024;         // 每段 GBK 源字节数上限
+    static constexpr uint32_t CHUNK_DST_CAP = CHUNK_SRC_SIZE * 3;  // 孤立高字节 → 3 字节 U+FFFD
+    static constexpr uint32_t MAP_FLUSH_CHUNKS = 16;  // 扫描多少段写一次 text.map
+    static constexpr uint32_t PRIORITY_CHUNKS = 4;    // 访问位置之后优先转换的段数
+    static constexpr uint32_t JOURNAL_COMMIT_CHUNKS = 8;  // 转换多少段提交一次日志
+    static constexpr uint32_t WRITE_ALIGN = 32 * 1024;    // 输出写入对齐（FAT 簇）
 
     EncodingConverter();
     ~EncodingConverter();
@@ -27,34 +48,163 @@ struct EncodingConverter {
     EncodingConverter(const EncodingConverter&) = delete;
     EncodingConverter& operator=(const EncodingConverter&) = delete;
 
-    /// 转换首块到内存缓冲区（同步，快速）
-    bool convertFirstChunk(const char* srcPath, char* outBuf,
-                           uint32_t outCapacity, uint32_t* outSize);
+    /// 打开源文件和输出文件，加载已有 checkpoint 映射（没有则同步扫描首段）
+    /// 和转换日志（有效时保留 text.utf8 中已提交的段），并确保首段已转换，
+    /// 使文本开头立即可读。
+    bool open(const char* srcPath, const char* dstPath, const char* mapPath,
+              const char* journalPath, uint32_t srcFileSize,
+              ink::TextSource* owner);
 
-    /// 启动后台转换 task
-    bool startBackgroundConversion(const char* srcPath, const char* dstPath,
-                                   uint32_t srcFileSize, ink::TextSource* owner);
+    /// 启动后台 task：完成长度扫描，然后按优先级转换剩余段
+    bool startBackground();
 
-    /// 停止后台转换 task
+    /// 停止后台 task 并关闭文件。调用前须确保没有读者仍在调用 read()。
     void stop();
 
-    /// 是否转换完成
+    /// 读取 UTF-8 输出 [offset, offset + len)，未转换的段在调用线程中按需转换
+    /// @return 实际读取字节数；范围尚未扫描到或已停止时返回 0
+    uint32_t read(char* dst, uint32_t offset, uint32_t len);
+
+    /// BlockCache::ReadFn 适配
+    static uint32_t readThunk(void* ctx, char* dst, uint32_t offset,
+                              uint32_t len);
+
+    /// 提示当前阅读位置，后台 task 优先转换其后的段
+    void prioritize(uint32_t utf8Offset);
+
+    /// 已完成长度扫描的 UTF-8 字节数（全部扫描完即 UTF-8 总大小）
+    uint32_t sizedUtf8() const;
+
+    /// 长度扫描是否已覆盖整个源文件
+    bool isSized() const;
+
+    /// 是否全部段都已转换并写入 DONE 标记
     bool isComplete() const { return complete_; }
 
+    /// 转换进度 [0.0, 1.0]（按已转换的源字节数）
+    float progress() const;
+
+    /// 源文件偏移换算为 UTF-8 输出偏移（落在双字节字符中间时取该字符起点）。
+    /// 从 text.map 中不超过 srcOffset 的最后一个 checkpoint 起计算剩余部分，
+    /// 不依赖转换器实例，缓存命中时（没有转换器）同样可用。
+    static uint32_t utf8OffsetOf(const char* srcPath, const char* mapPath,
+                                 uint32_t srcFileSize, uint32_t srcOffset);
+
 private:
+    /// 一段的结束位置（段 i 的起点为段 i-1 的结束位置）
+    struct Checkpoint {
+        uint32_t srcEnd;   ///< GBK 源结束偏移（不含）
+        uint32_t utf8End;  ///< UTF-8 输出结束偏移（不含）
+    };
+
+    /// text.map 文件头，其后是连续的 Checkpoint 记录
+    struct MapHeader {
+        char magic[4];       ///< "GMAP"
+        uint32_t version;    ///< 1
+        uint32_t srcSize;    ///< 源文件大小
+        uint32_t chunkSize;  ///< CHUNK_SRC_SIZE
+    } __attribute__((packed));
+
+    /// text.jnl 文件头，其后是已提交段序号（uint32_t）
+    struct JournalHeader {
+        char magic[4];       ///< "GJNL"
+        uint32_t version;    ///< 1
+        uint32_t srcSize;    ///< 源文件大小
+        uint32_t chunkSize;  ///< CHUNK_SRC_SIZE
+    } __attribute__((packed));
+
+    static constexpr uint32_t MAP_VERSION = 1;
+    static constexpr uint32_t JOURNAL_VERSION = 1;
+
+    // 映射与转换状态（mapMutex_ 保护）
+    mutable std::mutex mapMutex_;
+    std::vector<Checkpoint> chunks_;
+    std::vector<uint8_t> converted_;  ///< 每段是否已写入 text.utf8
+    uint32_t convertedCount_ = 0;
+    std::atomic<uint32_t> convertedSrc_{0};  ///< 已转换段的源字节数（progress() 不加锁读取）
+    uint32_t seqNext_ = 0;            ///< 顺序转换的下一个候选段
+    int32_t hintChunk_ = -1;          ///< 最近访问位置所在段
+    bool sized_ = false;
+
+    // 文件 I/O（convertMutex_ 串行化按需转换、srcFile_/dstFile_ 访问和写入暂存）
+    std::mutex convertMutex_;
+    std::atomic<int> priorityWaiters_{0};  ///< 等待按需转换的读者数
+    FILE* srcFile_ = nullptr;
+    FILE* dstFile_ = nullptr;
+    char* srcBuf_ = nullptr;
+    char* dstBuf_ = nullptr;
+    char* writeBuf_ = nullptr;   ///< 对齐写入暂存，覆盖 [writeStart_, writeStart_ + writeLen_)
+    uint32_t writeStart_ = 0;
+    uint32_t writeLen_ = 0;
+
+    // 映射文件（只由 open() 和后台 task 顺序写入）
+    FILE* mapFile_ = nullptr;
+    uint32_t unflushedChunks_ = 0;
+
+    // 转换日志（convertMutex_ 保护）
+    FILE* journalFile_ = nullptr;
+    std::vector<uint32_t> uncommitted_;  ///< 已写入 text.utf8 但未提交日志的段
+    char journalPath_[256] = {};
+
+    // 后台 task
     TaskHandle_t taskHandle_ = nullptr;
-    volatile bool stopRequested_ = false;
+    // 分页等待长度扫描，扫描优先；扫描完成后读者按需转换，其余段的
+    // 转换只是后台预取
+    ink::Job sizeJob_{"size", ink::JobPriority::High};
+    ink::Job job_{"convert", ink::JobPriority::Normal};
+    volatile bool taskExited_ = false;
     volatile bool complete_ = false;
 
-    // task 参数
     char srcPath_[256] = {};
-    char dstPath_[256] = {};
     uint32_t srcFileSize_ = 0;
     ink::TextSource* owner_ = nullptr;
 
+    /// 加载 text.map；无效时重建文件头。返回 false 表示无法创建映射文件
+    bool loadMap(const char* mapPath);
+
+    /// 加载转换日志，把已提交的段标记为已转换。返回 true 表示可续转
+    bool loadJournal();
+
+    /// 创建空日志（丢弃旧的转换结果时调用）
+    bool resetJournal();
+
+    /// 同步 text.utf8 后追加未提交的段序号（持有 convertMutex_ 调用）
+    void commitJournal();
+
+    /// 扫描下一段的输出长度并追加 checkpoint。扫描完或出错返回 false
+    bool sizeNextChunk(FILE* f, char* buf);
+
+    /// 段的源/输出范围（持有 mapMutex_ 调用）
+    void chunkRange(uint32_t idx, uint32_t* srcStart, uint32_t* srcEnd,
+                    uint32_t* utf8Start, uint32_t* utf8End) const;
+
+    /// 包含 utf8Offset 的段序号（持有 mapMutex_ 调用），超出已扫描范围返回 -1
+    int32_t findChunk(uint32_t utf8Offset) const;
+
+    /// 确保 [start, end) 覆盖的段都已转换
+    bool ensureRange(uint32_t start, uint32_t end);
+
+    /// 转换一段并写入 text.utf8（持有 convertMutex_ 调用）
+    bool convertChunk(uint32_t idx);
+
+    /// 段已写入：更新转换状态并按批提交日志（持有 convertMutex_ 调用）
+    void markConverted(uint32_t idx, uint32_t srcLen);
+
+    /// 经暂存缓冲写入输出，整簇部分直接写出（持有 convertMutex_ 调用）
+    bool writeOutput(uint32_t offset, const char* data, uint32_t len);
+
+    /// 写出暂存中的剩余数据（持有 convertMutex_ 调用）
+    bool flushOutput();
+
+    /// 后台下一个要转换的段，全部已转换返回 -1
+    int32_t nextChunk();
+
+    /// 全部段转换完成：写入 DONE 标记
+    void finish();
+
     /// FreeRTOS task 入口
     static void taskFunc(void* param);
 
-    /// 执行流式转换
-    void doConversion();
+    /// 后台扫描 + 转换
+    void doBackground();
 };
@@ -0,0 +1,110 @@
+/**
+ * @file ReadAhead.cpp
+ * @brief ReadAhead 实现 — 后台预读 task。
+ */
+
+#include "ReadAhead.h"
+#include "BlockCache.h"
+
+extern "C" {
+#include "esp_log.h"
+}
+
+static const char* TAG = "ReadAhead";
+
+ReadAhead::ReadAhead() = default;
+
+ReadAhead::~ReadAhead() {
+    stop();
+}
+
+bool ReadAhead::start(BlockCache* cache, LoadedFn onLoaded, void* ctx) {
+    if (taskHandle_) return true;
+
+    cache_ = cache;
+    onLoaded_ = onLoaded;
+    ctx_ = ctx;
+    urgentBlock_ = NO_BLOCK;
+    exited_ = false;
+    queue_ = xQueueCreate(QUEUE_DEPTH, sizeof(Request));
+    if (!queue_) {
+        ESP_LOGE(TAG, "Failed to create hint queue");
+        return false;
+    }
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        taskFunc, "text_ra", 4096, this,
+        tskIDLE_PRIORITY + 3, &taskHandle_, 1);
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create read-ahead task");
+        taskHandle_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void ReadAhead::stop() {
+    if (!taskHandle_) return;
+
+    Request quit = {0, ink::ReadDirection::Forward, true};
+    xQueueSend(queue_, &quit, portMAX_DELAY);
+
+    // 等待 task 退出（块读取最多几十毫秒）
+    for (int i = 0; i < 100 && !exited_; i++) {
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    if (!exited_) {
+        ESP_LOGW(TAG, "Read-ahead task did not exit cleanly, forcing delete");
+        vTaskDelete(taskHandle_);
+    }
+    taskHandle_ = nullptr;
+    vQueueDelete(queue_);
+    queue_ = nullptr;
+}
+
+void ReadAhead::hint(uint32_t offset, ink::ReadDirection direction) {
+    if (!taskHandle_) return;
+    Request req = {offset, direction, false};
+    // 不等待：队列满说明预读已落后，丢弃本次提示即可
+    xQueueSend(queue_, &req, 0);
+}
+
+void ReadAhead::request(uint32_t offset, ink::ReadDirection direction) {
+    if (!taskHandle_) return;
+    urgentBlock_ = offset / BlockCache::BLOCK_SIZE;
+    // 队列满时 task 正忙于处理提示，下一次循环即会处理紧急块
+    hint(offset, direction);
+}
+
+void ReadAhead::taskFunc(void* param) {
+    auto* self = static_cast<ReadAhead*>(param);
+    self->run();
+    self->exited_ = true;
+    vTaskDelete(nullptr);
+}
+
+void ReadAhead::run() {
+    Request req;
+    while (xQueueReceive(queue_, &req, portMAX_DELAY) == pdTRUE) {
+        if (req.quit) break;
+
+        // 前台等待的块优先：read() 在块正由其他线程加载时等待其完成，
+        // 回调时块已就绪
+        uint32_t urgent = urgentBlock_.exchange(NO_BLOCK);
+        if (urgent != NO_BLOCK) {
+            cache_->read(urgent * BlockCache::BLOCK_SIZE);
+            if (onLoaded_) onLoaded_(ctx_);
+        }
+
+        // 当前块优先，然后沿阅读方向预读
+        uint32_t block = req.offset / BlockCache::BLOCK_SIZE;
+        cache_->prefetch(block);
+        for (uint32_t i = 1; i <= AHEAD_BLOCKS; i++) {
+            if (req.direction == ink::ReadDirection::Forward) {
+                cache_->prefetch(block + i);
+            } else if (block >= i) {
+                cache_->prefetch(block - i);
+            }
+        }
+    }
+}
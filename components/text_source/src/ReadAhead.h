@@ -0,0 +1,71 @@
+/**
+ * @file ReadAhead.h
+ * @brief 方向感知的后台预读 — 按阅读方向提前把后续块载入 BlockCache。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include "text_source/TextSource.h"
+
+struct BlockCache;
+
+/// 后台预读 task，消费访问提示并调用 BlockCache::prefetch()
+struct ReadAhead {
+    static constexpr uint32_t AHEAD_BLOCKS = 2;  // 阅读方向上预读的块数
+    static constexpr uint32_t QUEUE_DEPTH = 4;   // 提示队列深度
+    static constexpr uint32_t NO_BLOCK = UINT32_MAX;
+
+    /// 紧急块载入后的回调（在预读 task 中调用）
+    using LoadedFn = void (*)(void* ctx);
+
+    ReadAhead();
+    ~ReadAhead();
+
+    // 不可拷贝
+    ReadAhead(const ReadAhead&) = delete;
+    ReadAhead& operator=(const ReadAhead&) = delete;
+
+    /// 启动预读 task
+    /// @param onLoaded request() 请求的块载入（或载入失败）后调用，可为 nullptr
+    bool start(BlockCache* cache, LoadedFn onLoaded = nullptr,
+               void* ctx = nullptr);
+
+    /// 停止预读 task（等待进行中的块读取结束）
+    void stop();
+
+    /// 投递访问提示（非阻塞，队列满时丢弃最旧以外的新提示）
+    void hint(uint32_t offset, ink::ReadDirection direction);
+
+    /// 请求尽快载入 offset 所在块（tryRead 未命中），载入后调用 onLoaded。
+    /// 只保留最近一次请求；先于队列中的提示处理，提示被丢弃时也不会丢失
+    void request(uint32_t offset, ink::ReadDirection direction);
+
+private:
+    /// 队列消息
+    struct Request {
+        uint32_t offset;
+        ink::ReadDirection direction;
+        bool quit;
+    };
+
+    TaskHandle_t taskHandle_ = nullptr;
+    QueueHandle_t queue_ = nullptr;
+    BlockCache* cache_ = nullptr;
+    LoadedFn onLoaded_ = nullptr;
+    void* ctx_ = nullptr;
+    std::atomic<uint32_t> urgentBlock_{NO_BLOCK};  // request() 请求的块
+    volatile bool exited_ = false;
+
+    /// FreeRTOS task 入口
+    static void taskFunc(void* param);
+
+    /// 预读主循环
+    void run();
+};
@@ -4,13 +4,18 @@
  */
 
 #include "text_source/TextSource.h"
-#include "TextWindow.h"
+#include "BlockCache.h"
 #include "EncodingConverter.h"
+#include "ReadAhead.h"
+#include "Utf8Validator.h"
 
+#include <chrono>
 #include <cstring>
 #include <cstdio>
 #include <sys/stat.h>
 
+#include "sdkconfig.h"
+
 extern "C" {
 #include "esp_log.h"
 #include "esp_heap_caps.h"
@@ -19,6 +24,12 @@ extern "C" {
 
 static const char* TAG = "TextSource";
 
+#ifdef CONFIG_TEXT_SOURCE_CACHE_KB
+static constexpr uint32_t kCacheBudget = CONFIG_TEXT_SOURCE_CACHE_KB * 1024;
+#else
+static constexpr uint32_t kCacheBudget = BlockCache::DEFAULT_BUDGET;
+#endif
+
 namespace ink {
 
 // ════════════════════════════════════════════════════════════════
@@ -29,6 +40,7 @@ TextSource::TextSource() = default;
 
 TextSource::~TextSource() {
     close();
+    delete cache_;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -57,6 +69,13 @@ bool TextSource::open(const char* filePath, const char* cacheDirPath) {
         return false;
     }
 
+    // 启动后台预读（失败不影响阻塞读取）
+    readAhead_ = new ReadAhead();
+    if (!readAhead_->start(cache_, &TextSource::onReadAheadLoaded, this)) {
+        delete readAhead_;
+        readAhead_ = nullptr;
+    }
+
     return true;
 }
 
@@ -65,33 +84,37 @@ void TextSource::close() {
     {
         std::lock_guard<std::mutex> lock(mutex_);
         state_ = TextSourceState::Closed;
+        notifyWaitersLocked(true);
+    }
+
+    // 校验 task 可能正在切换到 GBK 转换，先于块缓存和转换器停止
+    if (validator_) {
+        validator_->stop();
+        delete validator_;
+        validator_ = nullptr;
     }
 
-    // 停止后台转换（stop() 内部等待 task 退出）
-    if (converter_) {
-        converter_->stop();
-        delete converter_;
-        converter_ = nullptr;
+    if (readAhead_) {
+        readAhead_->stop();
+        delete readAhead_;
+        readAhead_ = nullptr;
     }
 
-    // 释放窗口（此时后台 task 已停止，安全操作）
-    if (window_) {
-        window_->deinit();
-        delete window_;
-        window_ = nullptr;
+    // 释放块缓存内存（deinit 等待进行中的块读取；对象保留到析构，
+    // 使并发的 read() 只会得到空片段而不是悬空指针）
+    if (cache_) {
+        cache_->deinit();
     }
 
-    // 释放首块缓冲区
-    if (firstChunkBuf_) {
-        heap_caps_free(firstChunkBuf_);
-        firstChunkBuf_ = nullptr;
-        firstChunkSize_ = 0;
+    // 块缓存已不再回调转换器，停止后台转换（stop() 内部等待 task 退出）
+    if (EncodingConverter* converter = converter_.exchange(nullptr)) {
+        converter->stop();
+        delete converter;
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
     totalSize_ = 0;
     availableSize_ = 0;
-    usingFirstChunk_ = false;
     filePath_[0] = '\0';
     cacheDirPath_[0] = '\0';
     utf8FilePath_[0] = '\0';
@@ -102,69 +125,216 @@ void TextSource::close() {
 // ════════════════════════════════════════════════════════════════
 
 TextSpan TextSource::read(uint32_t offset) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    if (!readable(offset)) return {nullptr, 0};
 
-    if (state_ == TextSourceState::Closed || state_ == TextSourceState::Error) {
-        return {nullptr, 0};
-    }
+    // 块缓存自带锁，I/O 期间不持有 mutex_，状态查询不被阻塞。
+    // 块未命中时只读取 offset 所在的一个块
+    return cache_->read(offset);
+}
 
+ReadStatus TextSource::tryRead(uint32_t offset, TextSpan* out) {
+    return tryReadPinned(offset, out, nullptr);
+}
+
+bool TextSource::readable(uint32_t offset) const {
+    TextSourceState state = state_.load(std::memory_order_acquire);
+    if (state == TextSourceState::Closed || state == TextSourceState::Error) {
+        return false;
+    }
     // 检查是否超出当前可用范围
-    if (offset >= availableSize_) {
+    return offset < availableSize_.load(std::memory_order_acquire) && cache_ != nullptr;
+}
+
+TextSpan TextSource::readPinned(uint32_t offset, TextCursor* cursor) {
+    if (!readable(offset)) {
+        unpin(cursor);
         return {nullptr, 0};
     }
 
-    if (!window_) return {nullptr, 0};
+    BlockCache::Pin pin{cursor->pinSlot_, cursor->pinGen_};
+    TextSpan span = cache_->read(offset, &pin,
+                                 cursor->mode_ == CursorMode::Interactive);
+    cursor->pinSlot_ = pin.slot;
+    cursor->pinGen_ = pin.gen;
+    return span;
+}
 
-    // 如果 offset 不在当前窗口内，重新加载
-    if (!window_->contains(offset)) {
-        if (!window_->load(offset)) {
-            return {nullptr, 0};
-        }
+ReadStatus TextSource::tryReadPinned(uint32_t offset, TextSpan* out,
+                                     TextCursor* cursor) {
+    *out = {nullptr, 0};
+    if (!readable(offset)) return ReadStatus::Unavailable;
+    ReadDirection direction = lastDirection_.load(std::memory_order_relaxed);
+
+    bool hit;
+    if (cursor) {
+        BlockCache::Pin pin{cursor->pinSlot_, cursor->pinGen_};
+        hit = cache_->tryRead(offset, out, &pin,
+                              cursor->mode_ == CursorMode::Interactive);
+        cursor->pinSlot_ = pin.slot;
+        cursor->pinGen_ = pin.gen;
+    } else {
+        hit = cache_->tryRead(offset, out);
+    }
+    if (hit) {
+        return out->data ? ReadStatus::Ok : ReadStatus::Unavailable;
+    }
+
+    // 未命中：交给后台预读，载入后由就绪回调通知调用方重试
+    if (readAhead_) {
+        readAhead_->request(offset, direction);
+        return ReadStatus::Pending;
     }
 
-    return window_->spanAt(offset);
+    // 没有预读 task 就不会有回调：只能阻塞读取
+    *out = cursor ? readPinned(offset, cursor) : cache_->read(offset);
+    return out->data ? ReadStatus::Ok : ReadStatus::Unavailable;
+}
+
+void TextSource::setReadReadyCallback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    readReadyCallback_ = std::move(callback);
+}
+
+void TextSource::onReadAheadLoaded(void* ctx) {
+    auto* self = static_cast<TextSource*>(ctx);
+    std::function<void()> callback;
+    {
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        if (self->state_ == TextSourceState::Closed) return;
+        callback = self->readReadyCallback_;
+    }
+    if (callback) callback();
+}
+
+void TextSource::unpin(TextCursor* cursor) {
+    if (cursor->pinSlot_ >= 0 && cache_) {
+        BlockCache::Pin pin{cursor->pinSlot_, cursor->pinGen_};
+        cache_->unpin(&pin);
+    }
+    cursor->pinSlot_ = -1;
+    cursor->pinGen_ = 0;
+}
+
+void TextSource::reportAccess(uint32_t offset, ReadDirection direction) {
+    if (state_.load(std::memory_order_acquire) == TextSourceState::Closed) return;
+    lastDirection_.store(direction, std::memory_order_relaxed);
+    // 校验 task 切换到 GBK 时会设置 converter_；转换器只在 close() 中释放
+    EncodingConverter* converter = converter_.load(std::memory_order_acquire);
+    if (converter) {
+        converter->prioritize(offset);
+    }
+    if (readAhead_) {
+        readAhead_->hint(offset, direction);
+    }
 }
 
 // ════════════════════════════════════════════════════════════════
 //  查询方法
 // ════════════════════════════════════════════════════════════════
 
+// 查询不加锁：UI 线程不会因后台转换或校验持有 mutex_ 而阻塞
+
 TextSourceState TextSource::state() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return state_;
+    return state_.load(std::memory_order_acquire);
 }
 
 uint32_t TextSource::totalSize() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return totalSize_;
+    return totalSize_.load(std::memory_order_acquire);
 }
 
 uint32_t TextSource::availableSize() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return availableSize_;
+    return availableSize_.load(std::memory_order_acquire);
 }
 
 float TextSource::progress() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (state_ == TextSourceState::Ready) return 1.0f;
-    if (state_ == TextSourceState::Closed || state_ == TextSourceState::Error) {
+    TextSourceState state = state_.load(std::memory_order_acquire);
+    if (state == TextSourceState::Ready) return 1.0f;
+    if (state == TextSourceState::Closed || state == TextSourceState::Error) {
         return 0.0f;
     }
-    if (originalFileSize_ == 0) return 0.0f;
-    // GBK 转换进度基于已处理的源文件字节数
-    // availableSize_ 是 UTF-8 输出大小，用原始文件大小估算
-    return static_cast<float>(availableSize_) /
-           static_cast<float>(originalFileSize_ * 3 / 2);
+    // GBK 转换进度基于已转换的源文件字节数
+    EncodingConverter* converter = converter_.load(std::memory_order_acquire);
+    return converter ? converter->progress() : 0.0f;
 }
 
 int TextSource::detectedEncoding() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return detectedEncoding_;
+    return detectedEncoding_.load(std::memory_order_relaxed);
 }
 
 uint32_t TextSource::originalFileSize() const {
+    return originalFileSize_.load(std::memory_order_relaxed);
+}
+
+uint32_t TextSource::contentVersion() const {
+    return contentVersion_.load(std::memory_order_acquire);
+}
+
+uint32_t TextSource::rawTextSize() const {
+    return originalFileSize_.load(std::memory_order_relaxed) - rawSkip_;
+}
+
+uint32_t TextSource::translateRawOffset(uint32_t rawOffset,
+                                        uint32_t* version) const {
+    // 编码与版本在 mutex_ 下一起取，结果与返回的版本号对应
+    bool gbk;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        gbk = detectedEncoding_ == static_cast<int>(TEXT_ENCODING_GBK);
+        if (version) *version = contentVersion_.load(std::memory_order_relaxed);
+    }
+    if (!gbk) return rawOffset;
+
+    char mapPath[280];
+    snprintf(mapPath, sizeof(mapPath), "%s/text.map", cacheDirPath_);
+    return EncodingConverter::utf8OffsetOf(filePath_, mapPath,
+                                           originalFileSize(),
+                                           rawOffset + rawSkip_);
+}
+
+void TextSource::setContentChangedCallback(std::function<void()> callback) {
     std::lock_guard<std::mutex> lock(mutex_);
-    return originalFileSize_;
+    contentChangedCallback_ = std::move(callback);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  可用范围等待
+// ════════════════════════════════════════════════════════════════
+
+bool TextSource::waitForAvailable(uint32_t minSize, uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto satisfied = [&] { return availableSize_ >= minSize || totalSize_ > 0; };
+    uint32_t version = contentVersion_;
+    uint32_t gen = wakeGen_;
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(timeoutMs);
+
+    while (!satisfied()) {
+        TextSourceState state = state_;
+        if (state == TextSourceState::Closed || state == TextSourceState::Error ||
+            contentVersion_ != version || wakeGen_ != gen) {
+            return false;
+        }
+        // 多个等待者时水位线取最小值，被唤醒后未满足的等待者重新登记
+        if (minSize < watermark_) watermark_ = minSize;
+        if (availCv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+            return satisfied();
+        }
+    }
+    return true;
+}
+
+void TextSource::wakeWaiters() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wakeGen_++;
+    notifyWaitersLocked(true);
+}
+
+void TextSource::notifyWaitersLocked(bool force) {
+    if (watermark_ == UINT32_MAX && !force) return;
+    if (force || availableSize_ >= watermark_ || totalSize_ > 0) {
+        watermark_ = UINT32_MAX;
+        availCv_.notify_all();
+    }
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -190,13 +360,17 @@ bool TextSource::initEncoding() {
     }
     originalFileSize_ = static_cast<uint32_t>(fsize);
 
+    struct stat st;
+    originalMtime_ = (stat(filePath_, &st) == 0)
+                         ? static_cast<uint32_t>(st.st_mtime) : 0;
+
     // 读取前几 KB 用于编码检测
     f = fopen(filePath_, "rb");
     if (!f) return false;
 
     constexpr uint32_t PROBE_SIZE = 8 * 1024;
     uint32_t probeSize = (originalFileSize_ < PROBE_SIZE)
-                             ? originalFileSize_ : PROBE_SIZE;
+                             ? originalFileSize_.load() : PROBE_SIZE;
     char* probeBuf = static_cast<char*>(heap_caps_malloc(PROBE_SIZE, MALLOC_CAP_INTERNAL));
     if (!probeBuf) {
         fclose(f);
@@ -213,15 +387,39 @@ bool TextSource::initEncoding() {
     text_encoding_t enc = text_encoding_detect(probeBuf, readBytes);
     heap_caps_free(probeBuf);
     detectedEncoding_ = static_cast<int>(enc);
+    rawSkip_ = (enc == TEXT_ENCODING_UTF8_BOM) ? 3 : 0;
 
     ESP_LOGI(TAG, "Detected encoding: %d, file size: %lu bytes",
              (int)enc, (unsigned long)originalFileSize_);
 
     if (enc == TEXT_ENCODING_GBK) {
         return initGbk();
-    } else {
+    }
+
+    if (originalFileSize_ <= probeSize) {
+        // 探测已覆盖整个文件
+        return initUtf8();
+    }
+
+    // 探测只覆盖开头：查上次打开时的整文件校验结果
+    char chkPath[280];
+    snprintf(chkPath, sizeof(chkPath), "%s/text.chk", cacheDirPath_);
+    Utf8Validator::Result result;
+    if (Utf8Validator::loadResult(chkPath, originalFileSize_, originalMtime_,
+                                  &result)) {
+        if (!result.valid) {
+            ESP_LOGI(TAG, "Cached check: invalid UTF-8 at %lu, using GBK",
+                     (unsigned long)result.firstInvalid);
+            detectedEncoding_ = static_cast<int>(TEXT_ENCODING_GBK);
+            return initGbk();
+        }
         return initUtf8();
     }
+
+    // 没有校验结果：先按 UTF-8 打开，后台校验其余部分
+    if (!initUtf8()) return false;
+    startValidation(rawSkip_);
+    return true;
 }
 
 bool TextSource::initUtf8() {
@@ -234,15 +432,10 @@ bool TextSource::initUtf8() {
     }
 
     totalSize_ = originalFileSize_ - skipBytes;
-    availableSize_ = totalSize_;
+    availableSize_ = totalSize_.load();
 
-    // 初始化滑动窗口
-    window_ = new TextWindow();
-    if (!window_->init()) {
-        delete window_;
-        window_ = nullptr;
-        return false;
-    }
+    // 初始化块缓存
+    if (!createCache()) return false;
 
     // 打开文件供窗口使用
     FILE* f = fopen(utf8FilePath_, "rb");
@@ -251,10 +444,10 @@ bool TextSource::initUtf8() {
         return false;
     }
 
-    window_->setFile(f, totalSize_, skipBytes);
+    cache_->setFile(f, totalSize_, skipBytes);
 
     // 预加载首块
-    window_->load(0);
+    cache_->read(0);
 
     state_ = TextSourceState::Ready;
     ESP_LOGI(TAG, "UTF-8 file ready: %lu bytes", (unsigned long)totalSize_);
@@ -265,12 +458,7 @@ bool TextSource::initGbk() {
     // 检查缓存是否可用
     if (checkCache()) {
         // 缓存命中，直接使用 text.utf8
-        window_ = new TextWindow();
-        if (!window_->init()) {
-            delete window_;
-            window_ = nullptr;
-            return false;
-        }
+        if (!createCache()) return false;
 
         FILE* f = fopen(utf8FilePath_, "rb");
         if (!f) {
@@ -283,10 +471,10 @@ bool TextSource::initGbk() {
         long cacheSize = ftell(f);
         fseek(f, 0, SEEK_SET);
         totalSize_ = static_cast<uint32_t>(cacheSize - 4);
-        availableSize_ = totalSize_;
+        availableSize_ = totalSize_.load();
 
-        window_->setFile(f, totalSize_);
-        window_->load(0);
+        cache_->setFile(f, totalSize_);
+        cache_->read(0);
 
         state_ = TextSourceState::Ready;
         ESP_LOGI(TAG, "GBK cache hit: %lu bytes UTF-8",
@@ -294,50 +482,39 @@ bool TextSource::initGbk() {
         return true;
     }
 
-    // 缓存未命中：首块内存转换 + 启动后台 task
-    // 分配首块缓冲区（128KB 源 → 最大 192KB UTF-8）
-    constexpr uint32_t FIRST_CHUNK_CAP = 192 * 1024;
-    firstChunkBuf_ = static_cast<char*>(
-        heap_caps_malloc(FIRST_CHUNK_CAP, MALLOC_CAP_SPIRAM));
-    if (!firstChunkBuf_) {
-        ESP_LOGE(TAG, "Failed to allocate first chunk buffer");
-        return false;
-    }
+    // 缓存未完成：同步转换首段（已按日志保留的段跳过），之后任意位置
+    // 按需转换，后台 task 补齐其余段
+    mkdir(cacheDirPath_, 0755);
+
+    char mapPath[280];
+    char journalPath[280];
+    snprintf(mapPath, sizeof(mapPath), "%s/text.map", cacheDirPath_);
+    snprintf(journalPath, sizeof(journalPath), "%s/text.jnl", cacheDirPath_);
 
-    // 同步转换首块
-    converter_ = new EncodingConverter();
-    if (!converter_->convertFirstChunk(filePath_, firstChunkBuf_,
-                                       FIRST_CHUNK_CAP, &firstChunkSize_)) {
-        ESP_LOGE(TAG, "Failed to convert first chunk");
-        heap_caps_free(firstChunkBuf_);
-        firstChunkBuf_ = nullptr;
-        delete converter_;
-        converter_ = nullptr;
+    auto* converter = new EncodingConverter();
+    if (!converter->open(filePath_, utf8FilePath_, mapPath, journalPath,
+                         originalFileSize_, this)) {
+        ESP_LOGE(TAG, "Failed to open GBK converter");
+        delete converter;
         return false;
     }
+    converter_ = converter;
 
-    ESP_LOGI(TAG, "First chunk converted: %lu bytes UTF-8",
-             (unsigned long)firstChunkSize_);
-
-    // 初始化窗口为内存模式
-    window_ = new TextWindow();
-    if (!window_->init()) {
-        delete window_;
-        window_ = nullptr;
-        return false;
+    // 块缓存从转换器读取：块未命中时由转换器先转换所需段
+    if (!createCache()) return false;
+    availableSize_ = converter->sizedUtf8();
+    if (converter->isSized()) {
+        totalSize_ = availableSize_.load();
     }
-    window_->setMemory(firstChunkBuf_, firstChunkSize_);
-    availableSize_ = firstChunkSize_;
-    usingFirstChunk_ = true;
+    cache_->setReader(&EncodingConverter::readThunk, converter, availableSize_);
 
-    // 创建缓存目录
-    mkdir(cacheDirPath_, 0755);
+    ESP_LOGI(TAG, "GBK converter ready: %lu bytes UTF-8 addressable",
+             (unsigned long)availableSize_);
 
-    // 启动后台转换
-    if (!converter_->startBackgroundConversion(filePath_, utf8FilePath_,
-                                                originalFileSize_, this)) {
+    // 启动后台扫描与转换
+    if (!converter->startBackground()) {
         ESP_LOGE(TAG, "Failed to start background conversion");
-        // 首块仍然可用，降级为仅首块模式
+        // 已扫描范围仍可按需转换，降级为部分可用
         state_ = TextSourceState::Available;
         return true;
     }
@@ -346,6 +523,28 @@ bool TextSource::initGbk() {
     return true;
 }
 
+void TextSource::startValidation(uint32_t skipBytes) {
+    mkdir(cacheDirPath_, 0755);
+
+    char chkPath[280];
+    snprintf(chkPath, sizeof(chkPath), "%s/text.chk", cacheDirPath_);
+
+    validator_ = new Utf8Validator();
+    if (!validator_->start(filePath_, originalFileSize_, originalMtime_,
+                           skipBytes, chkPath, this)) {
+        // 校验失败不影响阅读，下次打开再试
+        delete validator_;
+        validator_ = nullptr;
+    }
+}
+
+bool TextSource::createCache() {
+    if (!cache_) {
+        cache_ = new BlockCache();
+    }
+    return cache_->init(kCacheBudget);
+}
+
 bool TextSource::checkCache() {
     FILE* f = fopen(utf8FilePath_, "rb");
     if (!f) return false;
@@ -366,9 +565,8 @@ bool TextSource::checkCache() {
     fclose(f);
 
     if (memcmp(magic, "DONE", 4) != 0) {
-        // 不完整缓存，删除
-        ESP_LOGW(TAG, "Incomplete cache, removing: %s", utf8FilePath_);
-        remove(utf8FilePath_);
+        // 不完整缓存：保留，由转换器按 text.jnl 续转
+        ESP_LOGW(TAG, "Incomplete cache, resuming: %s", utf8FilePath_);
         return false;
     }
 
@@ -376,6 +574,78 @@ bool TextSource::checkCache() {
     return true;
 }
 
+// ════════════════════════════════════════════════════════════════
+//  后台校验回调
+// ════════════════════════════════════════════════════════════════
+
+void TextSource::onValidationComplete(bool valid, uint32_t firstInvalid) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (state_ == TextSourceState::Closed) return;
+    }
+    if (valid) return;
+
+    ESP_LOGW(TAG, "Not UTF-8 past probe (offset %lu), switching to GBK",
+             (unsigned long)firstInvalid);
+    switchToGbk();
+}
+
+void TextSource::switchToGbk() {
+    char mapPath[280];
+    char journalPath[280];
+    char dstPath[sizeof(utf8FilePath_)];
+    snprintf(mapPath, sizeof(mapPath), "%s/text.map", cacheDirPath_);
+    snprintf(journalPath, sizeof(journalPath), "%s/text.jnl", cacheDirPath_);
+    int n = snprintf(dstPath, sizeof(dstPath), "%s/text.utf8", cacheDirPath_);
+    if (n < 0 || n >= static_cast<int>(sizeof(dstPath))) {
+        ESP_LOGE(TAG, "Cache path too long, staying on UTF-8: %s", cacheDirPath_);
+        return;
+    }
+
+    // 首段同步转换，期间读者仍读原文件
+    auto* converter = new EncodingConverter();
+    if (!converter->open(filePath_, dstPath, mapPath, journalPath,
+                         originalFileSize_, this)) {
+        ESP_LOGE(TAG, "Failed to open GBK converter, staying on UTF-8");
+        delete converter;
+        return;
+    }
+
+    std::function<void()> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (state_ == TextSourceState::Closed) {
+            converter->stop();
+            delete converter;
+            return;
+        }
+
+        // 块缓存等待进行中的加载后丢弃全部旧块，旧 pin 随之失效
+        uint32_t sized = converter->sizedUtf8();
+        cache_->setReader(&EncodingConverter::readThunk, converter, sized);
+
+        converter_ = converter;
+        detectedEncoding_ = static_cast<int>(TEXT_ENCODING_GBK);
+        memcpy(utf8FilePath_, dstPath, sizeof(utf8FilePath_));
+        availableSize_ = sized;
+        totalSize_ = converter->isSized() ? sized : 0;
+        state_ = TextSourceState::Converting;
+        contentVersion_++;
+        notifyWaitersLocked(true);
+        callback = contentChangedCallback_;
+    }
+
+    if (!converter->startBackground()) {
+        ESP_LOGE(TAG, "Failed to start background conversion");
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (state_ == TextSourceState::Converting) {
+            state_ = TextSourceState::Available;
+        }
+    }
+
+    if (callback) callback();
+}
+
 // ════════════════════════════════════════════════════════════════
 //  后台转换回调
 // ════════════════════════════════════════════════════════════════
@@ -386,33 +656,131 @@ void TextSource::onConversionComplete(uint32_t utf8Size) {
     // 如果已关闭，忽略回调
     if (state_ == TextSourceState::Closed) return;
 
+    // 块缓存继续通过转换器读取 text.utf8，全部段已转换，不再触发转换
     totalSize_ = utf8Size;
     availableSize_ = utf8Size;
 
-    // 切换窗口到文件模式
-    FILE* f = fopen(utf8FilePath_, "rb");
-    if (f && window_) {
-        window_->setFile(f, utf8Size);
-        window_->load(0);
-    }
-
-    // 释放首块缓冲区
-    if (firstChunkBuf_) {
-        heap_caps_free(firstChunkBuf_);
-        firstChunkBuf_ = nullptr;
-        firstChunkSize_ = 0;
-    }
-    usingFirstChunk_ = false;
-
     state_ = TextSourceState::Ready;
+    notifyWaitersLocked(false);
     ESP_LOGI(TAG, "Conversion complete: %lu bytes UTF-8",
              (unsigned long)utf8Size);
 }
 
+void TextSource::onSizingComplete(uint32_t utf8Size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_ == TextSourceState::Closed) return;
+    // 读者不加锁：块缓存先扩展，再发布可用大小
+    if (cache_) cache_->growSource(utf8Size);
+    totalSize_ = utf8Size;
+    availableSize_ = utf8Size;
+    notifyWaitersLocked(false);
+}
+
 void TextSource::updateAvailableSize(uint32_t size) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (state_ == TextSourceState::Closed) return;
+    if (cache_) cache_->growSource(size);
     availableSize_ = size;
+    notifyWaitersLocked(false);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  TextCursor
+// ════════════════════════════════════════════════════════════════
+
+TextCursor::TextCursor(CursorMode mode) : mode_(mode) {}
+
+TextCursor::~TextCursor() {
+    release();
+    if (stitchBuf_) {
+        heap_caps_free(stitchBuf_);
+        stitchBuf_ = nullptr;
+    }
+}
+
+void TextCursor::bind(TextSource* source) {
+    release();
+    source_ = source;
+}
+
+TextSpan TextCursor::read(uint32_t offset) {
+    if (!source_) return {nullptr, 0};
+    return source_->readPinned(offset, this);
+}
+
+TextSpan TextCursor::readRange(uint32_t offset, uint32_t minLen) {
+    TextSpan span;
+    readRangeImpl(offset, minLen, true, &span);
+    return span;
+}
+
+ReadStatus TextCursor::tryReadRange(uint32_t offset, uint32_t minLen,
+                                    TextSpan* out) {
+    return readRangeImpl(offset, minLen, false, out);
+}
+
+ReadStatus TextCursor::readRangeImpl(uint32_t offset, uint32_t minLen,
+                                     bool wait, TextSpan* out) {
+    auto readPiece = [&](uint32_t pos, TextSpan* piece) {
+        if (!wait) return tryRead(pos, piece);
+        *piece = read(pos);
+        return piece->data ? ReadStatus::Ok : ReadStatus::Unavailable;
+    };
+
+    TextSpan first;
+    ReadStatus status = readPiece(offset, &first);
+    *out = first;
+    if (status != ReadStatus::Ok || first.length >= minLen) return status;
+
+    // 跨块：拼接到本游标的缓冲区。多留 4 字节，截断到完整字符后仍不少于 minLen
+    uint32_t cap = minLen + 4;
+    if (stitchCap_ < cap) {
+        char* buf = static_cast<char*>(heap_caps_malloc(cap, MALLOC_CAP_SPIRAM));
+        if (!buf) {
+            ESP_LOGW(TAG, "Failed to allocate %lu byte stitch buffer",
+                     (unsigned long)cap);
+            return ReadStatus::Ok;  // 退化为单块片段
+        }
+        if (stitchBuf_) heap_caps_free(stitchBuf_);
+        stitchBuf_ = buf;
+        stitchCap_ = cap;
+    }
+
+    memcpy(stitchBuf_, first.data, first.length);
+    uint32_t have = first.length;
+    while (have < minLen) {
+        // 块内片段止于完整字符，下一段从字符起始处开始
+        TextSpan next;
+        status = readPiece(offset + have, &next);
+        if (status == ReadStatus::Pending) {
+            release();
+            *out = {nullptr, 0};
+            return status;
+        }
+        if (!next.data || next.length == 0) break;  // 可用范围末尾
+        uint32_t n = next.length;
+        if (n > cap - have) n = cap - have;
+        memcpy(stitchBuf_ + have, next.data, n);
+        have += n;
+    }
+    // 数据已复制，不再需要 pin
+    release();
+
+    have = BlockCache::alignUtf8Backward(stitchBuf_, have);
+    *out = {stitchBuf_, have};
+    return ReadStatus::Ok;
+}
+
+ReadStatus TextCursor::tryRead(uint32_t offset, TextSpan* out) {
+    if (!source_) {
+        *out = {nullptr, 0};
+        return ReadStatus::Unavailable;
+    }
+    return source_->tryReadPinned(offset, out, this);
+}
+
+void TextCursor::release() {
+    if (source_) source_->unpin(this);
 }
 
 }  // namespace ink
@@ -0,0 +1,185 @@
+/**
+ * @file Utf8Validator.cpp
+ * @brief Utf8Validator 实现 — 后台整文件 UTF-8 校验。
+ */
+
+#include "Utf8Validator.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "text_source/TextSource.h"
+
+extern "C" {
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "text_encoding.h"
+}
+
+static const char* TAG = "Utf8Validator";
+
+Utf8Validator::Utf8Validator() = default;
+
+Utf8Validator::~Utf8Validator() {
+    stop();
+}
+
+bool Utf8Validator::start(const char* filePath, uint32_t fileSize,
+                          uint32_t mtime, uint32_t skipBytes,
+                          const char* resultPath, ink::TextSource* owner) {
+    if (taskHandle_) return true;
+
+    strncpy(filePath_, filePath, sizeof(filePath_) - 1);
+    strncpy(resultPath_, resultPath, sizeof(resultPath_) - 1);
+    fileSize_ = fileSize;
+    mtime_ = mtime;
+    skipBytes_ = skipBytes;
+    owner_ = owner;
+    exited_ = false;
+    job_.start();
+
+    // 优先级低于转换与分页，只占用空闲的 SD 带宽
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        taskFunc, "utf8_chk", 4096, this,
+        tskIDLE_PRIORITY + 1, &taskHandle_, 1);
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create validation task");
+        taskHandle_ = nullptr;
+        job_.finish();
+        return false;
+    }
+    return true;
+}
+
+void Utf8Validator::stop() {
+    if (!taskHandle_) return;
+
+    job_.cancel();
+    // 每读一块检查一次停止请求；切换到转换路径时可能需要更久
+    for (int i = 0; i < 100 && !exited_; i++) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    if (!exited_) {
+        ESP_LOGW(TAG, "Validation task did not exit cleanly, forcing delete");
+        vTaskDelete(taskHandle_);
+        job_.finish();
+    }
+    taskHandle_ = nullptr;
+}
+
+bool Utf8Validator::loadResult(const char* resultPath, uint32_t fileSize,
+                               uint32_t mtime, Result* out) {
+    FILE* f = fopen(resultPath, "rb");
+    if (!f) return false;
+
+    Record rec;
+    bool ok = fread(&rec, sizeof(rec), 1, f) == 1 &&
+              memcmp(rec.magic, "UCHK", 4) == 0 &&
+              rec.version == RECORD_VERSION &&
+              rec.fileSize == fileSize && rec.mtime == mtime;
+    fclose(f);
+    if (!ok) return false;
+
+    out->valid = rec.valid != 0;
+    out->firstInvalid = rec.firstInvalid;
+    return true;
+}
+
+void Utf8Validator::saveResult(const Result& result) {
+    FILE* f = fopen(resultPath_, "wb");
+    if (!f) {
+        ESP_LOGW(TAG, "Failed to write %s", resultPath_);
+        return;
+    }
+    Record rec;
+    memcpy(rec.magic, "UCHK", 4);
+    rec.version = RECORD_VERSION;
+    rec.fileSize = fileSize_;
+    rec.mtime = mtime_;
+    rec.valid = result.valid ? 1 : 0;
+    rec.firstInvalid = result.firstInvalid;
+    fwrite(&rec, sizeof(rec), 1, f);
+    fclose(f);
+}
+
+bool Utf8Validator::validate(Result* out) {
+    FILE* f = fopen(filePath_, "rb");
+    // 多留 3 字节放上一块末尾的不完整序列
+    char* buf = static_cast<char*>(
+        heap_caps_malloc(READ_SIZE + 3, MALLOC_CAP_SPIRAM));
+    if (!f || !buf) {
+        ESP_LOGE(TAG, "Failed to start validation: %s", filePath_);
+        if (f) fclose(f);
+        if (buf) heap_caps_free(buf);
+        return false;
+    }
+
+    fseek(f, skipBytes_, SEEK_SET);
+    uint32_t base = skipBytes_;  // buf[0] 在原文件中的偏移
+    size_t carry = 0;
+    bool finished = false;
+
+    out->valid = true;
+    out->firstInvalid = fileSize_;
+
+    // 校验以 I/O 为主，时间片用完才让出 CPU 喂看门狗
+    ink::JobSlice slice(job_);
+    while (slice.yieldPoint()) {
+        size_t n = fread(buf + carry, 1, READ_SIZE, f);
+        size_t len = carry + n;
+        bool final = n < READ_SIZE;
+        // 读取出错或提前结束时结果不可信：不报告也不保存，下次打开重新校验
+        if (final && (ferror(f) || base + len < fileSize_)) {
+            ESP_LOGE(TAG, "Read failed at offset %lu: %s",
+                     (unsigned long)(base + len), filePath_);
+            break;
+        }
+
+        size_t tail = 0;
+        size_t bad = text_encoding_utf8_validate(buf, len,
+                                                 final ? nullptr : &tail);
+        if (bad != len) {
+            out->valid = false;
+            out->firstInvalid = base + static_cast<uint32_t>(bad);
+            finished = true;
+            break;
+        }
+        if (final) {
+            finished = true;
+            break;
+        }
+
+        memmove(buf, buf + len - tail, tail);
+        base += static_cast<uint32_t>(len - tail);
+        carry = tail;
+    }
+
+    fclose(f);
+    heap_caps_free(buf);
+    return finished;
+}
+
+void Utf8Validator::taskFunc(void* param) {
+    auto* self = static_cast<Utf8Validator*>(param);
+    self->run();
+    self->job_.finish();
+    self->exited_ = true;
+    vTaskDelete(nullptr);
+}
+
+void Utf8Validator::run() {
+    Result result;
+    if (!validate(&result)) return;
+
+    saveResult(result);
+    if (result.valid) {
+        ESP_LOGI(TAG, "Whole file is valid UTF-8: %s", filePath_);
+    } else {
+        ESP_LOGW(TAG, "Invalid UTF-8 at offset %lu: %s",
+                 (unsigned long)result.firstInvalid, filePath_);
+    }
+
+    if (owner_ && !job_.cancelled()) {
+        owner_->onValidationComplete(result.valid, result.firstInvalid);
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file Utf8Validator.h
+ * @brief 后台整文件 UTF-8 校验 — 弥补编码检测只探测文件开头的不足。
+ *
+ * 编码检测只读前 8KB，英文前言 + GBK 正文的文件会被误判为 UTF-8。
+ * 打开后由后台 task 顺序读完整个文件做严格校验，结果（含首个非法字节
+ * 偏移）写入缓存目录的 text.chk，下次打开直接按结果选择读取路径。
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "job_scheduler/JobScheduler.h"
+
+namespace ink {
+class TextSource;
+}
+
+/// 后台 UTF-8 校验 task
+struct Utf8Validator {
+    static constexpr uint32_t READ_SIZE = 32 * 1024;  // 每次读取的字节数
+
+    /// 校验结果
+    struct Result {
+        bool valid;             ///< 整个文件是合法 UTF-8
+        uint32_t firstInvalid;  ///< 首个非法序列在原文件中的偏移（valid 时为文件大小）
+    };
+
+    Utf8Validator();
+    ~Utf8Validator();
+
+    // 不可拷贝
+    Utf8Validator(const Utf8Validator&) = delete;
+    Utf8Validator& operator=(const Utf8Validator&) = delete;
+
+    /// 启动校验 task。完成后写入 resultPath 并回调 owner->onValidationComplete()
+    /// @param skipBytes 跳过的文件头字节数（BOM）
+    bool start(const char* filePath, uint32_t fileSize, uint32_t mtime,
+               uint32_t skipBytes, const char* resultPath,
+               ink::TextSource* owner);
+
+    /// 停止校验 task（等待进行中的读取结束）
+    void stop();
+
+    /// 读取已缓存的校验结果；文件大小或修改时间不符时返回 false
+    static bool loadResult(const char* resultPath, uint32_t fileSize,
+                           uint32_t mtime, Result* out);
+
+private:
+    /// text.chk 文件内容
+    struct Record {
+        char magic[4];          ///< "UCHK"
+        uint32_t version;       ///< 1
+        uint32_t fileSize;      ///< 原文件大小
+        uint32_t mtime;         ///< 原文件修改时间
+        uint32_t valid;         ///< 1 合法 / 0 非法
+        uint32_t firstInvalid;  ///< 首个非法序列偏移
+    } __attribute__((packed));
+
+    static constexpr uint32_t RECORD_VERSION = 1;
+
+    TaskHandle_t taskHandle_ = nullptr;
+    ink::Job job_{"validate", ink::JobPriority::Low};
+    volatile bool exited_ = false;
+
+    char filePath_[256] = {};
+    char resultPath_[280] = {};
+    uint32_t fileSize_ = 0;
+    uint32_t mtime_ = 0;
+    uint32_t skipBytes_ = 0;
+    ink::TextSource* owner_ = nullptr;
+
+    /// 顺序读取并校验整个文件。被停止或读取失败返回 false
+    bool validate(Result* out);
+
+    /// 写入 text.chk
+    void saveResult(const Result& result);
+
+    /// FreeRTOS task 入口
+    static void taskFunc(void* param);
+
+    /// 校验主流程
+    void run();
+};
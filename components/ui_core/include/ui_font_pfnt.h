@@ -4,12 +4,14 @@
  *
  * .pfnt 文件自包含一个字体的一个字号的全部数据：header、unicode intervals、
  * glyph table 和 zlib 压缩的 4bpp bitmap。加载时将全部数据读入 PSRAM 并构建
- * 标准 EpdFont 结构体。
+ * 标准 EpdFont 结构体，同时为 BMP 范围构建码位 → glyph 的两级查找表，
+ * 测量和绘制经 pfnt_get_glyph() 以两次数组访问取得 glyph，不再二分查找。
  */
 
 #ifndef UI_FONT_PFNT_H
 #define UI_FONT_PFNT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "epdiy.h"
 
@@ -17,6 +19,13 @@
 extern "C" {
 #endif
 
+/** 编译期结构体布局检查（头文件也会被 C++ 代码包含）。 */
+#ifdef __cplusplus
+#define PFNT_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+#define PFNT_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+
 /** .pfnt 文件 magic: "PFNT" */
 #define PFNT_MAGIC 0x544E4650  /* 'P','F','N','T' little-endian */
 
@@ -42,7 +51,7 @@ typedef struct __attribute__((packed)) {
     uint8_t  reserved[10];    /**< 保留字段，全零 */
 } pfnt_header_t;
 
-_Static_assert(sizeof(pfnt_header_t) == 32, "pfnt_header_t must be 32 bytes");
+PFNT_STATIC_ASSERT(sizeof(pfnt_header_t) == 32, "pfnt_header_t must be 32 bytes");
 
 /**
  * @brief .pfnt 文件中的 glyph 条目（20 字节）。
@@ -60,7 +69,7 @@ typedef struct __attribute__((packed)) {
     uint16_t reserved;        /**< 保留，全零 */
 } pfnt_glyph_t;
 
-_Static_assert(sizeof(pfnt_glyph_t) == 20, "pfnt_glyph_t must be 20 bytes");
+PFNT_STATIC_ASSERT(sizeof(pfnt_glyph_t) == 20, "pfnt_glyph_t must be 20 bytes");
 
 /**
  * @brief .pfnt 文件中的 unicode interval 条目（12 字节）。
@@ -71,13 +80,50 @@ typedef struct __attribute__((packed)) {
     uint32_t glyph_offset;
 } pfnt_interval_t;
 
-_Static_assert(sizeof(pfnt_interval_t) == 12, "pfnt_interval_t must be 12 bytes");
+PFNT_STATIC_ASSERT(sizeof(pfnt_interval_t) == 12, "pfnt_interval_t must be 12 bytes");
+
+/** BMP 查找表的页数：每页 256 个码位，以码位高 8 位为页号。 */
+#define PFNT_PAGE_COUNT 256
+
+/**
+ * @brief pfnt_load 返回的字体对象。
+ *
+ * EpdFont 是第一个成员，pfnt_load 返回的 EpdFont* 即指向本结构体。
+ * pages[cp >> 8][cp & 0xFF] 为 glyph 下标 + 1，0 表示字体中没有该字。
+ */
+typedef struct {
+    EpdFont font;                               /**< 必须是第一个成员 */
+    const uint16_t *pages[PFNT_PAGE_COUNT];     /**< NULL 表示整页无 glyph */
+    uint16_t *page_block;                       /**< 全部页的连续分配 */
+    bool has_bmp_table;                         /**< false 时回退到二分查找 */
+} pfnt_font_t;
+
+/**
+ * @brief 按码位查找 glyph（BMP 范围 O(1)，其余回退到 epd_get_glyph）。
+ *
+ * @param font pfnt_load 返回的字体。
+ * @param cp   Unicode code point。
+ * @return glyph 指针，字体中没有该字时返回 NULL。
+ */
+static inline const EpdGlyph *pfnt_get_glyph(const EpdFont *font, uint32_t cp) {
+    const pfnt_font_t *pf = (const pfnt_font_t *)font;
+    if (cp > 0xFFFF || !pf->has_bmp_table) {
+        return epd_get_glyph(font, cp);
+    }
+    const uint16_t *page = pf->pages[cp >> 8];
+    if (!page) {
+        return NULL;
+    }
+    uint16_t index = page[cp & 0xFF];
+    return index ? &font->glyph[index - 1] : NULL;
+}
 
 /**
  * @brief 从 .pfnt 文件加载字体到 PSRAM。
  *
  * 读取整个文件内容，校验 magic 和版本，将 intervals、glyphs、bitmap 数据
- * 分配到 PSRAM，并构建 EpdFont 结构体。
+ * 分配到 PSRAM，构建 EpdFont 结构体和 BMP 查找表（只为有 glyph 的页分配，
+ * 每页 512 字节）。查找表分配失败时字体照常可用，查找回退到二分查找。
  *
  * @param path .pfnt 文件路径（如 "/fonts/noto_cjk_24.pfnt"）。
  * @return 成功返回指向 PSRAM 中 EpdFont 的指针（需用 pfnt_unload 释放），
@@ -92,6 +138,20 @@ EpdFont *pfnt_load(const char *path);
  */
 void pfnt_unload(EpdFont *font);
 
+/**
+ * @brief 字体卸载回调，在 pfnt_unload 释放内存之前调用。
+ */
+typedef void (*pfnt_unload_hook_t)(const EpdFont *font);
+
+/**
+ * @brief 注册字体卸载回调（如丢弃按字体缓存的 glyph bitmap）。
+ *
+ * 只保留一个回调，再次注册覆盖之前的回调；传 NULL 取消。
+ *
+ * @param hook 回调函数。
+ */
+void pfnt_set_unload_hook(pfnt_unload_hook_t hook);
+
 /**
  * @brief 仅读取 .pfnt 文件头，获取字号信息。
  *
@@ -15,6 +15,7 @@
 #include <string.h>
 
 #include "epdiy.h"
+#include "ui_font_pfnt.h"
 #include <miniz.h>
 
 /** 物理 framebuffer 尺寸（横屏）。 */
@@ -315,7 +316,7 @@ static uint8_t *decompress_glyph(const EpdFont *font, const EpdGlyph *glyph,
 static void draw_char_logical(uint8_t *fb, const EpdFont *font,
                                int *cursor_x, int cursor_y,
                                uint32_t cp, uint8_t fg) {
-    const EpdGlyph *glyph = epd_get_glyph(font, cp);
+    const EpdGlyph *glyph = pfnt_get_glyph(font, cp);
     if (!glyph) return;
 
     uint16_t w = glyph->width;
@@ -396,7 +397,7 @@ int ui_canvas_measure_text(const EpdFont *font, const char *text) {
     uint32_t cp;
     while ((cp = next_codepoint(&text)) != 0) {
         if (cp == '\n') break;
-        const EpdGlyph *glyph = epd_get_glyph(font, cp);
+        const EpdGlyph *glyph = pfnt_get_glyph(font, cp);
         if (glyph) {
             width += glyph->advance_x;
         }
@@ -15,6 +15,80 @@
 
 static const char *TAG = "pfnt";
 
+static pfnt_unload_hook_t s_unload_hook = NULL;
+
+void pfnt_set_unload_hook(pfnt_unload_hook_t hook) {
+    s_unload_hook = hook;
+}
+
+/**
+ * @brief 构建 BMP 码位 → glyph 下标的两级查找表。
+ *
+ * @return 成功返回 true；glyph 数超出 16 位下标或分配失败时返回 false。
+ */
+static bool build_bmp_table(pfnt_font_t *pf, uint32_t glyph_count) {
+    if (glyph_count >= 0xFFFF) {
+        return false;
+    }
+    const EpdUnicodeInterval *intervals = pf->font.intervals;
+
+    /* 统计有 glyph 的页。 */
+    bool used[PFNT_PAGE_COUNT] = { false };
+    uint16_t *pages[PFNT_PAGE_COUNT] = { NULL };
+    int page_count = 0;
+    for (uint32_t i = 0; i < pf->font.interval_count; i++) {
+        if (intervals[i].first > 0xFFFF) {
+            continue;
+        }
+        uint32_t last = intervals[i].last > 0xFFFF ? 0xFFFF : intervals[i].last;
+        for (uint32_t page = intervals[i].first >> 8; page <= last >> 8; page++) {
+            if (!used[page]) {
+                used[page] = true;
+                page_count++;
+            }
+        }
+    }
+
+    if (page_count > 0) {
+        uint16_t *block = heap_caps_calloc((size_t)page_count * 256,
+                                           sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+        if (!block) {
+            return false;
+        }
+        uint16_t *next = block;
+        for (int page = 0; page < PFNT_PAGE_COUNT; page++) {
+            if (used[page]) {
+                pages[page] = next;
+                next += 256;
+            }
+        }
+        pf->page_block = block;
+    }
+
+    /* 填入 glyph 下标 + 1，越界的条目（损坏文件）视为无 glyph。 */
+    for (uint32_t i = 0; i < pf->font.interval_count; i++) {
+        uint32_t first = intervals[i].first;
+        if (first > 0xFFFF) {
+            continue;
+        }
+        uint32_t last = intervals[i].last > 0xFFFF ? 0xFFFF : intervals[i].last;
+        for (uint32_t cp = first; cp <= last; cp++) {
+            uint32_t index = intervals[i].offset + (cp - first);
+            if (index >= glyph_count) {
+                break;
+            }
+            pages[cp >> 8][cp & 0xFF] = (uint16_t)(index + 1);
+        }
+    }
+    for (int page = 0; page < PFNT_PAGE_COUNT; page++) {
+        pf->pages[page] = pages[page];
+    }
+
+    ESP_LOGI(TAG, "BMP glyph table: %d pages, %d bytes", page_count,
+             page_count * 256 * (int)sizeof(uint16_t));
+    return true;
+}
+
 int pfnt_read_header(const char *path, pfnt_header_t *header) {
     if (!path || !header) {
         return -1;
@@ -83,7 +157,8 @@ EpdFont *pfnt_load(const char *path) {
     }
 
     /* 在 PSRAM 中分配内存。 */
-    EpdFont *font = heap_caps_calloc(1, sizeof(EpdFont), MALLOC_CAP_SPIRAM);
+    pfnt_font_t *pf = heap_caps_calloc(1, sizeof(pfnt_font_t), MALLOC_CAP_SPIRAM);
+    EpdFont *font = pf ? &pf->font : NULL;
     EpdUnicodeInterval *intervals = heap_caps_malloc(
         intervals_size, MALLOC_CAP_SPIRAM);
     EpdGlyph *glyphs = heap_caps_malloc(
@@ -157,6 +232,11 @@ EpdFont *pfnt_load(const char *path) {
     font->ascender = hdr.ascender;
     font->descender = hdr.descender;
 
+    pf->has_bmp_table = build_bmp_table(pf, hdr.glyph_count);
+    if (!pf->has_bmp_table) {
+        ESP_LOGW(TAG, "No BMP glyph table for %s, using binary search", path);
+    }
+
     ESP_LOGI(TAG, "Loaded %s: %lupx, %lu glyphs, %ld bytes bitmap",
              path, (unsigned long)hdr.font_size_px,
              (unsigned long)hdr.glyph_count, bitmap_size);
@@ -175,7 +255,11 @@ void pfnt_unload(EpdFont *font) {
     if (!font) {
         return;
     }
-    /* bitmap, glyph, intervals 均为 PSRAM 分配，需逐一释放。 */
+    if (s_unload_hook) {
+        s_unload_hook(font);
+    }
+    /* bitmap, glyph, intervals, 查找表均为 PSRAM 分配，需逐一释放。 */
+    heap_caps_free(((pfnt_font_t *)font)->page_block);
     heap_caps_free((void *)font->bitmap);
     heap_caps_free((void *)font->glyph);
     heap_caps_free((void *)font->intervals);
@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include "epdiy.h"
+#include "ui_font_pfnt.h"
 
 /* ── UTF-8 辅助 ── */
 
@@ -120,7 +121,7 @@ static int layout_line(const char *text, int max_width, const EpdFont *font) {
             return (int)(p - text) + byte_len;
         }
 
-        const EpdGlyph *glyph = epd_get_glyph(font, cp);
+        const EpdGlyph *glyph = pfnt_get_glyph(font, cp);
         int char_width = glyph ? glyph->advance_x : 0;
 
         /* 超出行宽 */
@@ -9,11 +9,10 @@
 
 #include <cstdio>
 #include <cstring>
-#include <sys/stat.h>
 
 extern "C" {
+#include "book_cache.h"
 #include "esp_log.h"
-#include "mbedtls/md5.h"
 #include "ui_font.h"
 #include "ui_icon.h"
 }
@@ -85,6 +84,10 @@ ReaderViewController::ReaderViewController(ink::Application& app,
 }
 
 ReaderViewController::~ReaderViewController() {
+    // view 树晚于 textSource_ 析构：先停止后台分页并释放游标
+    if (contentView_) {
+        contentView_->setTextSource(nullptr);
+    }
     textSource_.close();
 }
 
@@ -211,12 +214,23 @@ void ReaderViewController::loadView() {
 void ReaderViewController::viewDidLoad() {
     ESP_LOGI(TAG, "viewDidLoad — %s", book_.name);
 
-    // 计算缓存目录路径
+    // 按文件指纹定位并创建缓存目录
     computeCacheDirPath();
 
-    // 创建缓存目录（先确保父目录存在）
-    mkdir("/sdcard/.cache", 0755);
-    mkdir(cacheDirPath_, 0755);
+    // 后台校验发现文件不是 UTF-8 时数据源切换到 GBK 转换，
+    // 重绘时 ReaderContentView 按新内容重新分页
+    textSource_.setContentChangedCallback([this]() {
+        contentView_->setNeedsDisplay();
+        updateFooter();
+        app_.postEvent(ink::Event::makeTimer(kStatusTimerId));
+    });
+
+    // 绘制或翻页时所需文本块未缓存：后台预读载入后重绘，
+    // 并唤醒主循环完成待完成的翻页
+    textSource_.setReadReadyCallback([this]() {
+        contentView_->setNeedsDisplay();
+        app_.postEvent(ink::Event::makeTimer(kStatusTimerId));
+    });
 
     // 打开 TextSource
     if (!textSource_.open(book_.path, cacheDirPath_)) {
@@ -227,11 +241,17 @@ void ReaderViewController::viewDidLoad() {
         return;
     }
 
+    // 缓存超出预算时在后台淘汰最久未读的书籍，不占用打开时间
+    book_cache_trim_async();
+
     // 恢复阅读进度（必须在 setTextSource 之前，因为它会触发页索引加载）
     reading_progress_t progress = {};
     settings_store_load_progress(book_.path, &progress);
     if (progress.byte_offset > 0) {
-        contentView_->setInitialByteOffset(progress.byte_offset);
+        // 总大小等于原文件文本大小的进度是按 UTF-8 直接读取时保存的，
+        // 若本次已改为 GBK 转换则须换算
+        bool raw = progress.total_bytes == textSource_.rawTextSize();
+        contentView_->setInitialByteOffset(progress.byte_offset, raw);
     }
 
     // 设置文本源到 ReaderContentView（触发页索引加载/构建）
@@ -259,7 +279,7 @@ void ReaderViewController::viewWillDisappear() {
     if (!contentView_) return;
 
     reading_progress_t progress = {};
-    progress.byte_offset = contentView_->currentPageOffset();
+    progress.byte_offset = contentView_->readingOffset();
     progress.total_bytes = textSource_.totalSize();
     progress.current_page = static_cast<uint32_t>(contentView_->currentPage());
     progress.total_pages = contentView_->isPageIndexComplete()
@@ -276,6 +296,11 @@ void ReaderViewController::handleEvent(const ink::Event& event) {
         } else if (event.swipe.direction == ink::SwipeDirection::Right) {
             prevPage();
         }
+    } else if (event.type == ink::EventType::Timer &&
+               event.timer.timerId == kStatusTimerId) {
+        if (contentView_ && contentView_->retryPendingTurn()) {
+            pageTurned();
+        }
     }
 }
 
@@ -284,22 +309,12 @@ void ReaderViewController::handleEvent(const ink::Event& event) {
 // ════════════════════════════════════════════════════════════════
 
 void ReaderViewController::computeCacheDirPath() {
-    uint8_t hash[16];
-    mbedtls_md5_context ctx;
-    mbedtls_md5_init(&ctx);
-    mbedtls_md5_starts(&ctx);
-    mbedtls_md5_update(&ctx, reinterpret_cast<const uint8_t*>(book_.path),
-                       strlen(book_.path));
-    mbedtls_md5_finish(&ctx, hash);
-    mbedtls_md5_free(&ctx);
-
-    char hexStr[33];
-    for (int i = 0; i < 16; i++) {
-        snprintf(hexStr + i * 2, 3, "%02x", hash[i]);
+    // 以大小、修改时间和采样块为键：改名或移动后沿用原缓存，
+    // 同路径文件被替换则换用新目录
+    if (book_cache_open(book_.path, cacheDirPath_,
+                        sizeof(cacheDirPath_)) != ESP_OK) {
+        ESP_LOGW(TAG, "Cache dir unavailable for %s", book_.path);
     }
-
-    snprintf(cacheDirPath_, sizeof(cacheDirPath_),
-             "/sdcard/.cache/%s", hexStr);
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -316,20 +331,18 @@ void ReaderViewController::nextPage() {
     if (total > 0 && current + 1 >= total) return;
 
     contentView_->setCurrentPage(current + 1);
-    applyPageFlipRefresh();
-
-    // 翻页后 header 浮层需要重绘（内容重绘会覆盖其区域）
-    if (headerOverlay_ && !headerOverlay_->isHidden()) {
-        headerOverlay_->setNeedsDisplay();
-    }
-
-    updateFooter();
+    // 文本未缓存时翻页留到载入后完成
+    if (!contentView_->turnPending()) pageTurned();
 }
 
 void ReaderViewController::prevPage() {
     if (!contentView_ || contentView_->currentPage() <= 0) return;
 
     contentView_->setCurrentPage(contentView_->currentPage() - 1);
+    if (!contentView_->turnPending()) pageTurned();
+}
+
+void ReaderViewController::pageTurned() {
     applyPageFlipRefresh();
 
     // 翻页后 header 浮层需要重绘（内容重绘会覆盖其区域）
@@ -57,6 +57,9 @@ private:
     /// 翻到上一页
     void prevPage();
 
+    /// 翻页完成后：刷新屏幕、重绘 header 浮层、更新页脚
+    void pageTurned();
+
     /// 翻页刷新：普通用 Quality，每 N 次触发 W>B>GL 消残影
     void applyPageFlipRefresh();
 
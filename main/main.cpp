@@ -17,6 +17,7 @@ extern "C" {
 #include "board.h"
 #include "gt911.h"
 #include "sd_storage.h"
+#include "book_cache.h"
 #include "settings_store.h"
 #include "battery.h"
 #include "ui_font.h"
@@ -71,6 +72,9 @@ extern "C" void app_main(void) {
     if (sd_storage_mount(&sd_cfg) != ESP_OK) {
         ESP_LOGW(TAG, "SD card not available");
     }
+    if (book_cache_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Book cache init failed");
+    }
 
     /* 4. 电池 ADC 初始化 */
     ESP_LOGI(TAG, "[4/7] Battery ADC init...");
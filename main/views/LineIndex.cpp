@@ -0,0 +1,429 @@
+/**
+ * @file LineIndex.cpp
+ * @brief LineIndex 实现 — 行边界索引 + SD 卡持久化。
+ */
+
+#include "views/LineIndex.h"
+
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <unistd.h>
+
+extern "C" {
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+}
+
+static const char* TAG = "LineIndex";
+
+LineIndex::LineIndex() = default;
+
+LineIndex::~LineIndex() {
+    closeLog();
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeLocked();
+}
+
+// ════════════════════════════════════════════════════════════════
+//  块编码
+// ════════════════════════════════════════════════════════════════
+
+// 块格式：count u8 | first u32 LE | minDelta varint | bits u8 | packed
+// 第 i 行（i ≥ 1）的增量为 (行首偏移差 << 1 | 段落结尾标记)，packed 为
+// count-1 个 (增量 - minDelta)，每个 bits 位，低位在前。first 为首行原始条目。
+
+static inline uint32_t lineDelta(uint32_t prev, uint32_t line) {
+    uint32_t offset = line & ~LineIndex::kParagraphEnd;
+    uint32_t prevOffset = prev & ~LineIndex::kParagraphEnd;
+    return ((offset - prevOffset) << 1) | (line >> 31);
+}
+
+uint32_t LineIndex::encodeBlock(const uint32_t* lines, uint8_t* out) {
+    uint32_t minDelta = UINT32_MAX;
+    uint32_t maxDelta = 0;
+    for (uint32_t i = 1; i < kBlockLines; i++) {
+        uint32_t d = lineDelta(lines[i - 1], lines[i]);
+        minDelta = std::min(minDelta, d);
+        maxDelta = std::max(maxDelta, d);
+    }
+
+    uint8_t bits = 0;
+    while (bits < 32 && ((maxDelta - minDelta) >> bits) != 0) bits++;
+
+    uint32_t n = 0;
+    out[n++] = static_cast<uint8_t>(kBlockLines);
+    for (int i = 0; i < 4; i++) out[n++] = static_cast<uint8_t>(lines[0] >> (i * 8));
+    for (uint32_t v = minDelta;; v >>= 7) {
+        if (v < 0x80) {
+            out[n++] = static_cast<uint8_t>(v);
+            break;
+        }
+        out[n++] = static_cast<uint8_t>(v | 0x80);
+    }
+    out[n++] = bits;
+
+    uint64_t acc = 0;
+    uint32_t accBits = 0;
+    for (uint32_t i = 1; i < kBlockLines && bits > 0; i++) {
+        acc |= static_cast<uint64_t>(lineDelta(lines[i - 1], lines[i]) - minDelta) << accBits;
+        accBits += bits;
+        while (accBits >= 8) {
+            out[n++] = static_cast<uint8_t>(acc);
+            acc >>= 8;
+            accBits -= 8;
+        }
+    }
+    if (accBits > 0) out[n++] = static_cast<uint8_t>(acc);
+    return n;
+}
+
+uint32_t LineIndex::decodeBlock(const uint8_t* in, uint32_t avail, uint32_t* lines) {
+    if (avail < 7) return 0;
+    uint32_t n = 0;
+    if (in[n++] != kBlockLines) return 0;
+
+    uint32_t line = 0;
+    for (int i = 0; i < 4; i++) line |= static_cast<uint32_t>(in[n++]) << (i * 8);
+
+    uint32_t minDelta = 0;
+    for (int shift = 0;; shift += 7) {
+        if (n >= avail || shift > 28) return 0;
+        uint8_t b = in[n++];
+        minDelta |= static_cast<uint32_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    if (n >= avail) return 0;
+    uint32_t bits = in[n++];
+    if (bits > 32) return 0;
+    uint32_t packedBytes = ((kBlockLines - 1) * bits + 7) / 8;
+    if (avail - n < packedBytes) return 0;
+
+    const uint64_t mask = (bits == 32) ? 0xFFFFFFFFull : ((1ull << bits) - 1);
+    uint64_t acc = 0;
+    uint32_t accBits = 0;
+    uint32_t offset = line & ~kParagraphEnd;
+    lines[0] = line;
+    for (uint32_t i = 1; i < kBlockLines; i++) {
+        while (accBits < bits) {
+            acc |= static_cast<uint64_t>(in[n++]) << accBits;
+            accBits += 8;
+        }
+        uint32_t d = minDelta + static_cast<uint32_t>(acc & mask);
+        acc >>= bits;
+        accBits -= bits;
+        offset += d >> 1;
+        lines[i] = offset | ((d & 1) ? kParagraphEnd : 0);
+    }
+    return n;
+}
+
+bool LineIndex::flushTailLocked() {
+    uint8_t buf[kMaxBlockBytes];
+    uint32_t size = encodeBlock(tail_, buf);
+    if (chunks_.empty() || chunks_.back().used + size > kChunkBytes) {
+        auto* data = static_cast<uint8_t*>(heap_caps_malloc(kChunkBytes, MALLOC_CAP_SPIRAM));
+        if (!data) return false;
+        chunks_.push_back({data, encodedLines_, 0});
+    }
+    Chunk& chunk = chunks_.back();
+    memcpy(chunk.data + chunk.used, buf, size);
+    chunk.used += size;
+    encodedLines_ += kBlockLines;
+    tailCount_ = 0;
+    return true;
+}
+
+bool LineIndex::appendLocked(uint32_t line) {
+    if (tailCount_ == kBlockLines && !flushTailLocked()) return false;
+    tail_[tailCount_++] = line;
+    return true;
+}
+
+void LineIndex::freeLocked() {
+    for (const Chunk& chunk : chunks_) heap_caps_free(chunk.data);
+    // 释放目录本身：一本大书的目录也有数 KB
+    std::vector<Chunk>().swap(chunks_);
+    encodedLines_ = 0;
+    tailCount_ = 0;
+}
+
+LineIndex::Cursor LineIndex::cursorAt(uint32_t line) const {
+    Cursor cursor = {static_cast<uint32_t>(chunks_.size()), 0, encodedLines_, line};
+    if (line >= encodedLines_) return cursor;
+    // 最后一个首行不超过 line 的分片
+    auto it = std::upper_bound(
+        chunks_.begin(), chunks_.end(), line,
+        [](uint32_t l, const Chunk& c) { return l < c.firstLine; });
+    cursor.chunk = static_cast<uint32_t>(it - chunks_.begin()) - 1;
+    cursor.block = chunks_[cursor.chunk].firstLine;
+    return cursor;
+}
+
+uint32_t LineIndex::nextBatch(Cursor* cursor, uint32_t* out) const {
+    while (cursor->chunk < chunks_.size()) {
+        const Chunk& chunk = chunks_[cursor->chunk];
+        if (cursor->pos >= chunk.used) {
+            cursor->chunk++;
+            cursor->pos = 0;
+            continue;
+        }
+        uint32_t block[kBlockLines];
+        uint32_t size = decodeBlock(chunk.data + cursor->pos, chunk.used - cursor->pos, block);
+        if (size == 0) {
+            ESP_LOGE(TAG, "Corrupt block at line %u", (unsigned)cursor->block);
+            return 0;
+        }
+        cursor->pos += size;
+        uint32_t first = cursor->block;
+        cursor->block += kBlockLines;
+        if (cursor->line >= cursor->block) continue;  // 整块在起点之前
+
+        uint32_t skip = cursor->line - first;
+        uint32_t n = kBlockLines - skip;
+        memcpy(out, block + skip, n * sizeof(uint32_t));
+        cursor->line = cursor->block;
+        return n;
+    }
+
+    // 尾块
+    uint32_t total = countLocked();
+    if (cursor->line >= total) return 0;
+    uint32_t skip = cursor->line - encodedLines_;
+    uint32_t n = tailCount_ - skip;
+    memcpy(out, tail_ + skip, n * sizeof(uint32_t));
+    cursor->line = total;
+    return n;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  增量构建
+// ════════════════════════════════════════════════════════════════
+
+void LineIndex::begin(uint32_t layoutHash) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeLocked();
+    layoutHash_ = layoutHash;
+    complete_ = false;
+    if (log_) {
+        fclose(log_);
+        log_ = nullptr;
+    }
+    loggedCount_ = 0;
+}
+
+void LineIndex::appendLines(const uint32_t* lines, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < count; i++) {
+        if (!appendLocked(lines[i])) {
+            ESP_LOGE(TAG, "Out of memory, dropping %u lines",
+                     (unsigned)(count - i));
+            return;
+        }
+    }
+}
+
+void LineIndex::markComplete() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    complete_ = true;
+    ESP_LOGI(TAG, "Index complete: %u lines in %u chunks", (unsigned)countLocked(),
+             (unsigned)chunks_.size());
+}
+
+void LineIndex::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeLocked();
+    layoutHash_ = 0;
+    complete_ = false;
+    if (log_) {
+        fclose(log_);
+        log_ = nullptr;
+    }
+    loggedCount_ = 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  查询
+// ════════════════════════════════════════════════════════════════
+
+uint32_t LineIndex::lineCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return countLocked();
+}
+
+bool LineIndex::matches(uint32_t layoutHash) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return complete_ && layoutHash_ == layoutHash;
+}
+
+size_t LineIndex::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return chunks_.size() * kChunkBytes + chunks_.capacity() * sizeof(Chunk);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  SD 卡持久化
+// ════════════════════════════════════════════════════════════════
+
+bool LineIndex::load(const char* path, uint32_t textSize, uint32_t layoutHash,
+                     uint32_t resumeCount) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    FileHeader header;
+    if (fread(&header, sizeof(header), 1, f) != 1) {
+        fclose(f);
+        return false;
+    }
+
+    if (memcmp(header.magic, "LIDX", 4) != 0) {
+        ESP_LOGW(TAG, "Invalid magic in %s", path);
+        fclose(f);
+        return false;
+    }
+
+    if (header.version != CURRENT_VERSION) {
+        ESP_LOGW(TAG, "Version mismatch: %u vs %u", header.version, CURRENT_VERSION);
+        fclose(f);
+        return false;
+    }
+
+    if (header.fileSize != textSize) {
+        ESP_LOGW(TAG, "File size mismatch: %lu vs %lu",
+                 (unsigned long)header.fileSize, (unsigned long)textSize);
+        fclose(f);
+        return false;
+    }
+
+    if (header.layoutHash != layoutHash) {
+        ESP_LOGW(TAG, "Layout hash mismatch: 0x%08lx vs 0x%08lx",
+                 (unsigned long)header.layoutHash, (unsigned long)layoutHash);
+        fclose(f);
+        return false;
+    }
+
+    // 续建时只取页索引检查点对应的行，之后可能多提交的行会被覆盖
+    uint32_t count = header.lineCount;
+    if (resumeCount > 0) {
+        if (header.complete || count < resumeCount) {
+            fclose(f);
+            return false;
+        }
+        count = resumeCount;
+    } else if (!header.complete || count == 0) {
+        fclose(f);
+        return false;
+    }
+
+    // 文件按原始条目存储，逐块读入并编码
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeLocked();
+    uint32_t batch[kBlockLines];
+    uint32_t readCount = 0;
+    bool ok = true;
+    while (ok && readCount < count) {
+        uint32_t want = std::min(count - readCount, kBlockLines);
+        size_t got = fread(batch, sizeof(uint32_t), want, f);
+        for (size_t i = 0; ok && i < got; i++) ok = appendLocked(batch[i]);
+        readCount += static_cast<uint32_t>(got);
+        if (got != want) break;
+    }
+    fclose(f);
+
+    if (!ok || readCount != count) {
+        ESP_LOGE(TAG, "Incomplete read: %u / %u", (unsigned)readCount, count);
+        freeLocked();
+        complete_ = false;
+        return false;
+    }
+
+    layoutHash_ = layoutHash;
+    complete_ = resumeCount == 0;
+    loggedCount_ = count;
+    ESP_LOGI(TAG, "Loaded %u lines from %s%s", count, path,
+             complete_ ? "" : " (partial)");
+    return true;
+}
+
+bool LineIndex::checkpoint(const char* path, uint32_t textSize) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!log_) {
+        // 续建时保留已提交的行，在其后追加；否则新建
+        log_ = fopen(path, loggedCount_ > 0 ? "r+b" : "wb");
+        if (!log_) {
+            ESP_LOGE(TAG, "Failed to open %s", path);
+            return false;
+        }
+    }
+
+    // 先追加新行并落盘，再改写 header；文件存储解码后的原始条目
+    uint32_t count = countLocked();
+    bool ok = fseek(log_, sizeof(FileHeader) + loggedCount_ * sizeof(uint32_t),
+                    SEEK_SET) == 0;
+    if (ok && count > loggedCount_) {
+        uint32_t batch[kBlockLines];
+        Cursor cursor = cursorAt(loggedCount_);
+        uint32_t n;
+        while (ok && (n = nextBatch(&cursor, batch)) > 0) {
+            ok = fwrite(batch, sizeof(uint32_t), n, log_) == n;
+        }
+        ok = ok && cursor.line == count;
+    }
+    ok = ok && fflush(log_) == 0 && fsync(fileno(log_)) == 0;
+
+    if (ok) {
+        FileHeader header;
+        memcpy(header.magic, "LIDX", 4);
+        header.version = CURRENT_VERSION;
+        header.fileSize = textSize;
+        header.layoutHash = layoutHash_;
+        header.lineCount = count;
+        header.complete = complete_ ? 1 : 0;
+        ok = fseek(log_, 0, SEEK_SET) == 0 &&
+             fwrite(&header, sizeof(header), 1, log_) == 1 &&
+             fflush(log_) == 0 && fsync(fileno(log_)) == 0;
+    }
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Write error saving %s", path);
+        fclose(log_);
+        log_ = nullptr;
+        loggedCount_ = 0;
+        remove(path);
+        return false;
+    }
+
+    loggedCount_ = count;
+    if (complete_) {
+        ESP_LOGI(TAG, "Saved %u lines to %s", (unsigned)count, path);
+    }
+    return true;
+}
+
+void LineIndex::closeLog() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (log_) {
+        fclose(log_);
+        log_ = nullptr;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+//  工具
+// ════════════════════════════════════════════════════════════════
+
+uint32_t LineIndex::computeLayoutHash(uint8_t fontSize, int viewportW) {
+    // FNV-1a 32-bit hash
+    uint32_t hash = 0x811C9DC5;
+    auto mix = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 0x01000193;
+    };
+
+    mix(fontSize);
+    mix(static_cast<uint8_t>(viewportW & 0xFF));
+    mix(static_cast<uint8_t>((viewportW >> 8) & 0xFF));
+
+    return hash;
+}
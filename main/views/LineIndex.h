@@ -0,0 +1,155 @@
+/**
+ * @file LineIndex.h
+ * @brief 行边界索引 — 存储每行起始 byte offset 和段落结尾标记，支持 SD 卡持久化。
+ *
+ * 折行只取决于字体和视口宽度，行距、段间距和视口高度只影响行如何装入页。
+ * 后台分页把折出的行追加到本索引，这些参数变化时直接从行重新装页，
+ * 不必再次读取文本和测量字形。所有读写通过 mutex 保护线程安全。
+ * 与 PageIndex 在同一检查点追加写入 lines.idx，未完成的行索引可以续建。
+ *
+ * 一本大书有数十万行，内存中按 64 行分块压缩：块内记录首行条目、
+ * 最小增量和位宽，其余各行的 (行长 << 1 | 段落结尾) 减去最小增量后按
+ * 位宽紧密打包，约 1 字节/行。编码数据追加写入固定大小的 PSRAM 分片，
+ * 追加从不搬移已有数据；行只按顺序遍历，不需要跳表。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+/// 行边界索引
+class LineIndex {
+public:
+    /// 行条目中的段落结尾标记位（本行之后有段间距），低 31 位为行首偏移
+    static constexpr uint32_t kParagraphEnd = 0x80000000u;
+
+    LineIndex();
+    ~LineIndex();
+
+    // ── 增量构建 ──
+
+    /// 清空索引并开始为 layoutHash 对应的排版构建（后台 task 调用）
+    void begin(uint32_t layoutHash);
+
+    /// 按顺序追加一批行条目（后台 task 调用）
+    void appendLines(const uint32_t* lines, size_t count);
+
+    /// 标记索引构建完成
+    void markComplete();
+
+    /// 清空索引（数据源或字体变更时调用）
+    void clear();
+
+    // ── 查询 ──
+
+    /// 当前已知的行数
+    uint32_t lineCount() const;
+
+    /// 索引已覆盖全文且由 layoutHash 对应的排版构建
+    bool matches(uint32_t layoutHash) const;
+
+    /// 加锁后按顺序以 (lines, count) 分批调用 fn（每批至多 kBlockLines 行），
+    /// 用于一次遍历全部行
+    template <typename Fn>
+    void withLines(Fn fn) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint32_t batch[kBlockLines];
+        Cursor cursor = cursorAt(0);
+        uint32_t n;
+        while ((n = nextBatch(&cursor, batch)) > 0) fn(batch, n);
+    }
+
+    /// 索引占用的堆内存（编码分片 + 分片目录），用于日志
+    size_t memoryBytes() const;
+
+    // ── SD 卡持久化 ──
+
+    /// 从文件加载索引（校验 magic + version + file_size + layout_hash）
+    /// @param resumeCount 非 0 时加载未完成索引的前 resumeCount 行用于续建
+    /// @return true 如果缓存有效并成功加载
+    bool load(const char* path, uint32_t textSize, uint32_t layoutHash,
+              uint32_t resumeCount = 0);
+
+    /// 检查点：把上次检查点之后的新行追加到文件，再改写 header 并落盘
+    bool checkpoint(const char* path, uint32_t textSize);
+
+    /// 关闭检查点文件
+    void closeLog();
+
+    // ── 工具 ──
+
+    /// 计算折行参数哈希值（FNV-1a 32-bit），只包含影响折行的字体和视口宽度
+    static uint32_t computeLayoutHash(uint8_t fontSize, int viewportW);
+
+private:
+    static constexpr uint32_t kBlockLines = 64;    ///< 每块行数
+    static constexpr uint32_t kChunkBytes = 4096;  ///< 编码数据分片大小
+    /// 单块编码上限：count + first + minDelta(varint) + bits + 63 × 32 bit
+    static constexpr uint32_t kMaxBlockBytes = 1 + 4 + 5 + 1 + (kBlockLines - 1) * 4;
+
+    /// 编码数据分片（PSRAM）：块不跨分片
+    struct Chunk {
+        uint8_t* data;
+        uint32_t firstLine;  ///< 分片内第一块的首行序号
+        uint32_t used;       ///< 已用字节
+    };
+
+    /// 顺序遍历位置
+    struct Cursor {
+        uint32_t chunk;  ///< 当前分片
+        uint32_t pos;    ///< 分片内下一块的位置
+        uint32_t block;  ///< 下一块的首行序号
+        uint32_t line;   ///< 下一个要输出的行序号
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Chunk> chunks_;     ///< 分片目录（每 4KB 分片一项）
+    uint32_t encodedLines_ = 0;     ///< 已编码的行数（kBlockLines 的整数倍）
+    uint32_t tail_[kBlockLines];    ///< 尚未编码的尾块
+    uint32_t tailCount_ = 0;
+    uint32_t layoutHash_ = 0;
+    bool complete_ = false;
+
+    FILE* log_ = nullptr;       ///< 检查点文件（构建期间保持打开）
+    uint32_t loggedCount_ = 0;  ///< 文件中已提交的行数
+
+    /// 持久化文件 header
+    struct FileHeader {
+        char magic[4];        // "LIDX"
+        uint16_t version;     // 2
+        uint32_t fileSize;    // 原始文本大小（用于校验）
+        uint32_t layoutHash;  // 折行参数哈希
+        uint32_t lineCount;   // 已提交的行数
+        uint8_t complete;     // 1 = 索引覆盖全文
+    } __attribute__((packed));
+
+    static constexpr uint16_t CURRENT_VERSION = 2;
+
+    /// 追加一行（持锁调用）；内存不足时丢弃并返回 false
+    bool appendLocked(uint32_t line);
+
+    /// 编码尾块并追加到分片（持锁调用）
+    bool flushTailLocked();
+
+    /// 释放编码数据（持锁调用）
+    void freeLocked();
+
+    /// 行数（持锁调用）
+    uint32_t countLocked() const { return encodedLines_ + tailCount_; }
+
+    /// 定位到第 line 行所在的块（持锁调用）
+    Cursor cursorAt(uint32_t line) const;
+
+    /// 从 cursor 处取下一批行写入 out，返回行数，遍历结束时返回 0（持锁调用）
+    uint32_t nextBatch(Cursor* cursor, uint32_t* out) const;
+
+    /// 把 kBlockLines 个行条目编码为一块，返回字节数
+    static uint32_t encodeBlock(const uint32_t* lines, uint8_t* out);
+
+    /// 解码一块到 lines，返回消耗的字节数；数据非法时返回 0
+    static uint32_t decodeBlock(const uint8_t* in, uint32_t avail, uint32_t* lines);
+};
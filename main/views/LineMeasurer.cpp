@@ -0,0 +1,230 @@
+/**
+ * @file LineMeasurer.cpp
+ * @brief 折行测量内核实现。
+ */
+
+#include "views/LineMeasurer.h"
+
+#include <cstring>
+
+extern "C" {
+#include "esp_log.h"
+#include "ui_font_pfnt.h"
+}
+
+static const char* TAG = "LineMeasurer";
+
+// ════════════════════════════════════════════════════════════════
+//  宽度表
+// ════════════════════════════════════════════════════════════════
+
+LineMeasurer::LineMeasurer() = default;
+
+void LineMeasurer::setFont(const EpdFont* font) {
+    font_ = font;
+    buildTables();
+}
+
+void LineMeasurer::buildTables() {
+    memset(asciiWidth_, 0, sizeof(asciiWidth_));
+    memset(blockAdvance_, 0, sizeof(blockAdvance_));
+    if (!font_) return;
+
+    for (uint32_t cp = 0; cp < 128; cp++) {
+        asciiWidth_[cp] = static_cast<uint16_t>(charWidth(cp));
+    }
+
+    // 组宽表：整组 64 个码位宽度相同才记录，快路径据此跳过逐字测量
+    int uniform = 0;
+    for (uint32_t blk = 0; blk < kBlockCount; blk++) {
+        uint32_t base = blk << 6;
+        int w = charWidth(base);
+        if (w <= 0 || w > 255) continue;
+        uint32_t i = 1;
+        while (i < 64 && charWidth(base + i) == w) i++;
+        if (i < 64) continue;
+        blockAdvance_[blk] = static_cast<uint8_t>(w);
+        uniform++;
+    }
+
+    ESP_LOGI(TAG, "Glyph width tables built (%d of %d blocks fixed-advance)",
+             uniform, kBlockCount);
+}
+
+int LineMeasurer::charWidth(uint32_t codepoint) const {
+    if (!font_) return 0;
+    const EpdGlyph* glyph = pfnt_get_glyph(font_, codepoint);
+    if (codepoint > 0xFFFF) {
+        return glyph ? glyph->advance_x : font_->advance_y / 2;
+    }
+    // BMP 范围：零宽 glyph 与缺字同样按半个行高计，宽度上限 255
+    // （与已缓存的分页结果一致）
+    int w = glyph ? glyph->advance_x : 0;
+    if (w > 255) w = 255;
+    return w > 0 ? w : font_->advance_y / 2;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  glyph run
+// ════════════════════════════════════════════════════════════════
+
+int LineMeasurer::shapeLine(const char* buf, uint32_t start, uint32_t end,
+                            std::vector<ink::PositionedGlyph>& out) const {
+    if (!font_) return 0;
+    size_t first = out.size();
+    int x = 0;
+    uint32_t pos = start;
+    while (pos < end && buf[pos] != '\0' && buf[pos] != '\n') {
+        int cLen = utf8CharLen(static_cast<uint8_t>(buf[pos]));
+        if (pos + cLen > end) break;
+        uint32_t cp = decodeCodepoint(buf + pos, cLen);
+        pos += cLen;
+
+        const EpdGlyph* glyph = pfnt_get_glyph(font_, cp);
+        if (!glyph) continue;
+        if (glyph->width > 0 && glyph->height > 0) {
+            out.push_back({glyph, static_cast<int16_t>(x)});
+        }
+        x += glyph->advance_x;
+    }
+    return static_cast<int>(out.size() - first);
+}
+
+// ════════════════════════════════════════════════════════════════
+//  UTF-8
+// ════════════════════════════════════════════════════════════════
+
+int LineMeasurer::utf8CharLen(uint8_t byte) {
+    if (byte < 0x80) return 1;
+    if ((byte & 0xE0) == 0xC0) return 2;
+    if ((byte & 0xF0) == 0xE0) return 3;
+    if ((byte & 0xF8) == 0xF0) return 4;
+    return 1;
+}
+
+uint32_t LineMeasurer::decodeCodepoint(const char* p, int len) {
+    uint8_t b = static_cast<uint8_t>(p[0]);
+    uint32_t cp = 0;
+    if (b < 0x80) {
+        cp = b;
+    } else if ((b & 0xE0) == 0xC0) {
+        cp = b & 0x1F;
+        for (int i = 1; i < len; i++)
+            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
+    } else if ((b & 0xF0) == 0xE0) {
+        cp = b & 0x0F;
+        for (int i = 1; i < len; i++)
+            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
+    } else if ((b & 0xF8) == 0xF0) {
+        cp = b & 0x07;
+        for (int i = 1; i < len; i++)
+            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
+    } else {
+        cp = 0xFFFD;
+    }
+    return cp;
+}
+
+// ════════════════════════════════════════════════════════════════
+//  折行
+// ════════════════════════════════════════════════════════════════
+
+uint32_t LineMeasurer::breakLine(const char* buf, uint32_t len, uint32_t pos,
+                                 int maxWidth, Line* line) const {
+    // 处理 \r\n 或 \n 开头的空行
+    if (buf[pos] == '\n') {
+        *line = {pos, pos, true};
+        return pos + 1;
+    }
+    if (buf[pos] == '\r') {
+        *line = {pos, pos, true};
+        pos++;
+        if (pos < len && buf[pos] == '\n') pos++;
+        return pos;
+    }
+
+    // 折行：行首字符不论宽度都放入，之后放不下即折行
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(buf);
+    uint32_t lineStart = pos;
+    int lineWidth = 0;
+
+    while (pos < len) {
+        uint8_t b = p[pos];
+
+        if (b < 0x80) {
+            // ASCII 段：查 128 项表，不解码
+            while (b != '\n' && b != '\r') {
+                int cw = asciiWidth_[b];
+                if (lineWidth + cw > maxWidth && pos > lineStart) break;
+                lineWidth += cw;
+                if (++pos >= len) break;
+                b = p[pos];
+                if (b >= 0x80) break;
+            }
+            // 停在换行符或放不下的 ASCII 字符上：本行结束
+            if (pos < len && p[pos] < 0x80) break;
+            continue;
+        }
+
+        if ((b & 0xF0) == 0xE0) {
+            if (pos + 3 > len) break;
+            // codepoint 的高 10 位即组号
+            uint32_t blk = ((b & 0x0F) << 6) | (p[pos + 1] & 0x3F);
+            int adv = blockAdvance_[blk];
+            if (adv > 0) {
+                // 等宽段：剩余宽度能放下 fit 个字，只确认后续字符同宽
+                int room = maxWidth - lineWidth;
+                if (room < adv && pos > lineStart) break;
+                int fit = room / adv;
+                if (fit < 1) fit = 1;
+                int n = 1;
+                uint32_t q = pos + 3;
+                while (n < fit && q + 3 <= len && (p[q] & 0xF0) == 0xE0 &&
+                       blockAdvance_[((p[q] & 0x0F) << 6) | (p[q + 1] & 0x3F)] == adv) {
+                    q += 3;
+                    n++;
+                }
+                lineWidth += n * adv;
+                pos = q;
+                continue;
+            }
+            // 三字节快速解码
+            int cw = charWidth((blk << 6) | (p[pos + 2] & 0x3F));
+            if (lineWidth + cw > maxWidth && pos > lineStart) break;
+            lineWidth += cw;
+            pos += 3;
+            continue;
+        }
+
+        // 通用路径：两字节、四字节和非法首字节
+        int cLen = utf8CharLen(b);
+        if (pos + cLen > len) break;
+
+        int cw = charWidth(decodeCodepoint(buf + pos, cLen));
+        if (lineWidth + cw > maxWidth && pos > lineStart) break;
+
+        lineWidth += cw;
+        pos += cLen;
+    }
+
+    // 安全措施：至少前进一个字符
+    if (pos == lineStart && pos < len) {
+        pos += utf8CharLen(static_cast<uint8_t>(buf[pos]));
+    }
+
+    uint32_t lineEnd = pos;
+
+    // 判断是否段落结尾
+    bool isParagraphEnd = false;
+    if (pos < len && buf[pos] == '\n') {
+        isParagraphEnd = true;
+        pos++;
+    } else if (pos < len && buf[pos] == '\r') {
+        isParagraphEnd = true;
+        pos++;
+        if (pos < len && buf[pos] == '\n') pos++;
+    }
+
+    *line = {lineStart, lineEnd, isParagraphEnd};
+    return pos;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file LineMeasurer.h
+ * @brief 折行测量内核 — 按字体的字符宽度把 UTF-8 文本折成行。
+ *
+ * 通用路径逐字符解码 codepoint、经字体的 BMP 查找表（pfnt_get_glyph）
+ * 取宽度、累加并比较。
+ * 中文字体的汉字几乎全部同宽，按此设置三条快路径，折行结果与通用路径
+ * 逐字节一致：
+ *  - 等宽段：以 64 个码位为一组（三字节 UTF-8 的首字节 + 第二字节相同），
+ *    整组宽度相同的记入 1KB 组宽表。遇到等宽组的字符时，用行内剩余宽度
+ *    除以字宽算出还能放下几个字，只需确认后续字符落在同宽的组里，
+ *    不再逐字解码、查表、累加和比较
+ *  - ASCII 段：128 项宽度表，不解码，连续的 ASCII 字符在内层循环中处理
+ *  - 三字节 UTF-8：直接拼出 codepoint，不经过通用解码循环
+ *
+ * 宽度表在 setFont() 中构建，之后只读，多个折行 worker 可并发调用
+ * breakLine()。
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ink_ui/core/Canvas.h"
+
+extern "C" {
+#include "epdiy.h"
+}
+
+/// 折行测量内核
+class LineMeasurer {
+public:
+    /// 一行的布局信息
+    struct Line {
+        uint32_t start;           ///< 起始字节偏移
+        uint32_t end;             ///< 结束字节偏移（不含）
+        bool isParagraphEnd;      ///< 本行之后有段间距
+    };
+
+    LineMeasurer();
+
+    LineMeasurer(const LineMeasurer&) = delete;
+    LineMeasurer& operator=(const LineMeasurer&) = delete;
+
+    /// 设置字体并重建快路径的宽度表（不得与 breakLine() 并发）
+    void setFont(const EpdFont* font);
+
+    /// 从 buf[pos] 折出一行（pos 为行首），line 中的偏移相对于 buf
+    /// @return 下一行的行首（已跳过段落结尾的换行符）
+    uint32_t breakLine(const char* buf, uint32_t len, uint32_t pos,
+                       int maxWidth, Line* line) const;
+
+    /// 把 buf[start, end) 解码为已定位的 glyph 追加到 out：笔位置从 0 起
+    /// 按 advance_x 累加，缺字不前进，无像素的 glyph（空格）只前进不输出，
+    /// 与 Canvas::drawTextN 的绘制结果一致
+    /// @return 追加的 glyph 数
+    int shapeLine(const char* buf, uint32_t start, uint32_t end,
+                  std::vector<ink::PositionedGlyph>& out) const;
+
+    /// 获取字符宽度（BMP 范围为 O(1) 查表）
+    int charWidth(uint32_t codepoint) const;
+
+    /// 计算 UTF-8 字符字节长度
+    static int utf8CharLen(uint8_t byte);
+
+    /// 解码 UTF-8 codepoint
+    static uint32_t decodeCodepoint(const char* p, int len);
+
+private:
+    /// 组宽表的组数：BMP 按 64 个码位分组
+    static constexpr int kBlockCount = 0x10000 >> 6;
+
+    /// 构建 ASCII 宽度表和组宽表
+    void buildTables();
+
+    const EpdFont* font_ = nullptr;
+
+    /// ASCII 字符宽度（与 charWidth() 一致）
+    uint16_t asciiWidth_[128] = {};
+
+    /// 每组 64 个码位的公共宽度，组内宽度不一或超出 1-255 时为 0
+    uint8_t blockAdvance_[kBlockCount] = {};
+};
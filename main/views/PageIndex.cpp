@@ -8,72 +8,300 @@
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
+#include <unistd.h>
 
 extern "C" {
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 }
 
 static const char* TAG = "PageIndex";
 
 PageIndex::PageIndex() = default;
 
+PageIndex::~PageIndex() {
+    closeLog();
+    freeStorage();
+}
+
+// ════════════════════════════════════════════════════════════════
+//  块编码
+// ════════════════════════════════════════════════════════════════
+
+// 块格式：count u8 | first u32 LE | minDelta varint | bits u8 | packed
+// packed 为 count-1 个 (delta - minDelta)，每个 bits 位，低位在前
+
+uint32_t PageIndex::encodeBlock(const uint32_t* offsets, uint32_t count, uint8_t* out) {
+    uint32_t minDelta = UINT32_MAX;
+    uint32_t maxDelta = 0;
+    for (uint32_t i = 1; i < count; i++) {
+        uint32_t d = offsets[i] - offsets[i - 1];
+        minDelta = std::min(minDelta, d);
+        maxDelta = std::max(maxDelta, d);
+    }
+    if (count < 2) minDelta = maxDelta = 0;
+
+    uint8_t bits = 0;
+    while (bits < 32 && ((maxDelta - minDelta) >> bits) != 0) bits++;
+
+    uint32_t n = 0;
+    out[n++] = static_cast<uint8_t>(count);
+    for (int i = 0; i < 4; i++) out[n++] = static_cast<uint8_t>(offsets[0] >> (i * 8));
+    for (uint32_t v = minDelta;; v >>= 7) {
+        if (v < 0x80) {
+            out[n++] = static_cast<uint8_t>(v);
+            break;
+        }
+        out[n++] = static_cast<uint8_t>(v | 0x80);
+    }
+    out[n++] = bits;
+
+    uint64_t acc = 0;
+    uint32_t accBits = 0;
+    for (uint32_t i = 1; i < count && bits > 0; i++) {
+        acc |= static_cast<uint64_t>(offsets[i] - offsets[i - 1] - minDelta) << accBits;
+        accBits += bits;
+        while (accBits >= 8) {
+            out[n++] = static_cast<uint8_t>(acc);
+            acc >>= 8;
+            accBits -= 8;
+        }
+    }
+    if (accBits > 0) out[n++] = static_cast<uint8_t>(acc);
+    return n;
+}
+
+uint32_t PageIndex::decodeBlock(const uint8_t* in, uint32_t avail, uint32_t* offsets,
+                                uint32_t* count) {
+    if (avail < 7) return 0;
+    uint32_t n = 0;
+    uint32_t c = in[n++];
+    if (c == 0 || c > kBlockPages) return 0;
+
+    uint32_t offset = 0;
+    for (int i = 0; i < 4; i++) offset |= static_cast<uint32_t>(in[n++]) << (i * 8);
+
+    uint32_t minDelta = 0;
+    for (int shift = 0;; shift += 7) {
+        if (n >= avail || shift > 28) return 0;
+        uint8_t b = in[n++];
+        minDelta |= static_cast<uint32_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    if (n >= avail) return 0;
+    uint32_t bits = in[n++];
+    if (bits > 32) return 0;
+    uint32_t packedBytes = ((c - 1) * bits + 7) / 8;
+    if (avail - n < packedBytes) return 0;
+
+    const uint64_t mask = (bits == 32) ? 0xFFFFFFFFull : ((1ull << bits) - 1);
+    uint64_t acc = 0;
+    uint32_t accBits = 0;
+    offsets[0] = offset;
+    for (uint32_t i = 1; i < c; i++) {
+        while (accBits < bits) {
+            acc |= static_cast<uint64_t>(in[n++]) << accBits;
+            accBits += 8;
+        }
+        offset += minDelta + static_cast<uint32_t>(acc & mask);
+        acc >>= bits;
+        accBits -= bits;
+        offsets[i] = offset;
+    }
+    *count = c;
+    return n;
+}
+
 // ════════════════════════════════════════════════════════════════
 //  增量构建
 // ════════════════════════════════════════════════════════════════
 
 void PageIndex::addPage(uint32_t offset) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    offsets_.push_back(offset);
+    uint32_t count = pageCount_.load(std::memory_order_relaxed);
+    uint32_t block = blockCount_.load(std::memory_order_relaxed);
+    if (count - block * kBlockPages == kBlockPages) {
+        if (!flushTail()) {
+            ESP_LOGE(TAG, "Out of memory, dropping page at %lu", (unsigned long)offset);
+            return;
+        }
+        block++;
+    }
+    tail_[block & 1][count % kBlockPages].store(offset, std::memory_order_relaxed);
+    pageCount_.store(count + 1, std::memory_order_release);
+}
+
+bool PageIndex::flushTail() {
+    uint32_t block = blockCount_.load(std::memory_order_relaxed);
+    uint32_t offsets[kBlockPages];
+    for (uint32_t i = 0; i < kBlockPages; i++) {
+        offsets[i] = tail_[block & 1][i].load(std::memory_order_relaxed);
+    }
+
+    // 编码数据和跳表都只追加新分片，已有数据从不搬移；块不跨分片
+    uint8_t buf[kMaxBlockBytes];
+    uint32_t size = encodeBlock(offsets, kBlockPages, buf);
+    if (!chunks_) {
+        chunks_ = static_cast<uint8_t**>(
+            heap_caps_malloc(kMaxChunks * sizeof(uint8_t*), MALLOC_CAP_SPIRAM));
+        refs_ = static_cast<BlockRef**>(
+            heap_caps_malloc(kMaxRefChunks * sizeof(BlockRef*), MALLOC_CAP_SPIRAM));
+        if (!chunks_ || !refs_) {
+            heap_caps_free(chunks_);
+            heap_caps_free(refs_);
+            chunks_ = nullptr;
+            refs_ = nullptr;
+            return false;
+        }
+    }
+    if (chunkUsed_ + size > kChunkBytes) {
+        if (chunkCount_ == kMaxChunks) return false;
+        auto* chunk = static_cast<uint8_t*>(heap_caps_malloc(kChunkBytes, MALLOC_CAP_SPIRAM));
+        if (!chunk) return false;
+        chunks_[chunkCount_++] = chunk;
+        chunkUsed_ = 0;
+    }
+    if (block == refChunkCount_ * kRefsPerChunk) {
+        if (refChunkCount_ == kMaxRefChunks) return false;
+        auto* refs = static_cast<BlockRef*>(
+            heap_caps_malloc(kRefsPerChunk * sizeof(BlockRef), MALLOC_CAP_SPIRAM));
+        if (!refs) return false;
+        refs_[refChunkCount_++] = refs;
+    }
+
+    memcpy(chunks_[chunkCount_ - 1] + chunkUsed_, buf, size);
+    BlockRef& ref = refs_[block / kRefsPerChunk][block % kRefsPerChunk];
+    ref.firstOffset = offsets[0];
+    ref.pos = (chunkCount_ - 1) * kChunkBytes + chunkUsed_;
+    chunkUsed_ += size;
+    streamBytes_ += size;
+
+    // 发布新块；之后才复用另一个尾块缓冲（上上块的），读者据块数判断是否被复用
+    blockCount_.store(block + 1, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+void PageIndex::freeStorage() {
+    for (uint32_t i = 0; i < chunkCount_; i++) heap_caps_free(chunks_[i]);
+    for (uint32_t i = 0; i < refChunkCount_; i++) heap_caps_free(refs_[i]);
+    heap_caps_free(chunks_);
+    heap_caps_free(refs_);
+    chunks_ = nullptr;
+    refs_ = nullptr;
+    chunkCount_ = 0;
+    chunkUsed_ = kChunkBytes;
+    refChunkCount_ = 0;
+    streamBytes_ = 0;
 }
 
 void PageIndex::markComplete() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    complete_ = true;
-    ESP_LOGI(TAG, "Index complete: %u pages", (unsigned)offsets_.size());
+    complete_.store(true, std::memory_order_release);
+    ESP_LOGI(TAG, "Index complete: %u pages", (unsigned)pageCount());
 }
 
 void PageIndex::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    offsets_.clear();
-    complete_ = false;
+    complete_.store(false, std::memory_order_relaxed);
+    pageCount_.store(0, std::memory_order_relaxed);
+    blockCount_.store(0, std::memory_order_relaxed);
+    freeStorage();
+    std::lock_guard<std::mutex> lock(logMutex_);
+    if (log_) {
+        fclose(log_);
+        log_ = nullptr;
+    }
+    loggedBlocks_ = 0;
+    loggedBytes_ = 0;
 }
 
 // ════════════════════════════════════════════════════════════════
-//  查询
+//  查询（不加锁）
 // ════════════════════════════════════════════════════════════════
 
 uint32_t PageIndex::pageCount() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return static_cast<uint32_t>(offsets_.size());
+    return pageCount_.load(std::memory_order_acquire);
 }
 
 uint32_t PageIndex::pageOffset(uint32_t page) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (page >= offsets_.size()) return 0;
-    return offsets_[page];
+    if (page >= pageCount_.load(std::memory_order_acquire)) return 0;
+
+    uint32_t block = page / kBlockPages;
+    for (;;) {
+        if (block < blockCount_.load(std::memory_order_acquire)) {
+            uint32_t offsets[kBlockPages];
+            uint32_t count = 0;
+            decodeStored(block, offsets, &count);
+            return offsets[page % kBlockPages];
+        }
+        uint32_t offset = tail_[block & 1][page % kBlockPages].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // 缓冲在第 block + 2 块开始填充时才被复用
+        if (blockCount_.load(std::memory_order_relaxed) < block + 2) return offset;
+    }
 }
 
 uint32_t PageIndex::findPage(uint32_t offset) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (offsets_.empty()) return 0;
+    for (;;) {
+        uint32_t blocks = blockCount_.load(std::memory_order_acquire);
+        uint32_t count = pageCount_.load(std::memory_order_acquire);
+        if (count == 0) return 0;
+
+        // 读取块数后写者又编码了新块：重新取快照
+        uint32_t tailCount = count - blocks * kBlockPages;
+        if (tailCount > kBlockPages) continue;
+
+        // 未编码的尾部
+        if (tailCount > 0) {
+            uint32_t tail[kBlockPages];
+            for (uint32_t i = 0; i < tailCount; i++) {
+                tail[i] = tail_[blocks & 1][i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (blockCount_.load(std::memory_order_relaxed) >= blocks + 2) continue;
+            if (offset >= tail[0]) {
+                auto it = std::upper_bound(tail, tail + tailCount, offset);
+                return blocks * kBlockPages + static_cast<uint32_t>(it - tail) - 1;
+            }
+        }
+        if (blocks == 0) return 0;
+
+        // 跳表二分：找到最后一个首页偏移 <= offset 的块
+        uint32_t lo = 0;
+        uint32_t hi = blocks;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (blockRef(mid).firstOffset <= offset) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == 0) return 0;
+        uint32_t block = lo - 1;
+
+        uint32_t offsets[kBlockPages];
+        uint32_t n = 0;
+        decodeStored(block, offsets, &n);
+        auto it = std::upper_bound(offsets, offsets + n, offset);
+        return block * kBlockPages + static_cast<uint32_t>(it - offsets) - 1;
+    }
+}
 
-    // 二分搜索：找到最后一个 offsets_[i] <= offset 的 i
-    auto it = std::upper_bound(offsets_.begin(), offsets_.end(), offset);
-    if (it == offsets_.begin()) return 0;
-    --it;
-    return static_cast<uint32_t>(it - offsets_.begin());
+size_t PageIndex::memoryBytes() const {
+    size_t bytes = chunkCount_ * kChunkBytes + refChunkCount_ * kRefsPerChunk * sizeof(BlockRef);
+    if (chunks_) bytes += kMaxChunks * sizeof(uint8_t*) + kMaxRefChunks * sizeof(BlockRef*);
+    return bytes;
 }
 
 bool PageIndex::isComplete() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return complete_;
+    return complete_.load(std::memory_order_acquire);
 }
 
 // ════════════════════════════════════════════════════════════════
 //  SD 卡持久化
 // ════════════════════════════════════════════════════════════════
 
-bool PageIndex::load(const char* path, uint32_t textSize, uint32_t paramsHash) {
+bool PageIndex::load(const char* path, uint32_t textSize, uint32_t paramsHash,
+                     ResumeState* resume) {
     FILE* f = fopen(path, "rb");
     if (!f) return false;
 
@@ -113,68 +341,173 @@ bool PageIndex::load(const char* path, uint32_t textSize, uint32_t paramsHash) {
         return false;
     }
 
-    if (header.pageCount == 0) {
+    if (header.pageCount == 0 || (!header.complete && !resume)) {
         fclose(f);
         return false;
     }
 
-    // 读取页偏移数组
-    std::lock_guard<std::mutex> lock(mutex_);
-    offsets_.resize(header.pageCount);
-    size_t readCount = fread(offsets_.data(), sizeof(uint32_t),
-                              header.pageCount, f);
+    // 读取编码数据区（临时缓冲），逐块解码并重新装入分片
+    auto* data = static_cast<uint8_t*>(heap_caps_malloc(header.dataBytes, MALLOC_CAP_SPIRAM));
+    if (!data) {
+        ESP_LOGE(TAG, "Cannot allocate %lu bytes", (unsigned long)header.dataBytes);
+        fclose(f);
+        return false;
+    }
+    size_t readBytes = fread(data, 1, header.dataBytes, f);
     fclose(f);
 
-    if (readCount != header.pageCount) {
-        ESP_LOGE(TAG, "Incomplete read: %zu / %u", readCount, header.pageCount);
-        offsets_.clear();
+    clear();
+
+    // 页偏移必须严格递增且落在文本内，否则视为损坏
+    bool ok = readBytes == header.dataBytes;
+    uint32_t pos = 0;
+    uint32_t prev = 0;
+    while (ok && pos < header.dataBytes && pageCount() < header.pageCount) {
+        uint32_t offsets[kBlockPages];
+        uint32_t count = 0;
+        uint32_t used = decodeBlock(data + pos, header.dataBytes - pos, offsets, &count);
+        ok = used > 0;
+        for (uint32_t i = 0; ok && i < count && pageCount() < header.pageCount; i++) {
+            ok = offsets[i] < textSize && (pageCount() == 0 || offsets[i] > prev);
+            prev = offsets[i];
+            addPage(offsets[i]);
+        }
+        pos += used;
+    }
+    heap_caps_free(data);
+
+    if (!ok || pageCount() != header.pageCount) {
+        ESP_LOGE(TAG, "Corrupt index data: %u / %u pages", (unsigned)pageCount(),
+                 (unsigned)header.pageCount);
+        clear();
         return false;
     }
 
-    complete_ = true;
-    ESP_LOGI(TAG, "Loaded %u pages from %s", header.pageCount, path);
+    complete_.store(header.complete != 0, std::memory_order_release);
+    // 完整块的编码与文件数据区前缀逐字节相同，续建时从其后改写尾块
+    {
+        std::lock_guard<std::mutex> lock(logMutex_);
+        loggedBlocks_ = blockCount_.load(std::memory_order_relaxed);
+        loggedBytes_ = streamBytes_;
+    }
+    if (!header.complete) {
+        resume->nextSlice = header.nextSlice;
+        resume->lineCount = header.lineCount;
+        resume->remainingHeight = header.remainingHeight;
+        resume->pageLines = header.pageLines;
+    }
+    ESP_LOGI(TAG, "Loaded %u pages from %s%s", header.pageCount, path,
+             header.complete ? "" : " (partial)");
     return true;
 }
 
-bool PageIndex::save(const char* path, uint32_t textSize,
-                     uint32_t paramsHash) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (!complete_) {
+bool PageIndex::save(const char* path, uint32_t textSize, uint32_t paramsHash) {
+    if (!isComplete()) {
         ESP_LOGW(TAG, "Cannot save incomplete index");
         return false;
     }
 
-    FILE* f = fopen(path, "wb");
-    if (!f) {
-        ESP_LOGE(TAG, "Failed to create %s", path);
-        return false;
+    // 整体重写：丢弃已有文件内容
+    closeLog();
+    {
+        std::lock_guard<std::mutex> lock(logMutex_);
+        loggedBlocks_ = 0;
+        loggedBytes_ = 0;
     }
+    bool ok = checkpoint(path, textSize, paramsHash, ResumeState());
+    closeLog();
+    return ok;
+}
 
-    FileHeader header;
+bool PageIndex::checkpoint(const char* path, uint32_t textSize,
+                           uint32_t paramsHash, const ResumeState& resume) {
+    std::lock_guard<std::mutex> lock(logMutex_);
+
+    // 写者线程调用：块数、页数和尾块不会在此期间变化
+    uint32_t blocks = blockCount_.load(std::memory_order_relaxed);
+    uint32_t count = pageCount_.load(std::memory_order_relaxed);
+    uint32_t tailCount = count - blocks * kBlockPages;
+    bool complete = complete_.load(std::memory_order_relaxed);
+
+    if (!log_) {
+        // 续建时保留已提交的块，在其后追加；否则新建
+        log_ = fopen(path, loggedBytes_ > 0 ? "r+b" : "wb");
+        if (!log_) {
+            ESP_LOGE(TAG, "Failed to open %s", path);
+            return false;
+        }
+    }
+
+    FileHeader header = {};
     memcpy(header.magic, "PIDX", 4);
     header.version = CURRENT_VERSION;
     header.fileSize = textSize;
     header.paramsHash = paramsHash;
-    header.pageCount = static_cast<uint32_t>(offsets_.size());
 
-    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
-    if (ok) {
-        ok = fwrite(offsets_.data(), sizeof(uint32_t),
-                     offsets_.size(), f) == offsets_.size();
+    // 先追加新的完整块和尾块（尾块每次改写）并落盘，再改写 header：
+    // header 中的页数和数据区长度不会超过已写入的数据
+    bool ok = fseek(log_, sizeof(header) + loggedBytes_, SEEK_SET) == 0;
+    for (uint32_t b = loggedBlocks_; ok && b < blocks; b++) {
+        uint32_t offsets[kBlockPages];
+        uint32_t count = 0;
+        uint32_t size = decodeStored(b, offsets, &count);
+        ok = fwrite(blockData(blockRef(b)), 1, size, log_) == size;
     }
-
-    fclose(f);
+    uint32_t tailBytes = 0;
+    if (ok && tailCount > 0) {
+        uint32_t tail[kBlockPages];
+        for (uint32_t i = 0; i < tailCount; i++) {
+            tail[i] = tail_[blocks & 1][i].load(std::memory_order_relaxed);
+        }
+        uint8_t buf[kMaxBlockBytes];
+        tailBytes = encodeBlock(tail, tailCount, buf);
+        ok = fwrite(buf, 1, tailBytes, log_) == tailBytes;
+    }
+    ok = ok && fflush(log_) == 0 && fsync(fileno(log_)) == 0;
 
     if (ok) {
-        ESP_LOGI(TAG, "Saved %u pages to %s",
-                 (unsigned)offsets_.size(), path);
-    } else {
+        header.pageCount = count;
+        header.dataBytes = streamBytes_ + tailBytes;
+        header.complete = complete ? 1 : 0;
+        if (!complete) {
+            header.nextSlice = resume.nextSlice;
+            header.lineCount = resume.lineCount;
+            header.remainingHeight = resume.remainingHeight;
+            header.pageLines = resume.pageLines;
+        }
+        ok = fseek(log_, 0, SEEK_SET) == 0 &&
+             fwrite(&header, sizeof(header), 1, log_) == 1 &&
+             fflush(log_) == 0 && fsync(fileno(log_)) == 0;
+    }
+
+    if (!ok) {
         ESP_LOGE(TAG, "Write error saving %s", path);
+        fclose(log_);
+        log_ = nullptr;
+        loggedBlocks_ = 0;
+        loggedBytes_ = 0;
         remove(path);
+        return false;
     }
 
-    return ok;
+    loggedBlocks_ = blocks;
+    loggedBytes_ = streamBytes_;
+    if (complete) {
+        ESP_LOGI(TAG, "Saved %u pages (%lu bytes) to %s", (unsigned)count,
+                 (unsigned long)header.dataBytes, path);
+    } else {
+        ESP_LOGD(TAG, "Checkpoint: %u pages, next slice %lu", (unsigned)count,
+                 (unsigned long)resume.nextSlice);
+    }
+    return true;
+}
+
+void PageIndex::closeLog() {
+    std::lock_guard<std::mutex> lock(logMutex_);
+    if (log_) {
+        fclose(log_);
+        log_ = nullptr;
+    }
 }
 
 // ════════════════════════════════════════════════════════════════
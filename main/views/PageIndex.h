@@ -3,23 +3,49 @@
  * @brief 页边界索引 — 存储每页起始 byte offset，支持 SD 卡持久化。
  *
  * 后台 task 通过 addPage() 增量构建，主线程通过 pageOffset()/findPage()
- * 查询。所有读写通过 mutex 保护线程安全。
+ * 查询。单写多读：构建方法只由一个线程调用，查询不加锁——已编码的块
+ * 只追加、从不修改，块数和页数以原子变量发布；尚未编码的尾块用两个
+ * 缓冲交替存放，读者读取后复查块数，缓冲被复用时改读已编码的块。
+ * clear() 和 load() 要求没有并发的读者和写者（分页 task 已停止）。
+ *
+ * 构建中按检查点把新页追加到 pages.idx，header 记录续建状态：
+ * 中途离开的书再次打开时从最后一个检查点继续分页。
+ *
+ * 存储按 64 页分块压缩：块内记录首页偏移、最小页长和位宽，
+ * 其余页长减去最小页长后按位宽紧密打包（帧参考编码）。编码数据
+ * 追加写入固定大小的 PSRAM 分片，跳表记录每块首页偏移和数据位置，
+ * 追加从不搬移已有数据。查询先在跳表二分定位块，再解码块内至多 64 页。
+ * pages.idx 的数据区使用同一编码。
  */
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <mutex>
-#include <vector>
 
 /// 页边界索引
 class PageIndex {
 public:
+    /// 未完成索引的续建状态（分页方定义，随检查点写入 header）
+    struct ResumeState {
+        uint32_t nextSlice = 0;        ///< 下一个待装页的文本切片
+        uint32_t lineCount = 0;        ///< 行索引中已提交的行数
+        int32_t remainingHeight = 0;   ///< 最后一页的剩余高度
+        int32_t pageLines = 0;         ///< 最后一页已装入的行数
+    };
+
     PageIndex();
+    ~PageIndex();
+
+    PageIndex(const PageIndex&) = delete;
+    PageIndex& operator=(const PageIndex&) = delete;
 
     // ── 增量构建 ──
 
-    /// 添加一页的起始 byte offset（后台 task 调用）
+    /// 添加一页的起始 byte offset（唯一的写者调用）
     void addPage(uint32_t offset);
 
     /// 标记索引构建完成
@@ -39,17 +65,32 @@ public:
     /// 二分搜索找到包含该 byte offset 的页码
     uint32_t findPage(uint32_t offset) const;
 
+    /// 索引占用的堆内存（编码分片 + 跳表），用于日志（写者调用）
+    size_t memoryBytes() const;
+
     /// 索引是否已覆盖全文
     bool isComplete() const;
 
     // ── SD 卡持久化 ──
 
     /// 从文件加载索引（校验 magic + version + file_size + params_hash）
-    /// @return true 如果缓存有效并成功加载
-    bool load(const char* path, uint32_t textSize, uint32_t paramsHash);
+    /// @param resume 非 nullptr 时也接受未完成的索引，写入其续建状态
+    /// @return true 如果缓存有效并成功加载；isComplete() 区分是否完成
+    bool load(const char* path, uint32_t textSize, uint32_t paramsHash,
+              ResumeState* resume = nullptr);
 
     /// 保存索引到文件（仅 isComplete 时允许）
-    bool save(const char* path, uint32_t textSize, uint32_t paramsHash) const;
+    bool save(const char* path, uint32_t textSize, uint32_t paramsHash);
+
+    /// 检查点：把上次检查点之后的新页追加到文件，再改写 header
+    /// （页数、是否完成、续建状态）并落盘。首次调用时创建文件，
+    /// 从未完成的缓存续建时在已有内容之后追加。
+    /// @param resume 未完成时的续建状态；索引已完成时忽略
+    bool checkpoint(const char* path, uint32_t textSize, uint32_t paramsHash,
+                    const ResumeState& resume);
+
+    /// 关闭检查点文件
+    void closeLog();
 
     // ── 工具 ──
 
@@ -59,18 +100,80 @@ public:
                                       int viewportW, int viewportH);
 
 private:
-    mutable std::mutex mutex_;
-    std::vector<uint32_t> offsets_;  // PSRAM 分配
-    bool complete_ = false;
+    static constexpr uint32_t kBlockPages = 64;    ///< 每块页数（跳表粒度）
+    static constexpr uint32_t kChunkBytes = 4096;  ///< 编码数据分片大小
+    static constexpr uint32_t kRefsPerChunk = 256; ///< 每个跳表分片的块数
+    static constexpr uint32_t kMaxChunks = 512;    ///< 编码数据分片上限（约 150 万页）
+    static constexpr uint32_t kMaxRefChunks = 128; ///< 跳表分片上限（约 200 万页）
+    /// 单块编码上限：count + first + minDelta(varint) + bits + 63 × 32 bit
+    static constexpr uint32_t kMaxBlockBytes = 1 + 4 + 5 + 1 + (kBlockPages - 1) * 4;
+
+    /// 跳表条目：块首页偏移 + 编码数据位置
+    struct BlockRef {
+        uint32_t firstOffset;  ///< 块内第一页的起始 byte offset
+        uint32_t pos;          ///< 分片号 × kChunkBytes + 分片内偏移
+    };
+
+    std::mutex logMutex_;  ///< 保护检查点文件（写者与主线程的 closeLog）
+    std::atomic<bool> complete_{false};
+
+    // 读者可见：blockCount_ / pageCount_ 以 release 发布，此前写入的
+    // 分片、跳表项和尾块条目对 acquire 读取的读者可见
+    std::atomic<uint32_t> blockCount_{0};  ///< 已编码的完整块数
+    std::atomic<uint32_t> pageCount_{0};   ///< 总页数
+    std::atomic<uint32_t> tail_[2][kBlockPages] = {};  ///< 第 b 块编码前存放在 tail_[b & 1]
+
+    // 固定容量的分片目录（PSRAM，首次编码时分配），追加分片不搬移目录
+    uint8_t** chunks_ = nullptr;       ///< 编码数据分片（块不跨分片）
+    BlockRef** refs_ = nullptr;        ///< 跳表分片
+
+    // 只由写者访问
+    uint32_t chunkCount_ = 0;
+    uint32_t chunkUsed_ = kChunkBytes; ///< 最后一个数据分片已用字节
+    uint32_t refChunkCount_ = 0;
+    uint32_t streamBytes_ = 0;         ///< 完整块编码的总字节数（= 文件数据区前缀）
+
+    FILE* log_ = nullptr;         ///< 检查点文件（构建期间保持打开）
+    uint32_t loggedBlocks_ = 0;   ///< 文件中已提交的完整块数
+    uint32_t loggedBytes_ = 0;    ///< 文件中已提交的完整块字节数
 
     /// 持久化文件 header
     struct FileHeader {
-        char magic[4];        // "PIDX"
-        uint16_t version;     // 1
-        uint32_t fileSize;    // 原始文本大小（用于校验）
-        uint32_t paramsHash;  // 排版参数哈希
-        uint32_t pageCount;   // 页数
+        char magic[4];            // "PIDX"
+        uint16_t version;         // 3
+        uint32_t fileSize;        // 原始文本大小（用于校验）
+        uint32_t paramsHash;      // 排版参数哈希
+        uint32_t pageCount;       // 已提交的页数
+        uint32_t dataBytes;       // 数据区（编码块序列）字节数
+        uint8_t complete;         // 1 = 索引覆盖全文
+        uint32_t nextSlice;       // 续建状态（见 ResumeState）
+        uint32_t lineCount;
+        int32_t remainingHeight;
+        int32_t pageLines;
     } __attribute__((packed));
 
-    static constexpr uint16_t CURRENT_VERSION = 1;
+    static constexpr uint16_t CURRENT_VERSION = 3;
+
+    /// 把 count 个递增偏移编码为一块，返回字节数
+    static uint32_t encodeBlock(const uint32_t* offsets, uint32_t count, uint8_t* out);
+
+    /// 解码一块到 offsets（至多 kBlockPages 个），返回消耗的字节数；数据非法时返回 0
+    static uint32_t decodeBlock(const uint8_t* in, uint32_t avail, uint32_t* offsets,
+                                uint32_t* count);
+
+    const BlockRef& blockRef(uint32_t block) const {
+        return refs_[block / kRefsPerChunk][block % kRefsPerChunk];
+    }
+    const uint8_t* blockData(const BlockRef& ref) const {
+        return chunks_[ref.pos / kChunkBytes] + ref.pos % kChunkBytes;
+    }
+    /// 解码第 block 块（调用方已确认 block < blockCount_），返回编码字节数
+    uint32_t decodeStored(uint32_t block, uint32_t* offsets, uint32_t* count) const {
+        const BlockRef& ref = blockRef(block);
+        return decodeBlock(blockData(ref), kChunkBytes - ref.pos % kChunkBytes, offsets, count);
+    }
+
+    /// 把尾块（第 blockCount_ 块）编码追加到分片并发布
+    bool flushTail();
+    void freeStorage();
 };
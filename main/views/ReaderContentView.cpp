@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "ink_ui/core/Canvas.h"
+#include "ink_ui/core/GlyphCache.h"
 #include "text_source/TextSource.h"
 
 extern "C" {
@@ -27,7 +28,7 @@ ReaderContentView::ReaderContentView() {
 
 ReaderContentView::~ReaderContentView() {
     stopPaginateTask();
-    freeWidthCache();
+    stopPrewarmTask();
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -35,25 +36,42 @@ ReaderContentView::~ReaderContentView() {
 // ════════════════════════════════════════════════════════════════
 
 void ReaderContentView::setTextSource(ink::TextSource* source) {
+    // 先停止后台分页和预热，它们的游标绑定在旧数据源上
+    stopPaginateTask();
+    stopPrewarmTask();
+    anchored_ = false;
+    anchorPages_.clear();
+    renderCursor_.bind(source);
     textSource_ = source;
+    contentVersion_ = source ? source->contentVersion() : 0;
     invalidatePages();
+    lineIndex_.clear();
 }
 
 void ReaderContentView::setFont(const EpdFont* font) {
+    // 后台 task 使用字体和宽度表，重建前先停止
+    stopPaginateTask();
+    stopPrewarmTask();
     font_ = font;
-    buildWidthCache();
+    measurer_.setFont(font);
     invalidatePages();
+    lineIndex_.clear();
 }
 
 void ReaderContentView::setLineSpacing(uint8_t spacing10x) {
     if (spacing10x < 10) spacing10x = 10;
     if (spacing10x > 25) spacing10x = 25;
+    // 先停止后台 task：中途离开的检查点须按旧参数保存
+    stopPaginateTask();
+    stopPrewarmTask();
     lineSpacing10x_ = spacing10x;
     invalidatePages();
 }
 
 void ReaderContentView::setParagraphSpacing(uint8_t px) {
     if (px > 24) px = 24;
+    stopPaginateTask();
+    stopPrewarmTask();
     paragraphSpacing_ = px;
     invalidatePages();
 }
@@ -73,8 +91,20 @@ void ReaderContentView::setStatusCallback(std::function<void()> callback) {
 
 void ReaderContentView::invalidatePages() {
     stopPaginateTask();
+    stopPrewarmTask();
+    // 临时页码在重新分页后无意义：按当前页起始位置重新定位
+    if (anchored_) {
+        uint32_t offset = anchorPages_[anchorPage_];
+        if (offset > 0 && !hasInitialByteOffset_) {
+            setInitialByteOffset(offset);
+        }
+        anchored_ = false;
+        anchorPages_.clear();
+    }
+    pendingTurn_ = 0;
     pageIndex_.clear();
     paginateStarted_ = false;
+    drawnPage_.offset = UINT32_MAX;
     setNeedsDisplay();
 }
 
@@ -88,10 +118,22 @@ int ReaderContentView::totalPages() const {
 }
 
 int ReaderContentView::currentPage() const {
+    if (anchored_) {
+        uint32_t offset = anchorPages_[anchorPage_];
+        return pageIndex_.isComplete()
+                   ? static_cast<int>(pageIndex_.findPage(offset))
+                   : provisionalPage(offset);
+    }
     return currentPage_;
 }
 
 void ReaderContentView::setCurrentPage(int page) {
+    pendingTurn_ = 0;
+    if (anchored_) {
+        setAnchoredPage(page);
+        return;
+    }
+
     uint32_t count = pageIndex_.pageCount();
     if (count == 0) return;
 
@@ -103,9 +145,33 @@ void ReaderContentView::setCurrentPage(int page) {
             // 索引已完成，不能超出
             page = maxPage;
         } else if (textSource_ && page == maxPage + 1) {
-            // 顺序翻到超出已知范围：用 layoutPage 即时扩展一页
             uint32_t lastOffset = pageIndex_.pageOffset(static_cast<uint32_t>(maxPage));
-            PageLayout layout = layoutPage(lastOffset);
+            if (paginateTask_ && !paginateComplete_) {
+                // 页索引只由分页 task 写入：从最后一个已知页起锚定分页，
+                // 索引追上后翻页时切回全局页码
+                anchorPages_.assign(1, lastOffset);
+                anchorPage_ = 0;
+                anchored_ = true;
+                ink::ReadStatus status = extendAnchorForward();
+                if (status != ink::ReadStatus::Ok) {
+                    anchored_ = false;
+                    anchorPages_.clear();
+                    if (status == ink::ReadStatus::Pending) pendingTurn_ = 1;
+                    return;
+                }
+                anchorPage_ = 1;
+                textSource_->reportAccess(anchorPages_[1], ink::ReadDirection::Forward);
+                setNeedsDisplay();
+                return;
+            }
+            // 分页 task 未运行：用 layoutPage 即时扩展一页，文本未缓存时
+            // 留在当前页，载入后重试
+            PageLayout layout;
+            if (layoutPage(renderCursor_, lastOffset, &layout) ==
+                ink::ReadStatus::Pending) {
+                pendingTurn_ = page - currentPage_;
+                return;
+            }
             if (layout.endOffset > lastOffset) {
                 pageIndex_.addPage(layout.endOffset);
                 // 现在 maxPage 已经增加了
@@ -118,12 +184,26 @@ void ReaderContentView::setCurrentPage(int page) {
     }
 
     if (page != currentPage_) {
+        // 告知 TextSource 阅读方向，后台预读沿该方向提前加载文本块
+        if (textSource_) {
+            textSource_->reportAccess(
+                pageIndex_.pageOffset(static_cast<uint32_t>(page)),
+                page > currentPage_ ? ink::ReadDirection::Forward
+                                    : ink::ReadDirection::Backward);
+        }
         currentPage_ = page;
         setNeedsDisplay();
     }
 }
 
+bool ReaderContentView::retryPendingTurn() {
+    if (pendingTurn_ == 0) return false;
+    setCurrentPage(currentPage() + pendingTurn_);
+    return pendingTurn_ == 0;
+}
+
 uint32_t ReaderContentView::currentPageOffset() const {
+    if (anchored_) return anchorPages_[anchorPage_];
     if (pageIndex_.pageCount() == 0) return 0;
     return pageIndex_.pageOffset(static_cast<uint32_t>(currentPage_));
 }
@@ -133,9 +213,20 @@ int ReaderContentView::pageForByteOffset(uint32_t offset) const {
     return static_cast<int>(pageIndex_.findPage(offset));
 }
 
-void ReaderContentView::setInitialByteOffset(uint32_t offset) {
+void ReaderContentView::setInitialByteOffset(uint32_t offset, bool raw) {
     initialByteOffset_ = offset;
     hasInitialByteOffset_ = true;
+    initialOffsetRaw_ = raw;
+}
+
+uint32_t ReaderContentView::readingOffset() const {
+    uint32_t offset = hasInitialByteOffset_ ? initialByteOffset_
+                                            : currentPageOffset();
+    if (!textSource_) return offset;
+    // 切换编码之前得到的 offset 都是原始 offset
+    bool raw = (hasInitialByteOffset_ && initialOffsetRaw_) ||
+               textSource_->contentVersion() != contentVersion_;
+    return raw ? textSource_->translateRawOffset(offset) : offset;
 }
 
 bool ReaderContentView::isPageIndexComplete() const {
@@ -159,107 +250,286 @@ float ReaderContentView::pageIndexProgress() const {
 }
 
 // ════════════════════════════════════════════════════════════════
-//  统一布局引擎
+//  锚定分页
 // ════════════════════════════════════════════════════════════════
 
-int ReaderContentView::lineHeight() const {
-    if (!font_) return 0;
-    int lh = font_->advance_y * lineSpacing10x_ / 10;
-    if (lh < font_->advance_y) lh = font_->advance_y;
-    return lh;
+bool ReaderContentView::enterAnchor(uint32_t offset) {
+    if (!textSource_ || !font_) return false;
+
+    if (pageIndexCovers(offset)) {
+        currentPage_ = static_cast<int>(pageIndex_.findPage(offset));
+        hasInitialByteOffset_ = false;
+        return true;
+    }
+
+    uint32_t total = textSource_->totalSize();
+    if (total > 0 && offset >= total) offset = total - 1;
+
+    // 折行与页从哪里开始无关：从段落起点折行得到的行与全局分页一致，
+    // 取包含 offset 的行作为第一页起点
+    uint32_t paraStart;
+    std::vector<uint32_t> lines;
+    if (paragraphStartBefore(offset, &paraStart) != ink::ReadStatus::Ok ||
+        collectLines(paraStart, offset + 1, &lines) != ink::ReadStatus::Ok ||
+        lines.empty()) {
+        return false;
+    }
+
+    anchorPages_.assign(1, lines.back() & ~kLineParaEnd);
+    anchorPage_ = 0;
+    anchored_ = true;
+    hasInitialByteOffset_ = false;
+    extendAnchorForward();  // 文本未缓存时留到翻页时再扩展
+
+    ESP_LOGI(TAG, "Anchored at offset %lu (line %lu), provisional page %d",
+             (unsigned long)offset, (unsigned long)anchorPages_[0],
+             currentPage());
+    return true;
 }
 
-void ReaderContentView::buildWidthCache() {
-    freeWidthCache();
-    if (!font_) return;
+void ReaderContentView::setAnchoredPage(int page) {
+    int delta = page - currentPage();
+    if (delta == 0) return;
+
+    uint32_t start = anchorPages_[anchorPage_];
+    if (delta < 0 && start == 0) return;
+
+    // 全局页索引已覆盖：向后取包含本页末尾的页，向前取包含本页起点
+    // 前一字节的页，切换时不跳过文本
+    uint32_t probe = start - 1;
+    if (delta > 0) {
+        ink::ReadStatus status = extendAnchorForward();
+        if (status != ink::ReadStatus::Ok) {
+            if (status == ink::ReadStatus::Pending) pendingTurn_ = delta;
+            return;
+        }
+        probe = anchorPages_[anchorPage_ + 1];
+    }
+    if (pageIndexCovers(probe)) {
+        int target = static_cast<int>(pageIndex_.findPage(probe)) +
+                     (delta > 0 ? delta - 1 : delta + 1);
+        anchored_ = false;
+        anchorPages_.clear();
+        currentPage_ = static_cast<int>(pageIndex_.findPage(start));
+        ESP_LOGI(TAG, "Anchor resolved: page %d", target);
+        setNeedsDisplay();
+        setCurrentPage(target);
+        return;
+    }
 
-    glyphWidthCache_ = static_cast<uint8_t*>(
-        heap_caps_malloc(65536, MALLOC_CAP_SPIRAM));
-    if (!glyphWidthCache_) {
-        ESP_LOGW(TAG, "Failed to allocate glyph width cache (64KB PSRAM)");
+    // 所需文本未缓存时留在当前页（已装出的临时页保留），载入后重试
+    int startPage = anchorPage_;
+    int remaining = delta;
+    ink::ReadStatus status = ink::ReadStatus::Ok;
+    for (; remaining > 0; remaining--) {
+        status = extendAnchorForward();
+        if (status != ink::ReadStatus::Ok) break;
+        anchorPage_++;
+    }
+    for (; remaining < 0; remaining++) {
+        if (anchorPage_ > 0) {
+            anchorPage_--;
+            continue;
+        }
+        uint32_t first = anchorPages_[0];
+        uint32_t prev;
+        status = previousPageStart(first, &prev);
+        if (status != ink::ReadStatus::Ok || prev >= first) break;
+        anchorPages_.insert(anchorPages_.begin(), prev);
+        startPage++;
+    }
+    if (status == ink::ReadStatus::Pending) {
+        anchorPage_ = startPage;
+        pendingTurn_ = delta;
         return;
     }
-    memset(glyphWidthCache_, 0, 65536);
 
-    // 遍历 font 的所有 intervals，填入每个 glyph 的 advance_x
-    const EpdUnicodeInterval* intervals = font_->intervals;
-    for (uint32_t i = 0; i < font_->interval_count; i++) {
-        uint32_t first = intervals[i].first;
-        uint32_t last = intervals[i].last;
-        uint32_t offset = intervals[i].offset;
-        // 只处理 BMP 范围
-        if (first > 0xFFFF) continue;
-        if (last > 0xFFFF) last = 0xFFFF;
-        for (uint32_t cp = first; cp <= last; cp++) {
-            uint16_t ax = font_->glyph[offset + (cp - first)].advance_x;
-            glyphWidthCache_[cp] = ax > 255 ? 255 : static_cast<uint8_t>(ax);
+    uint32_t offset = anchorPages_[anchorPage_];
+    if (offset != start) {
+        textSource_->reportAccess(offset, offset > start
+                                              ? ink::ReadDirection::Forward
+                                              : ink::ReadDirection::Backward);
+        setNeedsDisplay();
+    }
+}
+
+ink::ReadStatus ReaderContentView::extendAnchorForward() {
+    if (anchorPage_ + 1 < static_cast<int>(anchorPages_.size())) {
+        return ink::ReadStatus::Ok;
+    }
+
+    uint32_t start = anchorPages_.back();
+    PageLayout layout;
+    ink::ReadStatus status = layoutPage(renderCursor_, start, &layout);
+    if (status != ink::ReadStatus::Ok) return status;
+    uint32_t total = textSource_->totalSize();
+    if (layout.endOffset <= start) return ink::ReadStatus::Unavailable;
+    if (total > 0 && layout.endOffset >= total) return ink::ReadStatus::Unavailable;
+    anchorPages_.push_back(layout.endOffset);
+    return ink::ReadStatus::Ok;
+}
+
+bool ReaderContentView::pageIndexCovers(uint32_t offset) const {
+    if (pageIndex_.isComplete()) return true;
+    // 已知页之后还有页开始，包含 offset 的页才确定
+    uint32_t count = pageIndex_.pageCount();
+    return count > 0 && pageIndex_.pageOffset(count - 1) > offset;
+}
+
+int ReaderContentView::provisionalPage(uint32_t offset) const {
+    if (offset == 0) return 0;
+
+    uint32_t bytesPerPage = 0;
+    uint32_t count = pageIndex_.pageCount();
+    if (count > 1) {
+        bytesPerPage = pageIndex_.pageOffset(count - 1) / (count - 1);
+    } else if (anchorPages_.size() > 1) {
+        bytesPerPage = (anchorPages_.back() - anchorPages_.front()) /
+                       static_cast<uint32_t>(anchorPages_.size() - 1);
+    }
+    if (bytesPerPage == 0) return 1;
+
+    // 非首页的页码至少为 1，保证可以向前翻页
+    int page = static_cast<int>(offset / bytesPerPage);
+    return page > 0 ? page : 1;
+}
+
+ink::ReadStatus ReaderContentView::previousPageStart(uint32_t end,
+                                                     uint32_t* out) {
+    int maxHeight = cachedViewportH_ > 0 ? cachedViewportH_ : bounds().h;
+    int lh = lineHeight();
+
+    // 从后往前装页：除最后一行外，其余行（含段间距）的高度之和不超过
+    // maxHeight - lh 时，正向装页从该页起点能放到最后一行
+    std::vector<uint32_t> lines;
+    uint32_t paraStart = end;
+    size_t first = 0;
+    while (paraStart > 0) {
+        uint32_t p;
+        std::vector<uint32_t> more;
+        ink::ReadStatus status = paragraphStartBefore(paraStart - 1, &p);
+        if (status == ink::ReadStatus::Ok) status = collectLines(p, paraStart, &more);
+        if (status == ink::ReadStatus::Pending) return status;
+        if (status != ink::ReadStatus::Ok || more.empty()) break;
+        more.insert(more.end(), lines.begin(), lines.end());
+        lines.swap(more);
+        paraStart = p;
+
+        int used = 0;
+        int count = 1;
+        bool full = false;
+        first = lines.size() - 1;
+        for (size_t j = lines.size() - 1; j-- > 0;) {
+            int cost = lh + ((lines[j] & kLineParaEnd) ? paragraphSpacing_ : 0);
+            if (count >= kMaxPageLines || used + cost > maxHeight - lh) {
+                full = true;
+                break;
+            }
+            used += cost;
+            count++;
+            first = j;
         }
+        if (full) break;
     }
 
-    ESP_LOGI(TAG, "Glyph width cache built (64KB PSRAM)");
+    *out = lines.empty() ? end : lines[first] & ~kLineParaEnd;
+    return ink::ReadStatus::Ok;
 }
 
-void ReaderContentView::freeWidthCache() {
-    if (glyphWidthCache_) {
-        heap_caps_free(glyphWidthCache_);
-        glyphWidthCache_ = nullptr;
+ink::ReadStatus ReaderContentView::paragraphStartBefore(uint32_t pos,
+                                                        uint32_t* out) {
+    uint32_t limit = pos > kMaxParagraphScan ? pos - kMaxParagraphScan : 0;
+    uint32_t end = pos;  // 尚未检查的最大候选
+
+    while (end > limit) {
+        uint32_t lo = end > limit + kBreakWindow ? end - kBreakWindow : limit;
+        ink::TextSpan span;
+        ink::ReadStatus status =
+            renderCursor_.tryReadRange(lo, end + 1 - lo, &span);
+        if (status != ink::ReadStatus::Ok) return status;
+
+        // 候选 s 为段落起点：前一字节是 \n，或是后面不跟 \n 的 \r
+        for (uint32_t s = end; s > lo; s--) {
+            uint32_t i = s - 1 - lo;
+            if (i >= span.length) continue;
+            char c = span.data[i];
+            bool lone = i + 1 >= span.length || span.data[i + 1] != '\n';
+            if (c == '\n' || (c == '\r' && lone)) {
+                *out = s;
+                return ink::ReadStatus::Ok;
+            }
+        }
+        end = lo;
+    }
+    *out = end;
+    return ink::ReadStatus::Ok;
+}
+
+ink::ReadStatus ReaderContentView::collectLines(uint32_t from, uint32_t to,
+                                                std::vector<uint32_t>* out) {
+    int maxWidth = cachedViewportW_ > 0 ? cachedViewportW_ : bounds().w;
+    uint32_t pos = from;
+
+    while (pos < to) {
+        ink::TextSpan span;
+        ink::ReadStatus status = renderCursor_.tryReadRange(pos, kBreakWindow, &span);
+        if (status != ink::ReadStatus::Ok) return status;
+        if (span.length == 0) return ink::ReadStatus::Unavailable;
+
+        uint32_t total = textSource_->totalSize();
+        bool eof = total > 0 && pos + span.length >= total;
+        uint32_t usable = (eof || span.length <= kMaxLineBytes)
+                              ? span.length
+                              : span.length - kMaxLineBytes;
+
+        uint32_t local = 0;
+        while (local < usable && pos + local < to) {
+            LineInfo line;
+            uint32_t next = measurer_.breakLine(span.data, span.length, local,
+                                                maxWidth, &line);
+            out->push_back((pos + local) |
+                           (line.isParagraphEnd ? kLineParaEnd : 0));
+            local = next;
+        }
+        if (eof && local >= span.length) break;
+        pos += local;
     }
+    return ink::ReadStatus::Ok;
 }
 
-int ReaderContentView::charWidth(uint32_t codepoint) const {
+// ════════════════════════════════════════════════════════════════
+//  统一布局引擎
+// ════════════════════════════════════════════════════════════════
+
+int ReaderContentView::lineHeight() const {
     if (!font_) return 0;
-    // BMP 范围：查缓存表
-    if (codepoint <= 0xFFFF && glyphWidthCache_) {
-        uint8_t w = glyphWidthCache_[codepoint];
-        return w > 0 ? w : font_->advance_y / 2;
-    }
-    // 非 BMP 或无缓存：回退到二分搜索
-    const EpdGlyph* glyph = epd_get_glyph(font_, codepoint);
-    return glyph ? glyph->advance_x : font_->advance_y / 2;
-}
-
-int ReaderContentView::utf8CharLen(uint8_t byte) {
-    if (byte < 0x80) return 1;
-    if ((byte & 0xE0) == 0xC0) return 2;
-    if ((byte & 0xF0) == 0xE0) return 3;
-    if ((byte & 0xF8) == 0xF0) return 4;
-    return 1;
-}
-
-uint32_t ReaderContentView::decodeCodepoint(const char* p, int len) {
-    uint8_t b = static_cast<uint8_t>(p[0]);
-    uint32_t cp = 0;
-    if (b < 0x80) {
-        cp = b;
-    } else if ((b & 0xE0) == 0xC0) {
-        cp = b & 0x1F;
-        for (int i = 1; i < len; i++)
-            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
-    } else if ((b & 0xF0) == 0xE0) {
-        cp = b & 0x0F;
-        for (int i = 1; i < len; i++)
-            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
-    } else if ((b & 0xF8) == 0xF0) {
-        cp = b & 0x07;
-        for (int i = 1; i < len; i++)
-            cp = (cp << 6) | (static_cast<uint8_t>(p[i]) & 0x3F);
-    } else {
-        cp = 0xFFFD;
+    int lh = font_->advance_y * lineSpacing10x_ / 10;
+    if (lh < font_->advance_y) lh = font_->advance_y;
+    return lh;
+}
+
+ink::ReadStatus ReaderContentView::layoutPage(ink::TextCursor& cursor,
+                                              uint32_t startOffset,
+                                              PageLayout* out) {
+    // 一次读入整页所需的连续文本：跨块时由游标拼接，
+    // 布局中途不会再进入 I/O，分页结果与块边界位置无关
+    ink::TextSpan span = {nullptr, 0};
+    ink::ReadStatus status = ink::ReadStatus::Unavailable;
+    if (font_ && textSource_) {
+        status = cursor.tryReadRange(startOffset, kMaxPageBytes, &span);
+        if (status == ink::ReadStatus::Pending) return status;
     }
-    return cp;
+    *out = layoutText(span, startOffset);
+    return status;
 }
 
-ReaderContentView::PageLayout ReaderContentView::layoutPage(
-    uint32_t startOffset) {
+ReaderContentView::PageLayout ReaderContentView::layoutText(
+    const ink::TextSpan& span, uint32_t startOffset) {
     PageLayout result;
     result.lineCount = 0;
     result.endOffset = startOffset;
 
-    if (!font_ || !textSource_) return result;
-
-    // 从 TextSource 获取文本
-    ink::TextSpan span = textSource_->read(startOffset);
-    if (!span.data || span.length == 0) return result;
+    if (!font_ || !span.data || span.length == 0) return result;
 
     const char* textBuf = span.data;
     uint32_t textLen = span.length;
@@ -271,93 +541,155 @@ ReaderContentView::PageLayout ReaderContentView::layoutPage(
     if (lh <= 0) return result;
 
     int remainingHeight = maxHeight;
-    uint32_t offset = startOffset;
-    // localOff 是相对于 span.data 的局部偏移
-    uint32_t localOff = 0;
+    uint32_t localOff = 0;  // 相对于 span.data 的局部偏移
 
     while (localOff < textLen && remainingHeight >= lh) {
-        if (result.lineCount >= 64) break;  // 固定数组上限
-
-        // 处理 \r\n 或 \n
-        if (textBuf[localOff] == '\n') {
-            result.lines[result.lineCount++] = {offset, offset, true};
-            offset++;
-            localOff++;
-            remainingHeight -= lh + paragraphSpacing_;
-            continue;
-        }
-        if (textBuf[localOff] == '\r') {
-            uint32_t crOffset = offset;
-            offset++;
-            localOff++;
-            if (localOff < textLen && textBuf[localOff] == '\n') {
-                offset++;
-                localOff++;
-            }
-            result.lines[result.lineCount++] = {crOffset, crOffset, true};
-            remainingHeight -= lh + paragraphSpacing_;
-            continue;
+        if (result.lineCount >= kMaxPageLines) break;  // 固定数组上限
+
+        LineInfo& line = result.lines[result.lineCount++];
+        localOff = measurer_.breakLine(textBuf, textLen, localOff, maxWidth,
+                                       &line);
+        line.start += startOffset;
+        line.end += startOffset;
+
+        remainingHeight -= lh;
+        if (line.isParagraphEnd) {
+            remainingHeight -= paragraphSpacing_;
         }
+    }
 
-        // 折行：逐字符测量宽度
-        uint32_t lineStartOffset = offset;
-        uint32_t lineStartLocal = localOff;
-        int lineWidth = 0;
+    result.endOffset = startOffset + localOff;
+    return result;
+}
 
-        while (localOff < textLen &&
-               textBuf[localOff] != '\n' &&
-               textBuf[localOff] != '\r') {
-            int cLen = utf8CharLen(static_cast<uint8_t>(textBuf[localOff]));
-            if (localOff + cLen > textLen) break;
+// ════════════════════════════════════════════════════════════════
+//  glyph 预热
+// ════════════════════════════════════════════════════════════════
 
-            uint32_t cp = decodeCodepoint(textBuf + localOff, cLen);
-            int cw = charWidth(cp);
+void ReaderContentView::requestPrewarm(uint32_t pageOffset,
+                                       uint32_t nextOffset) {
+    if (pageOffset == prewarmOffset_) return;
+    prewarmOffset_ = pageOffset;
+
+    // 上一页起点：临时页链或全局页索引中已知时才预热
+    uint32_t prevOffset = pageOffset;
+    if (anchored_) {
+        if (anchorPage_ > 0) prevOffset = anchorPages_[anchorPage_ - 1];
+    } else if (currentPage_ > 0) {
+        prevOffset = pageIndex_.pageOffset(static_cast<uint32_t>(currentPage_ - 1));
+    }
 
-            if (lineWidth + cw > maxWidth && localOff > lineStartLocal) {
-                break;
-            }
+    PrewarmRequest req = {};
+    req.ranges[0] = {nextOffset, 0};
+    req.ranges[1] = {prevOffset, pageOffset};
+    req.epoch = ink::GlyphCache::instance().fontEpoch();
 
-            lineWidth += cw;
-            offset += cLen;
-            localOff += cLen;
-        }
-
-        // 安全措施：至少前进一个字符
-        if (localOff == lineStartLocal && localOff < textLen) {
-            int cLen = utf8CharLen(static_cast<uint8_t>(textBuf[localOff]));
-            offset += cLen;
-            localOff += cLen;
-        }
-
-        uint32_t lineEndOffset = offset;
-
-        // 判断是否段落结尾
-        bool isParagraphEnd = false;
-        if (localOff < textLen && textBuf[localOff] == '\n') {
-            isParagraphEnd = true;
-            offset++;
-            localOff++;
-        } else if (localOff < textLen && textBuf[localOff] == '\r') {
-            isParagraphEnd = true;
-            offset++;
-            localOff++;
-            if (localOff < textLen && textBuf[localOff] == '\n') {
-                offset++;
-                localOff++;
-            }
-        }
+    if (!prewarmTask_) startPrewarmTask();
+    if (prewarmQueue_) xQueueOverwrite(prewarmQueue_, &req);
+}
 
-        result.lines[result.lineCount++] = {
-            lineStartOffset, lineEndOffset, isParagraphEnd};
+void ReaderContentView::startPrewarmTask() {
+    if (prewarmTask_) return;
 
-        remainingHeight -= lh;
-        if (isParagraphEnd) {
-            remainingHeight -= paragraphSpacing_;
+    prewarmQueue_ = xQueueCreate(1, sizeof(PrewarmRequest));
+    if (!prewarmQueue_) return;
+
+    prewarmJob_.start();
+    prewarmExited_ = false;
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        prewarmTaskFunc, "prewarm", 6144, this,
+        tskIDLE_PRIORITY + 1, &prewarmTask_, 1);
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create prewarm task");
+        prewarmJob_.finish();
+        prewarmTask_ = nullptr;
+        vQueueDelete(prewarmQueue_);
+        prewarmQueue_ = nullptr;
+    }
+}
+
+void ReaderContentView::stopPrewarmTask() {
+    prewarmOffset_ = UINT32_MAX;
+    if (!prewarmTask_) return;
+
+    prewarmJob_.cancel();
+    PrewarmRequest exitReq = {};
+    exitReq.exit = true;
+    xQueueOverwrite(prewarmQueue_, &exitReq);
+    // 唤醒等待文本的预热 task
+    if (textSource_) textSource_->wakeWaiters();
+    for (int i = 0; i < 50 && !prewarmExited_; i++) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    if (!prewarmExited_) {
+        ESP_LOGW(TAG, "Prewarm task did not exit cleanly, forcing delete");
+        vTaskDelete(prewarmTask_);
+        prewarmJob_.finish();
+    }
+    prewarmTask_ = nullptr;
+    vQueueDelete(prewarmQueue_);
+    prewarmQueue_ = nullptr;
+}
+
+void ReaderContentView::prewarmTaskFunc(void* param) {
+    auto* self = static_cast<ReaderContentView*>(param);
+    self->runPrewarm();
+    self->prewarmJob_.finish();
+    self->prewarmExited_ = true;
+    vTaskDelete(nullptr);
+}
+
+void ReaderContentView::runPrewarm() {
+    ink::TextCursor cursor(ink::CursorMode::Sequential);
+    cursor.bind(textSource_);
+    ink::JobSlice slice(prewarmJob_);
+
+    PrewarmRequest req;
+    while (!prewarmJob_.cancelled()) {
+        slice.beginWait();
+        BaseType_t got = xQueueReceive(prewarmQueue_, &req, portMAX_DELAY);
+        slice.endWait();
+        if (got != pdTRUE || req.exit) break;
+
+        for (const PrewarmRange& range : req.ranges) {
+            if (!prewarmRange(slice, cursor, range, req.epoch)) break;
         }
     }
+    cursor.bind(nullptr);
+}
 
-    result.endOffset = offset;
-    return result;
+bool ReaderContentView::prewarmRange(ink::JobSlice& slice,
+                                     ink::TextCursor& cursor,
+                                     const PrewarmRange& range,
+                                     uint32_t epoch) {
+    // end 为 0 时读入整页文本，按当前排版折出下一页的范围
+    uint32_t end = range.end;
+    if (end != 0 && end <= range.start) return true;
+    ink::TextSpan span = cursor.readRange(
+        range.start, end != 0 ? end - range.start : kMaxPageBytes);
+    if (!span.data) return true;
+    if (end == 0) end = layoutText(span, range.start).endOffset;
+    if (end <= range.start) return true;
+    uint32_t len = end - range.start;
+    if (len > span.length) len = span.length;
+
+    ink::GlyphCache& cache = ink::GlyphCache::instance();
+    uint32_t pos = 0;
+    while (pos < len) {
+        int cLen = LineMeasurer::utf8CharLen(static_cast<uint8_t>(span.data[pos]));
+        if (pos + cLen > len) break;
+        uint32_t cp = LineMeasurer::decodeCodepoint(span.data + pos, cLen);
+        pos += cLen;
+        if (cp < 0x20) continue;  // 换行等控制字符没有 glyph
+
+        if (!cache.prewarm(font_, cp, epoch)) return false;
+        // 又翻页了：放弃当前请求，处理新的请求
+        if (!slice.yieldPoint() || uxQueueMessagesWaiting(prewarmQueue_) > 0) {
+            return false;
+        }
+    }
+    return true;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -374,38 +706,93 @@ void ReaderContentView::ensurePagination() {
     cachedViewportW_ = bounds().w;
     cachedViewportH_ = bounds().h;
 
-    // 尝试从缓存加载 PageIndex
+    // 尝试从缓存加载 PageIndex，其次从行索引装页
+    bool loaded = false;
+    resume_ = PageIndex::ResumeState();
     if (cacheDirPath_[0] != '\0') {
         char idxPath[280];
         getPagesIdxPath(idxPath, sizeof(idxPath));
         uint32_t textSize = textSource_->totalSize();
         if (textSize > 0) {
             uint32_t hash = paramsHash();
-            if (pageIndex_.load(idxPath, textSize, hash)) {
+            PageIndex::ResumeState resume;
+            loaded = pageIndex_.load(idxPath, textSize, hash, &resume);
+            if (loaded && !pageIndex_.isComplete()) {
+                // 中途离开过的书：行索引加载到同一检查点后从那里继续分页
+                loaded = false;
+                getLinesIdxPath(idxPath, sizeof(idxPath));
+                if (resume.nextSlice > 0 &&
+                    lineIndex_.load(idxPath, textSize, layoutHash(),
+                                    resume.lineCount)) {
+                    resume_ = resume;
+                } else {
+                    pageIndex_.clear();
+                }
+            } else if (loaded) {
                 ESP_LOGI(TAG, "PageIndex loaded from cache: %u pages",
                          (unsigned)pageIndex_.pageCount());
-                // 恢复页码
-                if (hasInitialByteOffset_) {
-                    currentPage_ = static_cast<int>(
-                        pageIndex_.findPage(initialByteOffset_));
-                    hasInitialByteOffset_ = false;
-                    ESP_LOGI(TAG, "Restored to page %d (offset %lu)",
-                             currentPage_, (unsigned long)initialByteOffset_);
-                }
-                if (statusCallback_) statusCallback_();
-                return;
             }
         }
     }
+    if (!loaded && resume_.nextSlice == 0) loaded = derivePagesFromLines();
+
+    if (loaded) {
+        // 恢复页码
+        if (hasInitialByteOffset_) {
+            currentPage_ = static_cast<int>(
+                pageIndex_.findPage(initialByteOffset_));
+            hasInitialByteOffset_ = false;
+            ESP_LOGI(TAG, "Restored to page %d (offset %lu)",
+                     currentPage_, (unsigned long)initialByteOffset_);
+        }
+        if (statusCallback_) statusCallback_();
+        return;
+    }
 
-    // 缓存未命中，启动后台分页 task
+    // 缓存未命中或未完成，启动后台分页 task
     startPaginateTask();
 }
 
+bool ReaderContentView::derivePagesFromLines() {
+    uint32_t textSize = textSource_->totalSize();
+    if (textSize == 0) return false;
+
+    // 行索引只取决于字体和宽度：内存中没有时尝试 lines.idx
+    uint32_t hash = layoutHash();
+    if (!lineIndex_.matches(hash)) {
+        if (cacheDirPath_[0] == '\0') return false;
+        char idxPath[280];
+        getLinesIdxPath(idxPath, sizeof(idxPath));
+        if (!lineIndex_.load(idxPath, textSize, hash)) return false;
+    }
+
+    TickType_t startTick = xTaskGetTickCount();
+    pageIndex_.clear();
+    PackParams params = packParams();
+    PackState pack;
+    lineIndex_.withLines([&](const uint32_t* lines, size_t count) {
+        packLines(lines, count, params, &pack);
+    });
+    if (pageIndex_.pageCount() == 0) return false;
+    pageIndex_.markComplete();
+
+    ESP_LOGI(TAG, "PageIndex derived from %u lines: %u pages in %lu ms",
+             (unsigned)lineIndex_.lineCount(), (unsigned)pageIndex_.pageCount(),
+             (unsigned long)(xTaskGetTickCount() - startTick));
+
+    if (cacheDirPath_[0] != '\0') {
+        char idxPath[280];
+        getPagesIdxPath(idxPath, sizeof(idxPath));
+        pageIndex_.save(idxPath, textSize, params.paramsHash);
+    }
+    return true;
+}
+
 void ReaderContentView::startPaginateTask() {
     if (paginateTask_) return;
 
-    paginateStopRequested_ = false;
+    taskParams_ = packParams();
+    paginateJob_.start();
     paginateComplete_ = false;
     BaseType_t ret = xTaskCreatePinnedToCore(
         paginateTaskFunc, "paginate", 8192, this,
@@ -413,6 +800,7 @@ void ReaderContentView::startPaginateTask() {
 
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create paginate task");
+        paginateJob_.finish();
     } else {
         ESP_LOGI(TAG, "Background pagination started");
     }
@@ -421,7 +809,9 @@ void ReaderContentView::startPaginateTask() {
 void ReaderContentView::stopPaginateTask() {
     if (!paginateTask_) return;
 
-    paginateStopRequested_ = true;
+    paginateJob_.cancel();
+    // 唤醒等待文本的分页 task 和 worker
+    if (textSource_) textSource_->wakeWaiters();
     // 等待 task 退出
     for (int i = 0; i < 50 && !paginateComplete_; i++) {
         vTaskDelay(pdMS_TO_TICKS(100));
@@ -430,6 +820,7 @@ void ReaderContentView::stopPaginateTask() {
     if (!paginateComplete_) {
         ESP_LOGW(TAG, "Paginate task did not exit cleanly, forcing delete");
         vTaskDelete(paginateTask_);
+        paginateJob_.finish();
     }
     paginateTask_ = nullptr;
 }
@@ -437,6 +828,7 @@ void ReaderContentView::stopPaginateTask() {
 void ReaderContentView::paginateTaskFunc(void* param) {
     auto* self = static_cast<ReaderContentView*>(param);
     self->doPaginate();
+    self->paginateJob_.finish();
     self->paginateComplete_ = true;
     vTaskDelete(nullptr);
 }
@@ -444,28 +836,175 @@ void ReaderContentView::paginateTaskFunc(void* param) {
 void ReaderContentView::doPaginate() {
     if (!textSource_ || !font_) return;
 
-    ESP_LOGI(TAG, "BG paginate: starting");
+    int workers = portNUM_PROCESSORS;
+    if (workers > kMaxBreakWorkers) workers = kMaxBreakWorkers;
+    if (workers < 1) workers = 1;
+
+    // 在途切片数：每个 worker 两个，worker 折行时分页 task 装页不必等待
+    uint32_t window = static_cast<uint32_t>(workers) * 2;
+    sliceQueue_ = xQueueCreate(window + workers, sizeof(uint32_t));
+    resultQueue_ = xQueueCreate(window, sizeof(SliceResult));
+    if (!sliceQueue_ || !resultQueue_) {
+        ESP_LOGE(TAG, "BG paginate: failed to create queues");
+        if (sliceQueue_) vQueueDelete(sliceQueue_);
+        if (resultQueue_) vQueueDelete(resultQueue_);
+        sliceQueue_ = resultQueue_ = nullptr;
+        return;
+    }
 
-    uint32_t offset = 0;
+    breakAbort_ = false;
+    breakWorkersAlive_ = 0;
+    if (resume_.nextSlice == 0) {
+        lineIndex_.begin(layoutHash());
+    } else {
+        ESP_LOGI(TAG, "BG paginate: resuming at slice %lu, %u pages",
+                 (unsigned long)resume_.nextSlice,
+                 (unsigned)pageIndex_.pageCount());
+    }
+    int started = 0;
+    for (int i = 0; i < workers; i++) {
+        breakWorkersAlive_++;
+        TaskHandle_t handle;
+        BaseType_t ret = xTaskCreatePinnedToCore(
+            breakWorkerFunc, "linebreak", 8192, this,
+            tskIDLE_PRIORITY + 2, &handle, i % portNUM_PROCESSORS);
+        if (ret != pdPASS) {
+            breakWorkersAlive_--;
+            break;
+        }
+        started++;
+    }
+
+    ESP_LOGI(TAG, "BG paginate: starting, %d line-break workers", started);
+    TickType_t startTick = xTaskGetTickCount();
+
+    bool complete = started > 0 && runPagination(started);
+
+    // 停止 worker：排在剩余切片之后的退出标记，中止标记让剩余切片立即交回
+    breakAbort_ = true;
+    for (int i = 0; i < started; i++) {
+        xQueueSend(sliceQueue_, &kSliceExit, portMAX_DELAY);
+    }
+    SliceResult r;
+    while (breakWorkersAlive_ > 0) {
+        if (xQueueReceive(resultQueue_, &r, pdMS_TO_TICKS(10)) == pdTRUE) {
+            delete r.lines;
+        }
+    }
+    while (xQueueReceive(resultQueue_, &r, 0) == pdTRUE) {
+        delete r.lines;
+    }
+    vQueueDelete(sliceQueue_);
+    vQueueDelete(resultQueue_);
+    sliceQueue_ = resultQueue_ = nullptr;
+
+    if (!complete || paginateJob_.cancelled()) {
+        pageIndex_.closeLog();
+        lineIndex_.closeLog();
+        return;
+    }
+
+    pageIndex_.markComplete();
+    lineIndex_.markComplete();
+
+    // 恢复页码
+    if (hasInitialByteOffset_) {
+        currentPage_ = static_cast<int>(
+            pageIndex_.findPage(initialByteOffset_));
+        hasInitialByteOffset_ = false;
+        setNeedsDisplay();
+        ESP_LOGI(TAG, "BG: Restored to page %d (offset %lu)",
+                 currentPage_, (unsigned long)initialByteOffset_);
+    }
+
+    // 保存到缓存：追加最后一段并标记完成
+    savePagination(0, PackState());
+    pageIndex_.closeLog();
+    lineIndex_.closeLog();
+
+    ESP_LOGI(TAG, "BG paginate: complete, %u pages (%u bytes index) in %lu ms",
+             (unsigned)pageIndex_.pageCount(), (unsigned)pageIndex_.memoryBytes(),
+             (unsigned long)(xTaskGetTickCount() - startTick));
+
+    if (statusCallback_) statusCallback_();
+}
+
+bool ReaderContentView::runPagination(int workers) {
+    // 数据源切换编码后旧的分页结果作废，由 onDraw 重新分页
+    uint32_t version = textSource_->contentVersion();
+
+    uint32_t window = static_cast<uint32_t>(workers) * 2;
+    std::vector<std::vector<uint32_t>*> pending(window, nullptr);
+
+    // 从检查点续建时接着上次的切片和最后一页的装页状态
+    uint32_t nextDispatch = resume_.nextSlice;  // 下一个分发的切片
+    uint32_t nextPack = resume_.nextSlice;      // 下一个装页的切片
+    PackState pack;
+    pack.remainingHeight = resume_.remainingHeight;
+    pack.lineCount = resume_.pageLines;
+    pack.open = pageIndex_.pageCount() > 0;
+    uint32_t checkpointSlice = nextPack;
     TickType_t lastNotifyTick = xTaskGetTickCount();
+    bool complete = false;
+    bool abandoned = false;
+
+    // 装页本身很快，大部分时间阻塞在等待 worker 结果上
+    ink::JobSlice slice(paginateJob_);
+    while (slice.yieldPoint()) {
+        if (textSource_->contentVersion() != version) {
+            ESP_LOGI(TAG, "BG paginate: content changed, abandoning");
+            abandoned = true;
+            break;
+        }
 
-    while (!paginateStopRequested_) {
+        // 分发：总大小已知（UTF-8 文件或 GBK 长度扫描完成）时直到文本末尾，
+        // 未转换的段在读取时按需转换；否则只分发已扫描范围内的完整切片
+        uint32_t total = textSource_->totalSize();
         uint32_t avail = textSource_->availableSize();
-        if (offset >= avail) {
-            // 等待更多数据（GBK 转换中）
-            if (textSource_->state() == ink::TextSourceState::Ready) {
-                break;  // 全部数据已就绪，分页完成
+        while (nextDispatch < nextPack + window) {
+            uint32_t begin = nextDispatch * kSliceBytes;
+            bool ready = total > 0 ? begin < total
+                                   : begin + kSliceBytes <= avail;
+            if (!ready) break;
+            xQueueSend(sliceQueue_, &nextDispatch, portMAX_DELAY);
+            nextDispatch++;
+        }
+
+        if (nextPack == nextDispatch) {
+            if (total > 0 && nextPack * kSliceBytes >= total) {
+                complete = true;
+                break;
             }
-            vTaskDelay(pdMS_TO_TICKS(100));
+            // 等待 GBK 长度扫描推进到下一个完整切片：到达水位线时由
+            // TextSource 唤醒，超时只用于响应停止请求
+            slice.beginWait();
+            textSource_->waitForAvailable((nextDispatch + 1) * kSliceBytes, 100);
+            slice.endWait();
             continue;
         }
 
-        pageIndex_.addPage(offset);
-
-        PageLayout layout = layoutPage(offset);
-        if (layout.endOffset <= offset) break;
+        SliceResult r;
+        slice.beginWait();
+        BaseType_t got = xQueueReceive(resultQueue_, &r, pdMS_TO_TICKS(100));
+        slice.endWait();
+        if (got != pdTRUE) continue;
+        if (!r.lines) break;  // worker 已中止或分配失败
+        pending[r.index % window] = r.lines;
+
+        // 按顺序装页：切片可能乱序完成
+        while (pending[nextPack % window]) {
+            std::vector<uint32_t>* lines = pending[nextPack % window];
+            pending[nextPack % window] = nullptr;
+            lineIndex_.appendLines(lines->data(), lines->size());
+            packLines(lines->data(), lines->size(), taskParams_, &pack);
+            delete lines;
+            nextPack++;
+        }
 
-        offset = layout.endOffset;
+        if (nextPack - checkpointSlice >= kCheckpointSlices) {
+            checkpointSlice = nextPack;
+            savePagination(nextPack, pack);
+        }
 
         // 进度通知（每 2 秒刷新一次）
         TickType_t now = xTaskGetTickCount();
@@ -473,37 +1012,211 @@ void ReaderContentView::doPaginate() {
             lastNotifyTick = now;
             if (statusCallback_) statusCallback_();
         }
+    }
+
+    for (auto* lines : pending) delete lines;
+
+    // 中途离开：保存已装好的页，下次打开从这里继续
+    if (!complete && !abandoned && nextPack > checkpointSlice) {
+        savePagination(nextPack, pack);
+    }
+    return complete;
+}
+
+void ReaderContentView::savePagination(uint32_t nextSlice,
+                                       const PackState& pack) {
+    if (cacheDirPath_[0] == '\0') return;
+    // GBK 长度扫描完成前总大小未知，无法写出可校验的 header
+    uint32_t textSize = textSource_->totalSize();
+    if (textSize == 0) return;
+
+    PageIndex::ResumeState state;
+    state.nextSlice = nextSlice;
+    state.lineCount = lineIndex_.lineCount();
+    state.remainingHeight = pack.remainingHeight;
+    state.pageLines = pack.lineCount;
+
+    // 先提交行索引：页索引的检查点引用的行必须已经落盘
+    char idxPath[280];
+    getLinesIdxPath(idxPath, sizeof(idxPath));
+    if (!lineIndex_.checkpoint(idxPath, textSize)) return;
+    getPagesIdxPath(idxPath, sizeof(idxPath));
+    pageIndex_.checkpoint(idxPath, textSize, taskParams_.paramsHash, state);
+}
+
+ReaderContentView::PackParams ReaderContentView::packParams() const {
+    PackParams params;
+    params.lineHeight = lineHeight();
+    params.paragraphSpacing = paragraphSpacing_;
+    params.viewportH = cachedViewportH_ > 0 ? cachedViewportH_ : bounds().h;
+    params.paramsHash = paramsHash();
+    return params;
+}
 
-        vTaskDelay(1);  // 至少 1 tick，让 IDLE task 喂看门狗
+void ReaderContentView::packLines(const uint32_t* lines, size_t count,
+                                  const PackParams& params, PackState* state) {
+    int maxHeight = params.viewportH;
+    int lh = params.lineHeight;
+
+    // 与 layoutText() 的装页规则一致：放不下一行或满 64 行时换页
+    for (size_t i = 0; i < count; i++) {
+        uint32_t entry = lines[i];
+        if (!state->open || state->remainingHeight < lh ||
+            state->lineCount >= kMaxPageLines) {
+            pageIndex_.addPage(entry & ~kLineParaEnd);
+            state->remainingHeight = maxHeight;
+            state->lineCount = 0;
+            state->open = true;
+        }
+        state->remainingHeight -= lh;
+        if (entry & kLineParaEnd) {
+            state->remainingHeight -= params.paragraphSpacing;
+        }
+        state->lineCount++;
     }
+}
 
-    if (!paginateStopRequested_) {
-        pageIndex_.markComplete();
+void ReaderContentView::breakWorkerFunc(void* param) {
+    auto* self = static_cast<ReaderContentView*>(param);
+    self->runBreakWorker();
+    self->breakWorkersAlive_--;
+    vTaskDelete(nullptr);
+}
 
-        // 恢复页码
-        if (hasInitialByteOffset_) {
-            currentPage_ = static_cast<int>(
-                pageIndex_.findPage(initialByteOffset_));
-            hasInitialByteOffset_ = false;
-            setNeedsDisplay();
-            ESP_LOGI(TAG, "BG: Restored to page %d (offset %lu)",
-                     currentPage_, (unsigned long)initialByteOffset_);
+void ReaderContentView::runBreakWorker() {
+    // 每个 worker 一个游标：各自 pin 住自己的块，互不淘汰
+    ink::TextCursor cursor(ink::CursorMode::Sequential);
+    cursor.bind(textSource_);
+    int maxWidth = cachedViewportW_ > 0 ? cachedViewportW_ : bounds().w;
+    ink::JobSlice slice(paginateJob_);
+
+    for (;;) {
+        uint32_t k;
+        slice.beginWait();
+        xQueueReceive(sliceQueue_, &k, portMAX_DELAY);
+        slice.endWait();
+        if (k == kSliceExit) break;
+
+        SliceResult r = {k, nullptr};
+        if (!breakAbort_ && !paginateJob_.cancelled()) {
+            r.lines = breakSlice(slice, cursor, k, maxWidth);
         }
+        slice.beginWait();
+        xQueueSend(resultQueue_, &r, portMAX_DELAY);
+        slice.endWait();
+    }
+    cursor.bind(nullptr);
+}
 
-        // 保存到缓存
-        if (cacheDirPath_[0] != '\0') {
-            char idxPath[280];
-            getPagesIdxPath(idxPath, sizeof(idxPath));
-            uint32_t textSize = textSource_->totalSize();
-            uint32_t hash = paramsHash();
-            pageIndex_.save(idxPath, textSize, hash);
+bool ReaderContentView::readWindow(ink::JobSlice& slice,
+                                   ink::TextCursor& cursor, uint32_t pos,
+                                   ink::TextSpan* span, bool* eof) {
+    while (!breakAbort_ && !paginateJob_.cancelled()) {
+        uint32_t total = textSource_->totalSize();
+        *span = cursor.readRange(pos, kBreakWindow);
+        uint32_t len = span->data ? span->length : 0;
+        *eof = total > 0 && pos + len >= total;
+        // 窗口须容得下一整行，否则行会在窗口末尾被截断
+        if (*eof || len > kMaxLineBytes) return true;
+        slice.beginWait();
+        if (total == 0) {
+            // 段落越过已扫描范围：等长度扫描推进到能容下一整行
+            textSource_->waitForAvailable(pos + kMaxLineBytes + 1, 100);
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(100));  // 读取失败，稍后重试
         }
+        slice.endWait();
+    }
+    return false;
+}
 
-        ESP_LOGI(TAG, "BG paginate: complete, %u pages",
-                 (unsigned)pageIndex_.pageCount());
+bool ReaderContentView::findParagraphStart(ink::JobSlice& slice,
+                                           ink::TextCursor& cursor,
+                                           uint32_t begin, uint32_t* out) {
+    // 段落起点：前一字节是 \n，或是后面不跟 \n 的 \r
+    uint32_t pos = begin - 1;
+    for (;;) {
+        ink::TextSpan span;
+        bool eof;
+        if (!readWindow(slice, cursor, pos, &span, &eof)) return false;
+        uint32_t len = span.data ? span.length : 0;
+
+        uint32_t i = 0;
+        for (; i < len; i++) {
+            char c = span.data[i];
+            if (c == '\n') {
+                *out = pos + i + 1;
+                return true;
+            }
+            if (c == '\r') {
+                if (i + 1 < len) {
+                    *out = pos + i + (span.data[i + 1] == '\n' ? 2 : 1);
+                    return true;
+                }
+                if (eof) {
+                    *out = pos + i + 1;
+                    return true;
+                }
+                break;  // \r 在窗口末尾：从它重新读入
+            }
+        }
+        if (eof) {
+            *out = pos + len;
+            return true;
+        }
+        pos += i;
+    }
+}
 
-        if (statusCallback_) statusCallback_();
+std::vector<uint32_t>* ReaderContentView::breakSlice(ink::JobSlice& slice,
+                                                     ink::TextCursor& cursor,
+                                                     uint32_t k, int maxWidth) {
+    uint32_t begin = k * kSliceBytes;
+    uint32_t limit = begin + kSliceBytes;
+
+    uint32_t pos = begin;
+    if (k > 0 && !findParagraphStart(slice, cursor, begin, &pos)) return nullptr;
+
+    auto* lines = new std::vector<uint32_t>();
+    lines->reserve(kSliceBytes / 64);
+
+    ink::TextSpan span = {nullptr, 0};
+    uint32_t base = pos;    // span.data[0] 的文本偏移
+    uint32_t usable = 0;    // 可安全折行的窗口长度
+    bool eof = false;
+    bool paragraphStart = true;
+
+    for (;;) {
+        // 只处理行首位于切片内的段落，末段折到段落结束
+        if (paragraphStart && pos >= limit) break;
+
+        if (pos - base >= usable || !span.data) {
+            if (span.data && eof && pos - base >= span.length) break;
+            if (!readWindow(slice, cursor, pos, &span, &eof)) {
+                delete lines;
+                return nullptr;
+            }
+            base = pos;
+            uint32_t len = span.data ? span.length : 0;
+            if (len == 0) break;
+            usable = eof ? len : len - kMaxLineBytes;
+            continue;
+        }
+
+        LineInfo line;
+        uint32_t next = measurer_.breakLine(span.data, span.length,
+                                            pos - base, maxWidth, &line);
+        lines->push_back(pos | (line.isParagraphEnd ? kLineParaEnd : 0));
+        paragraphStart = line.isParagraphEnd;
+        pos = base + next;
+
+        // 时间片用完才让出 CPU，不按行或按页固定睡眠
+        if (breakAbort_ || !slice.yieldPoint()) {
+            delete lines;
+            return nullptr;
+        }
     }
+    return lines;
 }
 
 uint32_t ReaderContentView::paramsHash() const {
@@ -515,10 +1228,21 @@ uint32_t ReaderContentView::paramsHash() const {
         lineSpacing10x_, paragraphSpacing_, 0, w, h);
 }
 
+uint32_t ReaderContentView::layoutHash() const {
+    if (!font_) return 0;
+    int w = cachedViewportW_ > 0 ? cachedViewportW_ : bounds().w;
+    return LineIndex::computeLayoutHash(
+        static_cast<uint8_t>(font_->advance_y), w);
+}
+
 void ReaderContentView::getPagesIdxPath(char* buf, int bufSize) const {
     snprintf(buf, bufSize, "%s/pages.idx", cacheDirPath_);
 }
 
+void ReaderContentView::getLinesIdxPath(char* buf, int bufSize) const {
+    snprintf(buf, bufSize, "%s/lines.idx", cacheDirPath_);
+}
+
 // ════════════════════════════════════════════════════════════════
 //  渲染
 // ════════════════════════════════════════════════════════════════
@@ -529,59 +1253,111 @@ void ReaderContentView::onDraw(ink::Canvas& canvas) {
     ink::TextSourceState srcState = textSource_->state();
     if (srcState == ink::TextSourceState::Error) return;
 
+    // 数据源切换了编码（后台校验发现不是 UTF-8）：旧页索引作废，
+    // 按当前页起始位置重新定位后重新分页。旧 offset 是原文件中的
+    // 位置，须换算到转换后的文本
+    uint32_t version = textSource_->contentVersion();
+    if (version != contentVersion_) {
+        contentVersion_ = version;
+        if (hasInitialByteOffset_) {
+            initialOffsetRaw_ = true;
+        } else {
+            uint32_t offset = currentPageOffset();
+            if (offset > 0) setInitialByteOffset(offset, true);
+        }
+        invalidatePages();
+        lineIndex_.clear();
+        currentPage_ = 0;
+    }
+
+    // 换算原始 offset；换算期间又切换了版本时留到下一次 onDraw
+    if (hasInitialByteOffset_ && initialOffsetRaw_) {
+        uint32_t translatedVersion = 0;
+        uint32_t offset = textSource_->translateRawOffset(initialByteOffset_,
+                                                          &translatedVersion);
+        if (translatedVersion == contentVersion_) {
+            ESP_LOGI(TAG, "Raw offset %lu -> %lu",
+                     (unsigned long)initialByteOffset_, (unsigned long)offset);
+            initialByteOffset_ = offset;
+            initialOffsetRaw_ = false;
+        }
+    }
+
     // 懒分页：首次 onDraw 时启动
     if (!paginateStarted_) {
         ensurePagination();
     }
 
-    // 等待进度恢复完成再渲染（避免闪现第 0 页）
-    if (hasInitialByteOffset_) return;
+    // 恢复阅读位置：全局页索引尚未覆盖时从锚点临时分页，不必等后台分页
+    // 走到该位置；文本尚不可用时暂不渲染（避免闪现第 0 页）
+    if (hasInitialByteOffset_ && !enterAnchor(initialByteOffset_)) return;
 
-    // 获取当前页 offset
-    uint32_t pageOffset;
-    if (pageIndex_.pageCount() > 0) {
-        pageOffset = pageIndex_.pageOffset(static_cast<uint32_t>(currentPage_));
-    } else {
-        pageOffset = 0;
-    }
-
-    // 从 TextSource 获取文本
-    ink::TextSpan span = textSource_->read(pageOffset);
-    if (!span.data || span.length == 0) {
-        // 文本尚不可用，显示加载提示
-        const char* hint = "\xE6\xAD\xA3\xE5\x9C\xA8\xE5\x8A\xA0\xE8\xBD\xBD...";  // "正在加载..."
-        int hintLen = strlen(hint);
-        int w = bounds().w;
-        int h = bounds().h;
-        // 居中显示
-        int textW = font_->advance_y / 2 * hintLen / 3;  // 粗略估算
-        int x = (w - textW) / 2;
-        if (x < 0) x = 0;
-        int y = h / 2;
-        canvas.drawTextN(font_, hint, hintLen, x, y, textColor_);
-        return;
+    // 获取当前页 offset；反向装出的临时页在下一页起点处截止
+    uint32_t pageOffset = currentPageOffset();
+    uint32_t pageEnd = UINT32_MAX;
+    if (anchored_ && anchorPage_ + 1 < static_cast<int>(anchorPages_.size())) {
+        pageEnd = anchorPages_[anchorPage_ + 1];
     }
 
-    // 布局当前页（layoutPage 内部调用了 read，窗口已对齐）
-    PageLayout layout = layoutPage(pageOffset);
+    // 同一页重绘（如页脚刷新）直接使用缓存的 glyph run
+    if (drawnPage_.offset != pageOffset || drawnPage_.limit != pageEnd) {
+        // 从渲染游标获取整页连续文本：不在绘制路径上等待 SD 卡，块未缓存时
+        // 交给后台预读，载入后 TextSource 的就绪回调触发重绘
+        ink::TextSpan span;
+        ink::ReadStatus status =
+            renderCursor_.tryReadRange(pageOffset, kMaxPageBytes, &span);
+        if (status != ink::ReadStatus::Ok || span.length == 0) {
+            // 文本尚不可用或正在载入，显示加载提示
+            const char* hint = "\xE6\xAD\xA3\xE5\x9C\xA8\xE5\x8A\xA0\xE8\xBD\xBD...";  // "正在加载..."
+            int hintLen = strlen(hint);
+            int w = bounds().w;
+            int h = bounds().h;
+            // 居中显示
+            int textW = font_->advance_y / 2 * hintLen / 3;  // 粗略估算
+            int x = (w - textW) / 2;
+            if (x < 0) x = 0;
+            int y = h / 2;
+            canvas.drawTextN(font_, hint, hintLen, x, y, textColor_);
+            return;
+        }
 
-    // 再次 read 以获取渲染用指针（同一窗口内，无磁盘 I/O）
-    span = textSource_->read(pageOffset);
-    if (!span.data) return;
+        // 布局当前页（与解码共用同一片段，无需再次读取）
+        PageLayout layout = layoutText(span, pageOffset);
+        shapePage(span, pageOffset, pageEnd, layout);
+    }
+
+    for (int i = 0; i < drawnPage_.lineCount; i++) {
+        const DrawnLine& line = drawnPage_.lines[i];
+        canvas.drawGlyphRun(font_, drawnPage_.glyphs.data() + line.firstGlyph,
+                            line.glyphCount, 0, line.baselineY, textColor_);
+    }
+
+    requestPrewarm(pageOffset, drawnPage_.endOffset);
+}
+
+void ReaderContentView::shapePage(const ink::TextSpan& span,
+                                  uint32_t pageOffset, uint32_t pageEnd,
+                                  const PageLayout& layout) {
+    drawnPage_.offset = pageOffset;
+    drawnPage_.limit = pageEnd;
+    drawnPage_.endOffset = layout.endOffset;
+    drawnPage_.lineCount = 0;
+    drawnPage_.glyphs.clear();
 
     int lh = lineHeight();
     int y = 0;
 
     for (int i = 0; i < layout.lineCount; i++) {
         const LineInfo& line = layout.lines[i];
-        int len = static_cast<int>(line.end - line.start);
-        if (len > 0) {
-            uint32_t localOff = line.start - pageOffset;
-            if (localOff + len <= span.length) {
-                int baselineY = y + font_->ascender;
-                canvas.drawTextN(font_, span.data + localOff, len,
-                                 0, baselineY, textColor_);
-            }
+        if (line.start >= pageEnd) break;
+        uint32_t localStart = line.start - pageOffset;
+        uint32_t localEnd = line.end - pageOffset;
+        if (line.end > line.start && localEnd <= span.length) {
+            DrawnLine& drawn = drawnPage_.lines[drawnPage_.lineCount++];
+            drawn.firstGlyph = static_cast<uint32_t>(drawnPage_.glyphs.size());
+            drawn.glyphCount = static_cast<uint16_t>(measurer_.shapeLine(
+                span.data, localStart, localEnd, drawnPage_.glyphs));
+            drawn.baselineY = static_cast<int16_t>(y + font_->ascender);
         }
         y += lh;
         if (line.isParagraphEnd) {
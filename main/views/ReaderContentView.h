@@ -2,30 +2,48 @@
  * @file ReaderContentView.h
  * @brief 阅读文本渲染 View — 折行、分页、逐行绘制。
  *
- * 专用于阅读场景，支持可配置行距和段间距。直接使用 Canvas::drawTextN
- * 逐行绘制，绕过 TextLabel。分页由后台 FreeRTOS task 异步构建。
+ * 专用于阅读场景，支持可配置行距和段间距。布局当前页时把每一行解码为
+ * 已定位的 glyph run，逐行交给 Canvas::drawGlyphRun 绘制，绕过 TextLabel；
+ * run 随页缓存，同一页重绘时不再读取、布局和解码。分页由后台 FreeRTOS
+ * task 异步构建。
+ *
+ * 折行只取决于段落文本和视口宽度，与页从哪里开始无关，因此后台分页
+ * 分两阶段：折行 worker（每个核心一个）并行把 64KB 文本切片折成行，
+ * 分页 task 按顺序把行高和段间距装入页。折出的行保存在 LineIndex 中，
+ * 行距、段间距或视口高度变化时直接从行重新装页。
+ *
+ * 恢复阅读位置时若全局页索引尚未覆盖该位置，从锚点临时分页：锚点回溯到
+ * 段落起点折行，取包含该位置的行为第一页，向后逐页 layoutPage，向前从
+ * 段落起点折行后反向装页，页码按字节比例估算。翻页时全局页索引已覆盖
+ * 目标位置则切换到全局页码。
+ *
+ * 每次显示新的一页后，把预计接下来会显示的下一页和上一页交给低优先级的
+ * 预热 task：它读取这两页的文本，把其中的 glyph 提前解压进 GlyphCache，
+ * 翻页时前台绘制不再解压。
  */
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "ink_ui/core/View.h"
+#include "job_scheduler/JobScheduler.h"
+#include "text_source/TextSource.h"
+#include "views/LineIndex.h"
+#include "views/LineMeasurer.h"
 #include "views/PageIndex.h"
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
 #include "freertos/task.h"
 
 extern "C" {
 #include "epdiy.h"
 }
 
-namespace ink {
-class TextSource;
-struct TextSpan;
-}
-
 /// 阅读文本渲染 View
 class ReaderContentView : public ink::View {
 public:
@@ -35,6 +53,7 @@ public:
     // ── 配置 API ──
 
     /// 设置文本数据源（非拥有指针，调用方负责生命周期）。替代原 setTextBuffer()。
+    /// 数据源销毁前须先调用 setTextSource(nullptr) 停止后台分页并释放游标。
     void setTextSource(ink::TextSource* source);
 
     /// 设置渲染字体
@@ -57,12 +76,20 @@ public:
     /// 返回总页数。索引未完成返回 -1。
     int totalPages() const;
 
-    /// 返回当前页码（0-indexed）
+    /// 返回当前页码（0-indexed）。锚定分页期间为按字节比例估算的临时页码。
     int currentPage() const;
 
-    /// 设置当前页并标记需要重绘
+    /// 设置当前页并标记需要重绘。所需文本未缓存时不等待读取：留在当前页，
+    /// 记下待完成的翻页（turnPending()），文本载入后由 retryPendingTurn() 完成
     void setCurrentPage(int page);
 
+    /// 是否有因文本未缓存而尚未完成的翻页
+    bool turnPending() const { return pendingTurn_ != 0; }
+
+    /// 文本块载入后重试待完成的翻页（UI 线程调用）
+    /// @return true 表示本次完成了翻页
+    bool retryPendingTurn();
+
     /// 返回当前页的起始字节偏移
     uint32_t currentPageOffset() const;
 
@@ -70,7 +97,13 @@ public:
     int pageForByteOffset(uint32_t offset) const;
 
     /// 设置初始目标字节偏移（分页完成后转换为页码）
-    void setInitialByteOffset(uint32_t offset);
+    /// @param raw offset 是否为原始 offset（按 UTF-8 直接读取原文件得到），
+    ///            数据源已是 GBK 转换时先经 TextSource::translateRawOffset() 换算
+    void setInitialByteOffset(uint32_t offset, bool raw = false);
+
+    /// 保存进度用的阅读位置：尚未定位时为初始目标，数据源已切换编码而
+    /// 页索引尚未重建时换算到当前文本
+    uint32_t readingOffset() const;
 
     /// 页索引是否构建完成
     bool isPageIndexComplete() const;
@@ -88,6 +121,10 @@ public:
 private:
     // 文本数据源
     ink::TextSource* textSource_ = nullptr;
+    uint32_t contentVersion_ = 0;  ///< 页索引对应的数据源内容版本
+
+    // 前台渲染的读取游标；后台折行 worker 各自持有 Sequential 游标，互不淘汰对方的文本块
+    ink::TextCursor renderCursor_{ink::CursorMode::Interactive};
 
     // 渲染参数
     const EpdFont* font_ = nullptr;
@@ -95,47 +132,152 @@ private:
     uint8_t paragraphSpacing_ = 8;
     uint8_t textColor_ = 0x00;  // Black
 
-    // 页索引
+    // 页索引与行索引
     PageIndex pageIndex_;
+    LineIndex lineIndex_;
     int currentPage_ = 0;
     char cacheDirPath_[256] = {};
 
     // 后台分页 task
     TaskHandle_t paginateTask_ = nullptr;
-    volatile bool paginateStopRequested_ = false;
+    ink::Job paginateJob_{"paginate", ink::JobPriority::High};  ///< 分页 task 与折行 worker 共用
     volatile bool paginateComplete_ = false;
     bool paginateStarted_ = false;
 
+    // 折行 worker（只在后台分页期间存在）
+    QueueHandle_t sliceQueue_ = nullptr;   ///< 待折行的切片序号，kSliceExit 表示退出
+    QueueHandle_t resultQueue_ = nullptr;  ///< 折行完成的切片
+    std::atomic<int> breakWorkersAlive_{0};
+    volatile bool breakAbort_ = false;
+
+    // glyph 预热 task（首次翻页时启动，直到更换数据源或字体）
+    TaskHandle_t prewarmTask_ = nullptr;
+    QueueHandle_t prewarmQueue_ = nullptr;  ///< 长度 1：新的请求覆盖尚未处理的旧请求
+    ink::Job prewarmJob_{"prewarm", ink::JobPriority::Low};
+    volatile bool prewarmExited_ = false;
+    uint32_t prewarmOffset_ = UINT32_MAX;   ///< 最近一次请求预热时的当前页起点
+
     // 缓存的 viewport 尺寸（后台 task 使用，避免从 View::bounds() 读取）
     int cachedViewportW_ = 0;
     int cachedViewportH_ = 0;
 
+    // 从 pages.idx 检查点续建分页的状态（nextSlice 为 0 表示从头开始）
+    PageIndex::ResumeState resume_;
+
     // 初始目标
     uint32_t initialByteOffset_ = 0;
     bool hasInitialByteOffset_ = false;
+    bool initialOffsetRaw_ = false;  ///< 初始目标是原始 offset，尚待换算
+
+    // 锚定分页（主线程使用）：全局页索引覆盖恢复位置前的临时页
+    bool anchored_ = false;
+    std::vector<uint32_t> anchorPages_;  ///< 锚点附近的临时页起点，升序且首尾相接
+    int anchorPage_ = 0;                 ///< 当前页在 anchorPages_ 中的下标
+    int pendingTurn_ = 0;                ///< 待完成翻页相对当前页的页数（0 表示无）
 
     // 状态回调
     std::function<void()> statusCallback_;
 
     /// 一行的布局信息
-    struct LineInfo {
-        uint32_t start;           ///< 起始字节偏移
-        uint32_t end;             ///< 结束字节偏移（不含）
-        bool isParagraphEnd;      ///< 本行之后有段间距
-    };
+    using LineInfo = LineMeasurer::Line;
+
+    /// 一页最多的行数
+    static constexpr int kMaxPageLines = 64;
 
     /// 一页的布局结果
     struct PageLayout {
-        LineInfo lines[64];       ///< 固定数组避免 heap 分配
+        LineInfo lines[kMaxPageLines];  ///< 固定数组避免 heap 分配
         int lineCount = 0;
         uint32_t endOffset;       ///< 下一页起始偏移
     };
 
+    /// 已绘制页的一行：glyph run 在 DrawnPage::glyphs 中的范围
+    struct DrawnLine {
+        uint32_t firstGlyph;
+        uint16_t glyphCount;
+        int16_t baselineY;        ///< 基线（View 局部坐标）
+    };
+
+    /// 当前页的绘制缓存：逐行的 glyph run
+    struct DrawnPage {
+        uint32_t offset = UINT32_MAX;   ///< 页起始偏移，UINT32_MAX 表示无缓存
+        uint32_t limit = UINT32_MAX;    ///< 临时页的截止偏移（下一页起点）
+        uint32_t endOffset = 0;         ///< 布局得出的下一页起始偏移
+        int lineCount = 0;
+        DrawnLine lines[kMaxPageLines];
+        std::vector<ink::PositionedGlyph> glyphs;
+    };
+
+    /// 当前页的绘制缓存（主线程使用，页索引失效时清除）
+    DrawnPage drawnPage_;
+
+    /// 把当前页的行布局解码为 glyph run，写入绘制缓存
+    void shapePage(const ink::TextSpan& span, uint32_t pageOffset,
+                   uint32_t pageEnd, const PageLayout& layout);
+
+    static constexpr uint32_t kSliceBytes = 64 * 1024;    ///< 每个折行切片的文本字节数
+    static constexpr uint32_t kBreakWindow = 32 * 1024;   ///< 折行时一次读入的文本
+    static constexpr uint32_t kMaxLineBytes = 8 * 1024;   ///< 单行字节数上限（读入窗口余量）
+    static constexpr uint32_t kLineParaEnd = LineIndex::kParagraphEnd;
+    static constexpr uint32_t kSliceExit = UINT32_MAX;    ///< worker 退出标记
+    static constexpr int kMaxBreakWorkers = 8;
+    static constexpr uint32_t kCheckpointSlices = 16;    ///< 每装完 16 个切片（1MB 文本）写一次检查点
+    static constexpr uint32_t kMaxParagraphScan = 256 * 1024;  ///< 锚定分页回溯段落起点的上限
+
+    /// 折行完成的切片：行起点（段落结尾的行或上 kLineParaEnd）
+    struct SliceResult {
+        uint32_t index;
+        std::vector<uint32_t>* lines;  ///< nullptr 表示读取失败或已中止
+    };
+
+    /// 一段待预热的文本；end 为 0 表示终点未知，从 start 布局一页
+    struct PrewarmRange {
+        uint32_t start;
+        uint32_t end;
+    };
+
+    /// 预热请求：先下一页，后上一页
+    struct PrewarmRequest {
+        PrewarmRange ranges[2];
+        uint32_t epoch;     ///< 请求时的 GlyphCache 字体纪元
+        bool exit;          ///< 通知预热 task 退出
+    };
+
+    /// 一页的装页状态
+    struct PackState {
+        int remainingHeight = 0;
+        int lineCount = 0;
+        bool open = false;   ///< 已开始至少一页
+    };
+
+    /// 装页参数：分页 task 启动时取一次，task 不再读取 UI 线程会修改的字段
+    struct PackParams {
+        int lineHeight = 0;
+        int paragraphSpacing = 0;
+        int viewportH = 0;
+        uint32_t paramsHash = 0;  ///< 检查点与 pages.idx 的排版参数键
+    };
+
+    /// 按当前排版参数生成装页参数（主线程调用）
+    PackParams packParams() const;
+
+    /// 分页 task 的装页参数（启动 task 前由主线程写入）
+    PackParams taskParams_;
+
     /// 计算行高（像素）
     int lineHeight() const;
 
-    /// 统一布局引擎：对一页进行折行和填充
-    PageLayout layoutPage(uint32_t startOffset);
+    /// 一页最多可能占用的字节数（64 行 × 256 字节），布局前一次性读入
+    static constexpr uint32_t kMaxPageBytes = 16 * 1024;
+
+    /// 统一布局引擎：通过 cursor 非阻塞读取一页所需的连续文本并折行填充
+    /// @param cursor 调用方线程的读取游标
+    /// @return Pending 表示文本未缓存（已交给后台预读），out 未写入
+    ink::ReadStatus layoutPage(ink::TextCursor& cursor, uint32_t startOffset,
+                               PageLayout* out);
+
+    /// 对已读入的连续文本进行折行和填充（不做 I/O）
+    PageLayout layoutText(const ink::TextSpan& span, uint32_t startOffset);
 
     /// 使页索引失效并停止后台 task
     void invalidatePages();
@@ -152,30 +294,112 @@ private:
     /// 计算排版参数哈希值
     uint32_t paramsHash() const;
 
+    /// 计算折行参数哈希值（字体 + 视口宽度）
+    uint32_t layoutHash() const;
+
     /// 获取 pages.idx 路径
     void getPagesIdxPath(char* buf, int bufSize) const;
 
-    /// BMP 范围 (U+0000-U+FFFF) 的 glyph advance_x 缓存，PSRAM 分配
-    uint8_t* glyphWidthCache_ = nullptr;
+    /// 获取 lines.idx 路径
+    void getLinesIdxPath(char* buf, int bufSize) const;
+
+    /// 从行索引（内存中或 lines.idx）装页，不读取文本
+    /// @return true 如果行索引可用且页索引已构建完成
+    bool derivePagesFromLines();
+
+    /// 折行测量内核（字符宽度表随字体构建，折行 worker 并发只读）
+    LineMeasurer measurer_;
+
+    /// 显示新的一页后请求预热下一页（起点 nextOffset）和上一页
+    void requestPrewarm(uint32_t pageOffset, uint32_t nextOffset);
 
-    /// 构建宽度缓存表
-    void buildWidthCache();
+    /// 启动 glyph 预热 task
+    void startPrewarmTask();
 
-    /// 释放宽度缓存表
-    void freeWidthCache();
+    /// 停止 glyph 预热 task
+    void stopPrewarmTask();
 
-    /// 获取字符宽度（缓存命中为 O(1) 数组访问）
-    int charWidth(uint32_t codepoint) const;
+    /// 预热 task 入口
+    static void prewarmTaskFunc(void* param);
 
-    /// 计算 UTF-8 字符字节长度
-    static int utf8CharLen(uint8_t byte);
+    /// 逐个处理预热请求，直到收到退出请求
+    void runPrewarm();
 
-    /// 解码 UTF-8 codepoint
-    static uint32_t decodeCodepoint(const char* p, int len);
+    /// 解压一段文本中的 glyph
+    /// @return false 表示已取消、字体已卸载或有新的请求
+    bool prewarmRange(ink::JobSlice& slice, ink::TextCursor& cursor,
+                      const PrewarmRange& range, uint32_t epoch);
 
     /// 后台分页 task 入口
     static void paginateTaskFunc(void* param);
 
     /// 执行后台分页
     void doPaginate();
+
+    /// 分发切片、按顺序装页，直到全文完成（返回 true）或中止
+    bool runPagination(int workers);
+
+    /// 把新装好的页和行追加到 pages.idx / lines.idx 并记录续建状态
+    /// （索引已完成时标记完成）
+    void savePagination(uint32_t nextSlice, const PackState& pack);
+
+    /// 按顺序把行装入页（分页 task 逐切片调用，或从行索引一次装完）
+    void packLines(const uint32_t* lines, size_t count,
+                   const PackParams& params, PackState* state);
+
+    /// 折行 worker 入口
+    static void breakWorkerFunc(void* param);
+
+    /// 折行 worker：领取切片序号，折行后交回分页 task
+    void runBreakWorker();
+
+    // ── 锚定分页 ──
+
+    /// 从 offset 所在行开始临时分页；全局页索引已覆盖时直接定位
+    /// @return false 表示文本尚不可用或未缓存（载入后重绘时重试）
+    bool enterAnchor(uint32_t offset);
+
+    /// 锚定分页下翻页：全局页索引覆盖目标位置时切换到全局页码
+    void setAnchoredPage(int page);
+
+    /// 确保临时页链中当前页之后还有一页
+    /// @return Unavailable 表示已是最后一页，Pending 表示文本未缓存
+    ink::ReadStatus extendAnchorForward();
+
+    /// 全局页索引已知包含 offset 的页
+    bool pageIndexCovers(uint32_t offset) const;
+
+    /// 按已知页的平均字节数估算 offset 的页码
+    int provisionalPage(uint32_t offset) const;
+
+    /// 以 end 为下一页起点，从前面的段落起点折行后反向装满一页
+    /// @param out 该页起点；前面没有文本或文本不可用时为 end
+    /// @return Pending 表示文本未缓存
+    ink::ReadStatus previousPageStart(uint32_t end, uint32_t* out);
+
+    /// pos 处或之前最近的段落起点（最多回溯 kMaxParagraphScan，超出时返回回溯下限）
+    /// @return Unavailable 表示文本不可用，Pending 表示文本未缓存
+    ink::ReadStatus paragraphStartBefore(uint32_t pos, uint32_t* out);
+
+    /// 从段落起点 from 折行，收集行首位于 [from, to) 的行。经渲染游标非阻塞
+    /// 读取，文本未缓存时交给后台预读并返回 Pending，不在 UI 线程等待 SD 卡
+    /// @return Unavailable 表示文本不可用
+    ink::ReadStatus collectLines(uint32_t from, uint32_t to,
+                                 std::vector<uint32_t>* out);
+
+    /// 折行一个切片：处理行首位于 [k * kSliceBytes, (k + 1) * kSliceBytes)
+    /// 内的段落，末段越过切片边界时折到段落结束
+    std::vector<uint32_t>* breakSlice(ink::JobSlice& slice,
+                                      ink::TextCursor& cursor, uint32_t k,
+                                      int maxWidth);
+
+    /// 读入 pos 起的折行窗口；文本尚未就绪时等待
+    /// @return false 表示已中止
+    bool readWindow(ink::JobSlice& slice, ink::TextCursor& cursor, uint32_t pos,
+                    ink::TextSpan* span, bool* eof);
+
+    /// begin 处或其后的第一个段落起点（文本末尾时返回文本大小）
+    /// @return false 表示已中止
+    bool findParagraphStart(ink::JobSlice& slice, ink::TextCursor& cursor,
+                            uint32_t begin, uint32_t* out);
 };
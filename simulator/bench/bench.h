@@ -0,0 +1,55 @@
+/**
+ * @file bench.h
+ * @brief 模拟器性能基准 -- 公共工具与各项基准入口。
+ *
+ * parchment_bench <name> [args...]，每项基准独立运行并打印结果。
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace bench {
+
+/// 单调时钟，毫秒
+double nowMs();
+
+/// 生成约 size 字节的 GBK 测试文本（以常用汉字为主，夹杂中文标点、
+/// ASCII 与换行，接近中文小说的字节分布）。
+bool makeGbkFile(const char* path, uint32_t size);
+
+/// 在 /tmp 下创建临时工作目录，path 至少 64 字节
+bool makeWorkDir(char* path);
+
+/// 递归删除目录
+void removeTree(const char* path);
+
+/// 读入整个文件，调用者 free()
+char* loadFile(const char* path, uint32_t* size);
+
+/// 模拟 SD 卡带宽（MB/s，全为 0 时关闭）：之后 fopen 的文件按字节数延迟读写。
+/// 模拟流没有文件描述符，fsync(fileno()) 会失败。
+/// @return false 如果平台不支持（只在 Linux 上链接时包装 fopen）
+bool setSdModel(double readMBs, double writeMBs);
+
+/// GBK -> UTF-8 转换吞吐量（MB/s）：串行基线 vs TextSource 后台转换
+int runConvert(int argc, char** argv);
+
+/// GBK -> UTF-8 转码内核（MB/s）：逐字节对照实现 vs 查表 + 整字 ASCII
+int runGbk(int argc, char** argv);
+
+/// GBK 书籍转换 + 分页端到端耗时（ms）：长度扫描、转换完成与页索引完成
+int runPaginate(int argc, char** argv);
+
+/// 折行测量内核（页/秒）：逐字符对照实现 vs 等宽段 + ASCII 段快路径
+int runLayout(int argc, char** argv);
+
+/// 阅读页绘制耗时（ms/页）：glyph 缓存冷启动 vs 连续翻页 vs 预热，drawTextN vs glyph run
+int runRender(int argc, char** argv);
+
+/// glyph 绘制（ns/glyph）：逐像素对照实现 vs 按物理行扫描 + 混合查表
+int runGlyph(int argc, char** argv);
+
+/// PageIndex 并发压力：一个写者追加页，多个读者在增长的尾部校验查询
+int runPageIndex(int argc, char** argv);
+
+}  // namespace bench
@@ -0,0 +1,206 @@
+/**
+ * @file bench_convert.cpp
+ * @brief GBK -> UTF-8 转换吞吐量基准。
+ *
+ * 串行基线按旧实现顺序 fread -> 转码 -> fwrite；另一侧走完整的 TextSource
+ * 打开流程（长度扫描 + 后台分段转换，直到 Ready），并校验两者输出逐字节
+ * 一致。吞吐量按 GBK 源字节数计算。
+ *
+ * 串行基线只包含转换，与它对比的是后台转换阶段（长度扫描完成到 Ready）；
+ * 长度扫描是随机访问多出的一遍读取，单独列出。主机页缓存下 I/O 几乎
+ * 不耗时，两者只差在转码本身；--sd 按 SD 卡带宽模拟读写延迟，此时读写
+ * 占满总线，转码只占几个百分点。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "bench.h"
+#include "text_source/TextSource.h"
+
+extern "C" {
+#include "text_encoding.h"
+}
+
+namespace bench {
+
+static constexpr uint32_t kChunk = 64 * 1024;
+static constexpr uint32_t kDefaultSize = 16 * 1024 * 1024;
+static constexpr uint32_t kDefaultSdSize = 4 * 1024 * 1024;  ///< --sd 时的默认大小
+static constexpr double kSdReadMBs = 10.0;   ///< --sd 默认读带宽
+static constexpr double kSdWriteMBs = 5.0;   ///< --sd 默认写带宽
+
+/// 串行基线：读一段、转一段、写一段
+static bool convertSerial(const char* src, const char* dst) {
+    FILE* in = fopen(src, "rb");
+    FILE* out = fopen(dst, "wb");
+    char* inBuf = static_cast<char*>(malloc(kChunk));
+    char* outBuf = static_cast<char*>(malloc(kChunk * 3));
+    bool ok = in && out && inBuf && outBuf;
+
+    uint32_t carry = 0;
+    while (ok) {
+        size_t n = fread(inBuf + carry, 1, kChunk - carry, in);
+        size_t len = carry + n;
+        if (len == 0) break;
+        bool final = n < kChunk - carry;
+
+        // 段末不完整的首字节留到下一段
+        size_t used = 0;
+        text_encoding_gbk_utf8_len(inBuf, len, final, &used);
+        size_t outLen = kChunk * 3;
+        text_encoding_gbk_to_utf8(inBuf, used, outBuf, &outLen);
+        ok = fwrite(outBuf, 1, outLen, out) == outLen;
+
+        carry = static_cast<uint32_t>(len - used);
+        memmove(inBuf, inBuf + used, carry);
+        if (final) break;
+    }
+
+    if (in) fclose(in);
+    if (out) fclose(out);
+    free(inBuf);
+    free(outBuf);
+    return ok;
+}
+
+/// 只转码（源已在内存中）：按同样的分段转码整个文件，返回耗时 ms
+static double transcodeMs(const char* src, uint32_t size) {
+    char* outBuf = static_cast<char*>(malloc(kChunk * 3));
+    if (!outBuf) return 0;
+    double t0 = nowMs();
+    for (uint32_t pos = 0; pos < size;) {
+        uint32_t len = size - pos < kChunk ? size - pos : kChunk;
+        size_t used = 0;
+        text_encoding_gbk_utf8_len(src + pos, len, pos + len == size, &used);
+        if (used == 0) break;
+        size_t outLen = kChunk * 3;
+        text_encoding_gbk_to_utf8(src + pos, used, outBuf, &outLen);
+        pos += static_cast<uint32_t>(used);
+    }
+    double ms = nowMs() - t0;
+    free(outBuf);
+    return ms;
+}
+
+static bool sameContent(const char* a, const char* b, uint32_t len) {
+    uint32_t sizeA = 0, sizeB = 0;
+    char* bufA = loadFile(a, &sizeA);
+    char* bufB = loadFile(b, &sizeB);
+    bool same = bufA && bufB && sizeA >= len && sizeB >= len &&
+                memcmp(bufA, bufB, len) == 0;
+    free(bufA);
+    free(bufB);
+    return same;
+}
+
+static int convertIn(const char* workDir, int argc, char** argv) {
+    // --sd[=读,写]：按 MB/s 模拟 SD 卡读写带宽
+    double sdRead = 0, sdWrite = 0;
+    if (argc > 0 && strncmp(argv[0], "--sd", 4) == 0) {
+        sdRead = kSdReadMBs;
+        sdWrite = kSdWriteMBs;
+        if (argv[0][4] == '=' &&
+            sscanf(argv[0] + 5, "%lf,%lf", &sdRead, &sdWrite) != 2) {
+            fprintf(stderr, "usage: convert [--sd[=read,write MB/s]] [gbk-file]\n");
+            return 1;
+        }
+        argc--;
+        argv++;
+    }
+
+    char srcPath[256];
+    if (argc > 0) {
+        snprintf(srcPath, sizeof(srcPath), "%s", argv[0]);
+    } else {
+        snprintf(srcPath, sizeof(srcPath), "%s/novel_gbk.txt", workDir);
+        if (!makeGbkFile(srcPath, sdRead > 0 ? kDefaultSdSize : kDefaultSize)) {
+            fprintf(stderr, "Failed to generate %s\n", srcPath);
+            return 1;
+        }
+    }
+
+    // 预热页缓存，两边都从内存读源文件
+    uint32_t srcSize = 0;
+    char* src = loadFile(srcPath, &srcSize);
+    if (!src || srcSize == 0) {
+        fprintf(stderr, "Cannot read %s\n", srcPath);
+        free(src);
+        return 1;
+    }
+    double cpuMs = transcodeMs(src, srcSize);
+    free(src);
+    double mb = srcSize / (1024.0 * 1024.0);
+    printf("source: %s (%.1f MB)\n", srcPath, mb);
+    if (sdRead > 0) {
+        if (!setSdModel(sdRead, sdWrite)) {
+            fprintf(stderr, "SD model not supported on this platform\n");
+            return 1;
+        }
+        printf("SD model: read %.1f MB/s, write %.1f MB/s, one shared bus\n",
+               sdRead, sdWrite);
+    } else {
+        printf("SD model: off (host page cache, I/O nearly free)\n");
+    }
+
+    char serialOut[280];
+    snprintf(serialOut, sizeof(serialOut), "%s/serial.utf8", workDir);
+    double t0 = nowMs();
+    if (!convertSerial(srcPath, serialOut)) {
+        fprintf(stderr, "Serial conversion failed\n");
+        return 1;
+    }
+    double serialMs = nowMs() - t0;
+
+    char cacheDir[280];
+    snprintf(cacheDir, sizeof(cacheDir), "%s/cache", workDir);
+    ink::TextSource source;
+    t0 = nowMs();
+    if (!source.open(srcPath, cacheDir)) {
+        fprintf(stderr, "TextSource open failed\n");
+        return 1;
+    }
+    double openMs = nowMs() - t0;
+    double sizedMs = 0;
+    while (source.state() != ink::TextSourceState::Ready) {
+        if (sizedMs == 0 && source.totalSize() > 0) sizedMs = nowMs() - t0;
+        usleep(200);
+    }
+    double readyMs = nowMs() - t0;
+    uint32_t total = source.totalSize();
+    source.close();
+    setSdModel(0, 0);
+
+    // 与串行基线对比的是转换阶段；长度扫描是随机访问额外的一遍读取
+    double convMs = readyMs - sizedMs;
+    printf("convert (read + transcode + write):\n");
+    printf("  transcode  %8.1f ms  %7.1f MB/s  (in memory, no I/O)\n", cpuMs,
+           mb * 1000.0 / cpuMs);
+    printf("  serial     %8.1f ms  %7.1f MB/s\n", serialMs,
+           mb * 1000.0 / serialMs);
+    printf("  background %8.1f ms  %7.1f MB/s  (%.2fx)\n", convMs,
+           mb * 1000.0 / convMs, serialMs / convMs);
+    printf("TextSource open to Ready: %.1f ms (open %.1f ms, sizing scan %.1f ms)\n",
+           readyMs, openMs, sizedMs);
+
+    char cacheOut[300];
+    snprintf(cacheOut, sizeof(cacheOut), "%s/text.utf8", cacheDir);
+    bool same = sameContent(serialOut, cacheOut, total);
+    printf("output %s (%u bytes UTF-8)\n", same ? "identical" : "MISMATCH",
+           total);
+    return same ? 0 : 1;
+}
+
+int runConvert(int argc, char** argv) {
+    char workDir[64];
+    if (!makeWorkDir(workDir)) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    int rc = convertIn(workDir, argc, argv);
+    removeTree(workDir);
+    return rc;
+}
+
+}  // namespace bench
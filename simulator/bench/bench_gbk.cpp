@@ -0,0 +1,155 @@
+/**
+ * @file bench_gbk.cpp
+ * @brief GBK -> UTF-8 转码内核微基准。
+ *
+ * 对照实现是查表改版前的逐字节版本（码位表 + 逐字符编码），两者对同一
+ * 输入的输出逐字节比较，再分别计时转码与长度扫描。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "bench.h"
+
+extern "C" {
+#include "text_encoding.h"
+extern const uint16_t gbk_to_unicode[126][190];
+}
+
+namespace bench {
+
+static constexpr uint32_t kDefaultSize = 8 * 1024 * 1024;
+static constexpr double kMinRunMs = 500.0;
+
+static size_t encodeUtf8Ref(uint16_t cp, char* dst, size_t remaining) {
+    if (cp < 0x80) {
+        if (remaining < 1) return 0;
+        dst[0] = static_cast<char>(cp);
+        return 1;
+    } else if (cp < 0x800) {
+        if (remaining < 2) return 0;
+        dst[0] = static_cast<char>(0xC0 | (cp >> 6));
+        dst[1] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (remaining < 3) return 0;
+    dst[0] = static_cast<char>(0xE0 | (cp >> 12));
+    dst[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    dst[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+}
+
+/// 逐字节对照实现
+static size_t gbkToUtf8Ref(const char* src, size_t srcLen, char* dst,
+                           size_t capacity) {
+    size_t di = 0;
+    size_t si = 0;
+    while (si < srcLen) {
+        uint8_t b = static_cast<uint8_t>(src[si]);
+        if (b < 0x80) {
+            if (di >= capacity) break;
+            dst[di++] = static_cast<char>(b);
+            si++;
+        } else if (b >= 0x81 && b <= 0xFE && si + 1 < srcLen) {
+            uint8_t lo = static_cast<uint8_t>(src[si + 1]);
+            uint16_t cp = 0;
+            if (lo >= 0x40 && lo <= 0xFE && lo != 0x7F) {
+                int col = lo < 0x80 ? lo - 0x40 : lo - 0x41;
+                cp = gbk_to_unicode[b - 0x81][col];
+            }
+            size_t n = encodeUtf8Ref(cp ? cp : 0xFFFD, dst + di, capacity - di);
+            if (n == 0) break;
+            di += n;
+            si += 2;
+        } else {
+            size_t n = encodeUtf8Ref(0xFFFD, dst + di, capacity - di);
+            if (n == 0) break;
+            di += n;
+            si++;
+        }
+    }
+    return di;
+}
+
+/// 重复运行 fn 至少 kMinRunMs，返回 MB/s
+template <typename Fn>
+static double measure(uint32_t bytes, Fn fn) {
+    fn();  // 预热
+    int runs = 0;
+    double t0 = nowMs();
+    double elapsed = 0;
+    do {
+        fn();
+        runs++;
+        elapsed = nowMs() - t0;
+    } while (elapsed < kMinRunMs);
+    return bytes / (1024.0 * 1024.0) * runs * 1000.0 / elapsed;
+}
+
+static int gbkIn(const char* workDir, int argc, char** argv) {
+    char srcPath[256];
+    if (argc > 0) {
+        snprintf(srcPath, sizeof(srcPath), "%s", argv[0]);
+    } else {
+        snprintf(srcPath, sizeof(srcPath), "%s/novel_gbk.txt", workDir);
+        if (!makeGbkFile(srcPath, kDefaultSize)) {
+            fprintf(stderr, "Failed to generate %s\n", srcPath);
+            return 1;
+        }
+    }
+
+    uint32_t srcSize = 0;
+    char* src = loadFile(srcPath, &srcSize);
+    if (!src || srcSize == 0) {
+        fprintf(stderr, "Cannot read %s\n", srcPath);
+        free(src);
+        return 1;
+    }
+    printf("source: %s (%.1f MB)\n", srcPath, srcSize / (1024.0 * 1024.0));
+
+    size_t capacity = static_cast<size_t>(srcSize) * 3;
+    char* refOut = static_cast<char*>(malloc(capacity));
+    char* fastOut = static_cast<char*>(malloc(capacity));
+
+    size_t refLen = gbkToUtf8Ref(src, srcSize, refOut, capacity);
+    size_t fastLen = capacity;
+    text_encoding_gbk_to_utf8(src, srcSize, fastOut, &fastLen);
+    size_t sized = text_encoding_gbk_utf8_len(src, srcSize, true, nullptr);
+    bool same = refLen == fastLen && sized == refLen &&
+                memcmp(refOut, fastOut, refLen) == 0;
+    printf("output %s (%zu bytes UTF-8)\n", same ? "identical" : "MISMATCH",
+           refLen);
+
+    double refRate = measure(srcSize, [&]() {
+        gbkToUtf8Ref(src, srcSize, refOut, capacity);
+    });
+    double fastRate = measure(srcSize, [&]() {
+        size_t len = capacity;
+        text_encoding_gbk_to_utf8(src, srcSize, fastOut, &len);
+    });
+    double lenRate = measure(srcSize, [&]() {
+        text_encoding_gbk_utf8_len(src, srcSize, true, nullptr);
+    });
+
+    printf("reference  %8.1f MB/s\n", refRate);
+    printf("table+SWAR %8.1f MB/s  (%.2fx)\n", fastRate, fastRate / refRate);
+    printf("utf8_len   %8.1f MB/s\n", lenRate);
+
+    free(src);
+    free(refOut);
+    free(fastOut);
+    return same ? 0 : 1;
+}
+
+int runGbk(int argc, char** argv) {
+    char workDir[64];
+    if (!makeWorkDir(workDir)) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    int rc = gbkIn(workDir, argc, argv);
+    removeTree(workDir);
+    return rc;
+}
+
+}  // namespace bench
@@ -0,0 +1,235 @@
+/**
+ * @file bench_glyph.cpp
+ * @brief glyph 绘制微基准（ns/glyph）。
+ *
+ * 对照实现是逐像素路径（改版前的 Canvas::drawChar）：每个像素都检查
+ * 裁剪和屏幕边界、做竖屏→横屏坐标变换，半透明像素先读背景再除以 15。
+ * 两者在同一裁剪区域内绘制同样的文字行（含被裁掉一部分的 glyph），
+ * 背景为白色和灰度条纹，前景为黑色和深灰，逐字节比较 framebuffer 后
+ * 再分别计时。glyph 已全部在缓存中，计时只反映绘制本身。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "bench.h"
+#include "ink_ui/core/Canvas.h"
+#include "ink_ui/core/GlyphCache.h"
+#include "ink_ui/hal/DisplayDriver.h"
+#include "views/LineMeasurer.h"
+
+extern "C" {
+#include "ui_font.h"
+}
+
+namespace bench {
+
+static constexpr double kMinRunMs = 500.0;
+static constexpr int kFbSize = ink::kScreenWidth * ink::kScreenHeight / 2;
+static constexpr int kPhysStride = ink::kFbPhysWidth / 2;
+
+/// 裁剪区域：四边都有 glyph 被截断
+static constexpr ink::Rect kClip = {20, 30, 500, 900};
+
+static const char kSample[] =
+    "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。“寒来暑往”——秋收冬藏！"
+    "Hello, world 0123456789 gjpqy";
+
+// ── 对照实现：逐像素 ──
+
+static void setPixelRef(uint8_t* fb, int absX, int absY, uint8_t gray) {
+    if (absX < kClip.x || absX >= kClip.right() ||
+        absY < kClip.y || absY >= kClip.bottom()) {
+        return;
+    }
+    if (absX < 0 || absX >= 540 || absY < 0 || absY >= 960) return;
+    int px = absY;
+    int py = (ink::kFbPhysHeight - 1) - absX;
+    uint8_t* p = &fb[py * kPhysStride + px / 2];
+    if (px & 1) {
+        *p = (*p & 0x0F) | (gray & 0xF0);
+    } else {
+        *p = (*p & 0xF0) | (gray >> 4);
+    }
+}
+
+static uint8_t getPixelRef(const uint8_t* fb, int absX, int absY) {
+    if (absX < 0 || absX >= 540 || absY < 0 || absY >= 960) return 0xFF;
+    int px = absY;
+    int py = (ink::kFbPhysHeight - 1) - absX;
+    uint8_t b = fb[py * kPhysStride + px / 2];
+    return (px & 1) ? (b & 0xF0) : static_cast<uint8_t>((b & 0x0F) << 4);
+}
+
+static void drawCharRef(uint8_t* fb, const EpdFont* font, uint32_t cp,
+                        int* cursorX, int cursorY, uint8_t color) {
+    const EpdGlyph* glyph = epd_get_glyph(font, cp);
+    if (!glyph) return;
+    int w = glyph->width;
+    int h = glyph->height;
+    int byteWidth = w / 2 + w % 2;
+
+    ink::GlyphCache& cache = ink::GlyphCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    const uint8_t* bitmap = cache.bitmap(font, glyph);
+    if (!bitmap) {
+        *cursorX += glyph->advance_x;
+        return;
+    }
+
+    uint8_t fg4 = color >> 4;
+    for (int by = 0; by < h; by++) {
+        int absY = cursorY - glyph->top + by;
+        if (absY < kClip.y || absY >= kClip.bottom()) continue;
+        for (int bx = 0; bx < w; bx++) {
+            int absX = *cursorX + glyph->left + bx;
+            if (absX < kClip.x || absX >= kClip.right()) continue;
+            uint8_t bm = bitmap[by * byteWidth + bx / 2];
+            uint8_t alpha = (bx & 1) ? (bm >> 4) : (bm & 0x0F);
+            if (alpha == 0) continue;
+            if (alpha == 0x0F) {
+                setPixelRef(fb, absX, absY, color);
+            } else {
+                uint8_t bg4 = getPixelRef(fb, absX, absY) >> 4;
+                uint8_t c4 = static_cast<uint8_t>(
+                    bg4 + static_cast<int>(alpha) *
+                    (static_cast<int>(fg4) - static_cast<int>(bg4)) / 15);
+                setPixelRef(fb, absX, absY, c4 << 4);
+            }
+        }
+    }
+    *cursorX += glyph->advance_x;
+}
+
+/// 逐字绘制一行（局部坐标），与 Canvas::drawTextN 的解码方式一致
+static void drawLineRef(uint8_t* fb, const EpdFont* font, const char* text,
+                        int len, int x, int y, uint8_t color) {
+    int cursorX = kClip.x + x;
+    int cursorY = kClip.y + y;
+    int pos = 0;
+    while (pos < len) {
+        int cLen = LineMeasurer::utf8CharLen(static_cast<uint8_t>(text[pos]));
+        if (pos + cLen > len) break;
+        uint32_t cp = LineMeasurer::decodeCodepoint(text + pos, cLen);
+        pos += cLen;
+        drawCharRef(fb, font, cp, &cursorX, cursorY, color);
+    }
+}
+
+// ── 测试页 ──
+
+/// 一个绘制场景：整块背景 + 若干行文字
+struct Scene {
+    const char* name;
+    bool stripes;     ///< 背景为灰度条纹（否则为白色）
+    uint8_t color;    ///< 文字颜色
+};
+
+static void fillBackground(uint8_t* fb, bool stripes) {
+    if (!stripes) {
+        memset(fb, 0xFF, kFbSize);
+        return;
+    }
+    // 每个物理字节两个不同灰度，半透明像素的背景各不相同
+    for (int i = 0; i < kFbSize; i++) {
+        fb[i] = static_cast<uint8_t>(((i * 7) & 0x0F) | (((i * 5 + 3) & 0x0F) << 4));
+    }
+}
+
+/// 画满整个测试页，返回绘制的 glyph 数；draw(text, len, x, y)
+template <typename Draw>
+static int drawScene(const EpdFont* font, Draw draw) {
+    int len = static_cast<int>(strlen(kSample));
+    int glyphs = 0;
+    for (int pos = 0; pos < len;) {
+        pos += LineMeasurer::utf8CharLen(static_cast<uint8_t>(kSample[pos]));
+        glyphs++;
+    }
+
+    int count = 0;
+    int step = font->advance_y + 3;
+    // 起点错开奇偶和左右边界，覆盖各种 nibble 对齐和裁剪
+    for (int i = 0, y = -font->ascender / 2; y < kClip.h + step; i++, y += step) {
+        int x = (i % 5) * 7 - 13;
+        draw(kSample, len, x, y + font->ascender);
+        count += glyphs;
+    }
+    return count;
+}
+
+template <typename Fn>
+static double measureNs(int glyphs, Fn fn) {
+    fn();
+    int runs = 0;
+    double t0 = nowMs();
+    double elapsed = 0;
+    do {
+        fn();
+        runs++;
+        elapsed = nowMs() - t0;
+    } while (elapsed < kMinRunMs);
+    return elapsed * 1e6 / (static_cast<double>(glyphs) * runs);
+}
+
+static bool benchFont(const EpdFont* font, int size, uint8_t* refFb,
+                      uint8_t* fastFb) {
+    static const Scene kScenes[] = {
+        {"black on white", false, ink::Color::Black},
+        {"dark on stripes", true, ink::Color::Dark},
+    };
+
+    ink::Canvas canvas(fastFb, kClip);
+    bool ok = true;
+    for (const Scene& sc : kScenes) {
+        auto ref = [&](const char* t, int n, int x, int y) {
+            drawLineRef(refFb, font, t, n, x, y, sc.color);
+        };
+        auto fast = [&](const char* t, int n, int x, int y) {
+            canvas.drawTextN(font, t, n, x, y, sc.color);
+        };
+
+        fillBackground(refFb, sc.stripes);
+        fillBackground(fastFb, sc.stripes);
+        int glyphs = drawScene(font, ref);
+        drawScene(font, fast);
+        bool same = memcmp(refFb, fastFb, kFbSize) == 0;
+        ok &= same;
+
+        double refNs = measureNs(glyphs, [&]() { drawScene(font, ref); });
+        double fastNs = measureNs(glyphs, [&]() { drawScene(font, fast); });
+        printf("%dpx %s (%d glyphs/page): pixels %s\n", size, sc.name, glyphs,
+               same ? "identical" : "MISMATCH");
+        printf("  per-pixel  %8.1f ns/glyph\n", refNs);
+        printf("  scanline   %8.1f ns/glyph  (%.2fx)\n", fastNs, refNs / fastNs);
+    }
+    return ok;
+}
+
+int runGlyph(int argc, char** argv) {
+    ui_font_init();
+    uint8_t* refFb = static_cast<uint8_t*>(malloc(kFbSize));
+    uint8_t* fastFb = static_cast<uint8_t*>(malloc(kFbSize));
+    if (!refFb || !fastFb) {
+        free(refFb);
+        free(fastFb);
+        return 1;
+    }
+
+    static const int kSizes[] = {24, 32};
+    bool ok = true;
+    int fonts = 0;
+    for (int size : kSizes) {
+        const EpdFont* font = ui_font_get(size);
+        if (!font) continue;
+        ok &= benchFont(font, size, refFb, fastFb);
+        fonts++;
+    }
+    if (fonts == 0) fprintf(stderr, "No reading fonts\n");
+
+    free(refFb);
+    free(fastFb);
+    return ok && fonts > 0 ? 0 : 1;
+}
+
+}  // namespace bench
@@ -0,0 +1,236 @@
+/**
+ * @file bench_layout.cpp
+ * @brief 折行测量内核基准（页/秒）。
+ *
+ * 对照实现是快路径改版前的逐字符折行（解码 codepoint、查宽度表、累加
+ * 比较）。两者按阅读页的尺寸、行高和段间距把整本书装页，比较每一行的
+ * 起止偏移和段落标记，再分别计时。
+ *
+ * 语料默认取 simulator/data/book 下的全部 .txt（GBK 先转为 UTF-8），
+ * 另附一本生成的中文小说，也可在参数中指定文件。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+
+#include "bench.h"
+#include "views/LineMeasurer.h"
+
+extern "C" {
+#include "text_encoding.h"
+#include "ui_font.h"
+}
+
+namespace bench {
+
+static constexpr uint32_t kNovelSize = 4 * 1024 * 1024;
+static constexpr double kMinRunMs = 500.0;
+static constexpr int kFontSize = 32;
+
+/// 阅读页参数（与 ReaderContentView 默认值一致）
+static constexpr int kViewW = 540;
+static constexpr int kViewH = 880;
+static constexpr int kLineSpacing10x = 16;
+static constexpr int kParagraphSpacing = 8;
+static constexpr int kMaxPageLines = 64;
+
+using Line = LineMeasurer::Line;
+
+/// 逐字符对照实现
+static uint32_t breakLineRef(const LineMeasurer& m, const char* buf,
+                             uint32_t len, uint32_t pos, int maxWidth,
+                             Line* line) {
+    if (buf[pos] == '\n') {
+        *line = {pos, pos, true};
+        return pos + 1;
+    }
+    if (buf[pos] == '\r') {
+        *line = {pos, pos, true};
+        pos++;
+        if (pos < len && buf[pos] == '\n') pos++;
+        return pos;
+    }
+
+    uint32_t lineStart = pos;
+    int lineWidth = 0;
+    while (pos < len && buf[pos] != '\n' && buf[pos] != '\r') {
+        int cLen = LineMeasurer::utf8CharLen(static_cast<uint8_t>(buf[pos]));
+        if (pos + cLen > len) break;
+        int cw = m.charWidth(LineMeasurer::decodeCodepoint(buf + pos, cLen));
+        if (lineWidth + cw > maxWidth && pos > lineStart) break;
+        lineWidth += cw;
+        pos += cLen;
+    }
+    if (pos == lineStart && pos < len) {
+        pos += LineMeasurer::utf8CharLen(static_cast<uint8_t>(buf[pos]));
+    }
+
+    uint32_t lineEnd = pos;
+    bool isParagraphEnd = false;
+    if (pos < len && buf[pos] == '\n') {
+        isParagraphEnd = true;
+        pos++;
+    } else if (pos < len && buf[pos] == '\r') {
+        isParagraphEnd = true;
+        pos++;
+        if (pos < len && buf[pos] == '\n') pos++;
+    }
+    *line = {lineStart, lineEnd, isParagraphEnd};
+    return pos;
+}
+
+/// 把整本书装页，返回页数；hash 累积每一行的起止偏移和段落标记
+template <typename Break>
+static int layoutBook(const char* text, uint32_t len, int lh, Break brk,
+                      uint32_t* hash) {
+    uint32_t h = 2166136261u;
+    int pages = 0;
+    uint32_t pos = 0;
+    while (pos < len) {
+        pages++;
+        int remaining = kViewH;
+        int lines = 0;
+        while (pos < len && remaining >= lh && lines < kMaxPageLines) {
+            Line line;
+            pos = brk(text, len, pos, &line);
+            h = (h ^ line.start) * 16777619u;
+            h = (h ^ line.end) * 16777619u;
+            h = (h ^ (line.isParagraphEnd ? 1u : 0u)) * 16777619u;
+            lines++;
+            remaining -= lh;
+            if (line.isParagraphEnd) remaining -= kParagraphSpacing;
+        }
+    }
+    if (hash) *hash = h;
+    return pages;
+}
+
+/// 重复装页至少 kMinRunMs，返回页/秒
+template <typename Fn>
+static double measure(int pages, Fn fn) {
+    fn();  // 预热
+    int runs = 0;
+    double t0 = nowMs();
+    double elapsed = 0;
+    do {
+        fn();
+        runs++;
+        elapsed = nowMs() - t0;
+    } while (elapsed < kMinRunMs);
+    return static_cast<double>(pages) * runs * 1000.0 / elapsed;
+}
+
+/// 读入文件并按需转为 UTF-8，调用者 free()
+static char* loadUtf8(const char* path, uint32_t* size) {
+    uint32_t srcSize = 0;
+    char* src = loadFile(path, &srcSize);
+    if (!src || srcSize == 0) {
+        free(src);
+        return nullptr;
+    }
+    if (text_encoding_detect(src, srcSize) != TEXT_ENCODING_GBK) {
+        *size = srcSize;
+        return src;
+    }
+    size_t capacity = static_cast<size_t>(srcSize) * 3;
+    char* utf8 = static_cast<char*>(malloc(capacity));
+    size_t len = capacity;
+    if (utf8) text_encoding_gbk_to_utf8(src, srcSize, utf8, &len);
+    free(src);
+    *size = static_cast<uint32_t>(len);
+    return utf8;
+}
+
+/// 对一本书比较两种实现并计时，返回 true 如果折行一致
+static bool benchBook(const LineMeasurer& m, int lh, const char* path) {
+    uint32_t len = 0;
+    char* text = loadUtf8(path, &len);
+    if (!text) {
+        fprintf(stderr, "Cannot read %s\n", path);
+        return false;
+    }
+
+    auto ref = [&](const char* buf, uint32_t n, uint32_t pos, Line* line) {
+        return breakLineRef(m, buf, n, pos, kViewW, line);
+    };
+    auto fast = [&](const char* buf, uint32_t n, uint32_t pos, Line* line) {
+        return m.breakLine(buf, n, pos, kViewW, line);
+    };
+
+    uint32_t refHash = 0, fastHash = 0;
+    int pages = layoutBook(text, len, lh, ref, &refHash);
+    int fastPages = layoutBook(text, len, lh, fast, &fastHash);
+    bool same = pages == fastPages && refHash == fastHash;
+
+    double refRate = measure(pages, [&]() {
+        layoutBook(text, len, lh, ref, nullptr);
+    });
+    double fastRate = measure(pages, [&]() {
+        layoutBook(text, len, lh, fast, nullptr);
+    });
+
+    const char* name = strrchr(path, '/');
+    printf("%s (%.1f KB, %d pages): lines %s\n", name ? name + 1 : path,
+           len / 1024.0, pages, same ? "identical" : "MISMATCH");
+    printf("  reference  %10.0f pages/s\n", refRate);
+    printf("  fast paths %10.0f pages/s  (%.2fx)\n", fastRate,
+           fastRate / refRate);
+
+    free(text);
+    return same;
+}
+
+static int layoutIn(const char* workDir, int argc, char** argv) {
+    ui_font_init();
+    const EpdFont* font = ui_font_get(kFontSize);
+    if (!font) {
+        fprintf(stderr, "No %dpx reading font\n", kFontSize);
+        return 1;
+    }
+    LineMeasurer measurer;
+    measurer.setFont(font);
+    int lh = font->advance_y * kLineSpacing10x / 10;
+    if (lh < font->advance_y) lh = font->advance_y;
+
+    bool ok = true;
+    if (argc > 0) {
+        for (int i = 0; i < argc; i++) ok &= benchBook(measurer, lh, argv[i]);
+        return ok ? 0 : 1;
+    }
+
+    DIR* dir = opendir(BOOK_DIR);
+    if (dir) {
+        struct dirent* e;
+        while ((e = readdir(dir)) != nullptr) {
+            size_t n = strlen(e->d_name);
+            if (n < 4 || strcmp(e->d_name + n - 4, ".txt") != 0) continue;
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s", BOOK_DIR, e->d_name);
+            ok &= benchBook(measurer, lh, path);
+        }
+        closedir(dir);
+    }
+
+    char novel[256];
+    snprintf(novel, sizeof(novel), "%s/novel_gbk.txt", workDir);
+    if (!makeGbkFile(novel, kNovelSize)) {
+        fprintf(stderr, "Failed to generate %s\n", novel);
+        return 1;
+    }
+    ok &= benchBook(measurer, lh, novel);
+    return ok ? 0 : 1;
+}
+
+int runLayout(int argc, char** argv) {
+    char workDir[64];
+    if (!makeWorkDir(workDir)) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    int rc = layoutIn(workDir, argc, argv);
+    removeTree(workDir);
+    return rc;
+}
+
+}  // namespace bench
@@ -0,0 +1,138 @@
+/**
+ * @file bench_main.cpp
+ * @brief parchment_bench 入口 -- 按名称分派基准。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <ftw.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+namespace bench {
+
+double nowMs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+bool makeGbkFile(const char* path, uint32_t size) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+
+    // GB2312 一级汉字区 B0A1-D7FE，全部有映射
+    static const char* kPunct[] = {"\xA3\xAC", "\xA1\xA3", "\xA3\xBF",
+                                   "\xA1\xB0", "\xA1\xB1", "\xA3\xA1"};
+    uint32_t seed = 12345;
+    auto rnd = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    char line[512];
+    uint32_t written = 0;
+    while (written < size) {
+        int n = 0;
+        // 段首两个全角空格
+        memcpy(line, "\xA1\xA1\xA1\xA1", 4);
+        n = 4;
+        int chars = 40 + rnd() % 160;
+        for (int i = 0; i < chars; i++) {
+            uint32_t r = rnd() % 100;
+            if (r < 8) {
+                memcpy(line + n, kPunct[rnd() % 6], 2);
+                n += 2;
+            } else if (r < 11) {
+                line[n++] = static_cast<char>('0' + rnd() % 10);
+            } else {
+                line[n++] = static_cast<char>(0xB0 + rnd() % 40);
+                line[n++] = static_cast<char>(0xA1 + rnd() % 94);
+            }
+        }
+        line[n++] = '\n';
+        fwrite(line, 1, n, f);
+        written += n;
+    }
+    fclose(f);
+    return true;
+}
+
+bool makeWorkDir(char* path) {
+    strcpy(path, "/tmp/parchment_bench_XXXXXX");
+    return mkdtemp(path) != nullptr;
+}
+
+static int removeEntry(const char* path, const struct stat* st, int flag,
+                       struct FTW* ftw) {
+    (void)st; (void)flag; (void)ftw;
+    return remove(path);
+}
+
+void removeTree(const char* path) {
+    nftw(path, removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+char* loadFile(const char* path, uint32_t* size) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return nullptr;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* buf = static_cast<char*>(malloc(len > 0 ? len : 1));
+    if (buf && fread(buf, 1, len, f) != static_cast<size_t>(len)) {
+        free(buf);
+        buf = nullptr;
+    }
+    fclose(f);
+    if (buf) *size = static_cast<uint32_t>(len);
+    return buf;
+}
+
+}  // namespace bench
+
+struct BenchEntry {
+    const char* name;
+    const char* help;
+    int (*run)(int argc, char** argv);
+};
+
+static const BenchEntry kBenches[] = {
+    {"convert", "[--sd[=r,w]] [gbk-file]  GBK->UTF-8 conversion throughput (MB/s)",
+     bench::runConvert},
+    {"gbk", "[gbk-file]  GBK->UTF-8 kernel throughput vs reference (MB/s)",
+     bench::runGbk},
+    {"paginate", "[gbk-file]  Converted-and-indexed end-to-end time (ms)",
+     bench::runPaginate},
+    {"layout", "[utf8-or-gbk-file...]  Line-break kernel vs reference (pages/s)",
+     bench::runLayout},
+    {"render", "[text-file]  Reading page draw time: glyph cache cold/warm/prewarmed, glyph runs (ms/page)",
+     bench::runRender},
+    {"glyph", "Glyph blit vs per-pixel reference (ns/glyph)",
+     bench::runGlyph},
+    {"pageindex", "[pages] [readers]  PageIndex writer/reader stress, query cost (ns)",
+     bench::runPageIndex},
+};
+
+static void usage() {
+    printf("usage: parchment_bench <name> [args...]\n");
+    for (const auto& b : kBenches) {
+        printf("  %-10s %s\n", b.name, b.help);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+    for (const auto& b : kBenches) {
+        if (strcmp(argv[1], b.name) == 0) {
+            return b.run(argc - 2, argv + 2);
+        }
+    }
+    usage();
+    return 1;
+}
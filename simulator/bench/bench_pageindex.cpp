@@ -0,0 +1,185 @@
+/**
+ * @file bench_pageindex.cpp
+ * @brief PageIndex 并发读写压力测试与查询耗时。
+ *
+ * 一个写者线程按分页 task 的方式逐页 addPage()，若干读者线程同时
+ * 查询：大部分查询落在正在增长的尾部（未编码的尾块与刚编码的块，
+ * 双缓冲被复用的窗口），其余随机分布在已知范围内。页偏移由确定的
+ * 伪随机页长生成，读者对照预先算好的参考表逐次校验 pageOffset() 和
+ * findPage()，任何不一致都计入失败并使返回码非 0。
+ *
+ * 写者按固定速率追加，整个写入过程持续约 2 秒，让读者在尾块编码与
+ * 双缓冲切换的每个阶段都有足够多的查询。追加本身的耗时、完整索引上
+ * 两种查询的耗时（ns/次）另在单线程下计时。
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "views/PageIndex.h"
+
+namespace bench {
+
+static constexpr uint32_t kDefaultPages = 1400000;
+static constexpr int kDefaultReaders = 2;
+static constexpr uint32_t kTailWindow = 256;  ///< 尾部查询覆盖的页数
+static constexpr double kMinRunMs = 500.0;
+static constexpr double kStressMs = 2000.0;      ///< 并发阶段的写入时长
+static constexpr uint32_t kPaceBatch = 256;      ///< 写者每批页数
+
+/// 确定的页起点序列：中文页长 1400~1600 字节，偶尔夹杂章末短页。
+/// 页长分布决定编码位宽，150 万页在分片上限（2MB）之内
+static std::vector<uint32_t> makeOffsets(uint32_t pages) {
+    std::vector<uint32_t> offsets(pages);
+    uint32_t seed = 2024;
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < pages; i++) {
+        offsets[i] = offset;
+        seed = seed * 1103515245u + 12345u;
+        uint32_t r = (seed >> 8) & 0xFFFF;
+        offset += (r % 512 == 0) ? 40 + r % 400 : 1400 + r % 200;
+    }
+    return offsets;
+}
+
+struct ReaderStats {
+    uint64_t queries = 0;
+    uint64_t failures = 0;
+};
+
+static void readerLoop(const PageIndex& index, const std::vector<uint32_t>& ref,
+                       const std::atomic<bool>& done, uint32_t seed,
+                       ReaderStats* stats) {
+    auto rnd = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return seed >> 4;
+    };
+
+    while (!done.load(std::memory_order_acquire)) {
+        uint32_t count = index.pageCount();
+        if (count == 0) continue;
+
+        // 3/4 的查询落在尾部窗口
+        uint32_t page = rnd() % 4 != 0 || count <= kTailWindow
+                            ? count - 1 - rnd() % std::min(count, kTailWindow)
+                            : rnd() % count;
+
+        if (index.pageOffset(page) != ref[page]) {
+            if (stats->failures++ < 5) {
+                printf("  pageOffset(%u) mismatch at count %u\n", page, count);
+            }
+        }
+
+        // 取不超过已发布最后一页起点的偏移，答案只由前 count 页决定
+        uint32_t last = ref[count - 1];
+        uint32_t lo = ref[page];
+        uint32_t offset = lo + rnd() % (last - lo + 1);
+        uint32_t expect = static_cast<uint32_t>(
+            std::upper_bound(ref.begin(), ref.begin() + count, offset) -
+            ref.begin()) - 1;
+        uint32_t got = index.findPage(offset);
+        if (got != expect) {
+            if (stats->failures++ < 5) {
+                printf("  findPage(%u) = %u, expected %u at count %u\n",
+                       offset, got, expect, count);
+            }
+        }
+        stats->queries += 2;
+    }
+}
+
+int runPageIndex(int argc, char** argv) {
+    uint32_t pages = kDefaultPages;
+    int readers = kDefaultReaders;
+    if (argc > 0) pages = static_cast<uint32_t>(strtoul(argv[0], nullptr, 10));
+    if (argc > 1) readers = atoi(argv[1]);
+    if (pages == 0 || readers < 1) {
+        printf("usage: pageindex [pages] [readers]\n");
+        return 1;
+    }
+
+    std::vector<uint32_t> ref = makeOffsets(pages);
+    printf("PageIndex stress: 1 writer, %d readers, %u pages\n", readers, pages);
+
+    // ── 并发读写 ──
+    PageIndex index;
+    std::atomic<bool> done{false};
+    std::vector<ReaderStats> stats(readers);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers; i++) {
+        threads.emplace_back(readerLoop, std::cref(index), std::cref(ref),
+                             std::cref(done), 7u + i * 7919u, &stats[i]);
+    }
+
+    // 每批写完后等到按时长均摊的时刻
+    double t0 = nowMs();
+    for (uint32_t i = 0; i < pages; i++) {
+        index.addPage(ref[i]);
+        if ((i + 1) % kPaceBatch == 0) {
+            double due = t0 + kStressMs * (i + 1) / pages;
+            while (nowMs() < due) std::this_thread::yield();
+        }
+    }
+    index.markComplete();
+    done.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+
+    uint64_t queries = 0;
+    uint64_t failures = 0;
+    for (const auto& s : stats) {
+        queries += s.queries;
+        failures += s.failures;
+    }
+    bool countOk = index.pageCount() == pages;
+    printf("  readers: %llu queries during %.0f ms of writes, %llu mismatches%s\n",
+           static_cast<unsigned long long>(queries), kStressMs,
+           static_cast<unsigned long long>(failures),
+           countOk ? "" : ", PAGE COUNT WRONG");
+
+    // ── 单线程追加耗时 ──
+    PageIndex solo;
+    t0 = nowMs();
+    for (uint32_t i = 0; i < pages; i++) solo.addPage(ref[i]);
+    double writeMs = nowMs() - t0;
+    printf("  writer:  %.0f ms unpaced (%.1f ns/page), index %u KB (raw %u KB)\n",
+           writeMs, writeMs * 1e6 / pages,
+           static_cast<unsigned>(index.memoryBytes() / 1024),
+           static_cast<unsigned>(pages * sizeof(uint32_t) / 1024));
+
+    // ── 完整索引上的查询耗时 ──
+    uint32_t seed = 99;
+    auto rnd = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return seed >> 4;
+    };
+    uint64_t sink = 0;
+    uint64_t n = 0;
+    t0 = nowMs();
+    double elapsed = 0;
+    while (elapsed < kMinRunMs) {
+        for (int i = 0; i < 10000; i++) sink += index.pageOffset(rnd() % pages);
+        n += 10000;
+        elapsed = nowMs() - t0;
+    }
+    double offsetNs = elapsed * 1e6 / n;
+
+    n = 0;
+    t0 = nowMs();
+    elapsed = 0;
+    while (elapsed < kMinRunMs) {
+        for (int i = 0; i < 10000; i++) sink += index.findPage(rnd() % ref.back());
+        n += 10000;
+        elapsed = nowMs() - t0;
+    }
+    double findNs = elapsed * 1e6 / n;
+    printf("  complete index: pageOffset %.0f ns, findPage %.0f ns (sink %llu)\n",
+           offsetNs, findNs, static_cast<unsigned long long>(sink % 10));
+
+    return failures == 0 && countOk ? 0 : 1;
+}
+
+}  // namespace bench
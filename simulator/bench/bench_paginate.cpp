@@ -0,0 +1,126 @@
+/**
+ * @file bench_paginate.cpp
+ * @brief GBK 书籍"转换 + 分页"端到端基准。
+ *
+ * 以全新缓存目录打开 GBK 文件，按 UI 的方式周期性 onDraw 触发后台分页，
+ * 记录长度扫描完成、数据源 Ready（转换完成）与页索引完成的时刻。分页在
+ * 长度扫描进行中就开始消费已扫描的前缀，扫描完成后按需转换读取；
+ * 页索引完成相对转换完成的差值即流水线尾部延迟。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "bench.h"
+#include "ink_ui/core/Canvas.h"
+#include "ink_ui/hal/DisplayDriver.h"
+#include "text_source/TextSource.h"
+#include "views/ReaderContentView.h"
+
+extern "C" {
+#include "ui_font.h"
+}
+
+namespace bench {
+
+static constexpr uint32_t kDefaultSize = 16 * 1024 * 1024;
+static constexpr int kFontSize = 32;
+
+/// 阅读区尺寸（竖屏全宽，除去状态栏和页脚）
+static constexpr int kViewW = 540;
+static constexpr int kViewH = 880;
+
+/// 模拟 UI 刷新间隔：只用于触发懒分页和轮询计时，不参与流水线
+static constexpr useconds_t kPollUs = 2000;
+
+static int paginateIn(const char* workDir, int argc, char** argv) {
+    char srcPath[256];
+    if (argc > 0) {
+        snprintf(srcPath, sizeof(srcPath), "%s", argv[0]);
+    } else {
+        snprintf(srcPath, sizeof(srcPath), "%s/novel_gbk.txt", workDir);
+        if (!makeGbkFile(srcPath, kDefaultSize)) {
+            fprintf(stderr, "Failed to generate %s\n", srcPath);
+            return 1;
+        }
+    }
+
+    uint32_t srcSize = 0;
+    free(loadFile(srcPath, &srcSize));
+    if (srcSize == 0) {
+        fprintf(stderr, "Cannot read %s\n", srcPath);
+        return 1;
+    }
+    printf("source: %s (%.1f MB)\n", srcPath, srcSize / (1024.0 * 1024.0));
+
+    ui_font_init();
+    const EpdFont* font = ui_font_get(kFontSize);
+    if (!font) {
+        fprintf(stderr, "No %dpx reading font\n", kFontSize);
+        return 1;
+    }
+
+    uint8_t* fb = static_cast<uint8_t*>(
+        calloc(ink::kScreenWidth * ink::kScreenHeight / 2, 1));
+    if (!fb) return 1;
+    ink::Canvas canvas(fb, {0, 0, kViewW, kViewH});
+
+    char cacheDir[280];
+    snprintf(cacheDir, sizeof(cacheDir), "%s/cache", workDir);
+    ink::TextSource source;
+    ReaderContentView view;
+    view.setFrame({0, 0, kViewW, kViewH});
+    view.setFont(font);
+    view.setCacheDir(cacheDir);
+
+    double t0 = nowMs();
+    if (!source.open(srcPath, cacheDir)) {
+        fprintf(stderr, "TextSource open failed\n");
+        free(fb);
+        return 1;
+    }
+    view.setTextSource(&source);
+
+    double sizedMs = 0, convertedMs = 0;
+    while (!view.isPageIndexComplete()) {
+        view.onDraw(canvas);
+        double now = nowMs() - t0;
+        if (sizedMs == 0 && source.totalSize() > 0) sizedMs = now;
+        if (convertedMs == 0 &&
+            source.state() == ink::TextSourceState::Ready) {
+            convertedMs = now;
+        }
+        if (source.state() == ink::TextSourceState::Error) {
+            fprintf(stderr, "TextSource error\n");
+            break;
+        }
+        usleep(kPollUs);
+    }
+    double indexedMs = nowMs() - t0;
+    if (convertedMs == 0) convertedMs = indexedMs;
+
+    int pages = view.totalPages();
+    bool complete = view.isPageIndexComplete();
+    view.setTextSource(nullptr);
+    source.close();
+    free(fb);
+
+    printf("sized       %8.1f ms\n", sizedMs);
+    printf("converted   %8.1f ms\n", convertedMs);
+    printf("indexed     %8.1f ms  (%d pages, +%.1f ms after conversion)\n",
+           indexedMs, pages, indexedMs - convertedMs);
+    return complete ? 0 : 1;
+}
+
+int runPaginate(int argc, char** argv) {
+    char workDir[64];
+    if (!makeWorkDir(workDir)) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    int rc = paginateIn(workDir, argc, argv);
+    removeTree(workDir);
+    return rc;
+}
+
+}  // namespace bench
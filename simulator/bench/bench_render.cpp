@@ -0,0 +1,297 @@
+/**
+ * @file bench_render.cpp
+ * @brief 阅读页绘制基准（ms/页）。
+ *
+ * 把生成的中文小说按阅读页尺寸折行，逐行 Canvas::drawTextN 绘制前若干页。
+ * "cold" 每页之前清空 glyph 缓存，每个字都要解压（相当于缓存引入前）；
+ * "warm" 连续翻页，重复出现的字直接使用缓存。"prewarmed" 每页之前清空
+ * 缓存后用 GlyphCache::prewarm() 预热本页（不计时），相当于后台预热
+ * 赶在翻页之前完成时前台的绘制耗时。"hot" 只取前几页（glyph 全部留在
+ * 缓存中），比较 drawTextN 逐行解码查找与 drawGlyphRun 绘制布局时解码好的
+ * glyph run（含与不含解码耗时）。另输出 glyph 缓存的命中率与占用。
+ * 缓存全部命中时一页的耗时几乎都在 blitGlyph，解码与缓存查找不到 1%，
+ * glyph run 与 drawTextN 的差别在测量噪声之内。
+ *
+ * 默认输入由 makeGbkFile() 生成：3760 个一级汉字均匀随机出现，没有真实
+ * 小说中常用字集中的分布，warm 的命中率与淘汰次数是最坏情况。传入真实
+ * 小说（GBK 或 UTF-8）可得到有代表性的命中率。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "bench.h"
+#include "ink_ui/core/Canvas.h"
+#include "ink_ui/core/GlyphCache.h"
+#include "ink_ui/hal/DisplayDriver.h"
+#include "views/LineMeasurer.h"
+
+extern "C" {
+#include "text_encoding.h"
+#include "ui_font.h"
+}
+
+namespace bench {
+
+static constexpr uint32_t kNovelSize = 512 * 1024;
+static constexpr int kPages = 50;
+static constexpr int kHotPages = 4;   ///< glyph 全部留在缓存中的页数
+static constexpr double kMinRunMs = 500.0;
+static constexpr int kFontSize = 32;
+
+/// 阅读页参数（与 ReaderContentView 默认值一致）
+static constexpr int kViewW = 540;
+static constexpr int kViewH = 880;
+static constexpr int kLineSpacing10x = 16;
+static constexpr int kParagraphSpacing = 8;
+
+/// 一页中的一行
+struct PageLine {
+    uint32_t start;
+    uint32_t end;
+    int y;  ///< 行顶坐标
+};
+
+/// 折出前 maxPages 页，每页为若干行
+static std::vector<std::vector<PageLine>> layoutPages(
+    const LineMeasurer& m, const char* text, uint32_t len, int lh,
+    int maxPages) {
+    std::vector<std::vector<PageLine>> pages;
+    uint32_t pos = 0;
+    while (pos < len && static_cast<int>(pages.size()) < maxPages) {
+        pages.emplace_back();
+        int y = 0;
+        while (pos < len && y + lh <= kViewH) {
+            LineMeasurer::Line line;
+            pos = m.breakLine(text, len, pos, kViewW, &line);
+            pages.back().push_back({line.start, line.end, y});
+            y += lh;
+            if (line.isParagraphEnd) y += kParagraphSpacing;
+        }
+    }
+    return pages;
+}
+
+/// 绘制一页，返回绘制的字节数
+static uint32_t drawPage(ink::Canvas& canvas, const EpdFont* font,
+                         const char* text, const std::vector<PageLine>& page) {
+    uint32_t bytes = 0;
+    canvas.clear(ink::Color::White);
+    for (const auto& line : page) {
+        int len = static_cast<int>(line.end - line.start);
+        if (len <= 0) continue;
+        canvas.drawTextN(font, text + line.start, len, 0,
+                         line.y + font->ascender, ink::Color::Black);
+        bytes += len;
+    }
+    return bytes;
+}
+
+/// 预热一页的全部 glyph
+static void prewarmPage(const EpdFont* font, const char* text,
+                        const std::vector<PageLine>& page, uint32_t epoch) {
+    ink::GlyphCache& cache = ink::GlyphCache::instance();
+    for (const auto& line : page) {
+        uint32_t pos = line.start;
+        while (pos < line.end) {
+            int cLen = LineMeasurer::utf8CharLen(static_cast<uint8_t>(text[pos]));
+            if (pos + cLen > line.end) break;
+            uint32_t cp = LineMeasurer::decodeCodepoint(text + pos, cLen);
+            pos += cLen;
+            if (cp >= 0x20) cache.prewarm(font, cp, epoch);
+        }
+    }
+}
+
+/// 一页的 glyph run：每行在 glyphs 中的起点和个数
+struct PageRuns {
+    std::vector<ink::PositionedGlyph> glyphs;
+    std::vector<int> first;
+    std::vector<int> count;
+};
+
+static void shapePage(const LineMeasurer& m, const char* text,
+                      const std::vector<PageLine>& page, PageRuns* runs) {
+    runs->glyphs.clear();
+    runs->first.clear();
+    runs->count.clear();
+    for (const auto& line : page) {
+        runs->first.push_back(static_cast<int>(runs->glyphs.size()));
+        runs->count.push_back(m.shapeLine(text, line.start, line.end, runs->glyphs));
+    }
+}
+
+static void drawRuns(ink::Canvas& canvas, const EpdFont* font,
+                     const std::vector<PageLine>& page, const PageRuns& runs) {
+    canvas.clear(ink::Color::White);
+    for (size_t i = 0; i < page.size(); i++) {
+        canvas.drawGlyphRun(font, runs.glyphs.data() + runs.first[i],
+                            runs.count[i], 0, page[i].y + font->ascender,
+                            ink::Color::Black);
+    }
+}
+
+/// 重复绘制全部页至少 kMinRunMs，返回 ms/页
+template <typename Fn>
+static double measure(int pages, Fn fn) {
+    int runs = 0;
+    double t0 = nowMs();
+    double elapsed = 0;
+    do {
+        fn();
+        runs++;
+        elapsed = nowMs() - t0;
+    } while (elapsed < kMinRunMs);
+    return elapsed / (static_cast<double>(pages) * runs);
+}
+
+static int renderIn(const char* workDir, int argc, char** argv) {
+    char srcPath[256];
+    bool generated = argc == 0;
+    if (!generated) {
+        snprintf(srcPath, sizeof(srcPath), "%s", argv[0]);
+    } else {
+        snprintf(srcPath, sizeof(srcPath), "%s/novel_gbk.txt", workDir);
+        if (!makeGbkFile(srcPath, kNovelSize)) {
+            fprintf(stderr, "Failed to generate %s\n", srcPath);
+            return 1;
+        }
+    }
+
+    uint32_t srcSize = 0;
+    char* src = loadFile(srcPath, &srcSize);
+    if (!src || srcSize == 0) {
+        fprintf(stderr, "Cannot read %s\n", srcPath);
+        free(src);
+        return 1;
+    }
+    char* text = src;
+    uint32_t len = srcSize;
+    if (text_encoding_detect(src, srcSize) == TEXT_ENCODING_GBK) {
+        size_t capacity = static_cast<size_t>(srcSize) * 3;
+        text = static_cast<char*>(malloc(capacity));
+        size_t outLen = capacity;
+        if (text) text_encoding_gbk_to_utf8(src, srcSize, text, &outLen);
+        len = static_cast<uint32_t>(outLen);
+        free(src);
+        if (!text) return 1;
+    }
+
+    ui_font_init();
+    const EpdFont* font = ui_font_get(kFontSize);
+    if (!font) {
+        fprintf(stderr, "No %dpx reading font\n", kFontSize);
+        free(text);
+        return 1;
+    }
+    LineMeasurer measurer;
+    measurer.setFont(font);
+    int lh = font->advance_y * kLineSpacing10x / 10;
+    if (lh < font->advance_y) lh = font->advance_y;
+
+    auto pages = layoutPages(measurer, text, len, lh, kPages);
+    int pageCount = static_cast<int>(pages.size());
+
+    uint8_t* fb = static_cast<uint8_t*>(
+        calloc(ink::kScreenWidth * ink::kScreenHeight / 2, 1));
+    if (!fb || pageCount == 0) {
+        free(fb);
+        free(text);
+        return 1;
+    }
+    ink::Canvas canvas(fb, {0, 0, kViewW, kViewH});
+    ink::GlyphCache& cache = ink::GlyphCache::instance();
+
+    uint32_t bytes = 0;
+    for (const auto& page : pages) bytes += drawPage(canvas, font, text, page);
+
+    double coldMs = measure(pageCount, [&]() {
+        for (const auto& page : pages) {
+            cache.clear();
+            drawPage(canvas, font, text, page);
+        }
+    });
+
+    // 只计绘制时间，预热不计时
+    double prewarmedTotal = 0;
+    int prewarmedRuns = 0;
+    uint32_t epoch = cache.fontEpoch();
+    do {
+        for (const auto& page : pages) {
+            cache.clear();
+            prewarmPage(font, text, page, epoch);
+            double t0 = nowMs();
+            drawPage(canvas, font, text, page);
+            prewarmedTotal += nowMs() - t0;
+        }
+        prewarmedRuns++;
+    } while (prewarmedTotal < kMinRunMs);
+    double prewarmedMs = prewarmedTotal / (static_cast<double>(pageCount) * prewarmedRuns);
+
+    cache.clear();
+    cache.resetStats();
+    double warmMs = measure(pageCount, [&]() {
+        for (const auto& page : pages) drawPage(canvas, font, text, page);
+    });
+    ink::GlyphCache::Stats s = cache.stats();
+    uint32_t lookups = s.hits + s.misses;
+
+    // glyph run：只取前几页，glyph 全部命中缓存，只比较解码查找与绘制
+    int hotCount = pageCount < kHotPages ? pageCount : kHotPages;
+    std::vector<PageRuns> runs(hotCount);
+    for (int i = 0; i < hotCount; i++) {
+        shapePage(measurer, text, pages[i], &runs[i]);
+        drawPage(canvas, font, text, pages[i]);
+    }
+    double hotTextMs = measure(hotCount, [&]() {
+        for (int i = 0; i < hotCount; i++) drawPage(canvas, font, text, pages[i]);
+    });
+    double hotRunMs = measure(hotCount, [&]() {
+        for (int i = 0; i < hotCount; i++) drawRuns(canvas, font, pages[i], runs[i]);
+    });
+    PageRuns scratch;
+    double hotShapeMs = measure(hotCount, [&]() {
+        for (int i = 0; i < hotCount; i++) {
+            shapePage(measurer, text, pages[i], &scratch);
+            drawRuns(canvas, font, pages[i], scratch);
+        }
+    });
+
+    printf("source: %s, %d pages, %.0f bytes/page\n", srcPath, pageCount,
+           static_cast<double>(bytes) / pageCount);
+    printf("cold cache  %8.3f ms/page\n", coldMs);
+    printf("warm cache  %8.3f ms/page  (%.2fx)\n", warmMs, coldMs / warmMs);
+    printf("prewarmed   %8.3f ms/page  (%.2fx)\n", prewarmedMs,
+           coldMs / prewarmedMs);
+    printf("hot, drawTextN        %8.3f ms/page\n", hotTextMs);
+    printf("hot, glyph runs       %8.3f ms/page  (%.2fx)\n", hotRunMs,
+           hotTextMs / hotRunMs);
+    printf("hot, shape + runs     %8.3f ms/page  (%.2fx)\n", hotShapeMs,
+           hotTextMs / hotShapeMs);
+    printf("glyph cache: %.1f%% hits, %u glyphs, %.1f KB, %u evictions\n",
+           lookups ? s.hits * 100.0 / lookups : 0.0, (unsigned)s.entries,
+           s.bytes / 1024.0, (unsigned)s.evictions);
+    if (generated) {
+        printf("note: generated text uses all 3760 level-1 hanzi uniformly; "
+               "cache hits and evictions are a worst case, pass a real novel "
+               "for typical numbers\n");
+    }
+
+    free(fb);
+    free(text);
+    return 0;
+}
+
+int runRender(int argc, char** argv) {
+    char workDir[64];
+    if (!makeWorkDir(workDir)) {
+        fprintf(stderr, "mkdtemp failed\n");
+        return 1;
+    }
+    int rc = renderIn(workDir, argc, argv);
+    removeTree(workDir);
+    return rc;
+}
+
+}  // namespace bench
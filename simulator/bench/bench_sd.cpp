@@ -0,0 +1,114 @@
+/**
+ * @file bench_sd.cpp
+ * @brief SD 卡带宽模拟 -- 按字节数延迟文件读写。
+ *
+ * 主机的页缓存让文件 I/O 几乎不耗时，转换耗时中读写占多少在主机上
+ * 看不出来。开启模拟后新打开的文件换成 fopencookie 流：每次
+ * 读写先经过一条全局"总线"锁，再按设定带宽睡眠，同一时刻只有一个
+ * 线程在传输，与设备上共用的 SDMMC 总线一致。
+ *
+ * 依赖链接时包装 fopen（-Wl,--wrap=fopen）和 glibc 的 fopencookie，
+ * 只在 Linux 上构建时启用。
+ */
+#include <cstdio>
+#include <cstring>
+
+#include "bench.h"
+
+#ifdef BENCH_SD_MODEL
+
+#include <chrono>
+#include <fcntl.h>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+extern "C" FILE* __real_fopen(const char* path, const char* mode);
+
+namespace bench {
+
+static double sReadMBs = 0;
+static double sWriteMBs = 0;
+static std::mutex sBus;  ///< 模拟的 SD 总线：读写互斥
+
+/// 持有总线锁，按带宽睡眠 bytes 字节的传输时间
+static void transfer(size_t bytes, double mbs) {
+    if (mbs <= 0 || bytes == 0) return;
+    double us = bytes / (mbs * 1024.0 * 1024.0) * 1e6;
+    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long>(us)));
+}
+
+static ssize_t sdRead(void* cookie, char* buf, size_t size) {
+    std::lock_guard<std::mutex> lock(sBus);
+    ssize_t n = ::read(static_cast<int>(reinterpret_cast<intptr_t>(cookie)),
+                       buf, size);
+    if (n > 0) transfer(static_cast<size_t>(n), sReadMBs);
+    return n;
+}
+
+static ssize_t sdWrite(void* cookie, const char* buf, size_t size) {
+    std::lock_guard<std::mutex> lock(sBus);
+    ssize_t n = ::write(static_cast<int>(reinterpret_cast<intptr_t>(cookie)),
+                        buf, size);
+    if (n > 0) transfer(static_cast<size_t>(n), sWriteMBs);
+    return n;
+}
+
+static int sdSeek(void* cookie, off64_t* pos, int whence) {
+    off_t r = lseek(static_cast<int>(reinterpret_cast<intptr_t>(cookie)),
+                    *pos, whence);
+    if (r < 0) return -1;
+    *pos = r;
+    return 0;
+}
+
+static int sdClose(void* cookie) {
+    return ::close(static_cast<int>(reinterpret_cast<intptr_t>(cookie)));
+}
+
+/// fopen 模式串转换为 open() 标志，无法识别时返回 -1
+static int openFlags(const char* mode) {
+    bool plus = strchr(mode, '+') != nullptr;
+    switch (mode[0]) {
+        case 'r': return plus ? O_RDWR : O_RDONLY;
+        case 'w': return (plus ? O_RDWR : O_WRONLY) | O_CREAT | O_TRUNC;
+        case 'a': return (plus ? O_RDWR : O_WRONLY) | O_CREAT | O_APPEND;
+        default: return -1;
+    }
+}
+
+bool setSdModel(double readMBs, double writeMBs) {
+    sReadMBs = readMBs;
+    sWriteMBs = writeMBs;
+    return true;
+}
+
+}  // namespace bench
+
+extern "C" FILE* __wrap_fopen(const char* path, const char* mode) {
+    using namespace bench;
+    int flags = openFlags(mode);
+    if ((sReadMBs <= 0 && sWriteMBs <= 0) || flags < 0) {
+        return __real_fopen(path, mode);
+    }
+
+    int fd = ::open(path, flags, 0644);
+    if (fd < 0) return nullptr;
+    cookie_io_functions_t io = {sdRead, sdWrite, sdSeek, sdClose};
+    FILE* f = fopencookie(reinterpret_cast<void*>(static_cast<intptr_t>(fd)),
+                          mode, io);
+    if (!f) ::close(fd);
+    return f;
+}
+
+#else
+
+namespace bench {
+
+bool setSdModel(double readMBs, double writeMBs) {
+    return readMBs <= 0 && writeMBs <= 0;
+}
+
+}  // namespace bench
+
+#endif
@@ -24,6 +24,7 @@ extern "C" {
 #include "settings_store.h"
 #include "ui_font.h"
 #include "sd_storage.h"
+#include "book_cache.h"
 }
 
 static ink::Application app;
@@ -73,6 +74,7 @@ int main(int argc, char* argv[]) {
     // SD storage stub (sets mounted=true)
     sd_storage_config_t sd_cfg = {};
     sd_storage_mount(&sd_cfg);
+    book_cache_init();
 
     // Init fonts
     fonts.init();
@@ -12,4 +12,16 @@ typedef uint32_t UBaseType_t;
 #define pdPASS pdTRUE
 #define portMAX_DELAY UINT32_MAX
 #define pdMS_TO_TICKS(ms) (ms)
+#define portTICK_PERIOD_MS 1
 #define configSTACK_DEPTH_TYPE uint32_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/// Host CPU count (override with SIM_CORES); tasks run as pthreads, so the
+/// simulator may use every host core where the device has two
+int sim_num_processors(void);
+#ifdef __cplusplus
+}
+#endif
+#define portNUM_PROCESSORS sim_num_processors()
@@ -6,6 +6,9 @@ extern "C" {
 QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
 BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout);
 BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t timeout);
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+void vQueueDelete(QueueHandle_t queue);
 #ifdef __cplusplus
 }
 #endif
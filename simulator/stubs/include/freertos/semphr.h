@@ -4,6 +4,7 @@
 extern "C" {
 #endif
 SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
 BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout);
 BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
 BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* woken);
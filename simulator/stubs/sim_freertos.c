@@ -58,6 +58,12 @@ BaseType_t xTaskCreate(void(*fn)(void*), const char* name,
     return pdPASS;
 }
 
+int sim_num_processors(void) {
+    const char* env = getenv("SIM_CORES");
+    long n = env ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
 void vTaskDelete(TaskHandle_t handle) {
     (void)handle;
     /* Threads are detached; no-op */
@@ -92,6 +98,13 @@ SemaphoreHandle_t xSemaphoreCreateBinary(void) {
     return (SemaphoreHandle_t)s;
 }
 
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    /* No priority inheritance; a mutex is a binary semaphore that starts "full" */
+    SemaphoreHandle_t s = xSemaphoreCreateBinary();
+    if (s) ((sim_sem_t*)s)->value = 1;
+    return s;
+}
+
 BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout) {
     if (!sem) return pdFALSE;
     sim_sem_t* s = (sim_sem_t*)sem;
@@ -266,3 +279,39 @@ BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t timeout)
     pthread_mutex_unlock(&q->mutex);
     return pdTRUE;
 }
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    if (!queue || !item) return pdFALSE;
+    sim_queue_t* q = (sim_queue_t*)queue;
+    pthread_mutex_lock(&q->mutex);
+    if (q->count > 0) {
+        /* 与 FreeRTOS 一致：仅用于长度为 1 的队列，覆盖未取走的项 */
+        memcpy(q->buffer + q->head * q->item_size, item, q->item_size);
+    } else {
+        memcpy(q->buffer + q->tail * q->item_size, item, q->item_size);
+        q->tail = (q->tail + 1) % q->capacity;
+        q->count++;
+    }
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->mutex);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    if (!queue) return 0;
+    sim_queue_t* q = (sim_queue_t*)queue;
+    pthread_mutex_lock(&q->mutex);
+    UBaseType_t count = q->count;
+    pthread_mutex_unlock(&q->mutex);
+    return count;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    if (!queue) return;
+    sim_queue_t* q = (sim_queue_t*)queue;
+    pthread_mutex_destroy(&q->mutex);
+    pthread_cond_destroy(&q->not_empty);
+    pthread_cond_destroy(&q->not_full);
+    free(q->buffer);
+    free(q);
+}
@@ -8,6 +8,11 @@ generate_gbk_table.py
   - 行索引: 首字节 - 0x81 (0x81-0xFE → 0-125, 共 126)
   - 列索引: 次字节 - 0x40 (0x40-0xFE 跳过 0x7F → 0-189, 共 190)
   - 值: Unicode codepoint (uint16_t), 无效映射为 0
+
+输出: components/text_encoding/gbk_utf8_table.c（与 gbk_table.c 同目录）
+预编码表: const uint8_t gbk_utf8_table[126][190][4]
+  - 索引同上
+  - 值: {UTF-8 字节 0-2, 字节数}，无效映射预编码为 U+FFFD (EF BF BD)
 """
 
 import os
@@ -67,6 +72,42 @@ def write_c_file(table, output_path):
         f.write("};\n")
 
 
+def encode_cell(cp):
+    """codepoint → {UTF-8 字节 0-2, 字节数}，无效映射 (0) 编码为 U+FFFD。"""
+    if cp == 0:
+        cp = 0xFFFD
+    utf8 = chr(cp).encode("utf-8")
+    return list(utf8) + [0] * (3 - len(utf8)) + [len(utf8)]
+
+
+def write_utf8_c_file(table, output_path):
+    """将预编码 UTF-8 表写入 C 源文件。"""
+    with open(output_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @file gbk_utf8_table.c\n")
+        f.write(" * @brief GBK→UTF-8 预编码表（由 generate_gbk_table.py 自动生成）。\n")
+        f.write(" *\n")
+        f.write(" * 索引同 gbk_to_unicode。\n")
+        f.write(" * 值: {UTF-8 字节 0-2, 字节数}, 无效映射预编码为 U+FFFD\n")
+        f.write(" */\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("const uint8_t gbk_utf8_table[126][190][4] = {\n")
+
+        for row_idx, row in enumerate(table):
+            hi = row_idx + 0x81
+            f.write(f"    /* 0x{hi:02X} */ {{\n")
+            # 每行 8 个单元
+            for i in range(0, 190, 8):
+                cells = []
+                for cp in row[i : i + 8]:
+                    b = encode_cell(cp)
+                    cells.append(f"{{0x{b[0]:02X},0x{b[1]:02X},0x{b[2]:02X},{b[3]}}}")
+                f.write(f"        {', '.join(cells)},\n")
+            f.write("    },\n")
+
+        f.write("};\n")
+
+
 def verify_table(table):
     """验证关键码点映射正确。"""
     checks = [
@@ -98,7 +139,7 @@ def main():
         project_root, "components", "text_encoding", "gbk_table.c"
     )
 
-    # 允许通过命令行参数指定输出路径
+    # 允许通过命令行参数指定输出路径（预编码表写在同一目录）
     if len(sys.argv) > 1:
         output_path = sys.argv[1]
 
@@ -120,9 +161,14 @@ def main():
     print(f"Writing {output_path}...")
     write_c_file(table, output_path)
 
+    utf8_path = os.path.join(os.path.dirname(output_path), "gbk_utf8_table.c")
+    print(f"Writing {utf8_path}...")
+    write_utf8_c_file(table, utf8_path)
+
     # 计算文件大小
     size_kb = os.path.getsize(output_path) / 1024
-    print(f"Done! Output size: {size_kb:.1f} KB")
+    utf8_kb = os.path.getsize(utf8_path) / 1024
+    print(f"Done! Output size: {size_kb:.1f} KB + {utf8_kb:.1f} KB")
 
 
 if __name__ == "__main__":